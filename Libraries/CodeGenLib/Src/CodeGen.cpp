@@ -10,6 +10,7 @@
 #include <unordered_set>
 #include <algorithm>
 #include <functional>
+#include <tuple>
 
 #include "HMAData.h"
 #include "RTTI/Image.h"
@@ -38,6 +39,7 @@ void CodeGen::WriteFileHeader(std::ostream& p_Stream)
 void CodeGen::Generate(THashMap<ZString, STypeID*, TypeMapHashingPolicy>& p_Types, const std::filesystem::path& p_OutputPath)
 {
 	m_PropertyNames.clear();
+	m_TypeIndex.clear();
 
 	log("Generating code for types...\n");
 
@@ -67,16 +69,13 @@ void CodeGen::Generate(THashMap<ZString, STypeID*, TypeMapHashingPolicy>& p_Type
 	m_ReflectiveClassesHeaderFile << "#include <cstddef>" << std::endl;
 	m_ReflectiveClassesHeaderFile << "#include <ZHM/ZHMPrimitives.h>" << std::endl;
 	m_ReflectiveClassesHeaderFile << "#include <ZHM/ZHMTypeInfo.h>" << std::endl;
+	m_ReflectiveClassesHeaderFile << "#include <ZHM/ZHMTypeTables.h>" << std::endl;
 	m_ReflectiveClassesHeaderFile << std::endl;
 	m_ReflectiveClassesHeaderFile << "class ZHMTypeInfo;" << std::endl;
 	m_ReflectiveClassesHeaderFile << std::endl;
 
 	WriteFileHeader(m_ReflectiveClassesSourceFile);
 	m_ReflectiveClassesSourceFile << "#include \"ZHMGen.h\"" << std::endl;
-	m_ReflectiveClassesSourceFile << "#include \"ZHMProperties.h\"" << std::endl;
-	m_ReflectiveClassesSourceFile << "#include \"ZHMEnums.h\"" << std::endl;
-	m_ReflectiveClassesSourceFile << "#include <External/simdjson_helpers.h>" << std::endl;
-	m_ReflectiveClassesSourceFile << "#include <utility>" << std::endl;
 	m_ReflectiveClassesSourceFile << std::endl;
 
 	log("Registry has %zd types.\n", p_Types.size());
@@ -118,6 +117,7 @@ void CodeGen::Generate(THashMap<ZString, STypeID*, TypeMapHashingPolicy>& p_Type
 		GenerateCode(s_Node, "");
 	}
 
+	GenerateTypeIndex();
 	GeneratePropertyNamesFiles();
 	GenerateEnumsFiles();
 	GenerateTypesJsonFile(p_OutputPath);
@@ -744,141 +744,76 @@ std::string GetEnumUnderlyingType(STypeID* p_Type)
 	}
 }
 
-void GenerateArraySimpleJsonWriter(STypeID* p_ElementType, std::ostream& p_Stream, const std::string& p_ValueName, int p_Depth = 0, const std::string& p_Indentation = "")
+// Dynamic arrays of numbers and booleans are converted in bulk by TArray itself, so their fields are described by
+// the TArray type instead of their elements.
+bool IsBulkJsonArray(STypeID* p_Type)
 {
-	p_Stream << p_Indentation << "\tp_Stream << \"[\";" << std::endl;
-	p_Stream << p_Indentation << "\tfor (size_t i = 0; i < " << p_ValueName << ".size(); ++i)" << std::endl;
-	p_Stream << p_Indentation << "\t{" << std::endl;
-	p_Stream << p_Indentation << "\t\tauto& s_Item" << p_Depth << " = " << p_ValueName << "[i];" << std::endl;
-
-	auto s_ArrayType = reinterpret_cast<IArrayType*>(p_ElementType->typeInfo());
-	auto s_ArrayTypeName = std::string(s_ArrayType->m_pArrayElementType->typeInfo()->m_pTypeName);
+	if (p_Type->typeInfo()->isFixedArray() || !p_Type->typeInfo()->isArray())
+		return false;
+
+	const std::string s_ElementTypeName = reinterpret_cast<IArrayType*>(p_Type->typeInfo())->m_pArrayElementType->typeInfo()->m_pTypeName;
+
+	return s_ElementTypeName == "int8" ||
+		s_ElementTypeName == "uint8" ||
+		s_ElementTypeName == "int16" ||
+		s_ElementTypeName == "uint16" ||
+		s_ElementTypeName == "int32" ||
+		s_ElementTypeName == "uint32" ||
+		s_ElementTypeName == "int64" ||
+		s_ElementTypeName == "uint64" ||
+		s_ElementTypeName == "float32" ||
+		s_ElementTypeName == "float64" ||
+		s_ElementTypeName == "bool";
+}
 
-	if (s_ArrayType->m_pArrayElementType->typeInfo()->m_pTypeName == std::string("ZString"))
-	{
-		p_Stream << p_Indentation << "\t\tp_Stream << simdjson::as_json_string(s_Item" << p_Depth << ");" << std::endl;
-	}
-	else if (s_ArrayType->m_pArrayElementType->typeInfo()->isEnum())
-	{
-		p_Stream << p_Indentation << "\t\tp_Stream << simdjson::as_json_string(ZHMEnums::GetEnumValueName(\"" << s_ArrayTypeName << "\", static_cast<int>(s_Item" << p_Depth << ")));" << std::endl;
-	}
-	else if (s_ArrayType->m_pArrayElementType->typeInfo()->isArray() || s_ArrayType->m_pArrayElementType->typeInfo()->isFixedArray())
-	{
-		GenerateArraySimpleJsonWriter(s_ArrayType->m_pArrayElementType, p_Stream, "s_Item" + std::to_string(p_Depth), p_Depth + 1, p_Indentation + "\t");
-	}
-	else if (s_ArrayType->m_pArrayElementType->typeInfo()->isPrimitive())
-	{
-		p_Stream << p_Indentation << "\t\tp_Stream << simdjson::as_json_string(s_Item" << p_Depth << ");" << std::endl;
-	}
-	else
-	{
-		p_Stream << p_Indentation << "\t\t" << NormalizeName(s_ArrayType->m_pArrayElementType) << "::WriteSimpleJson(&s_Item" << p_Depth << ", p_Stream);" << std::endl;
-	}
+// Dynamic arrays of structs are written and parsed by TArray itself, so large ones can be split across the worker pool.
+bool IsStructJsonArray(STypeID* p_Type)
+{
+	if (p_Type->typeInfo()->isFixedArray() || !p_Type->typeInfo()->isArray())
+		return false;
 
-	p_Stream << std::endl;
-	p_Stream << p_Indentation << "\t\tif (i < " << p_ValueName << ".size() - 1)" << std::endl;
-	p_Stream << p_Indentation << "\t\t\tp_Stream << \",\";" << std::endl;
+	const auto s_ElementTypeInfo = reinterpret_cast<IArrayType*>(p_Type->typeInfo())->m_pArrayElementType->typeInfo();
 
-	p_Stream << p_Indentation << "\t}" << std::endl;
-	p_Stream << std::endl;
-	p_Stream << p_Indentation << "\tp_Stream << \"]\";" << std::endl;
+	return s_ElementTypeInfo->m_pTypeName != std::string("ZString") &&
+		!s_ElementTypeInfo->isEnum() &&
+		!s_ElementTypeInfo->isArray() &&
+		!s_ElementTypeInfo->isFixedArray() &&
+		!s_ElementTypeInfo->isPrimitive();
 }
 
-void GenerateArraySimpleJsonReader(STypeID* p_ElementType, std::ostream& p_Stream, const std::string& p_ValueName, const std::string& p_ArrayName, int p_Depth = 0, const std::string& p_Indentation = "")
+// Returns the ZHMFieldType expression describing a property (or an element of one) of type [p_Type]. Arrays whose
+// elements are converted by the interpreter instead of TArray need their element type as a separate constant. That's
+// written to [p_Stream] and named [p_ConstantName] followed by "Element".
+std::string GenerateFieldType(STypeID* p_Type, const std::string& p_PropName, const std::string& p_ConstantName, std::ostream& p_Stream)
 {
-	auto s_ArrayType = reinterpret_cast<IArrayType*>(p_ElementType->typeInfo());
-	auto s_ArrayTypeName = std::string(s_ArrayType->m_pArrayElementType->typeInfo()->m_pTypeName);
-	auto s_NormalizedArrayType = NormalizeName(s_ArrayType->m_pArrayElementType);
+	auto s_TypeInfo = p_Type->typeInfo();
 
-	if (s_ArrayType->isFixedArray())
+	if (s_TypeInfo->isFixedArray())
 	{
-		p_Stream << p_Indentation << "\t{" << std::endl;
-		p_Stream << p_Indentation << "\tsize_t s_Index" << p_Depth << " = 0;" << std::endl;
-		p_Stream << p_Indentation << "\tfor (simdjson::ondemand::value s_Item" << p_Depth << " : " << p_ArrayName << ")" << std::endl;
-		p_Stream << p_Indentation << "\t{" << std::endl;
+		auto s_ArrayType = reinterpret_cast<IArrayType*>(s_TypeInfo);
+		auto s_ElementType = GenerateFieldType(s_ArrayType->m_pArrayElementType, "", p_ConstantName, p_Stream);
 
-		if (s_ArrayType->m_pArrayElementType->typeInfo()->m_pTypeName == std::string("ZString"))
-		{
-			p_Stream << p_Indentation << "\t\t" << p_ValueName << "[s_Index" << p_Depth << "] = std::string_view(s_Item" << p_Depth << ");" << std::endl;
-		}
-		else if (s_ArrayType->m_pArrayElementType->typeInfo()->isEnum())
-		{
-			p_Stream << p_Indentation << "\t\t" << p_ValueName << "[s_Index" << p_Depth << "] = static_cast<" << s_NormalizedArrayType << ">(ZHMEnums::GetEnumValueByName(\"" << s_ArrayTypeName << "\", std::string_view(s_Item" << p_Depth << ")));" << std::endl;
-		}
-		else if (s_ArrayType->m_pArrayElementType->typeInfo()->isArray() || s_ArrayType->m_pArrayElementType->typeInfo()->isFixedArray())
-		{
-			GenerateArraySimpleJsonReader(
-				s_ArrayType->m_pArrayElementType,
-				p_Stream,
-				p_ValueName + "[s_Index" + std::to_string(p_Depth) + "]",
-				"s_Item" + std::to_string(p_Depth),
-				p_Depth + 1,
-				p_Indentation + "\t"
-			);
-		}
-		else if (s_ArrayType->m_pArrayElementType->typeInfo()->isPrimitive())
-		{
-			if (s_ArrayTypeName == "char")
-				s_ArrayTypeName = "int8";
+		return "ZHMFieldType::FixedArray(" + s_ElementType + ", " + std::to_string(s_ArrayType->fixedArraySize()) + ")";
+	}
 
-			p_Stream << p_Indentation << "\t\t" << p_ValueName << "[s_Index" << p_Depth << "] = simdjson::from_json_" << s_ArrayTypeName << "(s_Item" << p_Depth << ");" << std::endl;
-		}
-		else
-		{
-			p_Stream << p_Indentation << "\t\t" << s_NormalizedArrayType << "::FromSimpleJson(s_Item" << p_Depth << ", &" << p_ValueName << "[s_Index" << p_Depth << "]);" << std::endl;
-		}
+	if (s_TypeInfo->isArray() && !IsBulkJsonArray(p_Type) && !IsStructJsonArray(p_Type))
+	{
+		auto s_ElementType = reinterpret_cast<IArrayType*>(s_TypeInfo)->m_pArrayElementType;
+		auto s_ElementConstant = p_ConstantName + "Element";
+		auto s_ElementFieldType = GenerateFieldType(s_ElementType, "", s_ElementConstant, p_Stream);
 
-		p_Stream << p_Indentation << "\t\t++s_Index" << p_Depth << ";" << std::endl;
+		p_Stream << "static constexpr ZHMFieldType " << s_ElementConstant << " = " << s_ElementFieldType << ";" << std::endl;
 
-		p_Stream << p_Indentation << "\t}" << std::endl;
-		p_Stream << p_Indentation << "\t}" << std::endl;
+		return "ZHMFieldType::Array<" + NormalizeName(s_ElementType) + ">(" + s_ElementConstant + ")";
 	}
-	else
-	{
-		p_Stream << p_Indentation << "\t{" << std::endl;
-		p_Stream << p_Indentation << "\tsimdjson::ondemand::array s_Array" << p_Depth << " = " << p_ArrayName << ";" << std::endl;
-		p_Stream << p_Indentation << "\t" << p_ValueName << ".resize(s_Array" << p_Depth << ".count_elements());" << std::endl;
-		p_Stream << p_Indentation << "\tsize_t s_Index" << p_Depth << " = 0;" << std::endl;
-		p_Stream << std::endl;
-		p_Stream << p_Indentation << "\tfor (simdjson::ondemand::value s_Item" << p_Depth << " : s_Array" << p_Depth << ")" << std::endl;
-		p_Stream << p_Indentation << "\t{" << std::endl;
-
-		if (s_ArrayType->m_pArrayElementType->typeInfo()->m_pTypeName == std::string("ZString"))
-		{
-			p_Stream << p_Indentation << "\t\t" << p_ValueName << "[s_Index" << p_Depth << "] = std::string_view(s_Item" << p_Depth << ");" << std::endl;
-		}
-		else if (s_ArrayType->m_pArrayElementType->typeInfo()->isEnum())
-		{
-			p_Stream << p_Indentation << "\t\t" << p_ValueName << "[s_Index" << p_Depth << "] = static_cast<" << s_NormalizedArrayType << ">(ZHMEnums::GetEnumValueByName(\"" << s_ArrayTypeName << "\", std::string_view(s_Item" << p_Depth << ")));" << std::endl;
-		}
-		else if (s_ArrayType->m_pArrayElementType->typeInfo()->isArray() || s_ArrayType->m_pArrayElementType->typeInfo()->isFixedArray())
-		{
-			GenerateArraySimpleJsonReader(
-				s_ArrayType->m_pArrayElementType,
-				p_Stream,
-				p_ValueName + "[s_Index" + std::to_string(p_Depth) + "]",
-				"s_Item" + std::to_string(p_Depth),
-				p_Depth + 1,
-				p_Indentation + "\t"
-			);
-		}
-		else if (s_ArrayType->m_pArrayElementType->typeInfo()->isPrimitive())
-		{
-			if (s_ArrayTypeName == "char")
-				s_ArrayTypeName = "int8";
 
-			p_Stream << p_Indentation << "\t\t" << p_ValueName << "[s_Index" << p_Depth << "] = simdjson::from_json_" << s_ArrayTypeName << "(s_Item" << p_Depth << ");" << std::endl;
-		}
-		else
-		{
-			p_Stream << p_Indentation << "\t\t" << s_NormalizedArrayType << "::FromSimpleJson(s_Item" << p_Depth << ", &" << p_ValueName << "[s_Index" << p_Depth << "]);" << std::endl;
-		}
+	if (s_TypeInfo->isEnum())
+		return "ZHMFieldType::Enum<" + NormalizeName(p_Type) + ">(\"" + s_TypeInfo->m_pTypeName + "\")";
 
-		p_Stream << p_Indentation << "\t\t++s_Index" << p_Depth << ";" << std::endl;
+	if (s_TypeInfo->isPrimitive() && p_PropName == "nPropertyID")
+		return "ZHMFieldType::PropertyId()";
 
-		p_Stream << p_Indentation << "\t}" << std::endl;
-		p_Stream << p_Indentation << "\t}" << std::endl;
-	}
+	return "ZHMFieldType::Of<" + NormalizeName(p_Type) + ">()";
 }
 
 void CodeGen::GeneratePropertyNamesFiles()
@@ -887,14 +822,13 @@ void CodeGen::GeneratePropertyNamesFiles()
 	m_PropertyNamesHeaderFile << "#pragma once" << std::endl;
 	m_PropertyNamesHeaderFile << std::endl;
 	m_PropertyNamesHeaderFile << "#include <cstdint>" << std::endl;
+	m_PropertyNamesHeaderFile << "#include <mutex>" << std::endl;
 	m_PropertyNamesHeaderFile << "#include <unordered_map>" << std::endl;
 	m_PropertyNamesHeaderFile << "#include <vector>" << std::endl;
 	m_PropertyNamesHeaderFile << "#include <string>" << std::endl;
 	m_PropertyNamesHeaderFile << std::endl;
 	m_PropertyNamesHeaderFile << "#include <ZHM/Hash.h>" << std::endl;
 	m_PropertyNamesHeaderFile << std::endl;
-	m_PropertyNamesHeaderFile << "struct ZHMPropertyRegistrar;" << std::endl;
-	m_PropertyNamesHeaderFile << std::endl;
 	m_PropertyNamesHeaderFile << "class ZHMProperties" << std::endl;
 	m_PropertyNamesHeaderFile << "{" << std::endl;
 	m_PropertyNamesHeaderFile << "public:" << std::endl;
@@ -904,35 +838,27 @@ void CodeGen::GeneratePropertyNamesFiles()
 	m_PropertyNamesHeaderFile << "private:" << std::endl;
 	m_PropertyNamesHeaderFile << "\tstatic void RegisterProperties();" << std::endl;
 	m_PropertyNamesHeaderFile << "\tstatic std::unordered_map<uint32_t, std::string_view>* g_Properties;" << std::endl;
+	m_PropertyNamesHeaderFile << "\tstatic std::once_flag g_PropertiesRegistered;" << std::endl;
 	m_PropertyNamesHeaderFile << "\tstatic const uint8_t g_PropertiesData[];" << std::endl;
 	m_PropertyNamesHeaderFile << "\tstatic const size_t g_PropertiesDataSize;" << std::endl;
 	m_PropertyNamesHeaderFile << "\tstatic const size_t g_PropertiesCount;" << std::endl;
 	m_PropertyNamesHeaderFile << "\tstatic const uint8_t g_CustomPropertiesData[];" << std::endl;
 	m_PropertyNamesHeaderFile << "\tstatic const size_t g_CustomPropertiesDataSize;" << std::endl;
 	m_PropertyNamesHeaderFile << "\tstatic const size_t g_CustomPropertiesCount;" << std::endl;
-	m_PropertyNamesHeaderFile << std::endl;
-	m_PropertyNamesHeaderFile << "\tfriend class ZHMPropertyRegistrar;" << std::endl;
-	m_PropertyNamesHeaderFile << "};" << std::endl;
-	m_PropertyNamesHeaderFile << std::endl;
-	m_PropertyNamesHeaderFile << "struct ZHMPropertyRegistrar" << std::endl;
-	m_PropertyNamesHeaderFile << "{" << std::endl;
-	m_PropertyNamesHeaderFile << "\tZHMPropertyRegistrar()" << std::endl;
-	m_PropertyNamesHeaderFile << "\t{" << std::endl;
-	m_PropertyNamesHeaderFile << "\t\tZHMProperties::RegisterProperties();" << std::endl;
-	m_PropertyNamesHeaderFile << "\t}" << std::endl;
 	m_PropertyNamesHeaderFile << "};" << std::endl;
 	m_PropertyNamesHeaderFile << std::endl;
-	m_PropertyNamesHeaderFile << "extern ZHMPropertyRegistrar g_PropertyRegistrar;" << std::endl;
-	m_PropertyNamesHeaderFile << std::endl;
 
 	WriteFileHeader(m_PropertyNamesSourceFile);
 	m_PropertyNamesSourceFile << "#include \"ZHMProperties.h\"" << std::endl;
 	m_PropertyNamesSourceFile << "#include <Util/BinaryStreamReader.h>" << std::endl;
 	m_PropertyNamesSourceFile << std::endl;
 	m_PropertyNamesSourceFile << "std::unordered_map<uint32_t, std::string_view>* ZHMProperties::g_Properties = nullptr;" << std::endl;
+	m_PropertyNamesSourceFile << "std::once_flag ZHMProperties::g_PropertiesRegistered;" << std::endl;
 	m_PropertyNamesSourceFile << std::endl;
 	m_PropertyNamesSourceFile << "std::string ZHMProperties::PropertyToString(uint32_t p_PropertyId)" << std::endl;
 	m_PropertyNamesSourceFile << "{" << std::endl;
+	m_PropertyNamesSourceFile << "\tstd::call_once(g_PropertiesRegistered, RegisterProperties);" << std::endl;
+	m_PropertyNamesSourceFile << std::endl;
 	m_PropertyNamesSourceFile << "\tauto it = g_Properties->find(p_PropertyId);" << std::endl;
 	m_PropertyNamesSourceFile << std::endl;
 	m_PropertyNamesSourceFile << "\tif (it == g_Properties->end())" << std::endl;
@@ -943,6 +869,8 @@ void CodeGen::GeneratePropertyNamesFiles()
 	m_PropertyNamesSourceFile << std::endl;
 	m_PropertyNamesSourceFile << "std::string_view ZHMProperties::PropertyToStringView(uint32_t p_PropertyId)" << std::endl;
 	m_PropertyNamesSourceFile << "{" << std::endl;
+	m_PropertyNamesSourceFile << "\tstd::call_once(g_PropertiesRegistered, RegisterProperties);" << std::endl;
+	m_PropertyNamesSourceFile << std::endl;
 	m_PropertyNamesSourceFile << "\tauto it = g_Properties->find(p_PropertyId);" << std::endl;
 	m_PropertyNamesSourceFile << std::endl;
 	m_PropertyNamesSourceFile << "\tif (it == g_Properties->end())" << std::endl;
@@ -971,8 +899,6 @@ void CodeGen::GeneratePropertyNamesFiles()
 	m_PropertyNamesSourceFile << "\t}" << std::endl;
 	m_PropertyNamesSourceFile << "}" << std::endl;
 	m_PropertyNamesSourceFile << std::endl;
-	m_PropertyNamesSourceFile << "ZHMPropertyRegistrar g_PropertyRegistrar = ZHMPropertyRegistrar();" << std::endl;
-	m_PropertyNamesSourceFile << std::endl;
 
 	for (auto& s_Property : m_PropertyNames)
 	{
@@ -986,16 +912,16 @@ void CodeGen::GenerateEnumsFiles()
 	m_EnumsHeaderFile << "#pragma once" << std::endl;
 	m_EnumsHeaderFile << std::endl;
 	m_EnumsHeaderFile << "#include <cstdint>" << std::endl;
+	m_EnumsHeaderFile << "#include <mutex>" << std::endl;
 	m_EnumsHeaderFile << "#include <unordered_map>" << std::endl;
 	m_EnumsHeaderFile << "#include <string>" << std::endl;
 	m_EnumsHeaderFile << std::endl;
 	m_EnumsHeaderFile << "class ZHMEnums" << std::endl;
 	m_EnumsHeaderFile << "{" << std::endl;
 	m_EnumsHeaderFile << "private:" << std::endl;
-	m_EnumsHeaderFile << "\tstruct EnumRegistrar { EnumRegistrar() { RegisterEnums(); } };" << std::endl;
 	m_EnumsHeaderFile << "\tstatic std::unordered_map<std::string, std::unordered_map<int32_t, std::string>>* g_Enums;" << std::endl;
 	m_EnumsHeaderFile << "\tstatic std::unordered_map<std::string, uint32_t>* g_EnumSizes;" << std::endl;
-	m_EnumsHeaderFile << "\tstatic EnumRegistrar g_Registrar;" << std::endl;
+	m_EnumsHeaderFile << "\tstatic std::once_flag g_EnumsRegistered;" << std::endl;
 	m_EnumsHeaderFile << "\tstatic void RegisterEnums();" << std::endl;
 	m_EnumsHeaderFile << std::endl;
 	m_EnumsHeaderFile << "public:" << std::endl;
@@ -1011,11 +937,13 @@ void CodeGen::GenerateEnumsFiles()
 	m_EnumsSourceFile << std::endl;
 	m_EnumsSourceFile << "std::unordered_map<std::string, std::unordered_map<int32_t, std::string>>* ZHMEnums::g_Enums = nullptr;" << std::endl;
 	m_EnumsSourceFile << "std::unordered_map<std::string, uint32_t>* ZHMEnums::g_EnumSizes = nullptr;" << std::endl;
-	m_EnumsSourceFile << "ZHMEnums::EnumRegistrar ZHMEnums::g_Registrar;" << std::endl;
+	m_EnumsSourceFile << "std::once_flag ZHMEnums::g_EnumsRegistered;" << std::endl;
 	m_EnumsSourceFile << std::endl;
 
 	m_EnumsSourceFile << "std::string ZHMEnums::GetEnumValueName(const std::string& p_TypeName, int32_t p_Value)" << std::endl;
 	m_EnumsSourceFile << "{" << std::endl;
+	m_EnumsSourceFile << "\tstd::call_once(g_EnumsRegistered, RegisterEnums);" << std::endl;
+	m_EnumsSourceFile << std::endl;
 	m_EnumsSourceFile << "\tauto s_EnumIt = g_Enums->find(p_TypeName);" << std::endl;
 	m_EnumsSourceFile << std::endl;
 	m_EnumsSourceFile << "\tif (s_EnumIt == g_Enums->end())" << std::endl;
@@ -1032,6 +960,8 @@ void CodeGen::GenerateEnumsFiles()
 
 	m_EnumsSourceFile << "int32_t ZHMEnums::GetEnumValueByName(const std::string& p_TypeName, std::string_view p_Name)" << std::endl;
 	m_EnumsSourceFile << "{" << std::endl;
+	m_EnumsSourceFile << "\tstd::call_once(g_EnumsRegistered, RegisterEnums);" << std::endl;
+	m_EnumsSourceFile << std::endl;
 	m_EnumsSourceFile << "\tauto s_EnumIt = g_Enums->find(p_TypeName);" << std::endl;
 	m_EnumsSourceFile << std::endl;
 	m_EnumsSourceFile << "\tif (s_EnumIt == g_Enums->end())" << std::endl;
@@ -1047,12 +977,16 @@ void CodeGen::GenerateEnumsFiles()
 
 	m_EnumsSourceFile << "bool ZHMEnums::IsTypeNameEnum(const std::string& p_TypeName)" << std::endl;
 	m_EnumsSourceFile << "{" << std::endl;
+	m_EnumsSourceFile << "\tstd::call_once(g_EnumsRegistered, RegisterEnums);" << std::endl;
+	m_EnumsSourceFile << std::endl;
 	m_EnumsSourceFile << "\treturn g_Enums->find(p_TypeName) != g_Enums->end();" << std::endl;
 	m_EnumsSourceFile << "}" << std::endl;
 	m_EnumsSourceFile << std::endl;
 
 	m_EnumsSourceFile << "uint32_t ZHMEnums::GetEnumSize(const std::string& p_TypeName)" << std::endl;
 	m_EnumsSourceFile << "{" << std::endl;
+	m_EnumsSourceFile << "\tstd::call_once(g_EnumsRegistered, RegisterEnums);" << std::endl;
+	m_EnumsSourceFile << std::endl;
 	m_EnumsSourceFile << "\tauto s_It = g_EnumSizes->find(p_TypeName);" << std::endl;
 	m_EnumsSourceFile << std::endl;
 	m_EnumsSourceFile << "\tif (s_It == g_EnumSizes->end())" << std::endl;
@@ -1086,6 +1020,47 @@ void CodeGen::GenerateEnumsFiles()
 	m_EnumsSourceFile << std::endl;
 }
 
+// Same as Hash::Crc32 in ResourceLib, which is what the type index is looked up with.
+static uint32_t Crc32(const std::string& p_Data)
+{
+	uint32_t s_Hash = 0xFFFFFFFF;
+
+	for (char c : p_Data)
+	{
+		s_Hash ^= static_cast<uint8_t>(c);
+
+		for (int i = 0; i < 8; ++i)
+			s_Hash = (s_Hash >> 1) ^ (0xEDB88320 & (0 - (s_Hash & 1)));
+	}
+
+	return s_Hash ^ 0xFFFFFFFF;
+}
+
+void CodeGen::GenerateTypeIndex()
+{
+	std::vector<std::tuple<uint32_t, std::string, std::string>> s_Entries;
+
+	for (auto& [s_TypeName, s_NormalizedName] : m_TypeIndex)
+		s_Entries.emplace_back(Crc32(s_TypeName), s_TypeName, s_NormalizedName);
+
+	std::ranges::sort(s_Entries);
+
+	m_ReflectiveClassesSourceFile << "static constexpr ZHMTypeIndexEntry g_TypeIndex[] =" << std::endl;
+	m_ReflectiveClassesSourceFile << "{" << std::endl;
+
+	for (auto& [s_Hash, s_TypeName, s_NormalizedName] : s_Entries)
+	{
+		char s_HashStr[16];
+		snprintf(s_HashStr, sizeof(s_HashStr), "0x%08X", s_Hash);
+
+		m_ReflectiveClassesSourceFile << "\t{ " << s_HashStr << ", &" << s_NormalizedName << "::TypeInfo }," << std::endl;
+	}
+
+	m_ReflectiveClassesSourceFile << "};" << std::endl;
+	m_ReflectiveClassesSourceFile << std::endl;
+	m_ReflectiveClassesSourceFile << "constinit const std::span<const ZHMTypeIndexEntry> IZHMTypeInfo::g_GeneratedTypes = g_TypeIndex;" << std::endl;
+}
+
 static std::string EscapeJsonString(const std::string& p_Input)
 {
 	std::string s_Result;
@@ -1274,6 +1249,50 @@ bool CodeGen::ShouldForceJsonEmit(const std::string& p_TypeName)
 		|| p_TypeName.starts_with("SCondition_");
 }
 
+bool CodeGen::IsRelocationFree(STypeID* p_Type)
+{
+	auto* s_TypeInfo = p_Type->typeInfo();
+
+	if (!s_TypeInfo)
+		return false;
+
+	if (s_TypeInfo->isEnum())
+		return true;
+
+	if (s_TypeInfo->isFixedArray())
+		return IsRelocationFree(reinterpret_cast<IArrayType*>(s_TypeInfo)->m_pArrayElementType);
+
+	const std::string s_TypeName = s_TypeInfo->m_pTypeName;
+
+	if (const auto it = m_RelocationFreeTypes.find(s_TypeName); it != m_RelocationFreeTypes.end())
+		return it->second;
+
+	// Strings, variants, type ids and resource pointers all need patching, but these don't.
+	static const std::unordered_set<std::string> s_RelocationFreePrimitives = {
+		"int8", "uint8", "int16", "uint16", "int32", "uint32", "int64", "uint64", "float32", "float64", "bool", "ZRepositoryID",
+	};
+
+	if (s_RelocationFreePrimitives.contains(s_TypeName))
+		return true;
+
+	// Templated types (arrays, maps, resource pointers, ...) are never generated, and runtime resource
+	// ids get registered with the serializer.
+	if (!s_TypeInfo->isClass() || s_TypeInfo->isArray() || s_TypeName.find('<') != std::string::npos || s_TypeName == "ZRuntimeResourceID")
+		return m_RelocationFreeTypes[s_TypeName] = false;
+
+	auto* s_Type = reinterpret_cast<IClassType*>(s_TypeInfo);
+
+	if (s_Type->m_nBaseClassCount > 0 || s_Type->m_nInterfaceCount > 0)
+		return m_RelocationFreeTypes[s_TypeName] = false;
+
+	bool s_IsRelocationFree = true;
+
+	for (uint16_t i = 0; i < s_Type->m_nPropertyCount && s_IsRelocationFree; ++i)
+		s_IsRelocationFree = IsRelocationFree(s_Type->m_pProperties[i].m_pType);
+
+	return m_RelocationFreeTypes[s_TypeName] = s_IsRelocationFree;
+}
+
 void CodeGen::EmitJsonStruct(const std::shared_ptr<TreeNode>& p_Node)
 {
 	if (!p_Node || !p_Node->TypeData)
@@ -1428,14 +1447,17 @@ void CodeGen::GenerateRlClassHeader(const std::shared_ptr<TreeNode>& p_Node, con
 		s_HeaderStream << p_Indent << "public:" << std::endl;
 	}
 
-	s_HeaderStream << p_Indent << "\tstatic ZHMTypeInfo TypeInfo;" << std::endl;
-	s_HeaderStream << p_Indent << "\tstatic void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);" << std::endl;
-	s_HeaderStream << p_Indent << "\tstatic void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);" << std::endl;
-	s_HeaderStream << p_Indent << "\tstatic void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);" << std::endl;
-	s_HeaderStream << p_Indent << "\tstatic bool Equals(void* p_Left, void* p_Right);" << std::endl;
-	s_HeaderStream << p_Indent << "\tstatic void Destroy(void* p_Object);" << std::endl;
+	s_HeaderStream << p_Indent << "\tstatic ZHMTableTypeInfo TypeInfo;" << std::endl;
+
+	if (IsRelocationFree(p_Node->TypeData))
+		s_HeaderStream << p_Indent << "\tstatic constexpr bool IsRelocationFree = true;" << std::endl;
+
+	// Everything is done by the type info, which walks the field table emitted in the source file.
+	s_HeaderStream << p_Indent << "\tstatic void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }" << std::endl;
+	s_HeaderStream << p_Indent << "\tstatic void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }" << std::endl;
+	s_HeaderStream << p_Indent << "\tstatic void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }" << std::endl;
 	s_HeaderStream << std::endl;
-	s_HeaderStream << p_Indent << "\tbool operator==(const " << p_Node->Name << "& p_Other) const;" << std::endl;
+	s_HeaderStream << p_Indent << "\tbool operator==(const " << p_Node->Name << "& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }" << std::endl;
 	s_HeaderStream << p_Indent << "\tbool operator!=(const " << p_Node->Name << "& p_Other) const { return !(*this == p_Other); }" << std::endl;
 	s_HeaderStream << std::endl;
 
@@ -1498,211 +1520,49 @@ void CodeGen::GenerateRlClassSource(const std::shared_ptr<TreeNode>& p_Node)
 	std::string s_TypeName = s_Type->m_pTypeName;
 	std::string s_NormalizedName = p_Node->FullName();
 
-	s_SourceStream << "ZHMTypeInfo " << s_NormalizedName << "::TypeInfo = ZHMTypeInfo(\"" << s_TypeName << "\", sizeof(" << s_NormalizedName << "), alignof(" << s_NormalizedName << "), " << s_NormalizedName << "::WriteSimpleJson, " << s_NormalizedName << "::FromSimpleJson, " << s_NormalizedName << "::Serialize, " << s_NormalizedName << "::Equals, " << s_NormalizedName << "::Destroy);" << std::endl;
-	s_SourceStream << std::endl;
+	m_TypeIndex.emplace_back(s_TypeName, s_NormalizedName);
 
-	s_SourceStream << "void " << s_NormalizedName << "::WriteSimpleJson(void* p_Object, std::ostream& p_Stream)" << std::endl;
-	s_SourceStream << "{" << std::endl;
+	// Constants are named after the full name of the type, which is unique.
+	std::string s_ConstantName = "c_" + std::regex_replace(s_NormalizedName, std::regex("::"), "_");
+	std::string s_TableName = s_ConstantName + "Fields";
 
-	// TODO: Support for inherited classes.
-
-	s_SourceStream << "\tauto* s_Object = reinterpret_cast<" << s_NormalizedName << "*>(p_Object);" << std::endl;
-	s_SourceStream << std::endl;
-
-	s_SourceStream << "\tp_Stream << \"{\";" << std::endl;
-	s_SourceStream << std::endl;
-
-	/*s_SourceStream << "\tp_Stream << \"\\\"$id\\\":\" << simdjson::get_obj_id(s_Object)";
-
-	if (s_Type->m_nPropertyCount > 0)
-		s_SourceStream << " << \",\"";
-
-	s_SourceStream << ";";
-	s_SourceStream << std::endl;*/
+	// The field table, which ZHMTableTypeInfo walks to convert, serialize, compare and destroy objects of this type.
+	std::ostringstream s_Fields;
+	bool s_HasFields = false;
 
 	for (uint16_t i = 0; i < s_Type->m_nPropertyCount; ++i)
 	{
 		auto s_Prop = s_Type->m_pProperties[i];
-		auto s_PropTypeName = std::string(s_Prop.m_pType->typeInfo()->m_pTypeName);
 
-		if (s_PropTypeName == std::string("TArray"))
+		if (s_Prop.m_pType->typeInfo()->m_pTypeName == std::string("TArray"))
 			continue;
 
 		std::string s_PropName = s_Prop.m_pName;
+		auto s_FieldType = GenerateFieldType(s_Prop.m_pType, s_PropName, s_ConstantName + "_" + s_PropName, s_SourceStream);
 
-		s_SourceStream << "\tp_Stream << simdjson::as_json_string(\"" << s_PropName << "\") << \":\";" << std::endl;
-
-		if (s_Prop.m_pType->typeInfo()->m_pTypeName == std::string("ZString"))
-		{
-			s_SourceStream << "\tp_Stream << simdjson::as_json_string(s_Object->" << s_PropName << ");" << std::endl;
-		}
-		else if (s_Prop.m_pType->typeInfo()->isEnum())
-		{
-			s_SourceStream << "\tp_Stream << simdjson::as_json_string(ZHMEnums::GetEnumValueName(\"" << s_PropTypeName << "\", static_cast<int>(s_Object->" << s_PropName << ")));" << std::endl;
-		}
-		else if (s_Prop.m_pType->typeInfo()->isArray() || s_Prop.m_pType->typeInfo()->isFixedArray())
-		{
-			GenerateArraySimpleJsonWriter(s_Prop.m_pType, s_SourceStream, "s_Object->" + s_PropName);
-		}
-		else if (s_Prop.m_pType->typeInfo()->isPrimitive())
-		{
-			if (s_PropName == "nPropertyID")
-			{
-				s_SourceStream << "\t{" << std::endl;
-				s_SourceStream << "\t\tauto s_PropertyName = ZHMProperties::PropertyToString(s_Object->" << s_PropName << ");" << std::endl;
-				s_SourceStream << std::endl;
-				s_SourceStream << "\t\tif (s_PropertyName.size() == 0)" << std::endl;
-				s_SourceStream << "\t\t\tp_Stream << simdjson::as_json_string(s_Object->" << s_PropName << ");" << std::endl;
-				s_SourceStream << "\t\telse" << std::endl;
-				s_SourceStream << "\t\t\tp_Stream << simdjson::as_json_string(s_PropertyName);" << std::endl;
-				s_SourceStream << "\t}" << std::endl;
-			}
-			else
-			{
-				s_SourceStream << "\tp_Stream << simdjson::as_json_string(s_Object->" << s_PropName << ");" << std::endl;
-			}
-		}
-		else
-		{
-			s_SourceStream << "\t" << NormalizeName(s_Prop.m_pType) << "::WriteSimpleJson(&s_Object->" << s_PropName << ", p_Stream);" << std::endl;
-		}
-
-		if (i < s_Type->m_nPropertyCount - 1)
-		{
-			s_SourceStream << "\tp_Stream << \",\";" << std::endl;
-		}
+		// Property names are plain identifiers, so they can be written as pre-escaped literals,
+		// together with the brace or comma that comes before them.
+		s_Fields << "\t{ \"" << s_PropName << "\", \"" << (s_HasFields ? "," : "{") << "\\\"" << s_PropName << "\\\":\", ";
+		s_Fields << "offsetof(" << s_NormalizedName << ", " << s_PropName << "), " << s_FieldType << " }," << std::endl;
 
-		s_SourceStream << std::endl;
+		s_HasFields = true;
 	}
 
-	s_SourceStream << "\tp_Stream << \"}\";" << std::endl;
-
-	s_SourceStream << "}" << std::endl;
-	s_SourceStream << std::endl;
-
-	s_SourceStream << "void " << s_NormalizedName << "::FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target)" << std::endl;
-	s_SourceStream << "{" << std::endl;
-
-	s_SourceStream << "\tauto s_Object = reinterpret_cast<" << s_NormalizedName << "*>(p_Target);" << std::endl;
-	s_SourceStream << std::endl;
-
-	for (uint16_t i = 0; i < s_Type->m_nPropertyCount; ++i)
+	if (s_HasFields)
 	{
-		auto s_Prop = s_Type->m_pProperties[i];
-		auto s_PropTypeName = std::string(s_Prop.m_pType->typeInfo()->m_pTypeName);
-
-		if (s_PropTypeName == std::string("TArray"))
-			continue;
-
-		std::string s_PropName = s_Prop.m_pName;
-
-		if (s_Prop.m_pType->typeInfo()->m_pTypeName == std::string("ZString"))
-		{
-			s_SourceStream << "\ts_Object->" << s_PropName << " = std::string_view(p_Document[\"" << s_PropName << "\"]);" << std::endl;
-		}
-		else if (s_Prop.m_pType->typeInfo()->isEnum())
-		{
-			s_SourceStream << "\ts_Object->" << s_PropName << " = static_cast<" << NormalizeName(s_Prop.m_pType) << ">(ZHMEnums::GetEnumValueByName(\"" << s_PropTypeName << "\", std::string_view(p_Document[\"" << s_PropName << "\"])));" << std::endl;
-		}
-		else if (s_Prop.m_pType->typeInfo()->isArray() || s_Prop.m_pType->typeInfo()->isFixedArray())
-		{
-			GenerateArraySimpleJsonReader(s_Prop.m_pType, s_SourceStream, "s_Object->" + s_PropName, "p_Document[\"" + s_PropName + "\"]");
-		}
-		else if (s_Prop.m_pType->typeInfo()->isPrimitive())
-		{
-			if (s_PropTypeName == "char")
-				s_PropTypeName = "int8";
-
-			if (s_PropName == std::string("nPropertyID"))
-			{
-				s_SourceStream << "\tif (p_Document[\"" << s_PropName << "\"].type() == simdjson::ondemand::json_type::string)" << std::endl;
-				s_SourceStream << "\t\ts_Object->" << s_PropName << " = Hash::Crc32(std::string_view(p_Document[\"" << s_PropName << "\"]));" << std::endl;
-				s_SourceStream << "\telse" << std::endl;
-				s_SourceStream << "\t\ts_Object->" << s_PropName << " = simdjson::from_json_uint32(p_Document[\"" << s_PropName << "\"]);" << std::endl;
-			}
-			else
-			{
-				s_SourceStream << "\ts_Object->" << s_PropName << " = simdjson::from_json_" << s_PropTypeName << "(p_Document[\"" << s_PropName << "\"]);" << std::endl;
-			}
-		}
-		else
-		{
-			s_SourceStream << "\t" << NormalizeName(s_Prop.m_pType) << "::FromSimpleJson(p_Document[\"" << s_PropName << "\"], &s_Object->" << s_PropName << ");" << std::endl;
-		}
-
+		s_SourceStream << "static constexpr ZHMFieldDescriptor " << s_TableName << "[] =" << std::endl;
+		s_SourceStream << "{" << std::endl;
+		s_SourceStream << s_Fields.str();
+		s_SourceStream << "};" << std::endl;
 		s_SourceStream << std::endl;
 	}
 
-	s_SourceStream << "}" << std::endl;
-	s_SourceStream << std::endl;
-
-	s_SourceStream << "void " << s_NormalizedName << "::Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset)" << std::endl;
-	s_SourceStream << "{" << std::endl;
-	s_SourceStream << "\tauto* s_Object = reinterpret_cast<" << s_NormalizedName << "*>(p_Object);" << std::endl;
-	s_SourceStream << std::endl;
-
-	for (uint16_t i = 0; i < s_Type->m_nPropertyCount; ++i)
-	{
-		auto s_Prop = s_Type->m_pProperties[i];
-		auto s_PropTypeName = std::string(s_Prop.m_pType->typeInfo()->m_pTypeName);
-
-		if (s_PropTypeName == std::string("TArray"))
-			continue;
-
-		std::string s_PropName = s_Prop.m_pName;
-
-		if ((!s_Prop.m_pType->typeInfo()->isPrimitive() && !s_Prop.m_pType->typeInfo()->isEnum()) || s_PropTypeName == "ZString")
-		{
-			s_SourceStream << "\t" << NormalizeName(s_Prop.m_pType) << "::Serialize(&s_Object->" << s_PropName << ", p_Serializer, p_OwnOffset + offsetof(" << s_NormalizedName << ", " << s_PropName << "));" << std::endl;
-		}
-	}
+	s_SourceStream << "constinit ZHMTableTypeInfo " << s_NormalizedName << "::TypeInfo = ZHMTableTypeInfo::Of<" << s_NormalizedName << ">(\"" << s_TypeName << "\", \"\\\"" << s_TypeName << "\\\"\", " << (s_HasFields ? s_TableName : "{}");
 
 	if (s_TypeName == "ZRuntimeResourceID")
-		s_SourceStream << "\t" << "p_Serializer.RegisterRuntimeResourceId(p_OwnOffset);" << std::endl;
-
-	s_SourceStream << "}" << std::endl;
-	s_SourceStream << std::endl;
-
-	s_SourceStream << "bool " << s_NormalizedName << "::Equals(void* p_Left, void* p_Right)" << std::endl;
-	s_SourceStream << "{" << std::endl;
-	s_SourceStream << "\tauto* s_Left = reinterpret_cast<" << s_NormalizedName << "*>(p_Left);" << std::endl;
-	s_SourceStream << "\tauto* s_Right = reinterpret_cast<" << s_NormalizedName << "*>(p_Right);" << std::endl;
-	s_SourceStream << std::endl;
-	s_SourceStream << "\treturn *s_Left == *s_Right;" << std::endl;
-	s_SourceStream << "}" << std::endl;
-	s_SourceStream << std::endl;
-
-	s_SourceStream << "bool " << s_NormalizedName << "::operator==(const " << s_NormalizedName << "& p_Other) const" << std::endl;
-	s_SourceStream << "{" << std::endl;
-
-	s_SourceStream << "\tif constexpr (!ZHMTypeSupportsEquality_v<" << s_NormalizedName << ">)" << std::endl;
-	s_SourceStream << "\t\treturn false;" << std::endl;
-	s_SourceStream << std::endl;
-
-	for (uint16_t i = 0; i < s_Type->m_nPropertyCount; ++i)
-	{
-		auto s_Prop = s_Type->m_pProperties[i];
-		auto s_PropTypeName = std::string(s_Prop.m_pType->typeInfo()->m_pTypeName);
-
-		if (s_PropTypeName == std::string("TArray"))
-			continue;
-
-		std::string s_PropName = s_Prop.m_pName;
-
-		s_SourceStream << "\tif (" << s_PropName << " != p_Other." << s_PropName << ") return false;" << std::endl;
-	}
-
-	s_SourceStream << std::endl;
-	s_SourceStream << "\treturn true;" << std::endl;
-
-	s_SourceStream << "}" << std::endl;
-	s_SourceStream << std::endl;
+		s_SourceStream << ", ZHMTableTypeInfo::c_RuntimeResourceId";
 
-	s_SourceStream << "void " << s_NormalizedName << "::Destroy(void* p_Object)" << std::endl;
-	s_SourceStream << "{" << std::endl;
-	s_SourceStream << "\tauto* s_Object = reinterpret_cast<" << s_NormalizedName << "*>(p_Object);" << std::endl;
-	s_SourceStream << "\ts_Object->~" << p_Node->Name << "();" << std::endl;
-	s_SourceStream << "}" << std::endl;
+	s_SourceStream << ");" << std::endl;
 	s_SourceStream << std::endl;
 }
 
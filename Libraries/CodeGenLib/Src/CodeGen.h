@@ -87,6 +87,9 @@ private:
 
 	static bool ShouldForceJsonEmit(const std::string &p_TypeName);
 
+	// Whether objects of the type contain nothing that the serializer has to patch or register.
+	bool IsRelocationFree(STypeID *p_Type);
+
 	void EmitJsonStruct(const std::shared_ptr<TreeNode> &p_Node);
 
 	void MaybeEmitForcedJsonStruct(const std::shared_ptr<TreeNode> &p_Node);
@@ -95,6 +98,9 @@ private:
 
 	void GenerateSdkClass(const std::shared_ptr<TreeNode> &p_Node, const std::string &p_Indent);
 
+	// Writes the index that generated types are looked up by name with, sorted by name hash.
+	void GenerateTypeIndex();
+
 	void GeneratePropertyNamesFiles();
 
 	void GenerateEnumsFiles();
@@ -136,6 +142,8 @@ private:
 	std::vector<JsonStruct> m_JsonStructs;
 	std::vector<JsonEnumInfo> m_JsonEnums;
 	std::unordered_set<std::string> m_EmittedJsonStructs;
+	std::unordered_map<std::string, bool> m_RelocationFreeTypes;
+	std::vector<std::pair<std::string, std::string>> m_TypeIndex;
 
 	std::ofstream m_ReflectiveClassesHeaderFile;
 	std::ofstream m_ReflectiveClassesSourceFile;
@@ -32,6 +32,8 @@ SOFTWARE.
 #include <map>
 #include <iostream>
 #include <algorithm>
+#include <memory>
+#include <span>
 #include <stdlib.h>
 
 #if _WIN32
@@ -324,14 +326,18 @@ namespace NavPower
     // not a pointer to a location in the file relative to the start of the NavGraph
     void FixAreaPointers(uintptr_t data, size_t areaBytes);
 
+    // A non-owning view of an area and the edges that follow it in memory.
+    // The memory is owned by the NavGraph (JSON) or the NavMesh (binary), so views are cheap to copy.
     class Area
     {
     public:
         Binary::Area* m_area;
-        std::vector<Binary::Edge*> m_edges;
+        std::span<Binary::Edge> m_edges;
+
+        Area() : m_area(nullptr) {};
+        Area(Binary::Area* p_area) : m_area(p_area), m_edges(p_area->GetFirstEdge(), p_area->m_flags.GetNumEdges()) {};
 
         void writeJson(std::ostream& f, std::map<Binary::Area*, uint32_t>* p_AreaPointerToIndexMap);
-        void readJson(auto p_Json);
         void writeBinary(std::ostream& f, std::map<Binary::Area*, Binary::Area*>* s_AreaPointerToOffsetPointerMap);
         bool operator==(Area const& other) const;
         bool operator<(Area const& other) const;
@@ -361,10 +367,10 @@ namespace NavPower
             for (size_t i = 2; i < m_edges.size(); ++i)
             {
                 // Find the perpendicular point from this vertex to the line formed by the first two vertices.
-                const Vec3 s_PerpendicularPoint = m_edges[i]->m_pos.PerpendicularPointTo(m_edges[0]->m_pos, m_edges[1]->m_pos);
+                const Vec3 s_PerpendicularPoint = m_edges[i].m_pos.PerpendicularPointTo(m_edges[0].m_pos, m_edges[1].m_pos);
 
                 // Get the distance between this vertex and the perpendicular point.
-                const float s_Distance = s_PerpendicularPoint.DistanceTo(m_edges[i]->m_pos);
+                const float s_Distance = s_PerpendicularPoint.DistanceTo(m_edges[i].m_pos);
 
                 if (s_Distance > s_MaxDistance)
                 {
@@ -378,9 +384,9 @@ namespace NavPower
 
         Vec3 CalculateNormal()
         {
-            Vec3 v0 = m_edges.at(0)->m_pos;
-            Vec3 v1 = m_edges.at(1)->m_pos;
-            Vec3 basis = m_edges.at(2)->m_pos;
+            Vec3 v0 = m_edges[0].m_pos;
+            Vec3 v1 = m_edges[1].m_pos;
+            Vec3 basis = m_edges[2].m_pos;
 
             Vec3 vec1 = basis - v0;
             Vec3 vec2 = v1 - v0;
@@ -389,7 +395,7 @@ namespace NavPower
             return cross.GetUnitVec();
         }
 
-        BBox CalculateBBox();
+        BBox CalculateBBox() const;
         Vec3 CalculateCentroid();
         void updateAdjacentDistances() const;
     };
@@ -403,7 +409,7 @@ namespace NavPower
         uint32_t m_splitAxis;
     };
 
-    BBox generateBbox(std::vector<Area> s_areas);
+    BBox generateBbox(const std::vector<Area>& s_areas);
     bool compareX(Area& a1, Area& a2);
     bool compareY(Area& a1, Area& a2);
     bool compareZ(Area& a1, Area& a2);
@@ -416,6 +422,10 @@ namespace NavPower
         Binary::KDTreeData* m_kdTreeData;
         Binary::KDNode* m_rootKDNode;
 
+        // Areas and edges read from JSON, laid out like they are in a NAVP file.
+        // Binary NavGraphs point straight into the file owned by their NavMesh.
+        std::shared_ptr<char[]> m_areaData;
+
         NavGraph() {};
         NavGraph(auto s_NavGraphJson);
         
@@ -444,7 +454,7 @@ namespace NavPower
             float s_RightSplit;
         };
 
-        KdTreeGenerationHelper splitAreas(std::vector<Area> s_originalAreas);
+        KdTreeGenerationHelper splitAreas(const std::vector<Area>& s_originalAreas);
         uint32_t generateKdTree(uintptr_t s_nodePtr, std::vector<Area>& s_areas, std::map<Binary::Area*, uint32_t>& p_AreaPointerToNavGraphOffsetMap);
 
         void writeJson(std::ostream& f);
@@ -529,6 +539,9 @@ namespace NavPower
         Binary::Header* m_hdr;
         std::vector<Section> m_aSections;
 
+        // Keeps the memory the sections point into alive, e.g. the mapped NAVP file.
+        std::shared_ptr<void> m_data;
+
         NavMesh() {};
         NavMesh(const char* p_NavGraphJsonPath);
         NavMesh(uintptr_t p_data, uint32_t p_filesize) { read(p_data, p_filesize); };
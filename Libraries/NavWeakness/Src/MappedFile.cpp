@@ -0,0 +1,81 @@
+#include "MappedFile.h"
+
+#include <stdexcept>
+
+#if _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if _WIN32
+MappedFile::MappedFile(const char* p_Path)
+{
+	HANDLE s_File = CreateFileA(p_Path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (s_File == INVALID_HANDLE_VALUE)
+		throw std::runtime_error("Could not open file for mapping.");
+
+	LARGE_INTEGER s_FileSize {};
+
+	if (!GetFileSizeEx(s_File, &s_FileSize) || s_FileSize.QuadPart == 0)
+	{
+		CloseHandle(s_File);
+		throw std::runtime_error("Could not map empty file.");
+	}
+
+	HANDLE s_Mapping = CreateFileMappingA(s_File, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+	CloseHandle(s_File);
+
+	if (!s_Mapping)
+		throw std::runtime_error("Could not create file mapping.");
+
+	// The view keeps the mapping alive on its own.
+	m_Data = MapViewOfFile(s_Mapping, FILE_MAP_COPY, 0, 0, 0);
+	CloseHandle(s_Mapping);
+
+	if (!m_Data)
+		throw std::runtime_error("Could not map view of file.");
+
+	m_Size = static_cast<size_t>(s_FileSize.QuadPart);
+}
+
+MappedFile::~MappedFile()
+{
+	UnmapViewOfFile(m_Data);
+}
+#else
+MappedFile::MappedFile(const char* p_Path)
+{
+	const int s_File = open(p_Path, O_RDONLY);
+
+	if (s_File < 0)
+		throw std::runtime_error("Could not open file for mapping.");
+
+	struct stat s_Stat {};
+
+	if (fstat(s_File, &s_Stat) != 0 || s_Stat.st_size == 0)
+	{
+		close(s_File);
+		throw std::runtime_error("Could not map empty file.");
+	}
+
+	void* s_Data = mmap(nullptr, static_cast<size_t>(s_Stat.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, s_File, 0);
+	close(s_File);
+
+	if (s_Data == MAP_FAILED)
+		throw std::runtime_error("Could not map file.");
+
+	m_Data = s_Data;
+	m_Size = static_cast<size_t>(s_Stat.st_size);
+}
+
+MappedFile::~MappedFile()
+{
+	munmap(m_Data, m_Size);
+}
+#endif
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// A private, copy-on-write mapping of a whole file.
+// Writes through the mapping never reach the file, which lets the loader fix up pointers in place.
+class MappedFile
+{
+public:
+	explicit MappedFile(const char* p_Path);
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	[[nodiscard]] uintptr_t Data() const { return reinterpret_cast<uintptr_t>(m_Data); }
+	[[nodiscard]] size_t Size() const { return m_Size; }
+
+private:
+	void* m_Data = nullptr;
+	size_t m_Size = 0;
+};
@@ -31,6 +31,7 @@ SOFTWARE.
 #include <filesystem>
 #include <fstream>
 #include <functional>
+#include <new>
 #include <set>
 
 uint32_t RangeCheck(uint32_t val, uint32_t min, uint32_t max)
@@ -467,39 +468,22 @@ namespace NavPower
             {
                 f << ",";
             }
-            edge->writeJson(f, p_AreaPointerToIndexMap);
+            edge.writeJson(f, p_AreaPointerToIndexMap);
             first = false;
         }
         f << "]}";
     }
 
-    void Area::readJson(auto p_Json)
-    {
-        simdjson::ondemand::object m_areaJson = p_Json["Area"];
-        m_area = new Binary::Area;
-        m_area->readJson(m_areaJson);
-        simdjson::ondemand::array m_edgesJson = p_Json["Edges"];
-        for (auto edgeJson : m_edgesJson)
-        {
-            Binary::Edge* edge = new Binary::Edge;
-            edge->readJson(edgeJson);
-            m_edges.push_back(edge);
-        }
-        m_area->m_pos = CalculateCentroid();
-        m_area->m_flags.SetNumEdges(m_edges.size());
-        m_area->m_flags.SetBasisVert(CalculateBasisVert());
-    }
-
     void Area::writeBinary(std::ostream& f, std::map<Binary::Area*, Binary::Area*>* s_AreaPointerToOffsetPointerMap)
     {
         m_area->writeBinary(f);
         for (auto& edge : m_edges)
         {
-            edge->writeBinary(f, s_AreaPointerToOffsetPointerMap);
+            edge.writeBinary(f, s_AreaPointerToOffsetPointerMap);
         }
     }
 
-    BBox Area::CalculateBBox()
+    BBox Area::CalculateBBox() const
     {
         float s_minFloat = -300000000000;
         float s_maxFloat = 300000000000;
@@ -512,12 +496,12 @@ namespace NavPower
         bbox.m_max.Z = s_minFloat;
         for (auto& edge : m_edges)
         {
-            bbox.m_max.X = std::max(bbox.m_max.X, edge->m_pos.X);
-            bbox.m_max.Y = std::max(bbox.m_max.Y, edge->m_pos.Y);
-            bbox.m_max.Z = std::max(bbox.m_max.Z, edge->m_pos.Z);
-            bbox.m_min.X = std::min(bbox.m_min.X, edge->m_pos.X);
-            bbox.m_min.Y = std::min(bbox.m_min.Y, edge->m_pos.Y);
-            bbox.m_min.Z = std::min(bbox.m_min.Z, edge->m_pos.Z);
+            bbox.m_max.X = std::max(bbox.m_max.X, edge.m_pos.X);
+            bbox.m_max.Y = std::max(bbox.m_max.Y, edge.m_pos.Y);
+            bbox.m_max.Z = std::max(bbox.m_max.Z, edge.m_pos.Z);
+            bbox.m_min.X = std::min(bbox.m_min.X, edge.m_pos.X);
+            bbox.m_min.Y = std::min(bbox.m_min.Y, edge.m_pos.Y);
+            bbox.m_min.Z = std::min(bbox.m_min.Z, edge.m_pos.Z);
         }
         return bbox;
     }
@@ -525,16 +509,16 @@ namespace NavPower
     Vec3 Area::CalculateCentroid()
     {
         Vec3 normal = CalculateNormal();
-        Vec3 v0 = m_edges.at(0)->m_pos;
-        Vec3 v1 = m_edges.at(1)->m_pos;
+        Vec3 v0 = m_edges[0].m_pos;
+        Vec3 v1 = m_edges[1].m_pos;
 
         Vec3 u = (v1 - v0).GetUnitVec();
         Vec3 v = u.Cross(normal).GetUnitVec();
 
         std::vector<Vec3> mappedPoints;
-        for (Binary::Edge* edge : m_edges) 
+        for (const Binary::Edge& edge : m_edges)
         {
-            Vec3 relativePos = edge->m_pos - v0;
+            Vec3 relativePos = edge.m_pos - v0;
             float uCoord = relativePos.Dot(u);
             float vCoord = relativePos.Dot(v);
             Vec3 uvv = Vec3(uCoord, vCoord, 0.0);
@@ -581,18 +565,7 @@ namespace NavPower
 
     bool Area::operator==(Area const& other) const
     {
-        bool eq = true;
-        eq &= m_area == other.m_area;
-        if (m_edges.size() != other.m_edges.size())
-        {
-            return false;
-        }
-        for (int i = 0; i < m_edges.size(); i++)
-        {
-            eq &= m_edges[i] == other.m_edges[i];
-        }
-
-        return eq;
+        return m_area == other.m_area && m_edges.data() == other.m_edges.data() && m_edges.size() == other.m_edges.size();
     }
 
     bool Area::operator<(Area const& other) const
@@ -603,11 +576,11 @@ namespace NavPower
     void Area::updateAdjacentDistances() const {
         for (auto& edge : m_edges)
         {
-            edge->updateAdjacentDistances(m_area);
+            edge.updateAdjacentDistances(m_area);
         }
     }
 
-    BBox generateBbox(std::vector<Area> s_areas)
+    BBox generateBbox(const std::vector<Area>& s_areas)
     {
         float s_minFloat = -300000000000;
         float s_maxFloat = 300000000000;
@@ -619,16 +592,16 @@ namespace NavPower
         bbox.m_max.Y = s_minFloat;
         bbox.m_max.Z = s_minFloat;
 
-        for (auto& area : s_areas)
+        for (const auto& area : s_areas)
         {
-            for (auto& edge : area.m_edges)
+            for (const auto& edge : area.m_edges)
             {
-                bbox.m_min.X = std::min(bbox.m_min.X, edge->m_pos.X);
-                bbox.m_min.Y = std::min(bbox.m_min.Y, edge->m_pos.Y);
-                bbox.m_min.Z = std::min(bbox.m_min.Z, edge->m_pos.Z);
-                bbox.m_max.X = std::max(bbox.m_max.X, edge->m_pos.X);
-                bbox.m_max.Y = std::max(bbox.m_max.Y, edge->m_pos.Y);
-                bbox.m_max.Z = std::max(bbox.m_max.Z, edge->m_pos.Z);
+                bbox.m_min.X = std::min(bbox.m_min.X, edge.m_pos.X);
+                bbox.m_min.Y = std::min(bbox.m_min.Y, edge.m_pos.Y);
+                bbox.m_min.Z = std::min(bbox.m_min.Z, edge.m_pos.Z);
+                bbox.m_max.X = std::max(bbox.m_max.X, edge.m_pos.X);
+                bbox.m_max.Y = std::max(bbox.m_max.Y, edge.m_pos.Y);
+                bbox.m_max.Z = std::max(bbox.m_max.Z, edge.m_pos.Z);
             }
         }
         return bbox;
@@ -654,7 +627,7 @@ namespace NavPower
     {
         std::map<Binary::Area*, uint32_t> s_AreaPointerToIndexMap;
         uint32_t s_AreaIndex = 1;
-        for (Area area : m_areas)
+        for (const Area& area : m_areas)
         {
             s_AreaPointerToIndexMap.emplace(area.m_area, s_AreaIndex);
             s_AreaIndex++;
@@ -667,7 +640,7 @@ namespace NavPower
     {
         std::map<uint64_t, Binary::Area*> s_AreaIndexToPointerMap;
         uint64_t s_AreaIndex = 1;
-        for (Area area : m_areas)
+        for (const Area& area : m_areas)
         {
             s_AreaIndexToPointerMap.emplace(s_AreaIndex, area.m_area);
             s_AreaIndex++;
@@ -729,7 +702,7 @@ namespace NavPower
         f << "]}";
     }
 
-    NavGraph::KdTreeGenerationHelper NavGraph::splitAreas(std::vector<Area> s_originalAreas)
+    NavGraph::KdTreeGenerationHelper NavGraph::splitAreas(const std::vector<Area>& s_originalAreas)
     {
         KdTreeGenerationHelper nodeSplits;
         BBox areasBbox = generateBbox(s_originalAreas);
@@ -762,7 +735,7 @@ namespace NavPower
 
         std::vector<Area> s_areasWithPosEqualToMedianValue;
         int middleIndex = s_sortedAreas.size() / 2;
-        Area middleArea = s_sortedAreas[middleIndex];
+        const Area& middleArea = s_sortedAreas[middleIndex];
         float medianValue = 0;
 
         if (nodeSplits.splitAxis == Axis::X)
@@ -894,40 +867,74 @@ namespace NavPower
         m_hdr = new Binary::NavGraphHeader();
         simdjson::ondemand::array s_AreasJson = s_NavGraphJson["Areas"];
 
+        // Parse into flat arrays first, then lay the areas out with their edges like they are in a NAVP file
+        std::vector<Binary::Area> s_binaryAreas;
+        std::vector<Binary::Edge> s_binaryEdges;
+        std::vector<uint32_t> s_edgeCounts;
         for (auto areaJson : s_AreasJson)
         {
-            Area a_Area;
-            a_Area.readJson(areaJson);
-            m_areas.push_back(a_Area);
+            simdjson::ondemand::object s_AreaJson = areaJson["Area"];
+            s_binaryAreas.emplace_back().readJson(s_AreaJson);
+            simdjson::ondemand::array s_EdgesJson = areaJson["Edges"];
+            uint32_t s_edgeCount = 0;
+            for (auto edgeJson : s_EdgesJson)
+            {
+                s_binaryEdges.emplace_back().readJson(edgeJson);
+                s_edgeCount++;
+            }
+            // The centroid and normal are calculated from the first three edges
+            if (s_edgeCount < 3)
+                throw std::runtime_error("Area has fewer than 3 edges.");
+            s_edgeCounts.push_back(s_edgeCount);
         }
-        uint32_t s_areaBytes = 0;
+
+        const uint32_t s_areaBytes = static_cast<uint32_t>(sizeof(Binary::Area) * s_binaryAreas.size() + sizeof(Binary::Edge) * s_binaryEdges.size());
+        constexpr std::align_val_t s_areaAlignment{ alignof(Binary::Area) };
+        m_areaData = std::shared_ptr<char[]>(
+            static_cast<char*>(::operator new(s_areaBytes, s_areaAlignment)),
+            [s_areaAlignment](char* p_Data) { ::operator delete(p_Data, s_areaAlignment); });
+        m_areas.reserve(s_binaryAreas.size());
+        char* s_areaPtr = m_areaData.get();
+        const Binary::Edge* s_nextEdge = s_binaryEdges.data();
+        for (size_t i = 0; i < s_binaryAreas.size(); i++)
+        {
+            Binary::Area* s_area = new (s_areaPtr) Binary::Area(s_binaryAreas[i]);
+            s_area->m_flags.SetNumEdges(s_edgeCounts[i]);
+            std::uninitialized_copy_n(s_nextEdge, s_edgeCounts[i], s_area->GetFirstEdge());
+            s_nextEdge += s_edgeCounts[i];
+            s_areaPtr += sizeof(Binary::Area) + sizeof(Binary::Edge) * s_edgeCounts[i];
+
+            Area& area = m_areas.emplace_back(s_area);
+            area.m_area->m_pos = area.CalculateCentroid();
+            area.m_area->m_flags.SetBasisVert(area.CalculateBasisVert());
+        }
+
         uint64_t s_AreaIndex = 0;
         std::map<uint64_t, Binary::Area*> s_AreaIndexToPointerMap = AreaIndexToPointerMap();
         for (auto& area : m_areas)
         {
-            s_areaBytes += sizeof(Binary::Area) + sizeof(Binary::Edge) * area.m_edges.size();
             float s_radius = -1.;
-            for (Binary::Edge* edge : area.m_edges)
+            for (Binary::Edge& edge : area.m_edges)
             {
-                s_radius = std::max(s_radius, area.m_area->m_pos.DistanceTo(edge->m_pos));
-                if (reinterpret_cast<uint64_t>(edge->m_pAdjArea) != 0)
+                s_radius = std::max(s_radius, area.m_area->m_pos.DistanceTo(edge.m_pos));
+                if (reinterpret_cast<uint64_t>(edge.m_pAdjArea) != 0)
                 {
                     // Convert index of adjacent area + 1 back to Area pointer
-                    s_AreaIndex = reinterpret_cast<uint64_t>(edge->m_pAdjArea);
+                    s_AreaIndex = reinterpret_cast<uint64_t>(edge.m_pAdjArea);
                     std::map<uint64_t, Binary::Area*>::const_iterator s_MapPosition = s_AreaIndexToPointerMap.find(s_AreaIndex);
                     if (s_MapPosition == s_AreaIndexToPointerMap.end())
                     {
                         throw std::runtime_error("Area index not found in s_AreaIndexToPointerMap.");
                     }
                     else {
-                        edge->m_pAdjArea = reinterpret_cast<Binary::Area*>(s_MapPosition->second);
+                        edge.m_pAdjArea = reinterpret_cast<Binary::Area*>(s_MapPosition->second);
                     }
                 }
             }
             area.m_area->m_radius = s_radius;
         }
 
-        for (auto area : m_areas)
+        for (const auto& area : m_areas)
         {
             area.updateAdjacentDistances();
         }
@@ -970,7 +977,7 @@ namespace NavPower
         std::map<Binary::Area*, Binary::Area*> s_AreaPointerToOffsetPointerMap;
         unsigned char* s_AreaOffset = reinterpret_cast<unsigned char*>(sizeof(Binary::NavGraphHeader));
 
-        for (auto area : m_areas)
+        for (const auto& area : m_areas)
         {
             Binary::Area* s_areaOffsetPtr = reinterpret_cast<Binary::Area*>(s_AreaOffset);
             s_AreaPointerToOffsetPointerMap.emplace(area.m_area, s_areaOffsetPtr);
@@ -997,37 +1004,19 @@ namespace NavPower
 
         FixAreaPointers(p_data - sizeof(Binary::NavGraphHeader), m_hdr->m_areaBytes);
 
+        // Areas are views into the data, so this only touches the area headers
         s_endPointer = p_data + m_hdr->m_areaBytes;
         while (p_data < s_endPointer)
         {
-            Area s_area{};
-            s_area.m_area = (Binary::Area*)p_data;
-            p_data += sizeof(Binary::Area);
-
-            for (uint32_t i = 0; i < s_area.m_area->m_flags.GetNumEdges(); ++i)
-            {
-                s_area.m_edges.push_back((Binary::Edge*)p_data);
-                p_data += sizeof(Binary::Edge);
-            }
-
-            m_areas.push_back(s_area);
+            const Area& s_area = m_areas.emplace_back((Binary::Area*)p_data);
+            p_data += sizeof(Binary::Area) + sizeof(Binary::Edge) * s_area.m_edges.size();
         }
         m_kdTreeData = (Binary::KDTreeData*)p_data;
         p_data += sizeof(Binary::KDTreeData);
 
+        // The k-d tree is only walked when something asks for it
         m_rootKDNode = (Binary::KDNode*)p_data;
-
-        s_endPointer = p_data + m_kdTreeData->m_size;
-        while (p_data < s_endPointer)
-        {
-            Binary::KDNode* s_KDNode = (Binary::KDNode*)p_data;
-            Binary::KDLeaf* s_KDLeaf = (Binary::KDLeaf*)p_data;
-
-            if (s_KDNode->IsLeaf())
-                p_data += sizeof(Binary::KDLeaf);
-            else
-                p_data += sizeof(Binary::KDNode);
-        }
+        p_data += m_kdTreeData->m_size;
 
         if ((p_data - s_startPointer) != m_hdr->m_totalBytes)
         {
@@ -1077,10 +1066,9 @@ namespace NavPower
         m_setHdr = (Binary::NavSetHeader*)p_data;
         p_data += sizeof(Binary::NavSetHeader);
 
+        m_aNavGraphs.reserve(m_setHdr->m_numGraphs);
         for (uint32_t i = 0; i < m_setHdr->m_numGraphs; ++i) {
-            NavGraph s_Graph;
-            s_Graph.read(p_data);
-            m_aNavGraphs.push_back(s_Graph);
+            m_aNavGraphs.emplace_back().read(p_data);
         }
 
         if ((p_data - s_startPointer) != m_hdr->m_size)
@@ -1093,7 +1081,7 @@ namespace NavPower
     {
         f << "{\"NavGraphs\":[";
         bool first = true;
-        for (auto s_NavGraph : m_aNavGraphs)
+        for (auto& s_NavGraph : m_aNavGraphs)
         {
             if (!first) {
                 f << ",";
@@ -1122,7 +1110,7 @@ namespace NavPower
             NavGraph s_NavGraph;
             s_NavGraph.readJson(navGraphJson);
             m_hdr->m_size += s_NavGraph.m_hdr->m_totalBytes;
-            m_aNavGraphs.push_back(s_NavGraph);
+            m_aNavGraphs.push_back(std::move(s_NavGraph));
         }
         m_setHdr->m_numGraphs = static_cast<uint32_t>(m_aNavGraphs.size());
     }
@@ -1140,9 +1128,7 @@ namespace NavPower
 
         // Read Sections
         while ((p_data - s_startPointer) < p_filesize) {
-            Section s_Section;
-            s_Section.read(p_data);
-            m_aSections.push_back(s_Section);
+            m_aSections.emplace_back().read(p_data);
         }
     }
 
@@ -1161,9 +1147,8 @@ namespace NavPower
         m_hdr->m_imageSize = 0;
         auto s_SectionsJson = s_NavMeshDocument["Sections"];
         for (auto s_SectionJson : s_SectionsJson) {
-            Section s_Section;
+            Section& s_Section = m_aSections.emplace_back();
             s_Section.readJson(s_SectionJson);
-            m_aSections.push_back(s_Section);
             // Set size fields
             m_hdr->m_imageSize += sizeof(Binary::SectionHeader) + s_Section.m_hdr->m_size;
         }
@@ -1184,11 +1169,11 @@ namespace NavPower
         std::ifstream s_FileStream(p_ChecksumCalculationTempPath, std::ios::in | std::ios::binary);
         if (!s_FileStream)
             throw std::runtime_error("Error creating input file stream.");
-        void* s_FileData = malloc(s_FileSize);
-        s_FileStream.read(static_cast<char*>(s_FileData), s_FileSize);
+        std::vector<char> s_FileData(s_FileSize);
+        s_FileStream.read(s_FileData.data(), s_FileSize);
         s_FileStream.close();
         std::filesystem::remove(p_ChecksumCalculationTempPath);
-        const auto s_FileStartPtr = reinterpret_cast<uintptr_t>(s_FileData);
+        const auto s_FileStartPtr = reinterpret_cast<uintptr_t>(s_FileData.data());
         const uint32_t s_Checksum = CalculateChecksum(reinterpret_cast<void*>(s_FileStartPtr + sizeof(Binary::Header)), (s_FileSize - sizeof(Binary::Header)));
         m_hdr->m_checksum = s_Checksum;
     }
@@ -1196,7 +1181,7 @@ namespace NavPower
     void NavMesh::writeJson(std::ofstream& f) {
         f << "{\"NavpJsonVersion\":\"0.2\",\"Sections\":[";
         bool first = true;
-        for (auto s_Section : m_aSections) {
+        for (auto& s_Section : m_aSections) {
             if (!first) {
                 f << ",";
             }
@@ -1209,7 +1194,7 @@ namespace NavPower
     void NavMesh::writeBinary(std::ostream& f)
     {
         m_hdr->writeBinary(f);
-        for (auto s_Section : m_aSections) {
+        for (auto& s_Section : m_aSections) {
             s_Section.writeBinary(f);
         }
     }
@@ -6,37 +6,33 @@
 #include <cmath>
 #include <vector>
 #include <limits>
+#include <memory>
 
 #include "NavPower.h"
+#include "MappedFile.h"
 
 NavPower::NavMesh LoadNavMeshFromBinary(const char* p_NavMeshPath)
 {
 	if (!std::filesystem::is_regular_file(p_NavMeshPath))
 		throw std::runtime_error("Input path is not a regular file.");
 
-	// Read the entire file to memory.
 	const long s_FileSize = std::filesystem::file_size(p_NavMeshPath);
 
 	if (s_FileSize < sizeof(NavPower::NavGraph))
 		throw std::runtime_error("Invalid NavMesh File.");
 
-	std::ifstream s_FileStream(p_NavMeshPath, std::ios::in | std::ios::binary);
-
-	if (!s_FileStream)
-		throw std::runtime_error("Error creating input file stream.");
-
-	void* s_FileData = malloc(s_FileSize);
-	s_FileStream.read(static_cast<char*>(s_FileData), s_FileSize);
-
-	s_FileStream.close();
-
-	const auto s_FileStartPtr = reinterpret_cast<uintptr_t>(s_FileData);
+	// Map the file instead of reading it, pages are only loaded once the NavMesh touches them.
+	// The mapping is copy-on-write, so fixing up the area pointers below doesn't modify the file.
+	const auto s_File = std::make_shared<MappedFile>(p_NavMeshPath);
+	const auto s_FileStartPtr = s_File->Data();
 
 	// We calculate the checksum now as we alter the data when loading the NavMesh below
 	// In future there will be a way to calculate it from the modified data, this will do for now
 	const uint32_t s_Checksum = NavPower::CalculateChecksum(reinterpret_cast<void*>(s_FileStartPtr + sizeof(NavPower::Binary::Header)), (s_FileSize - sizeof(NavPower::Binary::Header)));
 
-	NavPower::NavMesh s_NavMesh((uintptr_t)s_FileData, s_FileSize);
+	NavPower::NavMesh s_NavMesh(s_FileStartPtr, s_FileSize);
+	s_NavMesh.m_data = s_File;
+
 	if (s_NavMesh.m_hdr->m_checksum != s_Checksum)
 	{
 		printf("===== NavPower Header ====\n");
@@ -63,7 +59,7 @@ NavPower::NavMesh LoadNavMeshFromJson(const char* p_NavMeshPath)
 
 void OutputNavMesh_HUMAN_Print(NavPower::NavMesh* p_NavMesh)
 {
-	NavPower::NavMesh s_NavMesh = *p_NavMesh;
+	NavPower::NavMesh& s_NavMesh = *p_NavMesh;
 	printf("===== NavPower Header ====\n");
 	printf("Hdr_endianFlag: %x\n", s_NavMesh.m_hdr->m_endianFlag);
 	printf("Hdr_version: %x\n", s_NavMesh.m_hdr->m_version);
@@ -72,7 +68,7 @@ void OutputNavMesh_HUMAN_Print(NavPower::NavMesh* p_NavMesh)
 	printf("Hdr_runtimeFlags: %x\n", s_NavMesh.m_hdr->m_runtimeFlags);
 	printf("Hdr_constantFlags: %x\n", s_NavMesh.m_hdr->m_constantFlags);
 
-	for (auto s_Section: p_NavMesh->m_aSections)
+	for (auto& s_Section : p_NavMesh->m_aSections)
 	{
         printf("==== NavMesh Section Header ====\n");
 	    printf("Sect_id: %x\n", s_Section.m_hdr->m_id);
@@ -83,7 +79,7 @@ void OutputNavMesh_HUMAN_Print(NavPower::NavMesh* p_NavMesh)
 	    printf("Set_endianFlag: %x\n", s_Section.m_setHdr->m_endianFlag);
 	    printf("Set_version: %x\n", s_Section.m_setHdr->m_version);
 	    printf("Set_numGraphs: %x\n", s_Section.m_setHdr->m_numGraphs);
-        for (auto s_NavGraph : s_Section.m_aNavGraphs) {
+        for (auto& s_NavGraph : s_Section.m_aNavGraphs) {
             printf("==== NavGraph Header ====\n");
             printf("GraphHdr_version: %x\n", s_NavGraph.m_hdr->m_version);
             printf("GraphHdr_layer: %x\n", s_NavGraph.m_hdr->m_layer);
@@ -105,7 +101,7 @@ void OutputNavMesh_HUMAN_Print(NavPower::NavMesh* p_NavMesh)
             printf("GraphHdr_buildUpAxis: %x [%s]\n", s_NavGraph.m_hdr->m_buildUpAxis, NavPower::AxisToString(s_NavGraph.m_hdr->m_buildUpAxis).c_str());
 
             for (int i = 0; i < s_NavGraph.m_areas.size(); i++) {
-                NavPower::Area s_curArea = s_NavGraph.m_areas.at(i);
+                NavPower::Area& s_curArea = s_NavGraph.m_areas.at(i);
 
                 Vec3 s_normal = s_curArea.CalculateNormal();
                 printf("==== NavGraph Area %p ====\n", s_curArea.m_area);
@@ -131,7 +127,7 @@ void OutputNavMesh_HUMAN_Print(NavPower::NavMesh* p_NavMesh)
 
                 for (int j = 0; j < s_curArea.m_edges.size(); j++)
                 {
-                    NavPower::Binary::Edge *s_curEdge = s_curArea.m_edges.at(j);
+                    NavPower::Binary::Edge *s_curEdge = &s_curArea.m_edges[j];
 
                     printf("==== NavGraph Area Edge #%u ====\n", j);
                     printf("Edge_pAdjArea: %p\n", s_curEdge->m_pAdjArea);
@@ -275,11 +271,11 @@ extern "C" void OutputNavMesh_JSON(const char* p_NavMeshPath, const char* p_NavM
 
 void OutputNavMesh_VIEWER_print(NavPower::NavMesh* p_NavMesh, const std::string s_FileName)
 {
-	NavPower::NavMesh s_NavMesh = *p_NavMesh;
-    for (auto s_Section : s_NavMesh.m_aSections)
+	NavPower::NavMesh& s_NavMesh = *p_NavMesh;
+    for (auto& s_Section : s_NavMesh.m_aSections)
     {
         int s_NavGraphIndex = 0;
-        for (auto s_NavGraph : s_Section.m_aNavGraphs)
+        for (auto& s_NavGraph : s_Section.m_aNavGraphs)
         {
 
 	        printf(
@@ -289,7 +285,7 @@ void OutputNavMesh_VIEWER_print(NavPower::NavMesh* p_NavMesh, const std::string
 
 	        for (int i = 0; i < s_NavGraph.m_areas.size(); i++)
 	        {
-		        NavPower::Area s_curArea = s_NavGraph.m_areas.at(i);
+		        NavPower::Area& s_curArea = s_NavGraph.m_areas.at(i);
 
 		        printf(
 			        "[%f, %f, %f, %f, %d, %d, [",
@@ -298,7 +294,7 @@ void OutputNavMesh_VIEWER_print(NavPower::NavMesh* p_NavMesh, const std::string
 
 		        for (int j = 0; j < s_curArea.m_edges.size(); j++)
 		        {
-			        NavPower::Binary::Edge* s_curEdge = s_curArea.m_edges.at(j);
+			        NavPower::Binary::Edge* s_curEdge = &s_curArea.m_edges[j];
 
 			        printf(
 				        "[%f, %f, %f, %d, %d],",
@@ -320,7 +316,7 @@ void OutputNavMesh_VIEWER_print(NavPower::NavMesh* p_NavMesh, const std::string
 
 	        for (auto const& s_curKDDepthToSplitAndBBoxes : s_kdTreeDepthToSplitAndBBoxesMap) {
 		        uint32_t s_curKdDepth = s_curKDDepthToSplitAndBBoxes.first;
-		        std::vector<std::pair<uint32_t, NavPower::BBox>> s_curKDDepthSplitAndBBoxes = s_curKDDepthToSplitAndBBoxes.second;
+		        const std::vector<std::pair<uint32_t, NavPower::BBox>>& s_curKDDepthSplitAndBBoxes = s_curKDDepthToSplitAndBBoxes.second;
 		        printf("%d:[", s_curKdDepth);
 		        for (int i = 0; i < s_curKDDepthSplitAndBBoxes.size(); i++)
 		        {
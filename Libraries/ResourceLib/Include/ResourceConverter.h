@@ -8,6 +8,7 @@ extern "C"
 #endif
 
 	struct JsonString;
+	struct ResourceMem;
 	
 	struct ResourceConverter
 	{
@@ -54,6 +55,33 @@ extern "C"
 		 * this function, and attempting to use it results in undefined behavior.
 		 */
 		void (*FreeJsonString)(JsonString* p_JsonString);
+
+		/**
+		 * Convert a resource from an in-memory buffer to a CBOR document and store it in memory as a
+		 * [ResourceMem]. The document is written directly from the in-memory structure and has the same shape
+		 * as the json representation, except that arrays of numbers (including fixed-size ones) are stored as
+		 * little-endian typed arrays (RFC 8746) of their element type. The [p_ResourceData] parameter
+		 * must point to the binary data of the resource and the [p_Size] parameter must be the size of
+		 * the resource in bytes. After using it, the [ResourceMem] must be cleaned up by passing it to the
+		 * [FreeResourceMem] function.
+		 *
+		 * If the operation fails, this function will return [nullptr].
+		 */
+		ResourceMem* (*FromMemoryToCbor)(const void* p_ResourceData, size_t p_Size);
+
+		/**
+		 * Convert a resource from an in-memory buffer to a CBOR document (see [FromMemoryToCbor]) and
+		 * store it in the [p_OutputFilePath] file on the filesystem.
+		 *
+		 * Returns [true] on success, or [false] otherwise.
+		 */
+		bool (*FromMemoryToCborFile)(const void* p_ResourceData, size_t p_Size, const char* p_OutputFilePath);
+
+		/**
+		 * Clean up an in-memory CBOR document. The [ResourceMem] becomes invalid after a call to
+		 * this function, and attempting to use it results in undefined behavior.
+		 */
+		void (*FreeResourceMem)(ResourceMem* p_ResourceMem);
 	};
 
 #ifdef __cplusplus
@@ -72,6 +72,29 @@ extern "C"
 		 * to this function, and attempting to use it results in undefined behavior.
 		 */
 		void (*FreeResourceMem)(ResourceMem* p_ResourceMem);
+
+		/**
+		 * Generate a new binary resource from a CBOR document, as produced by a converter's [FromMemoryToCbor]
+		 * function, and store it in the [p_ResourceFilePath] file on the filesystem. The [p_CborData] must
+		 * point to the CBOR data and the [p_CborSize] must be its size in bytes.
+		 *
+		 * The [p_GenerateCompatible] parameter works the same way as in [FromJsonStringToResourceFile].
+		 *
+		 * Returns [true] on success, or [false] otherwise.
+		 */
+		bool (*FromCborToResourceFile)(const void* p_CborData, size_t p_CborSize, const char* p_ResourceFilePath, bool p_GenerateCompatible);
+
+		/**
+		 * Generate a new binary resource from a CBOR document, as produced by a converter's [FromMemoryToCbor]
+		 * function, and store it in memory as a [ResourceMem]. The [p_CborData] must point to the CBOR data
+		 * and the [p_CborSize] must be its size in bytes. After using it, the [ResourceMem] must be cleaned up
+		 * by passing it to the [FreeResourceMem] function.
+		 *
+		 * The [p_GenerateCompatible] parameter works the same way as in [FromJsonStringToResourceMem].
+		 *
+		 * If the operation fails, this function will return [nullptr].
+		 */
+		ResourceMem* (*FromCborToResourceMem)(const void* p_CborData, size_t p_CborSize, bool p_GenerateCompatible);
 	};
 
 #ifdef __cplusplus
@@ -99,6 +99,186 @@ extern "C"
 	 */
 	RESOURCELIB_API void RL_TARGET_FUNC(SetAllocator)(Allocator* p_Allocator);
 
+	/**
+	 * Synthesize a binary resource of the given resource type (eg. TEMP), filled with deterministic
+	 * pseudo-random data according to [p_Options]. Struct layouts and enum values are read from the
+	 * [p_TypesJsonPath] file, which is the ZHMTypes.json file produced by CodeGen for this game. Types
+	 * that aren't described there are written in their default state.
+	 * After using it, the [ResourceMem] must be cleaned up by passing it to the [FreeResourceMem] function.
+	 *
+	 * If the operation fails, this function will return [nullptr].
+	 */
+	RESOURCELIB_API ResourceMem* RL_TARGET_FUNC(SynthesizeResource)(const char* p_ResourceType, const char* p_TypesJsonPath, const SyntheticResourceOptions* p_Options);
+
+	/**
+	 * Clean up an in-memory binary resource. The [ResourceMem] becomes invalid after a call
+	 * to this function, and attempting to use it results in undefined behavior.
+	 */
+	RESOURCELIB_API void RL_TARGET_FUNC(FreeResourceMem)(ResourceMem* p_ResourceMem);
+
+	/**
+	 * Enable or disable payload deduplication for generators. While enabled, identical strings and arrays of
+	 * primitive values in a generated resource share a single copy of their data, which makes the resulting
+	 * resources smaller. The game only accesses this data through pointers, so it's unaffected by this.
+	 * Deduplication is disabled by default.
+	 */
+	RESOURCELIB_API void RL_TARGET_FUNC(SetPayloadDeduplicationEnabled)(bool p_Enabled);
+
+	/**
+	 * Set the size in bytes above which binary fields (eg. byte blobs and arrays of numbers) are written to a sidecar
+	 * file instead of the json when converting resources to json files. The sidecar is written next to the json file,
+	 * with ".bin" appended to its name, and the json references the data in it by offset and length. Generators
+	 * resolve these references from the sidecar of the json file they're given.
+	 * Pass 0 to write everything inline, which is the default.
+	 */
+	RESOURCELIB_API void RL_TARGET_FUNC(SetBinarySidecarThreshold)(size_t p_MinSize);
+
+	/**
+	 * Set the number of threads (including the calling one) used to convert and generate resources. While set to
+	 * more than 1, large arrays (eg. TEMP sub-entities or AIRG waypoints) are split into ranges that are converted
+	 * to json, parsed from json, or serialized into resources on a pool of worker threads, which makes processing
+	 * big resources much faster. The output is the same as when processing them on a single thread. Arrays are
+	 * never split while writing binary sidecar files, or while serializing in compatibility mode or with payload
+	 * deduplication enabled.
+	 * Pass 0 or 1 to do all the work on the calling thread, which is the default.
+	 */
+	RESOURCELIB_API void RL_TARGET_FUNC(SetWorkerThreadCount)(size_t p_ThreadCount);
+
+	/**
+	 * Register the structs and enums described in [p_TypesJsonPath], which is the ZHMTypes.json file produced by
+	 * CodeGen for this game, that this library doesn't already know about. This allows converting resources and
+	 * properties that use types added in newer versions of the game without updating the library.
+	 * This must not be called while other threads are converting or generating resources.
+	 *
+	 * Returns the number of types that were registered, or -1 if the file could not be loaded.
+	 */
+	RESOURCELIB_API int64_t RL_TARGET_FUNC(LoadTypes)(const char* p_TypesJsonPath);
+
+	/**
+	 * Get the timing and allocation statistics collected for each resource type since the library was
+	 * loaded or [HMX_ResetStats] was last called. Statistics are aggregated across all calls to the
+	 * converters and generators of each resource type.
+	 * After using the result of this function it must be cleaned up by passing it to the [HMX_FreeStats] function.
+	 */
+	RESOURCELIB_API ResourceStatsArray* RL_TARGET_FUNC(GetStats)();
+
+	/**
+	 * Clean up a statistics array. The [ResourceStatsArray] becomes invalid after a call to this
+	 * function, and attempting to use it results in undefined behavior.
+	 */
+	RESOURCELIB_API void RL_TARGET_FUNC(FreeStats)(ResourceStatsArray* p_Array);
+
+	/**
+	 * Reset all collected statistics to zero.
+	 */
+	RESOURCELIB_API void RL_TARGET_FUNC(ResetStats)();
+
+	/**
+	 * Enable or disable tracing. While enabled, every conversion and generation records trace events for itself,
+	 * each of its phases and each of the top-level arrays it writes to json (and the parts of them written on
+	 * worker threads) into a per-thread ring buffer. Tracing is disabled by default.
+	 */
+	RESOURCELIB_API void RL_TARGET_FUNC(SetTracingEnabled)(bool p_Enabled);
+
+	/**
+	 * Get the trace events recorded so far by all threads, in the Chrome trace event json format, which can be
+	 * opened in chrome://tracing or Perfetto. Each thread only keeps its most recent events.
+	 * After using it, the [JsonString] must be cleaned up by passing it to the [FreeJsonString] function.
+	 */
+	RESOURCELIB_API JsonString* RL_TARGET_FUNC(GetTraceJson)();
+
+	/**
+	 * Discard all recorded trace events.
+	 */
+	RESOURCELIB_API void RL_TARGET_FUNC(ClearTrace)();
+
+	/**
+	 * Start converting a resource of the given type (eg. TEMP) from an in-memory buffer to its json representation
+	 * in the background, and return a handle to the job. The resource data is copied, so it can be freed as soon as
+	 * this returns. Once the job succeeds, its [JsonString] can be taken with [HMX_TakeJobJsonString].
+	 *
+	 * Jobs run on background threads owned by the library, and up to as many of them as set with
+	 * [HMX_SetWorkerThreadCount] run at the same time. [p_Callback] is called exactly once for every job, from the
+	 * thread that ran it, once it has succeeded, failed or been cancelled, even if its handle was already freed.
+	 * It can be [nullptr], in which case [HMX_PollJob] or [HMX_WaitForJob] can be used instead.
+	 * After using it, the [ResourceJob] must be cleaned up by passing it to the [HMX_FreeJob] function.
+	 *
+	 * If a converter for this resource type doesn't exist, this function will return [nullptr].
+	 */
+	RESOURCELIB_API ResourceJob* RL_TARGET_FUNC(SubmitMemoryToJsonString)(const char* p_ResourceType, const void* p_ResourceData, size_t p_Size, ResourceJobCallback p_Callback, void* p_UserData);
+
+	/**
+	 * Start converting the binary resource of the given type (eg. TEMP) found at [p_ResourceFilePath] to its json
+	 * representation in the background. See [HMX_SubmitMemoryToJsonString] for how jobs work.
+	 *
+	 * If a converter for this resource type doesn't exist, this function will return [nullptr].
+	 */
+	RESOURCELIB_API ResourceJob* RL_TARGET_FUNC(SubmitResourceFileToJsonString)(const char* p_ResourceType, const char* p_ResourceFilePath, ResourceJobCallback p_Callback, void* p_UserData);
+
+	/**
+	 * Start generating a binary resource of the given type (eg. TEMP) from the specified json string in the
+	 * background. The json string is copied, so it can be freed as soon as this returns. Once the job succeeds,
+	 * its [ResourceMem] can be taken with [HMX_TakeJobResourceMem]. See [HMX_SubmitMemoryToJsonString] for how
+	 * jobs work.
+	 *
+	 * If a generator for this resource type doesn't exist, this function will return [nullptr].
+	 */
+	RESOURCELIB_API ResourceJob* RL_TARGET_FUNC(SubmitJsonStringToResourceMem)(const char* p_ResourceType, const char* p_JsonStr, size_t p_JsonStrLength, bool p_GenerateCompatible, ResourceJobCallback p_Callback, void* p_UserData);
+
+	/**
+	 * Start generating a binary resource of the given type (eg. TEMP) from the json file found at [p_JsonFilePath]
+	 * in the background. See [HMX_SubmitJsonStringToResourceMem] for how jobs work.
+	 *
+	 * If a generator for this resource type doesn't exist, this function will return [nullptr].
+	 */
+	RESOURCELIB_API ResourceJob* RL_TARGET_FUNC(SubmitJsonFileToResourceMem)(const char* p_ResourceType, const char* p_JsonFilePath, bool p_GenerateCompatible, ResourceJobCallback p_Callback, void* p_UserData);
+
+	/**
+	 * Get the status of a job without waiting for it. If [p_Progress] isn't [nullptr], it's filled in with the
+	 * current progress of the job.
+	 */
+	RESOURCELIB_API ResourceJobStatus RL_TARGET_FUNC(PollJob)(ResourceJob* p_Job, ResourceJobProgress* p_Progress);
+
+	/**
+	 * Wait for up to [p_TimeoutMs] milliseconds for a job to succeed, fail or be cancelled, and return its status.
+	 * Pass [UINT32_MAX] to wait for as long as it takes.
+	 */
+	RESOURCELIB_API ResourceJobStatus RL_TARGET_FUNC(WaitForJob)(ResourceJob* p_Job, uint32_t p_TimeoutMs);
+
+	/**
+	 * Ask a job to stop. Queued jobs never start, and running ones stop at the next phase or array element they
+	 * get to, after which their status becomes [ResourceJobStatus_Cancelled]. Jobs that are already done are
+	 * unaffected.
+	 */
+	RESOURCELIB_API void RL_TARGET_FUNC(CancelJob)(ResourceJob* p_Job);
+
+	/**
+	 * Get the reason a failed job failed. The string stays valid until the job is freed.
+	 * Returns [nullptr] if the job hasn't failed.
+	 */
+	RESOURCELIB_API const char* RL_TARGET_FUNC(GetJobError)(ResourceJob* p_Job);
+
+	/**
+	 * Take the [JsonString] produced by a conversion job that succeeded. After using it, the [JsonString] must be
+	 * cleaned up by passing it to the [HMX_FreeJsonString] function.
+	 * Returns [nullptr] if the job didn't produce one, or if it was already taken.
+	 */
+	RESOURCELIB_API JsonString* RL_TARGET_FUNC(TakeJobJsonString)(ResourceJob* p_Job);
+
+	/**
+	 * Take the [ResourceMem] produced by a generation job that succeeded. After using it, the [ResourceMem] must be
+	 * cleaned up by passing it to the [HMX_FreeResourceMem] function.
+	 * Returns [nullptr] if the job didn't produce one, or if it was already taken.
+	 */
+	RESOURCELIB_API ResourceMem* RL_TARGET_FUNC(TakeJobResourceMem)(ResourceJob* p_Job);
+
+	/**
+	 * Clean up a job, along with any results that weren't taken. Jobs that are still queued or running are cancelled
+	 * and cleaned up once they stop. The [ResourceJob] becomes invalid after a call to this function, and attempting
+	 * to use it results in undefined behavior.
+	 */
+	RESOURCELIB_API void RL_TARGET_FUNC(FreeJob)(ResourceJob* p_Job);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 
 #ifdef __cplusplus
 extern "C"
@@ -51,6 +52,158 @@ extern "C"
 		void (*Free)(void* p_Ptr);
 	};
 
+	/**
+	 * Options controlling the contents and size of a synthesized resource.
+	 */
+	struct SyntheticResourceOptions
+	{
+		/**
+		 * Seed for the pseudo-random generator. The same seed and options always produce the same resource.
+		 */
+		uint64_t Seed;
+
+		/**
+		 * Number of elements in arrays that are the root of the resource or a direct member of it
+		 * (eg. the sub-entities of a TEMP).
+		 */
+		uint32_t RootArrayLength;
+
+		/**
+		 * Number of elements in all other arrays (eg. the properties of each TEMP sub-entity).
+		 */
+		uint32_t NestedArrayLength;
+
+		/**
+		 * Maximum length of generated strings.
+		 */
+		uint32_t MaxStringLength;
+
+		/**
+		 * Nesting depth after which arrays are left empty and variants only hold primitive values.
+		 */
+		uint32_t MaxDepth;
+	};
+
+	/**
+	 * The phases a resource goes through while being converted or generated.
+	 */
+	enum ResourcePhase
+	{
+		/**
+		 * Reading resource or json files from disk, and writing generated resources to it.
+		 */
+		ResourcePhase_FileIO = 0,
+
+		/**
+		 * Parsing the BIN1 header and applying relocations, type ids and other segments.
+		 */
+		ResourcePhase_Relocation,
+
+		/**
+		 * Writing the in-memory structure out as json (or CBOR).
+		 */
+		ResourcePhase_JsonWrite,
+
+		/**
+		 * Parsing json (or CBOR) and building the in-memory structure from it.
+		 */
+		ResourcePhase_JsonParse,
+
+		/**
+		 * Serializing the in-memory structure.
+		 */
+		ResourcePhase_Serialize,
+
+		/**
+		 * Generating segments and assembling the final BIN1 resource.
+		 */
+		ResourcePhase_SegmentGeneration,
+
+		ResourcePhase_Count,
+	};
+
+	struct ResourcePhaseStats
+	{
+		/**
+		 * Number of times this phase was entered.
+		 */
+		uint64_t Calls;
+
+		/**
+		 * Total time spent in this phase, in nanoseconds.
+		 */
+		uint64_t Nanoseconds;
+
+		/**
+		 * Number of allocations made through the library allocator while in this phase, and their total size.
+		 */
+		uint64_t Allocations;
+		uint64_t AllocatedBytes;
+	};
+
+	struct ResourceTypeStats
+	{
+		/**
+		 * The resource type (eg. TEMP) these statistics are for.
+		 */
+		const char* ResourceType;
+
+		/**
+		 * Number of binary -> json conversions and json -> binary generations of this resource type.
+		 */
+		uint64_t Conversions;
+		uint64_t Generations;
+
+		ResourcePhaseStats Phases[ResourcePhase_Count];
+	};
+
+	struct ResourceStatsArray
+	{
+		ResourceTypeStats* Stats;
+		size_t StatsCount;
+	};
+
+	/**
+	 * A handle to a conversion or generation running in the background.
+	 */
+	struct ResourceJob;
+
+	enum ResourceJobStatus
+	{
+		/**
+		 * Waiting for a thread to pick it up.
+		 */
+		ResourceJobStatus_Queued = 0,
+
+		ResourceJobStatus_Running,
+		ResourceJobStatus_Succeeded,
+		ResourceJobStatus_Failed,
+		ResourceJobStatus_Cancelled,
+	};
+
+	struct ResourceJobProgress
+	{
+		ResourceJobStatus Status;
+
+		/**
+		 * The phase the job is currently in.
+		 */
+		ResourcePhase Phase;
+
+		/**
+		 * Number of elements of huge arrays (eg. TEMP sub-entities) that have been gone through in the current phase,
+		 * out of the ones found so far. Both of these are reset whenever the job moves to another phase, and stay at 0
+		 * for resources without any huge arrays.
+		 */
+		uint64_t CompletedElements;
+		uint64_t TotalElements;
+	};
+
+	/**
+	 * Called once a job has succeeded, failed or been cancelled, from the thread that ran it.
+	 */
+	typedef void (*ResourceJobCallback)(ResourceJobStatus p_Status, void* p_UserData);
+
 #ifdef __cplusplus
 }
 #endif
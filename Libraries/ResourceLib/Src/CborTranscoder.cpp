@@ -0,0 +1,320 @@
+#include "CborTranscoder.h"
+
+#include <vector>
+
+#include <External/simdjson_helpers.h>
+
+// Arrays shorter than this aren't worth the extra tag and byte string header.
+constexpr size_t c_MinTypedArrayLength = 4;
+
+static bool IsExactFloat(double p_Value)
+{
+	return static_cast<double>(static_cast<float>(p_Value)) == p_Value;
+}
+
+static ECborTypedArray GetTypedArrayKind(simdjson::dom::array p_Array)
+{
+	bool s_AllIntegers = true;
+	bool s_AllFloat32 = true;
+	bool s_AllFloat64 = true;
+	bool s_HasLargeUnsigned = false;
+
+	int64_t s_Min = 0;
+	int64_t s_Max = 0;
+
+	for (auto s_Element : p_Array)
+	{
+		switch (s_Element.type())
+		{
+			case simdjson::dom::element_type::INT64:
+			{
+				const int64_t s_Value = s_Element.get_int64();
+				s_Min = (std::min)(s_Min, s_Value);
+				s_Max = (std::max)(s_Max, s_Value);
+
+				// Integers mixed with floats must be representable exactly by the float type.
+				if (s_Value < -(int64_t(1) << 24) || s_Value > (int64_t(1) << 24))
+					s_AllFloat32 = false;
+
+				if (s_Value < -(int64_t(1) << 53) || s_Value > (int64_t(1) << 53))
+					s_AllFloat64 = false;
+
+				break;
+			}
+
+			case simdjson::dom::element_type::UINT64:
+				s_HasLargeUnsigned = true;
+				s_AllFloat32 = false;
+				s_AllFloat64 = false;
+				break;
+
+			case simdjson::dom::element_type::DOUBLE:
+			{
+				s_AllIntegers = false;
+
+				if (!IsExactFloat(s_Element.get_double()))
+					s_AllFloat32 = false;
+
+				break;
+			}
+
+			default:
+				return ECborTypedArray::None;
+		}
+	}
+
+	if (s_AllIntegers)
+	{
+		if (s_Min >= 0)
+		{
+			if (s_HasLargeUnsigned || s_Max > 0xFFFFFFFF)
+				return ECborTypedArray::UInt64;
+
+			if (s_Max > 0xFFFF)
+				return ECborTypedArray::UInt32;
+
+			if (s_Max > 0xFF)
+				return ECborTypedArray::UInt16;
+
+			return ECborTypedArray::UInt8;
+		}
+
+		if (s_HasLargeUnsigned)
+			return ECborTypedArray::None;
+
+		if (s_Min >= INT8_MIN && s_Max <= INT8_MAX)
+			return ECborTypedArray::Int8;
+
+		if (s_Min >= INT16_MIN && s_Max <= INT16_MAX)
+			return ECborTypedArray::Int16;
+
+		if (s_Min >= INT32_MIN && s_Max <= INT32_MAX)
+			return ECborTypedArray::Int32;
+
+		return ECborTypedArray::Int64;
+	}
+
+	if (s_AllFloat32)
+		return ECborTypedArray::Float32;
+
+	if (s_AllFloat64)
+		return ECborTypedArray::Float64;
+
+	return ECborTypedArray::None;
+}
+
+template <class T>
+static void WriteTypedArray(simdjson::dom::array p_Array, CborWriter& p_Writer)
+{
+	std::vector<T> s_Values;
+	s_Values.reserve(p_Array.size());
+
+	for (auto s_Element : p_Array)
+	{
+		if constexpr (std::is_floating_point_v<T>)
+			s_Values.push_back(static_cast<T>(static_cast<double>(s_Element.get_double())));
+		else if (s_Element.type() == simdjson::dom::element_type::UINT64)
+			s_Values.push_back(static_cast<T>(static_cast<uint64_t>(s_Element.get_uint64())));
+		else
+			s_Values.push_back(static_cast<T>(static_cast<int64_t>(s_Element.get_int64())));
+	}
+
+	p_Writer.WriteTypedArray(s_Values.data(), s_Values.size());
+}
+
+void CborTranscoder::JsonToCbor(simdjson::dom::element p_Element, CborWriter& p_Writer)
+{
+	switch (p_Element.type())
+	{
+		case simdjson::dom::element_type::OBJECT:
+		{
+			const simdjson::dom::object s_Object = p_Element.get_object();
+			p_Writer.BeginMap(s_Object.size());
+
+			for (auto s_Field : s_Object)
+			{
+				p_Writer.WriteText(s_Field.key);
+				JsonToCbor(s_Field.value, p_Writer);
+			}
+
+			break;
+		}
+
+		case simdjson::dom::element_type::ARRAY:
+		{
+			const simdjson::dom::array s_Array = p_Element.get_array();
+			const auto s_Size = s_Array.size();
+
+			if (s_Size >= c_MinTypedArrayLength)
+			{
+				switch (GetTypedArrayKind(s_Array))
+				{
+					case ECborTypedArray::UInt8: WriteTypedArray<uint8_t>(s_Array, p_Writer); return;
+					case ECborTypedArray::UInt16: WriteTypedArray<uint16_t>(s_Array, p_Writer); return;
+					case ECborTypedArray::UInt32: WriteTypedArray<uint32_t>(s_Array, p_Writer); return;
+					case ECborTypedArray::UInt64: WriteTypedArray<uint64_t>(s_Array, p_Writer); return;
+					case ECborTypedArray::Int8: WriteTypedArray<int8_t>(s_Array, p_Writer); return;
+					case ECborTypedArray::Int16: WriteTypedArray<int16_t>(s_Array, p_Writer); return;
+					case ECborTypedArray::Int32: WriteTypedArray<int32_t>(s_Array, p_Writer); return;
+					case ECborTypedArray::Int64: WriteTypedArray<int64_t>(s_Array, p_Writer); return;
+					case ECborTypedArray::Float32: WriteTypedArray<float>(s_Array, p_Writer); return;
+					case ECborTypedArray::Float64: WriteTypedArray<double>(s_Array, p_Writer); return;
+					default: break;
+				}
+			}
+
+			p_Writer.BeginArray(s_Size);
+
+			for (auto s_Item : s_Array)
+				JsonToCbor(s_Item, p_Writer);
+
+			break;
+		}
+
+		case simdjson::dom::element_type::INT64:
+			p_Writer.WriteInteger(static_cast<int64_t>(p_Element.get_int64()));
+			break;
+
+		case simdjson::dom::element_type::UINT64:
+			p_Writer.WriteInteger(static_cast<uint64_t>(p_Element.get_uint64()));
+			break;
+
+		case simdjson::dom::element_type::DOUBLE:
+			p_Writer.WriteDouble(p_Element.get_double());
+			break;
+
+		case simdjson::dom::element_type::STRING:
+			p_Writer.WriteText(p_Element.get_string());
+			break;
+
+		case simdjson::dom::element_type::BOOL:
+			p_Writer.WriteBool(p_Element.get_bool());
+			break;
+
+		case simdjson::dom::element_type::NULL_VALUE:
+			p_Writer.WriteNull();
+			break;
+	}
+}
+
+template <class T>
+static void TypedArrayToJson(const CborTypedArrayView& p_Array, std::string& p_Json)
+{
+	std::vector<T> s_Values(p_Array.m_Count);
+	CborReader::ReadTypedArray(p_Array, s_Values.data());
+
+	p_Json += '[';
+
+	for (size_t i = 0; i < s_Values.size(); ++i)
+	{
+		if (i != 0)
+			p_Json += ',';
+
+		if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+			p_Json += simdjson::as_json_string(static_cast<int64_t>(s_Values[i]));
+		else if constexpr (std::is_integral_v<T>)
+			p_Json += simdjson::as_json_string(static_cast<uint64_t>(s_Values[i]));
+		else
+			p_Json += simdjson::as_json_string(s_Values[i]);
+	}
+
+	p_Json += ']';
+}
+
+void CborTranscoder::CborToJson(CborReader& p_Reader, std::string& p_Json)
+{
+	switch (p_Reader.PeekType())
+	{
+		case ECborMajorType::UnsignedInt:
+			p_Json += simdjson::as_json_string(p_Reader.ReadUInt());
+			break;
+
+		case ECborMajorType::NegativeInt:
+			p_Json += simdjson::as_json_string(p_Reader.ReadInt());
+			break;
+
+		case ECborMajorType::ByteString:
+			throw std::runtime_error("CBOR byte strings are only supported as typed arrays.");
+
+		case ECborMajorType::TextString:
+			p_Json += simdjson::as_json_string(p_Reader.ReadText());
+			break;
+
+		case ECborMajorType::Array:
+		{
+			auto s_Array = p_Reader.ReadArray();
+
+			p_Json += '[';
+
+			for (bool s_First = true; p_Reader.Next(s_Array); s_First = false)
+			{
+				if (!s_First)
+					p_Json += ',';
+
+				CborToJson(p_Reader, p_Json);
+			}
+
+			p_Json += ']';
+			break;
+		}
+
+		case ECborMajorType::Map:
+		{
+			auto s_Map = p_Reader.ReadMap();
+
+			p_Json += '{';
+
+			for (bool s_First = true; p_Reader.Next(s_Map); s_First = false)
+			{
+				if (!s_First)
+					p_Json += ',';
+
+				if (p_Reader.PeekType() != ECborMajorType::TextString)
+					throw std::runtime_error("CBOR map keys must be text strings.");
+
+				p_Json += simdjson::as_json_string(p_Reader.ReadText());
+				p_Json += ':';
+
+				CborToJson(p_Reader, p_Json);
+			}
+
+			p_Json += '}';
+			break;
+		}
+
+		case ECborMajorType::Tag:
+		{
+			// Other tags are skipped by the reader, so this is always a typed array.
+			const auto s_Array = *p_Reader.TryReadTypedArray();
+
+			switch (s_Array.m_Kind)
+			{
+				case ECborTypedArray::UInt8: TypedArrayToJson<uint8_t>(s_Array, p_Json); break;
+				case ECborTypedArray::UInt16: TypedArrayToJson<uint16_t>(s_Array, p_Json); break;
+				case ECborTypedArray::UInt32: TypedArrayToJson<uint32_t>(s_Array, p_Json); break;
+				case ECborTypedArray::UInt64: TypedArrayToJson<uint64_t>(s_Array, p_Json); break;
+				case ECborTypedArray::Int8: TypedArrayToJson<int8_t>(s_Array, p_Json); break;
+				case ECborTypedArray::Int16: TypedArrayToJson<int16_t>(s_Array, p_Json); break;
+				case ECborTypedArray::Int32: TypedArrayToJson<int32_t>(s_Array, p_Json); break;
+				case ECborTypedArray::Int64: TypedArrayToJson<int64_t>(s_Array, p_Json); break;
+				case ECborTypedArray::Float32: TypedArrayToJson<float>(s_Array, p_Json); break;
+				case ECborTypedArray::Float64: TypedArrayToJson<double>(s_Array, p_Json); break;
+				default: break;
+			}
+
+			break;
+		}
+
+		case ECborMajorType::Simple:
+		{
+			if (p_Reader.TryReadNull())
+				p_Json += "null";
+			else if (const auto s_Bool = p_Reader.TryReadBool())
+				p_Json += *s_Bool ? "true" : "false";
+			else
+				p_Json += simdjson::as_json_string(p_Reader.ReadDouble());
+
+			break;
+		}
+	}
+}
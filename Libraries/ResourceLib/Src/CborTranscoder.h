@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string>
+
+#include <External/simdjson.h>
+#include <Util/Cbor.h>
+
+/**
+ * Converts between json and CBOR (RFC 8949) items of the same shape: objects become maps with text keys,
+ * arrays stay arrays, and so on. Arrays made up solely of numbers are written as little-endian typed arrays
+ * (RFC 8746), using the smallest element type that can hold every value exactly.
+ *
+ * Resources are written and read as CBOR by their type infos directly (see ZHMCbor.h). This is only used
+ * for the few hand-written types that don't have CBOR code of their own.
+ */
+class CborTranscoder
+{
+public:
+	static void JsonToCbor(simdjson::dom::element p_Element, CborWriter& p_Writer);
+
+	/**
+	 * Appends the next item of [p_Reader] to [p_Json]. Throws a [std::runtime_error] if the item is malformed
+	 * or uses features that can't be represented in json (eg. non-text map keys).
+	 */
+	static void CborToJson(CborReader& p_Reader, std::string& p_Json);
+};
@@ -2,6 +2,7 @@
 
 #include "simdjson.h"
 #include "ZHM/ZString.h"
+#include "Util/FloatFormatting.h"
 
 namespace simdjson
 {
@@ -106,14 +107,16 @@ namespace simdjson
 
 	inline std::string as_json_string(double p_Value)
 	{
-		char s_NumberBuffer[24];
-		char* s_BufferEnd = internal::to_chars(s_NumberBuffer, nullptr, p_Value);
+		char s_NumberBuffer[c_MaxFloatChars];
+		char* s_BufferEnd = WriteShortestFloat(s_NumberBuffer, p_Value);
 		return std::string(s_NumberBuffer, s_BufferEnd);
 	}
 
 	inline std::string as_json_string(float p_Value)
 	{
-		return as_json_string(static_cast<double>(p_Value));
+		char s_NumberBuffer[c_MaxFloatChars];
+		char* s_BufferEnd = WriteShortestFloat(s_NumberBuffer, p_Value);
+		return std::string(s_NumberBuffer, s_BufferEnd);
 	}
 
 	inline std::string as_json_string(std::string_view p_Value)
@@ -8,16 +8,16 @@
 #pragma once
 
 #include <cstdint>
+#include <mutex>
 #include <unordered_map>
 #include <string>
 
 class ZHMEnums
 {
 private:
-	struct EnumRegistrar { EnumRegistrar() { RegisterEnums(); } };
 	static std::unordered_map<std::string, std::unordered_map<int32_t, std::string>>* g_Enums;
 	static std::unordered_map<std::string, uint32_t>* g_EnumSizes;
-	static EnumRegistrar g_Registrar;
+	static std::once_flag g_EnumsRegistered;
 	static void RegisterEnums();
 
 public:
@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <ZHM/ZHMPrimitives.h>
 #include <ZHM/ZHMTypeInfo.h>
+#include <ZHM/ZHMTypeTables.h>
 
 class ZHMTypeInfo;
 
@@ -251,14 +252,12 @@ namespace AI {
 		class alignas(8) SPoolModificationEvent
 		{
 		public:
-			static ZHMTypeInfo TypeInfo;
-			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-			static bool Equals(void* p_Left, void* p_Right);
-			static void Destroy(void* p_Object);
-
-			bool operator==(const SPoolModificationEvent& p_Other) const;
+			static ZHMTableTypeInfo TypeInfo;
+			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+			bool operator==(const SPoolModificationEvent& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 			bool operator!=(const SPoolModificationEvent& p_Other) const { return !(*this == p_Other); }
 
 			uint32 StimulusTypeId; // 0x0
@@ -283,14 +282,12 @@ namespace AI {
 		class alignas(8) SStimulusSnapshot
 		{
 		public:
-			static ZHMTypeInfo TypeInfo;
-			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-			static bool Equals(void* p_Left, void* p_Right);
-			static void Destroy(void* p_Object);
-
-			bool operator==(const SStimulusSnapshot& p_Other) const;
+			static ZHMTableTypeInfo TypeInfo;
+			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+			bool operator==(const SStimulusSnapshot& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 			bool operator!=(const SStimulusSnapshot& p_Other) const { return !(*this == p_Other); }
 
 			uint32 SlotIndex; // 0x0
@@ -305,14 +302,12 @@ namespace AI {
 		class alignas(8) SPoolSnapshot
 		{
 		public:
-			static ZHMTypeInfo TypeInfo;
-			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-			static bool Equals(void* p_Left, void* p_Right);
-			static void Destroy(void* p_Object);
-
-			bool operator==(const SPoolSnapshot& p_Other) const;
+			static ZHMTableTypeInfo TypeInfo;
+			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+			bool operator==(const SPoolSnapshot& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 			bool operator!=(const SPoolSnapshot& p_Other) const { return !(*this == p_Other); }
 
 			ZString StimulusTypeName; // 0x0
@@ -332,14 +327,14 @@ namespace AI {
 			class alignas(4) SStimulus_AgentData_SaveData
 			{
 			public:
-				static ZHMTypeInfo TypeInfo;
-				static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-				static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-				static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-				static bool Equals(void* p_Left, void* p_Right);
-				static void Destroy(void* p_Object);
-
-				bool operator==(const SStimulus_AgentData_SaveData& p_Other) const;
+				static ZHMTableTypeInfo TypeInfo;
+				static constexpr bool IsRelocationFree = true;
+
+				static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+				static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+				static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+				bool operator==(const SStimulus_AgentData_SaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 				bool operator!=(const SStimulus_AgentData_SaveData& p_Other) const { return !(*this == p_Other); }
 
 				uint32 m_AgentData; // 0x0
@@ -352,14 +347,12 @@ namespace AI {
 			class alignas(8) SBaseStimulus_Pool_SaveData
 			{
 			public:
-				static ZHMTypeInfo TypeInfo;
-				static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-				static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-				static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-				static bool Equals(void* p_Left, void* p_Right);
-				static void Destroy(void* p_Object);
-
-				bool operator==(const SBaseStimulus_Pool_SaveData& p_Other) const;
+				static ZHMTableTypeInfo TypeInfo;
+				static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+				static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+				static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+				bool operator==(const SBaseStimulus_Pool_SaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 				bool operator!=(const SBaseStimulus_Pool_SaveData& p_Other) const { return !(*this == p_Other); }
 
 				TArray<uint32> m_SlotDetails; // 0x0
@@ -378,14 +371,12 @@ namespace AI {
 		class alignas(8) SFullDataSnapshotEvent
 		{
 		public:
-			static ZHMTypeInfo TypeInfo;
-			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-			static bool Equals(void* p_Left, void* p_Right);
-			static void Destroy(void* p_Object);
-
-			bool operator==(const SFullDataSnapshotEvent& p_Other) const;
+			static ZHMTableTypeInfo TypeInfo;
+			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+			bool operator==(const SFullDataSnapshotEvent& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 			bool operator!=(const SFullDataSnapshotEvent& p_Other) const { return !(*this == p_Other); }
 
 			uint64 Timestamp; // 0x0
@@ -402,14 +393,12 @@ namespace AI {
 		class alignas(8) SPoolModificationCollectionEvent
 		{
 		public:
-			static ZHMTypeInfo TypeInfo;
-			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-			static bool Equals(void* p_Left, void* p_Right);
-			static void Destroy(void* p_Object);
-
-			bool operator==(const SPoolModificationCollectionEvent& p_Other) const;
+			static ZHMTableTypeInfo TypeInfo;
+			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+			bool operator==(const SPoolModificationCollectionEvent& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 			bool operator!=(const SPoolModificationCollectionEvent& p_Other) const { return !(*this == p_Other); }
 
 			TArray<AI::Private::SPoolModificationEvent> PoolModificationEvents; // 0x0
@@ -424,14 +413,14 @@ namespace AI {
 	class alignas(4) SEventDescription
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SEventDescription& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SEventDescription& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SEventDescription& p_Other) const { return !(*this == p_Other); }
 
 		EAIEventType m_eEventType; // 0x0
@@ -454,14 +443,14 @@ namespace AI {
 		class alignas(4) SData
 		{
 		public:
-			static ZHMTypeInfo TypeInfo;
-			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-			static bool Equals(void* p_Left, void* p_Right);
-			static void Destroy(void* p_Object);
-
-			bool operator==(const SData& p_Other) const;
+			static ZHMTableTypeInfo TypeInfo;
+			static constexpr bool IsRelocationFree = true;
+
+			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+			bool operator==(const SData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 			bool operator!=(const SData& p_Other) const { return !(*this == p_Other); }
 
 			uint32 m_BulletsToFire; // 0x0
@@ -476,14 +465,12 @@ namespace AI {
 
 
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SFirePattern01& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SFirePattern01& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SFirePattern01& p_Other) const { return !(*this == p_Other); }
 
 		TArray<AI::SFirePattern01::SData> m_PatternSequenceData; // 0x0
@@ -500,14 +487,14 @@ namespace AI {
 		class alignas(4) SData
 		{
 		public:
-			static ZHMTypeInfo TypeInfo;
-			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-			static bool Equals(void* p_Left, void* p_Right);
-			static void Destroy(void* p_Object);
-
-			bool operator==(const SData& p_Other) const;
+			static ZHMTableTypeInfo TypeInfo;
+			static constexpr bool IsRelocationFree = true;
+
+			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+			bool operator==(const SData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 			bool operator!=(const SData& p_Other) const { return !(*this == p_Other); }
 
 			float32 m_FireMinSeconds; // 0x0
@@ -524,14 +511,12 @@ namespace AI {
 
 
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SFirePattern02& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SFirePattern02& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SFirePattern02& p_Other) const { return !(*this == p_Other); }
 
 		TArray<AI::SFirePattern02::SData> m_PatternSequenceData; // 0x0
@@ -544,14 +529,14 @@ namespace AI {
 	class alignas(4) SSoundEventModifierState
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSoundEventModifierState& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSoundEventModifierState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSoundEventModifierState& p_Other) const { return !(*this == p_Other); }
 
 		float32 m_fRangeModifier; // 0x0
@@ -572,14 +557,14 @@ namespace AnimationEventDataTypes {
 	class alignas(4) SBlend
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SBlend& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SBlend& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SBlend& p_Other) const { return !(*this == p_Other); }
 
 		float32 m_fBlendTime; // 0x0
@@ -592,14 +577,14 @@ namespace AnimationEventDataTypes {
 	class alignas(4) SLegacy
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SLegacy& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SLegacy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SLegacy& p_Other) const { return !(*this == p_Other); }
 
 		int32 m_nEventID; // 0x0
@@ -614,14 +599,12 @@ namespace AnimationEventDataTypes {
 class alignas(4) ZRuntimeResourceID
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZRuntimeResourceID& p_Other) const;
+	bool operator==(const ZRuntimeResourceID& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZRuntimeResourceID& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_IDHigh; // 0x0
@@ -637,14 +620,12 @@ namespace AnimationTakeDataTypes {
 	class alignas(4) SGeneric
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SGeneric& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SGeneric& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SGeneric& p_Other) const { return !(*this == p_Other); }
 
 		float32 m_fTest; // 0x0
@@ -7810,14 +7791,14 @@ enum class GameLobbyState : int32_t
 class alignas(4) SVector3
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVector3& p_Other) const;
+	bool operator==(const SVector3& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVector3& p_Other) const { return !(*this == p_Other); }
 
 	float32 x; // 0x0
@@ -7834,14 +7815,14 @@ static_assert(alignof(SVector3) == 0x4, "Wrong alignment for SVector3");
 class alignas(4) SMatrix43
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMatrix43& p_Other) const;
+	bool operator==(const SMatrix43& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMatrix43& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 XAxis; // 0x0
@@ -7918,14 +7899,12 @@ public:
 class alignas(8) ZDynamicObject
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZDynamicObject& p_Other) const;
+	bool operator==(const ZDynamicObject& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZDynamicObject& p_Other) const { return !(*this == p_Other); }
 
 	ZVariant m_value; // 0x0
@@ -7938,14 +7917,14 @@ static_assert(alignof(ZDynamicObject) == 0x8, "Wrong alignment for ZDynamicObjec
 class alignas(8) ZGuid
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const ZGuid& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const ZGuid& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZGuid& p_Other) const { return !(*this == p_Other); }
 
 	uint32 _a; // 0x0
@@ -8007,14 +7986,12 @@ public:
 
 
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SCounterData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SCounterData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SCounterData& p_Other) const { return !(*this == p_Other); }
 
 		ZString m_sHeader; // 0x0
@@ -8636,14 +8613,14 @@ enum class ReverbFidelity : int32_t
 class alignas(4) S25DProjectionSettings
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const S25DProjectionSettings& p_Other) const;
+	bool operator==(const S25DProjectionSettings& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const S25DProjectionSettings& p_Other) const { return !(*this == p_Other); }
 
 	float32 fNearDistance; // 0x0
@@ -8682,14 +8659,14 @@ static_assert(alignof(S25DProjectionSettings) == 0x4, "Wrong alignment for S25DP
 class alignas(4) S3rdPersonCameraSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const S3rdPersonCameraSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const S3rdPersonCameraSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const S3rdPersonCameraSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fAngleYaw; // 0x0
@@ -8704,14 +8681,14 @@ static_assert(alignof(S3rdPersonCameraSaveData) == 0x4, "Wrong alignment for S3r
 class alignas(8) ZGameTime
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZGameTime& p_Other) const;
+	bool operator==(const ZGameTime& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZGameTime& p_Other) const { return !(*this == p_Other); }
 
 	int64 m_nTicks; // 0x0
@@ -8724,14 +8701,14 @@ static_assert(alignof(ZGameTime) == 0x8, "Wrong alignment for ZGameTime");
 class alignas(8) SAIEventSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAIEventSaveData& p_Other) const;
+	bool operator==(const SAIEventSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAIEventSaveData& p_Other) const { return !(*this == p_Other); }
 
 	EAIEventType m_eType; // 0x0
@@ -8750,14 +8727,14 @@ static_assert(alignof(SAIEventSaveData) == 0x8, "Wrong alignment for SAIEventSav
 class alignas(4) SAIModifierServiceActorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SAIModifierServiceActorSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SAIModifierServiceActorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAIModifierServiceActorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActorRef; // 0x0
@@ -8790,14 +8767,12 @@ static_assert(alignof(SAIModifierServiceActorSaveData) == 0x4, "Wrong alignment
 class alignas(8) SAIModifierServiceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAIModifierServiceSaveData& p_Other) const;
+	bool operator==(const SAIModifierServiceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAIModifierServiceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bFullVolumeUpdate; // 0x0
@@ -8812,14 +8787,14 @@ static_assert(alignof(SAIModifierServiceSaveData) == 0x8, "Wrong alignment for S
 class alignas(1) SAIPerceptibleEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAIPerceptibleEntitySaveData& p_Other) const;
+	bool operator==(const SAIPerceptibleEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAIPerceptibleEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bPerceptibleEnabled; // 0x0
@@ -8832,14 +8807,14 @@ static_assert(alignof(SAIPerceptibleEntitySaveData) == 0x1, "Wrong alignment for
 class alignas(1) SAIVisionBlockerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SAIVisionBlockerSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SAIVisionBlockerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAIVisionBlockerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -8852,14 +8827,14 @@ static_assert(alignof(SAIVisionBlockerSaveData) == 0x1, "Wrong alignment for SAI
 class alignas(4) SAccessoryItemSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAccessoryItemSaveData& p_Other) const;
+	bool operator==(const SAccessoryItemSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAccessoryItemSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -8878,14 +8853,12 @@ static_assert(alignof(SAccessoryItemSaveData) == 0x4, "Wrong alignment for SAcce
 class alignas(8) SAccidentObserversGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAccidentObserversGroupSaveData& p_Other) const;
+	bool operator==(const SAccidentObserversGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAccidentObserversGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_target; // 0x0
@@ -8914,14 +8887,14 @@ public:
 class alignas(4) SColorRGB
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SColorRGB& p_Other) const;
+	bool operator==(const SColorRGB& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SColorRGB& p_Other) const { return !(*this == p_Other); }
 
 	float32 r; // 0x0
@@ -8980,14 +8953,14 @@ public:
 class alignas(8) SActBehaviorEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActBehaviorEntitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActBehaviorEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActBehaviorEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bStartedSignalSent; // 0x0
@@ -9008,14 +8981,14 @@ static_assert(alignof(SActBehaviorEntitySaveData) == 0x8, "Wrong alignment for S
 class alignas(16) float4
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const float4& p_Other) const;
+	bool operator==(const float4& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const float4& p_Other) const { return !(*this == p_Other); }
 
 	float32 x; // 0x0
@@ -9034,14 +9007,12 @@ static_assert(alignof(float4) == 0x10, "Wrong alignment for float4");
 class alignas(16) SActOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActOrderSaveData& p_Other) const;
+	bool operator==(const SActOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sAct; // 0x0
@@ -9066,14 +9037,12 @@ static_assert(alignof(SActOrderSaveData) == 0x10, "Wrong alignment for SActOrder
 class alignas(8) SActionRadialArcDisplayInfo
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActionRadialArcDisplayInfo& p_Other) const;
+	bool operator==(const SActionRadialArcDisplayInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActionRadialArcDisplayInfo& p_Other) const { return !(*this == p_Other); }
 
 	bool hidden; // 0x0
@@ -9096,14 +9065,12 @@ static_assert(alignof(SActionRadialArcDisplayInfo) == 0x8, "Wrong alignment for
 class alignas(8) SActionRadialArcDisplayInfoArray_dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActionRadialArcDisplayInfoArray_dummy& p_Other) const;
+	bool operator==(const SActionRadialArcDisplayInfoArray_dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActionRadialArcDisplayInfoArray_dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SActionRadialArcDisplayInfo> dummy; // 0x0
@@ -9116,14 +9083,14 @@ static_assert(alignof(SActionRadialArcDisplayInfoArray_dummy) == 0x8, "Wrong ali
 class alignas(4) SActorAccessoryItemActionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActorAccessoryItemActionSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActorAccessoryItemActionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorAccessoryItemActionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -9136,14 +9103,14 @@ static_assert(alignof(SActorAccessoryItemActionSaveData) == 0x4, "Wrong alignmen
 class alignas(4) SActorAliveConditionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorAliveConditionSaveData& p_Other) const;
+	bool operator==(const SActorAliveConditionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorAliveConditionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -9156,14 +9123,14 @@ static_assert(alignof(SActorAliveConditionSaveData) == 0x4, "Wrong alignment for
 class alignas(4) SActorAnimSetVariationIndexSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorAnimSetVariationIndexSaveData& p_Other) const;
+	bool operator==(const SActorAnimSetVariationIndexSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorAnimSetVariationIndexSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rAnimationSetDefinition; // 0x0
@@ -9178,14 +9145,12 @@ static_assert(alignof(SActorAnimSetVariationIndexSaveData) == 0x4, "Wrong alignm
 class alignas(8) SActorAnimSetSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorAnimSetSaveData& p_Other) const;
+	bool operator==(const SActorAnimSetSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorAnimSetSaveData& p_Other) const { return !(*this == p_Other); }
 
 	EAnimSetType m_eAnimSet; // 0x0
@@ -9212,14 +9177,14 @@ static_assert(alignof(SActorAnimSetSaveData) == 0x8, "Wrong alignment for SActor
 class alignas(4) SActorBoneAttachSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActorBoneAttachSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActorBoneAttachSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorBoneAttachSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rAttachmentTarget; // 0x0
@@ -9234,14 +9199,12 @@ static_assert(alignof(SActorBoneAttachSaveData) == 0x4, "Wrong alignment for SAc
 class alignas(8) SActorBoneAttachmentsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorBoneAttachmentsSaveData& p_Other) const;
+	bool operator==(const SActorBoneAttachmentsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorBoneAttachmentsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -9256,14 +9219,14 @@ static_assert(alignof(SActorBoneAttachmentsSaveData) == 0x8, "Wrong alignment fo
 class alignas(4) SVector4
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVector4& p_Other) const;
+	bool operator==(const SVector4& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVector4& p_Other) const { return !(*this == p_Other); }
 
 	float32 x; // 0x0
@@ -9282,14 +9245,14 @@ static_assert(alignof(SVector4) == 0x4, "Wrong alignment for SVector4");
 class alignas(4) SActorBoneSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActorBoneSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActorBoneSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorBoneSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 mQuaterion; // 0x0
@@ -9304,14 +9267,14 @@ static_assert(alignof(SActorBoneSaveData) == 0x4, "Wrong alignment for SActorBon
 class alignas(4) SActorDynamicTemplateHandlerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorDynamicTemplateHandlerSaveData& p_Other) const;
+	bool operator==(const SActorDynamicTemplateHandlerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorDynamicTemplateHandlerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -9328,14 +9291,14 @@ static_assert(alignof(SActorDynamicTemplateHandlerSaveData) == 0x4, "Wrong align
 class alignas(4) SActorDynamicTemplateManipulatorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorDynamicTemplateManipulatorSaveData& p_Other) const;
+	bool operator==(const SActorDynamicTemplateManipulatorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorDynamicTemplateManipulatorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -9348,14 +9311,12 @@ static_assert(alignof(SActorDynamicTemplateManipulatorSaveData) == 0x4, "Wrong a
 class alignas(8) SActorDynamicTemplateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorDynamicTemplateSaveData& p_Other) const;
+	bool operator==(const SActorDynamicTemplateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorDynamicTemplateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sName; // 0x0
@@ -9384,14 +9345,12 @@ static_assert(alignof(SActorDynamicTemplateSaveData) == 0x8, "Wrong alignment fo
 class alignas(8) SActorGoalSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorGoalSaveData& p_Other) const;
+	bool operator==(const SActorGoalSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorGoalSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<int32> m_aEntities; // 0x0
@@ -9410,14 +9369,14 @@ static_assert(alignof(SActorGoalSaveData) == 0x8, "Wrong alignment for SActorGoa
 class alignas(4) SActorIKControllerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActorIKControllerSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActorIKControllerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorIKControllerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fRightHandWeight; // 0x0
@@ -9436,14 +9395,14 @@ static_assert(alignof(SActorIKControllerSaveData) == 0x4, "Wrong alignment for S
 class alignas(4) SActorInventoryItemSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorInventoryItemSaveData& p_Other) const;
+	bool operator==(const SActorInventoryItemSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorInventoryItemSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rItem; // 0x0
@@ -9466,14 +9425,12 @@ static_assert(alignof(SActorInventoryItemSaveData) == 0x4, "Wrong alignment for
 class alignas(8) SActorInventorySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorInventorySaveData& p_Other) const;
+	bool operator==(const SActorInventorySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorInventorySaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SActorInventoryItemSaveData> m_aItems; // 0x0
@@ -9486,14 +9443,14 @@ static_assert(alignof(SActorInventorySaveData) == 0x8, "Wrong alignment for SAct
 class alignas(4) SActorItemActionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorItemActionSaveData& p_Other) const;
+	bool operator==(const SActorItemActionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorItemActionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -9508,14 +9465,14 @@ static_assert(alignof(SActorItemActionSaveData) == 0x4, "Wrong alignment for SAc
 class alignas(4) SActorKeywordProxySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActorKeywordProxySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActorKeywordProxySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorKeywordProxySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -9528,14 +9485,12 @@ static_assert(alignof(SActorKeywordProxySaveData) == 0x4, "Wrong alignment for S
 class alignas(8) SActorKeywordProxiesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorKeywordProxiesSaveData& p_Other) const;
+	bool operator==(const SActorKeywordProxiesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorKeywordProxiesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -9550,14 +9505,12 @@ static_assert(alignof(SActorKeywordProxiesSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SActorManagerReferencableData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorManagerReferencableData& p_Other) const;
+	bool operator==(const SActorManagerReferencableData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorManagerReferencableData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<ESituationType> m_aSituationTypes; // 0x0
@@ -9570,14 +9523,14 @@ static_assert(alignof(SActorManagerReferencableData) == 0x8, "Wrong alignment fo
 class alignas(16) SMatrix
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMatrix& p_Other) const;
+	bool operator==(const SMatrix& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMatrix& p_Other) const { return !(*this == p_Other); }
 
 	float4 XAxis; // 0x0
@@ -9596,14 +9549,14 @@ static_assert(alignof(SMatrix) == 0x10, "Wrong alignment for SMatrix");
 class alignas(8) SEventSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEventSaveData& p_Other) const;
+	bool operator==(const SEventSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEventSaveData& p_Other) const { return !(*this == p_Other); }
 
 	EAISharedEventType m_nType; // 0x0
@@ -9620,14 +9573,12 @@ static_assert(alignof(SEventSaveData) == 0x8, "Wrong alignment for SEventSaveDat
 class alignas(8) SSituationGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSituationGroupSaveData& p_Other) const;
+	bool operator==(const SSituationGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSituationGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sClassTypeName; // 0x0
@@ -9648,14 +9599,12 @@ static_assert(alignof(SSituationGroupSaveData) == 0x8, "Wrong alignment for SSit
 class alignas(8) SSituationMemberSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSituationMemberSaveData& p_Other) const;
+	bool operator==(const SSituationMemberSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSituationMemberSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -9680,14 +9629,12 @@ static_assert(alignof(SSituationMemberSaveData) == 0x8, "Wrong alignment for SSi
 class alignas(8) SSituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSituationSaveData& p_Other) const;
+	bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rSituation; // 0x0
@@ -9716,14 +9663,12 @@ static_assert(alignof(SSituationSaveData) == 0x8, "Wrong alignment for SSituatio
 class alignas(8) SActorProviderDirectSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorProviderDirectSaveData& p_Other) const;
+	bool operator==(const SActorProviderDirectSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorProviderDirectSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aActors; // 0x0
@@ -9738,14 +9683,14 @@ static_assert(alignof(SActorProviderDirectSaveData) == 0x8, "Wrong alignment for
 class alignas(16) SActorThrowSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActorThrowSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActorThrowSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorThrowSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rItem; // 0x0
@@ -9766,14 +9711,12 @@ static_assert(alignof(SActorThrowSaveData) == 0x10, "Wrong alignment for SActorT
 class alignas(16) SKnownEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SKnownEntitySaveData& p_Other) const;
+	bool operator==(const SKnownEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SKnownEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nSharedIndex; // 0x0
@@ -9798,14 +9741,12 @@ static_assert(alignof(SKnownEntitySaveData) == 0x10, "Wrong alignment for SKnown
 class alignas(8) SKnowledgeSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SKnowledgeSaveData& p_Other) const;
+	bool operator==(const SKnowledgeSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SKnowledgeSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SKnownEntitySaveData> m_aKnownEntities; // 0x0
@@ -9848,14 +9789,12 @@ static_assert(alignof(SKnowledgeSaveData) == 0x8, "Wrong alignment for SKnowledg
 class alignas(8) SEventHistorySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEventHistorySaveData& p_Other) const;
+	bool operator==(const SEventHistorySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEventHistorySaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<ZGameTime> m_aOccurences; // 0x0
@@ -9868,14 +9807,12 @@ static_assert(alignof(SEventHistorySaveData) == 0x8, "Wrong alignment for SEvent
 class alignas(8) SActorRagdollPoseSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorRagdollPoseSaveData& p_Other) const;
+	bool operator==(const SActorRagdollPoseSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorRagdollPoseSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_vBodyVelocity; // 0x0
@@ -9892,14 +9829,12 @@ static_assert(alignof(SActorRagdollPoseSaveData) == 0x8, "Wrong alignment for SA
 class alignas(8) SCombatMetricsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCombatMetricsSaveData& p_Other) const;
+	bool operator==(const SCombatMetricsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCombatMetricsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_CombatProgress; // 0x0
@@ -9916,14 +9851,14 @@ static_assert(alignof(SCombatMetricsSaveData) == 0x8, "Wrong alignment for SComb
 class alignas(4) SActorProviderApproachSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorProviderApproachSaveData& p_Other) const;
+	bool operator==(const SActorProviderApproachSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorProviderApproachSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rCastActor; // 0x0
@@ -9936,14 +9871,14 @@ static_assert(alignof(SActorProviderApproachSaveData) == 0x4, "Wrong alignment f
 class alignas(4) SActorProxySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActorProxySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActorProxySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorProxySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -9956,14 +9891,12 @@ static_assert(alignof(SActorProxySaveData) == 0x4, "Wrong alignment for SActorPr
 class alignas(8) SActorProxiesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorProxiesSaveData& p_Other) const;
+	bool operator==(const SActorProxiesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorProxiesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -9989,14 +9922,14 @@ public:
 class alignas(8) SActorSpreadControllerCandidateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorSpreadControllerCandidateSaveData& p_Other) const;
+	bool operator==(const SActorSpreadControllerCandidateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorSpreadControllerCandidateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_CandidateActor; // 0x0
@@ -10013,14 +9946,12 @@ static_assert(alignof(SActorSpreadControllerCandidateSaveData) == 0x8, "Wrong al
 class alignas(8) SActorSpreadControllerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorSpreadControllerSaveData& p_Other) const;
+	bool operator==(const SActorSpreadControllerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorSpreadControllerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aSpreadingActors; // 0x0
@@ -10055,14 +9986,14 @@ static_assert(alignof(SActorSpreadControllerSaveData) == 0x8, "Wrong alignment f
 class alignas(4) SActorSpreadTransitionOperatorMaterialActorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorSpreadTransitionOperatorMaterialActorSaveData& p_Other) const;
+	bool operator==(const SActorSpreadTransitionOperatorMaterialActorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorSpreadTransitionOperatorMaterialActorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_Actor; // 0x0
@@ -10077,14 +10008,12 @@ static_assert(alignof(SActorSpreadTransitionOperatorMaterialActorSaveData) == 0x
 class alignas(8) SActorSpreadTransitionOperatorMaterialSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorSpreadTransitionOperatorMaterialSaveData& p_Other) const;
+	bool operator==(const SActorSpreadTransitionOperatorMaterialSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorSpreadTransitionOperatorMaterialSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SActorSpreadTransitionOperatorMaterialActorSaveData> m_aActorMaterialOverrides; // 0x0
@@ -10097,14 +10026,14 @@ static_assert(alignof(SActorSpreadTransitionOperatorMaterialSaveData) == 0x8, "W
 class alignas(4) SActorStandInSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActorStandInSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActorStandInSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorStandInSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -10117,14 +10046,12 @@ static_assert(alignof(SActorStandInSaveData) == 0x4, "Wrong alignment for SActor
 class alignas(8) SActorStandInEntitiesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorStandInEntitiesSaveData& p_Other) const;
+	bool operator==(const SActorStandInEntitiesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorStandInEntitiesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -10139,14 +10066,14 @@ static_assert(alignof(SActorStandInEntitiesSaveData) == 0x8, "Wrong alignment fo
 class alignas(4) SActorTagSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorTagSaveData& p_Other) const;
+	bool operator==(const SActorTagSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorTagSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bSeen; // 0x0
@@ -10163,14 +10090,12 @@ static_assert(alignof(SActorTagSaveData) == 0x4, "Wrong alignment for SActorTagS
 class alignas(8) SActorTagManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorTagManagerSaveData& p_Other) const;
+	bool operator==(const SActorTagManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorTagManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bContractsCreationMode; // 0x0
@@ -10191,14 +10116,14 @@ static_assert(alignof(SActorTagManagerSaveData) == 0x8, "Wrong alignment for SAc
 class alignas(4) SActorVisibilityConditionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActorVisibilityConditionSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActorVisibilityConditionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorVisibilityConditionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_pActor; // 0x0
@@ -10211,14 +10136,14 @@ static_assert(alignof(SActorVisibilityConditionSaveData) == 0x4, "Wrong alignmen
 class alignas(16) SAgitatedBystanderOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAgitatedBystanderOrderSaveData& p_Other) const;
+	bool operator==(const SAgitatedBystanderOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAgitatedBystanderOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rBystanderPoint; // 0x0
@@ -10235,14 +10160,14 @@ static_assert(alignof(SAgitatedBystanderOrderSaveData) == 0x10, "Wrong alignment
 class alignas(1) SAimAssistObjectSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAimAssistObjectSaveData& p_Other) const;
+	bool operator==(const SAimAssistObjectSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAimAssistObjectSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bHasBeenStarted; // 0x0
@@ -10257,14 +10182,14 @@ static_assert(alignof(SAimAssistObjectSaveData) == 0x1, "Wrong alignment for SAi
 class alignas(4) SBoneTransformSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SBoneTransformSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SBoneTransformSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBoneTransformSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 mQuaterion; // 0x0
@@ -10279,14 +10204,12 @@ static_assert(alignof(SBoneTransformSaveData) == 0x4, "Wrong alignment for SBone
 class alignas(8) SAnimPlayerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAnimPlayerSaveData& p_Other) const;
+	bool operator==(const SAnimPlayerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAnimPlayerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 mTrajectoryQuaterion; // 0x0
@@ -10303,14 +10226,14 @@ static_assert(alignof(SAnimPlayerSaveData) == 0x8, "Wrong alignment for SAnimPla
 class alignas(4) SAnimatedActorActOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAnimatedActorActOrderSaveData& p_Other) const;
+	bool operator==(const SAnimatedActorActOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAnimatedActorActOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bOverrideExistingAct; // 0x0
@@ -10333,14 +10256,14 @@ static_assert(alignof(SAnimatedActorActOrderSaveData) == 0x4, "Wrong alignment f
 class alignas(4) SAnimatedActorMoveOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SAnimatedActorMoveOrderSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SAnimatedActorMoveOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAnimatedActorMoveOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bPrecisePositioning; // 0x0
@@ -10367,14 +10290,12 @@ static_assert(alignof(SAnimatedActorMoveOrderSaveData) == 0x4, "Wrong alignment
 class alignas(8) SAnimatedActorOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAnimatedActorOrderSaveData& p_Other) const;
+	bool operator==(const SAnimatedActorOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAnimatedActorOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	EActorAnimationOrder m_eOrderType; // 0x0
@@ -10389,14 +10310,12 @@ static_assert(alignof(SAnimatedActorOrderSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SAnimatedActorReactOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAnimatedActorReactOrderSaveData& p_Other) const;
+	bool operator==(const SAnimatedActorReactOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAnimatedActorReactOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_vFaceTarget; // 0x0
@@ -10429,14 +10348,14 @@ static_assert(alignof(SAnimatedActorReactOrderSaveData) == 0x8, "Wrong alignment
 class alignas(4) SAnimatedActorStandOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAnimatedActorStandOrderSaveData& p_Other) const;
+	bool operator==(const SAnimatedActorStandOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAnimatedActorStandOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_vFacingDirection; // 0x0
@@ -10449,14 +10368,14 @@ static_assert(alignof(SAnimatedActorStandOrderSaveData) == 0x4, "Wrong alignment
 class alignas(4) SAttentionHUDUIElement
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAttentionHUDUIElement& p_Other) const;
+	bool operator==(const SAttentionHUDUIElement& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAttentionHUDUIElement& p_Other) const { return !(*this == p_Other); }
 
 	float32 fAngle; // 0x0
@@ -10477,14 +10396,12 @@ static_assert(alignof(SAttentionHUDUIElement) == 0x4, "Wrong alignment for SAtte
 class alignas(8) SAttentionHUDUIElementArray_Dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAttentionHUDUIElementArray_Dummy& p_Other) const;
+	bool operator==(const SAttentionHUDUIElementArray_Dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAttentionHUDUIElementArray_Dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SAttentionHUDUIElement> dummy; // 0x0
@@ -10497,14 +10414,14 @@ static_assert(alignof(SAttentionHUDUIElementArray_Dummy) == 0x8, "Wrong alignmen
 class alignas(4) SAudioEmitterEventSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SAudioEmitterEventSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SAudioEmitterEventSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAudioEmitterEventSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nEventId; // 0x0
@@ -10527,14 +10444,14 @@ static_assert(alignof(SAudioEmitterEventSaveData) == 0x4, "Wrong alignment for S
 class alignas(4) SAudioEmitterRTPCSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAudioEmitterRTPCSaveData& p_Other) const;
+	bool operator==(const SAudioEmitterRTPCSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAudioEmitterRTPCSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nParamId; // 0x0
@@ -10549,14 +10466,14 @@ static_assert(alignof(SAudioEmitterRTPCSaveData) == 0x4, "Wrong alignment for SA
 class alignas(4) SAudioEmitterSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAudioEmitterSaveData& p_Other) const;
+	bool operator==(const SAudioEmitterSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAudioEmitterSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEmitter; // 0x0
@@ -10575,14 +10492,14 @@ static_assert(alignof(SAudioEmitterSaveData) == 0x4, "Wrong alignment for SAudio
 class alignas(4) SAudioEmitterStateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SAudioEmitterStateSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SAudioEmitterStateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAudioEmitterStateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nGroupId; // 0x0
@@ -10597,14 +10514,14 @@ static_assert(alignof(SAudioEmitterStateSaveData) == 0x4, "Wrong alignment for S
 class alignas(4) SAudioEmitterSwitchSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAudioEmitterSwitchSaveData& p_Other) const;
+	bool operator==(const SAudioEmitterSwitchSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAudioEmitterSwitchSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nGroupId; // 0x0
@@ -10619,14 +10536,12 @@ static_assert(alignof(SAudioEmitterSwitchSaveData) == 0x4, "Wrong alignment for
 class alignas(8) ZResourceID
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZResourceID& p_Other) const;
+	bool operator==(const ZResourceID& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZResourceID& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_uri; // 0x0
@@ -10639,14 +10554,12 @@ static_assert(alignof(ZResourceID) == 0x8, "Wrong alignment for ZResourceID");
 class alignas(8) SAudioMemoryMonitorEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAudioMemoryMonitorEntry& p_Other) const;
+	bool operator==(const SAudioMemoryMonitorEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAudioMemoryMonitorEntry& p_Other) const { return !(*this == p_Other); }
 
 	uint32 shortId; // 0x0
@@ -10663,14 +10576,12 @@ static_assert(alignof(SAudioMemoryMonitorEntry) == 0x8, "Wrong alignment for SAu
 class alignas(8) SAudioSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAudioSaveData& p_Other) const;
+	bool operator==(const SAudioSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAudioSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SAudioEmitterSaveData> m_aEmitters; // 0x0
@@ -10695,14 +10606,14 @@ static_assert(alignof(SAudioSaveData) == 0x8, "Wrong alignment for SAudioSaveDat
 class alignas(8) SFSMSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SFSMSaveData& p_Other) const;
+	bool operator==(const SFSMSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFSMSaveData& p_Other) const { return !(*this == p_Other); }
 
 	EFSMStateStatus m_eStateStatus; // 0x0
@@ -10721,14 +10632,14 @@ static_assert(alignof(SFSMSaveData) == 0x8, "Wrong alignment for SFSMSaveData");
 class alignas(16) SAvoidDangerousAreaGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SAvoidDangerousAreaGroupSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SAvoidDangerousAreaGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAvoidDangerousAreaGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -10749,14 +10660,12 @@ static_assert(alignof(SAvoidDangerousAreaGroupSaveData) == 0x10, "Wrong alignmen
 class alignas(8) SBehaviorTreeEntityReference
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBehaviorTreeEntityReference& p_Other) const;
+	bool operator==(const SBehaviorTreeEntityReference& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBehaviorTreeEntityReference& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bList; // 0x0
@@ -10771,14 +10680,14 @@ static_assert(alignof(SBehaviorTreeEntityReference) == 0x8, "Wrong alignment for
 class alignas(8) SBehaviorTreeEvaluationLogEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBehaviorTreeEvaluationLogEntry& p_Other) const;
+	bool operator==(const SBehaviorTreeEvaluationLogEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBehaviorTreeEvaluationLogEntry& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nBehaviorTreeIndex; // 0x0
@@ -10795,14 +10704,12 @@ static_assert(alignof(SBehaviorTreeEvaluationLogEntry) == 0x8, "Wrong alignment
 class alignas(8) SBehaviorTreeEvaluationLog
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBehaviorTreeEvaluationLog& p_Other) const;
+	bool operator==(const SBehaviorTreeEvaluationLog& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBehaviorTreeEvaluationLog& p_Other) const { return !(*this == p_Other); }
 
 	TArray<ZResourceID> m_BehaviorTrees; // 0x0
@@ -10817,14 +10724,12 @@ static_assert(alignof(SBehaviorTreeEvaluationLog) == 0x8, "Wrong alignment for S
 class alignas(8) SBehaviorTreeInputPinCondition
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBehaviorTreeInputPinCondition& p_Other) const;
+	bool operator==(const SBehaviorTreeInputPinCondition& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBehaviorTreeInputPinCondition& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sName; // 0x0
@@ -10837,14 +10742,12 @@ static_assert(alignof(SBehaviorTreeInputPinCondition) == 0x8, "Wrong alignment f
 class alignas(8) SBehaviorTreeInfo
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBehaviorTreeInfo& p_Other) const;
+	bool operator==(const SBehaviorTreeInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBehaviorTreeInfo& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SBehaviorTreeEntityReference> m_references; // 0x0
@@ -10943,14 +10846,12 @@ public:
 class alignas(8) SBlobsConfigResourceEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBlobsConfigResourceEntry& p_Other) const;
+	bool operator==(const SBlobsConfigResourceEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBlobsConfigResourceEntry& p_Other) const { return !(*this == p_Other); }
 
 	ZString Id; // 0x0
@@ -11040,14 +10941,14 @@ public:
 class alignas(4) SBodyContainerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SBodyContainerSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SBodyContainerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBodyContainerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZHM5BodyContainer::EBCState m_eBCState; // 0x0
@@ -11066,14 +10967,12 @@ static_assert(alignof(SBodyContainerSaveData) == 0x4, "Wrong alignment for SBody
 class alignas(8) SBodyContainersSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBodyContainersSaveData& p_Other) const;
+	bool operator==(const SBodyContainersSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBodyContainersSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -11088,14 +10987,14 @@ static_assert(alignof(SBodyContainersSaveData) == 0x8, "Wrong alignment for SBod
 class alignas(4) SBodyPartDamageMultipliers
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBodyPartDamageMultipliers& p_Other) const;
+	bool operator==(const SBodyPartDamageMultipliers& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBodyPartDamageMultipliers& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fHeadDamageMultiplier; // 0x0
@@ -11132,14 +11031,14 @@ static_assert(alignof(SBodyPartDamageMultipliers) == 0x4, "Wrong alignment for S
 class alignas(4) SBodybagBoneSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBodybagBoneSaveData& p_Other) const;
+	bool operator==(const SBodybagBoneSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBodybagBoneSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 mQuaterion; // 0x0
@@ -11154,14 +11053,12 @@ static_assert(alignof(SBodybagBoneSaveData) == 0x4, "Wrong alignment for SBodyba
 class alignas(8) SBodybagSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBodybagSaveData& p_Other) const;
+	bool operator==(const SBodybagSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBodybagSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_vLinkedPosition; // 0x0
@@ -11184,14 +11081,14 @@ static_assert(alignof(SBodybagSaveData) == 0x8, "Wrong alignment for SBodybagSav
 class alignas(4) SBoneAttachSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SBoneAttachSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SBoneAttachSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBoneAttachSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -11206,14 +11103,12 @@ static_assert(alignof(SBoneAttachSaveData) == 0x4, "Wrong alignment for SBoneAtt
 class alignas(8) SBoneScalesList
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBoneScalesList& p_Other) const;
+	bool operator==(const SBoneScalesList& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBoneScalesList& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SVector3> m_aBoneScales; // 0x0
@@ -11226,14 +11121,14 @@ static_assert(alignof(SBoneScalesList) == 0x8, "Wrong alignment for SBoneScalesL
 class alignas(4) SCamBone
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCamBone& p_Other) const;
+	bool operator==(const SCamBone& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCamBone& p_Other) const { return !(*this == p_Other); }
 
 	BoneId::Enum m_eBoneId; // 0x0
@@ -11262,14 +11157,12 @@ public:
 class alignas(8) SCautiousBackupGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCautiousBackupGroupSaveData& p_Other) const;
+	bool operator==(const SCautiousBackupGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCautiousBackupGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZCautiousBackupGroup::EGroupState m_eGroupState; // 0x0
@@ -11294,14 +11187,14 @@ static_assert(alignof(SCautiousBackupGroupSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SCautiousHuntSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCautiousHuntSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCautiousHuntSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCautiousHuntSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -11375,14 +11268,12 @@ public:
 class alignas(8) SExactCompressedGridFloatField
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SExactCompressedGridFloatField& p_Other) const;
+	bool operator==(const SExactCompressedGridFloatField& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SExactCompressedGridFloatField& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fInitialValue; // 0x0
@@ -11403,14 +11294,12 @@ static_assert(alignof(SExactCompressedGridFloatField) == 0x8, "Wrong alignment f
 class alignas(16) SCautiousInvestigateGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCautiousInvestigateGroupSaveData& p_Other) const;
+	bool operator==(const SCautiousInvestigateGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCautiousInvestigateGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_tGroupStarted; // 0x0
@@ -11495,14 +11384,14 @@ public:
 class alignas(4) SCautiousSearchGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCautiousSearchGroupSaveData& p_Other) const;
+	bool operator==(const SCautiousSearchGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCautiousSearchGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint16 m_searchNode; // 0x0
@@ -11525,14 +11414,14 @@ static_assert(alignof(SCautiousSearchGroupSaveData) == 0x4, "Wrong alignment for
 class alignas(8) SCautiousSituationMemberSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCautiousSituationMemberSaveData& p_Other) const;
+	bool operator==(const SCautiousSituationMemberSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCautiousSituationMemberSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_tLastDisturbance; // 0x0
@@ -11571,14 +11460,14 @@ static_assert(alignof(SCautiousSituationMemberSaveData) == 0x8, "Wrong alignment
 class alignas(8) SCautiousVIPGroupState
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCautiousVIPGroupState& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCautiousVIPGroupState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCautiousVIPGroupState& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_tMove; // 0x0
@@ -11591,14 +11480,14 @@ static_assert(alignof(SCautiousVIPGroupState) == 0x8, "Wrong alignment for SCaut
 class alignas(8) SCautiousVIPGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCautiousVIPGroupSaveData& p_Other) const;
+	bool operator==(const SCautiousVIPGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCautiousVIPGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_vip; // 0x0
@@ -11619,14 +11508,14 @@ static_assert(alignof(SCautiousVIPGroupSaveData) == 0x8, "Wrong alignment for SC
 class alignas(4) SChairSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SChairSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SChairSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SChairSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -11641,14 +11530,12 @@ static_assert(alignof(SChairSaveData) == 0x4, "Wrong alignment for SChairSaveDat
 class alignas(8) SChallengeSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SChallengeSaveData& p_Other) const;
+	bool operator==(const SChallengeSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SChallengeSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sId; // 0x0
@@ -11663,14 +11550,12 @@ static_assert(alignof(SChallengeSaveData) == 0x8, "Wrong alignment for SChalleng
 class alignas(8) SChallengesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SChallengesSaveData& p_Other) const;
+	bool operator==(const SChallengesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SChallengesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SChallengeSaveData> m_mChallengeStates; // 0x0
@@ -11683,14 +11568,14 @@ static_assert(alignof(SChallengesSaveData) == 0x8, "Wrong alignment for SChallen
 class alignas(4) SCharacterSpeakEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCharacterSpeakEntitySaveData& p_Other) const;
+	bool operator==(const SCharacterSpeakEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCharacterSpeakEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fSeekPosition; // 0x0
@@ -11707,14 +11592,14 @@ static_assert(alignof(SCharacterSpeakEntitySaveData) == 0x4, "Wrong alignment fo
 class alignas(4) SCheckLastPositionGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCheckLastPositionGroupSaveData& p_Other) const;
+	bool operator==(const SCheckLastPositionGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCheckLastPositionGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_pLeader; // 0x0
@@ -11737,14 +11622,14 @@ static_assert(alignof(SCheckLastPositionGroupSaveData) == 0x4, "Wrong alignment
 class alignas(4) SClothBundleSpawnSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SClothBundleSpawnSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SClothBundleSpawnSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SClothBundleSpawnSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rClothbundle; // 0x0
@@ -11757,14 +11642,14 @@ static_assert(alignof(SClothBundleSpawnSaveData) == 0x4, "Wrong alignment for SC
 class alignas(2) SClothVertex
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SClothVertex& p_Other) const;
+	bool operator==(const SClothVertex& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SClothVertex& p_Other) const { return !(*this == p_Other); }
 
 	uint16 m_nColumn; // 0x0
@@ -11779,14 +11664,14 @@ static_assert(alignof(SClothVertex) == 0x2, "Wrong alignment for SClothVertex");
 class alignas(4) SClothWireEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SClothWireEntitySaveData& p_Other) const;
+	bool operator==(const SClothWireEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SClothWireEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fWireLength; // 0x0
@@ -11805,14 +11690,14 @@ static_assert(alignof(SClothWireEntitySaveData) == 0x4, "Wrong alignment for SCl
 class alignas(16) SCollidingParticle
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCollidingParticle& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCollidingParticle& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCollidingParticle& p_Other) const { return !(*this == p_Other); }
 
 	float4 m_vPosition; // 0x0
@@ -11833,14 +11718,14 @@ static_assert(alignof(SCollidingParticle) == 0x10, "Wrong alignment for SCollidi
 class alignas(1) SCollisionControllerAspectSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCollisionControllerAspectSaveData& p_Other) const;
+	bool operator==(const SCollisionControllerAspectSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCollisionControllerAspectSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bCollideHitman; // 0x0
@@ -11855,14 +11740,12 @@ static_assert(alignof(SCollisionControllerAspectSaveData) == 0x1, "Wrong alignme
 class alignas(8) SCollisionControllerAspectsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCollisionControllerAspectsSaveData& p_Other) const;
+	bool operator==(const SCollisionControllerAspectsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCollisionControllerAspectsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -11877,14 +11760,14 @@ static_assert(alignof(SCollisionControllerAspectsSaveData) == 0x8, "Wrong alignm
 class alignas(4) SColorRGBA
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SColorRGBA& p_Other) const;
+	bool operator==(const SColorRGBA& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SColorRGBA& p_Other) const { return !(*this == p_Other); }
 
 	float32 r; // 0x0
@@ -11903,14 +11786,12 @@ static_assert(alignof(SColorRGBA) == 0x4, "Wrong alignment for SColorRGBA");
 class alignas(8) SColorRGBSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SColorRGBSaveData& p_Other) const;
+	bool operator==(const SColorRGBSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SColorRGBSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -11925,14 +11806,14 @@ static_assert(alignof(SColorRGBSaveData) == 0x8, "Wrong alignment for SColorRGBS
 class alignas(16) SCombatOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCombatOrderSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCombatOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCombatOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float4 m_vPos; // 0x0
@@ -11949,14 +11830,14 @@ static_assert(alignof(SCombatOrderSaveData) == 0x10, "Wrong alignment for SComba
 class alignas(4) SCombatSituationMemberSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCombatSituationMemberSaveData& p_Other) const;
+	bool operator==(const SCombatSituationMemberSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCombatSituationMemberSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fDistanceToTarget; // 0x0
@@ -11985,14 +11866,14 @@ static_assert(alignof(SCombatSituationMemberSaveData) == 0x4, "Wrong alignment f
 class alignas(8) SCombatZoneEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCombatZoneEntitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCombatZoneEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCombatZoneEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsInLockdown; // 0x0
@@ -12015,14 +11896,12 @@ static_assert(alignof(SCombatZoneEntitySaveData) == 0x8, "Wrong alignment for SC
 class alignas(8) SCompressedGridFloatField
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCompressedGridFloatField& p_Other) const;
+	bool operator==(const SCompressedGridFloatField& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCompressedGridFloatField& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsSparse; // 0x0
@@ -12045,14 +11924,14 @@ static_assert(alignof(SCompressedGridFloatField) == 0x8, "Wrong alignment for SC
 class alignas(4) SConditionalTimerEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SConditionalTimerEntitySaveData& p_Other) const;
+	bool operator==(const SConditionalTimerEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SConditionalTimerEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nInterval; // 0x0
@@ -12071,14 +11950,14 @@ static_assert(alignof(SConditionalTimerEntitySaveData) == 0x4, "Wrong alignment
 class alignas(1) SContextActionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SContextActionSaveData& p_Other) const;
+	bool operator==(const SContextActionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SContextActionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -12095,14 +11974,12 @@ static_assert(alignof(SContextActionSaveData) == 0x1, "Wrong alignment for SCont
 class alignas(8) SContractConfigResourceEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SContractConfigResourceEntry& p_Other) const;
+	bool operator==(const SContractConfigResourceEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SContractConfigResourceEntry& p_Other) const { return !(*this == p_Other); }
 
 	ZString Id; // 0x0
@@ -12117,14 +11994,14 @@ static_assert(alignof(SContractConfigResourceEntry) == 0x8, "Wrong alignment for
 class alignas(1) SContractObjectiveHudHintEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SContractObjectiveHudHintEntitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SContractObjectiveHudHintEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SContractObjectiveHudHintEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bVisible; // 0x0
@@ -12137,14 +12014,12 @@ static_assert(alignof(SContractObjectiveHudHintEntitySaveData) == 0x1, "Wrong al
 class alignas(8) SContractObjectiveSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SContractObjectiveSaveData& p_Other) const;
+	bool operator==(const SContractObjectiveSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SContractObjectiveSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZGuid m_Id; // 0x0
@@ -12221,14 +12096,14 @@ static_assert(alignof(SContractObjectiveSaveData) == 0x8, "Wrong alignment for S
 class alignas(4) SConversationEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SConversationEntry& p_Other) const;
+	bool operator==(const SConversationEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SConversationEntry& p_Other) const { return !(*this == p_Other); }
 
 	EConversationRole m_role; // 0x0
@@ -12243,14 +12118,12 @@ static_assert(alignof(SConversationEntry) == 0x4, "Wrong alignment for SConversa
 class alignas(8) SConversationPart
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SConversationPart& p_Other) const;
+	bool operator==(const SConversationPart& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SConversationPart& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_chance; // 0x0
@@ -12265,14 +12138,12 @@ static_assert(alignof(SConversationPart) == 0x8, "Wrong alignment for SConversat
 class alignas(8) SEntityTemplateProperty
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTemplateProperty& p_Other) const;
+	bool operator==(const SEntityTemplateProperty& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTemplateProperty& p_Other) const { return !(*this == p_Other); }
 
 	uint32 nPropertyID; // 0x0
@@ -12287,14 +12158,12 @@ static_assert(alignof(SEntityTemplateProperty) == 0x8, "Wrong alignment for SEnt
 class alignas(8) SCppEntity
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCppEntity& p_Other) const;
+	bool operator==(const SCppEntity& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCppEntity& p_Other) const { return !(*this == p_Other); }
 
 	int32 blueprintIndexInResourceHeader; // 0x0
@@ -12309,14 +12178,12 @@ static_assert(alignof(SCppEntity) == 0x8, "Wrong alignment for SCppEntity");
 class alignas(8) SCppEntitySubsetInfo
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCppEntitySubsetInfo& p_Other) const;
+	bool operator==(const SCppEntitySubsetInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCppEntitySubsetInfo& p_Other) const { return !(*this == p_Other); }
 
 	ZString name; // 0x0
@@ -12331,14 +12198,12 @@ static_assert(alignof(SCppEntitySubsetInfo) == 0x8, "Wrong alignment for SCppEnt
 class alignas(8) SCppEntityBlueprint
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCppEntityBlueprint& p_Other) const;
+	bool operator==(const SCppEntityBlueprint& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCppEntityBlueprint& p_Other) const { return !(*this == p_Other); }
 
 	TypeID typeName; // 0x0
@@ -12355,14 +12220,14 @@ static_assert(alignof(SCppEntityBlueprint) == 0x8, "Wrong alignment for SCppEnti
 class alignas(16) SRunningCrowdAIEventSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRunningCrowdAIEventSaveData& p_Other) const;
+	bool operator==(const SRunningCrowdAIEventSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRunningCrowdAIEventSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_ReactionEntity; // 0x0
@@ -12389,14 +12254,12 @@ static_assert(alignof(SRunningCrowdAIEventSaveData) == 0x10, "Wrong alignment fo
 class alignas(8) SCrowdAIEventSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdAIEventSaveData& p_Other) const;
+	bool operator==(const SCrowdAIEventSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdAIEventSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SRunningCrowdAIEventSaveData> m_RunningEvents; // 0x0
@@ -12409,14 +12272,14 @@ static_assert(alignof(SCrowdAIEventSaveData) == 0x8, "Wrong alignment for SCrowd
 class alignas(4) SCrowdActivitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCrowdActivitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCrowdActivitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdActivitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -12435,14 +12298,14 @@ static_assert(alignof(SCrowdActivitySaveData) == 0x4, "Wrong alignment for SCrow
 class alignas(16) SCrowdActorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdActorSaveData& p_Other) const;
+	bool operator==(const SCrowdActorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdActorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -12471,14 +12334,12 @@ static_assert(alignof(SCrowdActorSaveData) == 0x10, "Wrong alignment for SCrowdA
 class alignas(8) SCrowdBodySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdBodySaveData& p_Other) const;
+	bool operator==(const SCrowdBodySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdBodySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_pCorpseBodybagEntity; // 0x0
@@ -12505,14 +12366,14 @@ static_assert(alignof(SCrowdBodySaveData) == 0x8, "Wrong alignment for SCrowdBod
 class alignas(128) SCrowdCells
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdCells& p_Other) const;
+	bool operator==(const SCrowdCells& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdCells& p_Other) const { return !(*this == p_Other); }
 
 	TFixedArray<uint8, 128> m_cells; // 0x0
@@ -12525,14 +12386,14 @@ static_assert(alignof(SCrowdCells) == 0x80, "Wrong alignment for SCrowdCells");
 class alignas(4) SCrowdPoseBoneSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCrowdPoseBoneSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCrowdPoseBoneSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdPoseBoneSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 mQuaterion; // 0x0
@@ -12547,14 +12408,12 @@ static_assert(alignof(SCrowdPoseBoneSaveData) == 0x4, "Wrong alignment for SCrow
 class alignas(8) SCrowdPoseSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdPoseSaveData& p_Other) const;
+	bool operator==(const SCrowdPoseSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdPoseSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SCrowdPoseBoneSaveData> m_aBones; // 0x0
@@ -12567,14 +12426,12 @@ static_assert(alignof(SCrowdPoseSaveData) == 0x8, "Wrong alignment for SCrowdPos
 class alignas(8) SCrowdPoseCollectionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdPoseCollectionSaveData& p_Other) const;
+	bool operator==(const SCrowdPoseCollectionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdPoseCollectionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint64 m_id; // 0x0
@@ -12589,14 +12446,12 @@ static_assert(alignof(SCrowdPoseCollectionSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SCrowdDeadPoseRepositorySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdDeadPoseRepositorySaveData& p_Other) const;
+	bool operator==(const SCrowdDeadPoseRepositorySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdDeadPoseRepositorySaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SCrowdPoseCollectionSaveData> m_aPoseCollections; // 0x0
@@ -12609,14 +12464,14 @@ static_assert(alignof(SCrowdDeadPoseRepositorySaveData) == 0x8, "Wrong alignment
 class alignas(16) SRegionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRegionSaveData& p_Other) const;
+	bool operator==(const SRegionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRegionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nIndex; // 0x0
@@ -12647,14 +12502,12 @@ static_assert(alignof(SRegionSaveData) == 0x10, "Wrong alignment for SRegionSave
 class alignas(8) SCrowdEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdEntitySaveData& p_Other) const;
+	bool operator==(const SCrowdEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SCrowdActorSaveData> m_CrowdActorData; // 0x0
@@ -12677,14 +12530,12 @@ static_assert(alignof(SCrowdEntitySaveData) == 0x8, "Wrong alignment for SCrowdE
 class alignas(8) SCrowdFlowChannel
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdFlowChannel& p_Other) const;
+	bool operator==(const SCrowdFlowChannel& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdFlowChannel& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint8> m_aFlowVectorIndex; // 0x0
@@ -12699,14 +12550,14 @@ static_assert(alignof(SCrowdFlowChannel) == 0x8, "Wrong alignment for SCrowdFlow
 class alignas(2) ZCrowdGridPoint
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const ZCrowdGridPoint& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const ZCrowdGridPoint& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZCrowdGridPoint& p_Other) const { return !(*this == p_Other); }
 
 	int16 m_nHeightOffset; // 0x0
@@ -12721,14 +12572,12 @@ static_assert(alignof(ZCrowdGridPoint) == 0x2, "Wrong alignment for ZCrowdGridPo
 class alignas(16) SCrowdMapData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdMapData& p_Other) const;
+	bool operator==(const SCrowdMapData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdMapData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nVersion; // 0x0
@@ -12773,14 +12622,14 @@ static_assert(alignof(SCrowdMapData) == 0x10, "Wrong alignment for SCrowdMapData
 class alignas(4) SCrowdReactionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdReactionSaveData& p_Other) const;
+	bool operator==(const SCrowdReactionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdReactionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nNumPacify; // 0x0
@@ -12801,14 +12650,12 @@ static_assert(alignof(SCrowdReactionSaveData) == 0x4, "Wrong alignment for SCrow
 class alignas(8) SCrowdServiceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdServiceSaveData& p_Other) const;
+	bool operator==(const SCrowdServiceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdServiceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SCrowdBodySaveData> m_aDeadBodies; // 0x0
@@ -12825,14 +12672,14 @@ static_assert(alignof(SCrowdServiceSaveData) == 0x8, "Wrong alignment for SCrowd
 class alignas(8) SCuriousEventSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCuriousEventSaveData& p_Other) const;
+	bool operator==(const SCuriousEventSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCuriousEventSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_tExpiresAt; // 0x0
@@ -12847,14 +12694,12 @@ static_assert(alignof(SCuriousEventSaveData) == 0x8, "Wrong alignment for SCurio
 class alignas(8) SCuriousEventServiceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCuriousEventServiceSaveData& p_Other) const;
+	bool operator==(const SCuriousEventServiceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCuriousEventServiceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SCuriousEventSaveData> m_aCuriousEvents; // 0x0
@@ -12867,14 +12712,12 @@ static_assert(alignof(SCuriousEventServiceSaveData) == 0x8, "Wrong alignment for
 class alignas(4) SCutSequenceData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCutSequenceData& p_Other) const;
+	bool operator==(const SCutSequenceData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCutSequenceData& p_Other) const { return !(*this == p_Other); }
 
 	TResourcePtr m_animResource; // 0x0
@@ -12893,14 +12736,14 @@ static_assert(alignof(SCutSequenceData) == 0x4, "Wrong alignment for SCutSequenc
 class alignas(1) SDangerousAreaSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SDangerousAreaSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SDangerousAreaSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDangerousAreaSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bDangerous; // 0x0
@@ -12913,14 +12756,12 @@ static_assert(alignof(SDangerousAreaSaveData) == 0x1, "Wrong alignment for SDang
 class alignas(8) SDeadBodyInfoSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDeadBodyInfoSaveData& p_Other) const;
+	bool operator==(const SDeadBodyInfoSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDeadBodyInfoSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -12957,14 +12798,12 @@ static_assert(alignof(SDeadBodyInfoSaveData) == 0x8, "Wrong alignment for SDeadB
 class alignas(8) SDeadBodySensorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDeadBodySensorSaveData& p_Other) const;
+	bool operator==(const SDeadBodySensorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDeadBodySensorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SDeadBodyInfoSaveData> m_aBodies; // 0x0
@@ -12979,14 +12818,14 @@ static_assert(alignof(SDeadBodySensorSaveData) == 0x8, "Wrong alignment for SDea
 class alignas(4) SVector2
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVector2& p_Other) const;
+	bool operator==(const SVector2& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVector2& p_Other) const { return !(*this == p_Other); }
 
 	float32 x; // 0x0
@@ -13001,14 +12840,14 @@ static_assert(alignof(SVector2) == 0x4, "Wrong alignment for SVector2");
 class alignas(16) SDecalSpawnSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDecalSpawnSaveData& p_Other) const;
+	bool operator==(const SDecalSpawnSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDecalSpawnSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bWasSpawned; // 0x0
@@ -13041,14 +12880,14 @@ static_assert(alignof(SDecalSpawnSaveData) == 0x10, "Wrong alignment for SDecalS
 class alignas(4) SDestructibleInteractionHandlerData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SDestructibleInteractionHandlerData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SDestructibleInteractionHandlerData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDestructibleInteractionHandlerData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fSettleTime; // 0x0
@@ -13061,14 +12900,12 @@ static_assert(alignof(SDestructibleInteractionHandlerData) == 0x4, "Wrong alignm
 class alignas(16) SDestructiblePieceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDestructiblePieceSaveData& p_Other) const;
+	bool operator==(const SDestructiblePieceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDestructiblePieceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SMatrix m_mTransform; // 0x0
@@ -13093,14 +12930,12 @@ static_assert(alignof(SDestructiblePieceSaveData) == 0x10, "Wrong alignment for
 class alignas(8) SDestructibleRuntimeConnnection
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDestructibleRuntimeConnnection& p_Other) const;
+	bool operator==(const SDestructibleRuntimeConnnection& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDestructibleRuntimeConnnection& p_Other) const { return !(*this == p_Other); }
 
 	uint16 m_nPieceIndex; // 0x0
@@ -13115,14 +12950,14 @@ static_assert(alignof(SDestructibleRuntimeConnnection) == 0x8, "Wrong alignment
 class alignas(4) SDestructibleRuntimeDamage
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDestructibleRuntimeDamage& p_Other) const;
+	bool operator==(const SDestructibleRuntimeDamage& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDestructibleRuntimeDamage& p_Other) const { return !(*this == p_Other); }
 
 	uint16 m_nPieceIndex; // 0x0
@@ -13137,14 +12972,12 @@ static_assert(alignof(SDestructibleRuntimeDamage) == 0x4, "Wrong alignment for S
 class alignas(8) SDestructibleObjectSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDestructibleObjectSaveData& p_Other) const;
+	bool operator==(const SDestructibleObjectSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDestructibleObjectSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SDestructibleInteractionHandlerData m_interactionData; // 0x0
@@ -13177,14 +13010,14 @@ static_assert(alignof(SDestructibleObjectSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SDetectedInPrivateGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDetectedInPrivateGroupSaveData& p_Other) const;
+	bool operator==(const SDetectedInPrivateGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDetectedInPrivateGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -13207,14 +13040,14 @@ static_assert(alignof(SDetectedInPrivateGroupSaveData) == 0x8, "Wrong alignment
 class alignas(1) SDisguiseZoneSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SDisguiseZoneSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SDisguiseZoneSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDisguiseZoneSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -13227,14 +13060,14 @@ static_assert(alignof(SDisguiseZoneSaveData) == 0x1, "Wrong alignment for SDisgu
 class alignas(8) SDisturbanceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDisturbanceSaveData& p_Other) const;
+	bool operator==(const SDisturbanceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDisturbanceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_object; // 0x0
@@ -13257,14 +13090,14 @@ static_assert(alignof(SDisturbanceSaveData) == 0x8, "Wrong alignment for SDistur
 class alignas(8) SDoorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SDoorSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SDoorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDoorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nDoorState; // 0x0
@@ -13297,14 +13130,12 @@ public:
 class alignas(8) SDoorsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDoorsSaveData& p_Other) const;
+	bool operator==(const SDoorsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDoorsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -13319,14 +13150,12 @@ static_assert(alignof(SDoorsSaveData) == 0x8, "Wrong alignment for SDoorsSaveDat
 class alignas(8) SDrama2ActorSaveState
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDrama2ActorSaveState& p_Other) const;
+	bool operator==(const SDrama2ActorSaveState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDrama2ActorSaveState& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -13363,14 +13192,12 @@ static_assert(alignof(SDrama2ActorSaveState) == 0x8, "Wrong alignment for SDrama
 class alignas(8) SDrama2ActorCollectionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDrama2ActorCollectionSaveData& p_Other) const;
+	bool operator==(const SDrama2ActorCollectionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDrama2ActorCollectionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -13385,14 +13212,14 @@ static_assert(alignof(SDrama2ActorCollectionSaveData) == 0x8, "Wrong alignment f
 class alignas(4) SDrama2SetupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDrama2SetupSaveData& p_Other) const;
+	bool operator==(const SDrama2SetupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDrama2SetupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bDoneTriggered; // 0x0
@@ -13409,14 +13236,12 @@ static_assert(alignof(SDrama2SetupSaveData) == 0x4, "Wrong alignment for SDrama2
 class alignas(8) SDrama2SetupCollectionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDrama2SetupCollectionSaveData& p_Other) const;
+	bool operator==(const SDrama2SetupCollectionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDrama2SetupCollectionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -13431,14 +13256,14 @@ static_assert(alignof(SDrama2SetupCollectionSaveData) == 0x8, "Wrong alignment f
 class alignas(4) SDrama2SituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDrama2SituationSaveData& p_Other) const;
+	bool operator==(const SDrama2SituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDrama2SituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_nPriorityModifier; // 0x0
@@ -13463,14 +13288,12 @@ static_assert(alignof(SDrama2SituationSaveData) == 0x4, "Wrong alignment for SDr
 class alignas(8) SDrama2SituationCollectionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDrama2SituationCollectionSaveData& p_Other) const;
+	bool operator==(const SDrama2SituationCollectionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDrama2SituationCollectionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -13485,14 +13308,12 @@ static_assert(alignof(SDrama2SituationCollectionSaveData) == 0x8, "Wrong alignme
 class alignas(8) SDramaActorSaveState
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDramaActorSaveState& p_Other) const;
+	bool operator==(const SDramaActorSaveState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDramaActorSaveState& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -13523,14 +13344,12 @@ static_assert(alignof(SDramaActorSaveState) == 0x8, "Wrong alignment for SDramaA
 class alignas(8) SDramaActorCollectionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDramaActorCollectionSaveData& p_Other) const;
+	bool operator==(const SDramaActorCollectionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDramaActorCollectionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -13545,14 +13364,14 @@ static_assert(alignof(SDramaActorCollectionSaveData) == 0x8, "Wrong alignment fo
 class alignas(1) SDramaControllerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SDramaControllerSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SDramaControllerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDramaControllerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsStartCondValid; // 0x0
@@ -13579,14 +13398,12 @@ public:
 class alignas(8) ZCurve
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZCurve& p_Other) const;
+	bool operator==(const ZCurve& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZCurve& p_Other) const { return !(*this == p_Other); }
 
 	TArray<TFixedArray<float32, 8>> data; // 0x0
@@ -13614,14 +13431,14 @@ public:
 class alignas(4) SDramaSetupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDramaSetupSaveData& p_Other) const;
+	bool operator==(const SDramaSetupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDramaSetupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bDoneTriggered; // 0x0
@@ -13638,14 +13455,12 @@ static_assert(alignof(SDramaSetupSaveData) == 0x4, "Wrong alignment for SDramaSe
 class alignas(8) SDramaSetupCollectionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDramaSetupCollectionSaveData& p_Other) const;
+	bool operator==(const SDramaSetupCollectionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDramaSetupCollectionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -13660,14 +13475,14 @@ static_assert(alignof(SDramaSetupCollectionSaveData) == 0x8, "Wrong alignment fo
 class alignas(4) SDramaSituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SDramaSituationSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SDramaSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDramaSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bSituationRunning; // 0x0
@@ -13688,14 +13503,12 @@ static_assert(alignof(SDramaSituationSaveData) == 0x4, "Wrong alignment for SDra
 class alignas(8) SDramaSituationCollectionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDramaSituationCollectionSaveData& p_Other) const;
+	bool operator==(const SDramaSituationCollectionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDramaSituationCollectionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -13710,14 +13523,14 @@ static_assert(alignof(SDramaSituationCollectionSaveData) == 0x8, "Wrong alignmen
 class alignas(16) SDynamicEnforcerCandidateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDynamicEnforcerCandidateSaveData& p_Other) const;
+	bool operator==(const SDynamicEnforcerCandidateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDynamicEnforcerCandidateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -13736,14 +13549,12 @@ static_assert(alignof(SDynamicEnforcerCandidateSaveData) == 0x10, "Wrong alignme
 class alignas(8) SDynamicEnforcerServiceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDynamicEnforcerServiceSaveData& p_Other) const;
+	bool operator==(const SDynamicEnforcerServiceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDynamicEnforcerServiceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SDynamicEnforcerCandidateSaveData> m_aCandidates; // 0x0
@@ -13756,14 +13567,12 @@ static_assert(alignof(SDynamicEnforcerServiceSaveData) == 0x8, "Wrong alignment
 class alignas(8) SDynamicObjectKeyValuePair
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDynamicObjectKeyValuePair& p_Other) const;
+	bool operator==(const SDynamicObjectKeyValuePair& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDynamicObjectKeyValuePair& p_Other) const { return !(*this == p_Other); }
 
 	ZString sKey; // 0x0
@@ -13778,14 +13587,14 @@ static_assert(alignof(SDynamicObjectKeyValuePair) == 0x8, "Wrong alignment for S
 class alignas(1) SDynamicRayCastEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDynamicRayCastEntitySaveData& p_Other) const;
+	bool operator==(const SDynamicRayCastEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDynamicRayCastEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -13802,14 +13611,12 @@ static_assert(alignof(SDynamicRayCastEntitySaveData) == 0x1, "Wrong alignment fo
 class alignas(8) SEntityPath
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityPath& p_Other) const;
+	bool operator==(const SEntityPath& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityPath& p_Other) const { return !(*this == p_Other); }
 
 	uint64 m_nOwnerID; // 0x0
@@ -13824,14 +13631,12 @@ static_assert(alignof(SEntityPath) == 0x8, "Wrong alignment for SEntityPath");
 class alignas(8) SEntityPinDescriptor
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityPinDescriptor& p_Other) const;
+	bool operator==(const SEntityPinDescriptor& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityPinDescriptor& p_Other) const { return !(*this == p_Other); }
 
 	ZString sName; // 0x0
@@ -13854,14 +13659,12 @@ static_assert(alignof(SEntityPinDescriptor) == 0x8, "Wrong alignment for SEntity
 class alignas(8) SEntityPropertyDescriptor
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityPropertyDescriptor& p_Other) const;
+	bool operator==(const SEntityPropertyDescriptor& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityPropertyDescriptor& p_Other) const { return !(*this == p_Other); }
 
 	ZString sName; // 0x0
@@ -13880,14 +13683,12 @@ static_assert(alignof(SEntityPropertyDescriptor) == 0x8, "Wrong alignment for SE
 class alignas(8) SEntityTemplateEntitySubset
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTemplateEntitySubset& p_Other) const;
+	bool operator==(const SEntityTemplateEntitySubset& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTemplateEntitySubset& p_Other) const { return !(*this == p_Other); }
 
 	TArray<int32> entities; // 0x0
@@ -13900,14 +13701,12 @@ static_assert(alignof(SEntityTemplateEntitySubset) == 0x8, "Wrong alignment for
 class alignas(8) SEntityTemplateReference
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTemplateReference& p_Other) const;
+	bool operator==(const SEntityTemplateReference& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTemplateReference& p_Other) const { return !(*this == p_Other); }
 
 	uint64 entityID; // 0x0
@@ -13926,14 +13725,12 @@ static_assert(alignof(SEntityTemplateReference) == 0x8, "Wrong alignment for SEn
 class alignas(8) SEntityTemplateExposedEntity
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTemplateExposedEntity& p_Other) const;
+	bool operator==(const SEntityTemplateExposedEntity& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTemplateExposedEntity& p_Other) const { return !(*this == p_Other); }
 
 	ZString sName; // 0x0
@@ -13950,14 +13747,12 @@ static_assert(alignof(SEntityTemplateExposedEntity) == 0x8, "Wrong alignment for
 class alignas(8) SEntityTemplatePinConnection
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTemplatePinConnection& p_Other) const;
+	bool operator==(const SEntityTemplatePinConnection& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTemplatePinConnection& p_Other) const { return !(*this == p_Other); }
 
 	int32 fromID; // 0x0
@@ -13978,14 +13773,12 @@ static_assert(alignof(SEntityTemplatePinConnection) == 0x8, "Wrong alignment for
 class alignas(8) SEntityTemplatePropertyAlias
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTemplatePropertyAlias& p_Other) const;
+	bool operator==(const SEntityTemplatePropertyAlias& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTemplatePropertyAlias& p_Other) const { return !(*this == p_Other); }
 
 	ZString sAliasName; // 0x0
@@ -14002,14 +13795,12 @@ static_assert(alignof(SEntityTemplatePropertyAlias) == 0x8, "Wrong alignment for
 class alignas(8) SEntityTemplatePropertyOverride
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTemplatePropertyOverride& p_Other) const;
+	bool operator==(const SEntityTemplatePropertyOverride& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTemplatePropertyOverride& p_Other) const { return !(*this == p_Other); }
 
 	SEntityTemplateReference propertyOwner; // 0x0
@@ -14024,14 +13815,12 @@ static_assert(alignof(SEntityTemplatePropertyOverride) == 0x8, "Wrong alignment
 class alignas(8) SExposedEntityDescriptor
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SExposedEntityDescriptor& p_Other) const;
+	bool operator==(const SExposedEntityDescriptor& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SExposedEntityDescriptor& p_Other) const { return !(*this == p_Other); }
 
 	ZString sName; // 0x0
@@ -14052,14 +13841,12 @@ static_assert(alignof(SExposedEntityDescriptor) == 0x8, "Wrong alignment for SEx
 class alignas(8) SExposedEntityTypeDescriptor
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SExposedEntityTypeDescriptor& p_Other) const;
+	bool operator==(const SExposedEntityTypeDescriptor& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SExposedEntityTypeDescriptor& p_Other) const { return !(*this == p_Other); }
 
 	ZString sName; // 0x0
@@ -14076,14 +13863,12 @@ static_assert(alignof(SExposedEntityTypeDescriptor) == 0x8, "Wrong alignment for
 class alignas(8) STypeReference
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STypeReference& p_Other) const;
+	bool operator==(const STypeReference& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STypeReference& p_Other) const { return !(*this == p_Other); }
 
 	ZString sEntityID; // 0x0
@@ -14098,14 +13883,12 @@ static_assert(alignof(STypeReference) == 0x8, "Wrong alignment for STypeReferenc
 class alignas(8) SExposedTypeInfo
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SExposedTypeInfo& p_Other) const;
+	bool operator==(const SExposedTypeInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SExposedTypeInfo& p_Other) const { return !(*this == p_Other); }
 
 	ZString sName; // 0x0
@@ -14124,14 +13907,12 @@ static_assert(alignof(SExposedTypeInfo) == 0x8, "Wrong alignment for SExposedTyp
 class alignas(8) SEntityTypeDescriptor
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTypeDescriptor& p_Other) const;
+	bool operator==(const SEntityTypeDescriptor& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTypeDescriptor& p_Other) const { return !(*this == p_Other); }
 
 	ZString typeName; // 0x0
@@ -14168,14 +13949,12 @@ static_assert(alignof(SEntityTypeDescriptor) == 0x8, "Wrong alignment for SEntit
 class alignas(8) SEnvironmentConfigResourceEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEnvironmentConfigResourceEntry& p_Other) const;
+	bool operator==(const SEnvironmentConfigResourceEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEnvironmentConfigResourceEntry& p_Other) const { return !(*this == p_Other); }
 
 	ZString Name; // 0x0
@@ -14194,14 +13973,12 @@ static_assert(alignof(SEnvironmentConfigResourceEntry) == 0x8, "Wrong alignment
 class alignas(8) SEnvironmentConfigResource
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEnvironmentConfigResource& p_Other) const;
+	bool operator==(const SEnvironmentConfigResource& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEnvironmentConfigResource& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SEnvironmentConfigResourceEntry> Environments; // 0x0
@@ -14214,14 +13991,14 @@ static_assert(alignof(SEnvironmentConfigResource) == 0x8, "Wrong alignment for S
 class alignas(16) SEscortOutBehaviorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SEscortOutBehaviorSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SEscortOutBehaviorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEscortOutBehaviorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nSituation; // 0x0
@@ -14260,14 +14037,12 @@ static_assert(alignof(SEscortOutBehaviorSaveData) == 0x10, "Wrong alignment for
 class alignas(8) SEscortOutOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEscortOutOrderSaveData& p_Other) const;
+	bool operator==(const SEscortOutOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEscortOutOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<float4> m_aExitPoints; // 0x0
@@ -14307,14 +14082,14 @@ public:
 class alignas(4) SEscortSituation2ActorStateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEscortSituation2ActorStateSaveData& p_Other) const;
+	bool operator==(const SEscortSituation2ActorStateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEscortSituation2ActorStateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nID; // 0x0
@@ -14339,14 +14114,14 @@ static_assert(alignof(SEscortSituation2ActorStateSaveData) == 0x4, "Wrong alignm
 class alignas(4) SEscortSituation2Actors
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SEscortSituation2Actors& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SEscortSituation2Actors& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEscortSituation2Actors& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -14359,14 +14134,12 @@ static_assert(alignof(SEscortSituation2Actors) == 0x4, "Wrong alignment for SEsc
 class alignas(8) SEscortSituation2SaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEscortSituation2SaveData& p_Other) const;
+	bool operator==(const SEscortSituation2SaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEscortSituation2SaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bActivated; // 0x0
@@ -14442,14 +14215,14 @@ public:
 class alignas(4) SEscortSituationActorStateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEscortSituationActorStateSaveData& p_Other) const;
+	bool operator==(const SEscortSituationActorStateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEscortSituationActorStateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nID; // 0x0
@@ -14474,14 +14247,14 @@ static_assert(alignof(SEscortSituationActorStateSaveData) == 0x4, "Wrong alignme
 class alignas(4) SEscortSituationActors
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEscortSituationActors& p_Other) const;
+	bool operator==(const SEscortSituationActors& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEscortSituationActors& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -14494,14 +14267,12 @@ static_assert(alignof(SEscortSituationActors) == 0x4, "Wrong alignment for SEsco
 class alignas(8) SEscortSituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEscortSituationSaveData& p_Other) const;
+	bool operator==(const SEscortSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEscortSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bActivated; // 0x0
@@ -14550,14 +14321,14 @@ static_assert(alignof(SEscortSituationSaveData) == 0x8, "Wrong alignment for SEs
 class alignas(4) SEvacuateSituationMemberSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SEvacuateSituationMemberSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SEvacuateSituationMemberSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEvacuateSituationMemberSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_pGuardDutyPoint; // 0x0
@@ -14574,14 +14345,12 @@ static_assert(alignof(SEvacuateSituationMemberSaveData) == 0x4, "Wrong alignment
 class alignas(8) SEvacuateSituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEvacuateSituationSaveData& p_Other) const;
+	bool operator==(const SEvacuateSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEvacuateSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -14606,14 +14375,14 @@ static_assert(alignof(SEvacuateSituationSaveData) == 0x8, "Wrong alignment for S
 class alignas(8) SEvacuateTrespassGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEvacuateTrespassGroupSaveData& p_Other) const;
+	bool operator==(const SEvacuateTrespassGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEvacuateTrespassGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -14642,14 +14411,12 @@ static_assert(alignof(SEvacuateTrespassGroupSaveData) == 0x8, "Wrong alignment f
 class alignas(8) SEvacuateVIPGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEvacuateVIPGroupSaveData& p_Other) const;
+	bool operator==(const SEvacuateVIPGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEvacuateVIPGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -14688,14 +14455,14 @@ static_assert(alignof(SEvacuateVIPGroupSaveData) == 0x8, "Wrong alignment for SE
 class alignas(1) SEventChannelSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEventChannelSaveData& p_Other) const;
+	bool operator==(const SEventChannelSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEventChannelSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -14708,14 +14475,14 @@ static_assert(alignof(SEventChannelSaveData) == 0x1, "Wrong alignment for SEvent
 class alignas(1) SExitSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SExitSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SExitSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SExitSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -14728,14 +14495,12 @@ static_assert(alignof(SExitSaveData) == 0x1, "Wrong alignment for SExitSaveData"
 class alignas(8) SExtendedCppEntityProperty
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SExtendedCppEntityProperty& p_Other) const;
+	bool operator==(const SExtendedCppEntityProperty& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SExtendedCppEntityProperty& p_Other) const { return !(*this == p_Other); }
 
 	ZString propertyName; // 0x0
@@ -14754,14 +14519,12 @@ static_assert(alignof(SExtendedCppEntityProperty) == 0x8, "Wrong alignment for S
 class alignas(8) SExtendedCppEntityBlueprint
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SExtendedCppEntityBlueprint& p_Other) const;
+	bool operator==(const SExtendedCppEntityBlueprint& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SExtendedCppEntityBlueprint& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SExtendedCppEntityProperty> properties; // 0x0
@@ -14774,14 +14537,12 @@ static_assert(alignof(SExtendedCppEntityBlueprint) == 0x8, "Wrong alignment for
 class alignas(8) SExternalEntityTemplatePinConnection
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SExternalEntityTemplatePinConnection& p_Other) const;
+	bool operator==(const SExternalEntityTemplatePinConnection& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SExternalEntityTemplatePinConnection& p_Other) const { return !(*this == p_Other); }
 
 	SEntityTemplateReference fromEntity; // 0x0
@@ -14802,14 +14563,14 @@ static_assert(alignof(SExternalEntityTemplatePinConnection) == 0x8, "Wrong align
 class alignas(4) SFaceOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SFaceOrderSaveData& p_Other) const;
+	bool operator==(const SFaceOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFaceOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bLookAt; // 0x0
@@ -14832,14 +14593,14 @@ static_assert(alignof(SFaceOrderSaveData) == 0x4, "Wrong alignment for SFaceOrde
 class alignas(4) SFleeOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SFleeOrderSaveData& p_Other) const;
+	bool operator==(const SFleeOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFleeOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	EDisturbanceType m_eHelpReason; // 0x0
@@ -14856,14 +14617,12 @@ static_assert(alignof(SFleeOrderSaveData) == 0x4, "Wrong alignment for SFleeOrde
 class alignas(8) SFontDefinition
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SFontDefinition& p_Other) const;
+	bool operator==(const SFontDefinition& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFontDefinition& p_Other) const { return !(*this == p_Other); }
 
 	ZString sFontId; // 0x0
@@ -14882,14 +14641,12 @@ static_assert(alignof(SFontDefinition) == 0x8, "Wrong alignment for SFontDefinit
 class alignas(8) SFontLibraryDefinition
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SFontLibraryDefinition& p_Other) const;
+	bool operator==(const SFontLibraryDefinition& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFontLibraryDefinition& p_Other) const { return !(*this == p_Other); }
 
 	ZString sFontLocaleID; // 0x0
@@ -14904,14 +14661,12 @@ static_assert(alignof(SFontLibraryDefinition) == 0x8, "Wrong alignment for SFont
 class alignas(8) SFooStruct
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SFooStruct& p_Other) const;
+	bool operator==(const SFooStruct& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFooStruct& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_eTest; // 0x0
@@ -14936,14 +14691,14 @@ public:
 
 
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SFootIKEventData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SFootIKEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFootIKEventData& p_Other) const { return !(*this == p_Other); }
 
 	SFootIKEventData::EFoot m_Foot; // 0x0
@@ -14978,14 +14733,14 @@ public:
 class alignas(8) SFriskSuspectGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SFriskSuspectGroupSaveData& p_Other) const;
+	bool operator==(const SFriskSuspectGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFriskSuspectGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -15028,14 +14783,14 @@ static_assert(alignof(SFriskSuspectGroupSaveData) == 0x8, "Wrong alignment for S
 class alignas(4) SGBufferSample
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SGBufferSample& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SGBufferSample& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGBufferSample& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 normal; // 0x0
@@ -15062,14 +14817,14 @@ static_assert(alignof(SGBufferSample) == 0x4, "Wrong alignment for SGBufferSampl
 class alignas(16) SGProperties
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGProperties& p_Other) const;
+	bool operator==(const SGProperties& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGProperties& p_Other) const { return !(*this == p_Other); }
 
 	float4 vMin; // 0x0
@@ -15090,14 +14845,14 @@ static_assert(alignof(SGProperties) == 0x10, "Wrong alignment for SGProperties")
 class alignas(4) SGUIViewPort
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGUIViewPort& p_Other) const;
+	bool operator==(const SGUIViewPort& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGUIViewPort& p_Other) const { return !(*this == p_Other); }
 
 	uint32 x; // 0x0
@@ -15116,14 +14871,14 @@ static_assert(alignof(SGUIViewPort) == 0x4, "Wrong alignment for SGUIViewPort");
 class alignas(16) SGWaypoint
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SGWaypoint& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SGWaypoint& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGWaypoint& p_Other) const { return !(*this == p_Other); }
 
 	uint16 nNeighbor0; // 0x0
@@ -15156,14 +14911,14 @@ static_assert(alignof(SGWaypoint) == 0x10, "Wrong alignment for SGWaypoint");
 class alignas(4) SGaitTransitionEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGaitTransitionEntry& p_Other) const;
+	bool operator==(const SGaitTransitionEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGaitTransitionEntry& p_Other) const { return !(*this == p_Other); }
 
 	EGait m_gait; // 0x0
@@ -15178,14 +14933,14 @@ static_assert(alignof(SGaitTransitionEntry) == 0x4, "Wrong alignment for SGaitTr
 class alignas(4) SGameCamProfileEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SGameCamProfileEntitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SGameCamProfileEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGameCamProfileEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsEnabled; // 0x0
@@ -15200,14 +14955,14 @@ static_assert(alignof(SGameCamProfileEntitySaveData) == 0x4, "Wrong alignment fo
 class alignas(1) SShotListenerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SShotListenerSaveData& p_Other) const;
+	bool operator==(const SShotListenerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SShotListenerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -15222,14 +14977,12 @@ static_assert(alignof(SShotListenerSaveData) == 0x1, "Wrong alignment for SShotL
 class alignas(8) SShotListenersSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SShotListenersSaveData& p_Other) const;
+	bool operator==(const SShotListenersSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SShotListenersSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15244,14 +14997,14 @@ static_assert(alignof(SShotListenersSaveData) == 0x8, "Wrong alignment for SShot
 class alignas(8) SVIPEvacuationNodeSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVIPEvacuationNodeSaveData& p_Other) const;
+	bool operator==(const SVIPEvacuationNodeSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVIPEvacuationNodeSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fPenaltyMultiplier; // 0x0
@@ -15272,14 +15025,12 @@ static_assert(alignof(SVIPEvacuationNodeSaveData) == 0x8, "Wrong alignment for S
 class alignas(8) SVIPEvacuationNodesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVIPEvacuationNodesSaveData& p_Other) const;
+	bool operator==(const SVIPEvacuationNodesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVIPEvacuationNodesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15294,14 +15045,14 @@ static_assert(alignof(SVIPEvacuationNodesSaveData) == 0x8, "Wrong alignment for
 class alignas(4) SItemSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SItemSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SItemSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_vPosition; // 0x0
@@ -15352,14 +15103,12 @@ static_assert(alignof(SItemSaveData) == 0x4, "Wrong alignment for SItemSaveData"
 class alignas(8) SItemsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SItemsSaveData& p_Other) const;
+	bool operator==(const SItemsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15374,14 +15123,14 @@ static_assert(alignof(SItemsSaveData) == 0x8, "Wrong alignment for SItemsSaveDat
 class alignas(4) SMathMultiplyDivideSaveData_SVector4
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultiplyDivideSaveData_SVector4& p_Other) const;
+	bool operator==(const SMathMultiplyDivideSaveData_SVector4& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultiplyDivideSaveData_SVector4& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 m_fA; // 0x0
@@ -15398,14 +15147,12 @@ static_assert(alignof(SMathMultiplyDivideSaveData_SVector4) == 0x4, "Wrong align
 class alignas(8) SMathMultipliesSaveData_SVector4
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultipliesSaveData_SVector4& p_Other) const;
+	bool operator==(const SMathMultipliesSaveData_SVector4& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultipliesSaveData_SVector4& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15420,14 +15167,14 @@ static_assert(alignof(SMathMultipliesSaveData_SVector4) == 0x8, "Wrong alignment
 class alignas(1) SVolumeTriggerListenerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SVolumeTriggerListenerSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SVolumeTriggerListenerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVolumeTriggerListenerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bColliding; // 0x0
@@ -15442,14 +15189,12 @@ static_assert(alignof(SVolumeTriggerListenerSaveData) == 0x1, "Wrong alignment f
 class alignas(8) SVolumeTriggersSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVolumeTriggersSaveData& p_Other) const;
+	bool operator==(const SVolumeTriggersSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVolumeTriggersSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15464,14 +15209,14 @@ static_assert(alignof(SVolumeTriggersSaveData) == 0x8, "Wrong alignment for SVol
 class alignas(4) SMathMultiplyDivideSaveData_SVector3
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultiplyDivideSaveData_SVector3& p_Other) const;
+	bool operator==(const SMathMultiplyDivideSaveData_SVector3& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultiplyDivideSaveData_SVector3& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_fA; // 0x0
@@ -15488,14 +15233,12 @@ static_assert(alignof(SMathMultiplyDivideSaveData_SVector3) == 0x4, "Wrong align
 class alignas(8) SMathMultipliesSaveData_SVector3
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultipliesSaveData_SVector3& p_Other) const;
+	bool operator==(const SMathMultipliesSaveData_SVector3& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultipliesSaveData_SVector3& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15510,14 +15253,14 @@ static_assert(alignof(SMathMultipliesSaveData_SVector3) == 0x8, "Wrong alignment
 class alignas(4) SMathMultiplyDivideSaveData_float32
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultiplyDivideSaveData_float32& p_Other) const;
+	bool operator==(const SMathMultiplyDivideSaveData_float32& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultiplyDivideSaveData_float32& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fA; // 0x0
@@ -15534,14 +15277,12 @@ static_assert(alignof(SMathMultiplyDivideSaveData_float32) == 0x4, "Wrong alignm
 class alignas(8) SMathMultipliesSaveData_float32
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultipliesSaveData_float32& p_Other) const;
+	bool operator==(const SMathMultipliesSaveData_float32& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultipliesSaveData_float32& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15556,14 +15297,14 @@ static_assert(alignof(SMathMultipliesSaveData_float32) == 0x8, "Wrong alignment
 class alignas(4) SItemKeywordProxySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SItemKeywordProxySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SItemKeywordProxySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemKeywordProxySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rItem; // 0x0
@@ -15576,14 +15317,12 @@ static_assert(alignof(SItemKeywordProxySaveData) == 0x4, "Wrong alignment for SI
 class alignas(8) SItemKeywordProxiesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SItemKeywordProxiesSaveData& p_Other) const;
+	bool operator==(const SItemKeywordProxiesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemKeywordProxiesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15598,14 +15337,14 @@ static_assert(alignof(SItemKeywordProxiesSaveData) == 0x8, "Wrong alignment for
 class alignas(4) SMathMultiplyDivideSaveData_SVector2
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultiplyDivideSaveData_SVector2& p_Other) const;
+	bool operator==(const SMathMultiplyDivideSaveData_SVector2& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultiplyDivideSaveData_SVector2& p_Other) const { return !(*this == p_Other); }
 
 	SVector2 m_fA; // 0x0
@@ -15622,14 +15361,12 @@ static_assert(alignof(SMathMultiplyDivideSaveData_SVector2) == 0x4, "Wrong align
 class alignas(8) SMathMultipliesSaveData_SVector2
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultipliesSaveData_SVector2& p_Other) const;
+	bool operator==(const SMathMultipliesSaveData_SVector2& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultipliesSaveData_SVector2& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15644,14 +15381,14 @@ static_assert(alignof(SMathMultipliesSaveData_SVector2) == 0x8, "Wrong alignment
 class alignas(4) SLampCoreSaveState
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLampCoreSaveState& p_Other) const;
+	bool operator==(const SLampCoreSaveState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLampCoreSaveState& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fDiffusePower; // 0x0
@@ -15666,14 +15403,12 @@ static_assert(alignof(SLampCoreSaveState) == 0x4, "Wrong alignment for SLampCore
 class alignas(8) SLampCoreSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLampCoreSaveData& p_Other) const;
+	bool operator==(const SLampCoreSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLampCoreSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15688,14 +15423,14 @@ static_assert(alignof(SLampCoreSaveData) == 0x8, "Wrong alignment for SLampCoreS
 class alignas(4) SItsATrapSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SItsATrapSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SItsATrapSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItsATrapSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -15710,14 +15445,12 @@ static_assert(alignof(SItsATrapSaveData) == 0x4, "Wrong alignment for SItsATrapS
 class alignas(8) STrapsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STrapsSaveData& p_Other) const;
+	bool operator==(const STrapsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STrapsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15732,14 +15465,14 @@ static_assert(alignof(STrapsSaveData) == 0x8, "Wrong alignment for STrapsSaveDat
 class alignas(4) SMathLerpSaveData_float32
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpSaveData_float32& p_Other) const;
+	bool operator==(const SMathLerpSaveData_float32& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpSaveData_float32& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_A; // 0x0
@@ -15756,14 +15489,12 @@ static_assert(alignof(SMathLerpSaveData_float32) == 0x4, "Wrong alignment for SM
 class alignas(8) SMathLerpsSaveData_float32
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpsSaveData_float32& p_Other) const;
+	bool operator==(const SMathLerpsSaveData_float32& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpsSaveData_float32& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15778,14 +15509,14 @@ static_assert(alignof(SMathLerpsSaveData_float32) == 0x8, "Wrong alignment for S
 class alignas(4) SMathLerpSaveData_SVector2
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpSaveData_SVector2& p_Other) const;
+	bool operator==(const SMathLerpSaveData_SVector2& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpSaveData_SVector2& p_Other) const { return !(*this == p_Other); }
 
 	SVector2 m_A; // 0x0
@@ -15802,14 +15533,12 @@ static_assert(alignof(SMathLerpSaveData_SVector2) == 0x4, "Wrong alignment for S
 class alignas(8) SMathLerpsSaveData_SVector2
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpsSaveData_SVector2& p_Other) const;
+	bool operator==(const SMathLerpsSaveData_SVector2& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpsSaveData_SVector2& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15824,14 +15553,14 @@ static_assert(alignof(SMathLerpsSaveData_SVector2) == 0x8, "Wrong alignment for
 class alignas(4) SMathLerpSaveData_SVector3
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMathLerpSaveData_SVector3& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMathLerpSaveData_SVector3& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpSaveData_SVector3& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_A; // 0x0
@@ -15848,14 +15577,12 @@ static_assert(alignof(SMathLerpSaveData_SVector3) == 0x4, "Wrong alignment for S
 class alignas(8) SMathLerpsSaveData_SVector3
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpsSaveData_SVector3& p_Other) const;
+	bool operator==(const SMathLerpsSaveData_SVector3& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpsSaveData_SVector3& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15870,14 +15597,14 @@ static_assert(alignof(SMathLerpsSaveData_SVector3) == 0x8, "Wrong alignment for
 class alignas(4) SMathLerpSaveData_SVector4
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpSaveData_SVector4& p_Other) const;
+	bool operator==(const SMathLerpSaveData_SVector4& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpSaveData_SVector4& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 m_A; // 0x0
@@ -15894,14 +15621,12 @@ static_assert(alignof(SMathLerpSaveData_SVector4) == 0x4, "Wrong alignment for S
 class alignas(8) SMathLerpsSaveData_SVector4
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpsSaveData_SVector4& p_Other) const;
+	bool operator==(const SMathLerpsSaveData_SVector4& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpsSaveData_SVector4& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15916,14 +15641,14 @@ static_assert(alignof(SMathLerpsSaveData_SVector4) == 0x8, "Wrong alignment for
 class alignas(4) SMathLerpSaveData_SColorRGB
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMathLerpSaveData_SColorRGB& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMathLerpSaveData_SColorRGB& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpSaveData_SColorRGB& p_Other) const { return !(*this == p_Other); }
 
 	SColorRGB m_A; // 0x0
@@ -15940,14 +15665,12 @@ static_assert(alignof(SMathLerpSaveData_SColorRGB) == 0x4, "Wrong alignment for
 class alignas(8) SMathLerpsSaveData_SColorRGB
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpsSaveData_SColorRGB& p_Other) const;
+	bool operator==(const SMathLerpsSaveData_SColorRGB& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpsSaveData_SColorRGB& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15962,14 +15685,14 @@ static_assert(alignof(SMathLerpsSaveData_SColorRGB) == 0x8, "Wrong alignment for
 class alignas(4) SMathLerpSaveData_SColorRGBA
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpSaveData_SColorRGBA& p_Other) const;
+	bool operator==(const SMathLerpSaveData_SColorRGBA& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpSaveData_SColorRGBA& p_Other) const { return !(*this == p_Other); }
 
 	SColorRGBA m_A; // 0x0
@@ -15986,14 +15709,12 @@ static_assert(alignof(SMathLerpSaveData_SColorRGBA) == 0x4, "Wrong alignment for
 class alignas(8) SMathLerpsSaveData_SColorRGBA
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpsSaveData_SColorRGBA& p_Other) const;
+	bool operator==(const SMathLerpsSaveData_SColorRGBA& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpsSaveData_SColorRGBA& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -16008,14 +15729,12 @@ static_assert(alignof(SMathLerpsSaveData_SColorRGBA) == 0x8, "Wrong alignment fo
 class alignas(8) SGameEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGameEntitySaveData& p_Other) const;
+	bool operator==(const SGameEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGameEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	SDoorsSaveData m_DoorData; // 0x0
@@ -16193,14 +15912,14 @@ enum class eAmmoType : int32_t
 class alignas(4) STimerEntityCommandSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STimerEntityCommandSaveData& p_Other) const;
+	bool operator==(const STimerEntityCommandSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STimerEntityCommandSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ETimerEntityCommandType m_eType; // 0x0
@@ -16217,14 +15936,14 @@ static_assert(alignof(STimerEntityCommandSaveData) == 0x4, "Wrong alignment for
 class alignas(4) STimerEntityStateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const STimerEntityStateSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const STimerEntityStateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STimerEntityStateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -16241,14 +15960,12 @@ static_assert(alignof(STimerEntityStateSaveData) == 0x4, "Wrong alignment for ST
 class alignas(8) SGameTimersSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGameTimersSaveData& p_Other) const;
+	bool operator==(const SGameTimersSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGameTimersSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<STimerEntityCommandSaveData> m_aTimerEntityCommands; // 0x0
@@ -16265,14 +15982,14 @@ static_assert(alignof(SGameTimersSaveData) == 0x8, "Wrong alignment for SGameTim
 class alignas(4) SLightSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLightSaveData& p_Other) const;
+	bool operator==(const SLightSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLightSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -16293,14 +16010,14 @@ static_assert(alignof(SLightSaveData) == 0x4, "Wrong alignment for SLightSaveDat
 class alignas(4) SPostfilterParametersSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SPostfilterParametersSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SPostfilterParametersSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPostfilterParametersSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -16363,14 +16080,12 @@ static_assert(alignof(SPostfilterParametersSaveData) == 0x4, "Wrong alignment fo
 class alignas(8) SRenderMaterialSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRenderMaterialSaveData& p_Other) const;
+	bool operator==(const SRenderMaterialSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRenderMaterialSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -16387,14 +16102,14 @@ static_assert(alignof(SRenderMaterialSaveData) == 0x8, "Wrong alignment for SRen
 class alignas(4) SParticleEmitterSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SParticleEmitterSaveData& p_Other) const;
+	bool operator==(const SParticleEmitterSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SParticleEmitterSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -16417,14 +16132,14 @@ static_assert(alignof(SParticleEmitterSaveData) == 0x4, "Wrong alignment for SPa
 class alignas(4) SGateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGateSaveData& p_Other) const;
+	bool operator==(const SGateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -16441,14 +16156,12 @@ static_assert(alignof(SGateSaveData) == 0x4, "Wrong alignment for SGateSaveData"
 class alignas(8) SGameplayRenderablesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGameplayRenderablesSaveData& p_Other) const;
+	bool operator==(const SGameplayRenderablesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGameplayRenderablesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SLightSaveData> m_aLightData; // 0x0
@@ -16471,14 +16184,14 @@ static_assert(alignof(SGameplayRenderablesSaveData) == 0x8, "Wrong alignment for
 class alignas(4) SGeomScaleSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SGeomScaleSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SGeomScaleSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGeomScaleSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 m_vPrimitiveScale; // 0x0
@@ -16491,14 +16204,12 @@ static_assert(alignof(SGeomScaleSaveData) == 0x4, "Wrong alignment for SGeomScal
 class alignas(16) SGetHelpGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGetHelpGroupSaveData& p_Other) const;
+	bool operator==(const SGetHelpGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGetHelpGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float4 m_vLastKnownTargetPosition; // 0x0
@@ -16541,14 +16252,14 @@ static_assert(alignof(SGetHelpGroupSaveData) == 0x10, "Wrong alignment for SGetH
 class alignas(4) SGetHelpOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGetHelpOrderSaveData& p_Other) const;
+	bool operator==(const SGetHelpOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGetHelpOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	EAISharedEventType m_helpType; // 0x0
@@ -16563,14 +16274,14 @@ static_assert(alignof(SGetHelpOrderSaveData) == 0x4, "Wrong alignment for SGetHe
 class alignas(4) SHelpingActorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SHelpingActorSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SHelpingActorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHelpingActorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_HelpTargetKnowledgeIndex; // 0x0
@@ -16585,14 +16296,12 @@ static_assert(alignof(SHelpingActorSaveData) == 0x4, "Wrong alignment for SHelpi
 class alignas(8) SGetHelpServiceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGetHelpServiceSaveData& p_Other) const;
+	bool operator==(const SGetHelpServiceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGetHelpServiceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SHelpingActorSaveData> m_aHelpingActors; // 0x0
@@ -16605,14 +16314,14 @@ static_assert(alignof(SGetHelpServiceSaveData) == 0x8, "Wrong alignment for SGet
 class alignas(4) SGuardBodySituationMemberSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGuardBodySituationMemberSaveData& p_Other) const;
+	bool operator==(const SGuardBodySituationMemberSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGuardBodySituationMemberSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bSearchingForMorgue; // 0x0
@@ -16631,14 +16340,14 @@ static_assert(alignof(SGuardBodySituationMemberSaveData) == 0x4, "Wrong alignmen
 class alignas(4) SGuardBodySituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGuardBodySituationSaveData& p_Other) const;
+	bool operator==(const SGuardBodySituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGuardBodySituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bBystanderFieldsFailed; // 0x0
@@ -16659,14 +16368,14 @@ static_assert(alignof(SGuardBodySituationSaveData) == 0x4, "Wrong alignment for
 class alignas(4) SGuardPointOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SGuardPointOrderSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SGuardPointOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGuardPointOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_guardPoint; // 0x0
@@ -16681,14 +16390,14 @@ static_assert(alignof(SGuardPointOrderSaveData) == 0x4, "Wrong alignment for SGu
 class alignas(1) SHM5CrippleBoxSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHM5CrippleBoxSaveData& p_Other) const;
+	bool operator==(const SHM5CrippleBoxSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHM5CrippleBoxSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bInSequence; // 0x0
@@ -16807,14 +16516,14 @@ static_assert(alignof(SHM5CrippleBoxSaveData) == 0x1, "Wrong alignment for SHM5C
 class alignas(1) SHUDPIPControllerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHUDPIPControllerSaveData& p_Other) const;
+	bool operator==(const SHUDPIPControllerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHUDPIPControllerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bPiPEnabled; // 0x0
@@ -16827,14 +16536,12 @@ static_assert(alignof(SHUDPIPControllerSaveData) == 0x1, "Wrong alignment for SH
 class alignas(8) SHUDPromptDisplayInfo
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHUDPromptDisplayInfo& p_Other) const;
+	bool operator==(const SHUDPromptDisplayInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHUDPromptDisplayInfo& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bActive; // 0x0
@@ -16877,14 +16584,12 @@ static_assert(alignof(SHUDPromptDisplayInfo) == 0x8, "Wrong alignment for SHUDPr
 class alignas(8) SHUDPromptDisplayInfoArray_Dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHUDPromptDisplayInfoArray_Dummy& p_Other) const;
+	bool operator==(const SHUDPromptDisplayInfoArray_Dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHUDPromptDisplayInfoArray_Dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SHUDPromptDisplayInfo> dummy; // 0x0
@@ -16897,14 +16602,14 @@ static_assert(alignof(SHUDPromptDisplayInfoArray_Dummy) == 0x8, "Wrong alignment
 class alignas(4) SHUDTimerControllerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SHUDTimerControllerSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SHUDTimerControllerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHUDTimerControllerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_pCurrentInstance; // 0x0
@@ -16962,14 +16667,14 @@ public:
 class alignas(4) SHUDVisibilityController2SaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHUDVisibilityController2SaveData& p_Other) const;
+	bool operator==(const SHUDVisibilityController2SaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHUDVisibilityController2SaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZHUDUIRoot::EHUDVisibility m_eCurrentRequest; // 0x0
@@ -16982,14 +16687,14 @@ static_assert(alignof(SHUDVisibilityController2SaveData) == 0x4, "Wrong alignmen
 class alignas(4) SHandleDistractionSituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHandleDistractionSituationSaveData& p_Other) const;
+	bool operator==(const SHandleDistractionSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHandleDistractionSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_pLeader; // 0x0
@@ -17006,14 +16711,14 @@ static_assert(alignof(SHandleDistractionSituationSaveData) == 0x4, "Wrong alignm
 class alignas(4) SHeroCameraStandInSaveState
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SHeroCameraStandInSaveState& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SHeroCameraStandInSaveState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHeroCameraStandInSaveState& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rHero; // 0x0
@@ -17055,14 +16760,14 @@ public:
 class alignas(4) SHeroEscortSituation2ActorStateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHeroEscortSituation2ActorStateSaveData& p_Other) const;
+	bool operator==(const SHeroEscortSituation2ActorStateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHeroEscortSituation2ActorStateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nID; // 0x0
@@ -17087,14 +16792,14 @@ static_assert(alignof(SHeroEscortSituation2ActorStateSaveData) == 0x4, "Wrong al
 class alignas(4) SHeroEscortSituation2Actors
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SHeroEscortSituation2Actors& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SHeroEscortSituation2Actors& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHeroEscortSituation2Actors& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -17134,14 +16839,14 @@ public:
 class alignas(4) SHeroEscortSituationActorStateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHeroEscortSituationActorStateSaveData& p_Other) const;
+	bool operator==(const SHeroEscortSituationActorStateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHeroEscortSituationActorStateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nID; // 0x0
@@ -17166,14 +16871,14 @@ static_assert(alignof(SHeroEscortSituationActorStateSaveData) == 0x4, "Wrong ali
 class alignas(4) SHeroEscortSituationActors
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHeroEscortSituationActors& p_Other) const;
+	bool operator==(const SHeroEscortSituationActors& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHeroEscortSituationActors& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -17186,14 +16891,14 @@ static_assert(alignof(SHeroEscortSituationActors) == 0x4, "Wrong alignment for S
 class alignas(4) SHeroItemActionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SHeroItemActionSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SHeroItemActionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHeroItemActionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rItem; // 0x0
@@ -17206,14 +16911,14 @@ static_assert(alignof(SHeroItemActionSaveData) == 0x4, "Wrong alignment for SHer
 class alignas(4) SHeroItemAttachmentSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHeroItemAttachmentSaveData& p_Other) const;
+	bool operator==(const SHeroItemAttachmentSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHeroItemAttachmentSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rItem; // 0x0
@@ -17226,14 +16931,14 @@ static_assert(alignof(SHeroItemAttachmentSaveData) == 0x4, "Wrong alignment for
 class alignas(4) SHeroStandInSaveState
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHeroStandInSaveState& p_Other) const;
+	bool operator==(const SHeroStandInSaveState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHeroStandInSaveState& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rHero; // 0x0
@@ -17250,14 +16955,14 @@ static_assert(alignof(SHeroStandInSaveState) == 0x4, "Wrong alignment for SHeroS
 class alignas(4) SHintEntrySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SHintEntrySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SHintEntrySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHintEntrySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsValid; // 0x0
@@ -17274,14 +16979,12 @@ static_assert(alignof(SHintEntrySaveData) == 0x4, "Wrong alignment for SHintEntr
 class alignas(8) SHintManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHintManagerSaveData& p_Other) const;
+	bool operator==(const SHintManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHintManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SHintEntrySaveData m_activeHint; // 0x0
@@ -17298,14 +17001,14 @@ static_assert(alignof(SHintManagerSaveData) == 0x8, "Wrong alignment for SHintMa
 class alignas(8) SHudMissionTimerControllerData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHudMissionTimerControllerData& p_Other) const;
+	bool operator==(const SHudMissionTimerControllerData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHudMissionTimerControllerData& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_fScoreGameTimeStart; // 0x0
@@ -17320,14 +17023,12 @@ static_assert(alignof(SHudMissionTimerControllerData) == 0x8, "Wrong alignment f
 class alignas(8) SIntelData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SIntelData& p_Other) const;
+	bool operator==(const SIntelData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SIntelData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sHeadline; // 0x0
@@ -17346,14 +17047,12 @@ static_assert(alignof(SIntelData) == 0x8, "Wrong alignment for SIntelData");
 class alignas(8) SIntelDataArray_dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SIntelDataArray_dummy& p_Other) const;
+	bool operator==(const SIntelDataArray_dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SIntelDataArray_dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SIntelData> dummy; // 0x0
@@ -17366,14 +17065,12 @@ static_assert(alignof(SIntelDataArray_dummy) == 0x8, "Wrong alignment for SIntel
 class alignas(8) SIntelDisplayInfo
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SIntelDisplayInfo& p_Other) const;
+	bool operator==(const SIntelDisplayInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SIntelDisplayInfo& p_Other) const { return !(*this == p_Other); }
 
 	int32 index; // 0x0
@@ -17398,14 +17095,12 @@ static_assert(alignof(SIntelDisplayInfo) == 0x8, "Wrong alignment for SIntelDisp
 class alignas(8) SIntelDisplayInfoArray_dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SIntelDisplayInfoArray_dummy& p_Other) const;
+	bool operator==(const SIntelDisplayInfoArray_dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SIntelDisplayInfoArray_dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SIntelDisplayInfo> dummy; // 0x0
@@ -17418,14 +17113,12 @@ static_assert(alignof(SIntelDisplayInfoArray_dummy) == 0x8, "Wrong alignment for
 class alignas(8) SIntelListDisplayInfo
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SIntelListDisplayInfo& p_Other) const;
+	bool operator==(const SIntelListDisplayInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SIntelListDisplayInfo& p_Other) const { return !(*this == p_Other); }
 
 	int32 index; // 0x0
@@ -17444,14 +17137,12 @@ static_assert(alignof(SIntelListDisplayInfo) == 0x8, "Wrong alignment for SIntel
 class alignas(8) SIntelListDisplayInfoArray_dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SIntelListDisplayInfoArray_dummy& p_Other) const;
+	bool operator==(const SIntelListDisplayInfoArray_dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SIntelListDisplayInfoArray_dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SIntelListDisplayInfo> dummy; // 0x0
@@ -17464,14 +17155,14 @@ static_assert(alignof(SIntelListDisplayInfoArray_dummy) == 0x8, "Wrong alignment
 class alignas(4) SIntelSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SIntelSaveData& p_Other) const;
+	bool operator==(const SIntelSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SIntelSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rCurrentStage; // 0x0
@@ -17496,14 +17187,12 @@ static_assert(alignof(SIntelSaveData) == 0x4, "Wrong alignment for SIntelSaveDat
 class alignas(8) SInteractionIndicatorInstanceData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SInteractionIndicatorInstanceData& p_Other) const;
+	bool operator==(const SInteractionIndicatorInstanceData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SInteractionIndicatorInstanceData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_eState; // 0x0
@@ -17562,14 +17251,12 @@ static_assert(alignof(SInteractionIndicatorInstanceData) == 0x8, "Wrong alignmen
 class alignas(8) SInteractionIndicatorInstanceDataArray_Dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SInteractionIndicatorInstanceDataArray_Dummy& p_Other) const;
+	bool operator==(const SInteractionIndicatorInstanceDataArray_Dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SInteractionIndicatorInstanceDataArray_Dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SInteractionIndicatorInstanceData> dummy; // 0x0
@@ -17582,14 +17269,14 @@ static_assert(alignof(SInteractionIndicatorInstanceDataArray_Dummy) == 0x8, "Wro
 class alignas(4) SInventoryControllerItemSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SInventoryControllerItemSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SInventoryControllerItemSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SInventoryControllerItemSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rItemEntity; // 0x0
@@ -17604,14 +17291,14 @@ static_assert(alignof(SInventoryControllerItemSaveData) == 0x4, "Wrong alignment
 class alignas(4) SStoredSlotSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SStoredSlotSaveData& p_Other) const;
+	bool operator==(const SStoredSlotSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SStoredSlotSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_iStoredInventorySlotIndex; // 0x0
@@ -17628,14 +17315,12 @@ static_assert(alignof(SStoredSlotSaveData) == 0x4, "Wrong alignment for SStoredS
 class alignas(8) SInventoryControllerSlotSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SInventoryControllerSlotSaveData& p_Other) const;
+	bool operator==(const SInventoryControllerSlotSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SInventoryControllerSlotSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SInventoryControllerItemSaveData> m_aItems; // 0x0
@@ -17650,14 +17335,14 @@ static_assert(alignof(SInventoryControllerSlotSaveData) == 0x8, "Wrong alignment
 class alignas(16) SInventoryMovementConfig
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SInventoryMovementConfig& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SInventoryMovementConfig& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SInventoryMovementConfig& p_Other) const { return !(*this == p_Other); }
 
 	EInventoryConfigItemHandling m_eItemHandlingRightHand; // 0x0
@@ -17703,14 +17388,14 @@ public:
 	class alignas(4) SDialogLines
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SDialogLines& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SDialogLines& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SDialogLines& p_Other) const { return !(*this == p_Other); }
 
 		EActorSoundDefs m_eFirstWarning; // 0x0
@@ -17741,14 +17426,14 @@ public:
 	class alignas(16) SMoveToOrderSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SMoveToOrderSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SMoveToOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SMoveToOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 		float4 m_vStopDirection; // 0x0
@@ -17787,14 +17472,14 @@ public:
 class alignas(16) SInvestigateDisguiseGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SInvestigateDisguiseGroupSaveData& p_Other) const;
+	bool operator==(const SInvestigateDisguiseGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SInvestigateDisguiseGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZInvestigateDisguiseGroup::EState m_state; // 0x0
@@ -17851,14 +17536,12 @@ static_assert(alignof(SInvestigateDisguiseGroupSaveData) == 0x10, "Wrong alignme
 class alignas(8) SInvestigateWeaponGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SInvestigateWeaponGroupSaveData& p_Other) const;
+	bool operator==(const SInvestigateWeaponGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SInvestigateWeaponGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rTarget; // 0x0
@@ -17885,14 +17568,12 @@ static_assert(alignof(SInvestigateWeaponGroupSaveData) == 0x8, "Wrong alignment
 class alignas(4) SItemLeftHandUIData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SItemLeftHandUIData& p_Other) const;
+	bool operator==(const SItemLeftHandUIData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemLeftHandUIData& p_Other) const { return !(*this == p_Other); }
 
 	ZRuntimeResourceID icon; // 0x0
@@ -17913,14 +17594,12 @@ static_assert(alignof(SItemLeftHandUIData) == 0x4, "Wrong alignment for SItemLef
 class alignas(4) SItemOnBackUIData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SItemOnBackUIData& p_Other) const;
+	bool operator==(const SItemOnBackUIData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemOnBackUIData& p_Other) const { return !(*this == p_Other); }
 
 	ZRuntimeResourceID icon; // 0x0
@@ -17941,14 +17620,14 @@ static_assert(alignof(SItemOnBackUIData) == 0x4, "Wrong alignment for SItemOnBac
 class alignas(1) SItemSpawnerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SItemSpawnerSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SItemSpawnerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemSpawnerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bItemUpdateTransformChange; // 0x0
@@ -17961,14 +17640,12 @@ static_assert(alignof(SItemSpawnerSaveData) == 0x1, "Wrong alignment for SItemSp
 class alignas(8) SItemStorageSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SItemStorageSaveData& p_Other) const;
+	bool operator==(const SItemStorageSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemStorageSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_Storage; // 0x0
@@ -17983,14 +17660,12 @@ static_assert(alignof(SItemStorageSaveData) == 0x8, "Wrong alignment for SItemSt
 class alignas(8) SItemWeaponSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SItemWeaponSaveData& p_Other) const;
+	bool operator==(const SItemWeaponSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemWeaponSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_magazineBulletsByAmmoType; // 0x0
@@ -18009,14 +17684,14 @@ static_assert(alignof(SItemWeaponSaveData) == 0x8, "Wrong alignment for SItemWea
 class alignas(4) SKeywordSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SKeywordSaveData& p_Other) const;
+	bool operator==(const SKeywordSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SKeywordSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_HolderSaveableId; // 0x0
@@ -18031,14 +17706,14 @@ static_assert(alignof(SKeywordSaveData) == 0x4, "Wrong alignment for SKeywordSav
 class alignas(1) SLayerBehaviorConfiguration
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLayerBehaviorConfiguration& p_Other) const;
+	bool operator==(const SLayerBehaviorConfiguration& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLayerBehaviorConfiguration& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bTrigger; // 0x0
@@ -18079,14 +17754,14 @@ public:
 class alignas(4) SLeadEscortSituationActorStateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SLeadEscortSituationActorStateSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SLeadEscortSituationActorStateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLeadEscortSituationActorStateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nID; // 0x0
@@ -18111,14 +17786,14 @@ static_assert(alignof(SLeadEscortSituationActorStateSaveData) == 0x4, "Wrong ali
 class alignas(4) SLeadEscortSituationActors
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLeadEscortSituationActors& p_Other) const;
+	bool operator==(const SLeadEscortSituationActors& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLeadEscortSituationActors& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -18131,14 +17806,12 @@ static_assert(alignof(SLeadEscortSituationActors) == 0x4, "Wrong alignment for S
 class alignas(8) SLeadEscortSituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLeadEscortSituationSaveData& p_Other) const;
+	bool operator==(const SLeadEscortSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLeadEscortSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bActivated; // 0x0
@@ -18179,14 +17852,12 @@ static_assert(alignof(SLeadEscortSituationSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SLevelReferenceableEntitieSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLevelReferenceableEntitieSaveData& p_Other) const;
+	bool operator==(const SLevelReferenceableEntitieSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLevelReferenceableEntitieSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sSceneResource; // 0x0
@@ -18201,14 +17872,12 @@ static_assert(alignof(SLevelReferenceableEntitieSaveData) == 0x8, "Wrong alignme
 class alignas(8) SObjetiveSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SObjetiveSaveData& p_Other) const;
+	bool operator==(const SObjetiveSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SObjetiveSaveData& p_Other) const { return !(*this == p_Other); }
 
 	IContractObjective::Type m_eType; // 0x0
@@ -18223,14 +17892,14 @@ static_assert(alignof(SObjetiveSaveData) == 0x8, "Wrong alignment for SObjetiveS
 class alignas(4) SSoundAmbienceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SSoundAmbienceSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SSoundAmbienceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSoundAmbienceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rCurrentAmbience; // 0x0
@@ -18251,14 +17920,14 @@ static_assert(alignof(SSoundAmbienceSaveData) == 0x4, "Wrong alignment for SSoun
 class alignas(1) SLightFlickerEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLightFlickerEntitySaveData& p_Other) const;
+	bool operator==(const SLightFlickerEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLightFlickerEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bLightOn; // 0x0
@@ -18273,14 +17942,12 @@ static_assert(alignof(SLightFlickerEntitySaveData) == 0x1, "Wrong alignment for
 class alignas(8) SLoadRuntimeResourceResult
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLoadRuntimeResourceResult& p_Other) const;
+	bool operator==(const SLoadRuntimeResourceResult& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLoadRuntimeResourceResult& p_Other) const { return !(*this == p_Other); }
 
 	ZString sFilePath; // 0x0
@@ -18293,14 +17960,12 @@ static_assert(alignof(SLoadRuntimeResourceResult) == 0x8, "Wrong alignment for S
 class alignas(8) SLocalizedVideoData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLocalizedVideoData& p_Other) const;
+	bool operator==(const SLocalizedVideoData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLocalizedVideoData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<ZString> AudioLanguages; // 0x0
@@ -18319,14 +17984,14 @@ static_assert(alignof(SLocalizedVideoData) == 0x8, "Wrong alignment for SLocaliz
 class alignas(8) SLockdownManagerAIZoneSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLockdownManagerAIZoneSaveData& p_Other) const;
+	bool operator==(const SLockdownManagerAIZoneSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLockdownManagerAIZoneSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_tExpiry; // 0x0
@@ -18343,14 +18008,12 @@ static_assert(alignof(SLockdownManagerAIZoneSaveData) == 0x8, "Wrong alignment f
 class alignas(8) SLockdownManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLockdownManagerSaveData& p_Other) const;
+	bool operator==(const SLockdownManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLockdownManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SLockdownManagerAIZoneSaveData> m_aAIZones; // 0x0
@@ -18363,14 +18026,12 @@ static_assert(alignof(SLockdownManagerSaveData) == 0x8, "Wrong alignment for SLo
 class alignas(8) SManHuntServiceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SManHuntServiceSaveData& p_Other) const;
+	bool operator==(const SManHuntServiceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SManHuntServiceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint16> m_rGuardNodes; // 0x0
@@ -18387,14 +18048,12 @@ static_assert(alignof(SManHuntServiceSaveData) == 0x8, "Wrong alignment for SMan
 class alignas(8) SMapMarkerData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMapMarkerData& p_Other) const;
+	bool operator==(const SMapMarkerData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMapMarkerData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SVector2> pathPoints; // 0x0
@@ -18407,14 +18066,14 @@ static_assert(alignof(SMapMarkerData) == 0x8, "Wrong alignment for SMapMarkerDat
 class alignas(4) SMathDistanceSaveData_SVector2
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMathDistanceSaveData_SVector2& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMathDistanceSaveData_SVector2& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathDistanceSaveData_SVector2& p_Other) const { return !(*this == p_Other); }
 
 	SVector2 m_fA; // 0x0
@@ -18429,14 +18088,14 @@ static_assert(alignof(SMathDistanceSaveData_SVector2) == 0x4, "Wrong alignment f
 class alignas(4) SMathDistanceSaveData_SVector3
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathDistanceSaveData_SVector3& p_Other) const;
+	bool operator==(const SMathDistanceSaveData_SVector3& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathDistanceSaveData_SVector3& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_fA; // 0x0
@@ -18451,14 +18110,14 @@ static_assert(alignof(SMathDistanceSaveData_SVector3) == 0x4, "Wrong alignment f
 class alignas(4) SMathDistanceSaveData_SVector4
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMathDistanceSaveData_SVector4& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMathDistanceSaveData_SVector4& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathDistanceSaveData_SVector4& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 m_fA; // 0x0
@@ -18473,14 +18132,14 @@ static_assert(alignof(SMathDistanceSaveData_SVector4) == 0x4, "Wrong alignment f
 class alignas(4) SMatrix33
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMatrix33& p_Other) const;
+	bool operator==(const SMatrix33& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMatrix33& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 XAxis; // 0x0
@@ -18497,14 +18156,14 @@ static_assert(alignof(SMatrix33) == 0x4, "Wrong alignment for SMatrix33");
 class alignas(4) SMatrix44
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMatrix44& p_Other) const;
+	bool operator==(const SMatrix44& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMatrix44& p_Other) const { return !(*this == p_Other); }
 
 	float32 m11; // 0x0
@@ -18547,14 +18206,14 @@ static_assert(alignof(SMatrix44) == 0x4, "Wrong alignment for SMatrix44");
 class alignas(4) SMovementAgilitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMovementAgilitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMovementAgilitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementAgilitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rLedgeGuide; // 0x0
@@ -18577,14 +18236,14 @@ static_assert(alignof(SMovementAgilitySaveData) == 0x4, "Wrong alignment for SMo
 class alignas(16) SMovementCoverSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMovementCoverSaveData& p_Other) const;
+	bool operator==(const SMovementCoverSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementCoverSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rCoverPlane; // 0x0
@@ -18605,14 +18264,14 @@ static_assert(alignof(SMovementCoverSaveData) == 0x10, "Wrong alignment for SMov
 class alignas(4) SMovementDisguiseSafeZoneSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMovementDisguiseSafeZoneSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMovementDisguiseSafeZoneSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementDisguiseSafeZoneSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rSafeZone; // 0x0
@@ -18627,14 +18286,14 @@ static_assert(alignof(SMovementDisguiseSafeZoneSaveData) == 0x4, "Wrong alignmen
 class alignas(4) SMovementDragBodySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMovementDragBodySaveData& p_Other) const;
+	bool operator==(const SMovementDragBodySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementDragBodySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rDraggedActor; // 0x0
@@ -18649,14 +18308,14 @@ static_assert(alignof(SMovementDragBodySaveData) == 0x4, "Wrong alignment for SM
 class alignas(4) SMovementDrainPipeSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMovementDrainPipeSaveData& p_Other) const;
+	bool operator==(const SMovementDrainPipeSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementDrainPipeSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rDrainPipe; // 0x0
@@ -18669,14 +18328,14 @@ static_assert(alignof(SMovementDrainPipeSaveData) == 0x4, "Wrong alignment for S
 class alignas(4) SMovementHideInClosetSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMovementHideInClosetSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMovementHideInClosetSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementHideInClosetSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ICloset::EClosetType m_eCurrentClosetType; // 0x0
@@ -18691,14 +18350,14 @@ static_assert(alignof(SMovementHideInClosetSaveData) == 0x4, "Wrong alignment fo
 class alignas(4) SMovementLadderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMovementLadderSaveData& p_Other) const;
+	bool operator==(const SMovementLadderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementLadderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rLadder; // 0x0
@@ -18711,14 +18370,14 @@ static_assert(alignof(SMovementLadderSaveData) == 0x4, "Wrong alignment for SMov
 class alignas(1) SMovementLocomotionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMovementLocomotionSaveData& p_Other) const;
+	bool operator==(const SMovementLocomotionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementLocomotionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsSneaking; // 0x0
@@ -18731,14 +18390,14 @@ static_assert(alignof(SMovementLocomotionSaveData) == 0x1, "Wrong alignment for
 class alignas(4) SMusicGridData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMusicGridData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMusicGridData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMusicGridData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fGridDurationSec; // 0x0
@@ -18753,14 +18412,12 @@ static_assert(alignof(SMusicGridData) == 0x4, "Wrong alignment for SMusicGridDat
 class alignas(8) SObserversGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SObserversGroupSaveData& p_Other) const;
+	bool operator==(const SObserversGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SObserversGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_target; // 0x0
@@ -18777,14 +18434,12 @@ static_assert(alignof(SObserversGroupSaveData) == 0x8, "Wrong alignment for SObs
 class alignas(8) SOnlineEvent
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SOnlineEvent& p_Other) const;
+	bool operator==(const SOnlineEvent& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SOnlineEvent& p_Other) const { return !(*this == p_Other); }
 
 	ZString sName; // 0x0
@@ -18799,14 +18454,12 @@ static_assert(alignof(SOnlineEvent) == 0x8, "Wrong alignment for SOnlineEvent");
 class alignas(8) SOnlineSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SOnlineSaveData& p_Other) const;
+	bool operator==(const SOnlineSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SOnlineSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sName; // 0x0
@@ -18827,14 +18480,12 @@ static_assert(alignof(SOnlineSaveData) == 0x8, "Wrong alignment for SOnlineSaveD
 class alignas(8) SOptionValueSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SOptionValueSaveData& p_Other) const;
+	bool operator==(const SOptionValueSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SOptionValueSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZVariant m_Value; // 0x0
@@ -18847,14 +18498,14 @@ static_assert(alignof(SOptionValueSaveData) == 0x8, "Wrong alignment for SOption
 class alignas(1) SPFObstactleSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPFObstactleSaveData& p_Other) const;
+	bool operator==(const SPFObstactleSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPFObstactleSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -18867,14 +18518,14 @@ static_assert(alignof(SPFObstactleSaveData) == 0x1, "Wrong alignment for SPFObst
 class alignas(1) SPIPMessageManagerProxySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPIPMessageManagerProxySaveData& p_Other) const;
+	bool operator==(const SPIPMessageManagerProxySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPIPMessageManagerProxySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -18887,14 +18538,12 @@ static_assert(alignof(SPIPMessageManagerProxySaveData) == 0x1, "Wrong alignment
 class alignas(8) SPackedAnimSetEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPackedAnimSetEntry& p_Other) const;
+	bool operator==(const SPackedAnimSetEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPackedAnimSetEntry& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sName; // 0x0
@@ -18911,14 +18560,14 @@ static_assert(alignof(SPackedAnimSetEntry) == 0x8, "Wrong alignment for SPackedA
 class alignas(4) SPatrolGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SPatrolGroupSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SPatrolGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPatrolGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nRouteID; // 0x0
@@ -18931,14 +18580,14 @@ static_assert(alignof(SPatrolGroupSaveData) == 0x4, "Wrong alignment for SPatrol
 class alignas(4) SPerceptibleCrowdBodySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPerceptibleCrowdBodySaveData& p_Other) const;
+	bool operator==(const SPerceptibleCrowdBodySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPerceptibleCrowdBodySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rCombatZone; // 0x0
@@ -18953,14 +18602,12 @@ static_assert(alignof(SPerceptibleCrowdBodySaveData) == 0x4, "Wrong alignment fo
 class alignas(8) SPersistentEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPersistentEntitySaveData& p_Other) const;
+	bool operator==(const SPersistentEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPersistentEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint64 m_nResourceId; // 0x0
@@ -18977,14 +18624,12 @@ static_assert(alignof(SPersistentEntitySaveData) == 0x8, "Wrong alignment for SP
 class alignas(8) SPersistentEntitySaveDataList
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPersistentEntitySaveDataList& p_Other) const;
+	bool operator==(const SPersistentEntitySaveDataList& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPersistentEntitySaveDataList& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SPersistentEntitySaveData> m_aEntityDatas; // 0x0
@@ -19001,14 +18646,14 @@ static_assert(alignof(SPersistentEntitySaveDataList) == 0x8, "Wrong alignment fo
 class alignas(1) SPhysicsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SPhysicsSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SPhysicsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPhysicsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsInPhysicsWorld; // 0x0
@@ -19025,14 +18670,12 @@ static_assert(alignof(SPhysicsSaveData) == 0x1, "Wrong alignment for SPhysicsSav
 class alignas(8) SPhysicsListSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPhysicsListSaveData& p_Other) const;
+	bool operator==(const SPhysicsListSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPhysicsListSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntityRefs; // 0x0
@@ -19047,14 +18690,14 @@ static_assert(alignof(SPhysicsListSaveData) == 0x8, "Wrong alignment for SPhysic
 class alignas(16) SPrivateAreaSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPrivateAreaSaveData& p_Other) const;
+	bool operator==(const SPrivateAreaSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPrivateAreaSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsInside; // 0x0
@@ -19077,14 +18720,14 @@ static_assert(alignof(SPrivateAreaSaveData) == 0x10, "Wrong alignment for SPriva
 class alignas(4) SProgressTimerEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SProgressTimerEntitySaveData& p_Other) const;
+	bool operator==(const SProgressTimerEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SProgressTimerEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nInterval; // 0x0
@@ -19101,14 +18744,14 @@ static_assert(alignof(SProgressTimerEntitySaveData) == 0x4, "Wrong alignment for
 class alignas(4) SRandomTimerEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SRandomTimerEntitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SRandomTimerEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRandomTimerEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -19131,14 +18774,12 @@ static_assert(alignof(SRandomTimerEntitySaveData) == 0x4, "Wrong alignment for S
 class alignas(8) SRandomTimerEntitiesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRandomTimerEntitiesSaveData& p_Other) const;
+	bool operator==(const SRandomTimerEntitiesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRandomTimerEntitiesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -19153,14 +18794,12 @@ static_assert(alignof(SRandomTimerEntitiesSaveData) == 0x8, "Wrong alignment for
 class alignas(8) ZBitArray
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZBitArray& p_Other) const;
+	bool operator==(const ZBitArray& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZBitArray& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint8> m_aBytes; // 0x0
@@ -19175,14 +18814,12 @@ static_assert(alignof(ZBitArray) == 0x8, "Wrong alignment for ZBitArray");
 class alignas(16) SReasoningGrid
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SReasoningGrid& p_Other) const;
+	bool operator==(const SReasoningGrid& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SReasoningGrid& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SGWaypoint> m_WaypointList; // 0x0
@@ -19207,14 +18844,14 @@ static_assert(alignof(SReasoningGrid) == 0x10, "Wrong alignment for SReasoningGr
 class alignas(8) SRecoverUnconsciousGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRecoverUnconsciousGroupSaveData& p_Other) const;
+	bool operator==(const SRecoverUnconsciousGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRecoverUnconsciousGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -19239,14 +18876,14 @@ static_assert(alignof(SRecoverUnconsciousGroupSaveData) == 0x8, "Wrong alignment
 class alignas(1) SRemoteControlReceiverSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SRemoteControlReceiverSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SRemoteControlReceiverSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRemoteControlReceiverSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -19263,14 +18900,14 @@ static_assert(alignof(SRemoteControlReceiverSaveData) == 0x1, "Wrong alignment f
 class alignas(8) SRenderVideoPlayerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRenderVideoPlayerSaveData& p_Other) const;
+	bool operator==(const SRenderVideoPlayerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRenderVideoPlayerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bPlaying; // 0x0
@@ -19303,14 +18940,14 @@ static_assert(alignof(SRenderVideoPlayerSaveData) == 0x8, "Wrong alignment for S
 class alignas(1) SRepositionOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRepositionOrderSaveData& p_Other) const;
+	bool operator==(const SRepositionOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRepositionOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bStrafe; // 0x0
@@ -19325,14 +18962,14 @@ static_assert(alignof(SRepositionOrderSaveData) == 0x1, "Wrong alignment for SRe
 class alignas(4) SRotateEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SRotateEntitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SRotateEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRotateEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -19351,14 +18988,14 @@ static_assert(alignof(SRotateEntitySaveData) == 0x4, "Wrong alignment for SRotat
 class alignas(1) SSCCuriousConfiguration
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSCCuriousConfiguration& p_Other) const;
+	bool operator==(const SSCCuriousConfiguration& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSCCuriousConfiguration& p_Other) const { return !(*this == p_Other); }
 
 	bool m_CanGuardsInvestigate; // 0x0
@@ -19375,14 +19012,12 @@ static_assert(alignof(SSCCuriousConfiguration) == 0x1, "Wrong alignment for SSCC
 class alignas(8) SSavableData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSavableData& p_Other) const;
+	bool operator==(const SSavableData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSavableData& p_Other) const { return !(*this == p_Other); }
 
 	ZVariant m_EntitiesData; // 0x0
@@ -19399,14 +19034,12 @@ static_assert(alignof(SSavableData) == 0x8, "Wrong alignment for SSavableData");
 class alignas(8) SVariantStruct
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVariantStruct& p_Other) const;
+	bool operator==(const SVariantStruct& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVariantStruct& p_Other) const { return !(*this == p_Other); }
 
 	ZVariant m_Data; // 0x0
@@ -19419,14 +19052,12 @@ static_assert(alignof(SVariantStruct) == 0x8, "Wrong alignment for SVariantStruc
 class alignas(8) SSavableEntitiesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSavableEntitiesSaveData& p_Other) const;
+	bool operator==(const SSavableEntitiesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSavableEntitiesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -19441,14 +19072,12 @@ static_assert(alignof(SSavableEntitiesSaveData) == 0x8, "Wrong alignment for SSa
 class alignas(8) SSaveGameData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSaveGameData& p_Other) const;
+	bool operator==(const SSaveGameData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSaveGameData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nVersion; // 0x0
@@ -19465,14 +19094,12 @@ static_assert(alignof(SSaveGameData) == 0x8, "Wrong alignment for SSaveGameData"
 class alignas(8) SSaveGameMetaData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSaveGameMetaData& p_Other) const;
+	bool operator==(const SSaveGameMetaData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSaveGameMetaData& p_Other) const { return !(*this == p_Other); }
 
 	uint8 nSlot; // 0x0
@@ -19507,14 +19134,12 @@ static_assert(alignof(SSaveGameMetaData) == 0x8, "Wrong alignment for SSaveGameM
 class alignas(8) SSaveGameHeader
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSaveGameHeader& p_Other) const;
+	bool operator==(const SSaveGameHeader& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSaveGameHeader& p_Other) const { return !(*this == p_Other); }
 
 	uint32 nFourCC; // 0x0
@@ -19537,14 +19162,12 @@ static_assert(alignof(SSaveGameHeader) == 0x8, "Wrong alignment for SSaveGameHea
 class alignas(8) SScreenplay2ManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SScreenplay2ManagerSaveData& p_Other) const;
+	bool operator==(const SScreenplay2ManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SScreenplay2ManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SDramaActorCollectionSaveData m_DramaActorData; // 0x0
@@ -19567,14 +19190,12 @@ static_assert(alignof(SScreenplay2ManagerSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SScreenplayManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SScreenplayManagerSaveData& p_Other) const;
+	bool operator==(const SScreenplayManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SScreenplayManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SDramaActorCollectionSaveData m_DramaActorData; // 0x0
@@ -19591,14 +19212,14 @@ static_assert(alignof(SScreenplayManagerSaveData) == 0x8, "Wrong alignment for S
 class alignas(4) SScreenplayRole2HeroSaveState
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SScreenplayRole2HeroSaveState& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SScreenplayRole2HeroSaveState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SScreenplayRole2HeroSaveState& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rCurrentSpeakEntity; // 0x0
@@ -19613,14 +19234,14 @@ static_assert(alignof(SScreenplayRole2HeroSaveState) == 0x4, "Wrong alignment fo
 class alignas(2) SSecuritySystemCameraSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSecuritySystemCameraSaveData& p_Other) const;
+	bool operator==(const SSecuritySystemCameraSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSecuritySystemCameraSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint16 m_nEscalation; // 0x0
@@ -19641,14 +19262,14 @@ static_assert(alignof(SSecuritySystemCameraSaveData) == 0x2, "Wrong alignment fo
 class alignas(1) SSecuritySystemRecorderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSecuritySystemRecorderSaveData& p_Other) const;
+	bool operator==(const SSecuritySystemRecorderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSecuritySystemRecorderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bHasRecordings; // 0x0
@@ -19663,14 +19284,14 @@ static_assert(alignof(SSecuritySystemRecorderSaveData) == 0x1, "Wrong alignment
 class alignas(8) SSentryGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SSentryGroupSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SSentryGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSentryGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rTarget; // 0x0
@@ -19697,14 +19318,14 @@ static_assert(alignof(SSentryGroupSaveData) == 0x8, "Wrong alignment for SSentry
 class alignas(4) SSentryOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSentryOrderSaveData& p_Other) const;
+	bool operator==(const SSentryOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSentryOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rSentryZone; // 0x0
@@ -19717,14 +19338,12 @@ static_assert(alignof(SSentryOrderSaveData) == 0x4, "Wrong alignment for SSentry
 class alignas(8) SSentryZoneSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSentryZoneSaveData& p_Other) const;
+	bool operator==(const SSentryZoneSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSentryZoneSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_tGreetingCooldown; // 0x0
@@ -19789,14 +19408,12 @@ static_assert(alignof(SSentryZoneSaveData) == 0x8, "Wrong alignment for SSentryZ
 class alignas(8) SSequenceTrackSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSequenceTrackSaveData& p_Other) const;
+	bool operator==(const SSequenceTrackSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSequenceTrackSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rTrackEntity; // 0x0
@@ -19811,14 +19428,12 @@ static_assert(alignof(SSequenceTrackSaveData) == 0x8, "Wrong alignment for SSequ
 class alignas(8) SSequenceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSequenceSaveData& p_Other) const;
+	bool operator==(const SSequenceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSequenceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<ZSequenceEntity::ECommand> m_commandQueue; // 0x0
@@ -19853,14 +19468,12 @@ static_assert(alignof(SSequenceSaveData) == 0x8, "Wrong alignment for SSequenceS
 class alignas(8) SSequenceManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSequenceManagerSaveData& p_Other) const;
+	bool operator==(const SSequenceManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSequenceManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -19875,14 +19488,12 @@ static_assert(alignof(SSequenceManagerSaveData) == 0x8, "Wrong alignment for SSe
 class alignas(8) SSituationConversationGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSituationConversationGroupSaveData& p_Other) const;
+	bool operator==(const SSituationConversationGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSituationConversationGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_members; // 0x0
@@ -19895,14 +19506,12 @@ static_assert(alignof(SSituationConversationGroupSaveData) == 0x8, "Wrong alignm
 class alignas(16) SSituationOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSituationOrderSaveData& p_Other) const;
+	bool operator==(const SSituationOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSituationOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sClassTypeName; // 0x0
@@ -19942,14 +19551,14 @@ public:
 class alignas(4) SSmuggleSituationActorStateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSmuggleSituationActorStateSaveData& p_Other) const;
+	bool operator==(const SSmuggleSituationActorStateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSmuggleSituationActorStateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -19974,14 +19583,12 @@ static_assert(alignof(SSmuggleSituationActorStateSaveData) == 0x4, "Wrong alignm
 class alignas(8) SSmuggleSituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSmuggleSituationSaveData& p_Other) const;
+	bool operator==(const SSmuggleSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSmuggleSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsEnabled; // 0x0
@@ -20002,14 +19609,14 @@ static_assert(alignof(SSmuggleSituationSaveData) == 0x8, "Wrong alignment for SS
 class alignas(8) SSniperCombatGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SSniperCombatGroupSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SSniperCombatGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSniperCombatGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -20030,14 +19637,12 @@ static_assert(alignof(SSniperCombatGroupSaveData) == 0x8, "Wrong alignment for S
 class alignas(8) SSniperScoringEvent
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSniperScoringEvent& p_Other) const;
+	bool operator==(const SSniperScoringEvent& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSniperScoringEvent& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_iPoints; // 0x0
@@ -20060,14 +19665,14 @@ static_assert(alignof(SSniperScoringEvent) == 0x8, "Wrong alignment for SSniperS
 class alignas(1) SSpaceCollectionBehaviorConfiguration
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSpaceCollectionBehaviorConfiguration& p_Other) const;
+	bool operator==(const SSpaceCollectionBehaviorConfiguration& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSpaceCollectionBehaviorConfiguration& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bInclusive; // 0x0
@@ -20080,14 +19685,14 @@ static_assert(alignof(SSpaceCollectionBehaviorConfiguration) == 0x1, "Wrong alig
 class alignas(4) SSpatialMoverEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSpatialMoverEntitySaveData& p_Other) const;
+	bool operator==(const SSpatialMoverEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSpatialMoverEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fSpeed; // 0x0
@@ -20108,14 +19713,14 @@ static_assert(alignof(SSpatialMoverEntitySaveData) == 0x4, "Wrong alignment for
 class alignas(4) SSpatialSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SSpatialSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SSpatialSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSpatialSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bVisible; // 0x0
@@ -20132,14 +19737,14 @@ static_assert(alignof(SSpatialSaveData) == 0x4, "Wrong alignment for SSpatialSav
 class alignas(4) SSpeakEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSpeakEntitySaveData& p_Other) const;
+	bool operator==(const SSpeakEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSpeakEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fSeekPosition; // 0x0
@@ -20152,14 +19757,14 @@ static_assert(alignof(SSpeakEntitySaveData) == 0x4, "Wrong alignment for SSpeakE
 class alignas(4) SStateControllerSaveDataStruct
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SStateControllerSaveDataStruct& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SStateControllerSaveDataStruct& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SStateControllerSaveDataStruct& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nIndex; // 0x0
@@ -20174,14 +19779,12 @@ static_assert(alignof(SStateControllerSaveDataStruct) == 0x4, "Wrong alignment f
 class alignas(8) SStateControllerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SStateControllerSaveData& p_Other) const;
+	bool operator==(const SStateControllerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SStateControllerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -20196,14 +19799,14 @@ static_assert(alignof(SStateControllerSaveData) == 0x8, "Wrong alignment for SSt
 class alignas(4) SStepCounterEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SStepCounterEntitySaveData& p_Other) const;
+	bool operator==(const SStepCounterEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SStepCounterEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_nIndex; // 0x0
@@ -20228,14 +19831,12 @@ static_assert(alignof(SStepCounterEntitySaveData) == 0x4, "Wrong alignment for S
 class alignas(8) STargetInfoObjectiveCondition
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STargetInfoObjectiveCondition& p_Other) const;
+	bool operator==(const STargetInfoObjectiveCondition& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STargetInfoObjectiveCondition& p_Other) const { return !(*this == p_Other); }
 
 	ZString header; // 0x0
@@ -20256,14 +19857,12 @@ static_assert(alignof(STargetInfoObjectiveCondition) == 0x8, "Wrong alignment fo
 class alignas(8) STargetInfoDisplayData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STargetInfoDisplayData& p_Other) const;
+	bool operator==(const STargetInfoDisplayData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STargetInfoDisplayData& p_Other) const { return !(*this == p_Other); }
 
 	ZString npcName; // 0x0
@@ -20290,14 +19889,12 @@ static_assert(alignof(STargetInfoDisplayData) == 0x8, "Wrong alignment for STarg
 class alignas(8) STargetInfoDisplayData_Dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STargetInfoDisplayData_Dummy& p_Other) const;
+	bool operator==(const STargetInfoDisplayData_Dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STargetInfoDisplayData_Dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<STargetInfoDisplayData> __dummy; // 0x0
@@ -20310,14 +19907,14 @@ static_assert(alignof(STargetInfoDisplayData_Dummy) == 0x8, "Wrong alignment for
 class alignas(16) STargetTrackingSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STargetTrackingSaveData& p_Other) const;
+	bool operator==(const STargetTrackingSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STargetTrackingSaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_sharedTarget; // 0x0
@@ -20334,14 +19931,12 @@ static_assert(alignof(STargetTrackingSaveData) == 0x10, "Wrong alignment for STa
 class alignas(8) STargetTrackingServiceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STargetTrackingServiceSaveData& p_Other) const;
+	bool operator==(const STargetTrackingServiceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STargetTrackingServiceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<STargetTrackingSaveData> m_aTrackedTargets; // 0x0
@@ -20354,14 +19949,14 @@ static_assert(alignof(STargetTrackingServiceSaveData) == 0x8, "Wrong alignment f
 class alignas(4) STargetableBoneConfiguration
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const STargetableBoneConfiguration& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const STargetableBoneConfiguration& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STargetableBoneConfiguration& p_Other) const { return !(*this == p_Other); }
 
 	BoneId::Enum m_eBone; // 0x0
@@ -20376,14 +19971,12 @@ static_assert(alignof(STargetableBoneConfiguration) == 0x4, "Wrong alignment for
 class alignas(8) STemplateBlueprintSubEntity
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STemplateBlueprintSubEntity& p_Other) const;
+	bool operator==(const STemplateBlueprintSubEntity& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STemplateBlueprintSubEntity& p_Other) const { return !(*this == p_Other); }
 
 	SEntityTemplateReference logicalParent; // 0x0
@@ -20412,14 +20005,12 @@ static_assert(alignof(STemplateBlueprintSubEntity) == 0x8, "Wrong alignment for
 class alignas(8) STemplateEntityBlueprint
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STemplateEntityBlueprint& p_Other) const;
+	bool operator==(const STemplateEntityBlueprint& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STemplateEntityBlueprint& p_Other) const { return !(*this == p_Other); }
 
 	int32 subType; // 0x0
@@ -20450,14 +20041,12 @@ static_assert(alignof(STemplateEntityBlueprint) == 0x8, "Wrong alignment for STe
 class alignas(8) STemplateFactorySubEntity
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STemplateFactorySubEntity& p_Other) const;
+	bool operator==(const STemplateFactorySubEntity& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STemplateFactorySubEntity& p_Other) const { return !(*this == p_Other); }
 
 	SEntityTemplateReference logicalParent; // 0x0
@@ -20476,14 +20065,12 @@ static_assert(alignof(STemplateFactorySubEntity) == 0x8, "Wrong alignment for ST
 class alignas(8) STemplateEntityFactory
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STemplateEntityFactory& p_Other) const;
+	bool operator==(const STemplateEntityFactory& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STemplateEntityFactory& p_Other) const { return !(*this == p_Other); }
 
 	int32 subType; // 0x0
@@ -20515,14 +20102,12 @@ public:
 
 
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STestStruct& p_Other) const;
+	bool operator==(const STestStruct& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STestStruct& p_Other) const { return !(*this == p_Other); }
 
 	ZString stringField; // 0x0
@@ -20541,14 +20126,12 @@ static_assert(alignof(STestStruct) == 0x8, "Wrong alignment for STestStruct");
 class alignas(8) STestStruct2
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STestStruct2& p_Other) const;
+	bool operator==(const STestStruct2& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STestStruct2& p_Other) const { return !(*this == p_Other); }
 
 	TArray<STestStruct> arrayField; // 0x0
@@ -20563,14 +20146,14 @@ static_assert(alignof(STestStruct2) == 0x8, "Wrong alignment for STestStruct2");
 class alignas(4) STimerEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STimerEntitySaveData& p_Other) const;
+	bool operator==(const STimerEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STimerEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nInterval; // 0x0
@@ -20587,14 +20170,12 @@ static_assert(alignof(STimerEntitySaveData) == 0x4, "Wrong alignment for STimerE
 class alignas(8) STimerEntitiesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STimerEntitiesSaveData& p_Other) const;
+	bool operator==(const STimerEntitiesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STimerEntitiesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -20609,14 +20190,12 @@ static_assert(alignof(STimerEntitiesSaveData) == 0x8, "Wrong alignment for STime
 class alignas(8) STimerManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STimerManagerSaveData& p_Other) const;
+	bool operator==(const STimerManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STimerManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	STimerEntitiesSaveData m_TimersData; // 0x0
@@ -20633,14 +20212,14 @@ static_assert(alignof(STimerManagerSaveData) == 0x8, "Wrong alignment for STimer
 class alignas(4) STokenID
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const STokenID& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const STokenID& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STokenID& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_iValue; // 0x0
@@ -20655,14 +20234,14 @@ static_assert(alignof(STokenID) == 0x4, "Wrong alignment for STokenID");
 class alignas(4) STrackDollyControllerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STrackDollyControllerSaveData& p_Other) const;
+	bool operator==(const STrackDollyControllerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STrackDollyControllerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rTrackEntity; // 0x0
@@ -20683,14 +20262,14 @@ static_assert(alignof(STrackDollyControllerSaveData) == 0x4, "Wrong alignment fo
 class alignas(4) STrackerEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STrackerEntitySaveData& p_Other) const;
+	bool operator==(const STrackerEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STrackerEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rTracker; // 0x0
@@ -20709,14 +20288,12 @@ static_assert(alignof(STrackerEntitySaveData) == 0x4, "Wrong alignment for STrac
 class alignas(8) STrackerManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STrackerManagerSaveData& p_Other) const;
+	bool operator==(const STrackerManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STrackerManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<STrackerEntitySaveData> m_aTrackerData; // 0x0
@@ -20729,14 +20306,14 @@ static_assert(alignof(STrackerManagerSaveData) == 0x8, "Wrong alignment for STra
 class alignas(16) STrajectoryTrackSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const STrajectoryTrackSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const STrajectoryTrackSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STrajectoryTrackSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SMatrix m_vOriginalEntityTransform; // 0x0
@@ -20751,14 +20328,12 @@ static_assert(alignof(STrajectoryTrackSaveData) == 0x10, "Wrong alignment for ST
 class alignas(8) STrespassingRuleEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STrespassingRuleEntitySaveData& p_Other) const;
+	bool operator==(const STrespassingRuleEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STrespassingRuleEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<bool> m_aAllowedProfessionsDisabled; // 0x0
@@ -20771,14 +20346,14 @@ static_assert(alignof(STrespassingRuleEntitySaveData) == 0x8, "Wrong alignment f
 class alignas(8) STriggerAlarmGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STriggerAlarmGroupSaveData& p_Other) const;
+	bool operator==(const STriggerAlarmGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STriggerAlarmGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rTarget; // 0x0
@@ -20799,14 +20374,14 @@ static_assert(alignof(STriggerAlarmGroupSaveData) == 0x8, "Wrong alignment for S
 class alignas(4) SUIBreadcrumbDataSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SUIBreadcrumbDataSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SUIBreadcrumbDataSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SUIBreadcrumbDataSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fProgress; // 0x0
@@ -20821,14 +20396,14 @@ static_assert(alignof(SUIBreadcrumbDataSaveData) == 0x4, "Wrong alignment for SU
 class alignas(4) SUIGridCellPosition
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SUIGridCellPosition& p_Other) const;
+	bool operator==(const SUIGridCellPosition& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SUIGridCellPosition& p_Other) const { return !(*this == p_Other); }
 
 	int32 nColumnIndex; // 0x0
@@ -20956,14 +20531,12 @@ enum class _EUIOptionKey : int32_t
 class alignas(8) SUIOptionsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SUIOptionsSaveData& p_Other) const;
+	bool operator==(const SUIOptionsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SUIOptionsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<_EUIOptionKey> m_aKeys; // 0x0
@@ -20990,14 +20563,12 @@ public:
 	class alignas(8) SSubSubStruct
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSubSubStruct& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSubSubStruct& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSubSubStruct& p_Other) const { return !(*this == p_Other); }
 
 		ZString sDeepString; // 0x0
@@ -21010,14 +20581,12 @@ public:
 	class alignas(8) SSubStruct
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSubStruct& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSubStruct& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSubStruct& p_Other) const { return !(*this == p_Other); }
 
 		TArray<SUITestData::SSubSubStruct> aSubSubStructs; // 0x0
@@ -21028,14 +20597,12 @@ public:
 
 
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SUITestData& p_Other) const;
+	bool operator==(const SUITestData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SUITestData& p_Other) const { return !(*this == p_Other); }
 
 	int32 nIntProp; // 0x0
@@ -21066,14 +20633,14 @@ static_assert(alignof(SUITestData) == 0x8, "Wrong alignment for SUITestData");
 class alignas(4) SValueBoolDelayedEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SValueBoolDelayedEntitySaveData& p_Other) const;
+	bool operator==(const SValueBoolDelayedEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SValueBoolDelayedEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bValue; // 0x0
@@ -21090,14 +20657,12 @@ static_assert(alignof(SValueBoolDelayedEntitySaveData) == 0x4, "Wrong alignment
 class alignas(8) SValueBoolsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SValueBoolsSaveData& p_Other) const;
+	bool operator==(const SValueBoolsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SValueBoolsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -21112,14 +20677,12 @@ static_assert(alignof(SValueBoolsSaveData) == 0x8, "Wrong alignment for SValueBo
 class alignas(8) SValueFloatSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SValueFloatSaveData& p_Other) const;
+	bool operator==(const SValueFloatSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SValueFloatSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -21134,14 +20697,12 @@ static_assert(alignof(SValueFloatSaveData) == 0x8, "Wrong alignment for SValueFl
 class alignas(8) SValueIntSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SValueIntSaveData& p_Other) const;
+	bool operator==(const SValueIntSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SValueIntSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -21156,14 +20717,12 @@ static_assert(alignof(SValueIntSaveData) == 0x8, "Wrong alignment for SValueIntS
 class alignas(8) SValueSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SValueSaveData& p_Other) const;
+	bool operator==(const SValueSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SValueSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SValueBoolsSaveData m_ValueBool; // 0x0
@@ -21184,14 +20743,12 @@ static_assert(alignof(SValueSaveData) == 0x8, "Wrong alignment for SValueSaveDat
 class alignas(8) SVideoDatabaseEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVideoDatabaseEntry& p_Other) const;
+	bool operator==(const SVideoDatabaseEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVideoDatabaseEntry& p_Other) const { return !(*this == p_Other); }
 
 	ZString VideoId; // 0x0
@@ -21206,14 +20763,12 @@ static_assert(alignof(SVideoDatabaseEntry) == 0x8, "Wrong alignment for SVideoDa
 class alignas(8) SVideoDatabaseData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVideoDatabaseData& p_Other) const;
+	bool operator==(const SVideoDatabaseData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVideoDatabaseData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SVideoDatabaseEntry> Videos; // 0x0
@@ -21226,14 +20781,14 @@ static_assert(alignof(SVideoDatabaseData) == 0x8, "Wrong alignment for SVideoDat
 class alignas(1) SVisibilitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVisibilitySaveData& p_Other) const;
+	bool operator==(const SVisibilitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVisibilitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsVisible; // 0x0
@@ -21246,14 +20801,14 @@ static_assert(alignof(SVisibilitySaveData) == 0x1, "Wrong alignment for SVisibil
 class alignas(4) SVoidSignalEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SVoidSignalEntitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SVoidSignalEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVoidSignalEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bSignaling; // 0x0
@@ -21268,14 +20823,14 @@ static_assert(alignof(SVoidSignalEntitySaveData) == 0x4, "Wrong alignment for SV
 class alignas(4) SWaveformGeneratorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SWaveformGeneratorSaveData& p_Other) const;
+	bool operator==(const SWaveformGeneratorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SWaveformGeneratorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fTime; // 0x0
@@ -21298,14 +20853,12 @@ static_assert(alignof(SWaveformGeneratorSaveData) == 0x4, "Wrong alignment for S
 class alignas(8) SWaveformGeneratorManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SWaveformGeneratorManagerSaveData& p_Other) const;
+	bool operator==(const SWaveformGeneratorManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SWaveformGeneratorManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aGenerators; // 0x0
@@ -21320,14 +20873,14 @@ static_assert(alignof(SWaveformGeneratorManagerSaveData) == 0x8, "Wrong alignmen
 class alignas(4) SWeaponCustomControlSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SWeaponCustomControlSaveData& p_Other) const;
+	bool operator==(const SWeaponCustomControlSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SWeaponCustomControlSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -21344,14 +20897,12 @@ static_assert(alignof(SWeaponCustomControlSaveData) == 0x4, "Wrong alignment for
 class alignas(8) SWeaponStatusUIData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SWeaponStatusUIData& p_Other) const;
+	bool operator==(const SWeaponStatusUIData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SWeaponStatusUIData& p_Other) const { return !(*this == p_Other); }
 
 	ZRuntimeResourceID icon; // 0x0
@@ -21522,14 +21073,14 @@ public:
 	class alignas(8) SAIDistractionContextEntitySaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SAIDistractionContextEntitySaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SAIDistractionContextEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SAIDistractionContextEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 		uint32 m_DistractedActor; // 0x0
@@ -21562,14 +21113,12 @@ namespace ZAISoundEvent {
 class alignas(8) ZAMDEvent
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZAMDEvent& p_Other) const;
+	bool operator==(const ZAMDEvent& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZAMDEvent& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nEventID; // 0x0
@@ -21588,14 +21137,12 @@ static_assert(alignof(ZAMDEvent) == 0x8, "Wrong alignment for ZAMDEvent");
 class alignas(8) ZAMDEventTrack
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZAMDEventTrack& p_Other) const;
+	bool operator==(const ZAMDEventTrack& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZAMDEventTrack& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sName; // 0x0
@@ -21610,14 +21157,12 @@ static_assert(alignof(ZAMDEventTrack) == 0x8, "Wrong alignment for ZAMDEventTrac
 class alignas(8) ZAMDTake
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZAMDTake& p_Other) const;
+	bool operator==(const ZAMDTake& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZAMDTake& p_Other) const { return !(*this == p_Other); }
 
 	TArray<ZAMDEventTrack> m_eventTracks; // 0x0
@@ -21644,14 +21189,14 @@ public:
 	class alignas(4) SGeneratedFootstepEvent
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SGeneratedFootstepEvent& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SGeneratedFootstepEvent& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SGeneratedFootstepEvent& p_Other) const { return !(*this == p_Other); }
 
 		ZAT2Controller::EFoot m_eFoot; // 0x0
@@ -21675,14 +21220,12 @@ public:
 	class alignas(8) SEventPreviewInfo
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SEventPreviewInfo& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SEventPreviewInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SEventPreviewInfo& p_Other) const { return !(*this == p_Other); }
 
 		int32 m_nEventID; // 0x0
@@ -21944,14 +21487,14 @@ public:
 	class alignas(16) SApproachOrderSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SApproachOrderSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SApproachOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SApproachOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 		float4 m_vStopDirection; // 0x0
@@ -22019,14 +21562,12 @@ public:
 	class alignas(8) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		TArray<int32> m_aAvoidDangerousAreaGroups; // 0x0
@@ -22129,14 +21670,12 @@ public:
 class alignas(8) ZComponentCreator
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZComponentCreator& p_Other) const;
+	bool operator==(const ZComponentCreator& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZComponentCreator& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sComponentName; // 0x0
@@ -22275,14 +21814,14 @@ public:
 	class alignas(8) SState
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SState& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SState& p_Other) const { return !(*this == p_Other); }
 
 		ZDeadBodySituation::ESituationFlavor m_eFlavor; // 0x0
@@ -22313,14 +21852,14 @@ public:
 	class alignas(4) SIncidentSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SIncidentSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SIncidentSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SIncidentSaveData& p_Other) const { return !(*this == p_Other); }
 
 		uint32 m_body; // 0x0
@@ -22335,14 +21874,12 @@ public:
 	class alignas(8) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		ZDeadBodySituation::SState m_State; // 0x0
@@ -22507,14 +22044,14 @@ public:
 	class alignas(4) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		int32 m_pDetectedInPrivateGroup; // 0x0
@@ -22532,14 +22069,14 @@ public:
 	class alignas(4) SVisibilitySetting
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SVisibilitySetting& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SVisibilitySetting& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SVisibilitySetting& p_Other) const { return !(*this == p_Other); }
 
 		EActorPerceptionSensitivity m_eSensitivity; // 0x0
@@ -22575,14 +22112,12 @@ public:
 	class alignas(8) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		uint32 m_pLeader; // 0x0
@@ -22656,14 +22191,12 @@ public:
 class alignas(8) ZER64
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZER64& p_Other) const;
+	bool operator==(const ZER64& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZER64& p_Other) const { return !(*this == p_Other); }
 
 	uint64 m_nEntityID; // 0x0
@@ -22678,14 +22211,12 @@ static_assert(alignof(ZER64) == 0x8, "Wrong alignment for ZER64");
 class alignas(8) ZEntityID
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZEntityID& p_Other) const;
+	bool operator==(const ZEntityID& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZEntityID& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sStr; // 0x0
@@ -22711,14 +22242,12 @@ public:
 class alignas(8) ZEntityReference
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZEntityReference& p_Other) const;
+	bool operator==(const ZEntityReference& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZEntityReference& p_Other) const { return !(*this == p_Other); }
 
 	ZEntityID m_EntityID; // 0x0
@@ -22733,14 +22262,12 @@ static_assert(alignof(ZEntityReference) == 0x8, "Wrong alignment for ZEntityRefe
 class alignas(8) ZStringBuilder
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZStringBuilder& p_Other) const;
+	bool operator==(const ZStringBuilder& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZStringBuilder& p_Other) const { return !(*this == p_Other); }
 
 	TArray<char> m_chars; // 0x0
@@ -22753,14 +22280,12 @@ static_assert(alignof(ZStringBuilder) == 0x8, "Wrong alignment for ZStringBuilde
 class alignas(8) ZPath
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZPath& p_Other) const;
+	bool operator==(const ZPath& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZPath& p_Other) const { return !(*this == p_Other); }
 
 	ZStringBuilder m_value; // 0x0
@@ -22773,14 +22298,12 @@ static_assert(alignof(ZPath) == 0x8, "Wrong alignment for ZPath");
 class alignas(8) ZFilePath
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZFilePath& p_Other) const;
+	bool operator==(const ZFilePath& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZFilePath& p_Other) const { return !(*this == p_Other); }
 
 	ZPath m_path; // 0x0
@@ -22864,14 +22387,14 @@ public:
 	class alignas(16) SFormationMoveOrderSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SFormationMoveOrderSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SFormationMoveOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SFormationMoveOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 		float4 m_vStopDirection; // 0x0
@@ -22922,14 +22445,14 @@ public:
 	class alignas(4) SAgilityEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SAgilityEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SAgilityEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SAgilityEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5AgilityEventConsumer::EEvent m_nEvent; // 0x0
@@ -22972,14 +22495,14 @@ public:
 	class alignas(4) SBodySoundEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SBodySoundEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SBodySoundEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SBodySoundEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5BodySoundEventConsumer::EAnimSoundBody m_nEvent; // 0x0
@@ -22997,14 +22520,14 @@ public:
 	class alignas(4) SCloseCombatSoundEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SCloseCombatSoundEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SCloseCombatSoundEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SCloseCombatSoundEventData& p_Other) const { return !(*this == p_Other); }
 
 		EHM5SoundCloseCombatEvent m_nEvent; // 0x0
@@ -23057,14 +22580,14 @@ public:
 	class alignas(4) SCrowdSoundGenericEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SCrowdSoundGenericEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SCrowdSoundGenericEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SCrowdSoundGenericEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5CrowdGenericEventConsumer::EEvent m_nEvent; // 0x0
@@ -23113,14 +22636,14 @@ public:
 	class alignas(4) SFaceFXEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SFaceFXEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SFaceFXEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SFaceFXEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5FaceFXReactionEventConsumer::EEvent m_nEvent; // 0x0
@@ -23151,14 +22674,12 @@ public:
 	class alignas(8) SFaceFXEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SFaceFXEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SFaceFXEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SFaceFXEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5FaceFXSpecificEventConsumer::EEvent m_nEvent; // 0x0
@@ -23178,14 +22699,14 @@ public:
 	class alignas(4) SFootstepSoundEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SFootstepSoundEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SFootstepSoundEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SFootstepSoundEventData& p_Other) const { return !(*this == p_Other); }
 
 		EHM5SoundFootstepEvent m_nEvent; // 0x0
@@ -23228,14 +22749,14 @@ public:
 	class alignas(4) SGenericEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SGenericEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SGenericEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SGenericEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5GenericEventConsumer::EEvent m_nEvent; // 0x0
@@ -23269,14 +22790,14 @@ public:
 	class alignas(4) SZHM5HIKEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SZHM5HIKEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SZHM5HIKEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SZHM5HIKEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5HIKEventConsumer::EEffector m_nEffector; // 0x0
@@ -23358,14 +22879,14 @@ public:
 	class alignas(4) SItemInteractionEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SItemInteractionEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SItemInteractionEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SItemInteractionEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5ItemInteractionEventConsumer::EHM5SoundItemInteractionEvent m_nEvent; // 0x0
@@ -23426,14 +22947,14 @@ public:
 	class alignas(4) SWeaponEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SWeaponEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SWeaponEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SWeaponEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5WeaponEventConsumer::EAnimWeapon m_nEvent; // 0x0
@@ -23451,14 +22972,14 @@ public:
 	class alignas(1) SData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SData& p_Other) const { return !(*this == p_Other); }
 
 		bool bDisguiseBroken; // 0x0
@@ -23490,14 +23011,12 @@ public:
 	class alignas(8) SData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SData& p_Other) const { return !(*this == p_Other); }
 
 		ZString m_sTitleText; // 0x0
@@ -23517,14 +23036,12 @@ public:
 	class alignas(8) SData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SData& p_Other) const { return !(*this == p_Other); }
 
 		ZString m_sTitleText; // 0x0
@@ -23557,14 +23074,12 @@ public:
 	class alignas(8) SWeaponViewData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SWeaponViewData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SWeaponViewData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SWeaponViewData& p_Other) const { return !(*this == p_Other); }
 
 		SWeaponStatusUIData weaponStatus; // 0x0
@@ -23644,14 +23159,14 @@ public:
 	class alignas(1) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		bool m_bStandingDown; // 0x0
@@ -23774,14 +23289,14 @@ public:
 	class alignas(4) SInteractionEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SInteractionEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SInteractionEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SInteractionEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZInteractionEventConsumer::EEvent m_nEvent; // 0x0
@@ -23820,14 +23335,14 @@ public:
 	class alignas(8) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		int32 m_nCurrentState; // 0x0
@@ -23851,14 +23366,14 @@ public:
 	class alignas(16) SJumpToOrderSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SJumpToOrderSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SJumpToOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SJumpToOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 		float4 m_vStopDirection; // 0x0
@@ -23878,14 +23393,12 @@ public:
 	class alignas(8) SCollection
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SCollection& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SCollection& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SCollection& p_Other) const { return !(*this == p_Other); }
 
 		TArray<int32> aKeywords; // 0x0
@@ -24177,14 +23690,14 @@ public:
 	class alignas(4) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		uint32 m_rVictim; // 0x0
@@ -24254,14 +23767,14 @@ public:
 class alignas(8) ZRuntimePinConDesc
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const ZRuntimePinConDesc& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const ZRuntimePinConDesc& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZRuntimePinConDesc& p_Other) const { return !(*this == p_Other); }
 
 	uint64 m_nFromEntityID; // 0x0
@@ -24280,14 +23793,12 @@ static_assert(alignof(ZRuntimePinConDesc) == 0x8, "Wrong alignment for ZRuntimeP
 class alignas(8) ZScopedER64
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZScopedER64& p_Other) const;
+	bool operator==(const ZScopedER64& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZScopedER64& p_Other) const { return !(*this == p_Other); }
 
 	ZER64 m_er64; // 0x0
@@ -24302,14 +23813,12 @@ static_assert(alignof(ZScopedER64) == 0x8, "Wrong alignment for ZScopedER64");
 class alignas(8) ZScopedRuntimePinConDesc
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZScopedRuntimePinConDesc& p_Other) const;
+	bool operator==(const ZScopedRuntimePinConDesc& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZScopedRuntimePinConDesc& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint64> m_aScopePath; // 0x0
@@ -24334,14 +23843,14 @@ public:
 	class alignas(4) SHitmanVisibleEscalationRule
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SHitmanVisibleEscalationRule& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SHitmanVisibleEscalationRule& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SHitmanVisibleEscalationRule& p_Other) const { return !(*this == p_Other); }
 
 		int32 m_NrGuardsToSend; // 0x0
@@ -24356,14 +23865,14 @@ public:
 	class alignas(4) SDeadBodyVisibleEscalationRule
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SDeadBodyVisibleEscalationRule& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SDeadBodyVisibleEscalationRule& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SDeadBodyVisibleEscalationRule& p_Other) const { return !(*this == p_Other); }
 
 		int32 m_NrGuardsToSend; // 0x0
@@ -24381,14 +23890,12 @@ public:
 	class alignas(8) SIconData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SIconData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SIconData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SIconData& p_Other) const { return !(*this == p_Other); }
 
 		ZString iCategory; // 0x0
@@ -24444,14 +23951,14 @@ public:
 	class alignas(16) SSniperSuspiciousArea
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSniperSuspiciousArea& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSniperSuspiciousArea& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSniperSuspiciousArea& p_Other) const { return !(*this == p_Other); }
 
 		float4 m_vPosition; // 0x0
@@ -24476,14 +23983,12 @@ public:
 	class alignas(8) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		uint32 m_rSniperLocation; // 0x0
@@ -24523,14 +24028,12 @@ public:
 	class alignas(8) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		bool m_bStandingDown; // 0x0
@@ -24591,14 +24094,14 @@ public:
 	class alignas(16) SState
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SState& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SState& p_Other) const { return !(*this == p_Other); }
 
 		ZStandOffSituation::ESituationState m_eSituationState; // 0x0
@@ -24671,14 +24174,12 @@ public:
 	class alignas(16) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		ZStandOffSituation::SState m_State; // 0x0
@@ -24733,14 +24234,14 @@ public:
 class alignas(8) ZTime
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const ZTime& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const ZTime& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZTime& p_Other) const { return !(*this == p_Other); }
 
 	uint64 m_nValue; // 0x0
@@ -24777,14 +24278,14 @@ public:
 	class alignas(8) SState
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SState& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SState& p_Other) const { return !(*this == p_Other); }
 
 		ZTrespassingSituation::ESituationState m_eSituationState; // 0x0
@@ -24805,14 +24306,14 @@ public:
 	class alignas(16) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		ZTrespassingSituation::SState m_State; // 0x0
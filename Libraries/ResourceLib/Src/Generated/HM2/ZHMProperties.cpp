@@ -9,9 +9,12 @@
 #include <Util/BinaryStreamReader.h>
 
 std::unordered_map<uint32_t, std::string_view>* ZHMProperties::g_Properties = nullptr;
+std::once_flag ZHMProperties::g_PropertiesRegistered;
 
 std::string ZHMProperties::PropertyToString(uint32_t p_PropertyId)
 {
+	std::call_once(g_PropertiesRegistered, RegisterProperties);
+
 	auto it = g_Properties->find(p_PropertyId);
 
 	if (it == g_Properties->end())
@@ -22,6 +25,8 @@ std::string ZHMProperties::PropertyToString(uint32_t p_PropertyId)
 
 std::string_view ZHMProperties::PropertyToStringView(uint32_t p_PropertyId)
 {
+	std::call_once(g_PropertiesRegistered, RegisterProperties);
+
 	auto it = g_Properties->find(p_PropertyId);
 
 	if (it == g_Properties->end())
@@ -50,5 +55,3 @@ void ZHMProperties::RegisterProperties()
 	}
 }
 
-ZHMPropertyRegistrar g_PropertyRegistrar = ZHMPropertyRegistrar();
-
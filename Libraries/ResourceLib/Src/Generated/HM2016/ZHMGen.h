@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <ZHM/ZHMPrimitives.h>
 #include <ZHM/ZHMTypeInfo.h>
+#include <ZHM/ZHMTypeTables.h>
 
 class ZHMTypeInfo;
 
@@ -18,14 +19,14 @@ namespace AnimationEventDataTypes {
 	class alignas(4) SBlend
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SBlend& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SBlend& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SBlend& p_Other) const { return !(*this == p_Other); }
 
 		float32 m_fBlendTime; // 0x0
@@ -38,14 +39,14 @@ namespace AnimationEventDataTypes {
 	class alignas(4) SLegacy
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SLegacy& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SLegacy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SLegacy& p_Other) const { return !(*this == p_Other); }
 
 		int32 m_nEventID; // 0x0
@@ -60,14 +61,12 @@ namespace AnimationEventDataTypes {
 class alignas(4) ZRuntimeResourceID
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZRuntimeResourceID& p_Other) const;
+	bool operator==(const ZRuntimeResourceID& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZRuntimeResourceID& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_IDHigh; // 0x0
@@ -83,14 +82,12 @@ namespace AnimationTakeDataTypes {
 	class alignas(4) SGeneric
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SGeneric& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SGeneric& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SGeneric& p_Other) const { return !(*this == p_Other); }
 
 		float32 m_fTest; // 0x0
@@ -5024,14 +5021,14 @@ enum class EWeaponUpgradeUse : int32_t
 class alignas(4) SVector3
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SVector3& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SVector3& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVector3& p_Other) const { return !(*this == p_Other); }
 
 	float32 x; // 0x0
@@ -5048,14 +5045,14 @@ static_assert(alignof(SVector3) == 0x4, "Wrong alignment for SVector3");
 class alignas(4) SMatrix43
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMatrix43& p_Other) const;
+	bool operator==(const SMatrix43& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMatrix43& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 XAxis; // 0x0
@@ -5114,14 +5111,14 @@ public:
 class alignas(8) ZGuid
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZGuid& p_Other) const;
+	bool operator==(const ZGuid& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZGuid& p_Other) const { return !(*this == p_Other); }
 
 	uint32 _a; // 0x0
@@ -5603,14 +5600,14 @@ namespace MenuWeaponUpgradeData {
 class alignas(4) S25DProjectionSettings
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const S25DProjectionSettings& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const S25DProjectionSettings& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const S25DProjectionSettings& p_Other) const { return !(*this == p_Other); }
 
 	float32 fNearDistance; // 0x0
@@ -5641,14 +5638,14 @@ static_assert(alignof(S25DProjectionSettings) == 0x4, "Wrong alignment for S25DP
 class alignas(4) S3rdPersonCameraSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const S3rdPersonCameraSaveData& p_Other) const;
+	bool operator==(const S3rdPersonCameraSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const S3rdPersonCameraSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fAngleYaw; // 0x0
@@ -5663,14 +5660,14 @@ static_assert(alignof(S3rdPersonCameraSaveData) == 0x4, "Wrong alignment for S3r
 class alignas(8) ZGameTime
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const ZGameTime& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const ZGameTime& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZGameTime& p_Other) const { return !(*this == p_Other); }
 
 	int64 m_nTicks; // 0x0
@@ -5683,14 +5680,14 @@ static_assert(alignof(ZGameTime) == 0x8, "Wrong alignment for ZGameTime");
 class alignas(8) SAIEventSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAIEventSaveData& p_Other) const;
+	bool operator==(const SAIEventSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAIEventSaveData& p_Other) const { return !(*this == p_Other); }
 
 	EAIEventType m_eType; // 0x0
@@ -5709,14 +5706,14 @@ static_assert(alignof(SAIEventSaveData) == 0x8, "Wrong alignment for SAIEventSav
 class alignas(4) SAIModifierServiceActorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAIModifierServiceActorSaveData& p_Other) const;
+	bool operator==(const SAIModifierServiceActorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAIModifierServiceActorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActorRef; // 0x0
@@ -5749,14 +5746,12 @@ static_assert(alignof(SAIModifierServiceActorSaveData) == 0x4, "Wrong alignment
 class alignas(8) SAIModifierServiceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAIModifierServiceSaveData& p_Other) const;
+	bool operator==(const SAIModifierServiceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAIModifierServiceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bFullVolumeUpdate; // 0x0
@@ -5771,14 +5766,14 @@ static_assert(alignof(SAIModifierServiceSaveData) == 0x8, "Wrong alignment for S
 class alignas(1) SAIPerceptibleEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SAIPerceptibleEntitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SAIPerceptibleEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAIPerceptibleEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bPerceptibleEnabled; // 0x0
@@ -5791,14 +5786,14 @@ static_assert(alignof(SAIPerceptibleEntitySaveData) == 0x1, "Wrong alignment for
 class alignas(1) SAIVisionBlockerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAIVisionBlockerSaveData& p_Other) const;
+	bool operator==(const SAIVisionBlockerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAIVisionBlockerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -5811,14 +5806,14 @@ static_assert(alignof(SAIVisionBlockerSaveData) == 0x1, "Wrong alignment for SAI
 class alignas(4) SAccessoryItemSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SAccessoryItemSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SAccessoryItemSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAccessoryItemSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -5849,14 +5844,14 @@ public:
 class alignas(4) SColorRGB
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SColorRGB& p_Other) const;
+	bool operator==(const SColorRGB& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SColorRGB& p_Other) const { return !(*this == p_Other); }
 
 	float32 r; // 0x0
@@ -5915,14 +5910,14 @@ public:
 class alignas(8) SActBehaviorEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActBehaviorEntitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActBehaviorEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActBehaviorEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bStartedSignalSent; // 0x0
@@ -5941,14 +5936,14 @@ static_assert(alignof(SActBehaviorEntitySaveData) == 0x8, "Wrong alignment for S
 class alignas(16) float4
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const float4& p_Other) const;
+	bool operator==(const float4& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const float4& p_Other) const { return !(*this == p_Other); }
 
 	float32 x; // 0x0
@@ -5967,14 +5962,12 @@ static_assert(alignof(float4) == 0x10, "Wrong alignment for float4");
 class alignas(16) SActOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActOrderSaveData& p_Other) const;
+	bool operator==(const SActOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sAct; // 0x0
@@ -5999,14 +5992,12 @@ static_assert(alignof(SActOrderSaveData) == 0x10, "Wrong alignment for SActOrder
 class alignas(8) SActionRadialArcDisplayInfo
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActionRadialArcDisplayInfo& p_Other) const;
+	bool operator==(const SActionRadialArcDisplayInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActionRadialArcDisplayInfo& p_Other) const { return !(*this == p_Other); }
 
 	bool hidden; // 0x0
@@ -6029,14 +6020,12 @@ static_assert(alignof(SActionRadialArcDisplayInfo) == 0x8, "Wrong alignment for
 class alignas(8) SActionRadialArcDisplayInfoArray_dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActionRadialArcDisplayInfoArray_dummy& p_Other) const;
+	bool operator==(const SActionRadialArcDisplayInfoArray_dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActionRadialArcDisplayInfoArray_dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SActionRadialArcDisplayInfo> dummy; // 0x0
@@ -6049,14 +6038,14 @@ static_assert(alignof(SActionRadialArcDisplayInfoArray_dummy) == 0x8, "Wrong ali
 class alignas(4) SActorAccessoryItemActionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActorAccessoryItemActionSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActorAccessoryItemActionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorAccessoryItemActionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -6069,14 +6058,14 @@ static_assert(alignof(SActorAccessoryItemActionSaveData) == 0x4, "Wrong alignmen
 class alignas(4) SActorAnimSetSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorAnimSetSaveData& p_Other) const;
+	bool operator==(const SActorAnimSetSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorAnimSetSaveData& p_Other) const { return !(*this == p_Other); }
 
 	EAnimSetType m_eAnimSet; // 0x0
@@ -6099,14 +6088,14 @@ static_assert(alignof(SActorAnimSetSaveData) == 0x4, "Wrong alignment for SActor
 class alignas(4) SActorBoneAttachSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorBoneAttachSaveData& p_Other) const;
+	bool operator==(const SActorBoneAttachSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorBoneAttachSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rAttachmentTarget; // 0x0
@@ -6121,14 +6110,12 @@ static_assert(alignof(SActorBoneAttachSaveData) == 0x4, "Wrong alignment for SAc
 class alignas(8) SActorBoneAttachmentsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorBoneAttachmentsSaveData& p_Other) const;
+	bool operator==(const SActorBoneAttachmentsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorBoneAttachmentsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -6143,14 +6130,14 @@ static_assert(alignof(SActorBoneAttachmentsSaveData) == 0x8, "Wrong alignment fo
 class alignas(4) SVector4
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SVector4& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SVector4& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVector4& p_Other) const { return !(*this == p_Other); }
 
 	float32 x; // 0x0
@@ -6169,14 +6156,14 @@ static_assert(alignof(SVector4) == 0x4, "Wrong alignment for SVector4");
 class alignas(4) SActorBoneSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorBoneSaveData& p_Other) const;
+	bool operator==(const SActorBoneSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorBoneSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 mQuaterion; // 0x0
@@ -6610,14 +6597,14 @@ public:
 class alignas(4) SActorDynamicTemplateHandlerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActorDynamicTemplateHandlerSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActorDynamicTemplateHandlerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorDynamicTemplateHandlerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -6634,14 +6621,14 @@ static_assert(alignof(SActorDynamicTemplateHandlerSaveData) == 0x4, "Wrong align
 class alignas(4) SActorDynamicTemplateManipulatorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorDynamicTemplateManipulatorSaveData& p_Other) const;
+	bool operator==(const SActorDynamicTemplateManipulatorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorDynamicTemplateManipulatorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -6654,14 +6641,12 @@ static_assert(alignof(SActorDynamicTemplateManipulatorSaveData) == 0x4, "Wrong a
 class alignas(8) SActorDynamicTemplateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorDynamicTemplateSaveData& p_Other) const;
+	bool operator==(const SActorDynamicTemplateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorDynamicTemplateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sName; // 0x0
@@ -6690,14 +6675,12 @@ static_assert(alignof(SActorDynamicTemplateSaveData) == 0x8, "Wrong alignment fo
 class alignas(8) SActorGoalSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorGoalSaveData& p_Other) const;
+	bool operator==(const SActorGoalSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorGoalSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<int32> m_aEntities; // 0x0
@@ -6716,14 +6699,14 @@ static_assert(alignof(SActorGoalSaveData) == 0x8, "Wrong alignment for SActorGoa
 class alignas(4) SActorInventoryItemSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorInventoryItemSaveData& p_Other) const;
+	bool operator==(const SActorInventoryItemSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorInventoryItemSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rItem; // 0x0
@@ -6744,14 +6727,12 @@ static_assert(alignof(SActorInventoryItemSaveData) == 0x4, "Wrong alignment for
 class alignas(8) SActorInventorySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorInventorySaveData& p_Other) const;
+	bool operator==(const SActorInventorySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorInventorySaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SActorInventoryItemSaveData> m_aItems; // 0x0
@@ -6764,14 +6745,14 @@ static_assert(alignof(SActorInventorySaveData) == 0x8, "Wrong alignment for SAct
 class alignas(4) SActorItemActionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActorItemActionSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActorItemActionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorItemActionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -6786,14 +6767,14 @@ static_assert(alignof(SActorItemActionSaveData) == 0x4, "Wrong alignment for SAc
 class alignas(4) SActorKeywordProxySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorKeywordProxySaveData& p_Other) const;
+	bool operator==(const SActorKeywordProxySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorKeywordProxySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -6806,14 +6787,12 @@ static_assert(alignof(SActorKeywordProxySaveData) == 0x4, "Wrong alignment for S
 class alignas(8) SActorKeywordProxiesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorKeywordProxiesSaveData& p_Other) const;
+	bool operator==(const SActorKeywordProxiesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorKeywordProxiesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -6828,14 +6807,12 @@ static_assert(alignof(SActorKeywordProxiesSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SActorManagerReferencableData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorManagerReferencableData& p_Other) const;
+	bool operator==(const SActorManagerReferencableData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorManagerReferencableData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<ESituationType> m_aSituationTypes; // 0x0
@@ -6848,14 +6825,14 @@ static_assert(alignof(SActorManagerReferencableData) == 0x8, "Wrong alignment fo
 class alignas(16) SMatrix
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMatrix& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMatrix& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMatrix& p_Other) const { return !(*this == p_Other); }
 
 	float4 XAxis; // 0x0
@@ -6874,14 +6851,14 @@ static_assert(alignof(SMatrix) == 0x10, "Wrong alignment for SMatrix");
 class alignas(8) SEventSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEventSaveData& p_Other) const;
+	bool operator==(const SEventSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEventSaveData& p_Other) const { return !(*this == p_Other); }
 
 	EAISharedEventType m_nType; // 0x0
@@ -6898,14 +6875,12 @@ static_assert(alignof(SEventSaveData) == 0x8, "Wrong alignment for SEventSaveDat
 class alignas(8) SSituationGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSituationGroupSaveData& p_Other) const;
+	bool operator==(const SSituationGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSituationGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sClassTypeName; // 0x0
@@ -6926,14 +6901,12 @@ static_assert(alignof(SSituationGroupSaveData) == 0x8, "Wrong alignment for SSit
 class alignas(8) SSituationMemberSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSituationMemberSaveData& p_Other) const;
+	bool operator==(const SSituationMemberSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSituationMemberSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -6958,14 +6931,12 @@ static_assert(alignof(SSituationMemberSaveData) == 0x8, "Wrong alignment for SSi
 class alignas(8) SSituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSituationSaveData& p_Other) const;
+	bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rSituation; // 0x0
@@ -6994,14 +6965,14 @@ static_assert(alignof(SSituationSaveData) == 0x8, "Wrong alignment for SSituatio
 class alignas(4) SActorProviderApproachSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorProviderApproachSaveData& p_Other) const;
+	bool operator==(const SActorProviderApproachSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorProviderApproachSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rCastActor; // 0x0
@@ -7014,14 +6985,12 @@ static_assert(alignof(SActorProviderApproachSaveData) == 0x4, "Wrong alignment f
 class alignas(16) SKnownEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SKnownEntitySaveData& p_Other) const;
+	bool operator==(const SKnownEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SKnownEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nSharedIndex; // 0x0
@@ -7046,14 +7015,12 @@ static_assert(alignof(SKnownEntitySaveData) == 0x10, "Wrong alignment for SKnown
 class alignas(8) SKnowledgeSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SKnowledgeSaveData& p_Other) const;
+	bool operator==(const SKnowledgeSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SKnowledgeSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SKnownEntitySaveData> m_aKnownEntities; // 0x0
@@ -7096,14 +7063,12 @@ static_assert(alignof(SKnowledgeSaveData) == 0x8, "Wrong alignment for SKnowledg
 class alignas(8) SEventHistorySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEventHistorySaveData& p_Other) const;
+	bool operator==(const SEventHistorySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEventHistorySaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<ZGameTime> m_aOccurences; // 0x0
@@ -7116,14 +7081,12 @@ static_assert(alignof(SEventHistorySaveData) == 0x8, "Wrong alignment for SEvent
 class alignas(8) SActorRagdollPoseSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorRagdollPoseSaveData& p_Other) const;
+	bool operator==(const SActorRagdollPoseSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorRagdollPoseSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_vBodyVelocity; // 0x0
@@ -7140,14 +7103,12 @@ static_assert(alignof(SActorRagdollPoseSaveData) == 0x8, "Wrong alignment for SA
 class alignas(8) SActorProviderDirectSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorProviderDirectSaveData& p_Other) const;
+	bool operator==(const SActorProviderDirectSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorProviderDirectSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aActors; // 0x0
@@ -7162,14 +7123,14 @@ static_assert(alignof(SActorProviderDirectSaveData) == 0x8, "Wrong alignment for
 class alignas(4) SActorProxySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActorProxySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActorProxySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorProxySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -7182,14 +7143,12 @@ static_assert(alignof(SActorProxySaveData) == 0x4, "Wrong alignment for SActorPr
 class alignas(8) SActorProxiesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorProxiesSaveData& p_Other) const;
+	bool operator==(const SActorProxiesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorProxiesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -7204,14 +7163,14 @@ static_assert(alignof(SActorProxiesSaveData) == 0x8, "Wrong alignment for SActor
 class alignas(8) SActorSpreadControllerCandidateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorSpreadControllerCandidateSaveData& p_Other) const;
+	bool operator==(const SActorSpreadControllerCandidateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorSpreadControllerCandidateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_CandidateActor; // 0x0
@@ -7228,14 +7187,12 @@ static_assert(alignof(SActorSpreadControllerCandidateSaveData) == 0x8, "Wrong al
 class alignas(8) SActorSpreadControllerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorSpreadControllerSaveData& p_Other) const;
+	bool operator==(const SActorSpreadControllerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorSpreadControllerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aSpreadingActors; // 0x0
@@ -7268,14 +7225,14 @@ static_assert(alignof(SActorSpreadControllerSaveData) == 0x8, "Wrong alignment f
 class alignas(4) SActorSpreadTransitionOperatorMaterialActorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActorSpreadTransitionOperatorMaterialActorSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActorSpreadTransitionOperatorMaterialActorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorSpreadTransitionOperatorMaterialActorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_Actor; // 0x0
@@ -7290,14 +7247,12 @@ static_assert(alignof(SActorSpreadTransitionOperatorMaterialActorSaveData) == 0x
 class alignas(8) SActorSpreadTransitionOperatorMaterialSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorSpreadTransitionOperatorMaterialSaveData& p_Other) const;
+	bool operator==(const SActorSpreadTransitionOperatorMaterialSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorSpreadTransitionOperatorMaterialSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SActorSpreadTransitionOperatorMaterialActorSaveData> m_aActorMaterialOverrides; // 0x0
@@ -7310,14 +7265,14 @@ static_assert(alignof(SActorSpreadTransitionOperatorMaterialSaveData) == 0x8, "W
 class alignas(4) SActorStandInSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorStandInSaveData& p_Other) const;
+	bool operator==(const SActorStandInSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorStandInSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -7330,14 +7285,12 @@ static_assert(alignof(SActorStandInSaveData) == 0x4, "Wrong alignment for SActor
 class alignas(8) SActorStandInEntitiesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorStandInEntitiesSaveData& p_Other) const;
+	bool operator==(const SActorStandInEntitiesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorStandInEntitiesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -7352,14 +7305,14 @@ static_assert(alignof(SActorStandInEntitiesSaveData) == 0x8, "Wrong alignment fo
 class alignas(4) SActorTagSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActorTagSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActorTagSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorTagSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bSeen; // 0x0
@@ -7376,14 +7329,12 @@ static_assert(alignof(SActorTagSaveData) == 0x4, "Wrong alignment for SActorTagS
 class alignas(8) SActorTagManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorTagManagerSaveData& p_Other) const;
+	bool operator==(const SActorTagManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorTagManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bContractsCreationMode; // 0x0
@@ -7404,14 +7355,14 @@ static_assert(alignof(SActorTagManagerSaveData) == 0x8, "Wrong alignment for SAc
 class alignas(16) SAgitatedBystanderOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAgitatedBystanderOrderSaveData& p_Other) const;
+	bool operator==(const SAgitatedBystanderOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAgitatedBystanderOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rBystanderPoint; // 0x0
@@ -7428,14 +7379,14 @@ static_assert(alignof(SAgitatedBystanderOrderSaveData) == 0x10, "Wrong alignment
 class alignas(4) SBoneTransformSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SBoneTransformSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SBoneTransformSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBoneTransformSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 mQuaterion; // 0x0
@@ -7450,14 +7401,12 @@ static_assert(alignof(SBoneTransformSaveData) == 0x4, "Wrong alignment for SBone
 class alignas(8) SAnimPlayerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAnimPlayerSaveData& p_Other) const;
+	bool operator==(const SAnimPlayerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAnimPlayerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 mTrajectoryQuaterion; // 0x0
@@ -7474,14 +7423,14 @@ static_assert(alignof(SAnimPlayerSaveData) == 0x8, "Wrong alignment for SAnimPla
 class alignas(4) SAnimatedActorActOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAnimatedActorActOrderSaveData& p_Other) const;
+	bool operator==(const SAnimatedActorActOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAnimatedActorActOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bOverrideExistingAct; // 0x0
@@ -7502,14 +7451,14 @@ static_assert(alignof(SAnimatedActorActOrderSaveData) == 0x4, "Wrong alignment f
 class alignas(4) SAnimatedActorMoveOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAnimatedActorMoveOrderSaveData& p_Other) const;
+	bool operator==(const SAnimatedActorMoveOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAnimatedActorMoveOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bPrecisePositioning; // 0x0
@@ -7534,14 +7483,12 @@ static_assert(alignof(SAnimatedActorMoveOrderSaveData) == 0x4, "Wrong alignment
 class alignas(8) SAnimatedActorOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAnimatedActorOrderSaveData& p_Other) const;
+	bool operator==(const SAnimatedActorOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAnimatedActorOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	EActorAnimationOrder m_eOrderType; // 0x0
@@ -7556,14 +7503,12 @@ static_assert(alignof(SAnimatedActorOrderSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SAnimatedActorReactOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAnimatedActorReactOrderSaveData& p_Other) const;
+	bool operator==(const SAnimatedActorReactOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAnimatedActorReactOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_vFaceTarget; // 0x0
@@ -7596,14 +7541,14 @@ static_assert(alignof(SAnimatedActorReactOrderSaveData) == 0x8, "Wrong alignment
 class alignas(4) SAnimatedActorStandOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SAnimatedActorStandOrderSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SAnimatedActorStandOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAnimatedActorStandOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_vFacingDirection; // 0x0
@@ -7616,14 +7561,14 @@ static_assert(alignof(SAnimatedActorStandOrderSaveData) == 0x4, "Wrong alignment
 class alignas(4) SAttentionHUDUIElement
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAttentionHUDUIElement& p_Other) const;
+	bool operator==(const SAttentionHUDUIElement& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAttentionHUDUIElement& p_Other) const { return !(*this == p_Other); }
 
 	float32 fAngle; // 0x0
@@ -7644,14 +7589,12 @@ static_assert(alignof(SAttentionHUDUIElement) == 0x4, "Wrong alignment for SAtte
 class alignas(8) SAttentionHUDUIElementArray_Dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAttentionHUDUIElementArray_Dummy& p_Other) const;
+	bool operator==(const SAttentionHUDUIElementArray_Dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAttentionHUDUIElementArray_Dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SAttentionHUDUIElement> dummy; // 0x0
@@ -7664,14 +7607,14 @@ static_assert(alignof(SAttentionHUDUIElementArray_Dummy) == 0x8, "Wrong alignmen
 class alignas(4) SAudioEmitterEventSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SAudioEmitterEventSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SAudioEmitterEventSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAudioEmitterEventSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nEventId; // 0x0
@@ -7692,14 +7635,14 @@ static_assert(alignof(SAudioEmitterEventSaveData) == 0x4, "Wrong alignment for S
 class alignas(4) SAudioEmitterRTPCSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAudioEmitterRTPCSaveData& p_Other) const;
+	bool operator==(const SAudioEmitterRTPCSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAudioEmitterRTPCSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nParamId; // 0x0
@@ -7714,14 +7657,14 @@ static_assert(alignof(SAudioEmitterRTPCSaveData) == 0x4, "Wrong alignment for SA
 class alignas(4) SAudioEmitterSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAudioEmitterSaveData& p_Other) const;
+	bool operator==(const SAudioEmitterSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAudioEmitterSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEmitter; // 0x0
@@ -7740,14 +7683,14 @@ static_assert(alignof(SAudioEmitterSaveData) == 0x4, "Wrong alignment for SAudio
 class alignas(4) SAudioEmitterStateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SAudioEmitterStateSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SAudioEmitterStateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAudioEmitterStateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nGroupId; // 0x0
@@ -7762,14 +7705,14 @@ static_assert(alignof(SAudioEmitterStateSaveData) == 0x4, "Wrong alignment for S
 class alignas(4) SAudioEmitterSwitchSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAudioEmitterSwitchSaveData& p_Other) const;
+	bool operator==(const SAudioEmitterSwitchSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAudioEmitterSwitchSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nGroupId; // 0x0
@@ -7784,14 +7727,14 @@ static_assert(alignof(SAudioEmitterSwitchSaveData) == 0x4, "Wrong alignment for
 class alignas(8) SAudioEventData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SAudioEventData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SAudioEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAudioEventData& p_Other) const { return !(*this == p_Other); }
 
 	uint64 m_EmitterID; // 0x0
@@ -7808,14 +7751,12 @@ static_assert(alignof(SAudioEventData) == 0x8, "Wrong alignment for SAudioEventD
 class alignas(8) SAudioSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAudioSaveData& p_Other) const;
+	bool operator==(const SAudioSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAudioSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SAudioEmitterSaveData> m_aEmitters; // 0x0
@@ -7840,14 +7781,14 @@ static_assert(alignof(SAudioSaveData) == 0x8, "Wrong alignment for SAudioSaveDat
 class alignas(8) SFSMSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SFSMSaveData& p_Other) const;
+	bool operator==(const SFSMSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFSMSaveData& p_Other) const { return !(*this == p_Other); }
 
 	EFSMStateStatus m_eStateStatus; // 0x0
@@ -7866,14 +7807,14 @@ static_assert(alignof(SFSMSaveData) == 0x8, "Wrong alignment for SFSMSaveData");
 class alignas(16) SAvoidDangerousAreaGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAvoidDangerousAreaGroupSaveData& p_Other) const;
+	bool operator==(const SAvoidDangerousAreaGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAvoidDangerousAreaGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -7894,14 +7835,12 @@ static_assert(alignof(SAvoidDangerousAreaGroupSaveData) == 0x10, "Wrong alignmen
 class alignas(8) SBehaviorTreeEntityReference
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBehaviorTreeEntityReference& p_Other) const;
+	bool operator==(const SBehaviorTreeEntityReference& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBehaviorTreeEntityReference& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bList; // 0x0
@@ -7916,14 +7855,12 @@ static_assert(alignof(SBehaviorTreeEntityReference) == 0x8, "Wrong alignment for
 class alignas(8) ZResourceID
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZResourceID& p_Other) const;
+	bool operator==(const ZResourceID& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZResourceID& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_uri; // 0x0
@@ -7936,14 +7873,14 @@ static_assert(alignof(ZResourceID) == 0x8, "Wrong alignment for ZResourceID");
 class alignas(8) SBehaviorTreeEvaluationLogEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SBehaviorTreeEvaluationLogEntry& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SBehaviorTreeEvaluationLogEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBehaviorTreeEvaluationLogEntry& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nBehaviorTreeIndex; // 0x0
@@ -7960,14 +7897,12 @@ static_assert(alignof(SBehaviorTreeEvaluationLogEntry) == 0x8, "Wrong alignment
 class alignas(8) SBehaviorTreeEvaluationLog
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBehaviorTreeEvaluationLog& p_Other) const;
+	bool operator==(const SBehaviorTreeEvaluationLog& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBehaviorTreeEvaluationLog& p_Other) const { return !(*this == p_Other); }
 
 	TArray<ZResourceID> m_BehaviorTrees; // 0x0
@@ -7982,14 +7917,12 @@ static_assert(alignof(SBehaviorTreeEvaluationLog) == 0x8, "Wrong alignment for S
 class alignas(8) SBehaviorTreeInputPinCondition
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBehaviorTreeInputPinCondition& p_Other) const;
+	bool operator==(const SBehaviorTreeInputPinCondition& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBehaviorTreeInputPinCondition& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sName; // 0x0
@@ -8002,14 +7935,12 @@ static_assert(alignof(SBehaviorTreeInputPinCondition) == 0x8, "Wrong alignment f
 class alignas(8) SBehaviorTreeInfo
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBehaviorTreeInfo& p_Other) const;
+	bool operator==(const SBehaviorTreeInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBehaviorTreeInfo& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SBehaviorTreeEntityReference> m_references; // 0x0
@@ -8087,14 +8018,12 @@ public:
 class alignas(8) SBlobsConfigResourceEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBlobsConfigResourceEntry& p_Other) const;
+	bool operator==(const SBlobsConfigResourceEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBlobsConfigResourceEntry& p_Other) const { return !(*this == p_Other); }
 
 	ZString Id; // 0x0
@@ -8183,14 +8112,14 @@ public:
 class alignas(4) SBodyContainerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBodyContainerSaveData& p_Other) const;
+	bool operator==(const SBodyContainerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBodyContainerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZHM5BodyContainer::EBCState m_eBCState; // 0x0
@@ -8209,14 +8138,12 @@ static_assert(alignof(SBodyContainerSaveData) == 0x4, "Wrong alignment for SBody
 class alignas(8) SBodyContainersSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBodyContainersSaveData& p_Other) const;
+	bool operator==(const SBodyContainersSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBodyContainersSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -8231,14 +8158,14 @@ static_assert(alignof(SBodyContainersSaveData) == 0x8, "Wrong alignment for SBod
 class alignas(4) SBodyPartDamageMultipliers
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SBodyPartDamageMultipliers& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SBodyPartDamageMultipliers& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBodyPartDamageMultipliers& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fHeadDamageMultiplier; // 0x0
@@ -8275,14 +8202,14 @@ static_assert(alignof(SBodyPartDamageMultipliers) == 0x4, "Wrong alignment for S
 class alignas(4) SBodybagBoneSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBodybagBoneSaveData& p_Other) const;
+	bool operator==(const SBodybagBoneSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBodybagBoneSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 mQuaterion; // 0x0
@@ -8297,14 +8224,12 @@ static_assert(alignof(SBodybagBoneSaveData) == 0x4, "Wrong alignment for SBodyba
 class alignas(8) SBodybagSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBodybagSaveData& p_Other) const;
+	bool operator==(const SBodybagSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBodybagSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_vLinkedPosition; // 0x0
@@ -8325,14 +8250,14 @@ static_assert(alignof(SBodybagSaveData) == 0x8, "Wrong alignment for SBodybagSav
 class alignas(4) SBoneAttachSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SBoneAttachSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SBoneAttachSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBoneAttachSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -8347,14 +8272,12 @@ static_assert(alignof(SBoneAttachSaveData) == 0x4, "Wrong alignment for SBoneAtt
 class alignas(8) SBoneScalesList
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBoneScalesList& p_Other) const;
+	bool operator==(const SBoneScalesList& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBoneScalesList& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SVector3> m_aBoneScales; // 0x0
@@ -8367,14 +8290,14 @@ static_assert(alignof(SBoneScalesList) == 0x8, "Wrong alignment for SBoneScalesL
 class alignas(4) SCamBone
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCamBone& p_Other) const;
+	bool operator==(const SCamBone& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCamBone& p_Other) const { return !(*this == p_Other); }
 
 	BoneId::Enum m_eBoneId; // 0x0
@@ -8403,14 +8326,12 @@ public:
 class alignas(8) SCautiousBackupGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCautiousBackupGroupSaveData& p_Other) const;
+	bool operator==(const SCautiousBackupGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCautiousBackupGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZCautiousBackupGroup::EGroupState m_eGroupState; // 0x0
@@ -8435,14 +8356,14 @@ static_assert(alignof(SCautiousBackupGroupSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SCautiousHuntSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCautiousHuntSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCautiousHuntSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCautiousHuntSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -8516,14 +8437,12 @@ public:
 class alignas(8) SExactCompressedGridFloatField
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SExactCompressedGridFloatField& p_Other) const;
+	bool operator==(const SExactCompressedGridFloatField& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SExactCompressedGridFloatField& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fInitialValue; // 0x0
@@ -8544,14 +8463,12 @@ static_assert(alignof(SExactCompressedGridFloatField) == 0x8, "Wrong alignment f
 class alignas(16) SCautiousInvestigateGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCautiousInvestigateGroupSaveData& p_Other) const;
+	bool operator==(const SCautiousInvestigateGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCautiousInvestigateGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_tGroupStarted; // 0x0
@@ -8636,14 +8553,14 @@ public:
 class alignas(4) SCautiousSearchGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCautiousSearchGroupSaveData& p_Other) const;
+	bool operator==(const SCautiousSearchGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCautiousSearchGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint16 m_searchNode; // 0x0
@@ -8666,14 +8583,14 @@ static_assert(alignof(SCautiousSearchGroupSaveData) == 0x4, "Wrong alignment for
 class alignas(8) SCautiousSituationMemberSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCautiousSituationMemberSaveData& p_Other) const;
+	bool operator==(const SCautiousSituationMemberSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCautiousSituationMemberSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_tLastDisturbance; // 0x0
@@ -8712,14 +8629,14 @@ static_assert(alignof(SCautiousSituationMemberSaveData) == 0x8, "Wrong alignment
 class alignas(8) SCautiousVIPGroupState
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCautiousVIPGroupState& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCautiousVIPGroupState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCautiousVIPGroupState& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_tMove; // 0x0
@@ -8732,14 +8649,14 @@ static_assert(alignof(SCautiousVIPGroupState) == 0x8, "Wrong alignment for SCaut
 class alignas(8) SCautiousVIPGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCautiousVIPGroupSaveData& p_Other) const;
+	bool operator==(const SCautiousVIPGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCautiousVIPGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_vip; // 0x0
@@ -8760,14 +8677,14 @@ static_assert(alignof(SCautiousVIPGroupSaveData) == 0x8, "Wrong alignment for SC
 class alignas(4) SChairSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SChairSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SChairSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SChairSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -8782,14 +8699,12 @@ static_assert(alignof(SChairSaveData) == 0x4, "Wrong alignment for SChairSaveDat
 class alignas(8) ZDynamicObject
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZDynamicObject& p_Other) const;
+	bool operator==(const ZDynamicObject& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZDynamicObject& p_Other) const { return !(*this == p_Other); }
 
 	ZVariant m_value; // 0x0
@@ -8802,14 +8717,12 @@ static_assert(alignof(ZDynamicObject) == 0x8, "Wrong alignment for ZDynamicObjec
 class alignas(8) SChallengeSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SChallengeSaveData& p_Other) const;
+	bool operator==(const SChallengeSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SChallengeSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sId; // 0x0
@@ -8824,14 +8737,12 @@ static_assert(alignof(SChallengeSaveData) == 0x8, "Wrong alignment for SChalleng
 class alignas(8) SChallengesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SChallengesSaveData& p_Other) const;
+	bool operator==(const SChallengesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SChallengesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SChallengeSaveData> m_mChallengeStates; // 0x0
@@ -8844,14 +8755,14 @@ static_assert(alignof(SChallengesSaveData) == 0x8, "Wrong alignment for SChallen
 class alignas(4) SCharacterSpeakEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCharacterSpeakEntitySaveData& p_Other) const;
+	bool operator==(const SCharacterSpeakEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCharacterSpeakEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fSeekPosition; // 0x0
@@ -8866,14 +8777,14 @@ static_assert(alignof(SCharacterSpeakEntitySaveData) == 0x4, "Wrong alignment fo
 class alignas(4) SCheckLastPositionGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCheckLastPositionGroupSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCheckLastPositionGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCheckLastPositionGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_pLeader; // 0x0
@@ -8896,14 +8807,14 @@ static_assert(alignof(SCheckLastPositionGroupSaveData) == 0x4, "Wrong alignment
 class alignas(4) SClothBundleSpawnSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SClothBundleSpawnSaveData& p_Other) const;
+	bool operator==(const SClothBundleSpawnSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SClothBundleSpawnSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rClothbundle; // 0x0
@@ -8916,14 +8827,14 @@ static_assert(alignof(SClothBundleSpawnSaveData) == 0x4, "Wrong alignment for SC
 class alignas(2) SClothVertex
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SClothVertex& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SClothVertex& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SClothVertex& p_Other) const { return !(*this == p_Other); }
 
 	uint16 m_nColumn; // 0x0
@@ -8938,14 +8849,14 @@ static_assert(alignof(SClothVertex) == 0x2, "Wrong alignment for SClothVertex");
 class alignas(4) SClothWireEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SClothWireEntitySaveData& p_Other) const;
+	bool operator==(const SClothWireEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SClothWireEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fWireLength; // 0x0
@@ -8962,14 +8873,14 @@ static_assert(alignof(SClothWireEntitySaveData) == 0x4, "Wrong alignment for SCl
 class alignas(16) SCollidingParticle
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCollidingParticle& p_Other) const;
+	bool operator==(const SCollidingParticle& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCollidingParticle& p_Other) const { return !(*this == p_Other); }
 
 	float4 m_vPosition; // 0x0
@@ -8990,14 +8901,14 @@ static_assert(alignof(SCollidingParticle) == 0x10, "Wrong alignment for SCollidi
 class alignas(1) SCollisionControllerAspectSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCollisionControllerAspectSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCollisionControllerAspectSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCollisionControllerAspectSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bCollideHitman; // 0x0
@@ -9012,14 +8923,12 @@ static_assert(alignof(SCollisionControllerAspectSaveData) == 0x1, "Wrong alignme
 class alignas(8) SCollisionControllerAspectsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCollisionControllerAspectsSaveData& p_Other) const;
+	bool operator==(const SCollisionControllerAspectsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCollisionControllerAspectsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -9034,14 +8943,14 @@ static_assert(alignof(SCollisionControllerAspectsSaveData) == 0x8, "Wrong alignm
 class alignas(4) SColorRGBA
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SColorRGBA& p_Other) const;
+	bool operator==(const SColorRGBA& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SColorRGBA& p_Other) const { return !(*this == p_Other); }
 
 	float32 r; // 0x0
@@ -9060,14 +8969,12 @@ static_assert(alignof(SColorRGBA) == 0x4, "Wrong alignment for SColorRGBA");
 class alignas(8) SColorRGBSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SColorRGBSaveData& p_Other) const;
+	bool operator==(const SColorRGBSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SColorRGBSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -9082,14 +8989,14 @@ static_assert(alignof(SColorRGBSaveData) == 0x8, "Wrong alignment for SColorRGBS
 class alignas(16) SCombatOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCombatOrderSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCombatOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCombatOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float4 m_vPos; // 0x0
@@ -9106,14 +9013,14 @@ static_assert(alignof(SCombatOrderSaveData) == 0x10, "Wrong alignment for SComba
 class alignas(8) SCombatSituationMemberSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCombatSituationMemberSaveData& p_Other) const;
+	bool operator==(const SCombatSituationMemberSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCombatSituationMemberSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_tAggressiveModeTimer; // 0x0
@@ -9150,14 +9057,14 @@ static_assert(alignof(SCombatSituationMemberSaveData) == 0x8, "Wrong alignment f
 class alignas(8) SCombatZoneEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCombatZoneEntitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCombatZoneEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCombatZoneEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsInLockdown; // 0x0
@@ -9180,14 +9087,12 @@ static_assert(alignof(SCombatZoneEntitySaveData) == 0x8, "Wrong alignment for SC
 class alignas(8) SCompressedGridFloatField
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCompressedGridFloatField& p_Other) const;
+	bool operator==(const SCompressedGridFloatField& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCompressedGridFloatField& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsSparse; // 0x0
@@ -9210,14 +9115,14 @@ static_assert(alignof(SCompressedGridFloatField) == 0x8, "Wrong alignment for SC
 class alignas(4) SConditionalTimerEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SConditionalTimerEntitySaveData& p_Other) const;
+	bool operator==(const SConditionalTimerEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SConditionalTimerEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nInterval; // 0x0
@@ -9234,14 +9139,14 @@ static_assert(alignof(SConditionalTimerEntitySaveData) == 0x4, "Wrong alignment
 class alignas(1) SContextActionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SContextActionSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SContextActionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SContextActionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -9258,14 +9163,12 @@ static_assert(alignof(SContextActionSaveData) == 0x1, "Wrong alignment for SCont
 class alignas(8) SContractConfigResourceEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SContractConfigResourceEntry& p_Other) const;
+	bool operator==(const SContractConfigResourceEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SContractConfigResourceEntry& p_Other) const { return !(*this == p_Other); }
 
 	ZString Id; // 0x0
@@ -9280,14 +9183,14 @@ static_assert(alignof(SContractConfigResourceEntry) == 0x8, "Wrong alignment for
 class alignas(1) SContractObjectiveHudHintEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SContractObjectiveHudHintEntitySaveData& p_Other) const;
+	bool operator==(const SContractObjectiveHudHintEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SContractObjectiveHudHintEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bVisible; // 0x0
@@ -9300,14 +9203,12 @@ static_assert(alignof(SContractObjectiveHudHintEntitySaveData) == 0x1, "Wrong al
 class alignas(8) SContractObjectiveSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SContractObjectiveSaveData& p_Other) const;
+	bool operator==(const SContractObjectiveSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SContractObjectiveSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZGuid m_Id; // 0x0
@@ -9382,14 +9283,12 @@ static_assert(alignof(SContractObjectiveSaveData) == 0x8, "Wrong alignment for S
 class alignas(8) SEntityTemplateProperty
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTemplateProperty& p_Other) const;
+	bool operator==(const SEntityTemplateProperty& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTemplateProperty& p_Other) const { return !(*this == p_Other); }
 
 	uint32 nPropertyID; // 0x0
@@ -9404,14 +9303,12 @@ static_assert(alignof(SEntityTemplateProperty) == 0x8, "Wrong alignment for SEnt
 class alignas(8) SCppEntity
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCppEntity& p_Other) const;
+	bool operator==(const SCppEntity& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCppEntity& p_Other) const { return !(*this == p_Other); }
 
 	int32 blueprintIndexInResourceHeader; // 0x0
@@ -9426,14 +9323,12 @@ static_assert(alignof(SCppEntity) == 0x8, "Wrong alignment for SCppEntity");
 class alignas(8) SCppEntitySubsetInfo
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCppEntitySubsetInfo& p_Other) const;
+	bool operator==(const SCppEntitySubsetInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCppEntitySubsetInfo& p_Other) const { return !(*this == p_Other); }
 
 	ZString name; // 0x0
@@ -9448,14 +9343,12 @@ static_assert(alignof(SCppEntitySubsetInfo) == 0x8, "Wrong alignment for SCppEnt
 class alignas(8) SCppEntityBlueprint
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCppEntityBlueprint& p_Other) const;
+	bool operator==(const SCppEntityBlueprint& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCppEntityBlueprint& p_Other) const { return !(*this == p_Other); }
 
 	TypeID typeName; // 0x0
@@ -9470,14 +9363,14 @@ static_assert(alignof(SCppEntityBlueprint) == 0x8, "Wrong alignment for SCppEnti
 class alignas(16) SCrimeSceneSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrimeSceneSaveData& p_Other) const;
+	bool operator==(const SCrimeSceneSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrimeSceneSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float4 m_vPos; // 0x0
@@ -9500,14 +9393,12 @@ static_assert(alignof(SCrimeSceneSaveData) == 0x10, "Wrong alignment for SCrimeS
 class alignas(8) SCrimeSceneServiceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrimeSceneServiceSaveData& p_Other) const;
+	bool operator==(const SCrimeSceneServiceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrimeSceneServiceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SCrimeSceneSaveData> m_aCrimeScenes; // 0x0
@@ -9539,14 +9430,14 @@ public:
 class alignas(4) SCrowdActivitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCrowdActivitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCrowdActivitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdActivitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -9565,14 +9456,14 @@ static_assert(alignof(SCrowdActivitySaveData) == 0x4, "Wrong alignment for SCrow
 class alignas(16) SCrowdActorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdActorSaveData& p_Other) const;
+	bool operator==(const SCrowdActorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdActorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -9601,14 +9492,12 @@ static_assert(alignof(SCrowdActorSaveData) == 0x10, "Wrong alignment for SCrowdA
 class alignas(8) SCrowdBodySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdBodySaveData& p_Other) const;
+	bool operator==(const SCrowdBodySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdBodySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_pCorpseBodybagEntity; // 0x0
@@ -9635,14 +9524,14 @@ static_assert(alignof(SCrowdBodySaveData) == 0x8, "Wrong alignment for SCrowdBod
 class alignas(128) SCrowdCells
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCrowdCells& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCrowdCells& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdCells& p_Other) const { return !(*this == p_Other); }
 
 	TFixedArray<uint8, 128> m_cells; // 0x0
@@ -9655,14 +9544,14 @@ static_assert(alignof(SCrowdCells) == 0x80, "Wrong alignment for SCrowdCells");
 class alignas(4) SCrowdPoseBoneSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdPoseBoneSaveData& p_Other) const;
+	bool operator==(const SCrowdPoseBoneSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdPoseBoneSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 mQuaterion; // 0x0
@@ -9677,14 +9566,12 @@ static_assert(alignof(SCrowdPoseBoneSaveData) == 0x4, "Wrong alignment for SCrow
 class alignas(8) SCrowdPoseSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdPoseSaveData& p_Other) const;
+	bool operator==(const SCrowdPoseSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdPoseSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SCrowdPoseBoneSaveData> m_aBones; // 0x0
@@ -9697,14 +9584,12 @@ static_assert(alignof(SCrowdPoseSaveData) == 0x8, "Wrong alignment for SCrowdPos
 class alignas(8) SCrowdPoseCollectionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdPoseCollectionSaveData& p_Other) const;
+	bool operator==(const SCrowdPoseCollectionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdPoseCollectionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint64 m_id; // 0x0
@@ -9719,14 +9604,12 @@ static_assert(alignof(SCrowdPoseCollectionSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SCrowdDeadPoseRepositorySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdDeadPoseRepositorySaveData& p_Other) const;
+	bool operator==(const SCrowdDeadPoseRepositorySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdDeadPoseRepositorySaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SCrowdPoseCollectionSaveData> m_aPoseCollections; // 0x0
@@ -9739,14 +9622,14 @@ static_assert(alignof(SCrowdDeadPoseRepositorySaveData) == 0x8, "Wrong alignment
 class alignas(16) SRegionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRegionSaveData& p_Other) const;
+	bool operator==(const SRegionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRegionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nIndex; // 0x0
@@ -9777,14 +9660,12 @@ static_assert(alignof(SRegionSaveData) == 0x10, "Wrong alignment for SRegionSave
 class alignas(8) SCrowdEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdEntitySaveData& p_Other) const;
+	bool operator==(const SCrowdEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SCrowdActorSaveData> m_CrowdActorData; // 0x0
@@ -9807,14 +9688,12 @@ static_assert(alignof(SCrowdEntitySaveData) == 0x8, "Wrong alignment for SCrowdE
 class alignas(8) SCrowdFlowChannel
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdFlowChannel& p_Other) const;
+	bool operator==(const SCrowdFlowChannel& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdFlowChannel& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint8> m_aFlowVectorIndex; // 0x0
@@ -9829,14 +9708,14 @@ static_assert(alignof(SCrowdFlowChannel) == 0x8, "Wrong alignment for SCrowdFlow
 class alignas(2) ZCrowdGridPoint
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const ZCrowdGridPoint& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const ZCrowdGridPoint& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZCrowdGridPoint& p_Other) const { return !(*this == p_Other); }
 
 	int16 m_nHeightOffset; // 0x0
@@ -9851,14 +9730,12 @@ static_assert(alignof(ZCrowdGridPoint) == 0x2, "Wrong alignment for ZCrowdGridPo
 class alignas(16) SCrowdMapData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdMapData& p_Other) const;
+	bool operator==(const SCrowdMapData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdMapData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nVersion; // 0x0
@@ -9903,14 +9780,14 @@ static_assert(alignof(SCrowdMapData) == 0x10, "Wrong alignment for SCrowdMapData
 class alignas(4) SCrowdReactionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdReactionSaveData& p_Other) const;
+	bool operator==(const SCrowdReactionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdReactionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nNumPacify; // 0x0
@@ -9931,14 +9808,12 @@ static_assert(alignof(SCrowdReactionSaveData) == 0x4, "Wrong alignment for SCrow
 class alignas(8) SCrowdServiceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdServiceSaveData& p_Other) const;
+	bool operator==(const SCrowdServiceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdServiceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SCrowdBodySaveData> m_aDeadBodies; // 0x0
@@ -9951,14 +9826,14 @@ static_assert(alignof(SCrowdServiceSaveData) == 0x8, "Wrong alignment for SCrowd
 class alignas(8) SCuriousEventSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCuriousEventSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCuriousEventSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCuriousEventSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_tExpiresAt; // 0x0
@@ -9973,14 +9848,12 @@ static_assert(alignof(SCuriousEventSaveData) == 0x8, "Wrong alignment for SCurio
 class alignas(8) SCuriousEventServiceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCuriousEventServiceSaveData& p_Other) const;
+	bool operator==(const SCuriousEventServiceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCuriousEventServiceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SCuriousEventSaveData> m_aCuriousEvents; // 0x0
@@ -9993,14 +9866,14 @@ static_assert(alignof(SCuriousEventServiceSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SCuriousInvestigateGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCuriousInvestigateGroupSaveData& p_Other) const;
+	bool operator==(const SCuriousInvestigateGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCuriousInvestigateGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nInvestigationId; // 0x0
@@ -10033,14 +9906,12 @@ static_assert(alignof(SCuriousInvestigateGroupSaveData) == 0x8, "Wrong alignment
 class alignas(8) SCuriousInvestigateSituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCuriousInvestigateSituationSaveData& p_Other) const;
+	bool operator==(const SCuriousInvestigateSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCuriousInvestigateSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<int32> m_aInvestigationGroupIDs; // 0x0
@@ -10059,14 +9930,14 @@ static_assert(alignof(SCuriousInvestigateSituationSaveData) == 0x8, "Wrong align
 class alignas(8) SCuriousSituationMemberSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCuriousSituationMemberSaveData& p_Other) const;
+	bool operator==(const SCuriousSituationMemberSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCuriousSituationMemberSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_tLastDisturbance; // 0x0
@@ -10083,14 +9954,12 @@ static_assert(alignof(SCuriousSituationMemberSaveData) == 0x8, "Wrong alignment
 class alignas(4) SCutSequenceData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCutSequenceData& p_Other) const;
+	bool operator==(const SCutSequenceData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCutSequenceData& p_Other) const { return !(*this == p_Other); }
 
 	TResourcePtr m_animResource; // 0x0
@@ -10109,14 +9978,14 @@ static_assert(alignof(SCutSequenceData) == 0x4, "Wrong alignment for SCutSequenc
 class alignas(1) SDangerousAreaSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SDangerousAreaSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SDangerousAreaSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDangerousAreaSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bDangerous; // 0x0
@@ -10129,14 +9998,12 @@ static_assert(alignof(SDangerousAreaSaveData) == 0x1, "Wrong alignment for SDang
 class alignas(8) SDeadBodyInfoSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDeadBodyInfoSaveData& p_Other) const;
+	bool operator==(const SDeadBodyInfoSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDeadBodyInfoSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -10175,14 +10042,12 @@ static_assert(alignof(SDeadBodyInfoSaveData) == 0x8, "Wrong alignment for SDeadB
 class alignas(8) SDeadBodySensorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDeadBodySensorSaveData& p_Other) const;
+	bool operator==(const SDeadBodySensorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDeadBodySensorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SDeadBodyInfoSaveData> m_aBodies; // 0x0
@@ -10197,14 +10062,14 @@ static_assert(alignof(SDeadBodySensorSaveData) == 0x8, "Wrong alignment for SDea
 class alignas(4) SVector2
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVector2& p_Other) const;
+	bool operator==(const SVector2& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVector2& p_Other) const { return !(*this == p_Other); }
 
 	float32 x; // 0x0
@@ -10219,14 +10084,14 @@ static_assert(alignof(SVector2) == 0x4, "Wrong alignment for SVector2");
 class alignas(16) SDecalSpawnSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SDecalSpawnSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SDecalSpawnSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDecalSpawnSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bWasSpawned; // 0x0
@@ -10259,14 +10124,14 @@ static_assert(alignof(SDecalSpawnSaveData) == 0x10, "Wrong alignment for SDecalS
 class alignas(8) SDetectedInPrivateGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDetectedInPrivateGroupSaveData& p_Other) const;
+	bool operator==(const SDetectedInPrivateGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDetectedInPrivateGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -10289,14 +10154,14 @@ static_assert(alignof(SDetectedInPrivateGroupSaveData) == 0x8, "Wrong alignment
 class alignas(1) SDisguiseZoneSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SDisguiseZoneSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SDisguiseZoneSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDisguiseZoneSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -10309,14 +10174,14 @@ static_assert(alignof(SDisguiseZoneSaveData) == 0x1, "Wrong alignment for SDisgu
 class alignas(8) SDisturbanceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDisturbanceSaveData& p_Other) const;
+	bool operator==(const SDisturbanceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDisturbanceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_object; // 0x0
@@ -10339,14 +10204,14 @@ static_assert(alignof(SDisturbanceSaveData) == 0x8, "Wrong alignment for SDistur
 class alignas(8) SDoorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SDoorSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SDoorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDoorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nDoorState; // 0x0
@@ -10379,14 +10244,12 @@ public:
 class alignas(8) SDoorsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDoorsSaveData& p_Other) const;
+	bool operator==(const SDoorsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDoorsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -10401,14 +10264,12 @@ static_assert(alignof(SDoorsSaveData) == 0x8, "Wrong alignment for SDoorsSaveDat
 class alignas(8) SDramaActorSaveState
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDramaActorSaveState& p_Other) const;
+	bool operator==(const SDramaActorSaveState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDramaActorSaveState& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -10439,14 +10300,12 @@ static_assert(alignof(SDramaActorSaveState) == 0x8, "Wrong alignment for SDramaA
 class alignas(8) SDramaActorCollectionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDramaActorCollectionSaveData& p_Other) const;
+	bool operator==(const SDramaActorCollectionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDramaActorCollectionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -10502,14 +10361,14 @@ public:
 class alignas(4) SDramaSetupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDramaSetupSaveData& p_Other) const;
+	bool operator==(const SDramaSetupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDramaSetupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bDoneTriggered; // 0x0
@@ -10526,14 +10385,12 @@ static_assert(alignof(SDramaSetupSaveData) == 0x4, "Wrong alignment for SDramaSe
 class alignas(8) SDramaSetupCollectionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDramaSetupCollectionSaveData& p_Other) const;
+	bool operator==(const SDramaSetupCollectionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDramaSetupCollectionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -10548,14 +10405,14 @@ static_assert(alignof(SDramaSetupCollectionSaveData) == 0x8, "Wrong alignment fo
 class alignas(4) SDramaSituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDramaSituationSaveData& p_Other) const;
+	bool operator==(const SDramaSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDramaSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bSituationRunning; // 0x0
@@ -10576,14 +10433,12 @@ static_assert(alignof(SDramaSituationSaveData) == 0x4, "Wrong alignment for SDra
 class alignas(8) SDramaSituationCollectionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDramaSituationCollectionSaveData& p_Other) const;
+	bool operator==(const SDramaSituationCollectionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDramaSituationCollectionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -10598,14 +10453,14 @@ static_assert(alignof(SDramaSituationCollectionSaveData) == 0x8, "Wrong alignmen
 class alignas(16) SDynamicEnforcerCandidateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SDynamicEnforcerCandidateSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SDynamicEnforcerCandidateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDynamicEnforcerCandidateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -10624,14 +10479,12 @@ static_assert(alignof(SDynamicEnforcerCandidateSaveData) == 0x10, "Wrong alignme
 class alignas(8) SDynamicEnforcerServiceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDynamicEnforcerServiceSaveData& p_Other) const;
+	bool operator==(const SDynamicEnforcerServiceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDynamicEnforcerServiceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SDynamicEnforcerCandidateSaveData> m_aCandidates; // 0x0
@@ -10644,14 +10497,12 @@ static_assert(alignof(SDynamicEnforcerServiceSaveData) == 0x8, "Wrong alignment
 class alignas(8) SDynamicObjectKeyValuePair
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDynamicObjectKeyValuePair& p_Other) const;
+	bool operator==(const SDynamicObjectKeyValuePair& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDynamicObjectKeyValuePair& p_Other) const { return !(*this == p_Other); }
 
 	ZString sKey; // 0x0
@@ -10666,14 +10517,14 @@ static_assert(alignof(SDynamicObjectKeyValuePair) == 0x8, "Wrong alignment for S
 class alignas(1) SDynamicRayCastEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDynamicRayCastEntitySaveData& p_Other) const;
+	bool operator==(const SDynamicRayCastEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDynamicRayCastEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -10686,14 +10537,12 @@ static_assert(alignof(SDynamicRayCastEntitySaveData) == 0x1, "Wrong alignment fo
 class alignas(8) SEntityPath
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityPath& p_Other) const;
+	bool operator==(const SEntityPath& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityPath& p_Other) const { return !(*this == p_Other); }
 
 	uint64 m_nOwnerID; // 0x0
@@ -10708,14 +10557,12 @@ static_assert(alignof(SEntityPath) == 0x8, "Wrong alignment for SEntityPath");
 class alignas(8) SEntityPinDescriptor
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityPinDescriptor& p_Other) const;
+	bool operator==(const SEntityPinDescriptor& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityPinDescriptor& p_Other) const { return !(*this == p_Other); }
 
 	ZString sName; // 0x0
@@ -10736,14 +10583,12 @@ static_assert(alignof(SEntityPinDescriptor) == 0x8, "Wrong alignment for SEntity
 class alignas(8) SEntityPropertyDescriptor
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityPropertyDescriptor& p_Other) const;
+	bool operator==(const SEntityPropertyDescriptor& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityPropertyDescriptor& p_Other) const { return !(*this == p_Other); }
 
 	ZString sName; // 0x0
@@ -10760,14 +10605,12 @@ static_assert(alignof(SEntityPropertyDescriptor) == 0x8, "Wrong alignment for SE
 class alignas(8) SEntityTemplateEntitySubset
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTemplateEntitySubset& p_Other) const;
+	bool operator==(const SEntityTemplateEntitySubset& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTemplateEntitySubset& p_Other) const { return !(*this == p_Other); }
 
 	TArray<int32> entities; // 0x0
@@ -10780,14 +10623,12 @@ static_assert(alignof(SEntityTemplateEntitySubset) == 0x8, "Wrong alignment for
 class alignas(8) SEntityTemplatePinConnection
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTemplatePinConnection& p_Other) const;
+	bool operator==(const SEntityTemplatePinConnection& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTemplatePinConnection& p_Other) const { return !(*this == p_Other); }
 
 	int32 fromID; // 0x0
@@ -10806,14 +10647,12 @@ static_assert(alignof(SEntityTemplatePinConnection) == 0x8, "Wrong alignment for
 class alignas(8) SEntityTemplatePropertyAlias
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTemplatePropertyAlias& p_Other) const;
+	bool operator==(const SEntityTemplatePropertyAlias& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTemplatePropertyAlias& p_Other) const { return !(*this == p_Other); }
 
 	ZString sAliasName; // 0x0
@@ -10830,14 +10669,12 @@ static_assert(alignof(SEntityTemplatePropertyAlias) == 0x8, "Wrong alignment for
 class alignas(8) SEntityTemplateReference
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTemplateReference& p_Other) const;
+	bool operator==(const SEntityTemplateReference& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTemplateReference& p_Other) const { return !(*this == p_Other); }
 
 	uint64 entityID; // 0x0
@@ -10856,14 +10693,12 @@ static_assert(alignof(SEntityTemplateReference) == 0x8, "Wrong alignment for SEn
 class alignas(8) SEntityTemplatePropertyOverride
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTemplatePropertyOverride& p_Other) const;
+	bool operator==(const SEntityTemplatePropertyOverride& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTemplatePropertyOverride& p_Other) const { return !(*this == p_Other); }
 
 	SEntityTemplateReference propertyOwner; // 0x0
@@ -10878,14 +10713,12 @@ static_assert(alignof(SEntityTemplatePropertyOverride) == 0x8, "Wrong alignment
 class alignas(8) SExposedEntityDescriptor
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SExposedEntityDescriptor& p_Other) const;
+	bool operator==(const SExposedEntityDescriptor& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SExposedEntityDescriptor& p_Other) const { return !(*this == p_Other); }
 
 	ZString sName; // 0x0
@@ -10904,14 +10737,12 @@ static_assert(alignof(SExposedEntityDescriptor) == 0x8, "Wrong alignment for SEx
 class alignas(8) SEntityTypeDescriptor
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTypeDescriptor& p_Other) const;
+	bool operator==(const SEntityTypeDescriptor& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTypeDescriptor& p_Other) const { return !(*this == p_Other); }
 
 	ZString typeName; // 0x0
@@ -10944,14 +10775,12 @@ static_assert(alignof(SEntityTypeDescriptor) == 0x8, "Wrong alignment for SEntit
 class alignas(8) SEnvironmentConfigResourceEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEnvironmentConfigResourceEntry& p_Other) const;
+	bool operator==(const SEnvironmentConfigResourceEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEnvironmentConfigResourceEntry& p_Other) const { return !(*this == p_Other); }
 
 	ZString Name; // 0x0
@@ -10970,14 +10799,12 @@ static_assert(alignof(SEnvironmentConfigResourceEntry) == 0x8, "Wrong alignment
 class alignas(8) SEnvironmentConfigResource
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEnvironmentConfigResource& p_Other) const;
+	bool operator==(const SEnvironmentConfigResource& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEnvironmentConfigResource& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SEnvironmentConfigResourceEntry> Environments; // 0x0
@@ -10990,14 +10817,14 @@ static_assert(alignof(SEnvironmentConfigResource) == 0x8, "Wrong alignment for S
 class alignas(16) SEscortOutBehaviorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SEscortOutBehaviorSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SEscortOutBehaviorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEscortOutBehaviorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nSituation; // 0x0
@@ -11036,14 +10863,12 @@ static_assert(alignof(SEscortOutBehaviorSaveData) == 0x10, "Wrong alignment for
 class alignas(8) SEscortOutOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEscortOutOrderSaveData& p_Other) const;
+	bool operator==(const SEscortOutOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEscortOutOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<float4> m_aExitPoints; // 0x0
@@ -11083,14 +10908,14 @@ public:
 class alignas(4) SEscortSituationActorStateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEscortSituationActorStateSaveData& p_Other) const;
+	bool operator==(const SEscortSituationActorStateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEscortSituationActorStateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nID; // 0x0
@@ -11115,14 +10940,14 @@ static_assert(alignof(SEscortSituationActorStateSaveData) == 0x4, "Wrong alignme
 class alignas(4) SEscortSituationActors
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SEscortSituationActors& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SEscortSituationActors& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEscortSituationActors& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -11135,14 +10960,12 @@ static_assert(alignof(SEscortSituationActors) == 0x4, "Wrong alignment for SEsco
 class alignas(8) SEscortSituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEscortSituationSaveData& p_Other) const;
+	bool operator==(const SEscortSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEscortSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bActivated; // 0x0
@@ -11191,14 +11014,14 @@ static_assert(alignof(SEscortSituationSaveData) == 0x8, "Wrong alignment for SEs
 class alignas(4) SEvacuateSituationMemberSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEvacuateSituationMemberSaveData& p_Other) const;
+	bool operator==(const SEvacuateSituationMemberSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEvacuateSituationMemberSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_pGuardDutyPoint; // 0x0
@@ -11215,14 +11038,12 @@ static_assert(alignof(SEvacuateSituationMemberSaveData) == 0x4, "Wrong alignment
 class alignas(8) SEvacuateSituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEvacuateSituationSaveData& p_Other) const;
+	bool operator==(const SEvacuateSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEvacuateSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -11245,14 +11066,14 @@ static_assert(alignof(SEvacuateSituationSaveData) == 0x8, "Wrong alignment for S
 class alignas(8) SEvacuateTrespassGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SEvacuateTrespassGroupSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SEvacuateTrespassGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEvacuateTrespassGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -11281,14 +11102,12 @@ static_assert(alignof(SEvacuateTrespassGroupSaveData) == 0x8, "Wrong alignment f
 class alignas(8) SEvacuateVIPGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEvacuateVIPGroupSaveData& p_Other) const;
+	bool operator==(const SEvacuateVIPGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEvacuateVIPGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -11325,14 +11144,14 @@ static_assert(alignof(SEvacuateVIPGroupSaveData) == 0x8, "Wrong alignment for SE
 class alignas(1) SEventChannelSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEventChannelSaveData& p_Other) const;
+	bool operator==(const SEventChannelSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEventChannelSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -11345,14 +11164,14 @@ static_assert(alignof(SEventChannelSaveData) == 0x1, "Wrong alignment for SEvent
 class alignas(1) SExitSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SExitSaveData& p_Other) const;
+	bool operator==(const SExitSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SExitSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -11365,14 +11184,14 @@ static_assert(alignof(SExitSaveData) == 0x1, "Wrong alignment for SExitSaveData"
 class alignas(4) SFRange
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SFRange& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SFRange& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFRange& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fMin; // 0x0
@@ -11387,14 +11206,12 @@ static_assert(alignof(SFRange) == 0x4, "Wrong alignment for SFRange");
 class alignas(8) SFaceFXAnimationRef
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SFaceFXAnimationRef& p_Other) const;
+	bool operator==(const SFaceFXAnimationRef& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFaceFXAnimationRef& p_Other) const { return !(*this == p_Other); }
 
 	ZRuntimeResourceID m_animationSetResourceID; // 0x0
@@ -11411,14 +11228,14 @@ static_assert(alignof(SFaceFXAnimationRef) == 0x8, "Wrong alignment for SFaceFXA
 class alignas(4) SFaceOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SFaceOrderSaveData& p_Other) const;
+	bool operator==(const SFaceOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFaceOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bLookAt; // 0x0
@@ -11441,14 +11258,14 @@ static_assert(alignof(SFaceOrderSaveData) == 0x4, "Wrong alignment for SFaceOrde
 class alignas(4) SFleeOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SFleeOrderSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SFleeOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFleeOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	EDisturbanceType m_eHelpReason; // 0x0
@@ -11465,14 +11282,12 @@ static_assert(alignof(SFleeOrderSaveData) == 0x4, "Wrong alignment for SFleeOrde
 class alignas(8) SFontDefinition
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SFontDefinition& p_Other) const;
+	bool operator==(const SFontDefinition& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFontDefinition& p_Other) const { return !(*this == p_Other); }
 
 	ZString sFontId; // 0x0
@@ -11491,14 +11306,12 @@ static_assert(alignof(SFontDefinition) == 0x8, "Wrong alignment for SFontDefinit
 class alignas(8) SFontLibraryDefinition
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SFontLibraryDefinition& p_Other) const;
+	bool operator==(const SFontLibraryDefinition& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFontLibraryDefinition& p_Other) const { return !(*this == p_Other); }
 
 	ZString sFontLocaleID; // 0x0
@@ -11523,14 +11336,14 @@ public:
 
 
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SFootIKEventData& p_Other) const;
+	bool operator==(const SFootIKEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFootIKEventData& p_Other) const { return !(*this == p_Other); }
 
 	SFootIKEventData::EFoot m_Foot; // 0x0
@@ -11565,14 +11378,14 @@ public:
 class alignas(8) SFriskSuspectGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SFriskSuspectGroupSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SFriskSuspectGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFriskSuspectGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -11615,14 +11428,14 @@ static_assert(alignof(SFriskSuspectGroupSaveData) == 0x8, "Wrong alignment for S
 class alignas(4) SGBufferSample
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGBufferSample& p_Other) const;
+	bool operator==(const SGBufferSample& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGBufferSample& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 normal; // 0x0
@@ -11649,14 +11462,14 @@ static_assert(alignof(SGBufferSample) == 0x4, "Wrong alignment for SGBufferSampl
 class alignas(16) SGProperties
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SGProperties& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SGProperties& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGProperties& p_Other) const { return !(*this == p_Other); }
 
 	float4 vMin; // 0x0
@@ -11677,14 +11490,14 @@ static_assert(alignof(SGProperties) == 0x10, "Wrong alignment for SGProperties")
 class alignas(16) SGWaypoint
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGWaypoint& p_Other) const;
+	bool operator==(const SGWaypoint& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGWaypoint& p_Other) const { return !(*this == p_Other); }
 
 	uint16 nNeighbor0; // 0x0
@@ -11717,14 +11530,14 @@ static_assert(alignof(SGWaypoint) == 0x10, "Wrong alignment for SGWaypoint");
 class alignas(1) SGameCamProfileEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGameCamProfileEntitySaveData& p_Other) const;
+	bool operator==(const SGameCamProfileEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGameCamProfileEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsEnabled; // 0x0
@@ -11737,14 +11550,14 @@ static_assert(alignof(SGameCamProfileEntitySaveData) == 0x1, "Wrong alignment fo
 class alignas(4) SShatterShardTransformSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SShatterShardTransformSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SShatterShardTransformSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SShatterShardTransformSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 m_vBoneRotation; // 0x0
@@ -11759,14 +11572,14 @@ static_assert(alignof(SShatterShardTransformSaveData) == 0x4, "Wrong alignment f
 class alignas(4) SShatterShardSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SShatterShardSaveData& p_Other) const;
+	bool operator==(const SShatterShardSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SShatterShardSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nShardIndex; // 0x0
@@ -11783,14 +11596,12 @@ static_assert(alignof(SShatterShardSaveData) == 0x4, "Wrong alignment for SShatt
 class alignas(8) SShatterSystemSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SShatterSystemSaveData& p_Other) const;
+	bool operator==(const SShatterSystemSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SShatterSystemSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 m_vRotation; // 0x0
@@ -11821,14 +11632,12 @@ static_assert(alignof(SShatterSystemSaveData) == 0x8, "Wrong alignment for SShat
 class alignas(8) SShatterSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SShatterSaveData& p_Other) const;
+	bool operator==(const SShatterSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SShatterSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -11843,14 +11652,14 @@ static_assert(alignof(SShatterSaveData) == 0x8, "Wrong alignment for SShatterSav
 class alignas(8) SVIPEvacuationNodeSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SVIPEvacuationNodeSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SVIPEvacuationNodeSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVIPEvacuationNodeSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fPenaltyMultiplier; // 0x0
@@ -11871,14 +11680,12 @@ static_assert(alignof(SVIPEvacuationNodeSaveData) == 0x8, "Wrong alignment for S
 class alignas(8) SVIPEvacuationNodesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVIPEvacuationNodesSaveData& p_Other) const;
+	bool operator==(const SVIPEvacuationNodesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVIPEvacuationNodesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -11893,14 +11700,12 @@ static_assert(alignof(SVIPEvacuationNodesSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SItemSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SItemSaveData& p_Other) const;
+	bool operator==(const SItemSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_vPosition; // 0x0
@@ -11947,14 +11752,12 @@ static_assert(alignof(SItemSaveData) == 0x8, "Wrong alignment for SItemSaveData"
 class alignas(8) SItemsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SItemsSaveData& p_Other) const;
+	bool operator==(const SItemsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -11969,14 +11772,14 @@ static_assert(alignof(SItemsSaveData) == 0x8, "Wrong alignment for SItemsSaveDat
 class alignas(4) SMathMultiplyDivideSaveData_SVector4
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultiplyDivideSaveData_SVector4& p_Other) const;
+	bool operator==(const SMathMultiplyDivideSaveData_SVector4& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultiplyDivideSaveData_SVector4& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 m_fA; // 0x0
@@ -11993,14 +11796,12 @@ static_assert(alignof(SMathMultiplyDivideSaveData_SVector4) == 0x4, "Wrong align
 class alignas(8) SMathMultipliesSaveData_SVector4
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultipliesSaveData_SVector4& p_Other) const;
+	bool operator==(const SMathMultipliesSaveData_SVector4& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultipliesSaveData_SVector4& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -12015,14 +11816,14 @@ static_assert(alignof(SMathMultipliesSaveData_SVector4) == 0x8, "Wrong alignment
 class alignas(1) SVolumeTriggerListenerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVolumeTriggerListenerSaveData& p_Other) const;
+	bool operator==(const SVolumeTriggerListenerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVolumeTriggerListenerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bColliding; // 0x0
@@ -12037,14 +11838,12 @@ static_assert(alignof(SVolumeTriggerListenerSaveData) == 0x1, "Wrong alignment f
 class alignas(8) SVolumeTriggersSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVolumeTriggersSaveData& p_Other) const;
+	bool operator==(const SVolumeTriggersSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVolumeTriggersSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -12059,14 +11858,14 @@ static_assert(alignof(SVolumeTriggersSaveData) == 0x8, "Wrong alignment for SVol
 class alignas(4) SMathMultiplyDivideSaveData_SVector3
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMathMultiplyDivideSaveData_SVector3& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMathMultiplyDivideSaveData_SVector3& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultiplyDivideSaveData_SVector3& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_fA; // 0x0
@@ -12083,14 +11882,12 @@ static_assert(alignof(SMathMultiplyDivideSaveData_SVector3) == 0x4, "Wrong align
 class alignas(8) SMathMultipliesSaveData_SVector3
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultipliesSaveData_SVector3& p_Other) const;
+	bool operator==(const SMathMultipliesSaveData_SVector3& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultipliesSaveData_SVector3& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -12105,14 +11902,14 @@ static_assert(alignof(SMathMultipliesSaveData_SVector3) == 0x8, "Wrong alignment
 class alignas(4) SMathMultiplyDivideSaveData_float32
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultiplyDivideSaveData_float32& p_Other) const;
+	bool operator==(const SMathMultiplyDivideSaveData_float32& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultiplyDivideSaveData_float32& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fA; // 0x0
@@ -12129,14 +11926,12 @@ static_assert(alignof(SMathMultiplyDivideSaveData_float32) == 0x4, "Wrong alignm
 class alignas(8) SMathMultipliesSaveData_float32
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultipliesSaveData_float32& p_Other) const;
+	bool operator==(const SMathMultipliesSaveData_float32& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultipliesSaveData_float32& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -12151,14 +11946,14 @@ static_assert(alignof(SMathMultipliesSaveData_float32) == 0x8, "Wrong alignment
 class alignas(4) SItemKeywordProxySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SItemKeywordProxySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SItemKeywordProxySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemKeywordProxySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rItem; // 0x0
@@ -12171,14 +11966,12 @@ static_assert(alignof(SItemKeywordProxySaveData) == 0x4, "Wrong alignment for SI
 class alignas(8) SItemKeywordProxiesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SItemKeywordProxiesSaveData& p_Other) const;
+	bool operator==(const SItemKeywordProxiesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemKeywordProxiesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -12193,14 +11986,14 @@ static_assert(alignof(SItemKeywordProxiesSaveData) == 0x8, "Wrong alignment for
 class alignas(4) SMathMultiplyDivideSaveData_SVector2
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultiplyDivideSaveData_SVector2& p_Other) const;
+	bool operator==(const SMathMultiplyDivideSaveData_SVector2& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultiplyDivideSaveData_SVector2& p_Other) const { return !(*this == p_Other); }
 
 	SVector2 m_fA; // 0x0
@@ -12217,14 +12010,12 @@ static_assert(alignof(SMathMultiplyDivideSaveData_SVector2) == 0x4, "Wrong align
 class alignas(8) SMathMultipliesSaveData_SVector2
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultipliesSaveData_SVector2& p_Other) const;
+	bool operator==(const SMathMultipliesSaveData_SVector2& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultipliesSaveData_SVector2& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -12239,14 +12030,14 @@ static_assert(alignof(SMathMultipliesSaveData_SVector2) == 0x8, "Wrong alignment
 class alignas(4) SLampCoreSaveState
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLampCoreSaveState& p_Other) const;
+	bool operator==(const SLampCoreSaveState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLampCoreSaveState& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fDiffusePower; // 0x0
@@ -12261,14 +12052,12 @@ static_assert(alignof(SLampCoreSaveState) == 0x4, "Wrong alignment for SLampCore
 class alignas(8) SLampCoreSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLampCoreSaveData& p_Other) const;
+	bool operator==(const SLampCoreSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLampCoreSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -12283,14 +12072,14 @@ static_assert(alignof(SLampCoreSaveData) == 0x8, "Wrong alignment for SLampCoreS
 class alignas(1) SShotListenerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SShotListenerSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SShotListenerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SShotListenerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -12305,14 +12094,12 @@ static_assert(alignof(SShotListenerSaveData) == 0x1, "Wrong alignment for SShotL
 class alignas(8) SShotListenersSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SShotListenersSaveData& p_Other) const;
+	bool operator==(const SShotListenersSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SShotListenersSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -12327,14 +12114,14 @@ static_assert(alignof(SShotListenersSaveData) == 0x8, "Wrong alignment for SShot
 class alignas(4) SItsATrapSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SItsATrapSaveData& p_Other) const;
+	bool operator==(const SItsATrapSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItsATrapSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -12349,14 +12136,12 @@ static_assert(alignof(SItsATrapSaveData) == 0x4, "Wrong alignment for SItsATrapS
 class alignas(8) STrapsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STrapsSaveData& p_Other) const;
+	bool operator==(const STrapsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STrapsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -12371,14 +12156,14 @@ static_assert(alignof(STrapsSaveData) == 0x8, "Wrong alignment for STrapsSaveDat
 class alignas(4) SMathLerpSaveData_float32
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMathLerpSaveData_float32& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMathLerpSaveData_float32& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpSaveData_float32& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_A; // 0x0
@@ -12395,14 +12180,12 @@ static_assert(alignof(SMathLerpSaveData_float32) == 0x4, "Wrong alignment for SM
 class alignas(8) SMathLerpsSaveData_float32
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpsSaveData_float32& p_Other) const;
+	bool operator==(const SMathLerpsSaveData_float32& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpsSaveData_float32& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -12417,14 +12200,14 @@ static_assert(alignof(SMathLerpsSaveData_float32) == 0x8, "Wrong alignment for S
 class alignas(4) SMathLerpSaveData_SVector2
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpSaveData_SVector2& p_Other) const;
+	bool operator==(const SMathLerpSaveData_SVector2& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpSaveData_SVector2& p_Other) const { return !(*this == p_Other); }
 
 	SVector2 m_A; // 0x0
@@ -12441,14 +12224,12 @@ static_assert(alignof(SMathLerpSaveData_SVector2) == 0x4, "Wrong alignment for S
 class alignas(8) SMathLerpsSaveData_SVector2
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpsSaveData_SVector2& p_Other) const;
+	bool operator==(const SMathLerpsSaveData_SVector2& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpsSaveData_SVector2& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -12463,14 +12244,14 @@ static_assert(alignof(SMathLerpsSaveData_SVector2) == 0x8, "Wrong alignment for
 class alignas(4) SMathLerpSaveData_SVector3
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMathLerpSaveData_SVector3& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMathLerpSaveData_SVector3& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpSaveData_SVector3& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_A; // 0x0
@@ -12487,14 +12268,12 @@ static_assert(alignof(SMathLerpSaveData_SVector3) == 0x4, "Wrong alignment for S
 class alignas(8) SMathLerpsSaveData_SVector3
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpsSaveData_SVector3& p_Other) const;
+	bool operator==(const SMathLerpsSaveData_SVector3& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpsSaveData_SVector3& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -12509,14 +12288,14 @@ static_assert(alignof(SMathLerpsSaveData_SVector3) == 0x8, "Wrong alignment for
 class alignas(4) SMathLerpSaveData_SVector4
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpSaveData_SVector4& p_Other) const;
+	bool operator==(const SMathLerpSaveData_SVector4& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpSaveData_SVector4& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 m_A; // 0x0
@@ -12533,14 +12312,12 @@ static_assert(alignof(SMathLerpSaveData_SVector4) == 0x4, "Wrong alignment for S
 class alignas(8) SMathLerpsSaveData_SVector4
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpsSaveData_SVector4& p_Other) const;
+	bool operator==(const SMathLerpsSaveData_SVector4& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpsSaveData_SVector4& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -12555,14 +12332,14 @@ static_assert(alignof(SMathLerpsSaveData_SVector4) == 0x8, "Wrong alignment for
 class alignas(4) SMathLerpSaveData_SColorRGB
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMathLerpSaveData_SColorRGB& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMathLerpSaveData_SColorRGB& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpSaveData_SColorRGB& p_Other) const { return !(*this == p_Other); }
 
 	SColorRGB m_A; // 0x0
@@ -12579,14 +12356,12 @@ static_assert(alignof(SMathLerpSaveData_SColorRGB) == 0x4, "Wrong alignment for
 class alignas(8) SMathLerpsSaveData_SColorRGB
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpsSaveData_SColorRGB& p_Other) const;
+	bool operator==(const SMathLerpsSaveData_SColorRGB& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpsSaveData_SColorRGB& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -12601,14 +12376,14 @@ static_assert(alignof(SMathLerpsSaveData_SColorRGB) == 0x8, "Wrong alignment for
 class alignas(4) SMathLerpSaveData_SColorRGBA
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpSaveData_SColorRGBA& p_Other) const;
+	bool operator==(const SMathLerpSaveData_SColorRGBA& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpSaveData_SColorRGBA& p_Other) const { return !(*this == p_Other); }
 
 	SColorRGBA m_A; // 0x0
@@ -12625,14 +12400,12 @@ static_assert(alignof(SMathLerpSaveData_SColorRGBA) == 0x4, "Wrong alignment for
 class alignas(8) SMathLerpsSaveData_SColorRGBA
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpsSaveData_SColorRGBA& p_Other) const;
+	bool operator==(const SMathLerpsSaveData_SColorRGBA& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpsSaveData_SColorRGBA& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -12647,14 +12420,12 @@ static_assert(alignof(SMathLerpsSaveData_SColorRGBA) == 0x8, "Wrong alignment fo
 class alignas(8) SGameEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGameEntitySaveData& p_Other) const;
+	bool operator==(const SGameEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGameEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	SDoorsSaveData m_DoorData; // 0x0
@@ -12831,14 +12602,14 @@ enum class eAmmoType : int32_t
 class alignas(4) STimerEntityCommandSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STimerEntityCommandSaveData& p_Other) const;
+	bool operator==(const STimerEntityCommandSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STimerEntityCommandSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ETimerEntityCommandType m_eType; // 0x0
@@ -12855,14 +12626,14 @@ static_assert(alignof(STimerEntityCommandSaveData) == 0x4, "Wrong alignment for
 class alignas(4) STimerEntityStateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const STimerEntityStateSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const STimerEntityStateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STimerEntityStateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -12879,14 +12650,12 @@ static_assert(alignof(STimerEntityStateSaveData) == 0x4, "Wrong alignment for ST
 class alignas(8) SGameTimersSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGameTimersSaveData& p_Other) const;
+	bool operator==(const SGameTimersSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGameTimersSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<STimerEntityCommandSaveData> m_aTimerEntityCommands; // 0x0
@@ -12903,14 +12672,14 @@ static_assert(alignof(SGameTimersSaveData) == 0x8, "Wrong alignment for SGameTim
 class alignas(4) SLightSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLightSaveData& p_Other) const;
+	bool operator==(const SLightSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLightSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -12931,14 +12700,14 @@ static_assert(alignof(SLightSaveData) == 0x4, "Wrong alignment for SLightSaveDat
 class alignas(4) SPostfilterParametersSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SPostfilterParametersSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SPostfilterParametersSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPostfilterParametersSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -13001,14 +12770,14 @@ static_assert(alignof(SPostfilterParametersSaveData) == 0x4, "Wrong alignment fo
 class alignas(4) SRenderMaterialSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRenderMaterialSaveData& p_Other) const;
+	bool operator==(const SRenderMaterialSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRenderMaterialSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -13025,14 +12794,14 @@ static_assert(alignof(SRenderMaterialSaveData) == 0x4, "Wrong alignment for SRen
 class alignas(4) SParticleEmitterSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SParticleEmitterSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SParticleEmitterSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SParticleEmitterSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -13055,14 +12824,14 @@ static_assert(alignof(SParticleEmitterSaveData) == 0x4, "Wrong alignment for SPa
 class alignas(4) SGateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGateSaveData& p_Other) const;
+	bool operator==(const SGateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -13079,14 +12848,12 @@ static_assert(alignof(SGateSaveData) == 0x4, "Wrong alignment for SGateSaveData"
 class alignas(8) SGameplayRenderablesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGameplayRenderablesSaveData& p_Other) const;
+	bool operator==(const SGameplayRenderablesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGameplayRenderablesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SLightSaveData> m_aLightData; // 0x0
@@ -13111,14 +12878,12 @@ static_assert(alignof(SGameplayRenderablesSaveData) == 0x8, "Wrong alignment for
 class alignas(16) SGetHelpGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGetHelpGroupSaveData& p_Other) const;
+	bool operator==(const SGetHelpGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGetHelpGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float4 m_vLastKnownTargetPosition; // 0x0
@@ -13159,14 +12924,14 @@ static_assert(alignof(SGetHelpGroupSaveData) == 0x10, "Wrong alignment for SGetH
 class alignas(4) SGetHelpOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SGetHelpOrderSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SGetHelpOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGetHelpOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	EAISharedEventType m_helpType; // 0x0
@@ -13181,14 +12946,14 @@ static_assert(alignof(SGetHelpOrderSaveData) == 0x4, "Wrong alignment for SGetHe
 class alignas(4) SHelpingActorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHelpingActorSaveData& p_Other) const;
+	bool operator==(const SHelpingActorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHelpingActorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nLocationKnowledgeIndex; // 0x0
@@ -13203,14 +12968,12 @@ static_assert(alignof(SHelpingActorSaveData) == 0x4, "Wrong alignment for SHelpi
 class alignas(8) SHelpingActorRequestSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHelpingActorRequestSaveData& p_Other) const;
+	bool operator==(const SHelpingActorRequestSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHelpingActorRequestSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aCandidates; // 0x0
@@ -13225,14 +12988,12 @@ static_assert(alignof(SHelpingActorRequestSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SGetHelpServiceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGetHelpServiceSaveData& p_Other) const;
+	bool operator==(const SGetHelpServiceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGetHelpServiceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SHelpingActorSaveData> m_aHelpingActors; // 0x0
@@ -13247,14 +13008,14 @@ static_assert(alignof(SGetHelpServiceSaveData) == 0x8, "Wrong alignment for SGet
 class alignas(4) SGuardBodySituationMemberSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGuardBodySituationMemberSaveData& p_Other) const;
+	bool operator==(const SGuardBodySituationMemberSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGuardBodySituationMemberSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bHasThingsTodo; // 0x0
@@ -13271,14 +13032,14 @@ static_assert(alignof(SGuardBodySituationMemberSaveData) == 0x4, "Wrong alignmen
 class alignas(1) SGuardBodySituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SGuardBodySituationSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SGuardBodySituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGuardBodySituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bBystanderFieldsFailed; // 0x0
@@ -13297,14 +13058,14 @@ static_assert(alignof(SGuardBodySituationSaveData) == 0x1, "Wrong alignment for
 class alignas(8) SGuardPointGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGuardPointGroupSaveData& p_Other) const;
+	bool operator==(const SGuardPointGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGuardPointGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bGroupEngaged; // 0x0
@@ -13323,14 +13084,14 @@ static_assert(alignof(SGuardPointGroupSaveData) == 0x8, "Wrong alignment for SGu
 class alignas(4) SGuardPointOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SGuardPointOrderSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SGuardPointOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGuardPointOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_guardPoint; // 0x0
@@ -13345,14 +13106,14 @@ static_assert(alignof(SGuardPointOrderSaveData) == 0x4, "Wrong alignment for SGu
 class alignas(1) SHM5CrippleBoxSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHM5CrippleBoxSaveData& p_Other) const;
+	bool operator==(const SHM5CrippleBoxSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHM5CrippleBoxSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bInSequence; // 0x0
@@ -13471,14 +13232,12 @@ static_assert(alignof(SHM5CrippleBoxSaveData) == 0x1, "Wrong alignment for SHM5C
 class alignas(8) SHUDPromptDisplayInfo
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHUDPromptDisplayInfo& p_Other) const;
+	bool operator==(const SHUDPromptDisplayInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHUDPromptDisplayInfo& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bActive; // 0x0
@@ -13517,14 +13276,12 @@ static_assert(alignof(SHUDPromptDisplayInfo) == 0x8, "Wrong alignment for SHUDPr
 class alignas(8) SHUDPromptDisplayInfoArray_Dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHUDPromptDisplayInfoArray_Dummy& p_Other) const;
+	bool operator==(const SHUDPromptDisplayInfoArray_Dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHUDPromptDisplayInfoArray_Dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SHUDPromptDisplayInfo> dummy; // 0x0
@@ -13537,14 +13294,14 @@ static_assert(alignof(SHUDPromptDisplayInfoArray_Dummy) == 0x8, "Wrong alignment
 class alignas(4) SHUDTimerControllerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SHUDTimerControllerSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SHUDTimerControllerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHUDTimerControllerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_pCurrentInstance; // 0x0
@@ -13602,14 +13359,14 @@ public:
 class alignas(4) SHUDVisibilityController2SaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHUDVisibilityController2SaveData& p_Other) const;
+	bool operator==(const SHUDVisibilityController2SaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHUDVisibilityController2SaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZHUDUIRoot::EHUDVisibility m_eCurrentRequest; // 0x0
@@ -13622,14 +13379,14 @@ static_assert(alignof(SHUDVisibilityController2SaveData) == 0x4, "Wrong alignmen
 class alignas(8) SHandleClosetGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SHandleClosetGroupSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SHandleClosetGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHandleClosetGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_pProcessingMember; // 0x0
@@ -13673,14 +13430,14 @@ public:
 class alignas(4) SHeroEscortSituationActorStateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHeroEscortSituationActorStateSaveData& p_Other) const;
+	bool operator==(const SHeroEscortSituationActorStateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHeroEscortSituationActorStateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nID; // 0x0
@@ -13705,14 +13462,14 @@ static_assert(alignof(SHeroEscortSituationActorStateSaveData) == 0x4, "Wrong ali
 class alignas(4) SHeroEscortSituationActors
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHeroEscortSituationActors& p_Other) const;
+	bool operator==(const SHeroEscortSituationActors& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHeroEscortSituationActors& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -13725,14 +13482,14 @@ static_assert(alignof(SHeroEscortSituationActors) == 0x4, "Wrong alignment for S
 class alignas(4) SHeroItemActionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SHeroItemActionSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SHeroItemActionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHeroItemActionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rItem; // 0x0
@@ -13745,14 +13502,14 @@ static_assert(alignof(SHeroItemActionSaveData) == 0x4, "Wrong alignment for SHer
 class alignas(4) SHeroItemAttachmentSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHeroItemAttachmentSaveData& p_Other) const;
+	bool operator==(const SHeroItemAttachmentSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHeroItemAttachmentSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rItem; // 0x0
@@ -13765,14 +13522,14 @@ static_assert(alignof(SHeroItemAttachmentSaveData) == 0x4, "Wrong alignment for
 class alignas(4) SHeroStandInSaveState
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SHeroStandInSaveState& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SHeroStandInSaveState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHeroStandInSaveState& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rCurrentSpeakEntity; // 0x0
@@ -13787,14 +13544,14 @@ static_assert(alignof(SHeroStandInSaveState) == 0x4, "Wrong alignment for SHeroS
 class alignas(4) SHintEntrySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHintEntrySaveData& p_Other) const;
+	bool operator==(const SHintEntrySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHintEntrySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsValid; // 0x0
@@ -13811,14 +13568,12 @@ static_assert(alignof(SHintEntrySaveData) == 0x4, "Wrong alignment for SHintEntr
 class alignas(8) SHintManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHintManagerSaveData& p_Other) const;
+	bool operator==(const SHintManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHintManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SHintEntrySaveData m_activeHint; // 0x0
@@ -13835,14 +13590,14 @@ static_assert(alignof(SHintManagerSaveData) == 0x8, "Wrong alignment for SHintMa
 class alignas(8) SHudMissionTimerControllerData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHudMissionTimerControllerData& p_Other) const;
+	bool operator==(const SHudMissionTimerControllerData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHudMissionTimerControllerData& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_fScoreGameTimeStart; // 0x0
@@ -13857,14 +13612,14 @@ static_assert(alignof(SHudMissionTimerControllerData) == 0x8, "Wrong alignment f
 class alignas(8) SHumanShieldGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SHumanShieldGroupSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SHumanShieldGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHumanShieldGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_pLeader; // 0x0
@@ -13893,14 +13648,12 @@ static_assert(alignof(SHumanShieldGroupSaveData) == 0x8, "Wrong alignment for SH
 class alignas(8) SIntelData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SIntelData& p_Other) const;
+	bool operator==(const SIntelData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SIntelData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sHeadline; // 0x0
@@ -13919,14 +13672,12 @@ static_assert(alignof(SIntelData) == 0x8, "Wrong alignment for SIntelData");
 class alignas(8) SIntelDataArray_dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SIntelDataArray_dummy& p_Other) const;
+	bool operator==(const SIntelDataArray_dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SIntelDataArray_dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SIntelData> dummy; // 0x0
@@ -13939,14 +13690,12 @@ static_assert(alignof(SIntelDataArray_dummy) == 0x8, "Wrong alignment for SIntel
 class alignas(8) SIntelDisplayInfo
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SIntelDisplayInfo& p_Other) const;
+	bool operator==(const SIntelDisplayInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SIntelDisplayInfo& p_Other) const { return !(*this == p_Other); }
 
 	int32 index; // 0x0
@@ -13971,14 +13720,12 @@ static_assert(alignof(SIntelDisplayInfo) == 0x8, "Wrong alignment for SIntelDisp
 class alignas(8) SIntelDisplayInfoArray_dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SIntelDisplayInfoArray_dummy& p_Other) const;
+	bool operator==(const SIntelDisplayInfoArray_dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SIntelDisplayInfoArray_dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SIntelDisplayInfo> dummy; // 0x0
@@ -13991,14 +13738,12 @@ static_assert(alignof(SIntelDisplayInfoArray_dummy) == 0x8, "Wrong alignment for
 class alignas(8) SIntelListDisplayInfo
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SIntelListDisplayInfo& p_Other) const;
+	bool operator==(const SIntelListDisplayInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SIntelListDisplayInfo& p_Other) const { return !(*this == p_Other); }
 
 	int32 index; // 0x0
@@ -14017,14 +13762,12 @@ static_assert(alignof(SIntelListDisplayInfo) == 0x8, "Wrong alignment for SIntel
 class alignas(8) SIntelListDisplayInfoArray_dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SIntelListDisplayInfoArray_dummy& p_Other) const;
+	bool operator==(const SIntelListDisplayInfoArray_dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SIntelListDisplayInfoArray_dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SIntelListDisplayInfo> dummy; // 0x0
@@ -14037,14 +13780,14 @@ static_assert(alignof(SIntelListDisplayInfoArray_dummy) == 0x8, "Wrong alignment
 class alignas(4) SIntelSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SIntelSaveData& p_Other) const;
+	bool operator==(const SIntelSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SIntelSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rCurrentStage; // 0x0
@@ -14065,14 +13808,12 @@ static_assert(alignof(SIntelSaveData) == 0x4, "Wrong alignment for SIntelSaveDat
 class alignas(8) SInteractionIndicatorInstanceData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SInteractionIndicatorInstanceData& p_Other) const;
+	bool operator==(const SInteractionIndicatorInstanceData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SInteractionIndicatorInstanceData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_eState; // 0x0
@@ -14117,14 +13858,12 @@ static_assert(alignof(SInteractionIndicatorInstanceData) == 0x8, "Wrong alignmen
 class alignas(8) SInteractionIndicatorInstanceDataArray_Dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SInteractionIndicatorInstanceDataArray_Dummy& p_Other) const;
+	bool operator==(const SInteractionIndicatorInstanceDataArray_Dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SInteractionIndicatorInstanceDataArray_Dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SInteractionIndicatorInstanceData> dummy; // 0x0
@@ -14137,14 +13876,14 @@ static_assert(alignof(SInteractionIndicatorInstanceDataArray_Dummy) == 0x8, "Wro
 class alignas(4) SInventoryControllerItemSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SInventoryControllerItemSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SInventoryControllerItemSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SInventoryControllerItemSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rItemEntity; // 0x0
@@ -14161,14 +13900,14 @@ static_assert(alignof(SInventoryControllerItemSaveData) == 0x4, "Wrong alignment
 class alignas(4) SStoredSlotSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SStoredSlotSaveData& p_Other) const;
+	bool operator==(const SStoredSlotSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SStoredSlotSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_iStoredInventorySlotIndex; // 0x0
@@ -14185,14 +13924,12 @@ static_assert(alignof(SStoredSlotSaveData) == 0x4, "Wrong alignment for SStoredS
 class alignas(8) SInventoryControllerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SInventoryControllerSaveData& p_Other) const;
+	bool operator==(const SInventoryControllerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SInventoryControllerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SInventoryControllerItemSaveData> m_aItems; // 0x0
@@ -14248,14 +13985,14 @@ public:
 	class alignas(4) SDialogLines
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SDialogLines& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SDialogLines& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SDialogLines& p_Other) const { return !(*this == p_Other); }
 
 		SActorSoundDefs::EDefinition m_eFirstWarning; // 0x0
@@ -14286,14 +14023,14 @@ public:
 	class alignas(16) SMoveToOrderSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SMoveToOrderSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SMoveToOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SMoveToOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 		float4 m_vStopDirection; // 0x0
@@ -14332,14 +14069,14 @@ public:
 class alignas(16) SInvestigateDisguiseGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SInvestigateDisguiseGroupSaveData& p_Other) const;
+	bool operator==(const SInvestigateDisguiseGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SInvestigateDisguiseGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZInvestigateDisguiseGroup::EState m_state; // 0x0
@@ -14396,14 +14133,12 @@ static_assert(alignof(SInvestigateDisguiseGroupSaveData) == 0x10, "Wrong alignme
 class alignas(8) SInvestigateWeaponGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SInvestigateWeaponGroupSaveData& p_Other) const;
+	bool operator==(const SInvestigateWeaponGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SInvestigateWeaponGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rTarget; // 0x0
@@ -14428,14 +14163,12 @@ static_assert(alignof(SInvestigateWeaponGroupSaveData) == 0x8, "Wrong alignment
 class alignas(4) SItemOnBackUIData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SItemOnBackUIData& p_Other) const;
+	bool operator==(const SItemOnBackUIData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemOnBackUIData& p_Other) const { return !(*this == p_Other); }
 
 	ZRuntimeResourceID icon; // 0x0
@@ -14454,14 +14187,14 @@ static_assert(alignof(SItemOnBackUIData) == 0x4, "Wrong alignment for SItemOnBac
 class alignas(1) SItemSpawnerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SItemSpawnerSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SItemSpawnerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemSpawnerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bItemUpdateTransformChange; // 0x0
@@ -14474,14 +14207,14 @@ static_assert(alignof(SItemSpawnerSaveData) == 0x1, "Wrong alignment for SItemSp
 class alignas(4) SItemStorageSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SItemStorageSaveData& p_Other) const;
+	bool operator==(const SItemStorageSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemStorageSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_ContainedItem; // 0x0
@@ -14496,14 +14229,14 @@ static_assert(alignof(SItemStorageSaveData) == 0x4, "Wrong alignment for SItemSt
 class alignas(2) SItemWeaponSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SItemWeaponSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SItemWeaponSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemWeaponSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint16 m_nBulletsInMagazine; // 0x0
@@ -14518,14 +14251,14 @@ static_assert(alignof(SItemWeaponSaveData) == 0x2, "Wrong alignment for SItemWea
 class alignas(4) SKeywordSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SKeywordSaveData& p_Other) const;
+	bool operator==(const SKeywordSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SKeywordSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_HolderSaveableId; // 0x0
@@ -14540,14 +14273,14 @@ static_assert(alignof(SKeywordSaveData) == 0x4, "Wrong alignment for SKeywordSav
 class alignas(1) SLayerBehaviorConfiguration
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLayerBehaviorConfiguration& p_Other) const;
+	bool operator==(const SLayerBehaviorConfiguration& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLayerBehaviorConfiguration& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bTrigger; // 0x0
@@ -14588,14 +14321,14 @@ public:
 class alignas(4) SLeadEscortSituationActorStateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SLeadEscortSituationActorStateSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SLeadEscortSituationActorStateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLeadEscortSituationActorStateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nID; // 0x0
@@ -14620,14 +14353,14 @@ static_assert(alignof(SLeadEscortSituationActorStateSaveData) == 0x4, "Wrong ali
 class alignas(4) SLeadEscortSituationActors
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLeadEscortSituationActors& p_Other) const;
+	bool operator==(const SLeadEscortSituationActors& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLeadEscortSituationActors& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -14640,14 +14373,12 @@ static_assert(alignof(SLeadEscortSituationActors) == 0x4, "Wrong alignment for S
 class alignas(8) SLeadEscortSituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLeadEscortSituationSaveData& p_Other) const;
+	bool operator==(const SLeadEscortSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLeadEscortSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bActivated; // 0x0
@@ -14688,14 +14419,12 @@ static_assert(alignof(SLeadEscortSituationSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SLevelReferenceableEntitieSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLevelReferenceableEntitieSaveData& p_Other) const;
+	bool operator==(const SLevelReferenceableEntitieSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLevelReferenceableEntitieSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sSceneResource; // 0x0
@@ -14710,14 +14439,14 @@ static_assert(alignof(SLevelReferenceableEntitieSaveData) == 0x8, "Wrong alignme
 class alignas(4) SSoundAmbienceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SSoundAmbienceSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SSoundAmbienceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSoundAmbienceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rCurrentAmbience; // 0x0
@@ -14738,14 +14467,12 @@ static_assert(alignof(SSoundAmbienceSaveData) == 0x4, "Wrong alignment for SSoun
 class alignas(8) SObjetiveSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SObjetiveSaveData& p_Other) const;
+	bool operator==(const SObjetiveSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SObjetiveSaveData& p_Other) const { return !(*this == p_Other); }
 
 	IContractObjective::Type m_eType; // 0x0
@@ -14760,14 +14487,14 @@ static_assert(alignof(SObjetiveSaveData) == 0x8, "Wrong alignment for SObjetiveS
 class alignas(1) SLightFlickerEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLightFlickerEntitySaveData& p_Other) const;
+	bool operator==(const SLightFlickerEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLightFlickerEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bLightOn; // 0x0
@@ -14782,14 +14509,12 @@ static_assert(alignof(SLightFlickerEntitySaveData) == 0x1, "Wrong alignment for
 class alignas(8) SLoadRuntimeResourceResult
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLoadRuntimeResourceResult& p_Other) const;
+	bool operator==(const SLoadRuntimeResourceResult& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLoadRuntimeResourceResult& p_Other) const { return !(*this == p_Other); }
 
 	ZString sFilePath; // 0x0
@@ -14802,14 +14527,12 @@ static_assert(alignof(SLoadRuntimeResourceResult) == 0x8, "Wrong alignment for S
 class alignas(8) SLocalizedVideoData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLocalizedVideoData& p_Other) const;
+	bool operator==(const SLocalizedVideoData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLocalizedVideoData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<ZString> AudioLanguages; // 0x0
@@ -14828,14 +14551,14 @@ static_assert(alignof(SLocalizedVideoData) == 0x8, "Wrong alignment for SLocaliz
 class alignas(8) SLockdownManagerAIZoneSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLockdownManagerAIZoneSaveData& p_Other) const;
+	bool operator==(const SLockdownManagerAIZoneSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLockdownManagerAIZoneSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_tExpiry; // 0x0
@@ -14852,14 +14575,12 @@ static_assert(alignof(SLockdownManagerAIZoneSaveData) == 0x8, "Wrong alignment f
 class alignas(8) SLockdownManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLockdownManagerSaveData& p_Other) const;
+	bool operator==(const SLockdownManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLockdownManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SLockdownManagerAIZoneSaveData> m_aAIZones; // 0x0
@@ -14872,14 +14593,12 @@ static_assert(alignof(SLockdownManagerSaveData) == 0x8, "Wrong alignment for SLo
 class alignas(8) SManHuntServiceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SManHuntServiceSaveData& p_Other) const;
+	bool operator==(const SManHuntServiceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SManHuntServiceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint16> m_rGuardNodes; // 0x0
@@ -14896,14 +14615,12 @@ static_assert(alignof(SManHuntServiceSaveData) == 0x8, "Wrong alignment for SMan
 class alignas(8) SMapMarkerData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMapMarkerData& p_Other) const;
+	bool operator==(const SMapMarkerData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMapMarkerData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SVector2> pathPoints; // 0x0
@@ -14916,14 +14633,14 @@ static_assert(alignof(SMapMarkerData) == 0x8, "Wrong alignment for SMapMarkerDat
 class alignas(4) SMatrix33
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMatrix33& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMatrix33& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMatrix33& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 XAxis; // 0x0
@@ -14940,14 +14657,14 @@ static_assert(alignof(SMatrix33) == 0x4, "Wrong alignment for SMatrix33");
 class alignas(4) SMatrix44
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMatrix44& p_Other) const;
+	bool operator==(const SMatrix44& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMatrix44& p_Other) const { return !(*this == p_Other); }
 
 	float32 m11; // 0x0
@@ -14990,14 +14707,14 @@ static_assert(alignof(SMatrix44) == 0x4, "Wrong alignment for SMatrix44");
 class alignas(4) SMovementAgilitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMovementAgilitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMovementAgilitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementAgilitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rLedgeGuide; // 0x0
@@ -15020,14 +14737,14 @@ static_assert(alignof(SMovementAgilitySaveData) == 0x4, "Wrong alignment for SMo
 class alignas(16) SMovementCoverSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMovementCoverSaveData& p_Other) const;
+	bool operator==(const SMovementCoverSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementCoverSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rCoverPlane; // 0x0
@@ -15048,14 +14765,14 @@ static_assert(alignof(SMovementCoverSaveData) == 0x10, "Wrong alignment for SMov
 class alignas(4) SMovementDisguiseSafeZoneSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMovementDisguiseSafeZoneSaveData& p_Other) const;
+	bool operator==(const SMovementDisguiseSafeZoneSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementDisguiseSafeZoneSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rSafeZone; // 0x0
@@ -15070,14 +14787,14 @@ static_assert(alignof(SMovementDisguiseSafeZoneSaveData) == 0x4, "Wrong alignmen
 class alignas(4) SMovementDragBodySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMovementDragBodySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMovementDragBodySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementDragBodySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rDraggedActor; // 0x0
@@ -15092,14 +14809,14 @@ static_assert(alignof(SMovementDragBodySaveData) == 0x4, "Wrong alignment for SM
 class alignas(4) SMovementDrainPipeSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMovementDrainPipeSaveData& p_Other) const;
+	bool operator==(const SMovementDrainPipeSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementDrainPipeSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rDrainPipe; // 0x0
@@ -15112,14 +14829,14 @@ static_assert(alignof(SMovementDrainPipeSaveData) == 0x4, "Wrong alignment for S
 class alignas(4) SMovementHideInClosetSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMovementHideInClosetSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMovementHideInClosetSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementHideInClosetSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ICloset::EClosetType m_eCurrentClosetType; // 0x0
@@ -15134,14 +14851,14 @@ static_assert(alignof(SMovementHideInClosetSaveData) == 0x4, "Wrong alignment fo
 class alignas(4) SMovementLadderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMovementLadderSaveData& p_Other) const;
+	bool operator==(const SMovementLadderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementLadderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rLadder; // 0x0
@@ -15154,14 +14871,14 @@ static_assert(alignof(SMovementLadderSaveData) == 0x4, "Wrong alignment for SMov
 class alignas(1) SMovementLocomotionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMovementLocomotionSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMovementLocomotionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementLocomotionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsSneaking; // 0x0
@@ -15174,14 +14891,14 @@ static_assert(alignof(SMovementLocomotionSaveData) == 0x1, "Wrong alignment for
 class alignas(4) SMusicGridData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMusicGridData& p_Other) const;
+	bool operator==(const SMusicGridData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMusicGridData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fGridDurationSec; // 0x0
@@ -15196,14 +14913,14 @@ static_assert(alignof(SMusicGridData) == 0x4, "Wrong alignment for SMusicGridDat
 class alignas(4) SNRange
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SNRange& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SNRange& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SNRange& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nMin; // 0x0
@@ -15218,14 +14935,12 @@ static_assert(alignof(SNRange) == 0x4, "Wrong alignment for SNRange");
 class alignas(8) SObserversGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SObserversGroupSaveData& p_Other) const;
+	bool operator==(const SObserversGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SObserversGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_target; // 0x0
@@ -15242,14 +14957,12 @@ static_assert(alignof(SObserversGroupSaveData) == 0x8, "Wrong alignment for SObs
 class alignas(8) SOnlineEvent
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SOnlineEvent& p_Other) const;
+	bool operator==(const SOnlineEvent& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SOnlineEvent& p_Other) const { return !(*this == p_Other); }
 
 	ZString sName; // 0x0
@@ -15264,14 +14977,12 @@ static_assert(alignof(SOnlineEvent) == 0x8, "Wrong alignment for SOnlineEvent");
 class alignas(8) SOptionValueSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SOptionValueSaveData& p_Other) const;
+	bool operator==(const SOptionValueSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SOptionValueSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZVariant m_Value; // 0x0
@@ -15284,14 +14995,14 @@ static_assert(alignof(SOptionValueSaveData) == 0x8, "Wrong alignment for SOption
 class alignas(1) SPFObstactleSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPFObstactleSaveData& p_Other) const;
+	bool operator==(const SPFObstactleSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPFObstactleSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -15304,14 +15015,12 @@ static_assert(alignof(SPFObstactleSaveData) == 0x1, "Wrong alignment for SPFObst
 class alignas(8) SPackedAnimSetEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPackedAnimSetEntry& p_Other) const;
+	bool operator==(const SPackedAnimSetEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPackedAnimSetEntry& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sName; // 0x0
@@ -15328,14 +15037,14 @@ static_assert(alignof(SPackedAnimSetEntry) == 0x8, "Wrong alignment for SPackedA
 class alignas(4) SPatrolGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPatrolGroupSaveData& p_Other) const;
+	bool operator==(const SPatrolGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPatrolGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nRouteID; // 0x0
@@ -15348,14 +15057,14 @@ static_assert(alignof(SPatrolGroupSaveData) == 0x4, "Wrong alignment for SPatrol
 class alignas(4) SPerceptibleCrowdBodySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SPerceptibleCrowdBodySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SPerceptibleCrowdBodySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPerceptibleCrowdBodySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rCombatZone; // 0x0
@@ -15370,14 +15079,12 @@ static_assert(alignof(SPerceptibleCrowdBodySaveData) == 0x4, "Wrong alignment fo
 class alignas(8) SPersistentEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPersistentEntitySaveData& p_Other) const;
+	bool operator==(const SPersistentEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPersistentEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint64 m_nResourceId; // 0x0
@@ -15392,14 +15099,12 @@ static_assert(alignof(SPersistentEntitySaveData) == 0x8, "Wrong alignment for SP
 class alignas(8) SPersistentEntitySaveDataList
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPersistentEntitySaveDataList& p_Other) const;
+	bool operator==(const SPersistentEntitySaveDataList& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPersistentEntitySaveDataList& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SPersistentEntitySaveData> m_aEntityDatas; // 0x0
@@ -15412,14 +15117,14 @@ static_assert(alignof(SPersistentEntitySaveDataList) == 0x8, "Wrong alignment fo
 class alignas(1) SPhysicsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPhysicsSaveData& p_Other) const;
+	bool operator==(const SPhysicsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPhysicsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsInPhysicsWorld; // 0x0
@@ -15436,14 +15141,12 @@ static_assert(alignof(SPhysicsSaveData) == 0x1, "Wrong alignment for SPhysicsSav
 class alignas(8) SPhysicsListSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPhysicsListSaveData& p_Other) const;
+	bool operator==(const SPhysicsListSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPhysicsListSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntityRefs; // 0x0
@@ -15458,14 +15161,14 @@ static_assert(alignof(SPhysicsListSaveData) == 0x8, "Wrong alignment for SPhysic
 class alignas(16) SPrivateAreaSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SPrivateAreaSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SPrivateAreaSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPrivateAreaSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsInside; // 0x0
@@ -15488,14 +15191,14 @@ static_assert(alignof(SPrivateAreaSaveData) == 0x10, "Wrong alignment for SPriva
 class alignas(4) SRandomTimerEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRandomTimerEntitySaveData& p_Other) const;
+	bool operator==(const SRandomTimerEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRandomTimerEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -15516,14 +15219,12 @@ static_assert(alignof(SRandomTimerEntitySaveData) == 0x4, "Wrong alignment for S
 class alignas(8) SRandomTimerEntitiesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRandomTimerEntitiesSaveData& p_Other) const;
+	bool operator==(const SRandomTimerEntitiesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRandomTimerEntitiesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15538,14 +15239,12 @@ static_assert(alignof(SRandomTimerEntitiesSaveData) == 0x8, "Wrong alignment for
 class alignas(8) ZBitArray
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZBitArray& p_Other) const;
+	bool operator==(const ZBitArray& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZBitArray& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint8> m_aBytes; // 0x0
@@ -15560,14 +15259,12 @@ static_assert(alignof(ZBitArray) == 0x8, "Wrong alignment for ZBitArray");
 class alignas(16) SReasoningGrid
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SReasoningGrid& p_Other) const;
+	bool operator==(const SReasoningGrid& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SReasoningGrid& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SGWaypoint> m_WaypointList; // 0x0
@@ -15592,14 +15289,14 @@ static_assert(alignof(SReasoningGrid) == 0x10, "Wrong alignment for SReasoningGr
 class alignas(8) SRecoverUnconsciousGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRecoverUnconsciousGroupSaveData& p_Other) const;
+	bool operator==(const SRecoverUnconsciousGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRecoverUnconsciousGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -15624,14 +15321,14 @@ static_assert(alignof(SRecoverUnconsciousGroupSaveData) == 0x8, "Wrong alignment
 class alignas(1) SRemoteControlReceiverSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SRemoteControlReceiverSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SRemoteControlReceiverSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRemoteControlReceiverSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -15648,14 +15345,14 @@ static_assert(alignof(SRemoteControlReceiverSaveData) == 0x1, "Wrong alignment f
 class alignas(8) SRenderVideoPlayerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRenderVideoPlayerSaveData& p_Other) const;
+	bool operator==(const SRenderVideoPlayerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRenderVideoPlayerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bPlaying; // 0x0
@@ -15686,14 +15383,14 @@ static_assert(alignof(SRenderVideoPlayerSaveData) == 0x8, "Wrong alignment for S
 class alignas(1) SRepositionOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SRepositionOrderSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SRepositionOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRepositionOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bStrafe; // 0x0
@@ -15708,14 +15405,14 @@ static_assert(alignof(SRepositionOrderSaveData) == 0x1, "Wrong alignment for SRe
 class alignas(4) SRotateEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRotateEntitySaveData& p_Other) const;
+	bool operator==(const SRotateEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRotateEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -15734,14 +15431,12 @@ static_assert(alignof(SRotateEntitySaveData) == 0x4, "Wrong alignment for SRotat
 class alignas(8) SSavableData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSavableData& p_Other) const;
+	bool operator==(const SSavableData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSavableData& p_Other) const { return !(*this == p_Other); }
 
 	ZVariant m_EntitiesData; // 0x0
@@ -15758,14 +15453,12 @@ static_assert(alignof(SSavableData) == 0x8, "Wrong alignment for SSavableData");
 class alignas(8) SVariantStruct
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVariantStruct& p_Other) const;
+	bool operator==(const SVariantStruct& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVariantStruct& p_Other) const { return !(*this == p_Other); }
 
 	ZVariant m_Data; // 0x0
@@ -15778,14 +15471,12 @@ static_assert(alignof(SVariantStruct) == 0x8, "Wrong alignment for SVariantStruc
 class alignas(8) SSavableEntitiesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSavableEntitiesSaveData& p_Other) const;
+	bool operator==(const SSavableEntitiesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSavableEntitiesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15800,14 +15491,12 @@ static_assert(alignof(SSavableEntitiesSaveData) == 0x8, "Wrong alignment for SSa
 class alignas(8) SSaveGameData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSaveGameData& p_Other) const;
+	bool operator==(const SSaveGameData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSaveGameData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nVersion; // 0x0
@@ -15824,14 +15513,12 @@ static_assert(alignof(SSaveGameData) == 0x8, "Wrong alignment for SSaveGameData"
 class alignas(8) SSaveGameMetaData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSaveGameMetaData& p_Other) const;
+	bool operator==(const SSaveGameMetaData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSaveGameMetaData& p_Other) const { return !(*this == p_Other); }
 
 	uint8 nSlot; // 0x0
@@ -15864,14 +15551,12 @@ static_assert(alignof(SSaveGameMetaData) == 0x8, "Wrong alignment for SSaveGameM
 class alignas(8) SSaveGameHeader
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSaveGameHeader& p_Other) const;
+	bool operator==(const SSaveGameHeader& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSaveGameHeader& p_Other) const { return !(*this == p_Other); }
 
 	uint32 nFourCC; // 0x0
@@ -15894,14 +15579,12 @@ static_assert(alignof(SSaveGameHeader) == 0x8, "Wrong alignment for SSaveGameHea
 class alignas(8) SScreenplayManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SScreenplayManagerSaveData& p_Other) const;
+	bool operator==(const SScreenplayManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SScreenplayManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SDramaActorCollectionSaveData m_DramaActorData; // 0x0
@@ -15918,14 +15601,14 @@ static_assert(alignof(SScreenplayManagerSaveData) == 0x8, "Wrong alignment for S
 class alignas(2) SSecuritySystemCameraSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSecuritySystemCameraSaveData& p_Other) const;
+	bool operator==(const SSecuritySystemCameraSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSecuritySystemCameraSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint16 m_nEscalation; // 0x0
@@ -15946,14 +15629,14 @@ static_assert(alignof(SSecuritySystemCameraSaveData) == 0x2, "Wrong alignment fo
 class alignas(1) SSecuritySystemRecorderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SSecuritySystemRecorderSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SSecuritySystemRecorderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSecuritySystemRecorderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bHasRecordings; // 0x0
@@ -15968,14 +15651,14 @@ static_assert(alignof(SSecuritySystemRecorderSaveData) == 0x1, "Wrong alignment
 class alignas(8) SSentryGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSentryGroupSaveData& p_Other) const;
+	bool operator==(const SSentryGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSentryGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rTarget; // 0x0
@@ -16002,14 +15685,14 @@ static_assert(alignof(SSentryGroupSaveData) == 0x8, "Wrong alignment for SSentry
 class alignas(4) SSentryOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SSentryOrderSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SSentryOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSentryOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rSentryZone; // 0x0
@@ -16022,14 +15705,12 @@ static_assert(alignof(SSentryOrderSaveData) == 0x4, "Wrong alignment for SSentry
 class alignas(8) SSentryZoneSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSentryZoneSaveData& p_Other) const;
+	bool operator==(const SSentryZoneSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSentryZoneSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_tGreetingCooldown; // 0x0
@@ -16092,14 +15773,12 @@ static_assert(alignof(SSentryZoneSaveData) == 0x8, "Wrong alignment for SSentryZ
 class alignas(8) SSequenceTrackSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSequenceTrackSaveData& p_Other) const;
+	bool operator==(const SSequenceTrackSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSequenceTrackSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rTrackEntity; // 0x0
@@ -16114,14 +15793,12 @@ static_assert(alignof(SSequenceTrackSaveData) == 0x8, "Wrong alignment for SSequ
 class alignas(8) SSequenceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSequenceSaveData& p_Other) const;
+	bool operator==(const SSequenceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSequenceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<ZSequenceEntity::ECommand> m_commandQueue; // 0x0
@@ -16156,14 +15833,12 @@ static_assert(alignof(SSequenceSaveData) == 0x8, "Wrong alignment for SSequenceS
 class alignas(8) SSequenceManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSequenceManagerSaveData& p_Other) const;
+	bool operator==(const SSequenceManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSequenceManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -16178,14 +15853,14 @@ static_assert(alignof(SSequenceManagerSaveData) == 0x8, "Wrong alignment for SSe
 class alignas(4) SSettingsParamMultiplier
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSettingsParamMultiplier& p_Other) const;
+	bool operator==(const SSettingsParamMultiplier& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSettingsParamMultiplier& p_Other) const { return !(*this == p_Other); }
 
 	ESettingsParam m_eSettingsParam; // 0x0
@@ -16200,14 +15875,12 @@ static_assert(alignof(SSettingsParamMultiplier) == 0x4, "Wrong alignment for SSe
 class alignas(8) SSituationConversationGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSituationConversationGroupSaveData& p_Other) const;
+	bool operator==(const SSituationConversationGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSituationConversationGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_members; // 0x0
@@ -16220,14 +15893,12 @@ static_assert(alignof(SSituationConversationGroupSaveData) == 0x8, "Wrong alignm
 class alignas(16) SSituationOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSituationOrderSaveData& p_Other) const;
+	bool operator==(const SSituationOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSituationOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sClassTypeName; // 0x0
@@ -16267,14 +15938,14 @@ public:
 class alignas(4) SSmuggleSituationActorStateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SSmuggleSituationActorStateSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SSmuggleSituationActorStateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSmuggleSituationActorStateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -16299,14 +15970,12 @@ static_assert(alignof(SSmuggleSituationActorStateSaveData) == 0x4, "Wrong alignm
 class alignas(8) SSmuggleSituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSmuggleSituationSaveData& p_Other) const;
+	bool operator==(const SSmuggleSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSmuggleSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsEnabled; // 0x0
@@ -16327,14 +15996,14 @@ static_assert(alignof(SSmuggleSituationSaveData) == 0x8, "Wrong alignment for SS
 class alignas(8) SSniperCombatGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSniperCombatGroupSaveData& p_Other) const;
+	bool operator==(const SSniperCombatGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSniperCombatGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -16355,14 +16024,14 @@ static_assert(alignof(SSniperCombatGroupSaveData) == 0x8, "Wrong alignment for S
 class alignas(1) SSpaceCollectionBehaviorConfiguration
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SSpaceCollectionBehaviorConfiguration& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SSpaceCollectionBehaviorConfiguration& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSpaceCollectionBehaviorConfiguration& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bInclusive; // 0x0
@@ -16375,14 +16044,14 @@ static_assert(alignof(SSpaceCollectionBehaviorConfiguration) == 0x1, "Wrong alig
 class alignas(4) SSpatialMoverEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSpatialMoverEntitySaveData& p_Other) const;
+	bool operator==(const SSpatialMoverEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSpatialMoverEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fSpeed; // 0x0
@@ -16403,14 +16072,14 @@ static_assert(alignof(SSpatialMoverEntitySaveData) == 0x4, "Wrong alignment for
 class alignas(4) SSpatialSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSpatialSaveData& p_Other) const;
+	bool operator==(const SSpatialSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSpatialSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bVisible; // 0x0
@@ -16427,14 +16096,14 @@ static_assert(alignof(SSpatialSaveData) == 0x4, "Wrong alignment for SSpatialSav
 class alignas(4) SSpeakEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SSpeakEntitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SSpeakEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSpeakEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fSeekPosition; // 0x0
@@ -16447,14 +16116,12 @@ static_assert(alignof(SSpeakEntitySaveData) == 0x4, "Wrong alignment for SSpeakE
 class alignas(8) SStateControllerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SStateControllerSaveData& p_Other) const;
+	bool operator==(const SStateControllerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SStateControllerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -16469,14 +16136,14 @@ static_assert(alignof(SStateControllerSaveData) == 0x8, "Wrong alignment for SSt
 class alignas(4) SStepCounterEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SStepCounterEntitySaveData& p_Other) const;
+	bool operator==(const SStepCounterEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SStepCounterEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_nIndex; // 0x0
@@ -16501,14 +16168,12 @@ static_assert(alignof(SStepCounterEntitySaveData) == 0x4, "Wrong alignment for S
 class alignas(4) SSubtitleRef
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSubtitleRef& p_Other) const;
+	bool operator==(const SSubtitleRef& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSubtitleRef& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bSubtitlesDisabled; // 0x0
@@ -16525,14 +16190,12 @@ static_assert(alignof(SSubtitleRef) == 0x4, "Wrong alignment for SSubtitleRef");
 class alignas(8) STargetInfoObjectiveCondition
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STargetInfoObjectiveCondition& p_Other) const;
+	bool operator==(const STargetInfoObjectiveCondition& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STargetInfoObjectiveCondition& p_Other) const { return !(*this == p_Other); }
 
 	ZString header; // 0x0
@@ -16553,14 +16216,12 @@ static_assert(alignof(STargetInfoObjectiveCondition) == 0x8, "Wrong alignment fo
 class alignas(8) STargetInfoDisplayData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STargetInfoDisplayData& p_Other) const;
+	bool operator==(const STargetInfoDisplayData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STargetInfoDisplayData& p_Other) const { return !(*this == p_Other); }
 
 	ZString npcName; // 0x0
@@ -16587,14 +16248,12 @@ static_assert(alignof(STargetInfoDisplayData) == 0x8, "Wrong alignment for STarg
 class alignas(8) STargetInfoDisplayData_Dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STargetInfoDisplayData_Dummy& p_Other) const;
+	bool operator==(const STargetInfoDisplayData_Dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STargetInfoDisplayData_Dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<STargetInfoDisplayData> __dummy; // 0x0
@@ -16607,14 +16266,14 @@ static_assert(alignof(STargetInfoDisplayData_Dummy) == 0x8, "Wrong alignment for
 class alignas(16) STargetTrackingSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const STargetTrackingSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const STargetTrackingSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STargetTrackingSaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_sharedTarget; // 0x0
@@ -16631,14 +16290,12 @@ static_assert(alignof(STargetTrackingSaveData) == 0x10, "Wrong alignment for STa
 class alignas(8) STargetTrackingServiceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STargetTrackingServiceSaveData& p_Other) const;
+	bool operator==(const STargetTrackingServiceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STargetTrackingServiceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<STargetTrackingSaveData> m_aTrackedTargets; // 0x0
@@ -16651,14 +16308,12 @@ static_assert(alignof(STargetTrackingServiceSaveData) == 0x8, "Wrong alignment f
 class alignas(8) STemplateSubEntity
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STemplateSubEntity& p_Other) const;
+	bool operator==(const STemplateSubEntity& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STemplateSubEntity& p_Other) const { return !(*this == p_Other); }
 
 	SEntityTemplateReference logicalParent; // 0x0
@@ -16677,14 +16332,12 @@ static_assert(alignof(STemplateSubEntity) == 0x8, "Wrong alignment for STemplate
 class alignas(8) STemplateEntity
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STemplateEntity& p_Other) const;
+	bool operator==(const STemplateEntity& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STemplateEntity& p_Other) const { return !(*this == p_Other); }
 
 	int32 subType; // 0x0
@@ -16707,14 +16360,12 @@ static_assert(alignof(STemplateEntity) == 0x8, "Wrong alignment for STemplateEnt
 class alignas(8) STemplateSubEntityBlueprint
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STemplateSubEntityBlueprint& p_Other) const;
+	bool operator==(const STemplateSubEntityBlueprint& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STemplateSubEntityBlueprint& p_Other) const { return !(*this == p_Other); }
 
 	SEntityTemplateReference logicalParent; // 0x0
@@ -16741,14 +16392,12 @@ static_assert(alignof(STemplateSubEntityBlueprint) == 0x8, "Wrong alignment for
 class alignas(8) STemplateEntityBlueprint
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STemplateEntityBlueprint& p_Other) const;
+	bool operator==(const STemplateEntityBlueprint& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STemplateEntityBlueprint& p_Other) const { return !(*this == p_Other); }
 
 	int32 subType; // 0x0
@@ -16775,14 +16424,12 @@ static_assert(alignof(STemplateEntityBlueprint) == 0x8, "Wrong alignment for STe
 class alignas(8) STestMiniStruct
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STestMiniStruct& p_Other) const;
+	bool operator==(const STestMiniStruct& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STestMiniStruct& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_iIntValue; // 0x0
@@ -16808,14 +16455,12 @@ public:
 
 
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STestStruct& p_Other) const;
+	bool operator==(const STestStruct& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STestStruct& p_Other) const { return !(*this == p_Other); }
 
 	ZString stringField; // 0x0
@@ -16834,14 +16479,12 @@ static_assert(alignof(STestStruct) == 0x8, "Wrong alignment for STestStruct");
 class alignas(8) STestStruct2
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STestStruct2& p_Other) const;
+	bool operator==(const STestStruct2& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STestStruct2& p_Other) const { return !(*this == p_Other); }
 
 	TArray<STestStruct> arrayField; // 0x0
@@ -16856,14 +16499,12 @@ static_assert(alignof(STestStruct2) == 0x8, "Wrong alignment for STestStruct2");
 class alignas(8) STestStructure
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STestStructure& p_Other) const;
+	bool operator==(const STestStructure& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STestStructure& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fWidth; // 0x0
@@ -16884,14 +16525,14 @@ static_assert(alignof(STestStructure) == 0x8, "Wrong alignment for STestStructur
 class alignas(4) STimerEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STimerEntitySaveData& p_Other) const;
+	bool operator==(const STimerEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STimerEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nInterval; // 0x0
@@ -16908,14 +16549,12 @@ static_assert(alignof(STimerEntitySaveData) == 0x4, "Wrong alignment for STimerE
 class alignas(8) STimerEntitiesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STimerEntitiesSaveData& p_Other) const;
+	bool operator==(const STimerEntitiesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STimerEntitiesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -16930,14 +16569,12 @@ static_assert(alignof(STimerEntitiesSaveData) == 0x8, "Wrong alignment for STime
 class alignas(8) STimerManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STimerManagerSaveData& p_Other) const;
+	bool operator==(const STimerManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STimerManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	STimerEntitiesSaveData m_TimersData; // 0x0
@@ -16954,14 +16591,14 @@ static_assert(alignof(STimerManagerSaveData) == 0x8, "Wrong alignment for STimer
 class alignas(4) STokenID
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const STokenID& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const STokenID& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STokenID& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_iValue; // 0x0
@@ -16976,14 +16613,14 @@ static_assert(alignof(STokenID) == 0x4, "Wrong alignment for STokenID");
 class alignas(4) STrackDollyControllerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STrackDollyControllerSaveData& p_Other) const;
+	bool operator==(const STrackDollyControllerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STrackDollyControllerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rTrackEntity; // 0x0
@@ -17004,14 +16641,14 @@ static_assert(alignof(STrackDollyControllerSaveData) == 0x4, "Wrong alignment fo
 class alignas(4) STrackerEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const STrackerEntitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const STrackerEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STrackerEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rTracker; // 0x0
@@ -17030,14 +16667,12 @@ static_assert(alignof(STrackerEntitySaveData) == 0x4, "Wrong alignment for STrac
 class alignas(8) STrackerManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STrackerManagerSaveData& p_Other) const;
+	bool operator==(const STrackerManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STrackerManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<STrackerEntitySaveData> m_aTrackerData; // 0x0
@@ -17050,14 +16685,14 @@ static_assert(alignof(STrackerManagerSaveData) == 0x8, "Wrong alignment for STra
 class alignas(16) STrajectoryTrackSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STrajectoryTrackSaveData& p_Other) const;
+	bool operator==(const STrajectoryTrackSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STrajectoryTrackSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SMatrix m_vOriginalEntityTransform; // 0x0
@@ -17072,14 +16707,12 @@ static_assert(alignof(STrajectoryTrackSaveData) == 0x10, "Wrong alignment for ST
 class alignas(8) STrespassingRuleEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STrespassingRuleEntitySaveData& p_Other) const;
+	bool operator==(const STrespassingRuleEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STrespassingRuleEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<bool> m_aAllowedProfessionsDisabled; // 0x0
@@ -17092,14 +16725,14 @@ static_assert(alignof(STrespassingRuleEntitySaveData) == 0x8, "Wrong alignment f
 class alignas(8) STriggerAlarmGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STriggerAlarmGroupSaveData& p_Other) const;
+	bool operator==(const STriggerAlarmGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STriggerAlarmGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rTarget; // 0x0
@@ -17120,14 +16753,14 @@ static_assert(alignof(STriggerAlarmGroupSaveData) == 0x8, "Wrong alignment for S
 class alignas(4) SUIGridCellPosition
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SUIGridCellPosition& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SUIGridCellPosition& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SUIGridCellPosition& p_Other) const { return !(*this == p_Other); }
 
 	int32 nColumnIndex; // 0x0
@@ -17252,14 +16885,12 @@ enum class _EUIOptionKey : int32_t
 class alignas(8) SUIOptionsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SUIOptionsSaveData& p_Other) const;
+	bool operator==(const SUIOptionsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SUIOptionsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<_EUIOptionKey> m_aKeys; // 0x0
@@ -17286,14 +16917,12 @@ public:
 	class alignas(8) SSubSubStruct
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSubSubStruct& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSubSubStruct& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSubSubStruct& p_Other) const { return !(*this == p_Other); }
 
 		ZString sDeepString; // 0x0
@@ -17306,14 +16935,12 @@ public:
 	class alignas(8) SSubStruct
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSubStruct& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSubStruct& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSubStruct& p_Other) const { return !(*this == p_Other); }
 
 		TArray<SUITestData::SSubSubStruct> aSubSubStructs; // 0x0
@@ -17324,14 +16951,12 @@ public:
 
 
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SUITestData& p_Other) const;
+	bool operator==(const SUITestData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SUITestData& p_Other) const { return !(*this == p_Other); }
 
 	int32 nIntProp; // 0x0
@@ -17362,14 +16987,14 @@ static_assert(alignof(SUITestData) == 0x8, "Wrong alignment for SUITestData");
 class alignas(16) SVIPInvestigateGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVIPInvestigateGroupSaveData& p_Other) const;
+	bool operator==(const SVIPInvestigateGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVIPInvestigateGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -17404,14 +17029,12 @@ static_assert(alignof(SVIPInvestigateGroupSaveData) == 0x10, "Wrong alignment fo
 class alignas(8) SValueBoolsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SValueBoolsSaveData& p_Other) const;
+	bool operator==(const SValueBoolsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SValueBoolsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -17426,14 +17049,12 @@ static_assert(alignof(SValueBoolsSaveData) == 0x8, "Wrong alignment for SValueBo
 class alignas(8) SValueFloatSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SValueFloatSaveData& p_Other) const;
+	bool operator==(const SValueFloatSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SValueFloatSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -17448,14 +17069,12 @@ static_assert(alignof(SValueFloatSaveData) == 0x8, "Wrong alignment for SValueFl
 class alignas(8) SValueIntSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SValueIntSaveData& p_Other) const;
+	bool operator==(const SValueIntSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SValueIntSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -17470,14 +17089,12 @@ static_assert(alignof(SValueIntSaveData) == 0x8, "Wrong alignment for SValueIntS
 class alignas(8) SValueSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SValueSaveData& p_Other) const;
+	bool operator==(const SValueSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SValueSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SValueBoolsSaveData m_ValueBool; // 0x0
@@ -17498,14 +17115,12 @@ static_assert(alignof(SValueSaveData) == 0x8, "Wrong alignment for SValueSaveDat
 class alignas(8) SVideoDatabaseEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVideoDatabaseEntry& p_Other) const;
+	bool operator==(const SVideoDatabaseEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVideoDatabaseEntry& p_Other) const { return !(*this == p_Other); }
 
 	ZString VideoId; // 0x0
@@ -17520,14 +17135,12 @@ static_assert(alignof(SVideoDatabaseEntry) == 0x8, "Wrong alignment for SVideoDa
 class alignas(8) SVideoDatabaseData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVideoDatabaseData& p_Other) const;
+	bool operator==(const SVideoDatabaseData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVideoDatabaseData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SVideoDatabaseEntry> Videos; // 0x0
@@ -17540,14 +17153,14 @@ static_assert(alignof(SVideoDatabaseData) == 0x8, "Wrong alignment for SVideoDat
 class alignas(1) SVisibilitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SVisibilitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SVisibilitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVisibilitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsVisible; // 0x0
@@ -17560,14 +17173,14 @@ static_assert(alignof(SVisibilitySaveData) == 0x1, "Wrong alignment for SVisibil
 class alignas(4) SVoidSignalEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVoidSignalEntitySaveData& p_Other) const;
+	bool operator==(const SVoidSignalEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVoidSignalEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bSignaling; // 0x0
@@ -17582,14 +17195,14 @@ static_assert(alignof(SVoidSignalEntitySaveData) == 0x4, "Wrong alignment for SV
 class alignas(4) SWaveformGeneratorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SWaveformGeneratorSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SWaveformGeneratorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SWaveformGeneratorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fTime; // 0x0
@@ -17612,14 +17225,12 @@ static_assert(alignof(SWaveformGeneratorSaveData) == 0x4, "Wrong alignment for S
 class alignas(8) SWaveformGeneratorManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SWaveformGeneratorManagerSaveData& p_Other) const;
+	bool operator==(const SWaveformGeneratorManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SWaveformGeneratorManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aGenerators; // 0x0
@@ -17699,14 +17310,12 @@ public:
 class alignas(8) ZAMDEvent
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZAMDEvent& p_Other) const;
+	bool operator==(const ZAMDEvent& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZAMDEvent& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nEventID; // 0x0
@@ -17725,14 +17334,12 @@ static_assert(alignof(ZAMDEvent) == 0x8, "Wrong alignment for ZAMDEvent");
 class alignas(8) ZAMDEventTrack
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZAMDEventTrack& p_Other) const;
+	bool operator==(const ZAMDEventTrack& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZAMDEventTrack& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sName; // 0x0
@@ -17747,14 +17354,12 @@ static_assert(alignof(ZAMDEventTrack) == 0x8, "Wrong alignment for ZAMDEventTrac
 class alignas(8) ZAMDTake
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZAMDTake& p_Other) const;
+	bool operator==(const ZAMDTake& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZAMDTake& p_Other) const { return !(*this == p_Other); }
 
 	TArray<ZAMDEventTrack> m_eventTracks; // 0x0
@@ -17781,14 +17386,14 @@ public:
 	class alignas(4) SGeneratedFootstepEvent
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SGeneratedFootstepEvent& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SGeneratedFootstepEvent& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SGeneratedFootstepEvent& p_Other) const { return !(*this == p_Other); }
 
 		ZAT2Controller::EFoot m_eFoot; // 0x0
@@ -17812,14 +17417,12 @@ public:
 	class alignas(8) SEventPreviewInfo
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SEventPreviewInfo& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SEventPreviewInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SEventPreviewInfo& p_Other) const { return !(*this == p_Other); }
 
 		int32 m_nEventID; // 0x0
@@ -18080,14 +17683,14 @@ public:
 	class alignas(16) SApproachOrderSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SApproachOrderSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SApproachOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SApproachOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 		float4 m_vStopDirection; // 0x0
@@ -18108,14 +17711,12 @@ public:
 class alignas(8) ZCurve
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZCurve& p_Other) const;
+	bool operator==(const ZCurve& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZCurve& p_Other) const { return !(*this == p_Other); }
 
 	TArray<TFixedArray<float32, 8>> data; // 0x0
@@ -18147,14 +17748,12 @@ public:
 	class alignas(8) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		TArray<int32> m_aAvoidDangerousAreaGroups; // 0x0
@@ -18245,14 +17844,14 @@ public:
 	class alignas(4) SActorNoise
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SActorNoise& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SActorNoise& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SActorNoise& p_Other) const { return !(*this == p_Other); }
 
 		SActorSoundDefs::EDefinition m_iSpeak; // 0x0
@@ -18271,14 +17870,12 @@ public:
 class alignas(8) ZComponentCreator
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZComponentCreator& p_Other) const;
+	bool operator==(const ZComponentCreator& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZComponentCreator& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sComponentName; // 0x0
@@ -18401,14 +17998,14 @@ public:
 	class alignas(8) SState
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SState& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SState& p_Other) const { return !(*this == p_Other); }
 
 		ZDeadBodySituation::ESituationFlavor m_eFlavor; // 0x0
@@ -18439,14 +18036,14 @@ public:
 	class alignas(4) SIncidentSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SIncidentSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SIncidentSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SIncidentSaveData& p_Other) const { return !(*this == p_Other); }
 
 		uint32 m_body; // 0x0
@@ -18463,14 +18060,12 @@ public:
 	class alignas(8) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		ZDeadBodySituation::SState m_State; // 0x0
@@ -18632,14 +18227,14 @@ public:
 	class alignas(4) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		int32 m_pDetectedInPrivateGroup; // 0x0
@@ -18679,14 +18274,14 @@ public:
 	class alignas(4) SVisibilitySetting
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SVisibilitySetting& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SVisibilitySetting& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SVisibilitySetting& p_Other) const { return !(*this == p_Other); }
 
 		EActorPerceptionSensitivity m_eSensitivity; // 0x0
@@ -18722,14 +18317,12 @@ public:
 	class alignas(8) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		uint32 m_pLeader; // 0x0
@@ -18819,14 +18412,12 @@ public:
 class alignas(8) ZER64
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZER64& p_Other) const;
+	bool operator==(const ZER64& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZER64& p_Other) const { return !(*this == p_Other); }
 
 	uint64 m_nEntityID; // 0x0
@@ -18841,14 +18432,12 @@ static_assert(alignof(ZER64) == 0x8, "Wrong alignment for ZER64");
 class alignas(8) ZEntityID
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZEntityID& p_Other) const;
+	bool operator==(const ZEntityID& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZEntityID& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sStr; // 0x0
@@ -18861,14 +18450,12 @@ static_assert(alignof(ZEntityID) == 0x8, "Wrong alignment for ZEntityID");
 class alignas(8) ZEntityReference
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZEntityReference& p_Other) const;
+	bool operator==(const ZEntityReference& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZEntityReference& p_Other) const { return !(*this == p_Other); }
 
 	ZEntityID m_EntityID; // 0x0
@@ -18883,14 +18470,12 @@ static_assert(alignof(ZEntityReference) == 0x8, "Wrong alignment for ZEntityRefe
 class alignas(8) ZStringBuilder
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZStringBuilder& p_Other) const;
+	bool operator==(const ZStringBuilder& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZStringBuilder& p_Other) const { return !(*this == p_Other); }
 
 	TArray<char> m_chars; // 0x0
@@ -18903,14 +18488,12 @@ static_assert(alignof(ZStringBuilder) == 0x8, "Wrong alignment for ZStringBuilde
 class alignas(8) ZPath
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZPath& p_Other) const;
+	bool operator==(const ZPath& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZPath& p_Other) const { return !(*this == p_Other); }
 
 	ZStringBuilder m_value; // 0x0
@@ -18923,14 +18506,12 @@ static_assert(alignof(ZPath) == 0x8, "Wrong alignment for ZPath");
 class alignas(8) ZFilePath
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZFilePath& p_Other) const;
+	bool operator==(const ZFilePath& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZFilePath& p_Other) const { return !(*this == p_Other); }
 
 	ZPath m_path; // 0x0
@@ -19014,14 +18595,14 @@ public:
 	class alignas(16) SFormationMoveOrderSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SFormationMoveOrderSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SFormationMoveOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SFormationMoveOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 		float4 m_vStopDirection; // 0x0
@@ -19088,14 +18669,14 @@ public:
 	class alignas(4) SAgilityEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SAgilityEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SAgilityEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SAgilityEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5AgilityEventConsumer::EEvent m_nEvent; // 0x0
@@ -19138,14 +18719,14 @@ public:
 	class alignas(4) SBodySoundEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SBodySoundEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SBodySoundEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SBodySoundEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5BodySoundEventConsumer::EAnimSoundBody m_nEvent; // 0x0
@@ -19163,14 +18744,14 @@ public:
 	class alignas(4) SCloseCombatSoundEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SCloseCombatSoundEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SCloseCombatSoundEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SCloseCombatSoundEventData& p_Other) const { return !(*this == p_Other); }
 
 		EHM5SoundCloseCombatEvent m_nEvent; // 0x0
@@ -19223,14 +18804,14 @@ public:
 	class alignas(4) SCrowdSoundGenericEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SCrowdSoundGenericEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SCrowdSoundGenericEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SCrowdSoundGenericEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5CrowdGenericEventConsumer::EEvent m_nEvent; // 0x0
@@ -19278,14 +18859,14 @@ public:
 	class alignas(4) SFaceFXEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SFaceFXEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SFaceFXEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SFaceFXEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5FaceFXReactionEventConsumer::EEvent m_nEvent; // 0x0
@@ -19316,14 +18897,12 @@ public:
 	class alignas(8) SFaceFXEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SFaceFXEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SFaceFXEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SFaceFXEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5FaceFXSpecificEventConsumer::EEvent m_nEvent; // 0x0
@@ -19343,14 +18922,14 @@ public:
 	class alignas(4) SFootstepSoundEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SFootstepSoundEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SFootstepSoundEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SFootstepSoundEventData& p_Other) const { return !(*this == p_Other); }
 
 		EHM5SoundFootstepEvent m_nEvent; // 0x0
@@ -19405,14 +18984,14 @@ public:
 	class alignas(4) SGenericEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SGenericEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SGenericEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SGenericEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5GenericEventConsumer::EEvent m_nEvent; // 0x0
@@ -19446,14 +19025,14 @@ public:
 	class alignas(4) SZHM5HIKEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SZHM5HIKEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SZHM5HIKEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SZHM5HIKEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5HIKEventConsumer::EEffector m_nEffector; // 0x0
@@ -19603,14 +19182,14 @@ public:
 	class alignas(4) SItemInteractionEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SItemInteractionEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SItemInteractionEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SItemInteractionEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5ItemInteractionEventConsumer::EHM5SoundItemInteractionEvent m_nEvent; // 0x0
@@ -19657,14 +19236,14 @@ public:
 	class alignas(4) SWeaponEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SWeaponEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SWeaponEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SWeaponEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5WeaponEventConsumer::EAnimWeapon m_nEvent; // 0x0
@@ -19682,14 +19261,14 @@ public:
 	class alignas(1) SData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SData& p_Other) const { return !(*this == p_Other); }
 
 		bool bDisguiseBroken; // 0x0
@@ -19721,14 +19300,12 @@ public:
 	class alignas(8) SData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SData& p_Other) const { return !(*this == p_Other); }
 
 		ZString m_sTitleText; // 0x0
@@ -19910,14 +19487,14 @@ public:
 	class alignas(4) SInteractionEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SInteractionEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SInteractionEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SInteractionEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZInteractionEventConsumer::EEvent m_nEvent; // 0x0
@@ -19987,14 +19564,14 @@ public:
 	class alignas(8) SState
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SState& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SState& p_Other) const { return !(*this == p_Other); }
 
 		bool m_bHitmanInvadingPrivacy; // 0x0
@@ -20027,14 +19604,14 @@ public:
 	class alignas(8) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		ZInvestigateStandingSituation::SState m_State; // 0x0
@@ -20054,14 +19631,14 @@ public:
 	class alignas(8) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		int32 m_nCurrentState; // 0x0
@@ -20085,14 +19662,14 @@ public:
 	class alignas(16) SJumpToOrderSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SJumpToOrderSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SJumpToOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SJumpToOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 		float4 m_vStopDirection; // 0x0
@@ -20369,14 +19946,14 @@ public:
 	class alignas(4) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		uint32 m_rVictim; // 0x0
@@ -20450,14 +20027,12 @@ public:
 class alignas(8) ZScopedER64
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZScopedER64& p_Other) const;
+	bool operator==(const ZScopedER64& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZScopedER64& p_Other) const { return !(*this == p_Other); }
 
 	ZER64 m_er64; // 0x0
@@ -20482,14 +20057,14 @@ public:
 	class alignas(4) SHitmanVisibleEscalationRule
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SHitmanVisibleEscalationRule& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SHitmanVisibleEscalationRule& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SHitmanVisibleEscalationRule& p_Other) const { return !(*this == p_Other); }
 
 		int32 m_NrGuardsToSend; // 0x0
@@ -20504,14 +20079,14 @@ public:
 	class alignas(4) SDeadBodyVisibleEscalationRule
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SDeadBodyVisibleEscalationRule& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SDeadBodyVisibleEscalationRule& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SDeadBodyVisibleEscalationRule& p_Other) const { return !(*this == p_Other); }
 
 		int32 m_NrGuardsToSend; // 0x0
@@ -20529,14 +20104,12 @@ public:
 	class alignas(8) SIconData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SIconData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SIconData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SIconData& p_Other) const { return !(*this == p_Other); }
 
 		ZString iCategory; // 0x0
@@ -20592,14 +20165,14 @@ public:
 	class alignas(16) SSniperSuspiciousArea
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSniperSuspiciousArea& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSniperSuspiciousArea& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSniperSuspiciousArea& p_Other) const { return !(*this == p_Other); }
 
 		float4 m_vPosition; // 0x0
@@ -20624,14 +20197,12 @@ public:
 	class alignas(8) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		uint32 m_rSniperLocation; // 0x0
@@ -20681,14 +20252,12 @@ public:
 class alignas(8) ZSpeakerLevels
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZSpeakerLevels& p_Other) const;
+	bool operator==(const ZSpeakerLevels& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZSpeakerLevels& p_Other) const { return !(*this == p_Other); }
 
 	TArray<float32> m_aSpeakerMatrix; // 0x0
@@ -20704,14 +20273,12 @@ public:
 	class alignas(8) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		bool m_bStandingDown; // 0x0
@@ -20772,14 +20339,14 @@ public:
 	class alignas(16) SState
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SState& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SState& p_Other) const { return !(*this == p_Other); }
 
 		ZStandOffSituation::ESituationState m_eSituationState; // 0x0
@@ -20842,14 +20409,12 @@ public:
 	class alignas(16) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		ZStandOffSituation::SState m_State; // 0x0
@@ -20900,14 +20465,14 @@ public:
 class alignas(8) ZTime
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZTime& p_Other) const;
+	bool operator==(const ZTime& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZTime& p_Other) const { return !(*this == p_Other); }
 
 	uint64 m_nValue; // 0x0
@@ -20944,14 +20509,14 @@ public:
 	class alignas(8) SState
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SState& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SState& p_Other) const { return !(*this == p_Other); }
 
 		ZTrespassingSituation::ESituationState m_eSituationState; // 0x0
@@ -20972,14 +20537,14 @@ public:
 	class alignas(16) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		ZTrespassingSituation::SState m_State; // 0x0
@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <ZHM/ZHMPrimitives.h>
 #include <ZHM/ZHMTypeInfo.h>
+#include <ZHM/ZHMTypeTables.h>
 
 class ZHMTypeInfo;
 
@@ -254,14 +255,12 @@ namespace AI {
 		class alignas(8) SPoolModificationEvent
 		{
 		public:
-			static ZHMTypeInfo TypeInfo;
-			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-			static bool Equals(void* p_Left, void* p_Right);
-			static void Destroy(void* p_Object);
-
-			bool operator==(const SPoolModificationEvent& p_Other) const;
+			static ZHMTableTypeInfo TypeInfo;
+			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+			bool operator==(const SPoolModificationEvent& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 			bool operator!=(const SPoolModificationEvent& p_Other) const { return !(*this == p_Other); }
 
 			uint32 StimulusTypeId; // 0x0
@@ -286,14 +285,12 @@ namespace AI {
 		class alignas(8) SStimulusSnapshot
 		{
 		public:
-			static ZHMTypeInfo TypeInfo;
-			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-			static bool Equals(void* p_Left, void* p_Right);
-			static void Destroy(void* p_Object);
-
-			bool operator==(const SStimulusSnapshot& p_Other) const;
+			static ZHMTableTypeInfo TypeInfo;
+			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+			bool operator==(const SStimulusSnapshot& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 			bool operator!=(const SStimulusSnapshot& p_Other) const { return !(*this == p_Other); }
 
 			uint32 SlotIndex; // 0x0
@@ -308,14 +305,12 @@ namespace AI {
 		class alignas(8) SPoolSnapshot
 		{
 		public:
-			static ZHMTypeInfo TypeInfo;
-			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-			static bool Equals(void* p_Left, void* p_Right);
-			static void Destroy(void* p_Object);
-
-			bool operator==(const SPoolSnapshot& p_Other) const;
+			static ZHMTableTypeInfo TypeInfo;
+			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+			bool operator==(const SPoolSnapshot& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 			bool operator!=(const SPoolSnapshot& p_Other) const { return !(*this == p_Other); }
 
 			ZString StimulusTypeName; // 0x0
@@ -335,14 +330,14 @@ namespace AI {
 			class alignas(4) SStimulus_AgentData_SaveData
 			{
 			public:
-				static ZHMTypeInfo TypeInfo;
-				static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-				static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-				static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-				static bool Equals(void* p_Left, void* p_Right);
-				static void Destroy(void* p_Object);
-
-				bool operator==(const SStimulus_AgentData_SaveData& p_Other) const;
+				static ZHMTableTypeInfo TypeInfo;
+				static constexpr bool IsRelocationFree = true;
+
+				static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+				static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+				static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+				bool operator==(const SStimulus_AgentData_SaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 				bool operator!=(const SStimulus_AgentData_SaveData& p_Other) const { return !(*this == p_Other); }
 
 				uint32 m_AgentData; // 0x0
@@ -355,14 +350,12 @@ namespace AI {
 			class alignas(8) SBaseStimulus_Pool_SaveData
 			{
 			public:
-				static ZHMTypeInfo TypeInfo;
-				static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-				static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-				static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-				static bool Equals(void* p_Left, void* p_Right);
-				static void Destroy(void* p_Object);
-
-				bool operator==(const SBaseStimulus_Pool_SaveData& p_Other) const;
+				static ZHMTableTypeInfo TypeInfo;
+				static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+				static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+				static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+				bool operator==(const SBaseStimulus_Pool_SaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 				bool operator!=(const SBaseStimulus_Pool_SaveData& p_Other) const { return !(*this == p_Other); }
 
 				TArray<uint32> m_SlotDetails; // 0x0
@@ -381,14 +374,12 @@ namespace AI {
 		class alignas(8) SFullDataSnapshotEvent
 		{
 		public:
-			static ZHMTypeInfo TypeInfo;
-			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-			static bool Equals(void* p_Left, void* p_Right);
-			static void Destroy(void* p_Object);
-
-			bool operator==(const SFullDataSnapshotEvent& p_Other) const;
+			static ZHMTableTypeInfo TypeInfo;
+			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+			bool operator==(const SFullDataSnapshotEvent& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 			bool operator!=(const SFullDataSnapshotEvent& p_Other) const { return !(*this == p_Other); }
 
 			uint64 Timestamp; // 0x0
@@ -405,14 +396,12 @@ namespace AI {
 		class alignas(8) SPoolModificationCollectionEvent
 		{
 		public:
-			static ZHMTypeInfo TypeInfo;
-			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-			static bool Equals(void* p_Left, void* p_Right);
-			static void Destroy(void* p_Object);
-
-			bool operator==(const SPoolModificationCollectionEvent& p_Other) const;
+			static ZHMTableTypeInfo TypeInfo;
+			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+			bool operator==(const SPoolModificationCollectionEvent& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 			bool operator!=(const SPoolModificationCollectionEvent& p_Other) const { return !(*this == p_Other); }
 
 			TArray<AI::Private::SPoolModificationEvent> PoolModificationEvents; // 0x0
@@ -427,14 +416,14 @@ namespace AI {
 	class alignas(4) SEventDescription
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SEventDescription& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SEventDescription& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SEventDescription& p_Other) const { return !(*this == p_Other); }
 
 		EAIEventType m_eEventType; // 0x0
@@ -457,14 +446,14 @@ namespace AI {
 		class alignas(4) SData
 		{
 		public:
-			static ZHMTypeInfo TypeInfo;
-			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-			static bool Equals(void* p_Left, void* p_Right);
-			static void Destroy(void* p_Object);
-
-			bool operator==(const SData& p_Other) const;
+			static ZHMTableTypeInfo TypeInfo;
+			static constexpr bool IsRelocationFree = true;
+
+			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+			bool operator==(const SData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 			bool operator!=(const SData& p_Other) const { return !(*this == p_Other); }
 
 			uint32 m_BulletsToFire; // 0x0
@@ -479,14 +468,12 @@ namespace AI {
 
 
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SFirePattern01& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SFirePattern01& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SFirePattern01& p_Other) const { return !(*this == p_Other); }
 
 		TArray<AI::SFirePattern01::SData> m_PatternSequenceData; // 0x0
@@ -503,14 +490,14 @@ namespace AI {
 		class alignas(4) SData
 		{
 		public:
-			static ZHMTypeInfo TypeInfo;
-			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-			static bool Equals(void* p_Left, void* p_Right);
-			static void Destroy(void* p_Object);
-
-			bool operator==(const SData& p_Other) const;
+			static ZHMTableTypeInfo TypeInfo;
+			static constexpr bool IsRelocationFree = true;
+
+			static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+			static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+			static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+			bool operator==(const SData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 			bool operator!=(const SData& p_Other) const { return !(*this == p_Other); }
 
 			float32 m_FireMinSeconds; // 0x0
@@ -527,14 +514,12 @@ namespace AI {
 
 
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SFirePattern02& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SFirePattern02& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SFirePattern02& p_Other) const { return !(*this == p_Other); }
 
 		TArray<AI::SFirePattern02::SData> m_PatternSequenceData; // 0x0
@@ -547,14 +532,14 @@ namespace AI {
 	class alignas(4) SSoundEventModifierState
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSoundEventModifierState& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSoundEventModifierState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSoundEventModifierState& p_Other) const { return !(*this == p_Other); }
 
 		float32 m_fRangeModifier; // 0x0
@@ -575,14 +560,14 @@ namespace AnimationEventDataTypes {
 	class alignas(4) SBlend
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SBlend& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SBlend& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SBlend& p_Other) const { return !(*this == p_Other); }
 
 		float32 m_fBlendTime; // 0x0
@@ -595,14 +580,14 @@ namespace AnimationEventDataTypes {
 	class alignas(4) SLegacy
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SLegacy& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SLegacy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SLegacy& p_Other) const { return !(*this == p_Other); }
 
 		int32 m_nEventID; // 0x0
@@ -617,14 +602,12 @@ namespace AnimationEventDataTypes {
 class alignas(4) ZRuntimeResourceID
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZRuntimeResourceID& p_Other) const;
+	bool operator==(const ZRuntimeResourceID& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZRuntimeResourceID& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_IDHigh; // 0x0
@@ -640,14 +623,12 @@ namespace AnimationTakeDataTypes {
 	class alignas(4) SGeneric
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SGeneric& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SGeneric& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SGeneric& p_Other) const { return !(*this == p_Other); }
 
 		float32 m_fTest; // 0x0
@@ -9147,14 +9128,14 @@ enum class GameLobbyState : int32_t
 class alignas(4) SVector3
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVector3& p_Other) const;
+	bool operator==(const SVector3& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVector3& p_Other) const { return !(*this == p_Other); }
 
 	float32 x; // 0x0
@@ -9171,14 +9152,14 @@ static_assert(alignof(SVector3) == 0x4, "Wrong alignment for SVector3");
 class alignas(4) SMatrix43
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMatrix43& p_Other) const;
+	bool operator==(const SMatrix43& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMatrix43& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 XAxis; // 0x0
@@ -9256,14 +9237,12 @@ public:
 class alignas(8) ZDynamicObject
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZDynamicObject& p_Other) const;
+	bool operator==(const ZDynamicObject& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZDynamicObject& p_Other) const { return !(*this == p_Other); }
 
 	ZVariant m_value; // 0x0
@@ -9276,14 +9255,14 @@ static_assert(alignof(ZDynamicObject) == 0x8, "Wrong alignment for ZDynamicObjec
 class alignas(8) ZGuid
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const ZGuid& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const ZGuid& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZGuid& p_Other) const { return !(*this == p_Other); }
 
 	uint32 _a; // 0x0
@@ -9345,14 +9324,12 @@ public:
 
 
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SCounterData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SCounterData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SCounterData& p_Other) const { return !(*this == p_Other); }
 
 		ZString m_sHeader; // 0x0
@@ -9924,14 +9901,12 @@ namespace InputControlNamesp {
 class alignas(8) SDebugMenuItemIntEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDebugMenuItemIntEntry& p_Other) const;
+	bool operator==(const SDebugMenuItemIntEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDebugMenuItemIntEntry& p_Other) const { return !(*this == p_Other); }
 
 	int32 Value; // 0x0
@@ -9958,14 +9933,12 @@ namespace JSONTemplate {
 	class alignas(8) SDebugMenuItemData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SDebugMenuItemData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SDebugMenuItemData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SDebugMenuItemData& p_Other) const { return !(*this == p_Other); }
 
 		JSONTemplate::EDebugMenuItemType Type; // 0x0
@@ -10156,14 +10129,12 @@ namespace JSONTemplate {
 	class alignas(8) SDebugMenuItemsResult
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SDebugMenuItemsResult& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SDebugMenuItemsResult& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SDebugMenuItemsResult& p_Other) const { return !(*this == p_Other); }
 
 		TArray<JSONTemplate::SDebugMenuItemData> Items; // 0x0
@@ -10249,14 +10220,14 @@ enum class ReverbFidelity : int32_t
 class alignas(4) SWorldSpaceSettings
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SWorldSpaceSettings& p_Other) const;
+	bool operator==(const SWorldSpaceSettings& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SWorldSpaceSettings& p_Other) const { return !(*this == p_Other); }
 
 	float32 fCloseupDistance; // 0x0
@@ -10281,14 +10252,14 @@ static_assert(alignof(SWorldSpaceSettings) == 0x4, "Wrong alignment for SWorldSp
 class alignas(4) S25DProjectionSettingsCurveEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const S25DProjectionSettingsCurveEntry& p_Other) const;
+	bool operator==(const S25DProjectionSettingsCurveEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const S25DProjectionSettingsCurveEntry& p_Other) const { return !(*this == p_Other); }
 
 	float32 fDistance; // 0x0
@@ -10303,14 +10274,12 @@ static_assert(alignof(S25DProjectionSettingsCurveEntry) == 0x4, "Wrong alignment
 class alignas(8) S25DProjectionSettings
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const S25DProjectionSettings& p_Other) const;
+	bool operator==(const S25DProjectionSettings& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const S25DProjectionSettings& p_Other) const { return !(*this == p_Other); }
 
 	float32 fNearDistance; // 0x0
@@ -10363,14 +10332,14 @@ static_assert(alignof(S25DProjectionSettings) == 0x8, "Wrong alignment for S25DP
 class alignas(4) S3rdPersonCameraSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const S3rdPersonCameraSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const S3rdPersonCameraSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const S3rdPersonCameraSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fAngleYaw; // 0x0
@@ -10385,14 +10354,14 @@ static_assert(alignof(S3rdPersonCameraSaveData) == 0x4, "Wrong alignment for S3r
 class alignas(8) ZGameTime
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZGameTime& p_Other) const;
+	bool operator==(const ZGameTime& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZGameTime& p_Other) const { return !(*this == p_Other); }
 
 	int64 m_nTicks; // 0x0
@@ -10405,14 +10374,14 @@ static_assert(alignof(ZGameTime) == 0x8, "Wrong alignment for ZGameTime");
 class alignas(8) SAIEventSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAIEventSaveData& p_Other) const;
+	bool operator==(const SAIEventSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAIEventSaveData& p_Other) const { return !(*this == p_Other); }
 
 	EAIEventType m_eType; // 0x0
@@ -10431,14 +10400,14 @@ static_assert(alignof(SAIEventSaveData) == 0x8, "Wrong alignment for SAIEventSav
 class alignas(4) SAIModifierServiceActorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SAIModifierServiceActorSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SAIModifierServiceActorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAIModifierServiceActorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActorRef; // 0x0
@@ -10471,14 +10440,12 @@ static_assert(alignof(SAIModifierServiceActorSaveData) == 0x4, "Wrong alignment
 class alignas(8) SAIModifierServiceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAIModifierServiceSaveData& p_Other) const;
+	bool operator==(const SAIModifierServiceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAIModifierServiceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bFullVolumeUpdate; // 0x0
@@ -10493,14 +10460,14 @@ static_assert(alignof(SAIModifierServiceSaveData) == 0x8, "Wrong alignment for S
 class alignas(1) SAIPerceptibleEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAIPerceptibleEntitySaveData& p_Other) const;
+	bool operator==(const SAIPerceptibleEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAIPerceptibleEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bPerceptibleEnabled; // 0x0
@@ -10513,14 +10480,14 @@ static_assert(alignof(SAIPerceptibleEntitySaveData) == 0x1, "Wrong alignment for
 class alignas(1) SAIVisionBlockerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAIVisionBlockerSaveData& p_Other) const;
+	bool operator==(const SAIVisionBlockerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAIVisionBlockerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -10533,14 +10500,14 @@ static_assert(alignof(SAIVisionBlockerSaveData) == 0x1, "Wrong alignment for SAI
 class alignas(4) SAccessoryItemSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SAccessoryItemSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SAccessoryItemSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAccessoryItemSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -10559,14 +10526,12 @@ static_assert(alignof(SAccessoryItemSaveData) == 0x4, "Wrong alignment for SAcce
 class alignas(8) SAccidentObserversGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAccidentObserversGroupSaveData& p_Other) const;
+	bool operator==(const SAccidentObserversGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAccidentObserversGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_target; // 0x0
@@ -10595,14 +10560,14 @@ public:
 class alignas(4) SColorRGB
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SColorRGB& p_Other) const;
+	bool operator==(const SColorRGB& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SColorRGB& p_Other) const { return !(*this == p_Other); }
 
 	float32 r; // 0x0
@@ -10662,14 +10627,14 @@ public:
 class alignas(8) SActBehaviorEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActBehaviorEntitySaveData& p_Other) const;
+	bool operator==(const SActBehaviorEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActBehaviorEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bStartedSignalSent; // 0x0
@@ -10690,14 +10655,14 @@ static_assert(alignof(SActBehaviorEntitySaveData) == 0x8, "Wrong alignment for S
 class alignas(16) float4
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const float4& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const float4& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const float4& p_Other) const { return !(*this == p_Other); }
 
 	float32 x; // 0x0
@@ -10716,14 +10681,12 @@ static_assert(alignof(float4) == 0x10, "Wrong alignment for float4");
 class alignas(16) SActOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActOrderSaveData& p_Other) const;
+	bool operator==(const SActOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sAct; // 0x0
@@ -10748,14 +10711,12 @@ static_assert(alignof(SActOrderSaveData) == 0x10, "Wrong alignment for SActOrder
 class alignas(8) SActionRadialArcDisplayInfo
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActionRadialArcDisplayInfo& p_Other) const;
+	bool operator==(const SActionRadialArcDisplayInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActionRadialArcDisplayInfo& p_Other) const { return !(*this == p_Other); }
 
 	bool hidden; // 0x0
@@ -10778,14 +10739,12 @@ static_assert(alignof(SActionRadialArcDisplayInfo) == 0x8, "Wrong alignment for
 class alignas(8) SActionRadialArcDisplayInfoArray_dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActionRadialArcDisplayInfoArray_dummy& p_Other) const;
+	bool operator==(const SActionRadialArcDisplayInfoArray_dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActionRadialArcDisplayInfoArray_dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SActionRadialArcDisplayInfo> dummy; // 0x0
@@ -10798,14 +10757,12 @@ static_assert(alignof(SActionRadialArcDisplayInfoArray_dummy) == 0x8, "Wrong ali
 class alignas(8) SActivity
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActivity& p_Other) const;
+	bool operator==(const SActivity& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActivity& p_Other) const { return !(*this == p_Other); }
 
 	ZGuid id; // 0x0
@@ -10820,14 +10777,12 @@ static_assert(alignof(SActivity) == 0x8, "Wrong alignment for SActivity");
 class alignas(8) SActivityObjective
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActivityObjective& p_Other) const;
+	bool operator==(const SActivityObjective& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActivityObjective& p_Other) const { return !(*this == p_Other); }
 
 	SActivity activity; // 0x0
@@ -10842,14 +10797,12 @@ static_assert(alignof(SActivityObjective) == 0x8, "Wrong alignment for SActivity
 class alignas(8) SActivityExits
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActivityExits& p_Other) const;
+	bool operator==(const SActivityExits& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActivityExits& p_Other) const { return !(*this == p_Other); }
 
 	SActivity activity; // 0x0
@@ -10864,14 +10817,12 @@ static_assert(alignof(SActivityExits) == 0x8, "Wrong alignment for SActivityExit
 class alignas(8) SActivityDefinition
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActivityDefinition& p_Other) const;
+	bool operator==(const SActivityDefinition& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActivityDefinition& p_Other) const { return !(*this == p_Other); }
 
 	SActivity activity; // 0x0
@@ -10888,14 +10839,12 @@ static_assert(alignof(SActivityDefinition) == 0x8, "Wrong alignment for SActivit
 class alignas(8) SActivities
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActivities& p_Other) const;
+	bool operator==(const SActivities& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActivities& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SActivityDefinition> Activities; // 0x0
@@ -10908,14 +10857,14 @@ static_assert(alignof(SActivities) == 0x8, "Wrong alignment for SActivities");
 class alignas(4) SActorAccessoryItemActionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorAccessoryItemActionSaveData& p_Other) const;
+	bool operator==(const SActorAccessoryItemActionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorAccessoryItemActionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -10928,14 +10877,14 @@ static_assert(alignof(SActorAccessoryItemActionSaveData) == 0x4, "Wrong alignmen
 class alignas(4) SActorAliveConditionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorAliveConditionSaveData& p_Other) const;
+	bool operator==(const SActorAliveConditionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorAliveConditionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -10948,14 +10897,14 @@ static_assert(alignof(SActorAliveConditionSaveData) == 0x4, "Wrong alignment for
 class alignas(4) SActorAnimSetVariationIndexSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActorAnimSetVariationIndexSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActorAnimSetVariationIndexSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorAnimSetVariationIndexSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rAnimationSetDefinition; // 0x0
@@ -10970,14 +10919,12 @@ static_assert(alignof(SActorAnimSetVariationIndexSaveData) == 0x4, "Wrong alignm
 class alignas(8) SActorAnimSetSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorAnimSetSaveData& p_Other) const;
+	bool operator==(const SActorAnimSetSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorAnimSetSaveData& p_Other) const { return !(*this == p_Other); }
 
 	EAnimSetType m_eAnimSet; // 0x0
@@ -11004,14 +10951,14 @@ static_assert(alignof(SActorAnimSetSaveData) == 0x8, "Wrong alignment for SActor
 class alignas(4) SActorBoneAttachSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorBoneAttachSaveData& p_Other) const;
+	bool operator==(const SActorBoneAttachSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorBoneAttachSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rAttachmentTarget; // 0x0
@@ -11026,14 +10973,12 @@ static_assert(alignof(SActorBoneAttachSaveData) == 0x4, "Wrong alignment for SAc
 class alignas(8) SActorBoneAttachmentsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorBoneAttachmentsSaveData& p_Other) const;
+	bool operator==(const SActorBoneAttachmentsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorBoneAttachmentsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -11048,14 +10993,14 @@ static_assert(alignof(SActorBoneAttachmentsSaveData) == 0x8, "Wrong alignment fo
 class alignas(4) SVector4
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVector4& p_Other) const;
+	bool operator==(const SVector4& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVector4& p_Other) const { return !(*this == p_Other); }
 
 	float32 x; // 0x0
@@ -11074,14 +11019,14 @@ static_assert(alignof(SVector4) == 0x4, "Wrong alignment for SVector4");
 class alignas(4) SActorBoneSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActorBoneSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActorBoneSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorBoneSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 mQuaterion; // 0x0
@@ -11096,14 +11041,14 @@ static_assert(alignof(SActorBoneSaveData) == 0x4, "Wrong alignment for SActorBon
 class alignas(4) SActorDynamicTemplateHandlerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorDynamicTemplateHandlerSaveData& p_Other) const;
+	bool operator==(const SActorDynamicTemplateHandlerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorDynamicTemplateHandlerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -11120,14 +11065,14 @@ static_assert(alignof(SActorDynamicTemplateHandlerSaveData) == 0x4, "Wrong align
 class alignas(4) SActorDynamicTemplateManipulatorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorDynamicTemplateManipulatorSaveData& p_Other) const;
+	bool operator==(const SActorDynamicTemplateManipulatorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorDynamicTemplateManipulatorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -11140,14 +11085,12 @@ static_assert(alignof(SActorDynamicTemplateManipulatorSaveData) == 0x4, "Wrong a
 class alignas(8) SActorDynamicTemplateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorDynamicTemplateSaveData& p_Other) const;
+	bool operator==(const SActorDynamicTemplateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorDynamicTemplateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sName; // 0x0
@@ -11176,14 +11119,12 @@ static_assert(alignof(SActorDynamicTemplateSaveData) == 0x8, "Wrong alignment fo
 class alignas(8) SActorGoalSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorGoalSaveData& p_Other) const;
+	bool operator==(const SActorGoalSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorGoalSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<int32> m_aEntities; // 0x0
@@ -11202,14 +11143,14 @@ static_assert(alignof(SActorGoalSaveData) == 0x8, "Wrong alignment for SActorGoa
 class alignas(4) SActorIKControllerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActorIKControllerSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActorIKControllerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorIKControllerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fRightHandWeight; // 0x0
@@ -11228,14 +11169,14 @@ static_assert(alignof(SActorIKControllerSaveData) == 0x4, "Wrong alignment for S
 class alignas(4) SActorInventoryItemSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorInventoryItemSaveData& p_Other) const;
+	bool operator==(const SActorInventoryItemSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorInventoryItemSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rItem; // 0x0
@@ -11258,14 +11199,12 @@ static_assert(alignof(SActorInventoryItemSaveData) == 0x4, "Wrong alignment for
 class alignas(8) SActorInventorySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorInventorySaveData& p_Other) const;
+	bool operator==(const SActorInventorySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorInventorySaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SActorInventoryItemSaveData> m_aItems; // 0x0
@@ -11278,14 +11217,14 @@ static_assert(alignof(SActorInventorySaveData) == 0x8, "Wrong alignment for SAct
 class alignas(4) SActorItemActionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorItemActionSaveData& p_Other) const;
+	bool operator==(const SActorItemActionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorItemActionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -11300,14 +11239,14 @@ static_assert(alignof(SActorItemActionSaveData) == 0x4, "Wrong alignment for SAc
 class alignas(4) SActorKeywordProxySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActorKeywordProxySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActorKeywordProxySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorKeywordProxySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -11320,14 +11259,12 @@ static_assert(alignof(SActorKeywordProxySaveData) == 0x4, "Wrong alignment for S
 class alignas(8) SActorKeywordProxiesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorKeywordProxiesSaveData& p_Other) const;
+	bool operator==(const SActorKeywordProxiesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorKeywordProxiesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -11342,14 +11279,12 @@ static_assert(alignof(SActorKeywordProxiesSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SActorManagerReferencableData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorManagerReferencableData& p_Other) const;
+	bool operator==(const SActorManagerReferencableData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorManagerReferencableData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<ESituationType> m_aSituationTypes; // 0x0
@@ -11362,14 +11297,14 @@ static_assert(alignof(SActorManagerReferencableData) == 0x8, "Wrong alignment fo
 class alignas(16) SMatrix
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMatrix& p_Other) const;
+	bool operator==(const SMatrix& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMatrix& p_Other) const { return !(*this == p_Other); }
 
 	float4 XAxis; // 0x0
@@ -11388,14 +11323,14 @@ static_assert(alignof(SMatrix) == 0x10, "Wrong alignment for SMatrix");
 class alignas(8) SEventSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEventSaveData& p_Other) const;
+	bool operator==(const SEventSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEventSaveData& p_Other) const { return !(*this == p_Other); }
 
 	EAISharedEventType m_nType; // 0x0
@@ -11412,14 +11347,12 @@ static_assert(alignof(SEventSaveData) == 0x8, "Wrong alignment for SEventSaveDat
 class alignas(8) SSituationGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSituationGroupSaveData& p_Other) const;
+	bool operator==(const SSituationGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSituationGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sClassTypeName; // 0x0
@@ -11440,14 +11373,12 @@ static_assert(alignof(SSituationGroupSaveData) == 0x8, "Wrong alignment for SSit
 class alignas(8) SSituationMemberSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSituationMemberSaveData& p_Other) const;
+	bool operator==(const SSituationMemberSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSituationMemberSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -11472,14 +11403,12 @@ static_assert(alignof(SSituationMemberSaveData) == 0x8, "Wrong alignment for SSi
 class alignas(8) SSituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSituationSaveData& p_Other) const;
+	bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rSituation; // 0x0
@@ -11508,14 +11437,12 @@ static_assert(alignof(SSituationSaveData) == 0x8, "Wrong alignment for SSituatio
 class alignas(8) SActorProviderDirectSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorProviderDirectSaveData& p_Other) const;
+	bool operator==(const SActorProviderDirectSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorProviderDirectSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aActors; // 0x0
@@ -11530,14 +11457,14 @@ static_assert(alignof(SActorProviderDirectSaveData) == 0x8, "Wrong alignment for
 class alignas(16) SActorThrowSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActorThrowSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActorThrowSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorThrowSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rItem; // 0x0
@@ -11558,14 +11485,12 @@ static_assert(alignof(SActorThrowSaveData) == 0x10, "Wrong alignment for SActorT
 class alignas(16) SKnownEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SKnownEntitySaveData& p_Other) const;
+	bool operator==(const SKnownEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SKnownEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nSharedIndex; // 0x0
@@ -11590,14 +11515,12 @@ static_assert(alignof(SKnownEntitySaveData) == 0x10, "Wrong alignment for SKnown
 class alignas(8) SKnowledgeSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SKnowledgeSaveData& p_Other) const;
+	bool operator==(const SKnowledgeSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SKnowledgeSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SKnownEntitySaveData> m_aKnownEntities; // 0x0
@@ -11640,14 +11563,12 @@ static_assert(alignof(SKnowledgeSaveData) == 0x8, "Wrong alignment for SKnowledg
 class alignas(8) SEventHistorySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEventHistorySaveData& p_Other) const;
+	bool operator==(const SEventHistorySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEventHistorySaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<ZGameTime> m_aOccurences; // 0x0
@@ -11660,14 +11581,12 @@ static_assert(alignof(SEventHistorySaveData) == 0x8, "Wrong alignment for SEvent
 class alignas(8) SActorRagdollPoseSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorRagdollPoseSaveData& p_Other) const;
+	bool operator==(const SActorRagdollPoseSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorRagdollPoseSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_vBodyVelocity; // 0x0
@@ -11684,14 +11603,12 @@ static_assert(alignof(SActorRagdollPoseSaveData) == 0x8, "Wrong alignment for SA
 class alignas(8) SCombatMetricsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCombatMetricsSaveData& p_Other) const;
+	bool operator==(const SCombatMetricsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCombatMetricsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_CombatProgress; // 0x0
@@ -11708,14 +11625,14 @@ static_assert(alignof(SCombatMetricsSaveData) == 0x8, "Wrong alignment for SComb
 class alignas(4) SActorProviderApproachSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorProviderApproachSaveData& p_Other) const;
+	bool operator==(const SActorProviderApproachSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorProviderApproachSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rCastActor; // 0x0
@@ -11728,14 +11645,12 @@ static_assert(alignof(SActorProviderApproachSaveData) == 0x4, "Wrong alignment f
 class alignas(8) SActorProviderFilterDirectSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorProviderFilterDirectSaveData& p_Other) const;
+	bool operator==(const SActorProviderFilterDirectSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorProviderFilterDirectSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aActors; // 0x0
@@ -11748,14 +11663,12 @@ static_assert(alignof(SActorProviderFilterDirectSaveData) == 0x8, "Wrong alignme
 class alignas(8) SActorProviderFilterQueueSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorProviderFilterQueueSaveData& p_Other) const;
+	bool operator==(const SActorProviderFilterQueueSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorProviderFilterQueueSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aActors; // 0x0
@@ -11768,14 +11681,14 @@ static_assert(alignof(SActorProviderFilterQueueSaveData) == 0x8, "Wrong alignmen
 class alignas(4) SActorProxySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorProxySaveData& p_Other) const;
+	bool operator==(const SActorProxySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorProxySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -11788,14 +11701,12 @@ static_assert(alignof(SActorProxySaveData) == 0x4, "Wrong alignment for SActorPr
 class alignas(8) SActorProxiesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorProxiesSaveData& p_Other) const;
+	bool operator==(const SActorProxiesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorProxiesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -11821,14 +11732,14 @@ public:
 class alignas(8) SActorSpreadControllerCandidateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActorSpreadControllerCandidateSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActorSpreadControllerCandidateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorSpreadControllerCandidateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_CandidateActor; // 0x0
@@ -11845,14 +11756,12 @@ static_assert(alignof(SActorSpreadControllerCandidateSaveData) == 0x8, "Wrong al
 class alignas(8) SActorSpreadControllerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorSpreadControllerSaveData& p_Other) const;
+	bool operator==(const SActorSpreadControllerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorSpreadControllerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aSpreadingActors; // 0x0
@@ -11887,14 +11796,14 @@ static_assert(alignof(SActorSpreadControllerSaveData) == 0x8, "Wrong alignment f
 class alignas(8) SActorSpreadTransitionOperatorMaterialActorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorSpreadTransitionOperatorMaterialActorSaveData& p_Other) const;
+	bool operator==(const SActorSpreadTransitionOperatorMaterialActorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorSpreadTransitionOperatorMaterialActorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_Actor; // 0x0
@@ -11911,14 +11820,12 @@ static_assert(alignof(SActorSpreadTransitionOperatorMaterialActorSaveData) == 0x
 class alignas(8) SActorSpreadTransitionOperatorMaterialSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorSpreadTransitionOperatorMaterialSaveData& p_Other) const;
+	bool operator==(const SActorSpreadTransitionOperatorMaterialSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorSpreadTransitionOperatorMaterialSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SActorSpreadTransitionOperatorMaterialActorSaveData> m_aActorMaterialOverrides; // 0x0
@@ -11931,14 +11838,14 @@ static_assert(alignof(SActorSpreadTransitionOperatorMaterialSaveData) == 0x8, "W
 class alignas(4) SActorStandInSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorStandInSaveData& p_Other) const;
+	bool operator==(const SActorStandInSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorStandInSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -11951,14 +11858,12 @@ static_assert(alignof(SActorStandInSaveData) == 0x4, "Wrong alignment for SActor
 class alignas(8) SActorStandInEntitiesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorStandInEntitiesSaveData& p_Other) const;
+	bool operator==(const SActorStandInEntitiesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorStandInEntitiesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -11973,14 +11878,14 @@ static_assert(alignof(SActorStandInEntitiesSaveData) == 0x8, "Wrong alignment fo
 class alignas(4) SActorTagSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SActorTagSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SActorTagSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorTagSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bSeen; // 0x0
@@ -11997,14 +11902,12 @@ static_assert(alignof(SActorTagSaveData) == 0x4, "Wrong alignment for SActorTagS
 class alignas(8) SActorTagManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorTagManagerSaveData& p_Other) const;
+	bool operator==(const SActorTagManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorTagManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bContractsCreationMode; // 0x0
@@ -12025,14 +11928,14 @@ static_assert(alignof(SActorTagManagerSaveData) == 0x8, "Wrong alignment for SAc
 class alignas(4) SActorVisibilityConditionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SActorVisibilityConditionSaveData& p_Other) const;
+	bool operator==(const SActorVisibilityConditionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SActorVisibilityConditionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_pActor; // 0x0
@@ -12045,14 +11948,14 @@ static_assert(alignof(SActorVisibilityConditionSaveData) == 0x4, "Wrong alignmen
 class alignas(16) SAgitatedBystanderOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAgitatedBystanderOrderSaveData& p_Other) const;
+	bool operator==(const SAgitatedBystanderOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAgitatedBystanderOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rBystanderPoint; // 0x0
@@ -12069,14 +11972,14 @@ static_assert(alignof(SAgitatedBystanderOrderSaveData) == 0x10, "Wrong alignment
 class alignas(1) SAimAssistObjectSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SAimAssistObjectSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SAimAssistObjectSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAimAssistObjectSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bHasBeenStarted; // 0x0
@@ -12091,14 +11994,14 @@ static_assert(alignof(SAimAssistObjectSaveData) == 0x1, "Wrong alignment for SAi
 class alignas(4) SBoneTransformSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBoneTransformSaveData& p_Other) const;
+	bool operator==(const SBoneTransformSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBoneTransformSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 mQuaterion; // 0x0
@@ -12113,14 +12016,12 @@ static_assert(alignof(SBoneTransformSaveData) == 0x4, "Wrong alignment for SBone
 class alignas(8) SAnimPlayerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAnimPlayerSaveData& p_Other) const;
+	bool operator==(const SAnimPlayerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAnimPlayerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 mTrajectoryQuaterion; // 0x0
@@ -12137,14 +12038,14 @@ static_assert(alignof(SAnimPlayerSaveData) == 0x8, "Wrong alignment for SAnimPla
 class alignas(4) SAnimatedActorActOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAnimatedActorActOrderSaveData& p_Other) const;
+	bool operator==(const SAnimatedActorActOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAnimatedActorActOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bOverrideExistingAct; // 0x0
@@ -12167,14 +12068,14 @@ static_assert(alignof(SAnimatedActorActOrderSaveData) == 0x4, "Wrong alignment f
 class alignas(4) SAnimatedActorMoveOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SAnimatedActorMoveOrderSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SAnimatedActorMoveOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAnimatedActorMoveOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bPrecisePositioning; // 0x0
@@ -12201,14 +12102,12 @@ static_assert(alignof(SAnimatedActorMoveOrderSaveData) == 0x4, "Wrong alignment
 class alignas(8) SAnimatedActorOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAnimatedActorOrderSaveData& p_Other) const;
+	bool operator==(const SAnimatedActorOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAnimatedActorOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	EActorAnimationOrder m_eOrderType; // 0x0
@@ -12223,14 +12122,12 @@ static_assert(alignof(SAnimatedActorOrderSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SAnimatedActorReactOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAnimatedActorReactOrderSaveData& p_Other) const;
+	bool operator==(const SAnimatedActorReactOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAnimatedActorReactOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_vFaceTarget; // 0x0
@@ -12263,14 +12160,14 @@ static_assert(alignof(SAnimatedActorReactOrderSaveData) == 0x8, "Wrong alignment
 class alignas(4) SAnimatedActorStandOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAnimatedActorStandOrderSaveData& p_Other) const;
+	bool operator==(const SAnimatedActorStandOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAnimatedActorStandOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_vFacingDirection; // 0x0
@@ -12283,14 +12180,14 @@ static_assert(alignof(SAnimatedActorStandOrderSaveData) == 0x4, "Wrong alignment
 class alignas(4) SAttentionHUDUIElement
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAttentionHUDUIElement& p_Other) const;
+	bool operator==(const SAttentionHUDUIElement& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAttentionHUDUIElement& p_Other) const { return !(*this == p_Other); }
 
 	float32 fAngle; // 0x0
@@ -12311,14 +12208,12 @@ static_assert(alignof(SAttentionHUDUIElement) == 0x4, "Wrong alignment for SAtte
 class alignas(8) SAttentionHUDUIElementArray_Dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAttentionHUDUIElementArray_Dummy& p_Other) const;
+	bool operator==(const SAttentionHUDUIElementArray_Dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAttentionHUDUIElementArray_Dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SAttentionHUDUIElement> dummy; // 0x0
@@ -12331,14 +12226,14 @@ static_assert(alignof(SAttentionHUDUIElementArray_Dummy) == 0x8, "Wrong alignmen
 class alignas(4) SAudioEmitterEventSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SAudioEmitterEventSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SAudioEmitterEventSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAudioEmitterEventSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nEventId; // 0x0
@@ -12361,14 +12256,14 @@ static_assert(alignof(SAudioEmitterEventSaveData) == 0x4, "Wrong alignment for S
 class alignas(4) SAudioEmitterRTPCSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAudioEmitterRTPCSaveData& p_Other) const;
+	bool operator==(const SAudioEmitterRTPCSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAudioEmitterRTPCSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nParamId; // 0x0
@@ -12383,14 +12278,14 @@ static_assert(alignof(SAudioEmitterRTPCSaveData) == 0x4, "Wrong alignment for SA
 class alignas(4) SAudioEmitterSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAudioEmitterSaveData& p_Other) const;
+	bool operator==(const SAudioEmitterSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAudioEmitterSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEmitter; // 0x0
@@ -12409,14 +12304,14 @@ static_assert(alignof(SAudioEmitterSaveData) == 0x4, "Wrong alignment for SAudio
 class alignas(4) SAudioEmitterStateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SAudioEmitterStateSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SAudioEmitterStateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAudioEmitterStateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nGroupId; // 0x0
@@ -12431,14 +12326,14 @@ static_assert(alignof(SAudioEmitterStateSaveData) == 0x4, "Wrong alignment for S
 class alignas(4) SAudioEmitterSwitchSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAudioEmitterSwitchSaveData& p_Other) const;
+	bool operator==(const SAudioEmitterSwitchSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAudioEmitterSwitchSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nGroupId; // 0x0
@@ -12453,14 +12348,12 @@ static_assert(alignof(SAudioEmitterSwitchSaveData) == 0x4, "Wrong alignment for
 class alignas(8) ZResourceID
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZResourceID& p_Other) const;
+	bool operator==(const ZResourceID& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZResourceID& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_uri; // 0x0
@@ -12473,14 +12366,12 @@ static_assert(alignof(ZResourceID) == 0x8, "Wrong alignment for ZResourceID");
 class alignas(8) SAudioMemoryMonitorEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAudioMemoryMonitorEntry& p_Other) const;
+	bool operator==(const SAudioMemoryMonitorEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAudioMemoryMonitorEntry& p_Other) const { return !(*this == p_Other); }
 
 	uint32 shortId; // 0x0
@@ -12497,14 +12388,12 @@ static_assert(alignof(SAudioMemoryMonitorEntry) == 0x8, "Wrong alignment for SAu
 class alignas(8) SAudioSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SAudioSaveData& p_Other) const;
+	bool operator==(const SAudioSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAudioSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SAudioEmitterSaveData> m_aEmitters; // 0x0
@@ -12529,14 +12418,14 @@ static_assert(alignof(SAudioSaveData) == 0x8, "Wrong alignment for SAudioSaveDat
 class alignas(8) SFSMSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SFSMSaveData& p_Other) const;
+	bool operator==(const SFSMSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFSMSaveData& p_Other) const { return !(*this == p_Other); }
 
 	EFSMStateStatus m_eStateStatus; // 0x0
@@ -12555,14 +12444,14 @@ static_assert(alignof(SFSMSaveData) == 0x8, "Wrong alignment for SFSMSaveData");
 class alignas(16) SAvoidDangerousAreaGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SAvoidDangerousAreaGroupSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SAvoidDangerousAreaGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SAvoidDangerousAreaGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -12583,14 +12472,12 @@ static_assert(alignof(SAvoidDangerousAreaGroupSaveData) == 0x10, "Wrong alignmen
 class alignas(8) SBehaviorTreeEntityReference
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBehaviorTreeEntityReference& p_Other) const;
+	bool operator==(const SBehaviorTreeEntityReference& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBehaviorTreeEntityReference& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bList; // 0x0
@@ -12605,14 +12492,14 @@ static_assert(alignof(SBehaviorTreeEntityReference) == 0x8, "Wrong alignment for
 class alignas(8) SBehaviorTreeEvaluationLogEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBehaviorTreeEvaluationLogEntry& p_Other) const;
+	bool operator==(const SBehaviorTreeEvaluationLogEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBehaviorTreeEvaluationLogEntry& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nBehaviorTreeIndex; // 0x0
@@ -12629,14 +12516,12 @@ static_assert(alignof(SBehaviorTreeEvaluationLogEntry) == 0x8, "Wrong alignment
 class alignas(8) SBehaviorTreeEvaluationLog
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBehaviorTreeEvaluationLog& p_Other) const;
+	bool operator==(const SBehaviorTreeEvaluationLog& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBehaviorTreeEvaluationLog& p_Other) const { return !(*this == p_Other); }
 
 	TArray<ZResourceID> m_BehaviorTrees; // 0x0
@@ -12651,14 +12536,12 @@ static_assert(alignof(SBehaviorTreeEvaluationLog) == 0x8, "Wrong alignment for S
 class alignas(8) SBehaviorTreeInputPinCondition
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBehaviorTreeInputPinCondition& p_Other) const;
+	bool operator==(const SBehaviorTreeInputPinCondition& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBehaviorTreeInputPinCondition& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sName; // 0x0
@@ -12671,14 +12554,12 @@ static_assert(alignof(SBehaviorTreeInputPinCondition) == 0x8, "Wrong alignment f
 class alignas(8) SBehaviorTreeInfo
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBehaviorTreeInfo& p_Other) const;
+	bool operator==(const SBehaviorTreeInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBehaviorTreeInfo& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SBehaviorTreeEntityReference> m_references; // 0x0
@@ -12777,14 +12658,12 @@ public:
 class alignas(8) SBlobsConfigResourceEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBlobsConfigResourceEntry& p_Other) const;
+	bool operator==(const SBlobsConfigResourceEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBlobsConfigResourceEntry& p_Other) const { return !(*this == p_Other); }
 
 	ZString Id; // 0x0
@@ -12874,14 +12753,14 @@ public:
 class alignas(4) SBodyContainerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBodyContainerSaveData& p_Other) const;
+	bool operator==(const SBodyContainerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBodyContainerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZHM5BodyContainer::EBCState m_eBCState; // 0x0
@@ -12900,14 +12779,12 @@ static_assert(alignof(SBodyContainerSaveData) == 0x4, "Wrong alignment for SBody
 class alignas(8) SBodyContainersSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBodyContainersSaveData& p_Other) const;
+	bool operator==(const SBodyContainersSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBodyContainersSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -12922,14 +12799,14 @@ static_assert(alignof(SBodyContainersSaveData) == 0x8, "Wrong alignment for SBod
 class alignas(4) SBodyPartDamageMultipliers
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SBodyPartDamageMultipliers& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SBodyPartDamageMultipliers& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBodyPartDamageMultipliers& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fHeadDamageMultiplier; // 0x0
@@ -12966,14 +12843,14 @@ static_assert(alignof(SBodyPartDamageMultipliers) == 0x4, "Wrong alignment for S
 class alignas(4) SBodybagBoneSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBodybagBoneSaveData& p_Other) const;
+	bool operator==(const SBodybagBoneSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBodybagBoneSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 mQuaterion; // 0x0
@@ -12988,14 +12865,12 @@ static_assert(alignof(SBodybagBoneSaveData) == 0x4, "Wrong alignment for SBodyba
 class alignas(8) SBodybagSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBodybagSaveData& p_Other) const;
+	bool operator==(const SBodybagSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBodybagSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_vLinkedPosition; // 0x0
@@ -13018,14 +12893,14 @@ static_assert(alignof(SBodybagSaveData) == 0x8, "Wrong alignment for SBodybagSav
 class alignas(4) SBoneAttachSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBoneAttachSaveData& p_Other) const;
+	bool operator==(const SBoneAttachSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBoneAttachSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -13040,14 +12915,12 @@ static_assert(alignof(SBoneAttachSaveData) == 0x4, "Wrong alignment for SBoneAtt
 class alignas(8) SBoneScalesList
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBoneScalesList& p_Other) const;
+	bool operator==(const SBoneScalesList& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBoneScalesList& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SVector3> m_aBoneScales; // 0x0
@@ -13060,14 +12933,12 @@ static_assert(alignof(SBoneScalesList) == 0x8, "Wrong alignment for SBoneScalesL
 class alignas(8) SBonusRequirementData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SBonusRequirementData& p_Other) const;
+	bool operator==(const SBonusRequirementData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SBonusRequirementData& p_Other) const { return !(*this == p_Other); }
 
 	ZString lstrTitle; // 0x0
@@ -13082,14 +12953,14 @@ static_assert(alignof(SBonusRequirementData) == 0x8, "Wrong alignment for SBonus
 class alignas(4) SCCEffectSet
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCCEffectSet& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCCEffectSet& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCCEffectSet& p_Other) const { return !(*this == p_Other); }
 
 	ECCDecalEffect m_eDecalEffect; // 0x0
@@ -13104,14 +12975,14 @@ static_assert(alignof(SCCEffectSet) == 0x4, "Wrong alignment for SCCEffectSet");
 class alignas(4) SCamBone
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCamBone& p_Other) const;
+	bool operator==(const SCamBone& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCamBone& p_Other) const { return !(*this == p_Other); }
 
 	BoneId::Enum m_eBoneId; // 0x0
@@ -13140,14 +13011,12 @@ public:
 class alignas(8) SCautiousBackupGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCautiousBackupGroupSaveData& p_Other) const;
+	bool operator==(const SCautiousBackupGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCautiousBackupGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZCautiousBackupGroup::EGroupState m_eGroupState; // 0x0
@@ -13172,14 +13041,14 @@ static_assert(alignof(SCautiousBackupGroupSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SCautiousHuntSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCautiousHuntSaveData& p_Other) const;
+	bool operator==(const SCautiousHuntSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCautiousHuntSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -13253,14 +13122,12 @@ public:
 class alignas(8) SExactCompressedGridFloatField
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SExactCompressedGridFloatField& p_Other) const;
+	bool operator==(const SExactCompressedGridFloatField& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SExactCompressedGridFloatField& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fInitialValue; // 0x0
@@ -13281,14 +13148,12 @@ static_assert(alignof(SExactCompressedGridFloatField) == 0x8, "Wrong alignment f
 class alignas(16) SCautiousInvestigateGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCautiousInvestigateGroupSaveData& p_Other) const;
+	bool operator==(const SCautiousInvestigateGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCautiousInvestigateGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_tGroupStarted; // 0x0
@@ -13373,14 +13238,14 @@ public:
 class alignas(4) SCautiousSearchGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCautiousSearchGroupSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCautiousSearchGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCautiousSearchGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint16 m_searchNode; // 0x0
@@ -13403,14 +13268,14 @@ static_assert(alignof(SCautiousSearchGroupSaveData) == 0x4, "Wrong alignment for
 class alignas(8) SCautiousSituationMemberSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCautiousSituationMemberSaveData& p_Other) const;
+	bool operator==(const SCautiousSituationMemberSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCautiousSituationMemberSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_tLastDisturbance; // 0x0
@@ -13449,14 +13314,14 @@ static_assert(alignof(SCautiousSituationMemberSaveData) == 0x8, "Wrong alignment
 class alignas(8) SCautiousVIPGroupState
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCautiousVIPGroupState& p_Other) const;
+	bool operator==(const SCautiousVIPGroupState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCautiousVIPGroupState& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_tMove; // 0x0
@@ -13469,14 +13334,14 @@ static_assert(alignof(SCautiousVIPGroupState) == 0x8, "Wrong alignment for SCaut
 class alignas(8) SCautiousVIPGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCautiousVIPGroupSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCautiousVIPGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCautiousVIPGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_vip; // 0x0
@@ -13497,14 +13362,14 @@ static_assert(alignof(SCautiousVIPGroupSaveData) == 0x8, "Wrong alignment for SC
 class alignas(4) SChairSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SChairSaveData& p_Other) const;
+	bool operator==(const SChairSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SChairSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -13519,14 +13384,12 @@ static_assert(alignof(SChairSaveData) == 0x4, "Wrong alignment for SChairSaveDat
 class alignas(8) SChallengeSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SChallengeSaveData& p_Other) const;
+	bool operator==(const SChallengeSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SChallengeSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sId; // 0x0
@@ -13541,14 +13404,12 @@ static_assert(alignof(SChallengeSaveData) == 0x8, "Wrong alignment for SChalleng
 class alignas(8) SChallengesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SChallengesSaveData& p_Other) const;
+	bool operator==(const SChallengesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SChallengesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SChallengeSaveData> m_mChallengeStates; // 0x0
@@ -13561,14 +13422,14 @@ static_assert(alignof(SChallengesSaveData) == 0x8, "Wrong alignment for SChallen
 class alignas(4) SCharacterSpeakEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCharacterSpeakEntitySaveData& p_Other) const;
+	bool operator==(const SCharacterSpeakEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCharacterSpeakEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fSeekPosition; // 0x0
@@ -13585,14 +13446,14 @@ static_assert(alignof(SCharacterSpeakEntitySaveData) == 0x4, "Wrong alignment fo
 class alignas(4) SCheckLastPositionGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCheckLastPositionGroupSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCheckLastPositionGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCheckLastPositionGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_pLeader; // 0x0
@@ -13615,14 +13476,14 @@ static_assert(alignof(SCheckLastPositionGroupSaveData) == 0x4, "Wrong alignment
 class alignas(4) SClothBundleSpawnSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SClothBundleSpawnSaveData& p_Other) const;
+	bool operator==(const SClothBundleSpawnSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SClothBundleSpawnSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rClothbundle; // 0x0
@@ -13635,14 +13496,14 @@ static_assert(alignof(SClothBundleSpawnSaveData) == 0x4, "Wrong alignment for SC
 class alignas(1) SClothSheetEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SClothSheetEntitySaveData& p_Other) const;
+	bool operator==(const SClothSheetEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SClothSheetEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bSimulationEnabled; // 0x0
@@ -13657,14 +13518,14 @@ static_assert(alignof(SClothSheetEntitySaveData) == 0x1, "Wrong alignment for SC
 class alignas(2) SClothVertex
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SClothVertex& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SClothVertex& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SClothVertex& p_Other) const { return !(*this == p_Other); }
 
 	uint16 m_nColumn; // 0x0
@@ -13679,14 +13540,14 @@ static_assert(alignof(SClothVertex) == 0x2, "Wrong alignment for SClothVertex");
 class alignas(4) SClothWireEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SClothWireEntitySaveData& p_Other) const;
+	bool operator==(const SClothWireEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SClothWireEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fWireLength; // 0x0
@@ -13705,14 +13566,14 @@ static_assert(alignof(SClothWireEntitySaveData) == 0x4, "Wrong alignment for SCl
 class alignas(16) SCollidingParticle
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCollidingParticle& p_Other) const;
+	bool operator==(const SCollidingParticle& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCollidingParticle& p_Other) const { return !(*this == p_Other); }
 
 	float4 m_vPosition; // 0x0
@@ -13733,14 +13594,14 @@ static_assert(alignof(SCollidingParticle) == 0x10, "Wrong alignment for SCollidi
 class alignas(1) SCollisionControllerAspectSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCollisionControllerAspectSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCollisionControllerAspectSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCollisionControllerAspectSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bCollideHitman; // 0x0
@@ -13755,14 +13616,12 @@ static_assert(alignof(SCollisionControllerAspectSaveData) == 0x1, "Wrong alignme
 class alignas(8) SCollisionControllerAspectsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCollisionControllerAspectsSaveData& p_Other) const;
+	bool operator==(const SCollisionControllerAspectsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCollisionControllerAspectsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -13777,14 +13636,14 @@ static_assert(alignof(SCollisionControllerAspectsSaveData) == 0x8, "Wrong alignm
 class alignas(4) SColorRGBA
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SColorRGBA& p_Other) const;
+	bool operator==(const SColorRGBA& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SColorRGBA& p_Other) const { return !(*this == p_Other); }
 
 	float32 r; // 0x0
@@ -13803,14 +13662,12 @@ static_assert(alignof(SColorRGBA) == 0x4, "Wrong alignment for SColorRGBA");
 class alignas(8) SColorRGBSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SColorRGBSaveData& p_Other) const;
+	bool operator==(const SColorRGBSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SColorRGBSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -13825,14 +13682,14 @@ static_assert(alignof(SColorRGBSaveData) == 0x8, "Wrong alignment for SColorRGBS
 class alignas(16) SCombatOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCombatOrderSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCombatOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCombatOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float4 m_vPos; // 0x0
@@ -13849,14 +13706,14 @@ static_assert(alignof(SCombatOrderSaveData) == 0x10, "Wrong alignment for SComba
 class alignas(4) SCombatSituationMemberSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCombatSituationMemberSaveData& p_Other) const;
+	bool operator==(const SCombatSituationMemberSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCombatSituationMemberSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fDistanceToTarget; // 0x0
@@ -13885,14 +13742,14 @@ static_assert(alignof(SCombatSituationMemberSaveData) == 0x4, "Wrong alignment f
 class alignas(8) SCombatZoneEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCombatZoneEntitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCombatZoneEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCombatZoneEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsInLockdown; // 0x0
@@ -13915,14 +13772,14 @@ static_assert(alignof(SCombatZoneEntitySaveData) == 0x8, "Wrong alignment for SC
 class alignas(4) SComboDeviceBinding
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SComboDeviceBinding& p_Other) const;
+	bool operator==(const SComboDeviceBinding& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SComboDeviceBinding& p_Other) const { return !(*this == p_Other); }
 
 	uint32 type; // 0x0
@@ -13937,14 +13794,12 @@ static_assert(alignof(SComboDeviceBinding) == 0x4, "Wrong alignment for SComboDe
 class alignas(8) SCompressedGridFloatField
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCompressedGridFloatField& p_Other) const;
+	bool operator==(const SCompressedGridFloatField& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCompressedGridFloatField& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsSparse; // 0x0
@@ -13967,14 +13822,14 @@ static_assert(alignof(SCompressedGridFloatField) == 0x8, "Wrong alignment for SC
 class alignas(4) SConditionalTimerEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SConditionalTimerEntitySaveData& p_Other) const;
+	bool operator==(const SConditionalTimerEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SConditionalTimerEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nInterval; // 0x0
@@ -13993,14 +13848,14 @@ static_assert(alignof(SConditionalTimerEntitySaveData) == 0x4, "Wrong alignment
 class alignas(1) SContextActionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SContextActionSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SContextActionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SContextActionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -14017,14 +13872,12 @@ static_assert(alignof(SContextActionSaveData) == 0x1, "Wrong alignment for SCont
 class alignas(8) SContractConfigResourceEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SContractConfigResourceEntry& p_Other) const;
+	bool operator==(const SContractConfigResourceEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SContractConfigResourceEntry& p_Other) const { return !(*this == p_Other); }
 
 	ZString Id; // 0x0
@@ -14039,14 +13892,14 @@ static_assert(alignof(SContractConfigResourceEntry) == 0x8, "Wrong alignment for
 class alignas(1) SContractObjectiveHudHintEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SContractObjectiveHudHintEntitySaveData& p_Other) const;
+	bool operator==(const SContractObjectiveHudHintEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SContractObjectiveHudHintEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bVisible; // 0x0
@@ -14059,14 +13912,12 @@ static_assert(alignof(SContractObjectiveHudHintEntitySaveData) == 0x1, "Wrong al
 class alignas(8) SContractObjectiveSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SContractObjectiveSaveData& p_Other) const;
+	bool operator==(const SContractObjectiveSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SContractObjectiveSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZGuid m_Id; // 0x0
@@ -14143,14 +13994,14 @@ static_assert(alignof(SContractObjectiveSaveData) == 0x8, "Wrong alignment for S
 class alignas(4) SConversationEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SConversationEntry& p_Other) const;
+	bool operator==(const SConversationEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SConversationEntry& p_Other) const { return !(*this == p_Other); }
 
 	EConversationRole m_role; // 0x0
@@ -14165,14 +14016,12 @@ static_assert(alignof(SConversationEntry) == 0x4, "Wrong alignment for SConversa
 class alignas(8) SConversationPart
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SConversationPart& p_Other) const;
+	bool operator==(const SConversationPart& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SConversationPart& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_chance; // 0x0
@@ -14187,14 +14036,12 @@ static_assert(alignof(SConversationPart) == 0x8, "Wrong alignment for SConversat
 class alignas(8) SEntityTemplateProperty
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTemplateProperty& p_Other) const;
+	bool operator==(const SEntityTemplateProperty& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTemplateProperty& p_Other) const { return !(*this == p_Other); }
 
 	uint32 nPropertyID; // 0x0
@@ -14209,14 +14056,12 @@ static_assert(alignof(SEntityTemplateProperty) == 0x8, "Wrong alignment for SEnt
 class alignas(8) SCppEntity
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCppEntity& p_Other) const;
+	bool operator==(const SCppEntity& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCppEntity& p_Other) const { return !(*this == p_Other); }
 
 	int32 blueprintIndexInResourceHeader; // 0x0
@@ -14231,14 +14076,12 @@ static_assert(alignof(SCppEntity) == 0x8, "Wrong alignment for SCppEntity");
 class alignas(8) SCppEntitySubsetInfo
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCppEntitySubsetInfo& p_Other) const;
+	bool operator==(const SCppEntitySubsetInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCppEntitySubsetInfo& p_Other) const { return !(*this == p_Other); }
 
 	ZString name; // 0x0
@@ -14253,14 +14096,12 @@ static_assert(alignof(SCppEntitySubsetInfo) == 0x8, "Wrong alignment for SCppEnt
 class alignas(8) SCppEntityBlueprint
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCppEntityBlueprint& p_Other) const;
+	bool operator==(const SCppEntityBlueprint& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCppEntityBlueprint& p_Other) const { return !(*this == p_Other); }
 
 	TypeID typeName; // 0x0
@@ -14277,14 +14118,14 @@ static_assert(alignof(SCppEntityBlueprint) == 0x8, "Wrong alignment for SCppEnti
 class alignas(16) SRunningCrowdAIEventSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SRunningCrowdAIEventSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SRunningCrowdAIEventSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRunningCrowdAIEventSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_ReactionEntity; // 0x0
@@ -14311,14 +14152,12 @@ static_assert(alignof(SRunningCrowdAIEventSaveData) == 0x10, "Wrong alignment fo
 class alignas(8) SCrowdAIEventSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdAIEventSaveData& p_Other) const;
+	bool operator==(const SCrowdAIEventSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdAIEventSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SRunningCrowdAIEventSaveData> m_RunningEvents; // 0x0
@@ -14331,14 +14170,14 @@ static_assert(alignof(SCrowdAIEventSaveData) == 0x8, "Wrong alignment for SCrowd
 class alignas(4) SCrowdActivitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdActivitySaveData& p_Other) const;
+	bool operator==(const SCrowdActivitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdActivitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -14357,14 +14196,14 @@ static_assert(alignof(SCrowdActivitySaveData) == 0x4, "Wrong alignment for SCrow
 class alignas(16) SCrowdActorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdActorSaveData& p_Other) const;
+	bool operator==(const SCrowdActorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdActorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -14393,14 +14232,12 @@ static_assert(alignof(SCrowdActorSaveData) == 0x10, "Wrong alignment for SCrowdA
 class alignas(8) SCrowdBodySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdBodySaveData& p_Other) const;
+	bool operator==(const SCrowdBodySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdBodySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_pCorpseBodybagEntity; // 0x0
@@ -14427,14 +14264,14 @@ static_assert(alignof(SCrowdBodySaveData) == 0x8, "Wrong alignment for SCrowdBod
 class alignas(128) SCrowdCells
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SCrowdCells& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SCrowdCells& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdCells& p_Other) const { return !(*this == p_Other); }
 
 	TFixedArray<uint8, 128> m_cells; // 0x0
@@ -14447,14 +14284,14 @@ static_assert(alignof(SCrowdCells) == 0x80, "Wrong alignment for SCrowdCells");
 class alignas(4) SCrowdPoseBoneSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdPoseBoneSaveData& p_Other) const;
+	bool operator==(const SCrowdPoseBoneSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdPoseBoneSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 mQuaterion; // 0x0
@@ -14469,14 +14306,12 @@ static_assert(alignof(SCrowdPoseBoneSaveData) == 0x4, "Wrong alignment for SCrow
 class alignas(8) SCrowdPoseSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdPoseSaveData& p_Other) const;
+	bool operator==(const SCrowdPoseSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdPoseSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SCrowdPoseBoneSaveData> m_aBones; // 0x0
@@ -14489,14 +14324,12 @@ static_assert(alignof(SCrowdPoseSaveData) == 0x8, "Wrong alignment for SCrowdPos
 class alignas(8) SCrowdPoseCollectionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdPoseCollectionSaveData& p_Other) const;
+	bool operator==(const SCrowdPoseCollectionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdPoseCollectionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint64 m_id; // 0x0
@@ -14511,14 +14344,12 @@ static_assert(alignof(SCrowdPoseCollectionSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SCrowdDeadPoseRepositorySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdDeadPoseRepositorySaveData& p_Other) const;
+	bool operator==(const SCrowdDeadPoseRepositorySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdDeadPoseRepositorySaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SCrowdPoseCollectionSaveData> m_aPoseCollections; // 0x0
@@ -14531,14 +14362,14 @@ static_assert(alignof(SCrowdDeadPoseRepositorySaveData) == 0x8, "Wrong alignment
 class alignas(16) SRegionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRegionSaveData& p_Other) const;
+	bool operator==(const SRegionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRegionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nIndex; // 0x0
@@ -14569,14 +14400,12 @@ static_assert(alignof(SRegionSaveData) == 0x10, "Wrong alignment for SRegionSave
 class alignas(8) SCrowdEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdEntitySaveData& p_Other) const;
+	bool operator==(const SCrowdEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SCrowdActorSaveData> m_CrowdActorData; // 0x0
@@ -14599,14 +14428,12 @@ static_assert(alignof(SCrowdEntitySaveData) == 0x8, "Wrong alignment for SCrowdE
 class alignas(8) SCrowdFlowChannel
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdFlowChannel& p_Other) const;
+	bool operator==(const SCrowdFlowChannel& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdFlowChannel& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint8> m_aFlowVectorIndex; // 0x0
@@ -14621,14 +14448,14 @@ static_assert(alignof(SCrowdFlowChannel) == 0x8, "Wrong alignment for SCrowdFlow
 class alignas(2) ZCrowdGridPoint
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const ZCrowdGridPoint& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const ZCrowdGridPoint& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZCrowdGridPoint& p_Other) const { return !(*this == p_Other); }
 
 	int16 m_nHeightOffset; // 0x0
@@ -14643,14 +14470,12 @@ static_assert(alignof(ZCrowdGridPoint) == 0x2, "Wrong alignment for ZCrowdGridPo
 class alignas(16) SCrowdMapData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdMapData& p_Other) const;
+	bool operator==(const SCrowdMapData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdMapData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nVersion; // 0x0
@@ -14695,14 +14520,14 @@ static_assert(alignof(SCrowdMapData) == 0x10, "Wrong alignment for SCrowdMapData
 class alignas(4) SCrowdReactionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdReactionSaveData& p_Other) const;
+	bool operator==(const SCrowdReactionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdReactionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nNumPacify; // 0x0
@@ -14723,14 +14548,12 @@ static_assert(alignof(SCrowdReactionSaveData) == 0x4, "Wrong alignment for SCrow
 class alignas(8) SCrowdServiceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCrowdServiceSaveData& p_Other) const;
+	bool operator==(const SCrowdServiceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCrowdServiceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SCrowdBodySaveData> m_aDeadBodies; // 0x0
@@ -14747,14 +14570,14 @@ static_assert(alignof(SCrowdServiceSaveData) == 0x8, "Wrong alignment for SCrowd
 class alignas(8) SCuriousEventSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCuriousEventSaveData& p_Other) const;
+	bool operator==(const SCuriousEventSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCuriousEventSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_tExpiresAt; // 0x0
@@ -14769,14 +14592,12 @@ static_assert(alignof(SCuriousEventSaveData) == 0x8, "Wrong alignment for SCurio
 class alignas(8) SCuriousEventServiceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCuriousEventServiceSaveData& p_Other) const;
+	bool operator==(const SCuriousEventServiceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCuriousEventServiceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SCuriousEventSaveData> m_aCuriousEvents; // 0x0
@@ -14789,14 +14610,12 @@ static_assert(alignof(SCuriousEventServiceSaveData) == 0x8, "Wrong alignment for
 class alignas(4) SCutSequenceData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SCutSequenceData& p_Other) const;
+	bool operator==(const SCutSequenceData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SCutSequenceData& p_Other) const { return !(*this == p_Other); }
 
 	TResourcePtr m_animResource; // 0x0
@@ -14815,14 +14634,14 @@ static_assert(alignof(SCutSequenceData) == 0x4, "Wrong alignment for SCutSequenc
 class alignas(1) SDangerousAreaSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SDangerousAreaSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SDangerousAreaSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDangerousAreaSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bDangerous; // 0x0
@@ -14835,14 +14654,14 @@ static_assert(alignof(SDangerousAreaSaveData) == 0x1, "Wrong alignment for SDang
 class alignas(16) SDeadActorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDeadActorSaveData& p_Other) const;
+	bool operator==(const SDeadActorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDeadActorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -14861,14 +14680,12 @@ static_assert(alignof(SDeadActorSaveData) == 0x10, "Wrong alignment for SDeadAct
 class alignas(8) SDeadBodyInfoSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDeadBodyInfoSaveData& p_Other) const;
+	bool operator==(const SDeadBodyInfoSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDeadBodyInfoSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -14905,14 +14722,12 @@ static_assert(alignof(SDeadBodyInfoSaveData) == 0x8, "Wrong alignment for SDeadB
 class alignas(8) SDeadBodySensorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDeadBodySensorSaveData& p_Other) const;
+	bool operator==(const SDeadBodySensorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDeadBodySensorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SDeadBodyInfoSaveData> m_aBodies; // 0x0
@@ -14927,14 +14742,14 @@ static_assert(alignof(SDeadBodySensorSaveData) == 0x8, "Wrong alignment for SDea
 class alignas(4) SVector2
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVector2& p_Other) const;
+	bool operator==(const SVector2& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVector2& p_Other) const { return !(*this == p_Other); }
 
 	float32 x; // 0x0
@@ -14949,14 +14764,14 @@ static_assert(alignof(SVector2) == 0x4, "Wrong alignment for SVector2");
 class alignas(16) SDecalSpawnSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SDecalSpawnSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SDecalSpawnSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDecalSpawnSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bWasSpawned; // 0x0
@@ -14989,14 +14804,14 @@ static_assert(alignof(SDecalSpawnSaveData) == 0x10, "Wrong alignment for SDecalS
 class alignas(4) SDestructibleInteractionHandlerData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDestructibleInteractionHandlerData& p_Other) const;
+	bool operator==(const SDestructibleInteractionHandlerData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDestructibleInteractionHandlerData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fSettleTime; // 0x0
@@ -15009,14 +14824,12 @@ static_assert(alignof(SDestructibleInteractionHandlerData) == 0x4, "Wrong alignm
 class alignas(16) SDestructiblePieceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDestructiblePieceSaveData& p_Other) const;
+	bool operator==(const SDestructiblePieceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDestructiblePieceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SMatrix m_mTransform; // 0x0
@@ -15041,14 +14854,12 @@ static_assert(alignof(SDestructiblePieceSaveData) == 0x10, "Wrong alignment for
 class alignas(8) SDestructibleRuntimeConnnection
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDestructibleRuntimeConnnection& p_Other) const;
+	bool operator==(const SDestructibleRuntimeConnnection& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDestructibleRuntimeConnnection& p_Other) const { return !(*this == p_Other); }
 
 	uint16 m_nPieceIndex; // 0x0
@@ -15063,14 +14874,14 @@ static_assert(alignof(SDestructibleRuntimeConnnection) == 0x8, "Wrong alignment
 class alignas(4) SDestructibleRuntimeDamage
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDestructibleRuntimeDamage& p_Other) const;
+	bool operator==(const SDestructibleRuntimeDamage& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDestructibleRuntimeDamage& p_Other) const { return !(*this == p_Other); }
 
 	uint16 m_nPieceIndex; // 0x0
@@ -15085,14 +14896,12 @@ static_assert(alignof(SDestructibleRuntimeDamage) == 0x4, "Wrong alignment for S
 class alignas(8) SDestructibleObjectSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDestructibleObjectSaveData& p_Other) const;
+	bool operator==(const SDestructibleObjectSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDestructibleObjectSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SDestructibleInteractionHandlerData m_interactionData; // 0x0
@@ -15125,14 +14934,14 @@ static_assert(alignof(SDestructibleObjectSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SDetectedInPrivateGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SDetectedInPrivateGroupSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SDetectedInPrivateGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDetectedInPrivateGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -15155,14 +14964,14 @@ static_assert(alignof(SDetectedInPrivateGroupSaveData) == 0x8, "Wrong alignment
 class alignas(1) SDisguiseZoneSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDisguiseZoneSaveData& p_Other) const;
+	bool operator==(const SDisguiseZoneSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDisguiseZoneSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -15175,14 +14984,14 @@ static_assert(alignof(SDisguiseZoneSaveData) == 0x1, "Wrong alignment for SDisgu
 class alignas(8) SDisturbanceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDisturbanceSaveData& p_Other) const;
+	bool operator==(const SDisturbanceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDisturbanceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_object; // 0x0
@@ -15205,14 +15014,14 @@ static_assert(alignof(SDisturbanceSaveData) == 0x8, "Wrong alignment for SDistur
 class alignas(8) SDoorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SDoorSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SDoorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDoorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nDoorState; // 0x0
@@ -15245,14 +15054,12 @@ public:
 class alignas(8) SDoorsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDoorsSaveData& p_Other) const;
+	bool operator==(const SDoorsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDoorsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15267,14 +15074,12 @@ static_assert(alignof(SDoorsSaveData) == 0x8, "Wrong alignment for SDoorsSaveDat
 class alignas(8) SDrama2ActorSaveState
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDrama2ActorSaveState& p_Other) const;
+	bool operator==(const SDrama2ActorSaveState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDrama2ActorSaveState& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -15311,14 +15116,12 @@ static_assert(alignof(SDrama2ActorSaveState) == 0x8, "Wrong alignment for SDrama
 class alignas(8) SDrama2ActorCollectionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDrama2ActorCollectionSaveData& p_Other) const;
+	bool operator==(const SDrama2ActorCollectionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDrama2ActorCollectionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15333,14 +15136,14 @@ static_assert(alignof(SDrama2ActorCollectionSaveData) == 0x8, "Wrong alignment f
 class alignas(4) SDrama2SetupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDrama2SetupSaveData& p_Other) const;
+	bool operator==(const SDrama2SetupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDrama2SetupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bDoneTriggered; // 0x0
@@ -15357,14 +15160,12 @@ static_assert(alignof(SDrama2SetupSaveData) == 0x4, "Wrong alignment for SDrama2
 class alignas(8) SDrama2SetupCollectionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDrama2SetupCollectionSaveData& p_Other) const;
+	bool operator==(const SDrama2SetupCollectionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDrama2SetupCollectionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15379,14 +15180,14 @@ static_assert(alignof(SDrama2SetupCollectionSaveData) == 0x8, "Wrong alignment f
 class alignas(4) SDrama2SituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDrama2SituationSaveData& p_Other) const;
+	bool operator==(const SDrama2SituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDrama2SituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_nPriorityModifier; // 0x0
@@ -15411,14 +15212,12 @@ static_assert(alignof(SDrama2SituationSaveData) == 0x4, "Wrong alignment for SDr
 class alignas(8) SDrama2SituationCollectionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDrama2SituationCollectionSaveData& p_Other) const;
+	bool operator==(const SDrama2SituationCollectionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDrama2SituationCollectionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15433,14 +15232,12 @@ static_assert(alignof(SDrama2SituationCollectionSaveData) == 0x8, "Wrong alignme
 class alignas(8) SDramaActorSaveState
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDramaActorSaveState& p_Other) const;
+	bool operator==(const SDramaActorSaveState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDramaActorSaveState& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -15471,14 +15268,12 @@ static_assert(alignof(SDramaActorSaveState) == 0x8, "Wrong alignment for SDramaA
 class alignas(8) SDramaActorCollectionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDramaActorCollectionSaveData& p_Other) const;
+	bool operator==(const SDramaActorCollectionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDramaActorCollectionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15493,14 +15288,14 @@ static_assert(alignof(SDramaActorCollectionSaveData) == 0x8, "Wrong alignment fo
 class alignas(1) SDramaControllerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SDramaControllerSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SDramaControllerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDramaControllerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsStartCondValid; // 0x0
@@ -15527,14 +15322,12 @@ public:
 class alignas(8) ZCurve
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZCurve& p_Other) const;
+	bool operator==(const ZCurve& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZCurve& p_Other) const { return !(*this == p_Other); }
 
 	TArray<TFixedArray<float32, 8>> data; // 0x0
@@ -15562,14 +15355,14 @@ public:
 class alignas(4) SDramaSetupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDramaSetupSaveData& p_Other) const;
+	bool operator==(const SDramaSetupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDramaSetupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bDoneTriggered; // 0x0
@@ -15586,14 +15379,12 @@ static_assert(alignof(SDramaSetupSaveData) == 0x4, "Wrong alignment for SDramaSe
 class alignas(8) SDramaSetupCollectionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDramaSetupCollectionSaveData& p_Other) const;
+	bool operator==(const SDramaSetupCollectionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDramaSetupCollectionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15608,14 +15399,14 @@ static_assert(alignof(SDramaSetupCollectionSaveData) == 0x8, "Wrong alignment fo
 class alignas(4) SDramaSituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDramaSituationSaveData& p_Other) const;
+	bool operator==(const SDramaSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDramaSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bSituationRunning; // 0x0
@@ -15636,14 +15427,12 @@ static_assert(alignof(SDramaSituationSaveData) == 0x4, "Wrong alignment for SDra
 class alignas(8) SDramaSituationCollectionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDramaSituationCollectionSaveData& p_Other) const;
+	bool operator==(const SDramaSituationCollectionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDramaSituationCollectionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -15658,14 +15447,14 @@ static_assert(alignof(SDramaSituationCollectionSaveData) == 0x8, "Wrong alignmen
 class alignas(16) SDynamicEnforcerCandidateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SDynamicEnforcerCandidateSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SDynamicEnforcerCandidateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDynamicEnforcerCandidateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -15684,14 +15473,12 @@ static_assert(alignof(SDynamicEnforcerCandidateSaveData) == 0x10, "Wrong alignme
 class alignas(8) SDynamicEnforcerServiceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDynamicEnforcerServiceSaveData& p_Other) const;
+	bool operator==(const SDynamicEnforcerServiceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDynamicEnforcerServiceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SDynamicEnforcerCandidateSaveData> m_aCandidates; // 0x0
@@ -15704,14 +15491,12 @@ static_assert(alignof(SDynamicEnforcerServiceSaveData) == 0x8, "Wrong alignment
 class alignas(8) SDynamicObjectKeyValuePair
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDynamicObjectKeyValuePair& p_Other) const;
+	bool operator==(const SDynamicObjectKeyValuePair& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDynamicObjectKeyValuePair& p_Other) const { return !(*this == p_Other); }
 
 	ZString sKey; // 0x0
@@ -15726,14 +15511,14 @@ static_assert(alignof(SDynamicObjectKeyValuePair) == 0x8, "Wrong alignment for S
 class alignas(1) SDynamicRayCastEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SDynamicRayCastEntitySaveData& p_Other) const;
+	bool operator==(const SDynamicRayCastEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SDynamicRayCastEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -15750,14 +15535,14 @@ static_assert(alignof(SDynamicRayCastEntitySaveData) == 0x1, "Wrong alignment fo
 class alignas(4) SEntityEventChannelSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityEventChannelSaveData& p_Other) const;
+	bool operator==(const SEntityEventChannelSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityEventChannelSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -15772,14 +15557,12 @@ static_assert(alignof(SEntityEventChannelSaveData) == 0x4, "Wrong alignment for
 class alignas(8) SEntityPath
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityPath& p_Other) const;
+	bool operator==(const SEntityPath& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityPath& p_Other) const { return !(*this == p_Other); }
 
 	uint64 m_nOwnerID; // 0x0
@@ -15794,14 +15577,12 @@ static_assert(alignof(SEntityPath) == 0x8, "Wrong alignment for SEntityPath");
 class alignas(8) SEntityPinDescriptor
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityPinDescriptor& p_Other) const;
+	bool operator==(const SEntityPinDescriptor& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityPinDescriptor& p_Other) const { return !(*this == p_Other); }
 
 	ZString sName; // 0x0
@@ -15824,14 +15605,12 @@ static_assert(alignof(SEntityPinDescriptor) == 0x8, "Wrong alignment for SEntity
 class alignas(8) SEntityPropertyDescriptor
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityPropertyDescriptor& p_Other) const;
+	bool operator==(const SEntityPropertyDescriptor& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityPropertyDescriptor& p_Other) const { return !(*this == p_Other); }
 
 	ZString sName; // 0x0
@@ -15850,14 +15629,12 @@ static_assert(alignof(SEntityPropertyDescriptor) == 0x8, "Wrong alignment for SE
 class alignas(8) SEntityTemplateEntitySubset
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTemplateEntitySubset& p_Other) const;
+	bool operator==(const SEntityTemplateEntitySubset& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTemplateEntitySubset& p_Other) const { return !(*this == p_Other); }
 
 	TArray<int32> entities; // 0x0
@@ -15870,14 +15647,12 @@ static_assert(alignof(SEntityTemplateEntitySubset) == 0x8, "Wrong alignment for
 class alignas(8) SEntityTemplateReference
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTemplateReference& p_Other) const;
+	bool operator==(const SEntityTemplateReference& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTemplateReference& p_Other) const { return !(*this == p_Other); }
 
 	uint64 entityID; // 0x0
@@ -15896,14 +15671,12 @@ static_assert(alignof(SEntityTemplateReference) == 0x8, "Wrong alignment for SEn
 class alignas(8) SEntityTemplateExposedEntity
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTemplateExposedEntity& p_Other) const;
+	bool operator==(const SEntityTemplateExposedEntity& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTemplateExposedEntity& p_Other) const { return !(*this == p_Other); }
 
 	ZString sName; // 0x0
@@ -15920,14 +15693,12 @@ static_assert(alignof(SEntityTemplateExposedEntity) == 0x8, "Wrong alignment for
 class alignas(8) SEntityTemplatePinConnection
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTemplatePinConnection& p_Other) const;
+	bool operator==(const SEntityTemplatePinConnection& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTemplatePinConnection& p_Other) const { return !(*this == p_Other); }
 
 	int32 fromID; // 0x0
@@ -15948,14 +15719,12 @@ static_assert(alignof(SEntityTemplatePinConnection) == 0x8, "Wrong alignment for
 class alignas(8) SEntityTemplatePlatformSpecificProperty
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTemplatePlatformSpecificProperty& p_Other) const;
+	bool operator==(const SEntityTemplatePlatformSpecificProperty& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTemplatePlatformSpecificProperty& p_Other) const { return !(*this == p_Other); }
 
 	SEntityTemplateProperty propertyValue; // 0x0
@@ -15972,14 +15741,12 @@ static_assert(alignof(SEntityTemplatePlatformSpecificProperty) == 0x8, "Wrong al
 class alignas(8) SEntityTemplatePropertyAlias
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTemplatePropertyAlias& p_Other) const;
+	bool operator==(const SEntityTemplatePropertyAlias& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTemplatePropertyAlias& p_Other) const { return !(*this == p_Other); }
 
 	ZString sAliasName; // 0x0
@@ -15996,14 +15763,12 @@ static_assert(alignof(SEntityTemplatePropertyAlias) == 0x8, "Wrong alignment for
 class alignas(8) SEntityTemplatePropertyOverride
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTemplatePropertyOverride& p_Other) const;
+	bool operator==(const SEntityTemplatePropertyOverride& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTemplatePropertyOverride& p_Other) const { return !(*this == p_Other); }
 
 	SEntityTemplateReference propertyOwner; // 0x0
@@ -16018,14 +15783,12 @@ static_assert(alignof(SEntityTemplatePropertyOverride) == 0x8, "Wrong alignment
 class alignas(8) SExposedEntityDescriptor
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SExposedEntityDescriptor& p_Other) const;
+	bool operator==(const SExposedEntityDescriptor& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SExposedEntityDescriptor& p_Other) const { return !(*this == p_Other); }
 
 	ZString sName; // 0x0
@@ -16046,14 +15809,12 @@ static_assert(alignof(SExposedEntityDescriptor) == 0x8, "Wrong alignment for SEx
 class alignas(8) SExposedEntityTypeDescriptor
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SExposedEntityTypeDescriptor& p_Other) const;
+	bool operator==(const SExposedEntityTypeDescriptor& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SExposedEntityTypeDescriptor& p_Other) const { return !(*this == p_Other); }
 
 	ZString sName; // 0x0
@@ -16070,14 +15831,12 @@ static_assert(alignof(SExposedEntityTypeDescriptor) == 0x8, "Wrong alignment for
 class alignas(8) STypeReference
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STypeReference& p_Other) const;
+	bool operator==(const STypeReference& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STypeReference& p_Other) const { return !(*this == p_Other); }
 
 	ZString sEntityID; // 0x0
@@ -16092,14 +15851,12 @@ static_assert(alignof(STypeReference) == 0x8, "Wrong alignment for STypeReferenc
 class alignas(8) SExposedTypeInfo
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SExposedTypeInfo& p_Other) const;
+	bool operator==(const SExposedTypeInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SExposedTypeInfo& p_Other) const { return !(*this == p_Other); }
 
 	ZString sName; // 0x0
@@ -16118,14 +15875,12 @@ static_assert(alignof(SExposedTypeInfo) == 0x8, "Wrong alignment for SExposedTyp
 class alignas(8) SEntityTypeDescriptor
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEntityTypeDescriptor& p_Other) const;
+	bool operator==(const SEntityTypeDescriptor& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEntityTypeDescriptor& p_Other) const { return !(*this == p_Other); }
 
 	ZString typeName; // 0x0
@@ -16164,14 +15919,12 @@ static_assert(alignof(SEntityTypeDescriptor) == 0x8, "Wrong alignment for SEntit
 class alignas(8) SEnvironmentConfigResourceEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEnvironmentConfigResourceEntry& p_Other) const;
+	bool operator==(const SEnvironmentConfigResourceEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEnvironmentConfigResourceEntry& p_Other) const { return !(*this == p_Other); }
 
 	ZString Name; // 0x0
@@ -16192,14 +15945,12 @@ static_assert(alignof(SEnvironmentConfigResourceEntry) == 0x8, "Wrong alignment
 class alignas(8) SEnvironmentConfigResource
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEnvironmentConfigResource& p_Other) const;
+	bool operator==(const SEnvironmentConfigResource& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEnvironmentConfigResource& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SEnvironmentConfigResourceEntry> Environments; // 0x0
@@ -16212,14 +15963,14 @@ static_assert(alignof(SEnvironmentConfigResource) == 0x8, "Wrong alignment for S
 class alignas(16) SEscortOutBehaviorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SEscortOutBehaviorSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SEscortOutBehaviorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEscortOutBehaviorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nSituation; // 0x0
@@ -16258,14 +16009,12 @@ static_assert(alignof(SEscortOutBehaviorSaveData) == 0x10, "Wrong alignment for
 class alignas(8) SEscortOutOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEscortOutOrderSaveData& p_Other) const;
+	bool operator==(const SEscortOutOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEscortOutOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<float4> m_aExitPoints; // 0x0
@@ -16305,14 +16054,14 @@ public:
 class alignas(4) SEscortSituation2ActorStateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEscortSituation2ActorStateSaveData& p_Other) const;
+	bool operator==(const SEscortSituation2ActorStateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEscortSituation2ActorStateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nID; // 0x0
@@ -16337,14 +16086,14 @@ static_assert(alignof(SEscortSituation2ActorStateSaveData) == 0x4, "Wrong alignm
 class alignas(4) SEscortSituation2Actors
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEscortSituation2Actors& p_Other) const;
+	bool operator==(const SEscortSituation2Actors& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEscortSituation2Actors& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -16357,14 +16106,12 @@ static_assert(alignof(SEscortSituation2Actors) == 0x4, "Wrong alignment for SEsc
 class alignas(8) SEscortSituation2SaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEscortSituation2SaveData& p_Other) const;
+	bool operator==(const SEscortSituation2SaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEscortSituation2SaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bActivated; // 0x0
@@ -16440,14 +16187,14 @@ public:
 class alignas(4) SEscortSituationActorStateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SEscortSituationActorStateSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SEscortSituationActorStateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEscortSituationActorStateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nID; // 0x0
@@ -16472,14 +16219,14 @@ static_assert(alignof(SEscortSituationActorStateSaveData) == 0x4, "Wrong alignme
 class alignas(4) SEscortSituationActors
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEscortSituationActors& p_Other) const;
+	bool operator==(const SEscortSituationActors& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEscortSituationActors& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -16492,14 +16239,12 @@ static_assert(alignof(SEscortSituationActors) == 0x4, "Wrong alignment for SEsco
 class alignas(8) SEscortSituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEscortSituationSaveData& p_Other) const;
+	bool operator==(const SEscortSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEscortSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bActivated; // 0x0
@@ -16548,14 +16293,14 @@ static_assert(alignof(SEscortSituationSaveData) == 0x8, "Wrong alignment for SEs
 class alignas(4) SEvacuateSituationMemberSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEvacuateSituationMemberSaveData& p_Other) const;
+	bool operator==(const SEvacuateSituationMemberSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEvacuateSituationMemberSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_pGuardDutyPoint; // 0x0
@@ -16572,14 +16317,12 @@ static_assert(alignof(SEvacuateSituationMemberSaveData) == 0x4, "Wrong alignment
 class alignas(8) SEvacuateSituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEvacuateSituationSaveData& p_Other) const;
+	bool operator==(const SEvacuateSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEvacuateSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -16604,14 +16347,14 @@ static_assert(alignof(SEvacuateSituationSaveData) == 0x8, "Wrong alignment for S
 class alignas(8) SEvacuateTrespassGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SEvacuateTrespassGroupSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SEvacuateTrespassGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEvacuateTrespassGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -16640,14 +16383,12 @@ static_assert(alignof(SEvacuateTrespassGroupSaveData) == 0x8, "Wrong alignment f
 class alignas(8) SEvacuateVIPGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEvacuateVIPGroupSaveData& p_Other) const;
+	bool operator==(const SEvacuateVIPGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEvacuateVIPGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -16688,14 +16429,14 @@ static_assert(alignof(SEvacuateVIPGroupSaveData) == 0x8, "Wrong alignment for SE
 class alignas(1) SEventChannelSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEventChannelSaveData& p_Other) const;
+	bool operator==(const SEventChannelSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEventChannelSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -16708,14 +16449,12 @@ static_assert(alignof(SEventChannelSaveData) == 0x1, "Wrong alignment for SEvent
 class alignas(8) SEvergreenMenuCursorDecorationData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEvergreenMenuCursorDecorationData& p_Other) const;
+	bool operator==(const SEvergreenMenuCursorDecorationData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEvergreenMenuCursorDecorationData& p_Other) const { return !(*this == p_Other); }
 
 	ZString icon; // 0x0
@@ -16732,14 +16471,12 @@ static_assert(alignof(SEvergreenMenuCursorDecorationData) == 0x8, "Wrong alignme
 class alignas(8) SEvergreenMenuLabelData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEvergreenMenuLabelData& p_Other) const;
+	bool operator==(const SEvergreenMenuLabelData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEvergreenMenuLabelData& p_Other) const { return !(*this == p_Other); }
 
 	EEvergreenMenuLabelPurpose purpose; // 0x0
@@ -16754,14 +16491,12 @@ static_assert(alignof(SEvergreenMenuLabelData) == 0x8, "Wrong alignment for SEve
 class alignas(8) SEvergreenMenuHeadlineData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEvergreenMenuHeadlineData& p_Other) const;
+	bool operator==(const SEvergreenMenuHeadlineData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEvergreenMenuHeadlineData& p_Other) const { return !(*this == p_Other); }
 
 	ZString lstrMicroMessage; // 0x0
@@ -16784,14 +16519,12 @@ static_assert(alignof(SEvergreenMenuHeadlineData) == 0x8, "Wrong alignment for S
 class alignas(8) SEvergreenMenuPerkData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEvergreenMenuPerkData& p_Other) const;
+	bool operator==(const SEvergreenMenuPerkData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEvergreenMenuPerkData& p_Other) const { return !(*this == p_Other); }
 
 	ZString icon; // 0x0
@@ -16810,14 +16543,12 @@ static_assert(alignof(SEvergreenMenuPerkData) == 0x8, "Wrong alignment for SEver
 class alignas(8) SEvergreenMenuInfoPanelRData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SEvergreenMenuInfoPanelRData& p_Other) const;
+	bool operator==(const SEvergreenMenuInfoPanelRData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SEvergreenMenuInfoPanelRData& p_Other) const { return !(*this == p_Other); }
 
 	ZString icon; // 0x0
@@ -16840,14 +16571,14 @@ static_assert(alignof(SEvergreenMenuInfoPanelRData) == 0x8, "Wrong alignment for
 class alignas(1) SExitSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SExitSaveData& p_Other) const;
+	bool operator==(const SExitSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SExitSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -16860,14 +16591,14 @@ static_assert(alignof(SExitSaveData) == 0x1, "Wrong alignment for SExitSaveData"
 class alignas(1) SExitsActiveSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SExitsActiveSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SExitsActiveSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SExitsActiveSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsActive; // 0x0
@@ -16880,14 +16611,12 @@ static_assert(alignof(SExitsActiveSaveData) == 0x1, "Wrong alignment for SExitsA
 class alignas(8) SExtendedCppEntityProperty
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SExtendedCppEntityProperty& p_Other) const;
+	bool operator==(const SExtendedCppEntityProperty& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SExtendedCppEntityProperty& p_Other) const { return !(*this == p_Other); }
 
 	ZString propertyName; // 0x0
@@ -16906,14 +16635,12 @@ static_assert(alignof(SExtendedCppEntityProperty) == 0x8, "Wrong alignment for S
 class alignas(8) SExtendedCppEntityBlueprint
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SExtendedCppEntityBlueprint& p_Other) const;
+	bool operator==(const SExtendedCppEntityBlueprint& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SExtendedCppEntityBlueprint& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SExtendedCppEntityProperty> properties; // 0x0
@@ -16926,14 +16653,12 @@ static_assert(alignof(SExtendedCppEntityBlueprint) == 0x8, "Wrong alignment for
 class alignas(8) SExternalEntityTemplatePinConnection
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SExternalEntityTemplatePinConnection& p_Other) const;
+	bool operator==(const SExternalEntityTemplatePinConnection& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SExternalEntityTemplatePinConnection& p_Other) const { return !(*this == p_Other); }
 
 	SEntityTemplateReference fromEntity; // 0x0
@@ -16954,14 +16679,14 @@ static_assert(alignof(SExternalEntityTemplatePinConnection) == 0x8, "Wrong align
 class alignas(4) SFaceOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SFaceOrderSaveData& p_Other) const;
+	bool operator==(const SFaceOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFaceOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bLookAt; // 0x0
@@ -16984,14 +16709,14 @@ static_assert(alignof(SFaceOrderSaveData) == 0x4, "Wrong alignment for SFaceOrde
 class alignas(4) SFleeOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SFleeOrderSaveData& p_Other) const;
+	bool operator==(const SFleeOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFleeOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	EDisturbanceType m_eHelpReason; // 0x0
@@ -17008,14 +16733,12 @@ static_assert(alignof(SFleeOrderSaveData) == 0x4, "Wrong alignment for SFleeOrde
 class alignas(8) SFontDefinition
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SFontDefinition& p_Other) const;
+	bool operator==(const SFontDefinition& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFontDefinition& p_Other) const { return !(*this == p_Other); }
 
 	ZString sFontId; // 0x0
@@ -17034,14 +16757,12 @@ static_assert(alignof(SFontDefinition) == 0x8, "Wrong alignment for SFontDefinit
 class alignas(8) SFontLibraryDefinition
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SFontLibraryDefinition& p_Other) const;
+	bool operator==(const SFontLibraryDefinition& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFontLibraryDefinition& p_Other) const { return !(*this == p_Other); }
 
 	ZString sFontLocaleID; // 0x0
@@ -17056,14 +16777,12 @@ static_assert(alignof(SFontLibraryDefinition) == 0x8, "Wrong alignment for SFont
 class alignas(8) SFooStruct
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SFooStruct& p_Other) const;
+	bool operator==(const SFooStruct& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFooStruct& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_eTest; // 0x0
@@ -17088,14 +16807,14 @@ public:
 
 
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SFootIKEventData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SFootIKEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFootIKEventData& p_Other) const { return !(*this == p_Other); }
 
 	SFootIKEventData::EFoot m_Foot; // 0x0
@@ -17130,14 +16849,14 @@ public:
 class alignas(8) SFriskSuspectGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SFriskSuspectGroupSaveData& p_Other) const;
+	bool operator==(const SFriskSuspectGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SFriskSuspectGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -17180,14 +16899,14 @@ static_assert(alignof(SFriskSuspectGroupSaveData) == 0x8, "Wrong alignment for S
 class alignas(4) SGBufferSample
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGBufferSample& p_Other) const;
+	bool operator==(const SGBufferSample& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGBufferSample& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 normal; // 0x0
@@ -17214,14 +16933,14 @@ static_assert(alignof(SGBufferSample) == 0x4, "Wrong alignment for SGBufferSampl
 class alignas(16) SGProperties
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SGProperties& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SGProperties& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGProperties& p_Other) const { return !(*this == p_Other); }
 
 	float4 vMin; // 0x0
@@ -17242,14 +16961,14 @@ static_assert(alignof(SGProperties) == 0x10, "Wrong alignment for SGProperties")
 class alignas(4) SGUIViewPort
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGUIViewPort& p_Other) const;
+	bool operator==(const SGUIViewPort& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGUIViewPort& p_Other) const { return !(*this == p_Other); }
 
 	uint32 x; // 0x0
@@ -17268,14 +16987,14 @@ static_assert(alignof(SGUIViewPort) == 0x4, "Wrong alignment for SGUIViewPort");
 class alignas(16) SGWaypoint
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGWaypoint& p_Other) const;
+	bool operator==(const SGWaypoint& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGWaypoint& p_Other) const { return !(*this == p_Other); }
 
 	uint16 nNeighbor0; // 0x0
@@ -17308,14 +17027,14 @@ static_assert(alignof(SGWaypoint) == 0x10, "Wrong alignment for SGWaypoint");
 class alignas(4) SGaitTransitionEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SGaitTransitionEntry& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SGaitTransitionEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGaitTransitionEntry& p_Other) const { return !(*this == p_Other); }
 
 	EGait m_gait; // 0x0
@@ -17330,14 +17049,14 @@ static_assert(alignof(SGaitTransitionEntry) == 0x4, "Wrong alignment for SGaitTr
 class alignas(4) SGameCamProfileEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGameCamProfileEntitySaveData& p_Other) const;
+	bool operator==(const SGameCamProfileEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGameCamProfileEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsEnabled; // 0x0
@@ -17352,14 +17071,14 @@ static_assert(alignof(SGameCamProfileEntitySaveData) == 0x4, "Wrong alignment fo
 class alignas(1) SShotListenerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SShotListenerSaveData& p_Other) const;
+	bool operator==(const SShotListenerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SShotListenerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -17374,14 +17093,12 @@ static_assert(alignof(SShotListenerSaveData) == 0x1, "Wrong alignment for SShotL
 class alignas(8) SShotListenersSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SShotListenersSaveData& p_Other) const;
+	bool operator==(const SShotListenersSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SShotListenersSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -17396,14 +17113,14 @@ static_assert(alignof(SShotListenersSaveData) == 0x8, "Wrong alignment for SShot
 class alignas(8) SVIPEvacuationNodeSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SVIPEvacuationNodeSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SVIPEvacuationNodeSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVIPEvacuationNodeSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fPenaltyMultiplier; // 0x0
@@ -17424,14 +17141,12 @@ static_assert(alignof(SVIPEvacuationNodeSaveData) == 0x8, "Wrong alignment for S
 class alignas(8) SVIPEvacuationNodesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVIPEvacuationNodesSaveData& p_Other) const;
+	bool operator==(const SVIPEvacuationNodesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVIPEvacuationNodesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -17446,14 +17161,14 @@ static_assert(alignof(SVIPEvacuationNodesSaveData) == 0x8, "Wrong alignment for
 class alignas(4) SItemSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SItemSaveData& p_Other) const;
+	bool operator==(const SItemSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_vPosition; // 0x0
@@ -17508,14 +17223,12 @@ static_assert(alignof(SItemSaveData) == 0x4, "Wrong alignment for SItemSaveData"
 class alignas(8) SItemsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SItemsSaveData& p_Other) const;
+	bool operator==(const SItemsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -17530,14 +17243,14 @@ static_assert(alignof(SItemsSaveData) == 0x8, "Wrong alignment for SItemsSaveDat
 class alignas(4) SMathMultiplyDivideSaveData_SVector4
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultiplyDivideSaveData_SVector4& p_Other) const;
+	bool operator==(const SMathMultiplyDivideSaveData_SVector4& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultiplyDivideSaveData_SVector4& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 m_fA; // 0x0
@@ -17554,14 +17267,12 @@ static_assert(alignof(SMathMultiplyDivideSaveData_SVector4) == 0x4, "Wrong align
 class alignas(8) SMathMultipliesSaveData_SVector4
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultipliesSaveData_SVector4& p_Other) const;
+	bool operator==(const SMathMultipliesSaveData_SVector4& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultipliesSaveData_SVector4& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -17576,14 +17287,14 @@ static_assert(alignof(SMathMultipliesSaveData_SVector4) == 0x8, "Wrong alignment
 class alignas(1) SVolumeTriggerListenerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SVolumeTriggerListenerSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SVolumeTriggerListenerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVolumeTriggerListenerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bColliding; // 0x0
@@ -17598,14 +17309,12 @@ static_assert(alignof(SVolumeTriggerListenerSaveData) == 0x1, "Wrong alignment f
 class alignas(8) SVolumeTriggersSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVolumeTriggersSaveData& p_Other) const;
+	bool operator==(const SVolumeTriggersSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVolumeTriggersSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -17620,14 +17329,14 @@ static_assert(alignof(SVolumeTriggersSaveData) == 0x8, "Wrong alignment for SVol
 class alignas(4) SMathMultiplyDivideSaveData_SVector3
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultiplyDivideSaveData_SVector3& p_Other) const;
+	bool operator==(const SMathMultiplyDivideSaveData_SVector3& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultiplyDivideSaveData_SVector3& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_fA; // 0x0
@@ -17644,14 +17353,12 @@ static_assert(alignof(SMathMultiplyDivideSaveData_SVector3) == 0x4, "Wrong align
 class alignas(8) SMathMultipliesSaveData_SVector3
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultipliesSaveData_SVector3& p_Other) const;
+	bool operator==(const SMathMultipliesSaveData_SVector3& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultipliesSaveData_SVector3& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -17666,14 +17373,14 @@ static_assert(alignof(SMathMultipliesSaveData_SVector3) == 0x8, "Wrong alignment
 class alignas(4) SMathMultiplyDivideSaveData_float32
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultiplyDivideSaveData_float32& p_Other) const;
+	bool operator==(const SMathMultiplyDivideSaveData_float32& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultiplyDivideSaveData_float32& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fA; // 0x0
@@ -17690,14 +17397,12 @@ static_assert(alignof(SMathMultiplyDivideSaveData_float32) == 0x4, "Wrong alignm
 class alignas(8) SMathMultipliesSaveData_float32
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultipliesSaveData_float32& p_Other) const;
+	bool operator==(const SMathMultipliesSaveData_float32& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultipliesSaveData_float32& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -17712,14 +17417,14 @@ static_assert(alignof(SMathMultipliesSaveData_float32) == 0x8, "Wrong alignment
 class alignas(4) SItemKeywordProxySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SItemKeywordProxySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SItemKeywordProxySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemKeywordProxySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rItem; // 0x0
@@ -17732,14 +17437,12 @@ static_assert(alignof(SItemKeywordProxySaveData) == 0x4, "Wrong alignment for SI
 class alignas(8) SItemKeywordProxiesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SItemKeywordProxiesSaveData& p_Other) const;
+	bool operator==(const SItemKeywordProxiesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemKeywordProxiesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -17754,14 +17457,14 @@ static_assert(alignof(SItemKeywordProxiesSaveData) == 0x8, "Wrong alignment for
 class alignas(4) SMathMultiplyDivideSaveData_SVector2
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultiplyDivideSaveData_SVector2& p_Other) const;
+	bool operator==(const SMathMultiplyDivideSaveData_SVector2& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultiplyDivideSaveData_SVector2& p_Other) const { return !(*this == p_Other); }
 
 	SVector2 m_fA; // 0x0
@@ -17778,14 +17481,12 @@ static_assert(alignof(SMathMultiplyDivideSaveData_SVector2) == 0x4, "Wrong align
 class alignas(8) SMathMultipliesSaveData_SVector2
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathMultipliesSaveData_SVector2& p_Other) const;
+	bool operator==(const SMathMultipliesSaveData_SVector2& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathMultipliesSaveData_SVector2& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -17800,14 +17501,14 @@ static_assert(alignof(SMathMultipliesSaveData_SVector2) == 0x8, "Wrong alignment
 class alignas(4) SLampCoreSaveState
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLampCoreSaveState& p_Other) const;
+	bool operator==(const SLampCoreSaveState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLampCoreSaveState& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fDiffusePower; // 0x0
@@ -17822,14 +17523,12 @@ static_assert(alignof(SLampCoreSaveState) == 0x4, "Wrong alignment for SLampCore
 class alignas(8) SLampCoreSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLampCoreSaveData& p_Other) const;
+	bool operator==(const SLampCoreSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLampCoreSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -17844,14 +17543,14 @@ static_assert(alignof(SLampCoreSaveData) == 0x8, "Wrong alignment for SLampCoreS
 class alignas(4) SItsATrapSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SItsATrapSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SItsATrapSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItsATrapSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -17866,14 +17565,12 @@ static_assert(alignof(SItsATrapSaveData) == 0x4, "Wrong alignment for SItsATrapS
 class alignas(8) STrapsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STrapsSaveData& p_Other) const;
+	bool operator==(const STrapsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STrapsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -17888,14 +17585,14 @@ static_assert(alignof(STrapsSaveData) == 0x8, "Wrong alignment for STrapsSaveDat
 class alignas(4) SMathLerpSaveData_float32
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpSaveData_float32& p_Other) const;
+	bool operator==(const SMathLerpSaveData_float32& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpSaveData_float32& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_A; // 0x0
@@ -17912,14 +17609,12 @@ static_assert(alignof(SMathLerpSaveData_float32) == 0x4, "Wrong alignment for SM
 class alignas(8) SMathLerpsSaveData_float32
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpsSaveData_float32& p_Other) const;
+	bool operator==(const SMathLerpsSaveData_float32& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpsSaveData_float32& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -17934,14 +17629,14 @@ static_assert(alignof(SMathLerpsSaveData_float32) == 0x8, "Wrong alignment for S
 class alignas(4) SMathLerpSaveData_SVector2
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpSaveData_SVector2& p_Other) const;
+	bool operator==(const SMathLerpSaveData_SVector2& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpSaveData_SVector2& p_Other) const { return !(*this == p_Other); }
 
 	SVector2 m_A; // 0x0
@@ -17958,14 +17653,12 @@ static_assert(alignof(SMathLerpSaveData_SVector2) == 0x4, "Wrong alignment for S
 class alignas(8) SMathLerpsSaveData_SVector2
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpsSaveData_SVector2& p_Other) const;
+	bool operator==(const SMathLerpsSaveData_SVector2& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpsSaveData_SVector2& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -17980,14 +17673,14 @@ static_assert(alignof(SMathLerpsSaveData_SVector2) == 0x8, "Wrong alignment for
 class alignas(4) SMathLerpSaveData_SVector3
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMathLerpSaveData_SVector3& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMathLerpSaveData_SVector3& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpSaveData_SVector3& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_A; // 0x0
@@ -18004,14 +17697,12 @@ static_assert(alignof(SMathLerpSaveData_SVector3) == 0x4, "Wrong alignment for S
 class alignas(8) SMathLerpsSaveData_SVector3
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpsSaveData_SVector3& p_Other) const;
+	bool operator==(const SMathLerpsSaveData_SVector3& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpsSaveData_SVector3& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -18026,14 +17717,14 @@ static_assert(alignof(SMathLerpsSaveData_SVector3) == 0x8, "Wrong alignment for
 class alignas(4) SMathLerpSaveData_SVector4
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpSaveData_SVector4& p_Other) const;
+	bool operator==(const SMathLerpSaveData_SVector4& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpSaveData_SVector4& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 m_A; // 0x0
@@ -18050,14 +17741,12 @@ static_assert(alignof(SMathLerpSaveData_SVector4) == 0x4, "Wrong alignment for S
 class alignas(8) SMathLerpsSaveData_SVector4
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpsSaveData_SVector4& p_Other) const;
+	bool operator==(const SMathLerpsSaveData_SVector4& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpsSaveData_SVector4& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -18072,14 +17761,14 @@ static_assert(alignof(SMathLerpsSaveData_SVector4) == 0x8, "Wrong alignment for
 class alignas(4) SMathLerpSaveData_SColorRGB
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpSaveData_SColorRGB& p_Other) const;
+	bool operator==(const SMathLerpSaveData_SColorRGB& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpSaveData_SColorRGB& p_Other) const { return !(*this == p_Other); }
 
 	SColorRGB m_A; // 0x0
@@ -18096,14 +17785,12 @@ static_assert(alignof(SMathLerpSaveData_SColorRGB) == 0x4, "Wrong alignment for
 class alignas(8) SMathLerpsSaveData_SColorRGB
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpsSaveData_SColorRGB& p_Other) const;
+	bool operator==(const SMathLerpsSaveData_SColorRGB& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpsSaveData_SColorRGB& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -18118,14 +17805,14 @@ static_assert(alignof(SMathLerpsSaveData_SColorRGB) == 0x8, "Wrong alignment for
 class alignas(4) SMathLerpSaveData_SColorRGBA
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMathLerpSaveData_SColorRGBA& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMathLerpSaveData_SColorRGBA& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpSaveData_SColorRGBA& p_Other) const { return !(*this == p_Other); }
 
 	SColorRGBA m_A; // 0x0
@@ -18142,14 +17829,12 @@ static_assert(alignof(SMathLerpSaveData_SColorRGBA) == 0x4, "Wrong alignment for
 class alignas(8) SMathLerpsSaveData_SColorRGBA
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathLerpsSaveData_SColorRGBA& p_Other) const;
+	bool operator==(const SMathLerpsSaveData_SColorRGBA& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathLerpsSaveData_SColorRGBA& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -18164,14 +17849,14 @@ static_assert(alignof(SMathLerpsSaveData_SColorRGBA) == 0x8, "Wrong alignment fo
 class alignas(4) SVRHolsterAttacherSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVRHolsterAttacherSaveData& p_Other) const;
+	bool operator==(const SVRHolsterAttacherSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVRHolsterAttacherSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rContainedItem; // 0x0
@@ -18184,14 +17869,12 @@ static_assert(alignof(SVRHolsterAttacherSaveData) == 0x4, "Wrong alignment for S
 class alignas(8) SVRHolsterAttachersSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVRHolsterAttachersSaveData& p_Other) const;
+	bool operator==(const SVRHolsterAttachersSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVRHolsterAttachersSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -18206,14 +17889,12 @@ static_assert(alignof(SVRHolsterAttachersSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SGameEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGameEntitySaveData& p_Other) const;
+	bool operator==(const SGameEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGameEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	SDoorsSaveData m_DoorData; // 0x0
@@ -18400,14 +18081,14 @@ enum class eAmmoType : int32_t
 class alignas(4) STimerEntityCommandSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STimerEntityCommandSaveData& p_Other) const;
+	bool operator==(const STimerEntityCommandSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STimerEntityCommandSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ETimerEntityCommandType m_eType; // 0x0
@@ -18424,14 +18105,14 @@ static_assert(alignof(STimerEntityCommandSaveData) == 0x4, "Wrong alignment for
 class alignas(4) STimerEntityStateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const STimerEntityStateSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const STimerEntityStateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STimerEntityStateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -18448,14 +18129,12 @@ static_assert(alignof(STimerEntityStateSaveData) == 0x4, "Wrong alignment for ST
 class alignas(8) SGameTimersSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGameTimersSaveData& p_Other) const;
+	bool operator==(const SGameTimersSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGameTimersSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<STimerEntityCommandSaveData> m_aTimerEntityCommands; // 0x0
@@ -18472,14 +18151,14 @@ static_assert(alignof(SGameTimersSaveData) == 0x8, "Wrong alignment for SGameTim
 class alignas(4) SLightSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLightSaveData& p_Other) const;
+	bool operator==(const SLightSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLightSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -18500,14 +18179,14 @@ static_assert(alignof(SLightSaveData) == 0x4, "Wrong alignment for SLightSaveDat
 class alignas(4) SPostfilterParametersSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPostfilterParametersSaveData& p_Other) const;
+	bool operator==(const SPostfilterParametersSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPostfilterParametersSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -18570,14 +18249,12 @@ static_assert(alignof(SPostfilterParametersSaveData) == 0x4, "Wrong alignment fo
 class alignas(8) SRenderMaterialSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRenderMaterialSaveData& p_Other) const;
+	bool operator==(const SRenderMaterialSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRenderMaterialSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -18594,14 +18271,14 @@ static_assert(alignof(SRenderMaterialSaveData) == 0x8, "Wrong alignment for SRen
 class alignas(4) SParticleEmitterSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SParticleEmitterSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SParticleEmitterSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SParticleEmitterSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -18624,14 +18301,14 @@ static_assert(alignof(SParticleEmitterSaveData) == 0x4, "Wrong alignment for SPa
 class alignas(4) SGateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGateSaveData& p_Other) const;
+	bool operator==(const SGateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rEntity; // 0x0
@@ -18648,14 +18325,12 @@ static_assert(alignof(SGateSaveData) == 0x4, "Wrong alignment for SGateSaveData"
 class alignas(8) SGameplayRenderablesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGameplayRenderablesSaveData& p_Other) const;
+	bool operator==(const SGameplayRenderablesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGameplayRenderablesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SLightSaveData> m_aLightData; // 0x0
@@ -18678,14 +18353,14 @@ static_assert(alignof(SGameplayRenderablesSaveData) == 0x8, "Wrong alignment for
 class alignas(4) SGeomScaleSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGeomScaleSaveData& p_Other) const;
+	bool operator==(const SGeomScaleSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGeomScaleSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 m_vPrimitiveScale; // 0x0
@@ -18698,14 +18373,12 @@ static_assert(alignof(SGeomScaleSaveData) == 0x4, "Wrong alignment for SGeomScal
 class alignas(16) SGetHelpGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGetHelpGroupSaveData& p_Other) const;
+	bool operator==(const SGetHelpGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGetHelpGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float4 m_vLastKnownTargetPosition; // 0x0
@@ -18748,14 +18421,14 @@ static_assert(alignof(SGetHelpGroupSaveData) == 0x10, "Wrong alignment for SGetH
 class alignas(4) SGetHelpOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SGetHelpOrderSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SGetHelpOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGetHelpOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	EAISharedEventType m_helpType; // 0x0
@@ -18770,14 +18443,14 @@ static_assert(alignof(SGetHelpOrderSaveData) == 0x4, "Wrong alignment for SGetHe
 class alignas(4) SHelpingActorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHelpingActorSaveData& p_Other) const;
+	bool operator==(const SHelpingActorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHelpingActorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_HelpTargetKnowledgeIndex; // 0x0
@@ -18792,14 +18465,12 @@ static_assert(alignof(SHelpingActorSaveData) == 0x4, "Wrong alignment for SHelpi
 class alignas(8) SGetHelpServiceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGetHelpServiceSaveData& p_Other) const;
+	bool operator==(const SGetHelpServiceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGetHelpServiceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SHelpingActorSaveData> m_aHelpingActors; // 0x0
@@ -18812,14 +18483,14 @@ static_assert(alignof(SGetHelpServiceSaveData) == 0x8, "Wrong alignment for SGet
 class alignas(4) SGetIActorPositionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGetIActorPositionSaveData& p_Other) const;
+	bool operator==(const SGetIActorPositionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGetIActorPositionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_StoredActor; // 0x0
@@ -18832,14 +18503,14 @@ static_assert(alignof(SGetIActorPositionSaveData) == 0x4, "Wrong alignment for S
 class alignas(4) SGuardBodySituationMemberSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SGuardBodySituationMemberSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SGuardBodySituationMemberSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGuardBodySituationMemberSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bSearchingForMorgue; // 0x0
@@ -18858,14 +18529,14 @@ static_assert(alignof(SGuardBodySituationMemberSaveData) == 0x4, "Wrong alignmen
 class alignas(4) SGuardBodySituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGuardBodySituationSaveData& p_Other) const;
+	bool operator==(const SGuardBodySituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGuardBodySituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bBystanderFieldsFailed; // 0x0
@@ -18886,14 +18557,14 @@ static_assert(alignof(SGuardBodySituationSaveData) == 0x4, "Wrong alignment for
 class alignas(4) SGuardPointOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SGuardPointOrderSaveData& p_Other) const;
+	bool operator==(const SGuardPointOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SGuardPointOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_guardPoint; // 0x0
@@ -18908,14 +18579,14 @@ static_assert(alignof(SGuardPointOrderSaveData) == 0x4, "Wrong alignment for SGu
 class alignas(1) SHM5CrippleBoxSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SHM5CrippleBoxSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SHM5CrippleBoxSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHM5CrippleBoxSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bInSequence; // 0x0
@@ -19038,14 +18709,14 @@ static_assert(alignof(SHM5CrippleBoxSaveData) == 0x1, "Wrong alignment for SHM5C
 class alignas(1) SHUDPIPControllerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHUDPIPControllerSaveData& p_Other) const;
+	bool operator==(const SHUDPIPControllerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHUDPIPControllerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bPiPEnabled; // 0x0
@@ -19058,14 +18729,12 @@ static_assert(alignof(SHUDPIPControllerSaveData) == 0x1, "Wrong alignment for SH
 class alignas(8) SHUDPromptDisplayInfo
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHUDPromptDisplayInfo& p_Other) const;
+	bool operator==(const SHUDPromptDisplayInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHUDPromptDisplayInfo& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bActive; // 0x0
@@ -19114,14 +18783,12 @@ static_assert(alignof(SHUDPromptDisplayInfo) == 0x8, "Wrong alignment for SHUDPr
 class alignas(8) SHUDPromptDisplayInfoArray_Dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHUDPromptDisplayInfoArray_Dummy& p_Other) const;
+	bool operator==(const SHUDPromptDisplayInfoArray_Dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHUDPromptDisplayInfoArray_Dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SHUDPromptDisplayInfo> dummy; // 0x0
@@ -19134,14 +18801,14 @@ static_assert(alignof(SHUDPromptDisplayInfoArray_Dummy) == 0x8, "Wrong alignment
 class alignas(4) SHUDTimerControllerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHUDTimerControllerSaveData& p_Other) const;
+	bool operator==(const SHUDTimerControllerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHUDTimerControllerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_pCurrentInstance; // 0x0
@@ -19203,14 +18870,14 @@ public:
 class alignas(4) SHUDVisibilityController2SaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SHUDVisibilityController2SaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SHUDVisibilityController2SaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHUDVisibilityController2SaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZHUDUIRoot::EHUDVisibility m_eCurrentRequest; // 0x0
@@ -19223,14 +18890,14 @@ static_assert(alignof(SHUDVisibilityController2SaveData) == 0x4, "Wrong alignmen
 class alignas(4) SHandleDistractionSituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHandleDistractionSituationSaveData& p_Other) const;
+	bool operator==(const SHandleDistractionSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHandleDistractionSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_pLeader; // 0x0
@@ -19247,14 +18914,14 @@ static_assert(alignof(SHandleDistractionSituationSaveData) == 0x4, "Wrong alignm
 class alignas(4) SHeroCameraStandInSaveState
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHeroCameraStandInSaveState& p_Other) const;
+	bool operator==(const SHeroCameraStandInSaveState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHeroCameraStandInSaveState& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rHero; // 0x0
@@ -19296,14 +18963,14 @@ public:
 class alignas(4) SHeroEscortSituation2ActorStateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SHeroEscortSituation2ActorStateSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SHeroEscortSituation2ActorStateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHeroEscortSituation2ActorStateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nID; // 0x0
@@ -19328,14 +18995,14 @@ static_assert(alignof(SHeroEscortSituation2ActorStateSaveData) == 0x4, "Wrong al
 class alignas(4) SHeroEscortSituation2Actors
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHeroEscortSituation2Actors& p_Other) const;
+	bool operator==(const SHeroEscortSituation2Actors& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHeroEscortSituation2Actors& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -19375,14 +19042,14 @@ public:
 class alignas(4) SHeroEscortSituationActorStateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHeroEscortSituationActorStateSaveData& p_Other) const;
+	bool operator==(const SHeroEscortSituationActorStateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHeroEscortSituationActorStateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nID; // 0x0
@@ -19407,14 +19074,14 @@ static_assert(alignof(SHeroEscortSituationActorStateSaveData) == 0x4, "Wrong ali
 class alignas(4) SHeroEscortSituationActors
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SHeroEscortSituationActors& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SHeroEscortSituationActors& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHeroEscortSituationActors& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -19427,14 +19094,14 @@ static_assert(alignof(SHeroEscortSituationActors) == 0x4, "Wrong alignment for S
 class alignas(4) SHeroItemActionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHeroItemActionSaveData& p_Other) const;
+	bool operator==(const SHeroItemActionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHeroItemActionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rItem; // 0x0
@@ -19447,14 +19114,14 @@ static_assert(alignof(SHeroItemActionSaveData) == 0x4, "Wrong alignment for SHer
 class alignas(4) SHeroItemAttachmentSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SHeroItemAttachmentSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SHeroItemAttachmentSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHeroItemAttachmentSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rItem; // 0x0
@@ -19467,14 +19134,14 @@ static_assert(alignof(SHeroItemAttachmentSaveData) == 0x4, "Wrong alignment for
 class alignas(4) SHeroStandInSaveState
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHeroStandInSaveState& p_Other) const;
+	bool operator==(const SHeroStandInSaveState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHeroStandInSaveState& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rHero; // 0x0
@@ -19491,14 +19158,14 @@ static_assert(alignof(SHeroStandInSaveState) == 0x4, "Wrong alignment for SHeroS
 class alignas(4) SHintEntrySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SHintEntrySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SHintEntrySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHintEntrySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsValid; // 0x0
@@ -19515,14 +19182,12 @@ static_assert(alignof(SHintEntrySaveData) == 0x4, "Wrong alignment for SHintEntr
 class alignas(8) SHintManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHintManagerSaveData& p_Other) const;
+	bool operator==(const SHintManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHintManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SHintEntrySaveData m_activeHint; // 0x0
@@ -19539,14 +19204,14 @@ static_assert(alignof(SHintManagerSaveData) == 0x8, "Wrong alignment for SHintMa
 class alignas(8) SHudMissionTimerControllerData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SHudMissionTimerControllerData& p_Other) const;
+	bool operator==(const SHudMissionTimerControllerData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SHudMissionTimerControllerData& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_fScoreGameTimeStart; // 0x0
@@ -19561,14 +19226,12 @@ static_assert(alignof(SHudMissionTimerControllerData) == 0x8, "Wrong alignment f
 class alignas(8) SIntelData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SIntelData& p_Other) const;
+	bool operator==(const SIntelData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SIntelData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sHeadline; // 0x0
@@ -19587,14 +19250,12 @@ static_assert(alignof(SIntelData) == 0x8, "Wrong alignment for SIntelData");
 class alignas(8) SIntelDataArray_dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SIntelDataArray_dummy& p_Other) const;
+	bool operator==(const SIntelDataArray_dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SIntelDataArray_dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SIntelData> dummy; // 0x0
@@ -19607,14 +19268,12 @@ static_assert(alignof(SIntelDataArray_dummy) == 0x8, "Wrong alignment for SIntel
 class alignas(8) SIntelDisplayInfo
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SIntelDisplayInfo& p_Other) const;
+	bool operator==(const SIntelDisplayInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SIntelDisplayInfo& p_Other) const { return !(*this == p_Other); }
 
 	int32 index; // 0x0
@@ -19639,14 +19298,12 @@ static_assert(alignof(SIntelDisplayInfo) == 0x8, "Wrong alignment for SIntelDisp
 class alignas(8) SIntelDisplayInfoArray_dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SIntelDisplayInfoArray_dummy& p_Other) const;
+	bool operator==(const SIntelDisplayInfoArray_dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SIntelDisplayInfoArray_dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SIntelDisplayInfo> dummy; // 0x0
@@ -19659,14 +19316,12 @@ static_assert(alignof(SIntelDisplayInfoArray_dummy) == 0x8, "Wrong alignment for
 class alignas(8) SIntelListDisplayInfo
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SIntelListDisplayInfo& p_Other) const;
+	bool operator==(const SIntelListDisplayInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SIntelListDisplayInfo& p_Other) const { return !(*this == p_Other); }
 
 	int32 index; // 0x0
@@ -19685,14 +19340,12 @@ static_assert(alignof(SIntelListDisplayInfo) == 0x8, "Wrong alignment for SIntel
 class alignas(8) SIntelListDisplayInfoArray_dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SIntelListDisplayInfoArray_dummy& p_Other) const;
+	bool operator==(const SIntelListDisplayInfoArray_dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SIntelListDisplayInfoArray_dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SIntelListDisplayInfo> dummy; // 0x0
@@ -19705,14 +19358,14 @@ static_assert(alignof(SIntelListDisplayInfoArray_dummy) == 0x8, "Wrong alignment
 class alignas(4) SIntelSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SIntelSaveData& p_Other) const;
+	bool operator==(const SIntelSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SIntelSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rCurrentStage; // 0x0
@@ -19741,14 +19394,12 @@ public:
 	class alignas(8) SUIControlData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SUIControlData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SUIControlData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SUIControlData& p_Other) const { return !(*this == p_Other); }
 
 		int32 m_eState; // 0x0
@@ -19793,14 +19444,12 @@ public:
 
 
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SInteractionIndicatorInstanceData& p_Other) const;
+	bool operator==(const SInteractionIndicatorInstanceData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SInteractionIndicatorInstanceData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nStableID; // 0x0
@@ -19831,14 +19480,12 @@ static_assert(alignof(SInteractionIndicatorInstanceData) == 0x8, "Wrong alignmen
 class alignas(8) SInteractionIndicatorInstanceDataArray_Dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SInteractionIndicatorInstanceDataArray_Dummy& p_Other) const;
+	bool operator==(const SInteractionIndicatorInstanceDataArray_Dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SInteractionIndicatorInstanceDataArray_Dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SInteractionIndicatorInstanceData> dummy; // 0x0
@@ -19851,14 +19498,14 @@ static_assert(alignof(SInteractionIndicatorInstanceDataArray_Dummy) == 0x8, "Wro
 class alignas(4) SInventoryControllerItemSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SInventoryControllerItemSaveData& p_Other) const;
+	bool operator==(const SInventoryControllerItemSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SInventoryControllerItemSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rItemEntity; // 0x0
@@ -19873,14 +19520,14 @@ static_assert(alignof(SInventoryControllerItemSaveData) == 0x4, "Wrong alignment
 class alignas(4) SStoredSlotSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SStoredSlotSaveData& p_Other) const;
+	bool operator==(const SStoredSlotSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SStoredSlotSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_iStoredInventorySlotIndex; // 0x0
@@ -19897,14 +19544,12 @@ static_assert(alignof(SStoredSlotSaveData) == 0x4, "Wrong alignment for SStoredS
 class alignas(8) SInventoryControllerSlotSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SInventoryControllerSlotSaveData& p_Other) const;
+	bool operator==(const SInventoryControllerSlotSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SInventoryControllerSlotSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SInventoryControllerItemSaveData> m_aItems; // 0x0
@@ -19919,14 +19564,14 @@ static_assert(alignof(SInventoryControllerSlotSaveData) == 0x8, "Wrong alignment
 class alignas(16) SInventoryMovementConfig
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SInventoryMovementConfig& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SInventoryMovementConfig& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SInventoryMovementConfig& p_Other) const { return !(*this == p_Other); }
 
 	EInventoryConfigItemHandling m_eItemHandlingRightHand; // 0x0
@@ -19957,14 +19602,12 @@ static_assert(alignof(SInventoryMovementConfig) == 0x10, "Wrong alignment for SI
 class alignas(8) SInventoryUISlotSlim
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SInventoryUISlotSlim& p_Other) const;
+	bool operator==(const SInventoryUISlotSlim& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SInventoryUISlotSlim& p_Other) const { return !(*this == p_Other); }
 
 	ZVariant icon; // 0x0
@@ -19981,14 +19624,12 @@ static_assert(alignof(SInventoryUISlotSlim) == 0x8, "Wrong alignment for SInvent
 class alignas(8) SInventoryUI
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SInventoryUI& p_Other) const;
+	bool operator==(const SInventoryUI& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SInventoryUI& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SInventoryUISlotSlim> mainslotsSlim; // 0x0
@@ -20035,14 +19676,14 @@ public:
 	class alignas(4) SDialogLines
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SDialogLines& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SDialogLines& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SDialogLines& p_Other) const { return !(*this == p_Other); }
 
 		EActorSoundDefs m_eFirstWarning; // 0x0
@@ -20073,14 +19714,14 @@ public:
 	class alignas(16) SMoveToOrderSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SMoveToOrderSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SMoveToOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SMoveToOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 		float4 m_vStopDirection; // 0x0
@@ -20119,14 +19760,14 @@ public:
 class alignas(16) SInvestigateDisguiseGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SInvestigateDisguiseGroupSaveData& p_Other) const;
+	bool operator==(const SInvestigateDisguiseGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SInvestigateDisguiseGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZInvestigateDisguiseGroup::EState m_state; // 0x0
@@ -20183,14 +19824,12 @@ static_assert(alignof(SInvestigateDisguiseGroupSaveData) == 0x10, "Wrong alignme
 class alignas(8) SInvestigateWeaponGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SInvestigateWeaponGroupSaveData& p_Other) const;
+	bool operator==(const SInvestigateWeaponGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SInvestigateWeaponGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rTarget; // 0x0
@@ -20217,14 +19856,14 @@ static_assert(alignof(SInvestigateWeaponGroupSaveData) == 0x8, "Wrong alignment
 class alignas(4) SItemActionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SItemActionSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SItemActionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemActionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rItem; // 0x0
@@ -20237,14 +19876,12 @@ static_assert(alignof(SItemActionSaveData) == 0x4, "Wrong alignment for SItemAct
 class alignas(4) SItemLeftHandUIData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SItemLeftHandUIData& p_Other) const;
+	bool operator==(const SItemLeftHandUIData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemLeftHandUIData& p_Other) const { return !(*this == p_Other); }
 
 	ZRuntimeResourceID icon; // 0x0
@@ -20265,14 +19902,12 @@ static_assert(alignof(SItemLeftHandUIData) == 0x4, "Wrong alignment for SItemLef
 class alignas(4) SItemOnBackUIData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SItemOnBackUIData& p_Other) const;
+	bool operator==(const SItemOnBackUIData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemOnBackUIData& p_Other) const { return !(*this == p_Other); }
 
 	ZRuntimeResourceID icon; // 0x0
@@ -20293,14 +19928,14 @@ static_assert(alignof(SItemOnBackUIData) == 0x4, "Wrong alignment for SItemOnBac
 class alignas(1) SItemSpawnerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SItemSpawnerSaveData& p_Other) const;
+	bool operator==(const SItemSpawnerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemSpawnerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bItemUpdateTransformChange; // 0x0
@@ -20313,14 +19948,12 @@ static_assert(alignof(SItemSpawnerSaveData) == 0x1, "Wrong alignment for SItemSp
 class alignas(8) SItemStorageSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SItemStorageSaveData& p_Other) const;
+	bool operator==(const SItemStorageSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemStorageSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_Storage; // 0x0
@@ -20335,14 +19968,12 @@ static_assert(alignof(SItemStorageSaveData) == 0x8, "Wrong alignment for SItemSt
 class alignas(8) SItemWeaponSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SItemWeaponSaveData& p_Other) const;
+	bool operator==(const SItemWeaponSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SItemWeaponSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_magazineBulletsByAmmoType; // 0x0
@@ -20365,14 +19996,14 @@ static_assert(alignof(SItemWeaponSaveData) == 0x8, "Wrong alignment for SItemWea
 class alignas(4) SKeywordSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SKeywordSaveData& p_Other) const;
+	bool operator==(const SKeywordSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SKeywordSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_HolderSaveableId; // 0x0
@@ -20387,14 +20018,14 @@ static_assert(alignof(SKeywordSaveData) == 0x4, "Wrong alignment for SKeywordSav
 class alignas(1) SLayerBehaviorConfiguration
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SLayerBehaviorConfiguration& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SLayerBehaviorConfiguration& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLayerBehaviorConfiguration& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bTrigger; // 0x0
@@ -20435,14 +20066,14 @@ public:
 class alignas(4) SLeadEscortSituationActorStateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLeadEscortSituationActorStateSaveData& p_Other) const;
+	bool operator==(const SLeadEscortSituationActorStateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLeadEscortSituationActorStateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nID; // 0x0
@@ -20467,14 +20098,14 @@ static_assert(alignof(SLeadEscortSituationActorStateSaveData) == 0x4, "Wrong ali
 class alignas(4) SLeadEscortSituationActors
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLeadEscortSituationActors& p_Other) const;
+	bool operator==(const SLeadEscortSituationActors& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLeadEscortSituationActors& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -20487,14 +20118,12 @@ static_assert(alignof(SLeadEscortSituationActors) == 0x4, "Wrong alignment for S
 class alignas(8) SLeadEscortSituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLeadEscortSituationSaveData& p_Other) const;
+	bool operator==(const SLeadEscortSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLeadEscortSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bActivated; // 0x0
@@ -20535,14 +20164,12 @@ static_assert(alignof(SLeadEscortSituationSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SLevelReferenceableEntitieSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLevelReferenceableEntitieSaveData& p_Other) const;
+	bool operator==(const SLevelReferenceableEntitieSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLevelReferenceableEntitieSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sSceneResource; // 0x0
@@ -20557,14 +20184,12 @@ static_assert(alignof(SLevelReferenceableEntitieSaveData) == 0x8, "Wrong alignme
 class alignas(8) SObjetiveSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SObjetiveSaveData& p_Other) const;
+	bool operator==(const SObjetiveSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SObjetiveSaveData& p_Other) const { return !(*this == p_Other); }
 
 	IContractObjective::Type m_eType; // 0x0
@@ -20579,14 +20204,14 @@ static_assert(alignof(SObjetiveSaveData) == 0x8, "Wrong alignment for SObjetiveS
 class alignas(4) SSoundAmbienceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SSoundAmbienceSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SSoundAmbienceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSoundAmbienceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rCurrentAmbience; // 0x0
@@ -20607,14 +20232,14 @@ static_assert(alignof(SSoundAmbienceSaveData) == 0x4, "Wrong alignment for SSoun
 class alignas(1) SLightFlickerEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLightFlickerEntitySaveData& p_Other) const;
+	bool operator==(const SLightFlickerEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLightFlickerEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bLightOn; // 0x0
@@ -20629,14 +20254,12 @@ static_assert(alignof(SLightFlickerEntitySaveData) == 0x1, "Wrong alignment for
 class alignas(8) SLoadRuntimeResourceResult
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLoadRuntimeResourceResult& p_Other) const;
+	bool operator==(const SLoadRuntimeResourceResult& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLoadRuntimeResourceResult& p_Other) const { return !(*this == p_Other); }
 
 	ZString sFilePath; // 0x0
@@ -20649,14 +20272,12 @@ static_assert(alignof(SLoadRuntimeResourceResult) == 0x8, "Wrong alignment for S
 class alignas(8) SLocalizedVideoData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLocalizedVideoData& p_Other) const;
+	bool operator==(const SLocalizedVideoData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLocalizedVideoData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<ZString> AudioLanguages; // 0x0
@@ -20675,14 +20296,14 @@ static_assert(alignof(SLocalizedVideoData) == 0x8, "Wrong alignment for SLocaliz
 class alignas(8) SLockdownManagerAIZoneSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLockdownManagerAIZoneSaveData& p_Other) const;
+	bool operator==(const SLockdownManagerAIZoneSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLockdownManagerAIZoneSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_tExpiry; // 0x0
@@ -20699,14 +20320,12 @@ static_assert(alignof(SLockdownManagerAIZoneSaveData) == 0x8, "Wrong alignment f
 class alignas(8) SLockdownManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SLockdownManagerSaveData& p_Other) const;
+	bool operator==(const SLockdownManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SLockdownManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SLockdownManagerAIZoneSaveData> m_aAIZones; // 0x0
@@ -20719,14 +20338,12 @@ static_assert(alignof(SLockdownManagerSaveData) == 0x8, "Wrong alignment for SLo
 class alignas(8) SManHuntServiceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SManHuntServiceSaveData& p_Other) const;
+	bool operator==(const SManHuntServiceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SManHuntServiceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint16> m_rGuardNodes; // 0x0
@@ -20743,14 +20360,12 @@ static_assert(alignof(SManHuntServiceSaveData) == 0x8, "Wrong alignment for SMan
 class alignas(8) SMapMarkerData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMapMarkerData& p_Other) const;
+	bool operator==(const SMapMarkerData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMapMarkerData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SVector2> pathPoints; // 0x0
@@ -20763,14 +20378,14 @@ static_assert(alignof(SMapMarkerData) == 0x8, "Wrong alignment for SMapMarkerDat
 class alignas(4) SMathDistanceSaveData_SVector2
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMathDistanceSaveData_SVector2& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMathDistanceSaveData_SVector2& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathDistanceSaveData_SVector2& p_Other) const { return !(*this == p_Other); }
 
 	SVector2 m_fA; // 0x0
@@ -20785,14 +20400,14 @@ static_assert(alignof(SMathDistanceSaveData_SVector2) == 0x4, "Wrong alignment f
 class alignas(4) SMathDistanceSaveData_SVector3
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathDistanceSaveData_SVector3& p_Other) const;
+	bool operator==(const SMathDistanceSaveData_SVector3& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathDistanceSaveData_SVector3& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 m_fA; // 0x0
@@ -20807,14 +20422,14 @@ static_assert(alignof(SMathDistanceSaveData_SVector3) == 0x4, "Wrong alignment f
 class alignas(4) SMathDistanceSaveData_SVector4
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMathDistanceSaveData_SVector4& p_Other) const;
+	bool operator==(const SMathDistanceSaveData_SVector4& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMathDistanceSaveData_SVector4& p_Other) const { return !(*this == p_Other); }
 
 	SVector4 m_fA; // 0x0
@@ -20829,14 +20444,14 @@ static_assert(alignof(SMathDistanceSaveData_SVector4) == 0x4, "Wrong alignment f
 class alignas(4) SMatrix33
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMatrix33& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMatrix33& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMatrix33& p_Other) const { return !(*this == p_Other); }
 
 	SVector3 XAxis; // 0x0
@@ -20853,14 +20468,14 @@ static_assert(alignof(SMatrix33) == 0x4, "Wrong alignment for SMatrix33");
 class alignas(4) SMatrix44
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMatrix44& p_Other) const;
+	bool operator==(const SMatrix44& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMatrix44& p_Other) const { return !(*this == p_Other); }
 
 	float32 m11; // 0x0
@@ -20903,14 +20518,14 @@ static_assert(alignof(SMatrix44) == 0x4, "Wrong alignment for SMatrix44");
 class alignas(4) SMovementAgilitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMovementAgilitySaveData& p_Other) const;
+	bool operator==(const SMovementAgilitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementAgilitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rLedgeGuide; // 0x0
@@ -20933,14 +20548,14 @@ static_assert(alignof(SMovementAgilitySaveData) == 0x4, "Wrong alignment for SMo
 class alignas(16) SMovementCoverSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMovementCoverSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMovementCoverSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementCoverSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rCoverPlane; // 0x0
@@ -20961,14 +20576,14 @@ static_assert(alignof(SMovementCoverSaveData) == 0x10, "Wrong alignment for SMov
 class alignas(4) SMovementDisguiseSafeZoneSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMovementDisguiseSafeZoneSaveData& p_Other) const;
+	bool operator==(const SMovementDisguiseSafeZoneSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementDisguiseSafeZoneSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rSafeZone; // 0x0
@@ -20983,14 +20598,14 @@ static_assert(alignof(SMovementDisguiseSafeZoneSaveData) == 0x4, "Wrong alignmen
 class alignas(4) SMovementDragBodySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMovementDragBodySaveData& p_Other) const;
+	bool operator==(const SMovementDragBodySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementDragBodySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rDraggedActor; // 0x0
@@ -21005,14 +20620,14 @@ static_assert(alignof(SMovementDragBodySaveData) == 0x4, "Wrong alignment for SM
 class alignas(4) SMovementDrainPipeSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMovementDrainPipeSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMovementDrainPipeSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementDrainPipeSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rDrainPipe; // 0x0
@@ -21025,14 +20640,14 @@ static_assert(alignof(SMovementDrainPipeSaveData) == 0x4, "Wrong alignment for S
 class alignas(4) SMovementHideInClosetSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMovementHideInClosetSaveData& p_Other) const;
+	bool operator==(const SMovementHideInClosetSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementHideInClosetSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ICloset::EClosetType m_eCurrentClosetType; // 0x0
@@ -21047,14 +20662,14 @@ static_assert(alignof(SMovementHideInClosetSaveData) == 0x4, "Wrong alignment fo
 class alignas(4) SMovementLadderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMovementLadderSaveData& p_Other) const;
+	bool operator==(const SMovementLadderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementLadderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rLadder; // 0x0
@@ -21067,14 +20682,14 @@ static_assert(alignof(SMovementLadderSaveData) == 0x4, "Wrong alignment for SMov
 class alignas(1) SMovementLocomotionSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SMovementLocomotionSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SMovementLocomotionSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMovementLocomotionSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsSneaking; // 0x0
@@ -21087,14 +20702,14 @@ static_assert(alignof(SMovementLocomotionSaveData) == 0x1, "Wrong alignment for
 class alignas(4) SMusicGridData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SMusicGridData& p_Other) const;
+	bool operator==(const SMusicGridData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SMusicGridData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fGridDurationSec; // 0x0
@@ -21109,14 +20724,12 @@ static_assert(alignof(SMusicGridData) == 0x4, "Wrong alignment for SMusicGridDat
 class alignas(8) SObserversGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SObserversGroupSaveData& p_Other) const;
+	bool operator==(const SObserversGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SObserversGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_target; // 0x0
@@ -21133,14 +20746,12 @@ static_assert(alignof(SObserversGroupSaveData) == 0x8, "Wrong alignment for SObs
 class alignas(8) SOnlineEvent
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SOnlineEvent& p_Other) const;
+	bool operator==(const SOnlineEvent& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SOnlineEvent& p_Other) const { return !(*this == p_Other); }
 
 	ZString sName; // 0x0
@@ -21155,14 +20766,12 @@ static_assert(alignof(SOnlineEvent) == 0x8, "Wrong alignment for SOnlineEvent");
 class alignas(8) SOnlineSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SOnlineSaveData& p_Other) const;
+	bool operator==(const SOnlineSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SOnlineSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sName; // 0x0
@@ -21183,14 +20792,12 @@ static_assert(alignof(SOnlineSaveData) == 0x8, "Wrong alignment for SOnlineSaveD
 class alignas(8) SOptionValueSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SOptionValueSaveData& p_Other) const;
+	bool operator==(const SOptionValueSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SOptionValueSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZVariant m_Value; // 0x0
@@ -21203,14 +20810,14 @@ static_assert(alignof(SOptionValueSaveData) == 0x8, "Wrong alignment for SOption
 class alignas(1) SPFObstactleSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPFObstactleSaveData& p_Other) const;
+	bool operator==(const SPFObstactleSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPFObstactleSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -21223,14 +20830,14 @@ static_assert(alignof(SPFObstactleSaveData) == 0x1, "Wrong alignment for SPFObst
 class alignas(1) SPIPMessageManagerProxySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SPIPMessageManagerProxySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SPIPMessageManagerProxySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPIPMessageManagerProxySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -21243,14 +20850,12 @@ static_assert(alignof(SPIPMessageManagerProxySaveData) == 0x1, "Wrong alignment
 class alignas(8) SPackedAnimSetEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPackedAnimSetEntry& p_Other) const;
+	bool operator==(const SPackedAnimSetEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPackedAnimSetEntry& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sName; // 0x0
@@ -21267,14 +20872,14 @@ static_assert(alignof(SPackedAnimSetEntry) == 0x8, "Wrong alignment for SPackedA
 class alignas(4) SPatrolGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPatrolGroupSaveData& p_Other) const;
+	bool operator==(const SPatrolGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPatrolGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nRouteID; // 0x0
@@ -21287,14 +20892,14 @@ static_assert(alignof(SPatrolGroupSaveData) == 0x4, "Wrong alignment for SPatrol
 class alignas(4) SPerceptibleCrowdBodySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPerceptibleCrowdBodySaveData& p_Other) const;
+	bool operator==(const SPerceptibleCrowdBodySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPerceptibleCrowdBodySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rCombatZone; // 0x0
@@ -21309,14 +20914,12 @@ static_assert(alignof(SPerceptibleCrowdBodySaveData) == 0x4, "Wrong alignment fo
 class alignas(8) SPersistentEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPersistentEntitySaveData& p_Other) const;
+	bool operator==(const SPersistentEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPersistentEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint64 m_nResourceId; // 0x0
@@ -21333,14 +20936,12 @@ static_assert(alignof(SPersistentEntitySaveData) == 0x8, "Wrong alignment for SP
 class alignas(8) SPersistentEntitySaveDataList
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPersistentEntitySaveDataList& p_Other) const;
+	bool operator==(const SPersistentEntitySaveDataList& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPersistentEntitySaveDataList& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SPersistentEntitySaveData> m_aEntityDatas; // 0x0
@@ -21357,14 +20958,14 @@ static_assert(alignof(SPersistentEntitySaveDataList) == 0x8, "Wrong alignment fo
 class alignas(1) SPhysicsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SPhysicsSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SPhysicsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPhysicsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsInPhysicsWorld; // 0x0
@@ -21381,14 +20982,12 @@ static_assert(alignof(SPhysicsSaveData) == 0x1, "Wrong alignment for SPhysicsSav
 class alignas(8) SPhysicsListSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPhysicsListSaveData& p_Other) const;
+	bool operator==(const SPhysicsListSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPhysicsListSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntityRefs; // 0x0
@@ -21403,14 +21002,12 @@ static_assert(alignof(SPhysicsListSaveData) == 0x8, "Wrong alignment for SPhysic
 class alignas(8) SPrivateAreaSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SPrivateAreaSaveData& p_Other) const;
+	bool operator==(const SPrivateAreaSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SPrivateAreaSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsInside; // 0x0
@@ -21427,14 +21024,14 @@ static_assert(alignof(SPrivateAreaSaveData) == 0x8, "Wrong alignment for SPrivat
 class alignas(4) SProgressTimerEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SProgressTimerEntitySaveData& p_Other) const;
+	bool operator==(const SProgressTimerEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SProgressTimerEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nInterval; // 0x0
@@ -21451,14 +21048,14 @@ static_assert(alignof(SProgressTimerEntitySaveData) == 0x4, "Wrong alignment for
 class alignas(4) SRandomTimerEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRandomTimerEntitySaveData& p_Other) const;
+	bool operator==(const SRandomTimerEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRandomTimerEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -21481,14 +21078,12 @@ static_assert(alignof(SRandomTimerEntitySaveData) == 0x4, "Wrong alignment for S
 class alignas(8) SRandomTimerEntitiesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRandomTimerEntitiesSaveData& p_Other) const;
+	bool operator==(const SRandomTimerEntitiesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRandomTimerEntitiesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -21503,14 +21098,12 @@ static_assert(alignof(SRandomTimerEntitiesSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SRateBasedValueInterpolatorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRateBasedValueInterpolatorSaveData& p_Other) const;
+	bool operator==(const SRateBasedValueInterpolatorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRateBasedValueInterpolatorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bInterpolating; // 0x0
@@ -21527,14 +21120,12 @@ static_assert(alignof(SRateBasedValueInterpolatorSaveData) == 0x8, "Wrong alignm
 class alignas(8) SRateBasedSpatialInterpolatorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRateBasedSpatialInterpolatorSaveData& p_Other) const;
+	bool operator==(const SRateBasedSpatialInterpolatorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRateBasedSpatialInterpolatorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rSpatial; // 0x0
@@ -21549,14 +21140,12 @@ static_assert(alignof(SRateBasedSpatialInterpolatorSaveData) == 0x8, "Wrong alig
 class alignas(8) ZBitArray
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZBitArray& p_Other) const;
+	bool operator==(const ZBitArray& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZBitArray& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint8> m_aBytes; // 0x0
@@ -21571,14 +21160,12 @@ static_assert(alignof(ZBitArray) == 0x8, "Wrong alignment for ZBitArray");
 class alignas(16) SReasoningGrid
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SReasoningGrid& p_Other) const;
+	bool operator==(const SReasoningGrid& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SReasoningGrid& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SGWaypoint> m_WaypointList; // 0x0
@@ -21603,14 +21190,14 @@ static_assert(alignof(SReasoningGrid) == 0x10, "Wrong alignment for SReasoningGr
 class alignas(8) SRecoverUnconsciousGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SRecoverUnconsciousGroupSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SRecoverUnconsciousGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRecoverUnconsciousGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -21635,14 +21222,12 @@ static_assert(alignof(SRecoverUnconsciousGroupSaveData) == 0x8, "Wrong alignment
 class alignas(8) SRememberActorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRememberActorSaveData& p_Other) const;
+	bool operator==(const SRememberActorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRememberActorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_Actors; // 0x0
@@ -21655,14 +21240,14 @@ static_assert(alignof(SRememberActorSaveData) == 0x8, "Wrong alignment for SReme
 class alignas(1) SRemoteControlReceiverSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRemoteControlReceiverSaveData& p_Other) const;
+	bool operator==(const SRemoteControlReceiverSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRemoteControlReceiverSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -21679,14 +21264,14 @@ static_assert(alignof(SRemoteControlReceiverSaveData) == 0x1, "Wrong alignment f
 class alignas(8) SRenderVideoPlayerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRenderVideoPlayerSaveData& p_Other) const;
+	bool operator==(const SRenderVideoPlayerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRenderVideoPlayerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bPlaying; // 0x0
@@ -21719,14 +21304,14 @@ static_assert(alignof(SRenderVideoPlayerSaveData) == 0x8, "Wrong alignment for S
 class alignas(1) SRepositionOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SRepositionOrderSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SRepositionOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRepositionOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bStrafe; // 0x0
@@ -21741,14 +21326,14 @@ static_assert(alignof(SRepositionOrderSaveData) == 0x1, "Wrong alignment for SRe
 class alignas(4) SRotateEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SRotateEntitySaveData& p_Other) const;
+	bool operator==(const SRotateEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SRotateEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bEnabled; // 0x0
@@ -21767,14 +21352,14 @@ static_assert(alignof(SRotateEntitySaveData) == 0x4, "Wrong alignment for SRotat
 class alignas(1) SSCCuriousConfiguration
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSCCuriousConfiguration& p_Other) const;
+	bool operator==(const SSCCuriousConfiguration& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSCCuriousConfiguration& p_Other) const { return !(*this == p_Other); }
 
 	bool m_CanGuardsInvestigate; // 0x0
@@ -21791,14 +21376,12 @@ static_assert(alignof(SSCCuriousConfiguration) == 0x1, "Wrong alignment for SSCC
 class alignas(8) SSavableData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSavableData& p_Other) const;
+	bool operator==(const SSavableData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSavableData& p_Other) const { return !(*this == p_Other); }
 
 	ZVariant m_EntitiesData; // 0x0
@@ -21815,14 +21398,12 @@ static_assert(alignof(SSavableData) == 0x8, "Wrong alignment for SSavableData");
 class alignas(8) SVariantStruct
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVariantStruct& p_Other) const;
+	bool operator==(const SVariantStruct& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVariantStruct& p_Other) const { return !(*this == p_Other); }
 
 	ZVariant m_Data; // 0x0
@@ -21835,14 +21416,12 @@ static_assert(alignof(SVariantStruct) == 0x8, "Wrong alignment for SVariantStruc
 class alignas(8) SSavableEntitiesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSavableEntitiesSaveData& p_Other) const;
+	bool operator==(const SSavableEntitiesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSavableEntitiesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -21857,14 +21436,12 @@ static_assert(alignof(SSavableEntitiesSaveData) == 0x8, "Wrong alignment for SSa
 class alignas(8) SSaveGameData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSaveGameData& p_Other) const;
+	bool operator==(const SSaveGameData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSaveGameData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nVersion; // 0x0
@@ -21881,14 +21458,12 @@ static_assert(alignof(SSaveGameData) == 0x8, "Wrong alignment for SSaveGameData"
 class alignas(8) SSaveGameMetaData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSaveGameMetaData& p_Other) const;
+	bool operator==(const SSaveGameMetaData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSaveGameMetaData& p_Other) const { return !(*this == p_Other); }
 
 	uint8 nSlot; // 0x0
@@ -21927,14 +21502,12 @@ static_assert(alignof(SSaveGameMetaData) == 0x8, "Wrong alignment for SSaveGameM
 class alignas(8) SSaveGameHeader
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSaveGameHeader& p_Other) const;
+	bool operator==(const SSaveGameHeader& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSaveGameHeader& p_Other) const { return !(*this == p_Other); }
 
 	uint32 nFourCC; // 0x0
@@ -21957,14 +21530,12 @@ static_assert(alignof(SSaveGameHeader) == 0x8, "Wrong alignment for SSaveGameHea
 class alignas(8) SScreenplay2ManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SScreenplay2ManagerSaveData& p_Other) const;
+	bool operator==(const SScreenplay2ManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SScreenplay2ManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SDramaActorCollectionSaveData m_DramaActorData; // 0x0
@@ -21987,14 +21558,12 @@ static_assert(alignof(SScreenplay2ManagerSaveData) == 0x8, "Wrong alignment for
 class alignas(8) SScreenplayManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SScreenplayManagerSaveData& p_Other) const;
+	bool operator==(const SScreenplayManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SScreenplayManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SDramaActorCollectionSaveData m_DramaActorData; // 0x0
@@ -22011,14 +21580,14 @@ static_assert(alignof(SScreenplayManagerSaveData) == 0x8, "Wrong alignment for S
 class alignas(4) SScreenplayRole2HeroSaveState
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SScreenplayRole2HeroSaveState& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SScreenplayRole2HeroSaveState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SScreenplayRole2HeroSaveState& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rCurrentSpeakEntity; // 0x0
@@ -22033,14 +21602,14 @@ static_assert(alignof(SScreenplayRole2HeroSaveState) == 0x4, "Wrong alignment fo
 class alignas(2) SSecuritySystemCameraSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSecuritySystemCameraSaveData& p_Other) const;
+	bool operator==(const SSecuritySystemCameraSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSecuritySystemCameraSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint16 m_nEscalation; // 0x0
@@ -22061,14 +21630,14 @@ static_assert(alignof(SSecuritySystemCameraSaveData) == 0x2, "Wrong alignment fo
 class alignas(1) SSecuritySystemRecorderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSecuritySystemRecorderSaveData& p_Other) const;
+	bool operator==(const SSecuritySystemRecorderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSecuritySystemRecorderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bHasRecordings; // 0x0
@@ -22083,14 +21652,14 @@ static_assert(alignof(SSecuritySystemRecorderSaveData) == 0x1, "Wrong alignment
 class alignas(8) SSentryGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SSentryGroupSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SSentryGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSentryGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rTarget; // 0x0
@@ -22117,14 +21686,14 @@ static_assert(alignof(SSentryGroupSaveData) == 0x8, "Wrong alignment for SSentry
 class alignas(4) SSentryOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSentryOrderSaveData& p_Other) const;
+	bool operator==(const SSentryOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSentryOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rSentryZone; // 0x0
@@ -22137,14 +21706,12 @@ static_assert(alignof(SSentryOrderSaveData) == 0x4, "Wrong alignment for SSentry
 class alignas(8) SSentryZoneSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSentryZoneSaveData& p_Other) const;
+	bool operator==(const SSentryZoneSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSentryZoneSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_tGreetingCooldown; // 0x0
@@ -22211,14 +21778,12 @@ static_assert(alignof(SSentryZoneSaveData) == 0x8, "Wrong alignment for SSentryZ
 class alignas(8) SSequenceTrackSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSequenceTrackSaveData& p_Other) const;
+	bool operator==(const SSequenceTrackSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSequenceTrackSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rTrackEntity; // 0x0
@@ -22233,14 +21798,12 @@ static_assert(alignof(SSequenceTrackSaveData) == 0x8, "Wrong alignment for SSequ
 class alignas(8) SSequenceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSequenceSaveData& p_Other) const;
+	bool operator==(const SSequenceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSequenceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<ZSequenceEntity::ECommand> m_commandQueue; // 0x0
@@ -22275,14 +21838,12 @@ static_assert(alignof(SSequenceSaveData) == 0x8, "Wrong alignment for SSequenceS
 class alignas(8) SSequenceManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSequenceManagerSaveData& p_Other) const;
+	bool operator==(const SSequenceManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSequenceManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -22297,14 +21858,12 @@ static_assert(alignof(SSequenceManagerSaveData) == 0x8, "Wrong alignment for SSe
 class alignas(8) SSituationConversationGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSituationConversationGroupSaveData& p_Other) const;
+	bool operator==(const SSituationConversationGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSituationConversationGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_members; // 0x0
@@ -22317,14 +21876,12 @@ static_assert(alignof(SSituationConversationGroupSaveData) == 0x8, "Wrong alignm
 class alignas(16) SSituationOrderSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSituationOrderSaveData& p_Other) const;
+	bool operator==(const SSituationOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSituationOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sClassTypeName; // 0x0
@@ -22364,14 +21921,14 @@ public:
 class alignas(4) SSmuggleSituationActorStateSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSmuggleSituationActorStateSaveData& p_Other) const;
+	bool operator==(const SSmuggleSituationActorStateSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSmuggleSituationActorStateSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -22396,14 +21953,12 @@ static_assert(alignof(SSmuggleSituationActorStateSaveData) == 0x4, "Wrong alignm
 class alignas(8) SSmuggleSituationSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSmuggleSituationSaveData& p_Other) const;
+	bool operator==(const SSmuggleSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSmuggleSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsEnabled; // 0x0
@@ -22424,14 +21979,14 @@ static_assert(alignof(SSmuggleSituationSaveData) == 0x8, "Wrong alignment for SS
 class alignas(8) SSniperCombatGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SSniperCombatGroupSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SSniperCombatGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSniperCombatGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SFSMSaveData m_fsmState; // 0x0
@@ -22452,14 +22007,12 @@ static_assert(alignof(SSniperCombatGroupSaveData) == 0x8, "Wrong alignment for S
 class alignas(8) SSniperScoringEvent
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSniperScoringEvent& p_Other) const;
+	bool operator==(const SSniperScoringEvent& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSniperScoringEvent& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_iPoints; // 0x0
@@ -22482,14 +22035,14 @@ static_assert(alignof(SSniperScoringEvent) == 0x8, "Wrong alignment for SSniperS
 class alignas(1) SSpaceCollectionBehaviorConfiguration
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSpaceCollectionBehaviorConfiguration& p_Other) const;
+	bool operator==(const SSpaceCollectionBehaviorConfiguration& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSpaceCollectionBehaviorConfiguration& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bInclusive; // 0x0
@@ -22502,14 +22055,14 @@ static_assert(alignof(SSpaceCollectionBehaviorConfiguration) == 0x1, "Wrong alig
 class alignas(4) SSpatialMoverEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSpatialMoverEntitySaveData& p_Other) const;
+	bool operator==(const SSpatialMoverEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSpatialMoverEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fSpeed; // 0x0
@@ -22530,14 +22083,14 @@ static_assert(alignof(SSpatialMoverEntitySaveData) == 0x4, "Wrong alignment for
 class alignas(4) SSpatialSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SSpatialSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SSpatialSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSpatialSaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bVisible; // 0x0
@@ -22554,14 +22107,14 @@ static_assert(alignof(SSpatialSaveData) == 0x4, "Wrong alignment for SSpatialSav
 class alignas(4) SSpeakEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SSpeakEntitySaveData& p_Other) const;
+	bool operator==(const SSpeakEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SSpeakEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fSeekPosition; // 0x0
@@ -22574,14 +22127,14 @@ static_assert(alignof(SSpeakEntitySaveData) == 0x4, "Wrong alignment for SSpeakE
 class alignas(4) SStateControllerSaveDataStruct
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SStateControllerSaveDataStruct& p_Other) const;
+	bool operator==(const SStateControllerSaveDataStruct& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SStateControllerSaveDataStruct& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nIndex; // 0x0
@@ -22596,14 +22149,12 @@ static_assert(alignof(SStateControllerSaveDataStruct) == 0x4, "Wrong alignment f
 class alignas(8) SStateControllerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SStateControllerSaveData& p_Other) const;
+	bool operator==(const SStateControllerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SStateControllerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -22618,14 +22169,14 @@ static_assert(alignof(SStateControllerSaveData) == 0x8, "Wrong alignment for SSt
 class alignas(4) SStepCounterEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SStepCounterEntitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SStepCounterEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SStepCounterEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_nIndex; // 0x0
@@ -22650,14 +22201,12 @@ static_assert(alignof(SStepCounterEntitySaveData) == 0x4, "Wrong alignment for S
 class alignas(8) SStoreItem
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SStoreItem& p_Other) const;
+	bool operator==(const SStoreItem& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SStoreItem& p_Other) const { return !(*this == p_Other); }
 
 	ZString Id; // 0x0
@@ -22678,14 +22227,12 @@ static_assert(alignof(SStoreItem) == 0x8, "Wrong alignment for SStoreItem");
 class alignas(8) STargetInfoObjectiveCondition
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STargetInfoObjectiveCondition& p_Other) const;
+	bool operator==(const STargetInfoObjectiveCondition& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STargetInfoObjectiveCondition& p_Other) const { return !(*this == p_Other); }
 
 	ZString header; // 0x0
@@ -22706,14 +22253,12 @@ static_assert(alignof(STargetInfoObjectiveCondition) == 0x8, "Wrong alignment fo
 class alignas(8) STargetInfoDisplayData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STargetInfoDisplayData& p_Other) const;
+	bool operator==(const STargetInfoDisplayData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STargetInfoDisplayData& p_Other) const { return !(*this == p_Other); }
 
 	ZString npcName; // 0x0
@@ -22740,14 +22285,12 @@ static_assert(alignof(STargetInfoDisplayData) == 0x8, "Wrong alignment for STarg
 class alignas(8) STargetInfoDisplayData_Dummy
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STargetInfoDisplayData_Dummy& p_Other) const;
+	bool operator==(const STargetInfoDisplayData_Dummy& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STargetInfoDisplayData_Dummy& p_Other) const { return !(*this == p_Other); }
 
 	TArray<STargetInfoDisplayData> __dummy; // 0x0
@@ -22760,14 +22303,14 @@ static_assert(alignof(STargetInfoDisplayData_Dummy) == 0x8, "Wrong alignment for
 class alignas(16) STargetTrackingSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STargetTrackingSaveData& p_Other) const;
+	bool operator==(const STargetTrackingSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STargetTrackingSaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_sharedTarget; // 0x0
@@ -22784,14 +22327,12 @@ static_assert(alignof(STargetTrackingSaveData) == 0x10, "Wrong alignment for STa
 class alignas(8) STargetTrackingServiceSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STargetTrackingServiceSaveData& p_Other) const;
+	bool operator==(const STargetTrackingServiceSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STargetTrackingServiceSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<STargetTrackingSaveData> m_aTrackedTargets; // 0x0
@@ -22804,14 +22345,14 @@ static_assert(alignof(STargetTrackingServiceSaveData) == 0x8, "Wrong alignment f
 class alignas(4) STargetableBoneConfiguration
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STargetableBoneConfiguration& p_Other) const;
+	bool operator==(const STargetableBoneConfiguration& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STargetableBoneConfiguration& p_Other) const { return !(*this == p_Other); }
 
 	BoneId::Enum m_eBone; // 0x0
@@ -22826,14 +22367,12 @@ static_assert(alignof(STargetableBoneConfiguration) == 0x4, "Wrong alignment for
 class alignas(8) STemplateBlueprintSubEntity
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STemplateBlueprintSubEntity& p_Other) const;
+	bool operator==(const STemplateBlueprintSubEntity& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STemplateBlueprintSubEntity& p_Other) const { return !(*this == p_Other); }
 
 	SEntityTemplateReference logicalParent; // 0x0
@@ -22862,14 +22401,12 @@ static_assert(alignof(STemplateBlueprintSubEntity) == 0x8, "Wrong alignment for
 class alignas(8) STemplateEntityBlueprint
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STemplateEntityBlueprint& p_Other) const;
+	bool operator==(const STemplateEntityBlueprint& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STemplateEntityBlueprint& p_Other) const { return !(*this == p_Other); }
 
 	int32 subType; // 0x0
@@ -22900,14 +22437,12 @@ static_assert(alignof(STemplateEntityBlueprint) == 0x8, "Wrong alignment for STe
 class alignas(8) STemplateFactorySubEntity
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STemplateFactorySubEntity& p_Other) const;
+	bool operator==(const STemplateFactorySubEntity& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STemplateFactorySubEntity& p_Other) const { return !(*this == p_Other); }
 
 	SEntityTemplateReference logicalParent; // 0x0
@@ -22928,14 +22463,12 @@ static_assert(alignof(STemplateFactorySubEntity) == 0x8, "Wrong alignment for ST
 class alignas(8) STemplateEntityFactory
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STemplateEntityFactory& p_Other) const;
+	bool operator==(const STemplateEntityFactory& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STemplateEntityFactory& p_Other) const { return !(*this == p_Other); }
 
 	int32 subType; // 0x0
@@ -22967,14 +22500,12 @@ public:
 
 
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STestStruct& p_Other) const;
+	bool operator==(const STestStruct& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STestStruct& p_Other) const { return !(*this == p_Other); }
 
 	ZString stringField; // 0x0
@@ -22993,14 +22524,12 @@ static_assert(alignof(STestStruct) == 0x8, "Wrong alignment for STestStruct");
 class alignas(8) STestStruct2
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STestStruct2& p_Other) const;
+	bool operator==(const STestStruct2& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STestStruct2& p_Other) const { return !(*this == p_Other); }
 
 	TArray<STestStruct> arrayField; // 0x0
@@ -23015,14 +22544,14 @@ static_assert(alignof(STestStruct2) == 0x8, "Wrong alignment for STestStruct2");
 class alignas(4) STimerEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const STimerEntitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const STimerEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STimerEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	int32 m_nInterval; // 0x0
@@ -23039,14 +22568,12 @@ static_assert(alignof(STimerEntitySaveData) == 0x4, "Wrong alignment for STimerE
 class alignas(8) STimerEntitiesSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STimerEntitiesSaveData& p_Other) const;
+	bool operator==(const STimerEntitiesSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STimerEntitiesSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -23061,14 +22588,12 @@ static_assert(alignof(STimerEntitiesSaveData) == 0x8, "Wrong alignment for STime
 class alignas(8) STimerManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STimerManagerSaveData& p_Other) const;
+	bool operator==(const STimerManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STimerManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	STimerEntitiesSaveData m_TimersData; // 0x0
@@ -23085,14 +22610,14 @@ static_assert(alignof(STimerManagerSaveData) == 0x8, "Wrong alignment for STimer
 class alignas(4) STokenID
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STokenID& p_Other) const;
+	bool operator==(const STokenID& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STokenID& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_iValue; // 0x0
@@ -23107,14 +22632,14 @@ static_assert(alignof(STokenID) == 0x4, "Wrong alignment for STokenID");
 class alignas(4) STrackDollyControllerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STrackDollyControllerSaveData& p_Other) const;
+	bool operator==(const STrackDollyControllerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STrackDollyControllerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rTrackEntity; // 0x0
@@ -23135,14 +22660,14 @@ static_assert(alignof(STrackDollyControllerSaveData) == 0x4, "Wrong alignment fo
 class alignas(4) STrackerEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const STrackerEntitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const STrackerEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STrackerEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rTracker; // 0x0
@@ -23161,14 +22686,12 @@ static_assert(alignof(STrackerEntitySaveData) == 0x4, "Wrong alignment for STrac
 class alignas(8) STrackerManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STrackerManagerSaveData& p_Other) const;
+	bool operator==(const STrackerManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STrackerManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<STrackerEntitySaveData> m_aTrackerData; // 0x0
@@ -23181,14 +22704,14 @@ static_assert(alignof(STrackerManagerSaveData) == 0x8, "Wrong alignment for STra
 class alignas(16) STrajectoryTrackSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STrajectoryTrackSaveData& p_Other) const;
+	bool operator==(const STrajectoryTrackSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STrajectoryTrackSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SMatrix m_vOriginalEntityTransform; // 0x0
@@ -23203,14 +22726,12 @@ static_assert(alignof(STrajectoryTrackSaveData) == 0x10, "Wrong alignment for ST
 class alignas(8) STrespassingRuleEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STrespassingRuleEntitySaveData& p_Other) const;
+	bool operator==(const STrespassingRuleEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STrespassingRuleEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<bool> m_aAllowedProfessionsDisabled; // 0x0
@@ -23223,14 +22744,14 @@ static_assert(alignof(STrespassingRuleEntitySaveData) == 0x8, "Wrong alignment f
 class alignas(8) STriggerAlarmGroupSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const STriggerAlarmGroupSaveData& p_Other) const;
+	bool operator==(const STriggerAlarmGroupSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const STriggerAlarmGroupSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rTarget; // 0x0
@@ -23251,14 +22772,14 @@ static_assert(alignof(STriggerAlarmGroupSaveData) == 0x8, "Wrong alignment for S
 class alignas(4) SUIBreadcrumbDataSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SUIBreadcrumbDataSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SUIBreadcrumbDataSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SUIBreadcrumbDataSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fProgress; // 0x0
@@ -23273,14 +22794,14 @@ static_assert(alignof(SUIBreadcrumbDataSaveData) == 0x4, "Wrong alignment for SU
 class alignas(4) SUIGridCellPosition
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SUIGridCellPosition& p_Other) const;
+	bool operator==(const SUIGridCellPosition& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SUIGridCellPosition& p_Other) const { return !(*this == p_Other); }
 
 	int32 nColumnIndex; // 0x0
@@ -23299,14 +22820,12 @@ static_assert(alignof(SUIGridCellPosition) == 0x4, "Wrong alignment for SUIGridC
 class alignas(8) SUIOpenVRComponent
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SUIOpenVRComponent& p_Other) const;
+	bool operator==(const SUIOpenVRComponent& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SUIOpenVRComponent& p_Other) const { return !(*this == p_Other); }
 
 	EUIOpenVRComponentArchetypeID idArchetype; // 0x0
@@ -23323,14 +22842,12 @@ static_assert(alignof(SUIOpenVRComponent) == 0x8, "Wrong alignment for SUIOpenVR
 class alignas(8) SUIOpenVRButtonConversion
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SUIOpenVRButtonConversion& p_Other) const;
+	bool operator==(const SUIOpenVRButtonConversion& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SUIOpenVRButtonConversion& p_Other) const { return !(*this == p_Other); }
 
 	EUIGamepadButtonID idSource; // 0x0
@@ -23518,14 +23035,12 @@ enum class _EUIOptionKey : int32_t
 class alignas(8) SUIOptionsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SUIOptionsSaveData& p_Other) const;
+	bool operator==(const SUIOptionsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SUIOptionsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<_EUIOptionKey> m_aKeys; // 0x0
@@ -23558,14 +23073,12 @@ public:
 	class alignas(8) SSubSubStruct
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSubSubStruct& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSubSubStruct& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSubSubStruct& p_Other) const { return !(*this == p_Other); }
 
 		ZString sDeepString; // 0x0
@@ -23578,14 +23091,12 @@ public:
 	class alignas(8) SSubStruct
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSubStruct& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSubStruct& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSubStruct& p_Other) const { return !(*this == p_Other); }
 
 		TArray<SUITestData::SSubSubStruct> aSubSubStructs; // 0x0
@@ -23596,14 +23107,12 @@ public:
 
 
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SUITestData& p_Other) const;
+	bool operator==(const SUITestData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SUITestData& p_Other) const { return !(*this == p_Other); }
 
 	int32 nIntProp; // 0x0
@@ -23634,14 +23143,12 @@ static_assert(alignof(SUITestData) == 0x8, "Wrong alignment for SUITestData");
 class alignas(8) SWeaponWheelPromptData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SWeaponWheelPromptData& p_Other) const;
+	bool operator==(const SWeaponWheelPromptData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SWeaponWheelPromptData& p_Other) const { return !(*this == p_Other); }
 
 	ZString actiontype; // 0x0
@@ -23662,14 +23169,14 @@ static_assert(alignof(SWeaponWheelPromptData) == 0x8, "Wrong alignment for SWeap
 class alignas(16) SVRConfigCameraComponent
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVRConfigCameraComponent& p_Other) const;
+	bool operator==(const SVRConfigCameraComponent& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVRConfigCameraComponent& p_Other) const { return !(*this == p_Other); }
 
 	EVRConfigHeadAnchorMode m_eHeadAnchorMode; // 0x0
@@ -23700,14 +23207,14 @@ static_assert(alignof(SVRConfigCameraComponent) == 0x10, "Wrong alignment for SV
 class alignas(4) SValueBoolDelayedEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SValueBoolDelayedEntitySaveData& p_Other) const;
+	bool operator==(const SValueBoolDelayedEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SValueBoolDelayedEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bValue; // 0x0
@@ -23724,14 +23231,12 @@ static_assert(alignof(SValueBoolDelayedEntitySaveData) == 0x4, "Wrong alignment
 class alignas(8) SValueBoolsSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SValueBoolsSaveData& p_Other) const;
+	bool operator==(const SValueBoolsSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SValueBoolsSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -23746,14 +23251,12 @@ static_assert(alignof(SValueBoolsSaveData) == 0x8, "Wrong alignment for SValueBo
 class alignas(8) SValueFloatSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SValueFloatSaveData& p_Other) const;
+	bool operator==(const SValueFloatSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SValueFloatSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -23768,14 +23271,12 @@ static_assert(alignof(SValueFloatSaveData) == 0x8, "Wrong alignment for SValueFl
 class alignas(8) SValueIntSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SValueIntSaveData& p_Other) const;
+	bool operator==(const SValueIntSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SValueIntSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aEntities; // 0x0
@@ -23790,14 +23291,12 @@ static_assert(alignof(SValueIntSaveData) == 0x8, "Wrong alignment for SValueIntS
 class alignas(8) SValueSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SValueSaveData& p_Other) const;
+	bool operator==(const SValueSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SValueSaveData& p_Other) const { return !(*this == p_Other); }
 
 	SValueBoolsSaveData m_ValueBool; // 0x0
@@ -23818,14 +23317,12 @@ static_assert(alignof(SValueSaveData) == 0x8, "Wrong alignment for SValueSaveDat
 class alignas(8) SVideoDatabaseEntry
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVideoDatabaseEntry& p_Other) const;
+	bool operator==(const SVideoDatabaseEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVideoDatabaseEntry& p_Other) const { return !(*this == p_Other); }
 
 	ZString VideoId; // 0x0
@@ -23840,14 +23337,12 @@ static_assert(alignof(SVideoDatabaseEntry) == 0x8, "Wrong alignment for SVideoDa
 class alignas(8) SVideoDatabaseData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVideoDatabaseData& p_Other) const;
+	bool operator==(const SVideoDatabaseData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVideoDatabaseData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SVideoDatabaseEntry> Videos; // 0x0
@@ -23860,14 +23355,14 @@ static_assert(alignof(SVideoDatabaseData) == 0x8, "Wrong alignment for SVideoDat
 class alignas(1) SVisibilitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SVisibilitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SVisibilitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVisibilitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bIsVisible; // 0x0
@@ -23880,14 +23375,14 @@ static_assert(alignof(SVisibilitySaveData) == 0x1, "Wrong alignment for SVisibil
 class alignas(4) SVoidSignalEntitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVoidSignalEntitySaveData& p_Other) const;
+	bool operator==(const SVoidSignalEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVoidSignalEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	bool m_bSignaling; // 0x0
@@ -23902,14 +23397,14 @@ static_assert(alignof(SVoidSignalEntitySaveData) == 0x4, "Wrong alignment for SV
 class alignas(8) SVrSingleHandThrowSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SVrSingleHandThrowSaveData& p_Other) const;
+	bool operator==(const SVrSingleHandThrowSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVrSingleHandThrowSaveData& p_Other) const { return !(*this == p_Other); }
 
 	ZGameTime m_tLastThrowTimeRight; // 0x0
@@ -23928,14 +23423,14 @@ static_assert(alignof(SVrSingleHandThrowSaveData) == 0x8, "Wrong alignment for S
 class alignas(4) SVrTakeDisguiseSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SVrTakeDisguiseSaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SVrTakeDisguiseSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SVrTakeDisguiseSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 fLastDisguiseTakenTime; // 0x0
@@ -23956,14 +23451,12 @@ static_assert(alignof(SVrTakeDisguiseSaveData) == 0x4, "Wrong alignment for SVrT
 class alignas(8) SWatersplashGeneratorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SWatersplashGeneratorSaveData& p_Other) const;
+	bool operator==(const SWatersplashGeneratorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SWatersplashGeneratorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<SDeadActorSaveData> m_aDeadActors; // 0x0
@@ -23976,14 +23469,14 @@ static_assert(alignof(SWatersplashGeneratorSaveData) == 0x8, "Wrong alignment fo
 class alignas(4) SWaveformGeneratorSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SWaveformGeneratorSaveData& p_Other) const;
+	bool operator==(const SWaveformGeneratorSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SWaveformGeneratorSaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 m_fTime; // 0x0
@@ -24006,14 +23499,12 @@ static_assert(alignof(SWaveformGeneratorSaveData) == 0x4, "Wrong alignment for S
 class alignas(8) SWaveformGeneratorManagerSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SWaveformGeneratorManagerSaveData& p_Other) const;
+	bool operator==(const SWaveformGeneratorManagerSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SWaveformGeneratorManagerSaveData& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint32> m_aGenerators; // 0x0
@@ -24028,14 +23519,14 @@ static_assert(alignof(SWaveformGeneratorManagerSaveData) == 0x8, "Wrong alignmen
 class alignas(4) SWeaponCustomControlSaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SWeaponCustomControlSaveData& p_Other) const;
+	bool operator==(const SWeaponCustomControlSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SWeaponCustomControlSaveData& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_rActor; // 0x0
@@ -24052,14 +23543,12 @@ static_assert(alignof(SWeaponCustomControlSaveData) == 0x4, "Wrong alignment for
 class alignas(8) SWeaponStatusUIData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const SWeaponStatusUIData& p_Other) const;
+	bool operator==(const SWeaponStatusUIData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SWeaponStatusUIData& p_Other) const { return !(*this == p_Other); }
 
 	ZRuntimeResourceID icon; // 0x0
@@ -24132,14 +23621,14 @@ static_assert(alignof(SWeaponStatusUIData) == 0x8, "Wrong alignment for SWeaponS
 class alignas(4) SZHUDIgnoreVisibilitySaveData
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const SZHUDIgnoreVisibilitySaveData& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const SZHUDIgnoreVisibilitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const SZHUDIgnoreVisibilitySaveData& p_Other) const { return !(*this == p_Other); }
 
 	float32 alpha; // 0x0
@@ -24285,14 +23774,14 @@ public:
 	class alignas(8) SAIDistractionContextEntitySaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SAIDistractionContextEntitySaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SAIDistractionContextEntitySaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SAIDistractionContextEntitySaveData& p_Other) const { return !(*this == p_Other); }
 
 		uint32 m_DistractedActor; // 0x0
@@ -24325,14 +23814,12 @@ namespace ZAISoundEvent {
 class alignas(8) ZAMDEvent
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZAMDEvent& p_Other) const;
+	bool operator==(const ZAMDEvent& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZAMDEvent& p_Other) const { return !(*this == p_Other); }
 
 	uint32 m_nEventID; // 0x0
@@ -24351,14 +23838,12 @@ static_assert(alignof(ZAMDEvent) == 0x8, "Wrong alignment for ZAMDEvent");
 class alignas(8) ZAMDEventTrack
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZAMDEventTrack& p_Other) const;
+	bool operator==(const ZAMDEventTrack& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZAMDEventTrack& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sName; // 0x0
@@ -24373,14 +23858,12 @@ static_assert(alignof(ZAMDEventTrack) == 0x8, "Wrong alignment for ZAMDEventTrac
 class alignas(8) ZAMDTake
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZAMDTake& p_Other) const;
+	bool operator==(const ZAMDTake& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZAMDTake& p_Other) const { return !(*this == p_Other); }
 
 	TArray<ZAMDEventTrack> m_eventTracks; // 0x0
@@ -24407,14 +23890,14 @@ public:
 	class alignas(4) SGeneratedFootstepEvent
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SGeneratedFootstepEvent& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SGeneratedFootstepEvent& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SGeneratedFootstepEvent& p_Other) const { return !(*this == p_Other); }
 
 		ZAT2Controller::EFoot m_eFoot; // 0x0
@@ -24438,14 +23921,12 @@ public:
 	class alignas(8) SEventPreviewInfo
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SEventPreviewInfo& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SEventPreviewInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SEventPreviewInfo& p_Other) const { return !(*this == p_Other); }
 
 		int32 m_nEventID; // 0x0
@@ -24732,14 +24213,14 @@ public:
 	class alignas(16) SApproachOrderSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SApproachOrderSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SApproachOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SApproachOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 		float4 m_vStopDirection; // 0x0
@@ -24807,14 +24288,12 @@ public:
 	class alignas(8) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		TArray<int32> m_aAvoidDangerousAreaGroups; // 0x0
@@ -25004,14 +24483,12 @@ enum class eVRFadeType : int32_t
 class alignas(8) ZComponentCreator
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZComponentCreator& p_Other) const;
+	bool operator==(const ZComponentCreator& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZComponentCreator& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sComponentName; // 0x0
@@ -25165,14 +24642,14 @@ public:
 	class alignas(8) SState
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SState& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SState& p_Other) const { return !(*this == p_Other); }
 
 		ZDeadBodySituation::ESituationFlavor m_eFlavor; // 0x0
@@ -25203,14 +24680,14 @@ public:
 	class alignas(4) SIncidentSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SIncidentSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SIncidentSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SIncidentSaveData& p_Other) const { return !(*this == p_Other); }
 
 		uint32 m_body; // 0x0
@@ -25225,14 +24702,12 @@ public:
 	class alignas(8) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		ZDeadBodySituation::SState m_State; // 0x0
@@ -25368,14 +24843,14 @@ public:
 	class alignas(4) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		int32 m_pDetectedInPrivateGroup; // 0x0
@@ -25393,14 +24868,14 @@ public:
 	class alignas(4) SVisibilitySetting
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SVisibilitySetting& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SVisibilitySetting& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SVisibilitySetting& p_Other) const { return !(*this == p_Other); }
 
 		EActorPerceptionSensitivity m_eSensitivity; // 0x0
@@ -25436,14 +24911,12 @@ public:
 	class alignas(8) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		uint32 m_pLeader; // 0x0
@@ -25532,14 +25005,12 @@ public:
 class alignas(8) ZER64
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZER64& p_Other) const;
+	bool operator==(const ZER64& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZER64& p_Other) const { return !(*this == p_Other); }
 
 	uint64 m_nEntityID; // 0x0
@@ -25554,14 +25025,12 @@ static_assert(alignof(ZER64) == 0x8, "Wrong alignment for ZER64");
 class alignas(8) ZEntityID
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZEntityID& p_Other) const;
+	bool operator==(const ZEntityID& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZEntityID& p_Other) const { return !(*this == p_Other); }
 
 	ZString m_sStr; // 0x0
@@ -25599,14 +25068,12 @@ public:
 class alignas(8) ZEntityReference
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZEntityReference& p_Other) const;
+	bool operator==(const ZEntityReference& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZEntityReference& p_Other) const { return !(*this == p_Other); }
 
 	ZEntityID m_EntityID; // 0x0
@@ -25624,14 +25091,12 @@ public:
 	class alignas(8) STerritoryData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const STerritoryData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const STerritoryData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const STerritoryData& p_Other) const { return !(*this == p_Other); }
 
 		ZString destination; // 0x0
@@ -25662,14 +25127,12 @@ public:
 	class alignas(8) SCampaignData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SCampaignData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SCampaignData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SCampaignData& p_Other) const { return !(*this == p_Other); }
 
 		ZString lstrCrimeSector; // 0x0
@@ -25731,14 +25194,14 @@ public:
 	class alignas(4) SCampaignInfo
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SCampaignInfo& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SCampaignInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SCampaignInfo& p_Other) const { return !(*this == p_Other); }
 
 		int32 nDifficultyRank; // 0x0
@@ -25758,14 +25221,12 @@ public:
 	class alignas(8) SData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SData& p_Other) const { return !(*this == p_Other); }
 
 		TArray<int32> campaign; // 0x0
@@ -25878,14 +25339,12 @@ public:
 	class alignas(8) SIntelWallData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SIntelWallData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SIntelWallData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SIntelWallData& p_Other) const { return !(*this == p_Other); }
 
 		int32 nDifficultyRank; // 0x0
@@ -25933,14 +25392,14 @@ public:
 	class alignas(4) SData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SData& p_Other) const { return !(*this == p_Other); }
 
 		int32 nSuppliers; // 0x0
@@ -26120,14 +25579,12 @@ public:
 	class alignas(8) SPrestigeInfo
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SPrestigeInfo& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SPrestigeInfo& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SPrestigeInfo& p_Other) const { return !(*this == p_Other); }
 
 		ZString title; // 0x0
@@ -26149,14 +25606,14 @@ public:
 	class alignas(1) SVitalInfoData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SVitalInfoData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SVitalInfoData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SVitalInfoData& p_Other) const { return !(*this == p_Other); }
 
 		bool isAssassinNearby; // 0x0
@@ -26206,14 +25663,12 @@ public:
 	class alignas(8) SData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SData& p_Other) const { return !(*this == p_Other); }
 
 		bool isInCampaign; // 0x0
@@ -26260,14 +25715,12 @@ public:
 class alignas(8) ZStringBuilder
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZStringBuilder& p_Other) const;
+	bool operator==(const ZStringBuilder& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZStringBuilder& p_Other) const { return !(*this == p_Other); }
 
 	TArray<char> m_chars; // 0x0
@@ -26280,14 +25733,12 @@ static_assert(alignof(ZStringBuilder) == 0x8, "Wrong alignment for ZStringBuilde
 class alignas(8) ZPath
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZPath& p_Other) const;
+	bool operator==(const ZPath& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZPath& p_Other) const { return !(*this == p_Other); }
 
 	ZStringBuilder m_value; // 0x0
@@ -26300,14 +25751,12 @@ static_assert(alignof(ZPath) == 0x8, "Wrong alignment for ZPath");
 class alignas(8) ZFilePath
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZFilePath& p_Other) const;
+	bool operator==(const ZFilePath& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZFilePath& p_Other) const { return !(*this == p_Other); }
 
 	ZPath m_path; // 0x0
@@ -26391,14 +25840,14 @@ public:
 	class alignas(16) SFormationMoveOrderSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SFormationMoveOrderSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SFormationMoveOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SFormationMoveOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 		float4 m_vStopDirection; // 0x0
@@ -26449,14 +25898,14 @@ public:
 	class alignas(4) SAgilityEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SAgilityEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SAgilityEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SAgilityEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5AgilityEventConsumer::EEvent m_nEvent; // 0x0
@@ -26514,14 +25963,14 @@ public:
 	class alignas(4) SBodySoundEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SBodySoundEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SBodySoundEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SBodySoundEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5BodySoundEventConsumer::EAnimSoundBody m_nEvent; // 0x0
@@ -26539,14 +25988,14 @@ public:
 	class alignas(4) SCloseCombatSoundEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SCloseCombatSoundEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SCloseCombatSoundEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SCloseCombatSoundEventData& p_Other) const { return !(*this == p_Other); }
 
 		EHM5SoundCloseCombatEvent m_nEvent; // 0x0
@@ -26599,14 +26048,14 @@ public:
 	class alignas(4) SCrowdSoundGenericEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SCrowdSoundGenericEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SCrowdSoundGenericEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SCrowdSoundGenericEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5CrowdGenericEventConsumer::EEvent m_nEvent; // 0x0
@@ -26655,14 +26104,14 @@ public:
 	class alignas(4) SFaceFXEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SFaceFXEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SFaceFXEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SFaceFXEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5FaceFXReactionEventConsumer::EEvent m_nEvent; // 0x0
@@ -26693,14 +26142,12 @@ public:
 	class alignas(8) SFaceFXEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SFaceFXEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SFaceFXEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SFaceFXEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5FaceFXSpecificEventConsumer::EEvent m_nEvent; // 0x0
@@ -26720,14 +26167,14 @@ public:
 	class alignas(4) SFootstepSoundEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SFootstepSoundEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SFootstepSoundEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SFootstepSoundEventData& p_Other) const { return !(*this == p_Other); }
 
 		EHM5SoundFootstepEvent m_nEvent; // 0x0
@@ -26788,14 +26235,14 @@ public:
 	class alignas(4) SGenericEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SGenericEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SGenericEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SGenericEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5GenericEventConsumer::EEvent m_nEvent; // 0x0
@@ -26829,14 +26276,14 @@ public:
 	class alignas(4) SZHM5HIKEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SZHM5HIKEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SZHM5HIKEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SZHM5HIKEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5HIKEventConsumer::EEffector m_nEffector; // 0x0
@@ -26918,14 +26365,14 @@ public:
 	class alignas(4) SItemInteractionEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SItemInteractionEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SItemInteractionEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SItemInteractionEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5ItemInteractionEventConsumer::EHM5SoundItemInteractionEvent m_nEvent; // 0x0
@@ -27000,14 +26447,14 @@ public:
 	class alignas(4) SWeaponEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SWeaponEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SWeaponEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SWeaponEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZHM5WeaponEventConsumer::EAnimWeapon m_nEvent; // 0x0
@@ -27025,14 +26472,14 @@ public:
 	class alignas(1) SData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SData& p_Other) const { return !(*this == p_Other); }
 
 		bool bDisguiseBroken; // 0x0
@@ -27088,14 +26535,14 @@ public:
 	class alignas(16) SEyeToPlane
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SEyeToPlane& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SEyeToPlane& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SEyeToPlane& p_Other) const { return !(*this == p_Other); }
 
 		float4 posCharacter; // 0x0
@@ -27117,14 +26564,12 @@ public:
 	class alignas(8) SData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SData& p_Other) const { return !(*this == p_Other); }
 
 		ZString m_sTitleText; // 0x0
@@ -27144,14 +26589,12 @@ public:
 	class alignas(8) SData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SData& p_Other) const { return !(*this == p_Other); }
 
 		ZString m_sTitleText; // 0x0
@@ -27171,14 +26614,14 @@ public:
 	class alignas(4) SBoneTestSetup
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SBoneTestSetup& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SBoneTestSetup& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SBoneTestSetup& p_Other) const { return !(*this == p_Other); }
 
 		BoneId::Enum boneId; // 0x0
@@ -27241,14 +26684,12 @@ public:
 	class alignas(8) SWeaponViewData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SWeaponViewData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SWeaponViewData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SWeaponViewData& p_Other) const { return !(*this == p_Other); }
 
 		SWeaponStatusUIData weaponStatus; // 0x0
@@ -27274,14 +26715,12 @@ public:
 	class alignas(8) SData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SData& p_Other) const { return !(*this == p_Other); }
 
 		bool isVisible; // 0x0
@@ -27403,14 +26842,14 @@ public:
 	class alignas(1) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		bool m_bStandingDown; // 0x0
@@ -27562,14 +27001,14 @@ public:
 	class alignas(4) SInteractionEventData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SInteractionEventData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SInteractionEventData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SInteractionEventData& p_Other) const { return !(*this == p_Other); }
 
 		ZInteractionEventConsumer::EEvent m_nEvent; // 0x0
@@ -27622,14 +27061,14 @@ public:
 	class alignas(8) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		int32 m_nCurrentState; // 0x0
@@ -27666,14 +27105,14 @@ public:
 	class alignas(16) SJumpToOrderSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SJumpToOrderSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SJumpToOrderSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SJumpToOrderSaveData& p_Other) const { return !(*this == p_Other); }
 
 		float4 m_vStopDirection; // 0x0
@@ -27693,14 +27132,12 @@ public:
 	class alignas(8) SCollection
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SCollection& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SCollection& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SCollection& p_Other) const { return !(*this == p_Other); }
 
 		TArray<int32> aKeywords; // 0x0
@@ -27982,14 +27419,12 @@ public:
 	class alignas(8) SUIInputData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SUIInputData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SUIInputData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SUIInputData& p_Other) const { return !(*this == p_Other); }
 
 		int32 actiontype; // 0x0
@@ -28040,14 +27475,14 @@ public:
 	class alignas(4) SInputData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SInputData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SInputData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SInputData& p_Other) const { return !(*this == p_Other); }
 
 		SVector2 PositionOffset; // 0x0
@@ -28066,14 +27501,14 @@ public:
 	class alignas(1) SInputState
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SInputState& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SInputState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SInputState& p_Other) const { return !(*this == p_Other); }
 
 		bool IsEnabled; // 0x0
@@ -28092,14 +27527,12 @@ public:
 	class alignas(8) SUIData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SUIData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SUIData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SUIData& p_Other) const { return !(*this == p_Other); }
 
 		TArray<ZOverlayControllerEntity::SUIInputData> buttonPromptInputs; // 0x0
@@ -28229,14 +27662,12 @@ public:
 	class alignas(8) SPrompt
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SPrompt& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SPrompt& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SPrompt& p_Other) const { return !(*this == p_Other); }
 
 		TArray<ZVariant> aIcons; // 0x0
@@ -28253,14 +27684,12 @@ public:
 	class alignas(8) SData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SData& p_Other) const { return !(*this == p_Other); }
 
 		bool bIsVisible; // 0x0
@@ -28279,14 +27708,12 @@ public:
 	class alignas(8) SMenuEntry
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SMenuEntry& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SMenuEntry& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SMenuEntry& p_Other) const { return !(*this == p_Other); }
 
 		ZString sLabel; // 0x0
@@ -28363,14 +27790,14 @@ public:
 	class alignas(4) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		uint32 m_rVictim; // 0x0
@@ -28440,14 +27867,14 @@ public:
 class alignas(8) ZRuntimePinConDesc
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
 
-	bool operator==(const ZRuntimePinConDesc& p_Other) const;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+	bool operator==(const ZRuntimePinConDesc& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZRuntimePinConDesc& p_Other) const { return !(*this == p_Other); }
 
 	uint64 m_nFromEntityID; // 0x0
@@ -28466,14 +27893,12 @@ static_assert(alignof(ZRuntimePinConDesc) == 0x8, "Wrong alignment for ZRuntimeP
 class alignas(8) ZScopedER64
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZScopedER64& p_Other) const;
+	bool operator==(const ZScopedER64& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZScopedER64& p_Other) const { return !(*this == p_Other); }
 
 	ZER64 m_er64; // 0x0
@@ -28488,14 +27913,12 @@ static_assert(alignof(ZScopedER64) == 0x8, "Wrong alignment for ZScopedER64");
 class alignas(8) ZScopedRuntimePinConDesc
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZScopedRuntimePinConDesc& p_Other) const;
+	bool operator==(const ZScopedRuntimePinConDesc& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZScopedRuntimePinConDesc& p_Other) const { return !(*this == p_Other); }
 
 	TArray<uint64> m_aScopePath; // 0x0
@@ -28520,14 +27943,14 @@ public:
 	class alignas(4) SHitmanVisibleEscalationRule
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SHitmanVisibleEscalationRule& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SHitmanVisibleEscalationRule& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SHitmanVisibleEscalationRule& p_Other) const { return !(*this == p_Other); }
 
 		int32 m_NrGuardsToSend; // 0x0
@@ -28542,14 +27965,14 @@ public:
 	class alignas(4) SDeadBodyVisibleEscalationRule
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SDeadBodyVisibleEscalationRule& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SDeadBodyVisibleEscalationRule& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SDeadBodyVisibleEscalationRule& p_Other) const { return !(*this == p_Other); }
 
 		int32 m_NrGuardsToSend; // 0x0
@@ -28567,14 +27990,12 @@ public:
 	class alignas(8) SIconData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SIconData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SIconData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SIconData& p_Other) const { return !(*this == p_Other); }
 
 		ZString iCategory; // 0x0
@@ -28650,14 +28071,14 @@ public:
 	class alignas(16) SSniperSuspiciousArea
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSniperSuspiciousArea& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSniperSuspiciousArea& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSniperSuspiciousArea& p_Other) const { return !(*this == p_Other); }
 
 		float4 m_vPosition; // 0x0
@@ -28682,14 +28103,12 @@ public:
 	class alignas(8) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		uint32 m_rSniperLocation; // 0x0
@@ -28755,14 +28174,12 @@ public:
 	class alignas(8) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		bool m_bStandingDown; // 0x0
@@ -28823,14 +28240,14 @@ public:
 	class alignas(16) SState
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SState& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SState& p_Other) const { return !(*this == p_Other); }
 
 		ZStandOffSituation::ESituationState m_eSituationState; // 0x0
@@ -28903,14 +28320,12 @@ public:
 	class alignas(16) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		ZStandOffSituation::SState m_State; // 0x0
@@ -28977,14 +28392,14 @@ public:
 class alignas(8) ZTime
 {
 public:
-	static ZHMTypeInfo TypeInfo;
-	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-	static bool Equals(void* p_Left, void* p_Right);
-	static void Destroy(void* p_Object);
+	static ZHMTableTypeInfo TypeInfo;
+	static constexpr bool IsRelocationFree = true;
+
+	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
 
-	bool operator==(const ZTime& p_Other) const;
+	bool operator==(const ZTime& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 	bool operator!=(const ZTime& p_Other) const { return !(*this == p_Other); }
 
 	uint64 m_nValue; // 0x0
@@ -29034,14 +28449,14 @@ public:
 	class alignas(8) SState
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SState& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SState& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SState& p_Other) const { return !(*this == p_Other); }
 
 		ZTrespassingSituation::ESituationState m_eSituationState; // 0x0
@@ -29062,14 +28477,14 @@ public:
 	class alignas(16) SSituationSaveData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SSituationSaveData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static constexpr bool IsRelocationFree = true;
+
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SSituationSaveData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SSituationSaveData& p_Other) const { return !(*this == p_Other); }
 
 		ZTrespassingSituation::SState m_State; // 0x0
@@ -29097,14 +28512,12 @@ public:
 	class alignas(4) SActionSelectorSlotDisplayInfoSlim
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SActionSelectorSlotDisplayInfoSlim& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SActionSelectorSlotDisplayInfoSlim& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SActionSelectorSlotDisplayInfoSlim& p_Other) const { return !(*this == p_Other); }
 
 		ZRuntimeResourceID icon; // 0x0
@@ -29117,14 +28530,12 @@ public:
 	class alignas(8) SActionSelectorInvokeData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SActionSelectorInvokeData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SActionSelectorInvokeData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SActionSelectorInvokeData& p_Other) const { return !(*this == p_Other); }
 
 		TArray<ZUIActionSelectorNavigationInventoryEntity::SActionSelectorSlotDisplayInfoSlim> mainslotsSlim; // 0x0
@@ -29235,14 +28646,12 @@ public:
 	class alignas(4) SActionSelectorSlotDisplayInfoSlim
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SActionSelectorSlotDisplayInfoSlim& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SActionSelectorSlotDisplayInfoSlim& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SActionSelectorSlotDisplayInfoSlim& p_Other) const { return !(*this == p_Other); }
 
 		ZRuntimeResourceID icon; // 0x0
@@ -29255,14 +28664,12 @@ public:
 	class alignas(8) SActionSelectorInvokeData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SActionSelectorInvokeData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SActionSelectorInvokeData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SActionSelectorInvokeData& p_Other) const { return !(*this == p_Other); }
 
 		TArray<ZUIEmoteSelectorNavigationEntity::SActionSelectorSlotDisplayInfoSlim> mainslotsSlim; // 0x0
@@ -29328,14 +28735,12 @@ public:
 	class alignas(8) SLegendTracker
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SLegendTracker& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SLegendTracker& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SLegendTracker& p_Other) const { return !(*this == p_Other); }
 
 		ZString ControlName; // 0x0
@@ -29348,14 +28753,12 @@ public:
 	class alignas(8) SData
 	{
 	public:
-		static ZHMTypeInfo TypeInfo;
-		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
-		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
-		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
-		static bool Equals(void* p_Left, void* p_Right);
-		static void Destroy(void* p_Object);
-
-		bool operator==(const SData& p_Other) const;
+		static ZHMTableTypeInfo TypeInfo;
+		static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) { TypeInfo.WriteSimpleJson(p_Object, p_Stream); }
+		static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target) { TypeInfo.CreateFromJson(p_Document, p_Target); }
+		static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TypeInfo.Serialize(p_Object, p_Serializer, p_OwnOffset); }
+
+		bool operator==(const SData& p_Other) const { return TypeInfo.FieldsEqual(this, &p_Other); }
 		bool operator!=(const SData& p_Other) const { return !(*this == p_Other); }
 
 		ZString Location; // 0x0
@@ -10,10 +10,12 @@
 
 std::unordered_map<std::string, std::unordered_map<int32_t, std::string>>* ZHMEnums::g_Enums = nullptr;
 std::unordered_map<std::string, uint32_t>* ZHMEnums::g_EnumSizes = nullptr;
-ZHMEnums::EnumRegistrar ZHMEnums::g_Registrar;
+std::once_flag ZHMEnums::g_EnumsRegistered;
 
 std::string ZHMEnums::GetEnumValueName(const std::string& p_TypeName, int32_t p_Value)
 {
+	std::call_once(g_EnumsRegistered, RegisterEnums);
+
 	auto s_EnumIt = g_Enums->find(p_TypeName);
 
 	if (s_EnumIt == g_Enums->end())
@@ -29,6 +31,8 @@ std::string ZHMEnums::GetEnumValueName(const std::string& p_TypeName, int32_t p_
 
 int32_t ZHMEnums::GetEnumValueByName(const std::string& p_TypeName, std::string_view p_Name)
 {
+	std::call_once(g_EnumsRegistered, RegisterEnums);
+
 	auto s_EnumIt = g_Enums->find(p_TypeName);
 
 	if (s_EnumIt == g_Enums->end())
@@ -43,11 +47,15 @@ int32_t ZHMEnums::GetEnumValueByName(const std::string& p_TypeName, std::string_
 
 bool ZHMEnums::IsTypeNameEnum(const std::string& p_TypeName)
 {
+	std::call_once(g_EnumsRegistered, RegisterEnums);
+
 	return g_Enums->find(p_TypeName) != g_Enums->end();
 }
 
 uint32_t ZHMEnums::GetEnumSize(const std::string& p_TypeName)
 {
+	std::call_once(g_EnumsRegistered, RegisterEnums);
+
 	auto s_It = g_EnumSizes->find(p_TypeName);
 
 	if (s_It == g_EnumSizes->end())
@@ -8,14 +8,13 @@
 #pragma once
 
 #include <cstdint>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 #include <string>
 
 #include <ZHM/Hash.h>
 
-struct ZHMPropertyRegistrar;
-
 class ZHMProperties
 {
 public:
@@ -25,23 +24,12 @@ public:
 private:
 	static void RegisterProperties();
 	static std::unordered_map<uint32_t, std::string_view>* g_Properties;
+	static std::once_flag g_PropertiesRegistered;
 	static const uint8_t g_PropertiesData[];
 	static const size_t g_PropertiesDataSize;
 	static const size_t g_PropertiesCount;
 	static const uint8_t g_CustomPropertiesData[];
 	static const size_t g_CustomPropertiesDataSize;
 	static const size_t g_CustomPropertiesCount;
-
-	friend class ZHMPropertyRegistrar;
-};
-
-struct ZHMPropertyRegistrar
-{
-	ZHMPropertyRegistrar()
-	{
-		ZHMProperties::RegisterProperties();
-	}
 };
 
-extern ZHMPropertyRegistrar g_PropertyRegistrar;
-
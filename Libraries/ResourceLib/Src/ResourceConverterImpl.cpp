@@ -3,11 +3,14 @@
 #include <filesystem>
 
 #include <Util/BinaryStreamReader.h>
+#include <ResourceTrace.h>
 #include <ZHM/ZHMTypeInfo.h>
 #include <ZHM/ZHMPrimitives.h>
 
 void ProcessRelocations(BinaryStreamReader& p_SegmentStream, BinaryStreamReader& p_ResourceStream)
 {
+	ResourceTraceScope s_Trace("Relocations", "Relocation");
+
 	const auto s_RelocationCount = p_SegmentStream.Read<uint32_t>();
 
 	for (uint32_t i = 0; i < s_RelocationCount; ++i)
@@ -30,6 +33,8 @@ void ProcessRelocations(BinaryStreamReader& p_SegmentStream, BinaryStreamReader&
 
 void ProcessTypeIds(BinaryStreamReader& p_SegmentStream, BinaryStreamReader& p_ResourceStream)
 {
+	ResourceTraceScope s_Trace("TypeIdPatching", "Relocation");
+
 	const uintptr_t s_StartOffset = p_SegmentStream.Position();
 	
 	const auto s_TypeIdsToPatchCount = p_SegmentStream.Read<uint32_t>();
@@ -88,6 +93,8 @@ void ProcessTypeIds(BinaryStreamReader& p_SegmentStream, BinaryStreamReader& p_R
 
 void ProcessRuntimeResourceIds(BinaryStreamReader& p_SegmentStream, BinaryStreamReader& p_ResourceStream)
 {
+	ResourceTraceScope s_Trace("RuntimeResourceIds", "Relocation");
+
 	const auto s_ResourceIdCount = p_SegmentStream.Read<uint32_t>();
 
 	for (uint32_t i = 0; i < s_ResourceIdCount; ++i)
@@ -100,6 +107,8 @@ void ProcessRuntimeResourceIds(BinaryStreamReader& p_SegmentStream, BinaryStream
 
 void ProcessResourcePtrs(BinaryStreamReader& p_SegmentStream, BinaryStreamReader& p_ResourceStream)
 {
+	ResourceTraceScope s_Trace("ResourcePtrs", "Relocation");
+
 	const auto s_ResourcePtrCount = p_SegmentStream.Read<uint32_t>();
 
 	for (uint32_t i = 0; i < s_ResourcePtrCount; ++i)
@@ -112,6 +121,8 @@ void ProcessResourcePtrs(BinaryStreamReader& p_SegmentStream, BinaryStreamReader
 
 void* ToInMemStructure(const void* p_ResourceData, size_t p_Size)
 {
+	ResourcePhaseScope s_Phase(ResourcePhase_Relocation);
+
 	// Parse the resource header.
 	BinaryStreamReader s_Stream(p_ResourceData, p_Size);
 
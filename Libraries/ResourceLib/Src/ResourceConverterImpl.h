@@ -1,22 +1,29 @@
 #pragma once
 
 #include "Resources.h"
+#include "ResourceStats.h"
 
 #include <fstream>
 #include <filesystem>
+#include <memory>
+#include <optional>
 #include <sstream>
 
 #include <ResourceConverter.h>
 #include <ResourceLibCommon.h>
 
+#include <Util/BinarySidecar.h>
 #include <Util/PortableIntrinsics.h>
 #include <Util/BinaryStreamReader.h>
+#include <Util/BinaryStreamWriter.h>
+#include <ZHM/ZHMCbor.h>
 
 extern void ProcessRelocations(BinaryStreamReader& p_SegmentStream, BinaryStreamReader& p_ResourceStream);
 extern void ProcessTypeIds(BinaryStreamReader& p_SegmentStream, BinaryStreamReader& p_ResourceStream);
 extern void ProcessRuntimeResourceIds(BinaryStreamReader& p_SegmentStream, BinaryStreamReader& p_ResourceStream);
 extern void* ToInMemStructure(const void* p_ResourceData, size_t p_Size);
 extern void FreeJsonString(JsonString* p_JsonString);
+extern void FreeResourceMem(ResourceMem* p_ResourceMem);
 
 template <class T>
 bool ToJsonStream(const void* p_ResourceData, size_t p_Size, std::ostream& p_Stream)
@@ -28,54 +35,68 @@ bool ToJsonStream(const void* p_ResourceData, size_t p_Size, std::ostream& p_Str
 		return false;
 	}
 
+	// Cancelled jobs stop by throwing, so this has to be freed however we leave.
+	const std::unique_ptr<void, decltype(&c_aligned_free)> s_StructureOwner(s_StructureData, c_aligned_free);
+
+	ResourcePhaseScope s_Phase(ResourcePhase_JsonWrite);
+
 	// Everything should be properly reconstructed in memory by now
 	// so just cast and convert this type to json.
 	p_Stream << std::boolalpha;
-	p_Stream.precision(std::numeric_limits<double>::max_digits10);
 
 	auto* s_Resource = static_cast<T*>(s_StructureData);
 
 	T::WriteSimpleJson(s_Resource, p_Stream);
-	c_aligned_free(s_StructureData);
 
 	return true;
 }
 
-template <class T>
+template <class T, ResourceName Name>
 bool FromMemoryToJsonFile(const void* p_ResourceData, size_t p_Size, const char* p_OutputFilePath)
 {
+	ResourceStatsContext s_Stats(Name.Value, EResourceOperation::Conversion);
+
+	// Large binary fields go to the sidecar file, if enabled.
+	std::optional<BinarySidecarWriter> s_Sidecar;
+
+	if (const auto s_Threshold = BinarySidecar::Threshold())
+		s_Sidecar.emplace(BinarySidecar::PathFor(p_OutputFilePath), s_Threshold);
+
 	std::ofstream s_OutputStream(p_OutputFilePath, std::ios::out);
 	return ToJsonStream<T>(p_ResourceData, p_Size, s_OutputStream);
 }
 
-template <class T>
+template <class T, ResourceName Name>
 bool FromResourceFileToJsonFile(const char* p_ResourceFilePath, const char* p_OutputFilePath)
 {
+	ResourceStatsContext s_Stats(Name.Value, EResourceOperation::Conversion);
+
 	if (!std::filesystem::is_regular_file(p_ResourceFilePath))
 		return false;
 	
 	// Read the entire file to memory.
+	std::optional<ResourcePhaseScope> s_ReadPhase(ResourcePhase_FileIO);
+
 	const auto s_FileSize = std::filesystem::file_size(p_ResourceFilePath);
 	std::ifstream s_FileStream(p_ResourceFilePath, std::ios::in | std::ios::binary);
 
 	if (!s_FileStream)
 		return false;
 
-	void* s_FileData = c_aligned_alloc(s_FileSize, alignof(char));
-	s_FileStream.read(static_cast<char*>(s_FileData), s_FileSize);
+	const std::unique_ptr<void, decltype(&c_aligned_free)> s_FileData(c_aligned_alloc(s_FileSize, alignof(char)), c_aligned_free);
+	s_FileStream.read(static_cast<char*>(s_FileData.get()), s_FileSize);
 
 	s_FileStream.close();
+	s_ReadPhase.reset();
 
-	auto s_Result = FromMemoryToJsonFile<T>(s_FileData, s_FileSize, p_OutputFilePath);
-
-	c_aligned_free(s_FileData);
-	
-	return s_Result;
+	return FromMemoryToJsonFile<T, Name>(s_FileData.get(), s_FileSize, p_OutputFilePath);
 }
 
-template <class T>
+template <class T, ResourceName Name>
 JsonString* FromMemoryToJsonString(const void* p_ResourceData, size_t p_Size)
 {
+	ResourceStatsContext s_Stats(Name.Value, EResourceOperation::Conversion);
+
 	std::ostringstream s_Stream;
 
 	if (!ToJsonStream<T>(p_ResourceData, p_Size, s_Stream))
@@ -98,42 +119,104 @@ JsonString* FromMemoryToJsonString(const void* p_ResourceData, size_t p_Size)
 	return s_JsonString;
 }
 
-template <class T>
+template <class T, ResourceName Name>
 JsonString* FromResourceFileToJsonString(const char* p_ResourceFilePath)
 {
+	ResourceStatsContext s_Stats(Name.Value, EResourceOperation::Conversion);
+
 	if (!std::filesystem::is_regular_file(p_ResourceFilePath))
 		return nullptr;
 
 	// Read the entire file to memory.
+	std::optional<ResourcePhaseScope> s_ReadPhase(ResourcePhase_FileIO);
+
 	const auto s_FileSize = std::filesystem::file_size(p_ResourceFilePath);
 	std::ifstream s_FileStream(p_ResourceFilePath, std::ios::in | std::ios::binary);
 
 	if (!s_FileStream)
 		return nullptr;
 
-	void* s_FileData = c_aligned_alloc(s_FileSize, alignof(char));
-	s_FileStream.read(static_cast<char*>(s_FileData), s_FileSize);
+	const std::unique_ptr<void, decltype(&c_aligned_free)> s_FileData(c_aligned_alloc(s_FileSize, alignof(char)), c_aligned_free);
+	s_FileStream.read(static_cast<char*>(s_FileData.get()), s_FileSize);
 
 	s_FileStream.close();
+	s_ReadPhase.reset();
+
+	return FromMemoryToJsonString<T, Name>(s_FileData.get(), s_FileSize);
+}
+
+template <class T>
+bool ToCborStream(const void* p_ResourceData, size_t p_Size, BinaryStreamWriter& p_Stream)
+{
+	auto s_StructureData = ToInMemStructure(p_ResourceData, p_Size);
+
+	if (!s_StructureData)
+	{
+		return false;
+	}
 
-	auto s_Result = FromMemoryToJsonString<T>(s_FileData, s_FileSize);
+	// Cancelled jobs stop by throwing, so this has to be freed however we leave.
+	const std::unique_ptr<void, decltype(&c_aligned_free)> s_StructureOwner(s_StructureData, c_aligned_free);
 
-	c_aligned_free(s_FileData);
+	ResourcePhaseScope s_Phase(ResourcePhase_JsonWrite);
 
-	return s_Result;
+	CborWriter s_Writer(p_Stream);
+	ZHMCbor<T>::Write(s_StructureData, s_Writer);
+
+	return true;
 }
 
+template <class T, ResourceName Name>
+ResourceMem* FromMemoryToCbor(const void* p_ResourceData, size_t p_Size)
+{
+	ResourceStatsContext s_Stats(Name.Value, EResourceOperation::Conversion);
+
+	BinaryStreamWriter s_Writer;
 
-template <class T>
+	if (!ToCborStream<T>(p_ResourceData, p_Size, s_Writer))
+		return nullptr;
+
+	auto* s_ResourceMem = new ResourceMem();
+
+	s_ResourceMem->ResourceData = c_aligned_alloc(s_Writer.WrittenBytes(), alignof(char));
+	s_ResourceMem->DataSize = s_Writer.WrittenBytes();
+
+	memcpy(const_cast<void*>(s_ResourceMem->ResourceData), s_Writer.Buffer(), s_Writer.WrittenBytes());
+
+	return s_ResourceMem;
+}
+
+template <class T, ResourceName Name>
+bool FromMemoryToCborFile(const void* p_ResourceData, size_t p_Size, const char* p_OutputFilePath)
+{
+	ResourceStatsContext s_Stats(Name.Value, EResourceOperation::Conversion);
+
+	BinaryStreamWriter s_Writer;
+
+	if (!ToCborStream<T>(p_ResourceData, p_Size, s_Writer))
+		return false;
+
+	ResourcePhaseScope s_Phase(ResourcePhase_FileIO);
+
+	std::ofstream s_OutputStream(p_OutputFilePath, std::ios::out | std::ios::binary);
+	s_OutputStream.write(static_cast<const char*>(s_Writer.Buffer()), s_Writer.WrittenBytes());
+
+	return static_cast<bool>(s_OutputStream);
+}
+
+template <class T, ResourceName Name>
 ResourceConverter* CreateResourceConverter()
 {
 	auto* s_Converter = new ResourceConverter();
 
-	s_Converter->FromResourceFileToJsonFile = FromResourceFileToJsonFile<T>;
-	s_Converter->FromMemoryToJsonFile = FromMemoryToJsonFile<T>;
-	s_Converter->FromResourceFileToJsonString = FromResourceFileToJsonString<T>;
-	s_Converter->FromMemoryToJsonString = FromMemoryToJsonString<T>;
+	s_Converter->FromResourceFileToJsonFile = FromResourceFileToJsonFile<T, Name>;
+	s_Converter->FromMemoryToJsonFile = FromMemoryToJsonFile<T, Name>;
+	s_Converter->FromResourceFileToJsonString = FromResourceFileToJsonString<T, Name>;
+	s_Converter->FromMemoryToJsonString = FromMemoryToJsonString<T, Name>;
 	s_Converter->FreeJsonString = FreeJsonString;
+	s_Converter->FromMemoryToCbor = FromMemoryToCbor<T, Name>;
+	s_Converter->FromMemoryToCborFile = FromMemoryToCborFile<T, Name>;
+	s_Converter->FreeResourceMem = FreeResourceMem;
 
 	return s_Converter;
 }
@@ -1,18 +1,23 @@
 #pragma once
 
 #include "Resources.h"
+#include "ResourceStats.h"
 
 #include <cstdio>
 #include <string>
+#include <optional>
 #include <filesystem>
 
 #include <ResourceGenerator.h>
 #include <ResourceLibCommon.h>
 
 #include <External/simdjson.h>
+#include <Util/BinarySidecar.h>
 #include <Util/PortableIntrinsics.h>
 #include <Util/BinaryStreamWriter.h>
+#include <ZHM/ZHMCbor.h>
 #include <ZHM/ZHMSerializer.h>
+#include <ZHM/ZStringPool.h>
 
 extern void FreeResourceMem(ResourceMem* p_ResourceMem);
 
@@ -42,16 +47,22 @@ bool GenerateFromMemory(void* p_Memory, std::filesystem::path p_OutputPath, bool
 	const auto s_OutputPath = absolute(p_OutputPath);
 
 	// Start serializing.
+	std::optional<ResourcePhaseScope> s_Phase(ResourcePhase_Serialize);
+
 	ZHMSerializer s_Serializer(alignof(T), p_GenerateCompatible);
 	auto s_BaseOffset = s_Serializer.WriteMemory(p_Memory, sizeof(T), alignof(T));
 
 	T::Serialize(p_Memory, s_Serializer, s_BaseOffset);
 
 	// Get serialized data and segments.
+	s_Phase.emplace(ResourcePhase_SegmentGeneration);
+
 	const auto s_SerializedData = s_Serializer.GetBuffer();
 	auto s_Segments = s_Serializer.GenerateSegments();
 
 	// Write to BIN1 file.
+	s_Phase.emplace(ResourcePhase_FileIO);
+
 #ifdef _WIN32
 	FILE* s_OutputFile = nullptr;
 	auto s_Error = fopen_s(&s_OutputFile, s_OutputPath.string().c_str(), "wb");
@@ -98,12 +109,16 @@ template <class T>
 ResourceMem* GenerateFromMemoryToMemory(void* p_Memory, bool p_GenerateCompatible)
 {
 	// Start serializing.
+	std::optional<ResourcePhaseScope> s_Phase(ResourcePhase_Serialize);
+
 	ZHMSerializer s_Serializer(alignof(T), p_GenerateCompatible);
 	auto s_BaseOffset = s_Serializer.WriteMemory(p_Memory, sizeof(T), alignof(T));
 
 	T::Serialize(p_Memory, s_Serializer, s_BaseOffset);
 
 	// Get serialized data and segments.
+	s_Phase.emplace(ResourcePhase_SegmentGeneration);
+
 	const auto s_SerializedData = s_Serializer.GetBuffer();
 	auto s_Segments = s_Serializer.GenerateSegments();
 
@@ -125,6 +140,8 @@ ResourceMem* GenerateFromMemoryToMemory(void* p_Memory, bool p_GenerateCompatibl
 		s_Writer.WriteBinary(s_Segment.Data.data(), s_Segment.Data.size());
 	}
 
+	s_Phase.reset();
+
 	auto* s_ResourceMem = new ResourceMem();
 
 	s_ResourceMem->ResourceData = c_aligned_alloc(s_Writer.WrittenBytes(), alignof(char));
@@ -135,21 +152,31 @@ ResourceMem* GenerateFromMemoryToMemory(void* p_Memory, bool p_GenerateCompatibl
 	return s_ResourceMem;
 }
 
-template <class T>
+template <class T, ResourceName Name>
 bool FromJsonFileToResourceFile(const char* p_JsonFilePath, const char* p_OutputPath, bool p_GenerateCompatible)
 {
+	ResourceStatsContext s_Stats(Name.Value, EResourceOperation::Generation);
+
 	const auto s_JsonFilePath = std::filesystem::absolute(p_JsonFilePath);
 
 	if (!is_regular_file(s_JsonFilePath))
 		return false;
 
 	// Load the input file as JSON.
+	std::optional<ResourcePhaseScope> s_Phase(ResourcePhase_FileIO);
+
 	simdjson::ondemand::parser s_Parser;
 	const auto s_Json = simdjson::padded_string::load(s_JsonFilePath.string());
 
+	s_Phase.emplace(ResourcePhase_JsonParse);
+
 	simdjson::ondemand::document s_Value = s_Parser.iterate(s_Json);
 
-	// Parse type from JSON.
+	// Parse type from JSON. Strings are pooled for the duration of the
+	// generation, so the pool must be destroyed after the resource.
+	// Large binary fields might be referencing the sidecar file of the json.
+	ZStringPool s_StringPool;
+	BinarySidecarReader s_Sidecar(BinarySidecar::PathFor(s_JsonFilePath));
 	T s_Resource {};
 
 	try
@@ -162,19 +189,27 @@ bool FromJsonFileToResourceFile(const char* p_JsonFilePath, const char* p_Output
 		throw std::runtime_error(std::string(p_Error.what()) + ". Last document location: " + std::to_string(*s_CurrentPosition));
 	}
 
+	s_Phase.reset();
+
 	return GenerateFromMemory<T>(&s_Resource, p_OutputPath, p_GenerateCompatible);
 }
 
-template <class T>
+template <class T, ResourceName Name>
 bool FromJsonStringToResourceFile(const char* p_JsonStr, size_t p_JsonStrLength, const char* p_OutputPath, bool p_GenerateCompatible)
 {
+	ResourceStatsContext s_Stats(Name.Value, EResourceOperation::Generation);
+
 	// Load the input data as JSON.
+	std::optional<ResourcePhaseScope> s_Phase(ResourcePhase_JsonParse);
+
 	simdjson::ondemand::parser s_Parser;
 	const auto s_Json = simdjson::padded_string(p_JsonStr, p_JsonStrLength);
 
 	simdjson::ondemand::document s_Value = s_Parser.iterate(s_Json);
 
-	// Parse type from JSON.
+	// Parse type from JSON. Strings are pooled for the duration of the
+	// generation, so the pool must be destroyed after the resource.
+	ZStringPool s_StringPool;
 	T s_Resource {};
 
 	try
@@ -187,24 +222,36 @@ bool FromJsonStringToResourceFile(const char* p_JsonStr, size_t p_JsonStrLength,
 		throw std::runtime_error(std::string(p_Error.what()) + ". Last document location: " + std::to_string(*s_CurrentPosition));
 	}
 
+	s_Phase.reset();
+
 	return GenerateFromMemory<T>(&s_Resource, p_OutputPath, p_GenerateCompatible);
 }
 
-template <class T>
+template <class T, ResourceName Name>
 ResourceMem* FromJsonFileToResourceMem(const char* p_JsonFilePath, bool p_GenerateCompatible)
 {
+	ResourceStatsContext s_Stats(Name.Value, EResourceOperation::Generation);
+
 	const auto s_JsonFilePath = std::filesystem::absolute(p_JsonFilePath);
 
 	if (!is_regular_file(s_JsonFilePath))
 		return nullptr;
 
 	// Load the input file as JSON.
+	std::optional<ResourcePhaseScope> s_Phase(ResourcePhase_FileIO);
+
 	simdjson::ondemand::parser s_Parser;
 	const auto s_Json = simdjson::padded_string::load(s_JsonFilePath.string());
 
+	s_Phase.emplace(ResourcePhase_JsonParse);
+
 	simdjson::ondemand::document s_Value = s_Parser.iterate(s_Json);
 
-	// Parse type from JSON.
+	// Parse type from JSON. Strings are pooled for the duration of the
+	// generation, so the pool must be destroyed after the resource.
+	// Large binary fields might be referencing the sidecar file of the json.
+	ZStringPool s_StringPool;
+	BinarySidecarReader s_Sidecar(BinarySidecar::PathFor(s_JsonFilePath));
 	T s_Resource {};
 
 	try
@@ -217,19 +264,27 @@ ResourceMem* FromJsonFileToResourceMem(const char* p_JsonFilePath, bool p_Genera
 		throw std::runtime_error(std::string(p_Error.what()) + ". Last document location: " + std::to_string(*s_CurrentPosition));
 	}
 
+	s_Phase.reset();
+
 	return GenerateFromMemoryToMemory<T>(&s_Resource, p_GenerateCompatible);
 }
 
-template <class T>
+template <class T, ResourceName Name>
 ResourceMem* FromJsonStringToResourceMem(const char* p_JsonStr, size_t p_JsonStrLength, bool p_GenerateCompatible)
 {
+	ResourceStatsContext s_Stats(Name.Value, EResourceOperation::Generation);
+
 	// Load the input data as JSON.
+	std::optional<ResourcePhaseScope> s_Phase(ResourcePhase_JsonParse);
+
 	simdjson::ondemand::parser s_Parser;
 	const auto s_Json = simdjson::padded_string(p_JsonStr, p_JsonStrLength);
 
 	simdjson::ondemand::document s_Value = s_Parser.iterate(s_Json);
 
-	// Parse type from JSON.
+	// Parse type from JSON. Strings are pooled for the duration of the
+	// generation, so the pool must be destroyed after the resource.
+	ZStringPool s_StringPool;
 	T s_Resource {};
 
 	try
@@ -242,20 +297,71 @@ ResourceMem* FromJsonStringToResourceMem(const char* p_JsonStr, size_t p_JsonStr
 		throw std::runtime_error(std::string(p_Error.what()) + ". Last document location: " + std::to_string(*s_CurrentPosition));
 	}
 
+	s_Phase.reset();
+
 	return GenerateFromMemoryToMemory<T>(&s_Resource, p_GenerateCompatible);
 }
 
+template <class T>
+void FromCbor(const void* p_CborData, size_t p_CborSize, T& p_Resource)
+{
+	CborReader s_Reader(p_CborData, p_CborSize);
+	ZHMCbor<T>::Read(s_Reader, &p_Resource);
+
+	if (!s_Reader.AtEnd())
+		throw std::runtime_error("Unexpected data after the end of the CBOR document.");
+}
+
+template <class T, ResourceName Name>
+bool FromCborToResourceFile(const void* p_CborData, size_t p_CborSize, const char* p_OutputPath, bool p_GenerateCompatible)
+{
+	ResourceStatsContext s_Stats(Name.Value, EResourceOperation::Generation);
+
+	std::optional<ResourcePhaseScope> s_Phase(ResourcePhase_JsonParse);
+
+	// Strings are pooled for the duration of the generation, so the pool
+	// must be destroyed after the resource.
+	ZStringPool s_StringPool;
+	T s_Resource {};
+
+	FromCbor(p_CborData, p_CborSize, s_Resource);
+
+	s_Phase.reset();
+
+	return GenerateFromMemory<T>(&s_Resource, p_OutputPath, p_GenerateCompatible);
+}
+
+template <class T, ResourceName Name>
+ResourceMem* FromCborToResourceMem(const void* p_CborData, size_t p_CborSize, bool p_GenerateCompatible)
+{
+	ResourceStatsContext s_Stats(Name.Value, EResourceOperation::Generation);
+
+	std::optional<ResourcePhaseScope> s_Phase(ResourcePhase_JsonParse);
+
+	// Strings are pooled for the duration of the generation, so the pool
+	// must be destroyed after the resource.
+	ZStringPool s_StringPool;
+	T s_Resource {};
+
+	FromCbor(p_CborData, p_CborSize, s_Resource);
+
+	s_Phase.reset();
+
+	return GenerateFromMemoryToMemory<T>(&s_Resource, p_GenerateCompatible);
+}
 
-template <typename T>
+template <typename T, ResourceName Name>
 ResourceGenerator* CreateResourceGenerator()
 {
 	auto* s_Generator = new ResourceGenerator();
 
-	s_Generator->FromJsonFileToResourceFile = FromJsonFileToResourceFile<T>;
-	s_Generator->FromJsonStringToResourceFile = FromJsonStringToResourceFile<T>;
-	s_Generator->FromJsonFileToResourceMem = FromJsonFileToResourceMem<T>;
-	s_Generator->FromJsonStringToResourceMem = FromJsonStringToResourceMem<T>;
+	s_Generator->FromJsonFileToResourceFile = FromJsonFileToResourceFile<T, Name>;
+	s_Generator->FromJsonStringToResourceFile = FromJsonStringToResourceFile<T, Name>;
+	s_Generator->FromJsonFileToResourceMem = FromJsonFileToResourceMem<T, Name>;
+	s_Generator->FromJsonStringToResourceMem = FromJsonStringToResourceMem<T, Name>;
 	s_Generator->FreeResourceMem = FreeResourceMem;
+	s_Generator->FromCborToResourceFile = FromCborToResourceFile<T, Name>;
+	s_Generator->FromCborToResourceMem = FromCborToResourceMem<T, Name>;
 
 	return s_Generator;
 }
\ No newline at end of file
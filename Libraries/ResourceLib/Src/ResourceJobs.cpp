@@ -0,0 +1,265 @@
+#include "ResourceJobs.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <Util/JobProgress.h>
+#include <Util/WorkerPool.h>
+
+extern void FreeJsonString(JsonString* p_JsonString);
+extern void FreeResourceMem(ResourceMem* p_ResourceMem);
+
+struct ResourceJobState
+{
+	ResourceJobWork Work;
+	ResourceJobCallback Callback;
+	void* UserData;
+
+	JobProgress Progress;
+
+	// Everything below is guarded by the mutex.
+	std::mutex Mutex;
+	std::condition_variable DoneCondition;
+	ResourceJobStatus Status = ResourceJobStatus_Queued;
+	std::string Error;
+	ResourceJobResults Results;
+
+	~ResourceJobState()
+	{
+		// Results that were never taken by the caller.
+		if (Results.Json)
+			FreeJsonString(Results.Json);
+
+		if (Results.Resource)
+			FreeResourceMem(Results.Resource);
+	}
+};
+
+// The handle given out to callers. The state outlives it while the job is still queued or running.
+struct ResourceJob
+{
+	std::shared_ptr<ResourceJobState> State;
+};
+
+class ResourceJobQueue
+{
+public:
+	void Push(std::shared_ptr<ResourceJobState> p_Job)
+	{
+		{
+			std::scoped_lock s_Lock(m_Mutex);
+			m_Jobs.push_back(std::move(p_Job));
+
+			// Jobs run concurrently on as many threads as the worker pool is allowed to use. Threads are only started
+			// when there's more queued work than idle threads to pick it up.
+			const auto s_MaxThreads = std::max<size_t>(1, WorkerPool::ThreadCount());
+
+			if (m_IdleThreads < m_Jobs.size() && m_Threads.size() < s_MaxThreads)
+				m_Threads.emplace_back([this]() { ThreadLoop(); });
+		}
+
+		m_JobCondition.notify_one();
+	}
+
+private:
+	void ThreadLoop()
+	{
+		while (true)
+		{
+			std::shared_ptr<ResourceJobState> s_Job;
+
+			{
+				std::unique_lock s_Lock(m_Mutex);
+
+				++m_IdleThreads;
+				m_JobCondition.wait(s_Lock, [&]() { return !m_Jobs.empty(); });
+				--m_IdleThreads;
+
+				s_Job = std::move(m_Jobs.front());
+				m_Jobs.pop_front();
+			}
+
+			Run(*s_Job);
+		}
+	}
+
+	static void Run(ResourceJobState& p_Job)
+	{
+		ResourceJobStatus s_Status = ResourceJobStatus_Succeeded;
+		std::string s_Error;
+		ResourceJobResults s_Results;
+
+		{
+			std::scoped_lock s_Lock(p_Job.Mutex);
+
+			// Jobs cancelled while they were queued never start.
+			if (!p_Job.Progress.IsCancelled())
+				p_Job.Status = ResourceJobStatus_Running;
+		}
+
+		if (p_Job.Progress.IsCancelled())
+		{
+			s_Status = ResourceJobStatus_Cancelled;
+		}
+		else
+		{
+			JobProgress::Scope s_ProgressScope(&p_Job.Progress);
+
+			try
+			{
+				if (!p_Job.Work(s_Results))
+				{
+					s_Status = ResourceJobStatus_Failed;
+					s_Error = "The resource could not be converted.";
+				}
+			}
+			catch (std::exception& p_Exception)
+			{
+				s_Status = ResourceJobStatus_Failed;
+				s_Error = p_Exception.what();
+			}
+			catch (...)
+			{
+				s_Status = ResourceJobStatus_Failed;
+				s_Error = "An unknown error occurred while converting the resource.";
+			}
+
+			// Whatever was thrown after a cancellation is most likely a consequence of it.
+			if (s_Status == ResourceJobStatus_Failed && p_Job.Progress.IsCancelled())
+				s_Status = ResourceJobStatus_Cancelled;
+		}
+
+		// The work is done, so anything captured by it can go.
+		p_Job.Work = nullptr;
+
+		{
+			std::scoped_lock s_Lock(p_Job.Mutex);
+
+			p_Job.Status = s_Status;
+			p_Job.Error = std::move(s_Error);
+			p_Job.Results = s_Results;
+		}
+
+		p_Job.DoneCondition.notify_all();
+
+		if (p_Job.Callback)
+			p_Job.Callback(s_Status, p_Job.UserData);
+	}
+
+private:
+	std::mutex m_Mutex;
+	std::condition_variable m_JobCondition;
+	std::deque<std::shared_ptr<ResourceJobState>> m_Jobs;
+	std::vector<std::thread> m_Threads;
+	size_t m_IdleThreads = 0;
+};
+
+static ResourceJobQueue& GetResourceJobQueue()
+{
+	// This is intentionally never destroyed, for the same reason as the worker pool.
+	static auto* s_Queue = new ResourceJobQueue();
+	return *s_Queue;
+}
+
+static bool IsFinished(ResourceJobStatus p_Status)
+{
+	return p_Status != ResourceJobStatus_Queued && p_Status != ResourceJobStatus_Running;
+}
+
+ResourceJob* SubmitResourceJob(ResourceJobWork p_Work, ResourceJobCallback p_Callback, void* p_UserData)
+{
+	auto s_State = std::make_shared<ResourceJobState>();
+
+	s_State->Work = std::move(p_Work);
+	s_State->Callback = p_Callback;
+	s_State->UserData = p_UserData;
+
+	auto* s_Job = new ResourceJob();
+	s_Job->State = s_State;
+
+	GetResourceJobQueue().Push(std::move(s_State));
+
+	return s_Job;
+}
+
+ResourceJobStatus PollResourceJob(ResourceJob* p_Job, ResourceJobProgress* p_Progress)
+{
+	auto& s_State = *p_Job->State;
+
+	std::scoped_lock s_Lock(s_State.Mutex);
+
+	if (p_Progress)
+	{
+		p_Progress->Status = s_State.Status;
+		p_Progress->Phase = s_State.Progress.Phase();
+		p_Progress->CompletedElements = s_State.Progress.CompletedElements();
+		p_Progress->TotalElements = s_State.Progress.TotalElements();
+	}
+
+	return s_State.Status;
+}
+
+ResourceJobStatus WaitForResourceJob(ResourceJob* p_Job, uint32_t p_TimeoutMs)
+{
+	auto& s_State = *p_Job->State;
+
+	std::unique_lock s_Lock(s_State.Mutex);
+
+	if (p_TimeoutMs == UINT32_MAX)
+		s_State.DoneCondition.wait(s_Lock, [&]() { return IsFinished(s_State.Status); });
+	else
+		s_State.DoneCondition.wait_for(s_Lock, std::chrono::milliseconds(p_TimeoutMs), [&]() { return IsFinished(s_State.Status); });
+
+	return s_State.Status;
+}
+
+void CancelResourceJob(ResourceJob* p_Job)
+{
+	p_Job->State->Progress.Cancel();
+}
+
+const char* GetResourceJobError(ResourceJob* p_Job)
+{
+	auto& s_State = *p_Job->State;
+
+	std::scoped_lock s_Lock(s_State.Mutex);
+
+	if (s_State.Status != ResourceJobStatus_Failed)
+		return nullptr;
+
+	return s_State.Error.c_str();
+}
+
+JsonString* TakeResourceJobJsonString(ResourceJob* p_Job)
+{
+	auto& s_State = *p_Job->State;
+
+	std::scoped_lock s_Lock(s_State.Mutex);
+	return std::exchange(s_State.Results.Json, nullptr);
+}
+
+ResourceMem* TakeResourceJobResourceMem(ResourceJob* p_Job)
+{
+	auto& s_State = *p_Job->State;
+
+	std::scoped_lock s_Lock(s_State.Mutex);
+	return std::exchange(s_State.Results.Resource, nullptr);
+}
+
+void FreeResourceJob(ResourceJob* p_Job)
+{
+	if (p_Job == nullptr)
+		return;
+
+	// A job that's still running gets cleaned up by its thread once it stops.
+	p_Job->State->Progress.Cancel();
+	delete p_Job;
+}
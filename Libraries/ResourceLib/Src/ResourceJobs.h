@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include <ResourceLibCommon.h>
+
+/**
+ * The results of a resource job. A job's work fills in the one it produces and returns [true], or returns
+ * [false] if the conversion failed without throwing an exception.
+ */
+struct ResourceJobResults
+{
+	JsonString* Json = nullptr;
+	ResourceMem* Resource = nullptr;
+};
+
+using ResourceJobWork = std::function<bool(ResourceJobResults& p_Results)>;
+
+/**
+ * Queues [p_Work] to run on a background thread and returns a handle to it. See the [HMX_Submit*] functions
+ * for how jobs and their callbacks behave.
+ */
+ResourceJob* SubmitResourceJob(ResourceJobWork p_Work, ResourceJobCallback p_Callback, void* p_UserData);
+
+ResourceJobStatus PollResourceJob(ResourceJob* p_Job, ResourceJobProgress* p_Progress);
+ResourceJobStatus WaitForResourceJob(ResourceJob* p_Job, uint32_t p_TimeoutMs);
+void CancelResourceJob(ResourceJob* p_Job);
+const char* GetResourceJobError(ResourceJob* p_Job);
+JsonString* TakeResourceJobJsonString(ResourceJob* p_Job);
+ResourceMem* TakeResourceJobResourceMem(ResourceJob* p_Job);
+void FreeResourceJob(ResourceJob* p_Job);
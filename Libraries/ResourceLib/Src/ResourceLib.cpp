@@ -1,12 +1,24 @@
 #include "ResourceLib.h"
 
 #include "Resources.h"
+#include "ResourceJobs.h"
+#include "ResourceStats.h"
+#include "ResourceTrace.h"
 
 #include <cstring>
+#include <sstream>
+#include <string>
 
+#include "Util/BinarySidecar.h"
 #include "Util/PortableIntrinsics.h"
+#include "Util/WorkerPool.h"
 #include "ZHM/ZHMTypeInfo.h"
+#include "ZHM/ZHMSerializer.h"
 #include "ZHM/ZHMCustomProperties.h"
+#include "ZHM/ZHMSyntheticGenerator.h"
+#include "ZHM/ZHMTypeTables.h"
+
+extern void FreeResourceMem(ResourceMem* p_ResourceMem);
 
 static auto g_DefaultAllocator = new Allocator {
 	.Alloc = [](size_t p_Size, size_t p_Alignment) 
@@ -212,4 +224,207 @@ extern "C"
 		else
 			g_Allocator = p_Allocator;
 	}
+
+	ResourceMem* RL_TARGET_FUNC(SynthesizeResource)(const char* p_ResourceType, const char* p_TypesJsonPath, const SyntheticResourceOptions* p_Options)
+	{
+		if (p_ResourceType == nullptr || p_TypesJsonPath == nullptr || p_Options == nullptr)
+			return nullptr;
+
+		const auto it = g_Resources.find(p_ResourceType);
+
+		if (it == g_Resources.end())
+			return nullptr;
+
+		try
+		{
+			ZHMSyntheticGenerator s_Generator(*p_Options);
+			s_Generator.LoadTypes(p_TypesJsonPath);
+
+			std::ostringstream s_Stream;
+			s_Generator.WriteSimpleJson(it->second.TypeName, s_Stream);
+
+			// Go through the regular json -> binary path so the result is produced by the serializer
+			// exactly like any other generated resource.
+			const std::string s_Json = s_Stream.str();
+			return it->second.Generator->FromJsonStringToResourceMem(s_Json.c_str(), s_Json.size(), false);
+		}
+		catch (std::exception& p_Exception)
+		{
+			fprintf(stderr, "[ERROR] Could not synthesize %s resource: %s\n", p_ResourceType, p_Exception.what());
+			return nullptr;
+		}
+	}
+
+	void RL_TARGET_FUNC(FreeResourceMem)(ResourceMem* p_ResourceMem)
+	{
+		FreeResourceMem(p_ResourceMem);
+	}
+
+	void RL_TARGET_FUNC(SetPayloadDeduplicationEnabled)(bool p_Enabled)
+	{
+		ZHMSerializer::SetPayloadDeduplicationEnabled(p_Enabled);
+	}
+
+	void RL_TARGET_FUNC(SetBinarySidecarThreshold)(size_t p_MinSize)
+	{
+		BinarySidecar::SetThreshold(p_MinSize);
+	}
+
+	void RL_TARGET_FUNC(SetWorkerThreadCount)(size_t p_ThreadCount)
+	{
+		WorkerPool::SetThreadCount(p_ThreadCount);
+	}
+
+	int64_t RL_TARGET_FUNC(LoadTypes)(const char* p_TypesJsonPath)
+	{
+		if (p_TypesJsonPath == nullptr)
+			return -1;
+
+		try
+		{
+			return static_cast<int64_t>(ZHMTypeTables::LoadTypes(p_TypesJsonPath));
+		}
+		catch (std::exception& p_Exception)
+		{
+			fprintf(stderr, "[ERROR] Could not load types from %s: %s\n", p_TypesJsonPath, p_Exception.what());
+			return -1;
+		}
+	}
+
+	ResourceStatsArray* RL_TARGET_FUNC(GetStats)()
+	{
+		return GetResourceStats();
+	}
+
+	void RL_TARGET_FUNC(FreeStats)(ResourceStatsArray* p_Array)
+	{
+		FreeResourceStats(p_Array);
+	}
+
+	void RL_TARGET_FUNC(ResetStats)()
+	{
+		ResetResourceStats();
+	}
+
+	void RL_TARGET_FUNC(SetTracingEnabled)(bool p_Enabled)
+	{
+		SetTracingEnabled(p_Enabled);
+	}
+
+	JsonString* RL_TARGET_FUNC(GetTraceJson)()
+	{
+		const std::string s_Result = GetTraceJson();
+
+		auto* s_JsonString = new JsonString();
+
+		s_JsonString->StrSize = s_Result.size();
+		s_JsonString->JsonData = static_cast<const char*>(c_aligned_alloc(s_JsonString->StrSize + 1, alignof(char)));
+
+		// Copy over string data.
+		memcpy(const_cast<char*>(s_JsonString->JsonData), s_Result.c_str(), s_JsonString->StrSize);
+
+		// Add null terminator.
+		const_cast<char*>(s_JsonString->JsonData)[s_JsonString->StrSize] = 0;
+
+		return s_JsonString;
+	}
+
+	void RL_TARGET_FUNC(ClearTrace)()
+	{
+		ClearTraceEvents();
+	}
+
+	ResourceJob* RL_TARGET_FUNC(SubmitMemoryToJsonString)(const char* p_ResourceType, const void* p_ResourceData, size_t p_Size, ResourceJobCallback p_Callback, void* p_UserData)
+	{
+		auto* s_Converter = RL_TARGET_FUNC(GetConverterForResource)(p_ResourceType);
+
+		if (!s_Converter)
+			return nullptr;
+
+		// The caller is free to release their buffer once this returns, so the job works on its own copy.
+		std::string s_ResourceData(static_cast<const char*>(p_ResourceData), p_Size);
+
+		return SubmitResourceJob([s_Converter, s_ResourceData = std::move(s_ResourceData)](ResourceJobResults& p_Results)
+		{
+			p_Results.Json = s_Converter->FromMemoryToJsonString(s_ResourceData.data(), s_ResourceData.size());
+			return p_Results.Json != nullptr;
+		}, p_Callback, p_UserData);
+	}
+
+	ResourceJob* RL_TARGET_FUNC(SubmitResourceFileToJsonString)(const char* p_ResourceType, const char* p_ResourceFilePath, ResourceJobCallback p_Callback, void* p_UserData)
+	{
+		auto* s_Converter = RL_TARGET_FUNC(GetConverterForResource)(p_ResourceType);
+
+		if (!s_Converter)
+			return nullptr;
+
+		return SubmitResourceJob([s_Converter, s_ResourceFilePath = std::string(p_ResourceFilePath)](ResourceJobResults& p_Results)
+		{
+			p_Results.Json = s_Converter->FromResourceFileToJsonString(s_ResourceFilePath.c_str());
+			return p_Results.Json != nullptr;
+		}, p_Callback, p_UserData);
+	}
+
+	ResourceJob* RL_TARGET_FUNC(SubmitJsonStringToResourceMem)(const char* p_ResourceType, const char* p_JsonStr, size_t p_JsonStrLength, bool p_GenerateCompatible, ResourceJobCallback p_Callback, void* p_UserData)
+	{
+		auto* s_Generator = RL_TARGET_FUNC(GetGeneratorForResource)(p_ResourceType);
+
+		if (!s_Generator)
+			return nullptr;
+
+		return SubmitResourceJob([s_Generator, s_Json = std::string(p_JsonStr, p_JsonStrLength), p_GenerateCompatible](ResourceJobResults& p_Results)
+		{
+			p_Results.Resource = s_Generator->FromJsonStringToResourceMem(s_Json.c_str(), s_Json.size(), p_GenerateCompatible);
+			return p_Results.Resource != nullptr;
+		}, p_Callback, p_UserData);
+	}
+
+	ResourceJob* RL_TARGET_FUNC(SubmitJsonFileToResourceMem)(const char* p_ResourceType, const char* p_JsonFilePath, bool p_GenerateCompatible, ResourceJobCallback p_Callback, void* p_UserData)
+	{
+		auto* s_Generator = RL_TARGET_FUNC(GetGeneratorForResource)(p_ResourceType);
+
+		if (!s_Generator)
+			return nullptr;
+
+		return SubmitResourceJob([s_Generator, s_JsonFilePath = std::string(p_JsonFilePath), p_GenerateCompatible](ResourceJobResults& p_Results)
+		{
+			p_Results.Resource = s_Generator->FromJsonFileToResourceMem(s_JsonFilePath.c_str(), p_GenerateCompatible);
+			return p_Results.Resource != nullptr;
+		}, p_Callback, p_UserData);
+	}
+
+	ResourceJobStatus RL_TARGET_FUNC(PollJob)(ResourceJob* p_Job, ResourceJobProgress* p_Progress)
+	{
+		return PollResourceJob(p_Job, p_Progress);
+	}
+
+	ResourceJobStatus RL_TARGET_FUNC(WaitForJob)(ResourceJob* p_Job, uint32_t p_TimeoutMs)
+	{
+		return WaitForResourceJob(p_Job, p_TimeoutMs);
+	}
+
+	void RL_TARGET_FUNC(CancelJob)(ResourceJob* p_Job)
+	{
+		CancelResourceJob(p_Job);
+	}
+
+	const char* RL_TARGET_FUNC(GetJobError)(ResourceJob* p_Job)
+	{
+		return GetResourceJobError(p_Job);
+	}
+
+	JsonString* RL_TARGET_FUNC(TakeJobJsonString)(ResourceJob* p_Job)
+	{
+		return TakeResourceJobJsonString(p_Job);
+	}
+
+	ResourceMem* RL_TARGET_FUNC(TakeJobResourceMem)(ResourceJob* p_Job)
+	{
+		return TakeResourceJobResourceMem(p_Job);
+	}
+
+	void RL_TARGET_FUNC(FreeJob)(ResourceJob* p_Job)
+	{
+		FreeResourceJob(p_Job);
+	}
 }
@@ -0,0 +1,195 @@
+#include "ResourceStats.h"
+
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <Util/JobProgress.h>
+#include <Util/PortableIntrinsics.h>
+
+#include "ResourceTrace.h"
+
+struct ResourcePhaseCounters
+{
+	std::atomic<uint64_t> Calls;
+	std::atomic<uint64_t> Nanoseconds;
+	std::atomic<uint64_t> Allocations;
+	std::atomic<uint64_t> AllocatedBytes;
+};
+
+struct ResourceTypeStatsEntry
+{
+	std::atomic<uint64_t> Conversions;
+	std::atomic<uint64_t> Generations;
+	ResourcePhaseCounters Phases[ResourcePhase_Count];
+};
+
+thread_local ThreadAllocationCounters g_ThreadAllocations {};
+
+static thread_local ResourceTypeStatsEntry* g_CurrentEntry = nullptr;
+static thread_local const char* g_CurrentResourceType = nullptr;
+
+static const char* g_PhaseNames[ResourcePhase_Count] = {
+	"FileIO",
+	"Relocation",
+	"JsonWrite",
+	"JsonParse",
+	"Serialize",
+	"SegmentGeneration",
+};
+
+static std::mutex g_StatsMutex;
+
+// Entries are never removed, so pointers to them stay valid for the lifetime of the library.
+static std::unordered_map<std::string, std::unique_ptr<ResourceTypeStatsEntry>> g_Stats;
+
+static ResourceTypeStatsEntry* GetOrCreateEntry(const char* p_ResourceType)
+{
+	std::unique_lock s_Lock(g_StatsMutex);
+
+	auto& s_Entry = g_Stats[p_ResourceType];
+
+	if (!s_Entry)
+		s_Entry = std::make_unique<ResourceTypeStatsEntry>();
+
+	return s_Entry.get();
+}
+
+ResourceStatsContext::ResourceStatsContext(const char* p_ResourceType, EResourceOperation p_Operation) :
+	m_Entry(nullptr),
+	m_Operation(p_Operation),
+	m_ResourceType(p_ResourceType),
+	m_Traced(false)
+{
+	if (g_CurrentEntry != nullptr)
+		return;
+
+	m_Entry = GetOrCreateEntry(p_ResourceType);
+	g_CurrentEntry = m_Entry;
+	g_CurrentResourceType = p_ResourceType;
+
+	m_Traced = IsTracingEnabled();
+
+	if (m_Traced)
+		m_Start = std::chrono::steady_clock::now();
+}
+
+ResourceStatsContext::~ResourceStatsContext()
+{
+	if (m_Entry == nullptr)
+		return;
+
+	if (m_Operation == EResourceOperation::Conversion)
+		m_Entry->Conversions.fetch_add(1, std::memory_order_relaxed);
+	else
+		m_Entry->Generations.fetch_add(1, std::memory_order_relaxed);
+
+	if (m_Traced)
+		RecordTraceEvent(m_ResourceType, m_Operation == EResourceOperation::Conversion ? "Conversion" : "Generation", m_Start, std::chrono::steady_clock::now());
+
+	g_CurrentEntry = nullptr;
+	g_CurrentResourceType = nullptr;
+}
+
+ResourcePhaseScope::ResourcePhaseScope(ResourcePhase p_Phase) :
+	m_Entry(g_CurrentEntry),
+	m_Phase(p_Phase),
+	m_Traced(m_Entry != nullptr && IsTracingEnabled()),
+	m_StartAllocations(g_ThreadAllocations)
+{
+	// Jobs report the phase they're in, and stop between phases if they've been cancelled.
+	if (auto* s_Job = JobProgress::Current())
+		s_Job->EnterPhase(p_Phase);
+
+	if (m_Entry != nullptr)
+		m_Start = std::chrono::steady_clock::now();
+}
+
+ResourcePhaseScope::~ResourcePhaseScope()
+{
+	if (m_Entry == nullptr)
+		return;
+
+	const auto s_End = std::chrono::steady_clock::now();
+	const auto s_Elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(s_End - m_Start);
+
+	if (m_Traced)
+		RecordTraceEvent(g_PhaseNames[m_Phase], g_CurrentResourceType, m_Start, s_End);
+
+	auto& s_Phase = m_Entry->Phases[m_Phase];
+
+	s_Phase.Calls.fetch_add(1, std::memory_order_relaxed);
+	s_Phase.Nanoseconds.fetch_add(s_Elapsed.count(), std::memory_order_relaxed);
+	s_Phase.Allocations.fetch_add(g_ThreadAllocations.Allocations - m_StartAllocations.Allocations, std::memory_order_relaxed);
+	s_Phase.AllocatedBytes.fetch_add(g_ThreadAllocations.Bytes - m_StartAllocations.Bytes, std::memory_order_relaxed);
+}
+
+ResourceStatsArray* GetResourceStats()
+{
+	std::unique_lock s_Lock(g_StatsMutex);
+
+	auto* s_Array = new ResourceStatsArray();
+
+	s_Array->StatsCount = g_Stats.size();
+	s_Array->Stats = new ResourceTypeStats[s_Array->StatsCount];
+
+	size_t s_CurrentIndex = 0;
+
+	for (auto& [s_ResourceType, s_Entry] : g_Stats)
+	{
+		auto& s_Stats = s_Array->Stats[s_CurrentIndex++];
+
+		const auto s_StringSize = s_ResourceType.size();
+		auto* s_StringMemory = c_aligned_alloc(s_StringSize + 1, alignof(char));
+
+		memset(s_StringMemory, 0x00, s_StringSize + 1);
+		memcpy(s_StringMemory, s_ResourceType.c_str(), s_StringSize);
+
+		s_Stats.ResourceType = static_cast<const char*>(s_StringMemory);
+		s_Stats.Conversions = s_Entry->Conversions.load(std::memory_order_relaxed);
+		s_Stats.Generations = s_Entry->Generations.load(std::memory_order_relaxed);
+
+		for (int i = 0; i < ResourcePhase_Count; ++i)
+		{
+			s_Stats.Phases[i].Calls = s_Entry->Phases[i].Calls.load(std::memory_order_relaxed);
+			s_Stats.Phases[i].Nanoseconds = s_Entry->Phases[i].Nanoseconds.load(std::memory_order_relaxed);
+			s_Stats.Phases[i].Allocations = s_Entry->Phases[i].Allocations.load(std::memory_order_relaxed);
+			s_Stats.Phases[i].AllocatedBytes = s_Entry->Phases[i].AllocatedBytes.load(std::memory_order_relaxed);
+		}
+	}
+
+	return s_Array;
+}
+
+void FreeResourceStats(ResourceStatsArray* p_Array)
+{
+	if (p_Array == nullptr)
+		return;
+
+	for (size_t i = 0; i < p_Array->StatsCount; ++i)
+		c_aligned_free(const_cast<char*>(p_Array->Stats[i].ResourceType));
+
+	delete[] p_Array->Stats;
+	delete p_Array;
+}
+
+void ResetResourceStats()
+{
+	std::unique_lock s_Lock(g_StatsMutex);
+
+	for (auto& [s_ResourceType, s_Entry] : g_Stats)
+	{
+		s_Entry->Conversions.store(0, std::memory_order_relaxed);
+		s_Entry->Generations.store(0, std::memory_order_relaxed);
+
+		for (auto& s_Phase : s_Entry->Phases)
+		{
+			s_Phase.Calls.store(0, std::memory_order_relaxed);
+			s_Phase.Nanoseconds.store(0, std::memory_order_relaxed);
+			s_Phase.Allocations.store(0, std::memory_order_relaxed);
+			s_Phase.AllocatedBytes.store(0, std::memory_order_relaxed);
+		}
+	}
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include <ResourceLibCommon.h>
+
+/**
+ * Allocations made through the library allocator by the current thread.
+ * These are only ever incremented, and phase scopes look at how much they changed while they were active.
+ */
+struct ThreadAllocationCounters
+{
+	uint64_t Allocations;
+	uint64_t Bytes;
+};
+
+extern thread_local ThreadAllocationCounters g_ThreadAllocations;
+
+enum class EResourceOperation
+{
+	Conversion,
+	Generation,
+};
+
+struct ResourceTypeStatsEntry;
+
+/**
+ * Marks the current thread as working on a resource of the given type, so that any phase scopes
+ * entered until this is destroyed are attributed to it. Nested contexts (eg. a converter entry point
+ * calling into another one) are ignored, so each top-level call is only counted once.
+ * When tracing is enabled, a trace event covering the whole call is recorded as well.
+ */
+class ResourceStatsContext
+{
+public:
+	ResourceStatsContext(const char* p_ResourceType, EResourceOperation p_Operation);
+	~ResourceStatsContext();
+
+	ResourceStatsContext(const ResourceStatsContext&) = delete;
+	ResourceStatsContext& operator=(const ResourceStatsContext&) = delete;
+
+private:
+	ResourceTypeStatsEntry* m_Entry;
+	EResourceOperation m_Operation;
+	const char* m_ResourceType;
+	bool m_Traced;
+	std::chrono::steady_clock::time_point m_Start;
+};
+
+/**
+ * Measures the time spent and the allocations made while it is alive and adds them to the given phase
+ * of the resource type the current thread is working on, and records a trace event for it when tracing is
+ * enabled. Does nothing outside a [ResourceStatsContext].
+ */
+class ResourcePhaseScope
+{
+public:
+	explicit ResourcePhaseScope(ResourcePhase p_Phase);
+	~ResourcePhaseScope();
+
+	ResourcePhaseScope(const ResourcePhaseScope&) = delete;
+	ResourcePhaseScope& operator=(const ResourcePhaseScope&) = delete;
+
+private:
+	ResourceTypeStatsEntry* m_Entry;
+	ResourcePhase m_Phase;
+	bool m_Traced;
+	std::chrono::steady_clock::time_point m_Start;
+	ThreadAllocationCounters m_StartAllocations;
+};
+
+ResourceStatsArray* GetResourceStats();
+void FreeResourceStats(ResourceStatsArray* p_Array);
+void ResetResourceStats();
@@ -0,0 +1,206 @@
+#include "ResourceTrace.h"
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#include <External/simdjson_helpers.h>
+
+// Events are recorded into chunks of this many events.
+constexpr size_t c_TraceChunkSize = 1024;
+
+// Number of chunks kept per thread. Once a thread fills more than this, its oldest chunk is dropped.
+constexpr size_t c_TraceChunksPerThread = 64;
+
+struct TraceEvent
+{
+	std::string_view Name;
+	const char* Category;
+	int64_t StartNs;
+	int64_t DurationNs;
+};
+
+struct TraceChunk
+{
+	TraceEvent Events[c_TraceChunkSize];
+
+	// Only the owning thread writes to the chunk. It publishes each event by bumping this.
+	std::atomic<size_t> Count = 0;
+
+	// Events before this one were cleared.
+	size_t FirstEvent = 0;
+};
+
+/**
+ * Recording an event only ever touches the current chunk of the calling thread, so it doesn't take any locks.
+ * Everything else (the list of full chunks, swapping the current chunk, reading and clearing) happens with
+ * [g_TraceBuffersMutex] held, which the recording thread only takes once per chunk.
+ */
+struct TraceBuffer
+{
+	uint32_t ThreadId;
+	std::deque<std::unique_ptr<TraceChunk>> FullChunks;
+	std::unique_ptr<TraceChunk> CurrentChunk;
+};
+
+std::atomic<bool> g_TracingEnabled = false;
+
+static thread_local uint32_t g_TraceArrayDepth = 0;
+static thread_local std::string_view g_TraceArrayElementType;
+
+static const auto g_TraceEpoch = std::chrono::steady_clock::now();
+
+static std::mutex g_TraceBuffersMutex;
+
+// Buffers are kept around after their thread exits so their events still show up in the trace.
+static std::vector<std::shared_ptr<TraceBuffer>> g_TraceBuffers;
+
+static thread_local std::shared_ptr<TraceBuffer> g_ThreadTraceBuffer;
+
+static TraceBuffer* GetThreadTraceBuffer()
+{
+	if (!g_ThreadTraceBuffer)
+	{
+		auto s_Buffer = std::make_shared<TraceBuffer>();
+		s_Buffer->CurrentChunk = std::make_unique<TraceChunk>();
+
+		std::unique_lock s_Lock(g_TraceBuffersMutex);
+
+		s_Buffer->ThreadId = static_cast<uint32_t>(g_TraceBuffers.size());
+		g_TraceBuffers.push_back(s_Buffer);
+
+		g_ThreadTraceBuffer = std::move(s_Buffer);
+	}
+
+	return g_ThreadTraceBuffer.get();
+}
+
+void RecordTraceEvent(std::string_view p_Name, const char* p_Category, std::chrono::steady_clock::time_point p_Start, std::chrono::steady_clock::time_point p_End)
+{
+	auto* s_Buffer = GetThreadTraceBuffer();
+	auto* s_Chunk = s_Buffer->CurrentChunk.get();
+
+	// Only this thread ever writes the count, so it can be read without ordering.
+	const size_t s_Index = s_Chunk->Count.load(std::memory_order_relaxed);
+
+	s_Chunk->Events[s_Index] = TraceEvent {
+		.Name = p_Name,
+		.Category = p_Category,
+		.StartNs = std::chrono::duration_cast<std::chrono::nanoseconds>(p_Start - g_TraceEpoch).count(),
+		.DurationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(p_End - p_Start).count(),
+	};
+
+	s_Chunk->Count.store(s_Index + 1, std::memory_order_release);
+
+	if (s_Index + 1 < c_TraceChunkSize)
+		return;
+
+	auto s_NewChunk = std::make_unique<TraceChunk>();
+
+	std::unique_lock s_Lock(g_TraceBuffersMutex);
+
+	if (s_Chunk->FirstEvent < c_TraceChunkSize)
+		s_Buffer->FullChunks.push_back(std::move(s_Buffer->CurrentChunk));
+
+	if (s_Buffer->FullChunks.size() > c_TraceChunksPerThread)
+		s_Buffer->FullChunks.pop_front();
+
+	s_Buffer->CurrentChunk = std::move(s_NewChunk);
+}
+
+void ResourceTraceArrayScope::Begin()
+{
+	m_Outermost = g_TraceArrayDepth++ == 0;
+
+	if (m_Outermost)
+	{
+		g_TraceArrayElementType = m_ElementType;
+		m_Start = std::chrono::steady_clock::now();
+	}
+}
+
+void ResourceTraceArrayScope::End()
+{
+	--g_TraceArrayDepth;
+
+	if (!m_Outermost)
+		return;
+
+	g_TraceArrayElementType = {};
+	RecordTraceEvent(m_ElementType, m_Category, m_Start, std::chrono::steady_clock::now());
+}
+
+std::string_view ResourceTraceArrayScope::Current()
+{
+	return g_TraceArrayElementType;
+}
+
+void SetTracingEnabled(bool p_Enabled)
+{
+	g_TracingEnabled.store(p_Enabled, std::memory_order_relaxed);
+}
+
+void ClearTraceEvents()
+{
+	std::unique_lock s_Lock(g_TraceBuffersMutex);
+
+	for (auto& s_Buffer : g_TraceBuffers)
+	{
+		// The current chunk is still being written to by its thread, so its events are skipped instead.
+		s_Buffer->FullChunks.clear();
+		s_Buffer->CurrentChunk->FirstEvent = s_Buffer->CurrentChunk->Count.load(std::memory_order_acquire);
+	}
+}
+
+static void WriteTraceEvents(std::ostream& p_Stream, uint32_t p_ThreadId, const TraceChunk& p_Chunk)
+{
+	const size_t s_Count = p_Chunk.Count.load(std::memory_order_acquire);
+
+	for (size_t i = p_Chunk.FirstEvent; i < s_Count; ++i)
+	{
+		const auto& s_Event = p_Chunk.Events[i];
+
+		// Timestamps and durations are in microseconds.
+		p_Stream << ",{\"name\":" << simdjson::as_json_string(s_Event.Name);
+		p_Stream << ",\"cat\":" << simdjson::as_json_string(s_Event.Category);
+		p_Stream << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << p_ThreadId;
+		p_Stream << ",\"ts\":" << static_cast<double>(s_Event.StartNs) / 1000.0;
+		p_Stream << ",\"dur\":" << static_cast<double>(s_Event.DurationNs) / 1000.0 << "}";
+	}
+}
+
+std::string GetTraceJson()
+{
+	std::ostringstream s_Stream;
+	s_Stream.precision(3);
+	s_Stream << std::fixed;
+
+	s_Stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+	bool s_First = true;
+
+	std::unique_lock s_Lock(g_TraceBuffersMutex);
+
+	// The buffers of all threads are merged here, while their threads keep recording into their current chunks.
+	for (auto& s_Buffer : g_TraceBuffers)
+	{
+		if (!s_First)
+			s_Stream << ",";
+
+		s_First = false;
+
+		s_Stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << s_Buffer->ThreadId;
+		s_Stream << ",\"args\":{\"name\":\"Thread " << s_Buffer->ThreadId << "\"}}";
+
+		for (const auto& s_Chunk : s_Buffer->FullChunks)
+			WriteTraceEvents(s_Stream, s_Buffer->ThreadId, *s_Chunk);
+
+		WriteTraceEvents(s_Stream, s_Buffer->ThreadId, *s_Buffer->CurrentChunk);
+	}
+
+	s_Stream << "]}";
+
+	return s_Stream.str();
+}
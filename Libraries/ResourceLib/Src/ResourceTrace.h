@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+extern std::atomic<bool> g_TracingEnabled;
+
+inline bool IsTracingEnabled()
+{
+	return g_TracingEnabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * Records a complete trace event into the ring buffer of the calling thread, without taking any locks.
+ * The name and category must point to strings that live for as long as the library is loaded.
+ */
+void RecordTraceEvent(std::string_view p_Name, const char* p_Category, std::chrono::steady_clock::time_point p_Start, std::chrono::steady_clock::time_point p_End);
+
+/**
+ * Records a trace event covering the lifetime of this object, if tracing was enabled when it was created.
+ */
+class ResourceTraceScope
+{
+public:
+	ResourceTraceScope(const char* p_Name, const char* p_Category) :
+		m_Name(p_Name),
+		m_Category(p_Category),
+		m_Enabled(IsTracingEnabled())
+	{
+		if (m_Enabled)
+			m_Start = std::chrono::steady_clock::now();
+	}
+
+	~ResourceTraceScope()
+	{
+		if (m_Enabled)
+			RecordTraceEvent(m_Name, m_Category, m_Start, std::chrono::steady_clock::now());
+	}
+
+	ResourceTraceScope(const ResourceTraceScope&) = delete;
+	ResourceTraceScope& operator=(const ResourceTraceScope&) = delete;
+
+private:
+	const char* m_Name;
+	const char* m_Category;
+	bool m_Enabled;
+	std::chrono::steady_clock::time_point m_Start;
+};
+
+/**
+ * Records a trace event for a json array that isn't nested in another one, named after the type of its elements
+ * (which must live for as long as the library is loaded). Arrays nested in it don't get events of their own.
+ */
+class ResourceTraceArrayScope
+{
+public:
+	explicit ResourceTraceArrayScope(std::string_view p_ElementType, const char* p_Category = "JsonWrite") :
+		m_ElementType(p_ElementType),
+		m_Category(p_Category),
+		m_Enabled(IsTracingEnabled())
+	{
+		if (m_Enabled)
+			Begin();
+	}
+
+	~ResourceTraceArrayScope()
+	{
+		if (m_Enabled)
+			End();
+	}
+
+	ResourceTraceArrayScope(const ResourceTraceArrayScope&) = delete;
+	ResourceTraceArrayScope& operator=(const ResourceTraceArrayScope&) = delete;
+
+	/**
+	 * The element type of the outermost array being written on this thread, so worker threads writing parts
+	 * of it can record events under the same name. Empty if there's none, or tracing is disabled.
+	 */
+	static std::string_view Current();
+
+private:
+	void Begin();
+	void End();
+
+private:
+	std::string_view m_ElementType;
+	const char* m_Category;
+	bool m_Enabled;
+	bool m_Outermost = false;
+	std::chrono::steady_clock::time_point m_Start;
+};
+
+void SetTracingEnabled(bool p_Enabled);
+void ClearTraceEvents();
+
+/**
+ * Writes the events of all threads in the Chrome trace event format, which can be opened
+ * in chrome://tracing or Perfetto.
+ */
+std::string GetTraceJson();
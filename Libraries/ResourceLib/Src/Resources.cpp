@@ -16,7 +16,7 @@
 #include <Generated/KNT/ZHMGen.h>
 #endif
 
-#define REGISTER_RESOURCE(ResourceName, ResourceType) { #ResourceName, Resource(CreateResourceConverter<ResourceType>(), CreateResourceGenerator<ResourceType>()) },
+#define REGISTER_RESOURCE(ResourceName, ResourceType) { #ResourceName, Resource(#ResourceType, CreateResourceConverter<ResourceType, #ResourceName>(), CreateResourceGenerator<ResourceType, #ResourceName>()) },
 
 // Register all supported resource types here.
 std::unordered_map<std::string, Resource> g_Resources = {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
 #include <unordered_map>
 #include <string>
 
@@ -8,12 +10,28 @@ struct ResourceConverter;
 
 struct Resource
 {
-	Resource(ResourceConverter* p_Converter, ResourceGenerator* p_Generator) :
-		Converter(p_Converter), Generator(p_Generator)
+	Resource(const char* p_TypeName, ResourceConverter* p_Converter, ResourceGenerator* p_Generator) :
+		TypeName(p_TypeName), Converter(p_Converter), Generator(p_Generator)
 	{}
 	
+	std::string TypeName;
 	ResourceConverter* Converter;
 	ResourceGenerator* Generator;
 };
 
+/**
+ * A resource type name (eg. TEMP) that can be passed as a template argument, so that the converter and
+ * generator instantiations of each resource type know which one they're working on.
+ */
+template <size_t N>
+struct ResourceName
+{
+	constexpr ResourceName(const char (&p_Name)[N])
+	{
+		std::copy_n(p_Name, N, Value);
+	}
+
+	char Value[N];
+};
+
 extern std::unordered_map<std::string, Resource> g_Resources;
@@ -0,0 +1,399 @@
+#include "Base64.h"
+
+#include "CpuFeatures.h"
+
+static constexpr char c_EncodingTable[] = {
+	'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
+	'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+	'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',
+	'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+	'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',
+	'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+	'w', 'x', 'y', 'z', '0', '1', '2', '3',
+	'4', '5', '6', '7', '8', '9', '+', '/'
+};
+
+// 64 marks characters that aren't part of the alphabet.
+static constexpr uint8_t c_DecodingTable[] = {
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 62, 64, 64, 64, 63,
+	52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 64, 64, 64, 64, 64, 64,
+	64,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+	15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 64, 64, 64, 64, 64,
+	64, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+	41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64
+};
+
+#if RL_X86
+// The vectorized codecs below are based on the algorithms described by Wojciech Mula and Daniel Lemire
+// in "Faster Base64 Encoding and Decoding using AVX2 Instructions" (2018).
+
+// Encodes 12 bytes per iteration. Reads 16 bytes at a time, so it stops while at least 16 bytes remain.
+// Returns the number of input bytes consumed.
+RL_TARGET_SSSE3
+static size_t EncodeSSSE3(const uint8_t* p_Input, size_t p_Size, char* p_Output)
+{
+	const __m128i s_Shuffle = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+	const __m128i s_ShiftLut = _mm_setr_epi8(
+		'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+		'0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+		'/' - 63, 'A', 0, 0
+	);
+
+	size_t s_Consumed = 0;
+
+	while (p_Size - s_Consumed >= 16)
+	{
+		__m128i s_In = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_Input + s_Consumed));
+		s_In = _mm_shuffle_epi8(s_In, s_Shuffle);
+
+		// Split every 3 bytes into 4 6-bit indices.
+		const __m128i s_T0 = _mm_and_si128(s_In, _mm_set1_epi32(0x0FC0FC00));
+		const __m128i s_T1 = _mm_mulhi_epu16(s_T0, _mm_set1_epi32(0x04000040));
+		const __m128i s_T2 = _mm_and_si128(s_In, _mm_set1_epi32(0x003F03F0));
+		const __m128i s_T3 = _mm_mullo_epi16(s_T2, _mm_set1_epi32(0x01000010));
+		const __m128i s_Indices = _mm_or_si128(s_T1, s_T3);
+
+		// Map indices to characters.
+		__m128i s_Result = _mm_subs_epu8(s_Indices, _mm_set1_epi8(51));
+		const __m128i s_Less = _mm_cmpgt_epi8(_mm_set1_epi8(26), s_Indices);
+		s_Result = _mm_or_si128(s_Result, _mm_and_si128(s_Less, _mm_set1_epi8(13)));
+		s_Result = _mm_add_epi8(_mm_shuffle_epi8(s_ShiftLut, s_Result), s_Indices);
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(p_Output), s_Result);
+
+		p_Output += 16;
+		s_Consumed += 12;
+	}
+
+	return s_Consumed;
+}
+
+// Encodes 24 bytes per iteration. Reads 28 bytes at a time, so it stops while at least 32 bytes remain.
+RL_TARGET_AVX2
+static size_t EncodeAVX2(const uint8_t* p_Input, size_t p_Size, char* p_Output)
+{
+	const __m256i s_Shuffle = _mm256_set_epi8(
+		10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+		10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1
+	);
+
+	const __m256i s_ShiftLut = _mm256_setr_epi8(
+		'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+		'0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+		'/' - 63, 'A', 0, 0,
+		'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+		'0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+		'/' - 63, 'A', 0, 0
+	);
+
+	size_t s_Consumed = 0;
+
+	while (p_Size - s_Consumed >= 32)
+	{
+		// Each 128-bit lane gets 12 input bytes.
+		const auto* s_Input = p_Input + s_Consumed;
+		const __m128i s_Low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s_Input));
+		const __m128i s_High = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s_Input + 12));
+
+		__m256i s_In = _mm256_inserti128_si256(_mm256_castsi128_si256(s_Low), s_High, 1);
+		s_In = _mm256_shuffle_epi8(s_In, s_Shuffle);
+
+		const __m256i s_T0 = _mm256_and_si256(s_In, _mm256_set1_epi32(0x0FC0FC00));
+		const __m256i s_T1 = _mm256_mulhi_epu16(s_T0, _mm256_set1_epi32(0x04000040));
+		const __m256i s_T2 = _mm256_and_si256(s_In, _mm256_set1_epi32(0x003F03F0));
+		const __m256i s_T3 = _mm256_mullo_epi16(s_T2, _mm256_set1_epi32(0x01000010));
+		const __m256i s_Indices = _mm256_or_si256(s_T1, s_T3);
+
+		__m256i s_Result = _mm256_subs_epu8(s_Indices, _mm256_set1_epi8(51));
+		const __m256i s_Less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), s_Indices);
+		s_Result = _mm256_or_si256(s_Result, _mm256_and_si256(s_Less, _mm256_set1_epi8(13)));
+		s_Result = _mm256_add_epi8(_mm256_shuffle_epi8(s_ShiftLut, s_Result), s_Indices);
+
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(p_Output), s_Result);
+
+		p_Output += 32;
+		s_Consumed += 24;
+	}
+
+	return s_Consumed;
+}
+
+// Decodes 16 characters per iteration, writing 16 bytes of which 12 are valid. Stops at the first block
+// with characters outside the alphabet and leaves it to the scalar decoder. Returns the number of
+// input characters consumed.
+RL_TARGET_SSSE3
+static size_t DecodeSSSE3(const char* p_Input, size_t p_Size, uint8_t* p_Output, size_t p_OutputSize)
+{
+	const __m128i s_LutLo = _mm_setr_epi8(
+		0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A
+	);
+
+	const __m128i s_LutHi = _mm_setr_epi8(
+		0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10
+	);
+
+	const __m128i s_LutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+	const __m128i s_Pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+	size_t s_Consumed = 0;
+	size_t s_Produced = 0;
+
+	while (p_Size - s_Consumed >= 16 && p_OutputSize - s_Produced >= 16)
+	{
+		__m128i s_In = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_Input + s_Consumed));
+
+		const __m128i s_HiNibbles = _mm_and_si128(_mm_srli_epi32(s_In, 4), _mm_set1_epi8(0x0F));
+		const __m128i s_LoNibbles = _mm_and_si128(s_In, _mm_set1_epi8(0x0F));
+		const __m128i s_Lo = _mm_shuffle_epi8(s_LutLo, s_LoNibbles);
+		const __m128i s_Hi = _mm_shuffle_epi8(s_LutHi, s_HiNibbles);
+
+		if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(s_Lo, s_Hi), _mm_setzero_si128())) != 0)
+			break;
+
+		const __m128i s_Eq2F = _mm_cmpeq_epi8(s_In, _mm_set1_epi8('/'));
+		const __m128i s_Roll = _mm_shuffle_epi8(s_LutRoll, _mm_add_epi8(s_Eq2F, s_HiNibbles));
+		s_In = _mm_add_epi8(s_In, s_Roll);
+
+		// Pack 4 6-bit values into 3 bytes.
+		const __m128i s_MergedAb = _mm_maddubs_epi16(s_In, _mm_set1_epi32(0x01400140));
+		__m128i s_Out = _mm_madd_epi16(s_MergedAb, _mm_set1_epi32(0x00011000));
+		s_Out = _mm_shuffle_epi8(s_Out, s_Pack);
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(p_Output + s_Produced), s_Out);
+
+		s_Consumed += 16;
+		s_Produced += 12;
+	}
+
+	return s_Consumed;
+}
+
+RL_TARGET_AVX2
+static size_t DecodeAVX2(const char* p_Input, size_t p_Size, uint8_t* p_Output, size_t p_OutputSize)
+{
+	const __m256i s_LutLo = _mm256_setr_epi8(
+		0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+		0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A
+	);
+
+	const __m256i s_LutHi = _mm256_setr_epi8(
+		0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+		0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10
+	);
+
+	const __m256i s_LutRoll = _mm256_setr_epi8(
+		0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0
+	);
+
+	const __m256i s_Pack = _mm256_setr_epi8(
+		2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+		2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1
+	);
+
+	size_t s_Consumed = 0;
+	size_t s_Produced = 0;
+
+	while (p_Size - s_Consumed >= 32 && p_OutputSize - s_Produced >= 32)
+	{
+		__m256i s_In = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_Input + s_Consumed));
+
+		const __m256i s_HiNibbles = _mm256_and_si256(_mm256_srli_epi32(s_In, 4), _mm256_set1_epi8(0x0F));
+		const __m256i s_LoNibbles = _mm256_and_si256(s_In, _mm256_set1_epi8(0x0F));
+		const __m256i s_Lo = _mm256_shuffle_epi8(s_LutLo, s_LoNibbles);
+		const __m256i s_Hi = _mm256_shuffle_epi8(s_LutHi, s_HiNibbles);
+
+		if (!_mm256_testz_si256(s_Lo, s_Hi))
+			break;
+
+		const __m256i s_Eq2F = _mm256_cmpeq_epi8(s_In, _mm256_set1_epi8('/'));
+		const __m256i s_Roll = _mm256_shuffle_epi8(s_LutRoll, _mm256_add_epi8(s_Eq2F, s_HiNibbles));
+		s_In = _mm256_add_epi8(s_In, s_Roll);
+
+		const __m256i s_MergedAb = _mm256_maddubs_epi16(s_In, _mm256_set1_epi32(0x01400140));
+		__m256i s_Out = _mm256_madd_epi16(s_MergedAb, _mm256_set1_epi32(0x00011000));
+		s_Out = _mm256_shuffle_epi8(s_Out, s_Pack);
+
+		// Move the 12 valid bytes of each lane next to each other.
+		s_Out = _mm256_permutevar8x32_epi32(s_Out, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(p_Output + s_Produced), s_Out);
+
+		s_Consumed += 32;
+		s_Produced += 24;
+	}
+
+	return s_Consumed;
+}
+#endif
+
+static void EncodeScalar(const uint8_t* p_Input, size_t p_Size, char* p_Output)
+{
+	size_t i = 0;
+
+	for (; i + 2 < p_Size; i += 3)
+	{
+		*p_Output++ = c_EncodingTable[p_Input[i] >> 2];
+		*p_Output++ = c_EncodingTable[((p_Input[i] & 0x3) << 4) | (p_Input[i + 1] >> 4)];
+		*p_Output++ = c_EncodingTable[((p_Input[i + 1] & 0xF) << 2) | (p_Input[i + 2] >> 6)];
+		*p_Output++ = c_EncodingTable[p_Input[i + 2] & 0x3F];
+	}
+
+	if (i < p_Size)
+	{
+		*p_Output++ = c_EncodingTable[p_Input[i] >> 2];
+
+		if (i == p_Size - 1)
+		{
+			*p_Output++ = c_EncodingTable[(p_Input[i] & 0x3) << 4];
+			*p_Output++ = '=';
+		}
+		else
+		{
+			*p_Output++ = c_EncodingTable[((p_Input[i] & 0x3) << 4) | (p_Input[i + 1] >> 4)];
+			*p_Output++ = c_EncodingTable[(p_Input[i + 1] & 0xF) << 2];
+		}
+
+		*p_Output++ = '=';
+	}
+}
+
+size_t Base64::DecodedSize(std::string_view p_Input)
+{
+	const auto s_Size = p_Input.size();
+
+	if (s_Size % 4 != 0)
+		return 0;
+
+	size_t s_DecodedSize = s_Size / 4 * 3;
+
+	if (s_Size > 0 && p_Input[s_Size - 1] == '=')
+		--s_DecodedSize;
+
+	if (s_Size > 1 && p_Input[s_Size - 2] == '=')
+		--s_DecodedSize;
+
+	return s_DecodedSize;
+}
+
+void Base64::Encode(std::span<const uint8_t> p_Input, char* p_Output)
+{
+	size_t s_Consumed = 0;
+
+#if RL_X86
+	const auto& s_Features = CpuFeatures::Get();
+
+	if (s_Features.AVX2)
+		s_Consumed = EncodeAVX2(p_Input.data(), p_Input.size(), p_Output);
+	else if (s_Features.SSSE3)
+		s_Consumed = EncodeSSSE3(p_Input.data(), p_Input.size(), p_Output);
+#endif
+
+	EncodeScalar(p_Input.data() + s_Consumed, p_Input.size() - s_Consumed, p_Output + s_Consumed / 3 * 4);
+}
+
+void Base64::EncodeJsonString(std::span<const uint8_t> p_Input, std::ostream& p_Stream)
+{
+	// Must be a multiple of 3 so only the last chunk can have padding.
+	constexpr size_t c_ChunkSize = 3 * 4096;
+
+	char s_Buffer[EncodedSize(c_ChunkSize)];
+
+	p_Stream << "\"";
+
+	for (size_t s_Offset = 0; s_Offset < p_Input.size(); s_Offset += c_ChunkSize)
+	{
+		const auto s_Chunk = p_Input.subspan(s_Offset, std::min(c_ChunkSize, p_Input.size() - s_Offset));
+
+		Encode(s_Chunk, s_Buffer);
+		p_Stream.write(s_Buffer, EncodedSize(s_Chunk.size()));
+	}
+
+	p_Stream << "\"";
+}
+
+bool Base64::Decode(std::string_view p_Input, std::span<uint8_t> p_Output)
+{
+	if (p_Input.size() % 4 != 0 || p_Output.size() != DecodedSize(p_Input))
+		return false;
+
+	if (p_Input.empty())
+		return true;
+
+	// The last quad can contain padding, so it's always decoded separately.
+	const size_t s_BodySize = p_Input.size() - 4;
+	size_t s_Consumed = 0;
+
+#if RL_X86
+	const auto& s_Features = CpuFeatures::Get();
+
+	if (s_Features.AVX2)
+		s_Consumed = DecodeAVX2(p_Input.data(), s_BodySize, p_Output.data(), p_Output.size());
+
+	if (s_Features.SSSE3)
+	{
+		s_Consumed += DecodeSSSE3(
+			p_Input.data() + s_Consumed, s_BodySize - s_Consumed,
+			p_Output.data() + s_Consumed / 4 * 3, p_Output.size() - s_Consumed / 4 * 3
+		);
+	}
+#endif
+
+	auto* s_Output = p_Output.data() + s_Consumed / 4 * 3;
+
+	for (size_t i = s_Consumed; i < s_BodySize; i += 4)
+	{
+		const uint32_t a = c_DecodingTable[static_cast<uint8_t>(p_Input[i])];
+		const uint32_t b = c_DecodingTable[static_cast<uint8_t>(p_Input[i + 1])];
+		const uint32_t c = c_DecodingTable[static_cast<uint8_t>(p_Input[i + 2])];
+		const uint32_t d = c_DecodingTable[static_cast<uint8_t>(p_Input[i + 3])];
+
+		if ((a | b | c | d) & 64)
+			return false;
+
+		const uint32_t s_Triple = (a << 18) | (b << 12) | (c << 6) | d;
+
+		*s_Output++ = (s_Triple >> 16) & 0xFF;
+		*s_Output++ = (s_Triple >> 8) & 0xFF;
+		*s_Output++ = s_Triple & 0xFF;
+	}
+
+	// Decode the last quad, which may be padded.
+	const char* s_Last = p_Input.data() + s_BodySize;
+	const size_t s_Padding = (s_Last[3] == '=') + (s_Last[2] == '=' && s_Last[3] == '=');
+
+	uint32_t s_Triple = 0;
+
+	for (size_t i = 0; i < 4 - s_Padding; ++i)
+	{
+		const uint32_t s_Value = c_DecodingTable[static_cast<uint8_t>(s_Last[i])];
+
+		if (s_Value & 64)
+			return false;
+
+		s_Triple |= s_Value << (18 - 6 * i);
+	}
+
+	const auto* s_End = p_Output.data() + p_Output.size();
+
+	for (size_t i = 0; i < 3 - s_Padding && s_Output < s_End; ++i)
+		*s_Output++ = (s_Triple >> (16 - 8 * i)) & 0xFF;
+
+	return true;
+}
@@ -24,113 +24,51 @@
  * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  */
 
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <span>
 #include <string>
+#include <string_view>
 
+/**
+ * Standard (RFC 4648) base64 with padding.
+ * Bulk data is processed with AVX2 or SSSE3 when the CPU supports them, and with a scalar loop otherwise.
+ */
 class Base64
 {
 public:
-    static std::string Encode(const std::string data)
+	static constexpr size_t EncodedSize(size_t p_Size)
 	{
-        static constexpr char sEncodingTable[] = {
-          'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
-          'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
-          'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',
-          'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
-          'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',
-          'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
-          'w', 'x', 'y', 'z', '0', '1', '2', '3',
-          '4', '5', '6', '7', '8', '9', '+', '/'
-        };
-
-        size_t in_len = data.size();
-        size_t out_len = 4 * ((in_len + 2) / 3);
-        std::string ret(out_len, '\0');
-        size_t i;
-        char* p = const_cast<char*>(ret.c_str());
+		return 4 * ((p_Size + 2) / 3);
+	}
 
-        for (i = 0; i < in_len - 2; i += 3) 
-        {
-            *p++ = sEncodingTable[(data[i] >> 2) & 0x3F];
-            *p++ = sEncodingTable[((data[i] & 0x3) << 4) | ((int)(data[i + 1] & 0xF0) >> 4)];
-            *p++ = sEncodingTable[((data[i + 1] & 0xF) << 2) | ((int)(data[i + 2] & 0xC0) >> 6)];
-            *p++ = sEncodingTable[data[i + 2] & 0x3F];
-        }
-    	
-        if (i < in_len)
-        {
-            *p++ = sEncodingTable[(data[i] >> 2) & 0x3F];
-        	
-            if (i == (in_len - 1)) 
-            {
-                *p++ = sEncodingTable[((data[i] & 0x3) << 4)];
-                *p++ = '=';
-            }
-            else 
-            {
-                *p++ = sEncodingTable[((data[i] & 0x3) << 4) | ((int)(data[i + 1] & 0xF0) >> 4)];
-                *p++ = sEncodingTable[((data[i + 1] & 0xF) << 2)];
-            }
-        	
-            *p++ = '=';
-        }
+	/**
+	 * Size of the data encoded in [p_Input], or 0 if its length isn't valid for padded base64.
+	 */
+	static size_t DecodedSize(std::string_view p_Input);
 
-        return ret;
-    }
-
-    static void Decode(const std::string& input, std::string& out)
-	{
-        static constexpr unsigned char kDecodingTable[] = {
-          64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-          64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-          64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 62, 64, 64, 64, 63,
-          52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 64, 64, 64, 64, 64, 64,
-          64,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
-          15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 64, 64, 64, 64, 64,
-          64, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
-          41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 64, 64, 64, 64, 64,
-          64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-          64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-          64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-          64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-          64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-          64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-          64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
-          64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64
-        };
+	/**
+	 * Encodes [p_Input] into [p_Output], which must have room for [EncodedSize] characters.
+	 */
+	static void Encode(std::span<const uint8_t> p_Input, char* p_Output);
 
-        size_t in_len = input.size();
-    	
-        if (in_len % 4 != 0)
-            return;
+	/**
+	 * Writes [p_Input] to [p_Stream] as a quoted json string, encoding it in chunks so the whole
+	 * encoded string never has to exist in memory. Base64 never needs escaping in json.
+	 */
+	static void EncodeJsonString(std::span<const uint8_t> p_Input, std::ostream& p_Stream);
 
-        size_t out_len = in_len / 4 * 3;
-        if (input[in_len - 1] == '=') out_len--;
-        if (input[in_len - 2] == '=') out_len--;
+	/**
+	 * Decodes [p_Input] into [p_Output], which must be exactly [DecodedSize] bytes long.
+	 * Returns [false] if the input isn't valid base64.
+	 */
+	static bool Decode(std::string_view p_Input, std::span<uint8_t> p_Output);
 
-        out.resize(out_len);
-
-        for (size_t i = 0, j = 0; i < in_len;) 
-        {
-            uint32_t a = input[i] == '=' ? 0 & i++ : kDecodingTable[static_cast<int>(input[i++])];
-            uint32_t b = input[i] == '=' ? 0 & i++ : kDecodingTable[static_cast<int>(input[i++])];
-            uint32_t c = input[i] == '=' ? 0 & i++ : kDecodingTable[static_cast<int>(input[i++])];
-            uint32_t d = input[i] == '=' ? 0 & i++ : kDecodingTable[static_cast<int>(input[i++])];
-
-            uint32_t triple = (a << 3 * 6) + (b << 2 * 6) + (c << 1 * 6) + (d << 0 * 6);
-
-            if (j < out_len) 
-                out[j++] = (triple >> 2 * 8) & 0xFF;
-        	
-            if (j < out_len) 
-                out[j++] = (triple >> 1 * 8) & 0xFF;
-        	
-            if (j < out_len) 
-                out[j++] = (triple >> 0 * 8) & 0xFF;
-        }
-    }
-	
-    static void Decode(std::string_view input, std::string& out)
-    {
-        Decode(std::string(input.data(), input.size()), out);
-    }
+	static std::string Encode(std::string_view p_Input)
+	{
+		std::string s_Result(EncodedSize(p_Input.size()), '\0');
+		Encode(std::span(reinterpret_cast<const uint8_t*>(p_Input.data()), p_Input.size()), s_Result.data());
+		return s_Result;
+	}
 };
@@ -0,0 +1,207 @@
+#include "BinarySidecar.h"
+
+#include <stdexcept>
+#include <string>
+
+#if _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+std::atomic<size_t> BinarySidecar::g_Threshold = 0;
+
+static thread_local BinarySidecarWriter* g_CurrentSidecarWriter = nullptr;
+static thread_local BinarySidecarReader* g_CurrentSidecarReader = nullptr;
+
+void BinarySidecar::SetThreshold(size_t p_MinSize)
+{
+	g_Threshold.store(p_MinSize, std::memory_order_relaxed);
+}
+
+size_t BinarySidecar::Threshold()
+{
+	return g_Threshold.load(std::memory_order_relaxed);
+}
+
+std::filesystem::path BinarySidecar::PathFor(const std::filesystem::path& p_JsonFilePath)
+{
+	auto s_Path = p_JsonFilePath;
+	s_Path += ".bin";
+	return s_Path;
+}
+
+BinarySidecarWriter::BinarySidecarWriter(std::filesystem::path p_Path, size_t p_Threshold) :
+	m_Path(std::move(p_Path)),
+	m_Threshold(p_Threshold),
+	m_Previous(g_CurrentSidecarWriter)
+{
+	g_CurrentSidecarWriter = this;
+}
+
+BinarySidecarWriter::~BinarySidecarWriter()
+{
+	g_CurrentSidecarWriter = m_Previous;
+
+	if (m_File)
+		fclose(m_File);
+}
+
+BinarySidecarWriter* BinarySidecarWriter::Current()
+{
+	return g_CurrentSidecarWriter;
+}
+
+bool BinarySidecarWriter::TryWrite(const void* p_Data, size_t p_Size, std::ostream& p_Stream)
+{
+	if (m_Threshold == 0 || p_Size == 0 || p_Size < m_Threshold)
+		return false;
+
+	if (!m_File)
+	{
+#if _WIN32
+		if (_wfopen_s(&m_File, m_Path.c_str(), L"wb") != 0)
+			m_File = nullptr;
+#else
+		m_File = fopen(m_Path.c_str(), "wb");
+#endif
+
+		if (!m_File)
+			throw std::runtime_error("Could not open the binary sidecar file '" + m_Path.string() + "' for writing.");
+	}
+
+	// Keep every blob aligned so it can be used straight from the mapped file.
+	static constexpr uint8_t c_Padding[BinarySidecar::c_Alignment] = {};
+	const size_t s_PaddingSize = (BinarySidecar::c_Alignment - (m_Size % BinarySidecar::c_Alignment)) % BinarySidecar::c_Alignment;
+
+	if (fwrite(c_Padding, 1, s_PaddingSize, m_File) != s_PaddingSize || fwrite(p_Data, 1, p_Size, m_File) != p_Size)
+		throw std::runtime_error("Could not write to the binary sidecar file '" + m_Path.string() + "'.");
+
+	const uint64_t s_Offset = m_Size + s_PaddingSize;
+	m_Size = s_Offset + p_Size;
+
+	p_Stream << "{\"$sidecar\":{\"offset\":" << s_Offset << ",\"length\":" << p_Size << "}}";
+
+	return true;
+}
+
+BinarySidecarReader::BinarySidecarReader(std::filesystem::path p_Path) :
+	m_Path(std::move(p_Path)),
+	m_Previous(g_CurrentSidecarReader)
+{
+	g_CurrentSidecarReader = this;
+}
+
+BinarySidecarReader::~BinarySidecarReader()
+{
+	g_CurrentSidecarReader = m_Previous;
+
+#if _WIN32
+	if (m_Data)
+		UnmapViewOfFile(m_Data);
+
+	if (m_MappingHandle)
+		CloseHandle(m_MappingHandle);
+#else
+	if (m_Data)
+		munmap(const_cast<uint8_t*>(m_Data), m_Size);
+#endif
+}
+
+BinarySidecarReader* BinarySidecarReader::Current()
+{
+	return g_CurrentSidecarReader;
+}
+
+BinarySidecarReader::Scope::Scope(BinarySidecarReader* p_Reader) :
+	m_Previous(g_CurrentSidecarReader)
+{
+	g_CurrentSidecarReader = p_Reader;
+}
+
+BinarySidecarReader::Scope::~Scope()
+{
+	g_CurrentSidecarReader = m_Previous;
+}
+
+std::optional<std::span<const uint8_t>> BinarySidecarReader::Resolve(simdjson::ondemand::value p_Value)
+{
+	if (p_Value.type() != simdjson::ondemand::json_type::object)
+		return std::nullopt;
+
+	simdjson::ondemand::object s_Reference = p_Value["$sidecar"];
+
+	const uint64_t s_Offset = s_Reference["offset"];
+	const uint64_t s_Length = s_Reference["length"];
+
+	auto* s_Reader = Current();
+
+	if (!s_Reader)
+		throw std::runtime_error("Found a binary sidecar reference, but binary sidecars can only be used when generating resources from json files.");
+
+	return s_Reader->Get(s_Offset, s_Length);
+}
+
+std::span<const uint8_t> BinarySidecarReader::Get(uint64_t p_Offset, uint64_t p_Length)
+{
+	// If mapping fails, the next call tries again (and most likely throws the same error).
+	std::call_once(m_MapOnce, [this]() { Map(); });
+
+	if (p_Offset > m_Size || p_Length > m_Size - p_Offset)
+		throw std::runtime_error("Binary sidecar reference at offset " + std::to_string(p_Offset) + " with length " + std::to_string(p_Length) + " is out of bounds.");
+
+	return { m_Data + p_Offset, static_cast<size_t>(p_Length) };
+}
+
+void BinarySidecarReader::Map()
+{
+	std::error_code s_Error;
+	const auto s_FileSize = std::filesystem::file_size(m_Path, s_Error);
+
+	if (s_Error)
+		throw std::runtime_error("Could not find the binary sidecar file '" + m_Path.string() + "'.");
+
+	// Empty files can't be mapped, and nothing can reference them anyway.
+	if (s_FileSize == 0)
+		return;
+
+#if _WIN32
+	const HANDLE s_File = CreateFileW(m_Path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+	if (s_File == INVALID_HANDLE_VALUE)
+		throw std::runtime_error("Could not open the binary sidecar file '" + m_Path.string() + "'.");
+
+	// The mapping keeps the file open, so we don't need its handle anymore.
+	m_MappingHandle = CreateFileMappingW(s_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(s_File);
+
+	if (!m_MappingHandle)
+		throw std::runtime_error("Could not map the binary sidecar file '" + m_Path.string() + "'.");
+
+	m_Data = static_cast<const uint8_t*>(MapViewOfFile(m_MappingHandle, FILE_MAP_READ, 0, 0, 0));
+#else
+	const int s_File = open(m_Path.c_str(), O_RDONLY);
+
+	if (s_File == -1)
+		throw std::runtime_error("Could not open the binary sidecar file '" + m_Path.string() + "'.");
+
+	void* s_Data = mmap(nullptr, s_FileSize, PROT_READ, MAP_PRIVATE, s_File, 0);
+	close(s_File);
+
+	// The data is copied out of the mapping front to back.
+	if (s_Data != MAP_FAILED)
+	{
+		madvise(s_Data, s_FileSize, MADV_SEQUENTIAL);
+		m_Data = static_cast<const uint8_t*>(s_Data);
+	}
+#endif
+
+	if (!m_Data)
+		throw std::runtime_error("Could not map the binary sidecar file '" + m_Path.string() + "'.");
+
+	m_Size = s_FileSize;
+}
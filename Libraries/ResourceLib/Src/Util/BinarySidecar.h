@@ -0,0 +1,123 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <span>
+
+#include <External/simdjson.h>
+
+/**
+ * Large binary fields, like the byte blobs and arrays of numbers found in AIRG, CRMD, GFXF and TDAT resources,
+ * can be stored in a sidecar file next to the json file of a resource instead of being written inline as base64
+ * or decimal text. The json then references the data by its position in the sidecar:
+ *
+ *     "m_pVisibilityData": {"$sidecar":{"offset":0,"length":1048576}}
+ *
+ * The referenced data is the in-memory representation of the field (eg. the little-endian elements of an array).
+ * The sidecar of a json file is the file at the same path with ".bin" appended to it.
+ */
+class BinarySidecar
+{
+public:
+	/**
+	 * Fields with at least [p_MinSize] bytes of data get written to the sidecar when converting resources to
+	 * json files. Passing 0 disables sidecars, which is the default.
+	 */
+	static void SetThreshold(size_t p_MinSize);
+	static size_t Threshold();
+
+	static std::filesystem::path PathFor(const std::filesystem::path& p_JsonFilePath);
+
+	// Offsets of data in the sidecar are aligned to this.
+	static constexpr size_t c_Alignment = 16;
+
+private:
+	static std::atomic<size_t> g_Threshold;
+};
+
+/**
+ * Creating a writer makes it the current one for the calling thread until it's destroyed.
+ * The sidecar file is only created once something gets written to it.
+ */
+class BinarySidecarWriter
+{
+public:
+	BinarySidecarWriter(std::filesystem::path p_Path, size_t p_Threshold);
+	~BinarySidecarWriter();
+
+	BinarySidecarWriter(const BinarySidecarWriter&) = delete;
+	BinarySidecarWriter& operator=(const BinarySidecarWriter&) = delete;
+
+	static BinarySidecarWriter* Current();
+
+	/**
+	 * If [p_Size] is over the threshold, appends the data to the sidecar, writes a reference to it to [p_Stream]
+	 * and returns [true]. Otherwise returns [false] and the caller is expected to write the data inline.
+	 */
+	bool TryWrite(const void* p_Data, size_t p_Size, std::ostream& p_Stream);
+
+private:
+	std::filesystem::path m_Path;
+	size_t m_Threshold;
+	FILE* m_File = nullptr;
+	uint64_t m_Size = 0;
+	BinarySidecarWriter* m_Previous;
+};
+
+/**
+ * Creating a reader makes it the current one for the calling thread until it's destroyed.
+ * The sidecar file is memory mapped the first time a reference to it is resolved, and stays mapped for
+ * the lifetime of the reader. A reader can be used by multiple threads at once.
+ */
+class BinarySidecarReader
+{
+public:
+	explicit BinarySidecarReader(std::filesystem::path p_Path);
+	~BinarySidecarReader();
+
+	BinarySidecarReader(const BinarySidecarReader&) = delete;
+	BinarySidecarReader& operator=(const BinarySidecarReader&) = delete;
+
+	static BinarySidecarReader* Current();
+
+	/**
+	 * If [p_Value] is a sidecar reference, returns the data it references. Otherwise returns [std::nullopt] and
+	 * leaves [p_Value] untouched. Throws std::runtime_error if the reference can't be resolved.
+	 */
+	static std::optional<std::span<const uint8_t>> Resolve(simdjson::ondemand::value p_Value);
+
+	/**
+	 * Makes [p_Reader] the current reader of the calling thread until it's destroyed. This lets worker threads
+	 * resolve references in the parts of a resource they parse.
+	 */
+	class Scope
+	{
+	public:
+		explicit Scope(BinarySidecarReader* p_Reader);
+		~Scope();
+
+		Scope(const Scope&) = delete;
+		Scope& operator=(const Scope&) = delete;
+
+	private:
+		BinarySidecarReader* m_Previous;
+	};
+
+private:
+	std::span<const uint8_t> Get(uint64_t p_Offset, uint64_t p_Length);
+	void Map();
+
+private:
+	std::filesystem::path m_Path;
+	std::once_flag m_MapOnce;
+	const uint8_t* m_Data = nullptr;
+	size_t m_Size = 0;
+	void* m_MappingHandle = nullptr;
+	BinarySidecarReader* m_Previous;
+};
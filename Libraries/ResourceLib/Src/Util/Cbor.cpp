@@ -0,0 +1,379 @@
+#include "Cbor.h"
+
+#include <cmath>
+#include <limits>
+#include <string>
+
+size_t CborTypedArrayElementSize(ECborTypedArray p_Kind)
+{
+	switch (p_Kind)
+	{
+		case ECborTypedArray::UInt8:
+		case ECborTypedArray::Int8:
+			return 1;
+
+		case ECborTypedArray::UInt16:
+		case ECborTypedArray::Int16:
+			return 2;
+
+		case ECborTypedArray::UInt32:
+		case ECborTypedArray::Int32:
+		case ECborTypedArray::Float32:
+			return 4;
+
+		case ECborTypedArray::UInt64:
+		case ECborTypedArray::Int64:
+		case ECborTypedArray::Float64:
+			return 8;
+
+		default:
+			return 0;
+	}
+}
+
+ECborMajorType CborReader::PeekType()
+{
+	SkipIgnoredTags();
+	return static_cast<ECborMajorType>(PeekByte() >> 5);
+}
+
+bool CborReader::TryReadNull()
+{
+	SkipIgnoredTags();
+
+	// Undefined is read as null too.
+	if (PeekByte() != 0xF6 && PeekByte() != 0xF7)
+		return false;
+
+	++m_Position;
+	return true;
+}
+
+std::optional<bool> CborReader::TryReadBool()
+{
+	SkipIgnoredTags();
+
+	switch (PeekByte())
+	{
+		case 0xF4: ++m_Position; return false;
+		case 0xF5: ++m_Position; return true;
+		default: return std::nullopt;
+	}
+}
+
+bool CborReader::ReadBool()
+{
+	const auto s_Value = TryReadBool();
+
+	if (!s_Value)
+		throw std::runtime_error("Expected a CBOR boolean.");
+
+	return *s_Value;
+}
+
+int64_t CborReader::ReadInt()
+{
+	SkipIgnoredTags();
+
+	const uint8_t s_Initial = ReadByte();
+	const auto s_Type = static_cast<ECborMajorType>(s_Initial >> 5);
+
+	if (s_Type != ECborMajorType::UnsignedInt && s_Type != ECborMajorType::NegativeInt)
+		throw std::runtime_error("Expected a CBOR integer.");
+
+	const uint64_t s_Value = ReadArgument(s_Initial & 0x1F);
+
+	if (s_Value > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+		throw std::runtime_error("CBOR integer is out of range.");
+
+	return s_Type == ECborMajorType::UnsignedInt ? static_cast<int64_t>(s_Value) : -static_cast<int64_t>(s_Value) - 1;
+}
+
+uint64_t CborReader::ReadUInt()
+{
+	return ReadHead(ECborMajorType::UnsignedInt, "unsigned integer");
+}
+
+double CborReader::ReadDouble()
+{
+	SkipIgnoredTags();
+
+	switch (PeekByte())
+	{
+		case 0xF9:
+		{
+			++m_Position;
+
+			const auto s_Half = static_cast<uint16_t>(ReadBigEndian(2));
+			const int s_Exponent = (s_Half >> 10) & 0x1F;
+			const int s_Mantissa = s_Half & 0x3FF;
+
+			double s_Value;
+
+			if (s_Exponent == 0)
+				s_Value = std::ldexp(s_Mantissa, -24);
+			else if (s_Exponent != 31)
+				s_Value = std::ldexp(s_Mantissa + 1024, s_Exponent - 25);
+			else
+				s_Value = s_Mantissa == 0 ? std::numeric_limits<double>::infinity() : std::numeric_limits<double>::quiet_NaN();
+
+			return (s_Half & 0x8000) ? -s_Value : s_Value;
+		}
+
+		case 0xFA:
+			++m_Position;
+			return std::bit_cast<float>(static_cast<uint32_t>(ReadBigEndian(4)));
+
+		case 0xFB:
+			++m_Position;
+			return std::bit_cast<double>(ReadBigEndian(8));
+
+		default:
+			break;
+	}
+
+	if (static_cast<ECborMajorType>(PeekByte() >> 5) == ECborMajorType::UnsignedInt)
+		return static_cast<double>(ReadUInt());
+
+	return static_cast<double>(ReadInt());
+}
+
+std::string_view CborReader::ReadText()
+{
+	const uint64_t s_Length = ReadHead(ECborMajorType::TextString, "text string");
+	return { reinterpret_cast<const char*>(ReadBytes(s_Length)), static_cast<size_t>(s_Length) };
+}
+
+CborContainer CborReader::ReadArray()
+{
+	SkipIgnoredTags();
+
+	const uint8_t s_Initial = ReadByte();
+
+	if (static_cast<ECborMajorType>(s_Initial >> 5) != ECborMajorType::Array)
+		throw std::runtime_error("Expected a CBOR array.");
+
+	if ((s_Initial & 0x1F) == 31)
+		return { 0, true };
+
+	return { static_cast<size_t>(ReadArgument(s_Initial & 0x1F)), false };
+}
+
+CborContainer CborReader::ReadMap()
+{
+	SkipIgnoredTags();
+
+	const uint8_t s_Initial = ReadByte();
+
+	if (static_cast<ECborMajorType>(s_Initial >> 5) != ECborMajorType::Map)
+		throw std::runtime_error("Expected a CBOR map.");
+
+	if ((s_Initial & 0x1F) == 31)
+		return { 0, true };
+
+	return { static_cast<size_t>(ReadArgument(s_Initial & 0x1F)), false };
+}
+
+bool CborReader::Next(CborContainer& p_Container)
+{
+	if (p_Container.m_Indefinite)
+	{
+		if (PeekByte() != 0xFF)
+			return true;
+
+		++m_Position;
+		return false;
+	}
+
+	if (p_Container.m_Remaining == 0)
+		return false;
+
+	--p_Container.m_Remaining;
+	return true;
+}
+
+size_t CborReader::Count(const CborContainer& p_Container)
+{
+	if (!p_Container.m_Indefinite)
+		return p_Container.m_Remaining;
+
+	// Indefinite length arrays have to be walked to know how long they are.
+	const auto s_Start = m_Position;
+	size_t s_Count = 0;
+
+	for (; PeekByte() != 0xFF; ++s_Count)
+		Skip();
+
+	m_Position = s_Start;
+
+	return s_Count;
+}
+
+std::optional<CborTypedArrayView> CborReader::TryReadTypedArray()
+{
+	SkipIgnoredTags();
+
+	if (static_cast<ECborMajorType>(PeekByte() >> 5) != ECborMajorType::Tag)
+		return std::nullopt;
+
+	const auto s_Kind = static_cast<ECborTypedArray>(ReadArgument(ReadByte() & 0x1F));
+	const auto s_ElementSize = CborTypedArrayElementSize(s_Kind);
+
+	const uint8_t s_Initial = ReadByte();
+
+	if (static_cast<ECborMajorType>(s_Initial >> 5) != ECborMajorType::ByteString || (s_Initial & 0x1F) == 31)
+		throw std::runtime_error("CBOR typed arrays must contain a definite length byte string.");
+
+	const uint64_t s_Length = ReadArgument(s_Initial & 0x1F);
+
+	if (s_Length % s_ElementSize != 0)
+		throw std::runtime_error("CBOR typed array size is not a multiple of its element size.");
+
+	return CborTypedArrayView { s_Kind, ReadBytes(s_Length), static_cast<size_t>(s_Length / s_ElementSize) };
+}
+
+void CborReader::Skip()
+{
+	const uint8_t s_Initial = ReadByte();
+	const auto s_Type = static_cast<ECborMajorType>(s_Initial >> 5);
+	const uint8_t s_Info = s_Initial & 0x1F;
+
+	switch (s_Type)
+	{
+		case ECborMajorType::UnsignedInt:
+		case ECborMajorType::NegativeInt:
+			ReadArgument(s_Info);
+			break;
+
+		case ECborMajorType::ByteString:
+		case ECborMajorType::TextString:
+		case ECborMajorType::Array:
+		case ECborMajorType::Map:
+		{
+			// Indefinite length strings are made up of chunks, which are skipped like any other item.
+			if (s_Info == 31)
+			{
+				while (PeekByte() != 0xFF)
+					Skip();
+
+				++m_Position;
+				break;
+			}
+
+			const uint64_t s_Length = ReadArgument(s_Info);
+
+			if (s_Type == ECborMajorType::ByteString || s_Type == ECborMajorType::TextString)
+			{
+				ReadBytes(s_Length);
+				break;
+			}
+
+			const uint64_t s_Items = s_Type == ECborMajorType::Map ? s_Length * 2 : s_Length;
+
+			for (uint64_t i = 0; i < s_Items; ++i)
+				Skip();
+
+			break;
+		}
+
+		case ECborMajorType::Tag:
+			ReadArgument(s_Info);
+			Skip();
+			break;
+
+		case ECborMajorType::Simple:
+			if (s_Info == 24)
+				ReadBytes(1);
+			else if (s_Info >= 25 && s_Info <= 27)
+				ReadBytes(size_t(1) << (s_Info - 24));
+			else if (s_Info >= 28)
+				throw std::runtime_error("Unsupported CBOR simple value.");
+
+			break;
+	}
+}
+
+uint8_t CborReader::PeekByte()
+{
+	if (m_Position >= m_Size)
+		throw std::runtime_error("Unexpected end of CBOR data.");
+
+	return m_Data[m_Position];
+}
+
+uint8_t CborReader::ReadByte()
+{
+	const uint8_t s_Byte = PeekByte();
+	++m_Position;
+
+	return s_Byte;
+}
+
+const uint8_t* CborReader::ReadBytes(uint64_t p_Count)
+{
+	if (p_Count > m_Size - m_Position)
+		throw std::runtime_error("Unexpected end of CBOR data.");
+
+	const auto* s_Bytes = m_Data + m_Position;
+	m_Position += p_Count;
+
+	return s_Bytes;
+}
+
+uint64_t CborReader::ReadBigEndian(size_t p_Size)
+{
+	const auto* s_Bytes = ReadBytes(p_Size);
+
+	uint64_t s_Value = 0;
+
+	for (size_t i = 0; i < p_Size; ++i)
+		s_Value = (s_Value << 8) | s_Bytes[i];
+
+	return s_Value;
+}
+
+uint64_t CborReader::ReadArgument(uint8_t p_Info)
+{
+	if (p_Info < 24)
+		return p_Info;
+
+	switch (p_Info)
+	{
+		case 24: return ReadBigEndian(1);
+		case 25: return ReadBigEndian(2);
+		case 26: return ReadBigEndian(4);
+		case 27: return ReadBigEndian(8);
+		default: throw std::runtime_error("Unsupported CBOR argument encoding.");
+	}
+}
+
+uint64_t CborReader::ReadHead(ECborMajorType p_ExpectedType, const char* p_Expected)
+{
+	SkipIgnoredTags();
+
+	const uint8_t s_Initial = ReadByte();
+
+	if (static_cast<ECborMajorType>(s_Initial >> 5) != p_ExpectedType)
+		throw std::runtime_error(std::string("Expected a CBOR ") + p_Expected + ".");
+
+	if ((s_Initial & 0x1F) == 31)
+		throw std::runtime_error(std::string("Indefinite length CBOR items are not supported here (expected a ") + p_Expected + ").");
+
+	return ReadArgument(s_Initial & 0x1F);
+}
+
+void CborReader::SkipIgnoredTags()
+{
+	while (static_cast<ECborMajorType>(PeekByte() >> 5) == ECborMajorType::Tag)
+	{
+		const auto s_Start = m_Position;
+		const uint64_t s_Tag = ReadArgument(ReadByte() & 0x1F);
+
+		// Typed arrays are the only tags that change how items are read. Everything else is ignored.
+		if (CborTypedArrayElementSize(static_cast<ECborTypedArray>(s_Tag)) != 0)
+		{
+			m_Position = s_Start;
+			return;
+		}
+	}
+}
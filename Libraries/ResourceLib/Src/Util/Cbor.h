@@ -0,0 +1,318 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+#include "BinaryStreamWriter.h"
+
+/**
+ * Encoding and decoding of the CBOR (RFC 8949) subset used for the binary representation of resources.
+ * Arrays of numbers are stored as little-endian typed arrays (RFC 8746), which are copied straight from
+ * and to the memory of the arrays they represent.
+ */
+enum class ECborMajorType : uint8_t
+{
+	UnsignedInt = 0,
+	NegativeInt = 1,
+	ByteString = 2,
+	TextString = 3,
+	Array = 4,
+	Map = 5,
+	Tag = 6,
+	Simple = 7,
+};
+
+// RFC 8746 typed array tags (little-endian variants).
+enum class ECborTypedArray : uint64_t
+{
+	None = 0,
+	UInt8 = 64,
+	UInt16 = 69,
+	UInt32 = 70,
+	UInt64 = 71,
+	Int8 = 72,
+	Int16 = 77,
+	Int32 = 78,
+	Int64 = 79,
+	Float32 = 85,
+	Float64 = 86,
+};
+
+static_assert(std::endian::native == std::endian::little, "Typed arrays are copied as is, so they must match the native byte order.");
+
+template <class T>
+constexpr ECborTypedArray CborTypedArrayOf()
+{
+	if constexpr (std::is_same_v<T, uint8_t>) return ECborTypedArray::UInt8;
+	else if constexpr (std::is_same_v<T, uint16_t>) return ECborTypedArray::UInt16;
+	else if constexpr (std::is_same_v<T, uint32_t>) return ECborTypedArray::UInt32;
+	else if constexpr (std::is_same_v<T, uint64_t>) return ECborTypedArray::UInt64;
+	else if constexpr (std::is_same_v<T, int8_t> || std::is_same_v<T, char>) return ECborTypedArray::Int8;
+	else if constexpr (std::is_same_v<T, int16_t>) return ECborTypedArray::Int16;
+	else if constexpr (std::is_same_v<T, int32_t>) return ECborTypedArray::Int32;
+	else if constexpr (std::is_same_v<T, int64_t>) return ECborTypedArray::Int64;
+	else if constexpr (std::is_same_v<T, float>) return ECborTypedArray::Float32;
+	else if constexpr (std::is_same_v<T, double>) return ECborTypedArray::Float64;
+	else return ECborTypedArray::None;
+}
+
+size_t CborTypedArrayElementSize(ECborTypedArray p_Kind);
+
+class CborWriter
+{
+public:
+	explicit CborWriter(BinaryStreamWriter& p_Stream) :
+		m_Stream(p_Stream)
+	{
+	}
+
+	void WriteHead(ECborMajorType p_Type, uint64_t p_Value)
+	{
+		const uint8_t s_Major = static_cast<uint8_t>(p_Type) << 5;
+
+		if (p_Value < 24)
+		{
+			m_Stream.Write<uint8_t>(s_Major | static_cast<uint8_t>(p_Value));
+		}
+		else if (p_Value <= 0xFF)
+		{
+			m_Stream.Write<uint8_t>(s_Major | 24);
+			m_Stream.Write<uint8_t>(static_cast<uint8_t>(p_Value));
+		}
+		else if (p_Value <= 0xFFFF)
+		{
+			m_Stream.Write<uint8_t>(s_Major | 25);
+			m_Stream.Write<uint16_t>(std::byteswap(static_cast<uint16_t>(p_Value)));
+		}
+		else if (p_Value <= 0xFFFFFFFF)
+		{
+			m_Stream.Write<uint8_t>(s_Major | 26);
+			m_Stream.Write<uint32_t>(std::byteswap(static_cast<uint32_t>(p_Value)));
+		}
+		else
+		{
+			m_Stream.Write<uint8_t>(s_Major | 27);
+			m_Stream.Write<uint64_t>(std::byteswap(p_Value));
+		}
+	}
+
+	void WriteNull()
+	{
+		m_Stream.Write<uint8_t>(0xF6);
+	}
+
+	void WriteBool(bool p_Value)
+	{
+		m_Stream.Write<uint8_t>(p_Value ? 0xF5 : 0xF4);
+	}
+
+	template <class T>
+	void WriteInteger(T p_Value)
+	{
+		if constexpr (std::is_signed_v<T>)
+		{
+			if (p_Value < 0)
+			{
+				WriteHead(ECborMajorType::NegativeInt, static_cast<uint64_t>(-(static_cast<int64_t>(p_Value) + 1)));
+				return;
+			}
+		}
+
+		WriteHead(ECborMajorType::UnsignedInt, static_cast<uint64_t>(p_Value));
+	}
+
+	void WriteFloat(float p_Value)
+	{
+		m_Stream.Write<uint8_t>(0xFA);
+		m_Stream.Write<uint32_t>(std::byteswap(std::bit_cast<uint32_t>(p_Value)));
+	}
+
+	// Doubles that a float holds exactly are written as one.
+	void WriteDouble(double p_Value)
+	{
+		if (static_cast<double>(static_cast<float>(p_Value)) == p_Value)
+			return WriteFloat(static_cast<float>(p_Value));
+
+		m_Stream.Write<uint8_t>(0xFB);
+		m_Stream.Write<uint64_t>(std::byteswap(std::bit_cast<uint64_t>(p_Value)));
+	}
+
+	void WriteText(std::string_view p_Value)
+	{
+		WriteHead(ECborMajorType::TextString, p_Value.size());
+		m_Stream.WriteBinary(p_Value.data(), p_Value.size());
+	}
+
+	void BeginArray(size_t p_Count)
+	{
+		WriteHead(ECborMajorType::Array, p_Count);
+	}
+
+	void BeginMap(size_t p_Count)
+	{
+		WriteHead(ECborMajorType::Map, p_Count);
+	}
+
+	template <class T>
+	void WriteTypedArray(const T* p_Values, size_t p_Count)
+	{
+		static_assert(CborTypedArrayOf<T>() != ECborTypedArray::None);
+
+		WriteHead(ECborMajorType::Tag, static_cast<uint64_t>(CborTypedArrayOf<T>()));
+		WriteHead(ECborMajorType::ByteString, p_Count * sizeof(T));
+
+		if (p_Count > 0)
+			m_Stream.WriteBinary(p_Values, p_Count * sizeof(T));
+	}
+
+private:
+	BinaryStreamWriter& m_Stream;
+};
+
+/**
+ * An array or map being read. Maps count their entries, not their keys and values.
+ */
+struct CborContainer
+{
+	size_t m_Remaining;
+	bool m_Indefinite;
+};
+
+struct CborTypedArrayView
+{
+	ECborTypedArray m_Kind;
+	const uint8_t* m_Data;
+	size_t m_Count;
+};
+
+/**
+ * Reads CBOR items from memory, throwing a [std::runtime_error] when they're malformed or not
+ * what the caller expects. Tags other than typed array ones are skipped over.
+ */
+class CborReader
+{
+public:
+	CborReader(const void* p_Data, size_t p_Size) :
+		m_Data(static_cast<const uint8_t*>(p_Data)),
+		m_Size(p_Size),
+		m_Position(0)
+	{
+	}
+
+	// Major type of the next item. Typed arrays are reported as [ECborMajorType::Tag].
+	ECborMajorType PeekType();
+
+	bool TryReadNull();
+	std::optional<bool> TryReadBool();
+	bool ReadBool();
+	int64_t ReadInt();
+	uint64_t ReadUInt();
+
+	// Any number, be it an integer or a half, single or double precision float.
+	double ReadDouble();
+
+	std::string_view ReadText();
+
+	CborContainer ReadArray();
+	CborContainer ReadMap();
+
+	/**
+	 * Returns [true] if there's another item (or map entry) left in [p_Container], and [false] once
+	 * the end of it has been reached and consumed.
+	 */
+	bool Next(CborContainer& p_Container);
+
+	// Number of items (or map entries) left in [p_Container], without consuming any of them.
+	size_t Count(const CborContainer& p_Container);
+
+	std::optional<CborTypedArrayView> TryReadTypedArray();
+
+	void Skip();
+
+	template <class T>
+	T ReadInteger()
+	{
+		if constexpr (std::is_signed_v<T>)
+			return static_cast<T>(ReadInt());
+		else
+			return static_cast<T>(ReadUInt());
+	}
+
+	/**
+	 * Converts the elements of [p_Array] to [T] and stores them in [p_Output], which must hold
+	 * [p_Array.m_Count] of them.
+	 */
+	template <class T>
+	static void ReadTypedArray(const CborTypedArrayView& p_Array, T* p_Output)
+	{
+		if (p_Array.m_Count == 0)
+			return;
+
+		if (p_Array.m_Kind == CborTypedArrayOf<T>())
+		{
+			memcpy(p_Output, p_Array.m_Data, p_Array.m_Count * sizeof(T));
+			return;
+		}
+
+		switch (p_Array.m_Kind)
+		{
+			case ECborTypedArray::UInt8: ConvertTypedArray<uint8_t>(p_Array, p_Output); break;
+			case ECborTypedArray::UInt16: ConvertTypedArray<uint16_t>(p_Array, p_Output); break;
+			case ECborTypedArray::UInt32: ConvertTypedArray<uint32_t>(p_Array, p_Output); break;
+			case ECborTypedArray::UInt64: ConvertTypedArray<uint64_t>(p_Array, p_Output); break;
+			case ECborTypedArray::Int8: ConvertTypedArray<int8_t>(p_Array, p_Output); break;
+			case ECborTypedArray::Int16: ConvertTypedArray<int16_t>(p_Array, p_Output); break;
+			case ECborTypedArray::Int32: ConvertTypedArray<int32_t>(p_Array, p_Output); break;
+			case ECborTypedArray::Int64: ConvertTypedArray<int64_t>(p_Array, p_Output); break;
+			case ECborTypedArray::Float32: ConvertTypedArray<float>(p_Array, p_Output); break;
+			case ECborTypedArray::Float64: ConvertTypedArray<double>(p_Array, p_Output); break;
+			default: break;
+		}
+	}
+
+	[[nodiscard]] size_t Position() const
+	{
+		return m_Position;
+	}
+
+	void Seek(size_t p_Position)
+	{
+		m_Position = p_Position;
+	}
+
+	[[nodiscard]] bool AtEnd() const
+	{
+		return m_Position == m_Size;
+	}
+
+private:
+	template <class TSource, class T>
+	static void ConvertTypedArray(const CborTypedArrayView& p_Array, T* p_Output)
+	{
+		for (size_t i = 0; i < p_Array.m_Count; ++i)
+		{
+			TSource s_Value;
+			memcpy(&s_Value, p_Array.m_Data + i * sizeof(TSource), sizeof(TSource));
+			p_Output[i] = static_cast<T>(s_Value);
+		}
+	}
+
+	uint8_t PeekByte();
+	uint8_t ReadByte();
+	const uint8_t* ReadBytes(uint64_t p_Count);
+	uint64_t ReadBigEndian(size_t p_Size);
+	uint64_t ReadArgument(uint8_t p_Info);
+	uint64_t ReadHead(ECborMajorType p_ExpectedType, const char* p_Expected);
+	void SkipIgnoredTags();
+
+private:
+	const uint8_t* m_Data;
+	size_t m_Size;
+	size_t m_Position;
+};
@@ -0,0 +1,115 @@
+#pragma once
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define RL_X86 1
+#else
+#define RL_X86 0
+#endif
+
+#if RL_X86
+#if _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#include <immintrin.h>
+#endif
+
+// Functions using instruction sets beyond the compiler baseline must be marked with these, so
+// they can be compiled without enabling those instruction sets for the whole library.
+#if RL_X86 && !_MSC_VER
+#define RL_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define RL_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define RL_TARGET_AVX2 __attribute__((target("avx2")))
+#define RL_TARGET_PCLMUL __attribute__((target("pclmul,sse4.1")))
+#else
+#define RL_TARGET_SSSE3
+#define RL_TARGET_SSE41
+#define RL_TARGET_AVX2
+#define RL_TARGET_PCLMUL
+#endif
+
+/**
+ * Instruction set extensions supported by the CPU we're running on, used to pick
+ * between the different implementations of hot loops at runtime.
+ */
+struct CpuFeatures
+{
+	bool SSSE3;
+	bool SSE41;
+	bool AVX2;
+	bool PCLMUL;
+
+	static const CpuFeatures& Get()
+	{
+		static const CpuFeatures s_Features = Detect();
+		return s_Features;
+	}
+
+private:
+	static CpuFeatures Detect()
+	{
+		CpuFeatures s_Features {};
+
+#if RL_X86
+		unsigned int s_Leaf1[4] {};
+		unsigned int s_Leaf7[4] {};
+
+		// ecx and ebx registers, respectively.
+		unsigned int& s_Leaf1Ecx = s_Leaf1[2];
+		unsigned int& s_Leaf7Ebx = s_Leaf7[1];
+
+#if _MSC_VER
+		int s_Info[4];
+
+		__cpuid(s_Info, 0);
+		const auto s_MaxLeaf = static_cast<unsigned int>(s_Info[0]);
+
+		__cpuid(s_Info, 1);
+		for (int i = 0; i < 4; ++i)
+			s_Leaf1[i] = static_cast<unsigned int>(s_Info[i]);
+
+		if (s_MaxLeaf >= 7)
+		{
+			__cpuidex(s_Info, 7, 0);
+			for (int i = 0; i < 4; ++i)
+				s_Leaf7[i] = static_cast<unsigned int>(s_Info[i]);
+		}
+#else
+		const auto s_MaxLeaf = __get_cpuid_max(0, nullptr);
+
+		__cpuid(1, s_Leaf1[0], s_Leaf1[1], s_Leaf1[2], s_Leaf1[3]);
+
+		if (s_MaxLeaf >= 7)
+			__cpuid_count(7, 0, s_Leaf7[0], s_Leaf7[1], s_Leaf7[2], s_Leaf7[3]);
+#endif
+
+		s_Features.SSSE3 = (s_Leaf1Ecx & (1 << 9)) != 0;
+		s_Features.SSE41 = (s_Leaf1Ecx & (1 << 19)) != 0;
+		s_Features.PCLMUL = (s_Leaf1Ecx & (1 << 1)) != 0;
+
+		// AVX2 also needs the OS to save the upper halves of the ymm registers.
+		const bool s_OsSavesYmm = (s_Leaf1Ecx & (1 << 27)) != 0 && (s_Leaf1Ecx & (1 << 28)) != 0 && (ReadXcr0() & 0x6) == 0x6;
+		s_Features.AVX2 = s_OsSavesYmm && (s_Leaf7Ebx & (1 << 5)) != 0;
+#endif
+
+		return s_Features;
+	}
+
+#if RL_X86
+#if _MSC_VER
+	static unsigned long long ReadXcr0()
+	{
+		return _xgetbv(0);
+	}
+#else
+	__attribute__((target("xsave")))
+	static unsigned long long ReadXcr0()
+	{
+		unsigned int s_Eax, s_Edx;
+		__asm__ volatile("xgetbv" : "=a"(s_Eax), "=d"(s_Edx) : "c"(0));
+		return (static_cast<unsigned long long>(s_Edx) << 32) | s_Eax;
+	}
+#endif
+#endif
+};
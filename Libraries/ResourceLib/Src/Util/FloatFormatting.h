@@ -0,0 +1,49 @@
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <type_traits>
+
+#include <External/simdjson.h>
+
+/**
+ * Enough space for the shortest representation of any float or double
+ * (eg. -2.2250738585072014e-308), plus a ".0" suffix.
+ */
+constexpr size_t c_MaxFloatChars = 32;
+
+/**
+ * Writes the shortest decimal representation that parses back to exactly the same value.
+ * Floats are formatted with float precision (eg. 0.1f is written as 0.1 instead of 0.10000000149011612),
+ * so they still round-trip bit-exactly when read back as a double and narrowed to a float.
+ *
+ * Integral values are suffixed with ".0" so they stay recognizable as floating point numbers.
+ * Returns a pointer past the last written character. [p_Buffer] must have room for [c_MaxFloatChars] characters.
+ */
+template <class T>
+inline char* WriteShortestFloat(char* p_Buffer, T p_Value)
+{
+	static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>);
+
+#if defined(__cpp_lib_to_chars)
+	char* s_End = std::to_chars(p_Buffer, p_Buffer + c_MaxFloatChars, p_Value).ptr;
+
+	const auto s_IsIntegral = std::none_of(p_Buffer, s_End, [](char p_Char)
+	{
+		return p_Char == '.' || p_Char == 'e' || p_Char == 'n' || p_Char == 'i';
+	});
+
+	if (s_IsIntegral)
+	{
+		*s_End++ = '.';
+		*s_End++ = '0';
+	}
+
+	return s_End;
+#else
+	// The standard library doesn't support floating point to_chars, so fall back to simdjson's
+	// implementation. It only works with doubles, so floats will be written with double precision.
+	return simdjson::internal::to_chars(p_Buffer, nullptr, static_cast<double>(p_Value));
+#endif
+}
@@ -0,0 +1,81 @@
+#include "JobProgress.h"
+
+static thread_local JobProgress* g_CurrentProgress = nullptr;
+
+JobProgress* JobProgress::Current()
+{
+	return g_CurrentProgress;
+}
+
+JobProgress::Scope::Scope(JobProgress* p_Progress) :
+	m_Previous(g_CurrentProgress)
+{
+	g_CurrentProgress = p_Progress;
+}
+
+JobProgress::Scope::~Scope()
+{
+	g_CurrentProgress = m_Previous;
+}
+
+JobProgress* JobProgress::BeginElements(size_t p_Count)
+{
+	auto* s_Progress = g_CurrentProgress;
+
+	if (!s_Progress)
+		return nullptr;
+
+	s_Progress->ThrowIfCancelled();
+
+	if (p_Count < c_MinElements)
+		return nullptr;
+
+	s_Progress->m_TotalElements.fetch_add(p_Count, std::memory_order_relaxed);
+	return s_Progress;
+}
+
+void JobProgress::CompleteElements(size_t p_Count)
+{
+	ThrowIfCancelled();
+	m_CompletedElements.fetch_add(p_Count, std::memory_order_relaxed);
+}
+
+void JobProgress::EnterPhase(ResourcePhase p_Phase)
+{
+	ThrowIfCancelled();
+
+	m_Phase.store(p_Phase, std::memory_order_relaxed);
+	m_CompletedElements.store(0, std::memory_order_relaxed);
+	m_TotalElements.store(0, std::memory_order_relaxed);
+}
+
+void JobProgress::Cancel()
+{
+	m_Cancelled.store(true, std::memory_order_relaxed);
+}
+
+bool JobProgress::IsCancelled() const
+{
+	return m_Cancelled.load(std::memory_order_relaxed);
+}
+
+void JobProgress::ThrowIfCancelled() const
+{
+	if (IsCancelled())
+		throw JobCancelledError();
+}
+
+ResourcePhase JobProgress::Phase() const
+{
+	return static_cast<ResourcePhase>(m_Phase.load(std::memory_order_relaxed));
+}
+
+uint64_t JobProgress::CompletedElements() const
+{
+	return m_CompletedElements.load(std::memory_order_relaxed);
+}
+
+uint64_t JobProgress::TotalElements() const
+{
+	return m_TotalElements.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#include <ResourceLibCommon.h>
+
+/**
+ * Thrown from inside a job once it has been cancelled, to unwind whatever it was doing.
+ */
+class JobCancelledError : public std::runtime_error
+{
+public:
+	JobCancelledError() : std::runtime_error("The job was cancelled.") {}
+};
+
+/**
+ * The progress and cancellation state of an asynchronous job. The thread running a job makes its progress current,
+ * and resources report the phase they're in and the elements of huge arrays they've gone through to it. Both of
+ * these also throw [JobCancelledError] once the job has been cancelled, which is how jobs stop mid-conversion.
+ */
+class JobProgress
+{
+public:
+	// Arrays smaller than this are done quickly enough that they don't report progress.
+	static constexpr size_t c_MinElements = 256;
+
+	/**
+	 * The progress of the job the calling thread is working on, or [nullptr] if it isn't working on one.
+	 */
+	static JobProgress* Current();
+
+	/**
+	 * Makes a job's progress current on the calling thread while it is alive. Worker threads use this to
+	 * report to the job of the thread that handed them work.
+	 */
+	class Scope
+	{
+	public:
+		explicit Scope(JobProgress* p_Progress);
+		~Scope();
+
+		Scope(const Scope&) = delete;
+		Scope& operator=(const Scope&) = delete;
+
+	private:
+		JobProgress* m_Previous;
+	};
+
+	/**
+	 * Returns the progress of the current job if an array of [p_Count] elements is big enough to report progress for,
+	 * after adding its elements to the total of the current phase. Returns [nullptr] otherwise.
+	 * Throws [JobCancelledError] if the job was cancelled.
+	 */
+	static JobProgress* BeginElements(size_t p_Count);
+
+	/**
+	 * Marks [p_Count] of the elements added by [BeginElements] as done.
+	 * Throws [JobCancelledError] if the job was cancelled.
+	 */
+	void CompleteElements(size_t p_Count);
+
+	/**
+	 * Moves the job to [p_Phase] and resets the element counts.
+	 * Throws [JobCancelledError] if the job was cancelled.
+	 */
+	void EnterPhase(ResourcePhase p_Phase);
+
+	void Cancel();
+	bool IsCancelled() const;
+	void ThrowIfCancelled() const;
+
+	ResourcePhase Phase() const;
+	uint64_t CompletedElements() const;
+	uint64_t TotalElements() const;
+
+private:
+	std::atomic<bool> m_Cancelled = false;
+	std::atomic<int> m_Phase = ResourcePhase_FileIO;
+	std::atomic<uint64_t> m_CompletedElements = 0;
+	std::atomic<uint64_t> m_TotalElements = 0;
+};
@@ -0,0 +1,620 @@
+#include "NumericArrayJson.h"
+
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include <External/simdjson.h>
+
+#include "CpuFeatures.h"
+#include "FloatFormatting.h"
+
+static constexpr size_t c_ChunkSize = 16384;
+
+// The SSSE3 writer always stores 8 digits at a time, so the buffer needs some slack past the last element.
+static constexpr size_t c_ChunkSlack = 16;
+
+// The longest representation of a value of type T, including the separator that follows it.
+template <class T>
+static constexpr size_t c_MaxElementChars =
+	std::is_same_v<T, bool> ? sizeof("false") :
+	std::is_floating_point_v<T> ? c_MaxFloatChars + 1 :
+	std::numeric_limits<T>::digits10 + 3;
+
+struct SmallNumber
+{
+	char m_Chars[3];
+	uint8_t m_Length;
+};
+
+// Decimal representations of 0 - 255, used for byte-sized integers.
+static constexpr auto c_SmallNumbers = []
+{
+	std::array<SmallNumber, 256> s_Table {};
+
+	for (int i = 0; i < 256; ++i)
+	{
+		auto& s_Entry = s_Table[i];
+
+		if (i >= 100)
+			s_Entry.m_Chars[s_Entry.m_Length++] = static_cast<char>('0' + i / 100);
+
+		if (i >= 10)
+			s_Entry.m_Chars[s_Entry.m_Length++] = static_cast<char>('0' + i / 10 % 10);
+
+		s_Entry.m_Chars[s_Entry.m_Length++] = static_cast<char>('0' + i % 10);
+	}
+
+	return s_Table;
+}();
+
+[[noreturn]] static void ThrowMalformed()
+{
+	throw std::runtime_error("Malformed numeric json array.");
+}
+
+static bool IsWhitespace(char p_Char)
+{
+	return p_Char == ' ' || p_Char == '\t' || p_Char == '\n' || p_Char == '\r';
+}
+
+static bool IsDigit(char p_Char)
+{
+	return p_Char >= '0' && p_Char <= '9';
+}
+
+static const char* SkipWhitespace(const char* p_Current, const char* p_End)
+{
+	while (p_Current < p_End && IsWhitespace(*p_Current))
+		++p_Current;
+
+	return p_Current;
+}
+
+static char* WriteSmallNumber(char* p_Output, uint8_t p_Value)
+{
+	const auto& s_Entry = c_SmallNumbers[p_Value];
+	memcpy(p_Output, s_Entry.m_Chars, sizeof(s_Entry.m_Chars));
+	return p_Output + s_Entry.m_Length;
+}
+
+template <class T>
+static char* WriteElementScalar(char* p_Output, T p_Value)
+{
+	if constexpr (std::is_same_v<T, bool>)
+	{
+		memcpy(p_Output, p_Value ? "true" : "false", 5);
+		return p_Output + (p_Value ? 4 : 5);
+	}
+	else if constexpr (std::is_floating_point_v<T>)
+	{
+		return WriteShortestFloat(p_Output, p_Value);
+	}
+	else if constexpr (std::is_same_v<T, uint8_t>)
+	{
+		return WriteSmallNumber(p_Output, p_Value);
+	}
+	else if constexpr (std::is_same_v<T, int8_t>)
+	{
+		if (p_Value < 0)
+			*p_Output++ = '-';
+
+		return WriteSmallNumber(p_Output, static_cast<uint8_t>(p_Value < 0 ? -p_Value : p_Value));
+	}
+	else if constexpr (std::is_signed_v<T>)
+	{
+		return simdjson::fast_itoa(p_Output, static_cast<int64_t>(p_Value));
+	}
+	else
+	{
+		return simdjson::fast_itoa(p_Output, static_cast<uint64_t>(p_Value));
+	}
+}
+
+template <class T>
+static char* WriteElementsScalar(char* p_Output, const T* p_Values, size_t p_Count)
+{
+	for (size_t i = 0; i < p_Count; ++i)
+	{
+		p_Output = WriteElementScalar(p_Output, p_Values[i]);
+		*p_Output++ = ',';
+	}
+
+	return p_Output;
+}
+
+#if RL_X86
+// The integer formatting below is based on the SSE2 conversion described by Wojciech Mula
+// in "SSE: conversion integers to decimal representation" (2011).
+
+// Returns the 8 decimal digits of [p_Value], which must be below 100000000, as characters in the low 8 bytes.
+RL_TARGET_SSSE3
+static __m128i Digits8SSSE3(uint32_t p_Value)
+{
+	// abcd, efgh = abcdefgh divmod 10000
+	const __m128i s_Abcdefgh = _mm_cvtsi32_si128(static_cast<int>(p_Value));
+	const __m128i s_Abcd = _mm_srli_epi64(_mm_mul_epu32(s_Abcdefgh, _mm_set1_epi32(static_cast<int>(0xD1B71759))), 45);
+	const __m128i s_Efgh = _mm_sub_epi32(s_Abcdefgh, _mm_mul_epu32(s_Abcd, _mm_set1_epi32(10000)));
+
+	// [abcd * 4 (x4), efgh * 4 (x4)]
+	const __m128i s_Halves = _mm_slli_epi64(_mm_unpacklo_epi16(s_Abcd, s_Efgh), 2);
+	const __m128i s_Spread = _mm_unpacklo_epi16(s_Halves, s_Halves);
+	const __m128i s_Broadcast = _mm_unpacklo_epi32(s_Spread, s_Spread);
+
+	// Divide by 1000, 100, 10 and 1 through multiplication: [a, ab, abc, abcd, e, ef, efg, efgh]
+	const __m128i s_Dividers = _mm_setr_epi16(8389, 5243, 13108, -32768, 8389, 5243, 13108, -32768);
+	const __m128i s_Shifts = _mm_setr_epi16(1 << 7, 1 << 11, 1 << 13, -32768, 1 << 7, 1 << 11, 1 << 13, -32768);
+	const __m128i s_Prefixes = _mm_mulhi_epu16(_mm_mulhi_epu16(s_Broadcast, s_Dividers), s_Shifts);
+
+	// Subtract the previous prefix times 10 to get the individual digits: [a, b, c, d, e, f, g, h]
+	const __m128i s_Tens = _mm_slli_epi64(_mm_mullo_epi16(s_Prefixes, _mm_set1_epi16(10)), 16);
+	const __m128i s_Digits = _mm_sub_epi16(s_Prefixes, s_Tens);
+
+	return _mm_add_epi8(_mm_packus_epi16(s_Digits, _mm_setzero_si128()), _mm_set1_epi8('0'));
+}
+
+// Writes [p_Value], which must be below 100000000, without leading zeros. Always stores 8 bytes.
+RL_TARGET_SSSE3
+static char* WriteDigitsTrimmedSSSE3(char* p_Output, uint32_t p_Value)
+{
+	const __m128i s_Digits = Digits8SSSE3(p_Value);
+	const auto s_Zeros = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(s_Digits, _mm_set1_epi8('0'))));
+
+	// The last digit is always kept, even if the whole value is zero.
+	const int s_LeadingZeros = std::countr_one(s_Zeros & 0x7F);
+
+	alignas(16) char s_Buffer[16];
+	_mm_store_si128(reinterpret_cast<__m128i*>(s_Buffer), s_Digits);
+	memcpy(p_Output, s_Buffer + s_LeadingZeros, 8);
+
+	return p_Output + 8 - s_LeadingZeros;
+}
+
+RL_TARGET_SSSE3
+static char* WriteDigitsSSSE3(char* p_Output, uint64_t p_Value)
+{
+	if (p_Value < 100000000)
+		return WriteDigitsTrimmedSSSE3(p_Output, static_cast<uint32_t>(p_Value));
+
+	if (p_Value < 10000000000000000)
+	{
+		p_Output = WriteDigitsTrimmedSSSE3(p_Output, static_cast<uint32_t>(p_Value / 100000000));
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(p_Output), Digits8SSSE3(static_cast<uint32_t>(p_Value % 100000000)));
+		return p_Output + 8;
+	}
+
+	const uint64_t s_Low = p_Value % 10000000000000000;
+
+	p_Output = WriteDigitsTrimmedSSSE3(p_Output, static_cast<uint32_t>(p_Value / 10000000000000000));
+	_mm_storel_epi64(reinterpret_cast<__m128i*>(p_Output), Digits8SSSE3(static_cast<uint32_t>(s_Low / 100000000)));
+	_mm_storel_epi64(reinterpret_cast<__m128i*>(p_Output + 8), Digits8SSSE3(static_cast<uint32_t>(s_Low % 100000000)));
+
+	return p_Output + 16;
+}
+
+template <class T>
+RL_TARGET_SSSE3
+static char* WriteIntegersSSSE3(char* p_Output, const T* p_Values, size_t p_Count)
+{
+	for (size_t i = 0; i < p_Count; ++i)
+	{
+		const T s_Value = p_Values[i];
+
+		if constexpr (std::is_signed_v<T>)
+		{
+			if (s_Value < 0)
+			{
+				*p_Output++ = '-';
+				p_Output = WriteDigitsSSSE3(p_Output, 0 - static_cast<uint64_t>(s_Value));
+			}
+			else
+			{
+				p_Output = WriteDigitsSSSE3(p_Output, static_cast<uint64_t>(s_Value));
+			}
+		}
+		else
+		{
+			p_Output = WriteDigitsSSSE3(p_Output, s_Value);
+		}
+
+		*p_Output++ = ',';
+	}
+
+	return p_Output;
+}
+
+// Shuffles that move the first N bytes of a vector to its end and zero the rest, for N = 0 - 16.
+static constexpr auto c_AlignRightShuffles = []
+{
+	std::array<std::array<uint8_t, 16>, 17> s_Shuffles {};
+
+	for (int n = 0; n <= 16; ++n)
+		for (int i = 0; i < 16; ++i)
+			s_Shuffles[n][i] = i >= 16 - n ? static_cast<uint8_t>(i - (16 - n)) : 0x80;
+
+	return s_Shuffles;
+}();
+
+// Parses the run of digits at [p_Input], which must have at least 16 readable bytes.
+// Returns the end of the run, or nullptr if it's 16 or more digits long.
+RL_TARGET_SSSE3
+static const char* ParseDigitsSSSE3(const char* p_Input, uint64_t& p_Value)
+{
+	const __m128i s_Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_Input));
+	const __m128i s_Digits = _mm_sub_epi8(s_Chunk, _mm_set1_epi8('0'));
+	const __m128i s_IsDigit = _mm_cmpeq_epi8(_mm_min_epu8(s_Digits, _mm_set1_epi8(9)), s_Digits);
+	const auto s_NonDigits = ~static_cast<uint32_t>(_mm_movemask_epi8(s_IsDigit)) & 0xFFFF;
+
+	if (s_NonDigits == 0)
+		return nullptr;
+
+	const int s_Count = std::countr_zero(s_NonDigits);
+	const __m128i s_Shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c_AlignRightShuffles[s_Count].data()));
+	const __m128i s_Aligned = _mm_shuffle_epi8(s_Digits, s_Shuffle);
+
+	// Combine digits into pairs, then quads, then two halves of 8 digits each.
+	const __m128i s_Pairs = _mm_maddubs_epi16(s_Aligned, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+	const __m128i s_Quads = _mm_madd_epi16(s_Pairs, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+	const __m128i s_Packed = _mm_packs_epi32(s_Quads, s_Quads);
+	const __m128i s_Halves = _mm_madd_epi16(s_Packed, _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+
+	const auto s_High = static_cast<uint32_t>(_mm_cvtsi128_si32(s_Halves));
+	const auto s_Low = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(s_Halves, 4)));
+
+	p_Value = static_cast<uint64_t>(s_High) * 100000000 + s_Low;
+
+	return p_Input + s_Count;
+}
+#endif
+
+static const char* ParseDigitsScalar(const char* p_Current, const char* p_End, uint64_t& p_Value)
+{
+	const char* s_DigitsEnd = p_Current;
+
+	while (s_DigitsEnd < p_End && IsDigit(*s_DigitsEnd))
+		++s_DigitsEnd;
+
+	if (s_DigitsEnd == p_Current)
+		return s_DigitsEnd;
+
+	const auto s_Result = std::from_chars(p_Current, s_DigitsEnd, p_Value);
+
+	if (s_Result.ec != std::errc())
+		ThrowMalformed();
+
+	return s_DigitsEnd;
+}
+
+template <class T>
+static const char* ParseInteger(const char* p_Current, const char* p_End, bool p_UseSimd, T& p_Value)
+{
+	bool s_Negative = false;
+
+	if constexpr (std::is_signed_v<T>)
+	{
+		if (p_Current < p_End && *p_Current == '-')
+		{
+			s_Negative = true;
+			++p_Current;
+		}
+	}
+
+	uint64_t s_Magnitude = 0;
+	const char* s_DigitsEnd = nullptr;
+
+#if RL_X86
+	if (p_UseSimd && p_End - p_Current >= 16)
+		s_DigitsEnd = ParseDigitsSSSE3(p_Current, s_Magnitude);
+#endif
+
+	if (!s_DigitsEnd)
+		s_DigitsEnd = ParseDigitsScalar(p_Current, p_End, s_Magnitude);
+
+	// Json doesn't allow leading zeros.
+	if (s_DigitsEnd == p_Current || (*p_Current == '0' && s_DigitsEnd - p_Current > 1))
+		ThrowMalformed();
+
+	if constexpr (std::is_signed_v<T>)
+	{
+		constexpr auto c_Max = static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+
+		if (s_Magnitude > c_Max + (s_Negative ? 1 : 0))
+			ThrowMalformed();
+
+		p_Value = static_cast<T>(s_Negative ? static_cast<int64_t>(0 - s_Magnitude) : static_cast<int64_t>(s_Magnitude));
+	}
+	else
+	{
+		p_Value = static_cast<T>(s_Magnitude);
+	}
+
+	return s_DigitsEnd;
+}
+
+// Returns the end of the json number at [p_Current], or nullptr if there isn't a valid one.
+static const char* ScanNumber(const char* p_Current, const char* p_End)
+{
+	if (p_Current < p_End && *p_Current == '-')
+		++p_Current;
+
+	if (p_Current == p_End || !IsDigit(*p_Current))
+		return nullptr;
+
+	if (*p_Current++ != '0')
+		while (p_Current < p_End && IsDigit(*p_Current))
+			++p_Current;
+
+	if (p_Current < p_End && *p_Current == '.')
+	{
+		if (++p_Current == p_End || !IsDigit(*p_Current))
+			return nullptr;
+
+		while (p_Current < p_End && IsDigit(*p_Current))
+			++p_Current;
+	}
+
+	if (p_Current < p_End && (*p_Current == 'e' || *p_Current == 'E'))
+	{
+		if (++p_Current < p_End && (*p_Current == '+' || *p_Current == '-'))
+			++p_Current;
+
+		if (p_Current == p_End || !IsDigit(*p_Current))
+			return nullptr;
+
+		while (p_Current < p_End && IsDigit(*p_Current))
+			++p_Current;
+	}
+
+	return p_Current;
+}
+
+// Parses numbers with up to 19 significant digits whose value is exactly representable as w * 10^e,
+// with w < 2^53 and |e| <= 22. Both operands are then exact doubles, so a single multiplication or
+// division rounds correctly (Clinger's fast path). Returns false for anything else.
+static bool ParseFloatFast(const char* p_Current, const char* p_End, double& p_Value)
+{
+	static constexpr double c_PowersOf10[] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+
+	const bool s_Negative = *p_Current == '-';
+
+	if (s_Negative)
+		++p_Current;
+
+	uint64_t s_Mantissa = 0;
+	int s_Digits = 0;
+	int s_Exponent = 0;
+
+	for (; p_Current < p_End && IsDigit(*p_Current); ++p_Current, ++s_Digits)
+		s_Mantissa = s_Mantissa * 10 + (*p_Current - '0');
+
+	if (p_Current < p_End && *p_Current == '.')
+	{
+		for (++p_Current; p_Current < p_End && IsDigit(*p_Current); ++p_Current, ++s_Digits, --s_Exponent)
+			s_Mantissa = s_Mantissa * 10 + (*p_Current - '0');
+	}
+
+	if (p_Current < p_End)
+	{
+		// Exponents are rare enough in our data to leave them to the slow path.
+		return false;
+	}
+
+	if (s_Digits > 19 || s_Mantissa > (uint64_t(1) << 53) || s_Exponent < -22)
+		return false;
+
+	const double s_Value = s_Exponent < 0
+		? static_cast<double>(s_Mantissa) / c_PowersOf10[-s_Exponent]
+		: static_cast<double>(s_Mantissa);
+
+	p_Value = s_Negative ? -s_Value : s_Value;
+
+	return true;
+}
+
+template <class T>
+static const char* ParseFloat(const char* p_Current, const char* p_End, T& p_Value)
+{
+	const char* s_NumberEnd = ScanNumber(p_Current, p_End);
+
+	if (!s_NumberEnd)
+		ThrowMalformed();
+
+	double s_Value = 0.0;
+
+	if (ParseFloatFast(p_Current, s_NumberEnd, s_Value))
+	{
+		p_Value = static_cast<T>(s_Value);
+		return s_NumberEnd;
+	}
+
+#if defined(__cpp_lib_to_chars)
+	const auto s_Result = std::from_chars(p_Current, s_NumberEnd, s_Value);
+
+	// Some implementations report subnormal values as out of range, so let simdjson take care of those.
+	if (s_Result.ec == std::errc::result_out_of_range)
+		s_Value = simdjson::internal::from_chars(p_Current, s_NumberEnd);
+	else if (s_Result.ec != std::errc())
+		ThrowMalformed();
+#else
+	s_Value = simdjson::internal::from_chars(p_Current, s_NumberEnd);
+#endif
+
+	if (!std::isfinite(s_Value))
+		ThrowMalformed();
+
+	p_Value = static_cast<T>(s_Value);
+
+	return s_NumberEnd;
+}
+
+static const char* ParseBool(const char* p_Current, const char* p_End, bool& p_Value)
+{
+	if (p_End - p_Current >= 4 && memcmp(p_Current, "true", 4) == 0)
+	{
+		p_Value = true;
+		return p_Current + 4;
+	}
+
+	if (p_End - p_Current >= 5 && memcmp(p_Current, "false", 5) == 0)
+	{
+		p_Value = false;
+		return p_Current + 5;
+	}
+
+	ThrowMalformed();
+}
+
+template <class T>
+void NumericArrayJson::Write(const T* p_Values, size_t p_Count, std::ostream& p_Stream)
+{
+	if (p_Count == 0)
+	{
+		p_Stream << "[]";
+		return;
+	}
+
+	constexpr size_t c_ElementsPerChunk = c_ChunkSize / c_MaxElementChars<T>;
+
+	char s_Buffer[c_ChunkSize + c_ChunkSlack];
+	s_Buffer[0] = '[';
+
+	char* s_Output = s_Buffer + 1;
+
+	for (size_t s_Offset = 0; s_Offset < p_Count; s_Offset += c_ElementsPerChunk)
+	{
+		const size_t s_ChunkCount = std::min(c_ElementsPerChunk, p_Count - s_Offset);
+
+#if RL_X86
+		if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) > 1)
+		{
+			if (CpuFeatures::Get().SSSE3)
+				s_Output = WriteIntegersSSSE3(s_Output, p_Values + s_Offset, s_ChunkCount);
+			else
+				s_Output = WriteElementsScalar(s_Output, p_Values + s_Offset, s_ChunkCount);
+		}
+		else
+#endif
+		{
+			s_Output = WriteElementsScalar(s_Output, p_Values + s_Offset, s_ChunkCount);
+		}
+
+		// Every element is followed by a comma, so the last one gets replaced with the closing bracket.
+		if (s_Offset + s_ChunkCount == p_Count)
+			s_Output[-1] = ']';
+
+		p_Stream.write(s_Buffer, s_Output - s_Buffer);
+		s_Output = s_Buffer;
+	}
+}
+
+size_t NumericArrayJson::Count(std::string_view p_Json)
+{
+	const char* s_Begin = SkipWhitespace(p_Json.data(), p_Json.data() + p_Json.size());
+	const char* s_End = p_Json.data() + p_Json.size();
+
+	while (s_End > s_Begin && IsWhitespace(s_End[-1]))
+		--s_End;
+
+	if (s_End - s_Begin < 2 || *s_Begin != '[' || s_End[-1] != ']')
+		ThrowMalformed();
+
+	// Skip the brackets.
+	const char* s_Current = s_Begin + 1;
+	const char* s_ContentEnd = s_End - 1;
+
+	// Elements can only be numbers or booleans, so every comma separates two of them.
+	size_t s_Commas = 0;
+
+#if RL_X86
+	if (CpuFeatures::Get().SSSE3)
+	{
+		for (; s_ContentEnd - s_Current >= 16; s_Current += 16)
+		{
+			const __m128i s_Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s_Current));
+			const auto s_Mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(s_Chunk, _mm_set1_epi8(','))));
+			s_Commas += std::popcount(s_Mask);
+		}
+	}
+#endif
+
+	for (; s_Current < s_ContentEnd; ++s_Current)
+		s_Commas += *s_Current == ',';
+
+	if (s_Commas > 0)
+		return s_Commas + 1;
+
+	// With no commas we have either a single element or none at all.
+	return SkipWhitespace(s_Begin + 1, s_ContentEnd) == s_ContentEnd ? 0 : 1;
+}
+
+template <class T>
+void NumericArrayJson::Parse(std::string_view p_Json, T* p_Output, size_t p_Count)
+{
+	const char* s_Current = p_Json.data();
+	const char* s_End = s_Current + p_Json.size();
+
+#if RL_X86
+	const bool s_UseSimd = CpuFeatures::Get().SSSE3;
+#else
+	constexpr bool s_UseSimd = false;
+#endif
+
+	s_Current = SkipWhitespace(s_Current, s_End);
+
+	if (s_Current == s_End || *s_Current++ != '[')
+		ThrowMalformed();
+
+	if (p_Count == 0)
+		s_Current = SkipWhitespace(s_Current, s_End);
+
+	for (size_t i = 0; i < p_Count; ++i)
+	{
+		s_Current = SkipWhitespace(s_Current, s_End);
+
+		if constexpr (std::is_same_v<T, bool>)
+			s_Current = ParseBool(s_Current, s_End, p_Output[i]);
+		else if constexpr (std::is_floating_point_v<T>)
+			s_Current = ParseFloat(s_Current, s_End, p_Output[i]);
+		else
+			s_Current = ParseInteger(s_Current, s_End, s_UseSimd, p_Output[i]);
+
+		s_Current = SkipWhitespace(s_Current, s_End);
+
+		if (i + 1 < p_Count)
+		{
+			if (s_Current == s_End || *s_Current++ != ',')
+				ThrowMalformed();
+		}
+	}
+
+	if (s_Current == s_End || *s_Current++ != ']')
+		ThrowMalformed();
+
+	if (SkipWhitespace(s_Current, s_End) != s_End)
+		ThrowMalformed();
+}
+
+#define RL_INSTANTIATE_NUMERIC_ARRAY_JSON(T) \
+	template void NumericArrayJson::Write<T>(const T*, size_t, std::ostream&); \
+	template void NumericArrayJson::Parse<T>(std::string_view, T*, size_t);
+
+RL_INSTANTIATE_NUMERIC_ARRAY_JSON(bool)
+RL_INSTANTIATE_NUMERIC_ARRAY_JSON(int8_t)
+RL_INSTANTIATE_NUMERIC_ARRAY_JSON(uint8_t)
+RL_INSTANTIATE_NUMERIC_ARRAY_JSON(int16_t)
+RL_INSTANTIATE_NUMERIC_ARRAY_JSON(uint16_t)
+RL_INSTANTIATE_NUMERIC_ARRAY_JSON(int32_t)
+RL_INSTANTIATE_NUMERIC_ARRAY_JSON(uint32_t)
+RL_INSTANTIATE_NUMERIC_ARRAY_JSON(int64_t)
+RL_INSTANTIATE_NUMERIC_ARRAY_JSON(uint64_t)
+RL_INSTANTIATE_NUMERIC_ARRAY_JSON(float)
+RL_INSTANTIATE_NUMERIC_ARRAY_JSON(double)
+
+#undef RL_INSTANTIATE_NUMERIC_ARRAY_JSON
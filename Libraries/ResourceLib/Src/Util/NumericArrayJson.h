@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * Json codecs for arrays of integers, floats and booleans, used for the large primitive arrays found
+ * in resources like AIRG, CRMD and TDAT.
+ * Integers are formatted and parsed with SSSE3 when the CPU supports it, and with scalar loops otherwise.
+ * Floats are formatted with their shortest round-tripping representation (see WriteShortestFloat).
+ * The output is identical to writing the elements one by one with simdjson::as_json_string.
+ */
+class NumericArrayJson
+{
+public:
+	template <class T>
+	static constexpr bool IsSupported =
+		std::is_same_v<T, bool> ||
+		std::is_same_v<T, int8_t> || std::is_same_v<T, uint8_t> ||
+		std::is_same_v<T, int16_t> || std::is_same_v<T, uint16_t> ||
+		std::is_same_v<T, int32_t> || std::is_same_v<T, uint32_t> ||
+		std::is_same_v<T, int64_t> || std::is_same_v<T, uint64_t> ||
+		std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+	/**
+	 * Writes the [p_Count] values at [p_Values] to [p_Stream] as a json array.
+	 */
+	template <class T>
+	static void Write(const T* p_Values, size_t p_Count, std::ostream& p_Stream);
+
+	/**
+	 * Number of elements in [p_Json], which must start with the opening bracket of a json array and end
+	 * after its closing bracket. The elements themselves are only validated by [Parse].
+	 */
+	static size_t Count(std::string_view p_Json);
+
+	/**
+	 * Parses the json array in [p_Json] into [p_Output], which must hold exactly [Count] elements.
+	 * Integers are parsed as 64-bit and narrowed just like the simdjson::from_json_* helpers do.
+	 * Throws std::runtime_error if the array is malformed or contains anything but numbers (or booleans for bool).
+	 */
+	template <class T>
+	static void Parse(std::string_view p_Json, T* p_Output, size_t p_Count);
+};
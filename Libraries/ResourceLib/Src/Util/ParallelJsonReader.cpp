@@ -0,0 +1,94 @@
+#include "ParallelJsonReader.h"
+
+static bool IsJsonWhitespace(char p_Char)
+{
+	return p_Char == ' ' || p_Char == '\t' || p_Char == '\n' || p_Char == '\r';
+}
+
+static const char* SkipJsonWhitespace(const char* p_Current, const char* p_End)
+{
+	while (p_Current < p_End && IsJsonWhitespace(*p_Current))
+		++p_Current;
+
+	return p_Current;
+}
+
+[[noreturn]] static void ThrowMalformedArray()
+{
+	throw std::runtime_error("Malformed json array.");
+}
+
+std::vector<std::string_view> ParallelJsonReader::FindElements(std::string_view p_Json)
+{
+	const char* s_Current = SkipJsonWhitespace(p_Json.data(), p_Json.data() + p_Json.size());
+	const char* s_End = p_Json.data() + p_Json.size();
+
+	while (s_End > s_Current && IsJsonWhitespace(s_End[-1]))
+		--s_End;
+
+	if (s_End - s_Current < 2 || *s_Current != '[' || s_End[-1] != ']')
+		ThrowMalformedArray();
+
+	// Skip the brackets.
+	++s_Current;
+	--s_End;
+
+	std::vector<std::string_view> s_Elements;
+
+	if (SkipJsonWhitespace(s_Current, s_End) == s_End)
+		return s_Elements;
+
+	const char* s_ElementStart = s_Current;
+	size_t s_Depth = 0;
+
+	// Only commas outside of strings and nested containers separate elements.
+	for (; s_Current < s_End; ++s_Current)
+	{
+		switch (*s_Current)
+		{
+		case '"':
+			for (++s_Current; s_Current < s_End && *s_Current != '"'; ++s_Current)
+			{
+				if (*s_Current == '\\')
+					++s_Current;
+			}
+
+			if (s_Current >= s_End)
+				ThrowMalformedArray();
+
+			break;
+
+		case '[':
+		case '{':
+			++s_Depth;
+			break;
+
+		case ']':
+		case '}':
+			if (s_Depth == 0)
+				ThrowMalformedArray();
+
+			--s_Depth;
+			break;
+
+		case ',':
+			if (s_Depth == 0)
+			{
+				s_Elements.emplace_back(s_ElementStart, s_Current - s_ElementStart);
+				s_ElementStart = s_Current + 1;
+			}
+
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	if (s_Depth != 0)
+		ThrowMalformedArray();
+
+	s_Elements.emplace_back(s_ElementStart, s_End - s_ElementStart);
+
+	return s_Elements;
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include <External/simdjson.h>
+
+#include "WorkerPool.h"
+#include "BinarySidecar.h"
+#include "JobProgress.h"
+#include <ZHM/ZStringPool.h>
+
+/**
+ * Parses the elements of large json arrays on the worker pool. simdjson's on-demand parser can only walk
+ * a document front to back, so the array is first split into its elements with a single scan over its
+ * text. Contiguous ranges of elements are then parsed on the worker threads, each one into its own slots
+ * of the already sized target.
+ *
+ * Strings and values pooled by the workers are handed over to the string pool of the calling thread,
+ * and the workers resolve binary sidecar references with the sidecar reader of the calling thread.
+ */
+class ParallelJsonReader
+{
+public:
+	// Arrays smaller than this are parsed on the calling thread.
+	static constexpr size_t c_MinElements = 256;
+	static constexpr size_t c_MinRangeSize = 64;
+
+	/**
+	 * Parses the json array in [p_Document]. [p_Resize] is called with the number of elements first, and then
+	 * [p_ReadElement] is called with the index and json value of every element.
+	 */
+	template <class R, class F>
+	static void ReadElements(simdjson::ondemand::value p_Document, const R& p_Resize, const F& p_ReadElement)
+	{
+		simdjson::ondemand::array s_Array = p_Document;
+		const std::vector<std::string_view> s_Elements = FindElements(s_Array.raw_json());
+
+		p_Resize(s_Elements.size());
+
+		auto* s_Progress = JobProgress::BeginElements(s_Elements.size());
+
+		if (s_Elements.size() < c_MinElements || !WorkerPool::IsParallel())
+		{
+			ReadRange(s_Elements, 0, s_Elements.size(), p_ReadElement, s_Progress);
+			return;
+		}
+
+		const auto [s_RangeCount, s_RangeSize] = WorkerPool::SplitRanges(s_Elements.size(), c_MinRangeSize, WorkerPool::ThreadCount());
+
+		auto* s_StringPool = ZStringPool::Current();
+		auto* s_SidecarReader = BinarySidecarReader::Current();
+		auto* s_Job = JobProgress::Current();
+		std::mutex s_StringPoolMutex;
+
+		WorkerPool::Run(s_RangeCount, [&](size_t p_Range)
+		{
+			const size_t s_Start = p_Range * s_RangeSize;
+			const size_t s_End = std::min(s_Elements.size(), s_Start + s_RangeSize);
+
+			BinarySidecarReader::Scope s_SidecarScope(s_SidecarReader);
+			JobProgress::Scope s_JobScope(s_Job);
+
+			if (!s_StringPool)
+			{
+				ReadRange(s_Elements, s_Start, s_End, p_ReadElement, s_Progress);
+				return;
+			}
+
+			// Elements that were already parsed reference the pool even if parsing fails, and they get destroyed
+			// along with the rest of the resource later.
+			ZStringPool s_RangeStringPool;
+
+			const auto s_AdoptRangeStringPool = [&]()
+			{
+				std::scoped_lock s_Lock(s_StringPoolMutex);
+				s_StringPool->Adopt(s_RangeStringPool);
+			};
+
+			try
+			{
+				ReadRange(s_Elements, s_Start, s_End, p_ReadElement, s_Progress);
+			}
+			catch (...)
+			{
+				s_AdoptRangeStringPool();
+				throw;
+			}
+
+			s_AdoptRangeStringPool();
+		});
+	}
+
+private:
+	/**
+	 * Splits the json array in [p_Json] into the text of each of its elements.
+	 * Throws std::runtime_error if the array is malformed.
+	 */
+	static std::vector<std::string_view> FindElements(std::string_view p_Json);
+
+	template <class F>
+	static void ReadRange(const std::vector<std::string_view>& p_Elements, size_t p_Start, size_t p_End, const F& p_ReadElement, JobProgress* p_Progress)
+	{
+		if (p_Start >= p_End)
+			return;
+
+		// Elements are contiguous in the original document, so the range can be parsed as an array of its own.
+		const char* s_RangeStart = p_Elements[p_Start].data();
+		const char* s_RangeEnd = p_Elements[p_End - 1].data() + p_Elements[p_End - 1].size();
+		const size_t s_RangeSize = static_cast<size_t>(s_RangeEnd - s_RangeStart);
+
+		simdjson::padded_string s_Json(s_RangeSize + 2);
+		s_Json.data()[0] = '[';
+		memcpy(s_Json.data() + 1, s_RangeStart, s_RangeSize);
+		s_Json.data()[s_RangeSize + 1] = ']';
+
+		simdjson::ondemand::parser s_Parser;
+		simdjson::ondemand::document s_Document = s_Parser.iterate(s_Json);
+		simdjson::ondemand::array s_Array = s_Document.get_array();
+
+		size_t s_Index = p_Start;
+
+		for (simdjson::ondemand::value s_Item : s_Array)
+		{
+			if (s_Index >= p_End)
+				throw std::runtime_error("Found more elements than expected while parsing a json array.");
+
+			p_ReadElement(s_Index, s_Item);
+			++s_Index;
+
+			if (p_Progress)
+				p_Progress->CompleteElements(1);
+		}
+	}
+};
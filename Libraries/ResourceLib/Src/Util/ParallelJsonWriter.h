@@ -0,0 +1,89 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "WorkerPool.h"
+#include "BinarySidecar.h"
+#include "JobProgress.h"
+#include <ResourceTrace.h>
+
+/**
+ * Writes the elements of large json arrays on the worker pool. The elements are split into contiguous ranges,
+ * each range is written to its own buffer, and the buffers are then appended to the output stream in order,
+ * so the output is byte for byte the same as writing the elements one after another.
+ */
+class ParallelJsonWriter
+{
+public:
+	// Arrays smaller than this aren't worth the overhead of splitting.
+	static constexpr size_t c_MinElements = 256;
+	static constexpr size_t c_MinRangeSize = 64;
+
+	/**
+	 * Whether an array with [p_Count] elements should be written with [WriteElements].
+	 * Sidecar offsets depend on the order data gets written in, so arrays are never split while writing one.
+	 */
+	static bool ShouldSplit(size_t p_Count)
+	{
+		return p_Count >= c_MinElements && WorkerPool::IsParallel() && !BinarySidecarWriter::Current();
+	}
+
+	/**
+	 * Writes the [p_Count] comma separated elements of an array (without the brackets) to [p_Stream], by
+	 * calling [p_WriteElement] with the index of each element and the stream to write it to.
+	 */
+	template <class F>
+	static void WriteElements(size_t p_Count, std::ostream& p_Stream, const F& p_WriteElement)
+	{
+		const auto [s_RangeCount, s_RangeSize] = WorkerPool::SplitRanges(p_Count, c_MinRangeSize, WorkerPool::ThreadCount());
+
+		std::vector<std::string> s_Buffers(s_RangeCount);
+
+		auto* s_Job = JobProgress::Current();
+		auto* s_Progress = JobProgress::BeginElements(p_Count);
+
+		const auto s_TraceElementType = ResourceTraceArrayScope::Current();
+
+		WorkerPool::Run(s_RangeCount, [&](size_t p_Range)
+		{
+			const size_t s_Start = p_Range * s_RangeSize;
+			const size_t s_End = std::min(p_Count, s_Start + s_RangeSize);
+
+			JobProgress::Scope s_JobScope(s_Job);
+
+			// Each range on a worker thread shows up in the trace under the name of the array it's part of.
+			ResourceTraceArrayScope s_Trace(s_TraceElementType, "JsonWriteRange");
+
+			// Elements must be formatted exactly like they would be on the output stream.
+			std::ostringstream s_Stream;
+			s_Stream.copyfmt(p_Stream);
+
+			for (size_t i = s_Start; i < s_End; ++i)
+			{
+				if (i != s_Start)
+					s_Stream << ",";
+
+				p_WriteElement(i, static_cast<std::ostream&>(s_Stream));
+
+				if (s_Progress)
+					s_Progress->CompleteElements(1);
+			}
+
+			s_Buffers[p_Range] = std::move(s_Stream).str();
+		});
+
+		// None of the ranges are empty, so every buffer holds at least one element.
+		for (size_t i = 0; i < s_RangeCount; ++i)
+		{
+			if (i != 0)
+				p_Stream << ",";
+
+			p_Stream.write(s_Buffers[i].data(), static_cast<std::streamsize>(s_Buffers[i].size()));
+		}
+	}
+};
@@ -7,6 +7,7 @@
 #endif
 
 #include <ResourceLib.h>
+#include <ResourceStats.h>
 
 inline unsigned char c_bittestandset(long* p_Val, long p_Bit)
 {
@@ -17,6 +18,9 @@ inline unsigned char c_bittestandset(long* p_Val, long p_Bit)
 
 inline void* c_aligned_alloc(size_t p_Size, size_t p_Alignment)
 {
+	++g_ThreadAllocations.Allocations;
+	g_ThreadAllocations.Bytes += p_Size;
+
 	return RL_TARGET_FUNC(GetAllocator)()->Alloc(p_Size, p_Alignment);
 }
 
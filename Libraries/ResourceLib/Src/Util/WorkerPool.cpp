@@ -0,0 +1,234 @@
+#include "WorkerPool.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+std::atomic<size_t> WorkerPool::g_ThreadCount = 0;
+
+// Set for pool threads, and for the submitting thread while it's helping out with its own work.
+static thread_local bool g_IsInTask = false;
+
+struct WorkerPoolJob
+{
+	const std::function<void(size_t)>* m_Task;
+	size_t m_TaskCount;
+	std::atomic<size_t> m_NextTask = 0;
+	std::atomic<size_t> m_FinishedTasks = 0;
+	std::atomic<bool> m_Failed = false;
+	std::mutex m_ErrorMutex;
+	std::exception_ptr m_Error;
+
+	void Execute()
+	{
+		for (size_t i = m_NextTask++; i < m_TaskCount; i = m_NextTask++)
+		{
+			if (!m_Failed.load(std::memory_order_relaxed))
+			{
+				try
+				{
+					(*m_Task)(i);
+				}
+				catch (...)
+				{
+					std::scoped_lock s_Lock(m_ErrorMutex);
+
+					if (!m_Error)
+						m_Error = std::current_exception();
+
+					m_Failed.store(true, std::memory_order_relaxed);
+				}
+			}
+
+			++m_FinishedTasks;
+		}
+	}
+};
+
+class WorkerPoolThreads
+{
+public:
+	// Only one job runs on the pool at a time. This is held for the whole duration of a job.
+	std::mutex m_RunMutex;
+
+	void Resize(size_t p_WorkerCount)
+	{
+		if (m_Threads.size() == p_WorkerCount)
+			return;
+
+		{
+			std::scoped_lock s_Lock(m_Mutex);
+			m_Stopping = true;
+		}
+
+		m_WakeCondition.notify_all();
+
+		for (auto& s_Thread : m_Threads)
+			s_Thread.join();
+
+		m_Threads.clear();
+		m_Stopping = false;
+
+		// No job is running while we hold the run mutex, so new threads only have to wait for the next one.
+		for (size_t i = 0; i < p_WorkerCount; ++i)
+			m_Threads.emplace_back([this, s_Generation = m_Generation]() { WorkerLoop(s_Generation); });
+	}
+
+	void Run(WorkerPoolJob& p_Job)
+	{
+		{
+			std::scoped_lock s_Lock(m_Mutex);
+			m_Job = &p_Job;
+			++m_Generation;
+		}
+
+		m_WakeCondition.notify_all();
+
+		g_IsInTask = true;
+		p_Job.Execute();
+		g_IsInTask = false;
+
+		// Workers that picked up the job might still be finishing their last task.
+		std::unique_lock s_Lock(m_Mutex);
+
+		m_DoneCondition.wait(s_Lock, [&]()
+		{
+			return m_ActiveWorkers == 0 && p_Job.m_FinishedTasks == p_Job.m_TaskCount;
+		});
+
+		m_Job = nullptr;
+	}
+
+private:
+	void WorkerLoop(uint64_t p_Generation)
+	{
+		g_IsInTask = true;
+
+		uint64_t s_SeenGeneration = p_Generation;
+
+		while (true)
+		{
+			WorkerPoolJob* s_Job = nullptr;
+
+			{
+				std::unique_lock s_Lock(m_Mutex);
+
+				m_WakeCondition.wait(s_Lock, [&]()
+				{
+					return m_Stopping || m_Generation != s_SeenGeneration;
+				});
+
+				if (m_Stopping)
+					return;
+
+				s_SeenGeneration = m_Generation;
+				s_Job = m_Job;
+
+				// We woke up after the job was already done.
+				if (!s_Job)
+					continue;
+
+				++m_ActiveWorkers;
+			}
+
+			s_Job->Execute();
+
+			{
+				std::scoped_lock s_Lock(m_Mutex);
+				--m_ActiveWorkers;
+			}
+
+			m_DoneCondition.notify_all();
+		}
+	}
+
+private:
+	std::mutex m_Mutex;
+	std::condition_variable m_WakeCondition;
+	std::condition_variable m_DoneCondition;
+	std::vector<std::thread> m_Threads;
+	WorkerPoolJob* m_Job = nullptr;
+	uint64_t m_Generation = 0;
+	size_t m_ActiveWorkers = 0;
+	bool m_Stopping = false;
+};
+
+// Rounding the range size up used to leave the last ranges empty, e.g. for 4225 elements on 17 or more threads.
+static constexpr bool SplitsIntoNonEmptyRanges(size_t p_Count, size_t p_MinRangeSize)
+{
+	for (size_t s_ThreadCount = 1; s_ThreadCount <= 256; ++s_ThreadCount)
+	{
+		const auto s_Ranges = WorkerPool::SplitRanges(p_Count, p_MinRangeSize, s_ThreadCount);
+
+		if (s_Ranges.m_Count * s_Ranges.m_Size < p_Count || (s_Ranges.m_Count - 1) * s_Ranges.m_Size >= p_Count)
+			return false;
+	}
+
+	return true;
+}
+
+static_assert(SplitsIntoNonEmptyRanges(4225, 64));
+static_assert(SplitsIntoNonEmptyRanges(256, 64));
+static_assert(SplitsIntoNonEmptyRanges(100003, 64));
+
+static WorkerPoolThreads& GetWorkerPoolThreads()
+{
+	// This is intentionally never destroyed. Joining threads while the library is being unloaded can deadlock.
+	static auto* s_Threads = new WorkerPoolThreads();
+	return *s_Threads;
+}
+
+void WorkerPool::SetThreadCount(size_t p_ThreadCount)
+{
+	g_ThreadCount.store(p_ThreadCount, std::memory_order_relaxed);
+}
+
+size_t WorkerPool::ThreadCount()
+{
+	return g_ThreadCount.load(std::memory_order_relaxed);
+}
+
+bool WorkerPool::IsParallel()
+{
+	return ThreadCount() > 1 && !g_IsInTask;
+}
+
+void WorkerPool::Run(size_t p_TaskCount, const std::function<void(size_t)>& p_Task)
+{
+	if (p_TaskCount == 0)
+		return;
+
+	if (p_TaskCount > 1 && IsParallel())
+	{
+		auto& s_Threads = GetWorkerPoolThreads();
+		std::unique_lock s_RunLock(s_Threads.m_RunMutex, std::try_to_lock);
+
+		// If another thread is using the pool we just do the work ourselves instead of waiting for it.
+		if (s_RunLock.owns_lock())
+		{
+			const auto s_ThreadCount = ThreadCount();
+
+			if (s_ThreadCount > 1)
+			{
+				s_Threads.Resize(s_ThreadCount - 1);
+
+				WorkerPoolJob s_Job;
+				s_Job.m_Task = &p_Task;
+				s_Job.m_TaskCount = p_TaskCount;
+
+				s_Threads.Run(s_Job);
+
+				if (s_Job.m_Error)
+					std::rethrow_exception(s_Job.m_Error);
+
+				return;
+			}
+		}
+	}
+
+	for (size_t i = 0; i < p_TaskCount; ++i)
+		p_Task(i);
+}
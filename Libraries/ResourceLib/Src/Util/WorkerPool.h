@@ -0,0 +1,63 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+
+/**
+ * A process-wide pool of worker threads used to split the conversion of large resources into independent
+ * pieces of work. The pool is disabled by default, in which case all work runs on the calling thread.
+ *
+ * Work submitted from inside a task, or while another thread is already using the pool, also runs on the
+ * calling thread, so callers never have to care whether the pool is available.
+ */
+class WorkerPool
+{
+public:
+	/**
+	 * Use up to [p_ThreadCount] threads (including the calling one) for parallel work. Passing 0 or 1
+	 * disables the pool. Threads are started the next time work is submitted.
+	 */
+	static void SetThreadCount(size_t p_ThreadCount);
+	static size_t ThreadCount();
+
+	/**
+	 * Whether work submitted from the calling thread would be split across multiple threads.
+	 */
+	static bool IsParallel();
+
+	/**
+	 * Calls [p_Task] once for every index in [0, p_TaskCount) and returns once all calls have finished.
+	 * Indices are handed out in order, but may run concurrently and finish in any order.
+	 * If any task throws, the remaining ones are skipped and the first exception is rethrown.
+	 */
+	static void Run(size_t p_TaskCount, const std::function<void(size_t)>& p_Task);
+
+	struct Ranges
+	{
+		size_t m_Count;
+		size_t m_Size;
+	};
+
+	/**
+	 * Splits [p_Count] items into contiguous ranges of [m_Size] items for [p_ThreadCount] threads. There are a
+	 * few ranges per thread so that threads that finish early can pick up some of the remaining work, and each
+	 * range has at least [p_MinRangeSize] items unless there's only one. Only the last range can be shorter,
+	 * and none of them are empty.
+	 */
+	static constexpr Ranges SplitRanges(size_t p_Count, size_t p_MinRangeSize, size_t p_ThreadCount)
+	{
+		if (p_Count == 0)
+			return { 0, 0 };
+
+		const size_t s_MaxRanges = std::max<size_t>(1, std::min(p_Count / p_MinRangeSize, p_ThreadCount * 4));
+		const size_t s_RangeSize = (p_Count + s_MaxRanges - 1) / s_MaxRanges;
+
+		// Rounding the size up can leave fewer ranges than we asked for, so count them again.
+		return { (p_Count + s_RangeSize - 1) / s_RangeSize, s_RangeSize };
+	}
+
+private:
+	static std::atomic<size_t> g_ThreadCount;
+};
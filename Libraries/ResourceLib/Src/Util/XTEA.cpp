@@ -0,0 +1,241 @@
+#include "XTEA.h"
+
+#include <cstring>
+
+#include "CpuFeatures.h"
+
+static void DecryptScalar(uint8_t* p_Memory, size_t p_Blocks, size_t p_Rounds, const uint32_t p_Key[4], uint32_t p_Delta)
+{
+	for (size_t s_Block = 0; s_Block < p_Blocks; ++s_Block)
+	{
+		uint32_t s_V[2];
+		memcpy(s_V, p_Memory + s_Block * XTEA::c_BlockSize, sizeof(s_V));
+
+		uint32_t s_Sum = p_Delta * static_cast<uint32_t>(p_Rounds);
+
+		for (size_t i = 0; i < p_Rounds; ++i)
+		{
+			s_V[1] -= (((s_V[0] << 4) ^ (s_V[0] >> 5)) + s_V[0]) ^ (s_Sum + p_Key[(s_Sum >> 11) & 3]);
+			s_Sum -= p_Delta;
+			s_V[0] -= (((s_V[1] << 4) ^ (s_V[1] >> 5)) + s_V[1]) ^ (s_Sum + p_Key[s_Sum & 3]);
+		}
+
+		memcpy(p_Memory + s_Block * XTEA::c_BlockSize, s_V, sizeof(s_V));
+	}
+}
+
+static void EncryptScalar(uint8_t* p_Memory, size_t p_Blocks, size_t p_Rounds, const uint32_t p_Key[4], uint32_t p_Delta)
+{
+	for (size_t s_Block = 0; s_Block < p_Blocks; ++s_Block)
+	{
+		uint32_t s_V[2];
+		memcpy(s_V, p_Memory + s_Block * XTEA::c_BlockSize, sizeof(s_V));
+
+		uint32_t s_Sum = 0;
+
+		for (size_t i = 0; i < p_Rounds; ++i)
+		{
+			s_V[0] += (((s_V[1] << 4) ^ (s_V[1] >> 5)) + s_V[1]) ^ (s_Sum + p_Key[s_Sum & 3]);
+			s_Sum += p_Delta;
+			s_V[1] += (((s_V[0] << 4) ^ (s_V[0] >> 5)) + s_V[0]) ^ (s_Sum + p_Key[(s_Sum >> 11) & 3]);
+		}
+
+		memcpy(p_Memory + s_Block * XTEA::c_BlockSize, s_V, sizeof(s_V));
+	}
+}
+
+#if RL_X86
+// The round keys only depend on the running sum, which is the same for every block, so each
+// lane holds one half of a different block and the keys are broadcast to all of them.
+// Blocks are split into a vector of first halves and a vector of second halves on load,
+// and interleaved back on store.
+
+// Processes 4 blocks per iteration. Returns the number of blocks processed.
+RL_TARGET_SSE41
+static size_t DecryptSSE41(uint8_t* p_Memory, size_t p_Blocks, size_t p_Rounds, const uint32_t p_Key[4], uint32_t p_Delta)
+{
+	size_t s_Block = 0;
+
+	for (; s_Block + 4 <= p_Blocks; s_Block += 4)
+	{
+		auto* s_Ptr = reinterpret_cast<__m128i*>(p_Memory + s_Block * XTEA::c_BlockSize);
+
+		const __m128 s_A = _mm_castsi128_ps(_mm_loadu_si128(s_Ptr));
+		const __m128 s_B = _mm_castsi128_ps(_mm_loadu_si128(s_Ptr + 1));
+
+		__m128i s_V0 = _mm_castps_si128(_mm_shuffle_ps(s_A, s_B, _MM_SHUFFLE(2, 0, 2, 0)));
+		__m128i s_V1 = _mm_castps_si128(_mm_shuffle_ps(s_A, s_B, _MM_SHUFFLE(3, 1, 3, 1)));
+
+		uint32_t s_Sum = p_Delta * static_cast<uint32_t>(p_Rounds);
+
+		for (size_t i = 0; i < p_Rounds; ++i)
+		{
+			const __m128i s_Key1 = _mm_set1_epi32(static_cast<int>(s_Sum + p_Key[(s_Sum >> 11) & 3]));
+			const __m128i s_Mix0 = _mm_add_epi32(_mm_xor_si128(_mm_slli_epi32(s_V0, 4), _mm_srli_epi32(s_V0, 5)), s_V0);
+			s_V1 = _mm_sub_epi32(s_V1, _mm_xor_si128(s_Mix0, s_Key1));
+
+			s_Sum -= p_Delta;
+
+			const __m128i s_Key0 = _mm_set1_epi32(static_cast<int>(s_Sum + p_Key[s_Sum & 3]));
+			const __m128i s_Mix1 = _mm_add_epi32(_mm_xor_si128(_mm_slli_epi32(s_V1, 4), _mm_srli_epi32(s_V1, 5)), s_V1);
+			s_V0 = _mm_sub_epi32(s_V0, _mm_xor_si128(s_Mix1, s_Key0));
+		}
+
+		_mm_storeu_si128(s_Ptr, _mm_unpacklo_epi32(s_V0, s_V1));
+		_mm_storeu_si128(s_Ptr + 1, _mm_unpackhi_epi32(s_V0, s_V1));
+	}
+
+	return s_Block;
+}
+
+RL_TARGET_SSE41
+static size_t EncryptSSE41(uint8_t* p_Memory, size_t p_Blocks, size_t p_Rounds, const uint32_t p_Key[4], uint32_t p_Delta)
+{
+	size_t s_Block = 0;
+
+	for (; s_Block + 4 <= p_Blocks; s_Block += 4)
+	{
+		auto* s_Ptr = reinterpret_cast<__m128i*>(p_Memory + s_Block * XTEA::c_BlockSize);
+
+		const __m128 s_A = _mm_castsi128_ps(_mm_loadu_si128(s_Ptr));
+		const __m128 s_B = _mm_castsi128_ps(_mm_loadu_si128(s_Ptr + 1));
+
+		__m128i s_V0 = _mm_castps_si128(_mm_shuffle_ps(s_A, s_B, _MM_SHUFFLE(2, 0, 2, 0)));
+		__m128i s_V1 = _mm_castps_si128(_mm_shuffle_ps(s_A, s_B, _MM_SHUFFLE(3, 1, 3, 1)));
+
+		uint32_t s_Sum = 0;
+
+		for (size_t i = 0; i < p_Rounds; ++i)
+		{
+			const __m128i s_Key0 = _mm_set1_epi32(static_cast<int>(s_Sum + p_Key[s_Sum & 3]));
+			const __m128i s_Mix1 = _mm_add_epi32(_mm_xor_si128(_mm_slli_epi32(s_V1, 4), _mm_srli_epi32(s_V1, 5)), s_V1);
+			s_V0 = _mm_add_epi32(s_V0, _mm_xor_si128(s_Mix1, s_Key0));
+
+			s_Sum += p_Delta;
+
+			const __m128i s_Key1 = _mm_set1_epi32(static_cast<int>(s_Sum + p_Key[(s_Sum >> 11) & 3]));
+			const __m128i s_Mix0 = _mm_add_epi32(_mm_xor_si128(_mm_slli_epi32(s_V0, 4), _mm_srli_epi32(s_V0, 5)), s_V0);
+			s_V1 = _mm_add_epi32(s_V1, _mm_xor_si128(s_Mix0, s_Key1));
+		}
+
+		_mm_storeu_si128(s_Ptr, _mm_unpacklo_epi32(s_V0, s_V1));
+		_mm_storeu_si128(s_Ptr + 1, _mm_unpackhi_epi32(s_V0, s_V1));
+	}
+
+	return s_Block;
+}
+
+// Processes 8 blocks per iteration. The shuffles work within 128-bit lanes, so the blocks end up
+// in a different order inside the vectors, but the unpacks put them back where they came from.
+RL_TARGET_AVX2
+static size_t DecryptAVX2(uint8_t* p_Memory, size_t p_Blocks, size_t p_Rounds, const uint32_t p_Key[4], uint32_t p_Delta)
+{
+	size_t s_Block = 0;
+
+	for (; s_Block + 8 <= p_Blocks; s_Block += 8)
+	{
+		auto* s_Ptr = reinterpret_cast<__m256i*>(p_Memory + s_Block * XTEA::c_BlockSize);
+
+		const __m256 s_A = _mm256_castsi256_ps(_mm256_loadu_si256(s_Ptr));
+		const __m256 s_B = _mm256_castsi256_ps(_mm256_loadu_si256(s_Ptr + 1));
+
+		__m256i s_V0 = _mm256_castps_si256(_mm256_shuffle_ps(s_A, s_B, _MM_SHUFFLE(2, 0, 2, 0)));
+		__m256i s_V1 = _mm256_castps_si256(_mm256_shuffle_ps(s_A, s_B, _MM_SHUFFLE(3, 1, 3, 1)));
+
+		uint32_t s_Sum = p_Delta * static_cast<uint32_t>(p_Rounds);
+
+		for (size_t i = 0; i < p_Rounds; ++i)
+		{
+			const __m256i s_Key1 = _mm256_set1_epi32(static_cast<int>(s_Sum + p_Key[(s_Sum >> 11) & 3]));
+			const __m256i s_Mix0 = _mm256_add_epi32(_mm256_xor_si256(_mm256_slli_epi32(s_V0, 4), _mm256_srli_epi32(s_V0, 5)), s_V0);
+			s_V1 = _mm256_sub_epi32(s_V1, _mm256_xor_si256(s_Mix0, s_Key1));
+
+			s_Sum -= p_Delta;
+
+			const __m256i s_Key0 = _mm256_set1_epi32(static_cast<int>(s_Sum + p_Key[s_Sum & 3]));
+			const __m256i s_Mix1 = _mm256_add_epi32(_mm256_xor_si256(_mm256_slli_epi32(s_V1, 4), _mm256_srli_epi32(s_V1, 5)), s_V1);
+			s_V0 = _mm256_sub_epi32(s_V0, _mm256_xor_si256(s_Mix1, s_Key0));
+		}
+
+		_mm256_storeu_si256(s_Ptr, _mm256_unpacklo_epi32(s_V0, s_V1));
+		_mm256_storeu_si256(s_Ptr + 1, _mm256_unpackhi_epi32(s_V0, s_V1));
+	}
+
+	return s_Block;
+}
+
+RL_TARGET_AVX2
+static size_t EncryptAVX2(uint8_t* p_Memory, size_t p_Blocks, size_t p_Rounds, const uint32_t p_Key[4], uint32_t p_Delta)
+{
+	size_t s_Block = 0;
+
+	for (; s_Block + 8 <= p_Blocks; s_Block += 8)
+	{
+		auto* s_Ptr = reinterpret_cast<__m256i*>(p_Memory + s_Block * XTEA::c_BlockSize);
+
+		const __m256 s_A = _mm256_castsi256_ps(_mm256_loadu_si256(s_Ptr));
+		const __m256 s_B = _mm256_castsi256_ps(_mm256_loadu_si256(s_Ptr + 1));
+
+		__m256i s_V0 = _mm256_castps_si256(_mm256_shuffle_ps(s_A, s_B, _MM_SHUFFLE(2, 0, 2, 0)));
+		__m256i s_V1 = _mm256_castps_si256(_mm256_shuffle_ps(s_A, s_B, _MM_SHUFFLE(3, 1, 3, 1)));
+
+		uint32_t s_Sum = 0;
+
+		for (size_t i = 0; i < p_Rounds; ++i)
+		{
+			const __m256i s_Key0 = _mm256_set1_epi32(static_cast<int>(s_Sum + p_Key[s_Sum & 3]));
+			const __m256i s_Mix1 = _mm256_add_epi32(_mm256_xor_si256(_mm256_slli_epi32(s_V1, 4), _mm256_srli_epi32(s_V1, 5)), s_V1);
+			s_V0 = _mm256_add_epi32(s_V0, _mm256_xor_si256(s_Mix1, s_Key0));
+
+			s_Sum += p_Delta;
+
+			const __m256i s_Key1 = _mm256_set1_epi32(static_cast<int>(s_Sum + p_Key[(s_Sum >> 11) & 3]));
+			const __m256i s_Mix0 = _mm256_add_epi32(_mm256_xor_si256(_mm256_slli_epi32(s_V0, 4), _mm256_srli_epi32(s_V0, 5)), s_V0);
+			s_V1 = _mm256_add_epi32(s_V1, _mm256_xor_si256(s_Mix0, s_Key1));
+		}
+
+		_mm256_storeu_si256(s_Ptr, _mm256_unpacklo_epi32(s_V0, s_V1));
+		_mm256_storeu_si256(s_Ptr + 1, _mm256_unpackhi_epi32(s_V0, s_V1));
+	}
+
+	return s_Block;
+}
+#endif
+
+void XTEA::DecryptInPlace(void* p_Memory, size_t p_Bytes, size_t p_Rounds, const uint32_t p_Key[4], uint32_t p_Delta)
+{
+	auto* s_Memory = static_cast<uint8_t*>(p_Memory);
+	const size_t s_Blocks = p_Bytes / c_BlockSize;
+	size_t s_Done = 0;
+
+#if RL_X86
+	const auto& s_Features = CpuFeatures::Get();
+
+	if (s_Features.AVX2)
+		s_Done = DecryptAVX2(s_Memory, s_Blocks, p_Rounds, p_Key, p_Delta);
+
+	if (s_Features.SSE41)
+		s_Done += DecryptSSE41(s_Memory + s_Done * c_BlockSize, s_Blocks - s_Done, p_Rounds, p_Key, p_Delta);
+#endif
+
+	DecryptScalar(s_Memory + s_Done * c_BlockSize, s_Blocks - s_Done, p_Rounds, p_Key, p_Delta);
+}
+
+void XTEA::EncryptInPlace(void* p_Memory, size_t p_Bytes, size_t p_Rounds, const uint32_t p_Key[4], uint32_t p_Delta)
+{
+	auto* s_Memory = static_cast<uint8_t*>(p_Memory);
+	const size_t s_Blocks = p_Bytes / c_BlockSize;
+	size_t s_Done = 0;
+
+#if RL_X86
+	const auto& s_Features = CpuFeatures::Get();
+
+	if (s_Features.AVX2)
+		s_Done = EncryptAVX2(s_Memory, s_Blocks, p_Rounds, p_Key, p_Delta);
+
+	if (s_Features.SSE41)
+		s_Done += EncryptSSE41(s_Memory + s_Done * c_BlockSize, s_Blocks - s_Done, p_Rounds, p_Key, p_Delta);
+#endif
+
+	EncryptScalar(s_Memory + s_Done * c_BlockSize, s_Blocks - s_Done, p_Rounds, p_Key, p_Delta);
+}
@@ -0,0 +1,196 @@
+#include "Hash.h"
+
+#include <array>
+
+#include <Util/CpuFeatures.h>
+
+// Slice-by-8 tables. The first one is the regular byte-at-a-time table and every subsequent one
+// advances the CRC of the previous one by another zero byte.
+static constexpr auto c_Crc32SliceTables = []()
+{
+	std::array<std::array<uint32_t, 256>, 8> s_Tables {};
+
+	for (size_t i = 0; i < 256; ++i)
+		s_Tables[0][i] = Hash::g_Crc32Table[i];
+
+	for (size_t s_Slice = 1; s_Slice < 8; ++s_Slice)
+	{
+		for (size_t i = 0; i < 256; ++i)
+		{
+			const auto s_Previous = s_Tables[s_Slice - 1][i];
+			s_Tables[s_Slice][i] = (s_Previous >> 8) ^ s_Tables[0][s_Previous & 0xFF];
+		}
+	}
+
+	return s_Tables;
+}();
+
+// Works on the raw CRC state (ie. without the initial and final inversion).
+static uint32_t Crc32SliceBy8(uint32_t p_Crc, const uint8_t* p_Data, size_t p_Length)
+{
+	const auto& s_T = c_Crc32SliceTables;
+
+	while (p_Length >= 8)
+	{
+		uint32_t s_Low, s_High;
+		memcpy(&s_Low, p_Data, sizeof(s_Low));
+		memcpy(&s_High, p_Data + 4, sizeof(s_High));
+
+		s_Low ^= p_Crc;
+
+		p_Crc =
+			s_T[7][s_Low & 0xFF] ^ s_T[6][(s_Low >> 8) & 0xFF] ^ s_T[5][(s_Low >> 16) & 0xFF] ^ s_T[4][s_Low >> 24] ^
+			s_T[3][s_High & 0xFF] ^ s_T[2][(s_High >> 8) & 0xFF] ^ s_T[1][(s_High >> 16) & 0xFF] ^ s_T[0][s_High >> 24];
+
+		p_Data += 8;
+		p_Length -= 8;
+	}
+
+	while (p_Length--)
+		p_Crc = s_T[0][(p_Crc ^ *p_Data++) & 0xFF] ^ (p_Crc >> 8);
+
+	return p_Crc;
+}
+
+#if RL_X86
+// Folds the 128-bit accumulator over the next 16 bytes.
+RL_TARGET_PCLMUL
+static __m128i Crc32Fold16(__m128i p_Accumulator, __m128i p_Next, __m128i p_K3K4)
+{
+	const __m128i s_Lo = _mm_clmulepi64_si128(p_Accumulator, p_K3K4, 0x00);
+	const __m128i s_Hi = _mm_clmulepi64_si128(p_Accumulator, p_K3K4, 0x11);
+	return _mm_xor_si128(_mm_xor_si128(s_Hi, s_Lo), p_Next);
+}
+
+// Folds 64 bytes per iteration using carry-less multiplication, as described by Intel in
+// "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction" (2009).
+// [p_Length] must be at least 64 and a multiple of 16. Works on the raw CRC state.
+RL_TARGET_PCLMUL
+static uint32_t Crc32Pclmul(uint32_t p_Crc, const uint8_t* p_Data, size_t p_Length)
+{
+	const __m128i s_K1K2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+	const __m128i s_K3K4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+	const __m128i s_K5 = _mm_set_epi64x(0, 0x0163cd6124);
+	const __m128i s_Poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+	const __m128i s_Mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+	const auto* s_Data = reinterpret_cast<const __m128i*>(p_Data);
+
+	__m128i s_X1 = _mm_loadu_si128(s_Data + 0);
+	__m128i s_X2 = _mm_loadu_si128(s_Data + 1);
+	__m128i s_X3 = _mm_loadu_si128(s_Data + 2);
+	__m128i s_X4 = _mm_loadu_si128(s_Data + 3);
+
+	s_X1 = _mm_xor_si128(s_X1, _mm_cvtsi32_si128(static_cast<int>(p_Crc)));
+
+	s_Data += 4;
+	p_Length -= 64;
+
+	// Fold by 4 while we have 64 more bytes.
+	for (; p_Length >= 64; p_Length -= 64, s_Data += 4)
+	{
+		const __m128i s_Lo1 = _mm_clmulepi64_si128(s_X1, s_K1K2, 0x00);
+		const __m128i s_Lo2 = _mm_clmulepi64_si128(s_X2, s_K1K2, 0x00);
+		const __m128i s_Lo3 = _mm_clmulepi64_si128(s_X3, s_K1K2, 0x00);
+		const __m128i s_Lo4 = _mm_clmulepi64_si128(s_X4, s_K1K2, 0x00);
+
+		s_X1 = _mm_clmulepi64_si128(s_X1, s_K1K2, 0x11);
+		s_X2 = _mm_clmulepi64_si128(s_X2, s_K1K2, 0x11);
+		s_X3 = _mm_clmulepi64_si128(s_X3, s_K1K2, 0x11);
+		s_X4 = _mm_clmulepi64_si128(s_X4, s_K1K2, 0x11);
+
+		s_X1 = _mm_xor_si128(_mm_xor_si128(s_X1, s_Lo1), _mm_loadu_si128(s_Data + 0));
+		s_X2 = _mm_xor_si128(_mm_xor_si128(s_X2, s_Lo2), _mm_loadu_si128(s_Data + 1));
+		s_X3 = _mm_xor_si128(_mm_xor_si128(s_X3, s_Lo3), _mm_loadu_si128(s_Data + 2));
+		s_X4 = _mm_xor_si128(_mm_xor_si128(s_X4, s_Lo4), _mm_loadu_si128(s_Data + 3));
+	}
+
+	// Fold the 4 accumulators into one, and then any remaining 16 byte blocks into that.
+	s_X1 = Crc32Fold16(s_X1, s_X2, s_K3K4);
+	s_X1 = Crc32Fold16(s_X1, s_X3, s_K3K4);
+	s_X1 = Crc32Fold16(s_X1, s_X4, s_K3K4);
+
+	for (; p_Length >= 16; p_Length -= 16, ++s_Data)
+		s_X1 = Crc32Fold16(s_X1, _mm_loadu_si128(s_Data), s_K3K4);
+
+	// Fold 128 bits down to 64.
+	__m128i s_Tmp = _mm_clmulepi64_si128(s_X1, s_K3K4, 0x10);
+	s_X1 = _mm_xor_si128(_mm_srli_si128(s_X1, 8), s_Tmp);
+
+	s_Tmp = _mm_srli_si128(s_X1, 4);
+	s_X1 = _mm_clmulepi64_si128(_mm_and_si128(s_X1, s_Mask32), s_K5, 0x00);
+	s_X1 = _mm_xor_si128(s_X1, s_Tmp);
+
+	// Barrett reduction down to 32 bits.
+	s_Tmp = _mm_clmulepi64_si128(_mm_and_si128(s_X1, s_Mask32), s_Poly, 0x10);
+	s_Tmp = _mm_clmulepi64_si128(_mm_and_si128(s_Tmp, s_Mask32), s_Poly, 0x00);
+	s_X1 = _mm_xor_si128(s_X1, s_Tmp);
+
+	return static_cast<uint32_t>(_mm_extract_epi32(s_X1, 1));
+}
+#endif
+
+uint32_t Hash::Crc32Accelerated(const char* p_Data, size_t p_Length)
+{
+	auto* s_Data = reinterpret_cast<const uint8_t*>(p_Data);
+	uint32_t s_Crc = 0xFFFFFFFF;
+
+#if RL_X86
+	if (p_Length >= 64 && CpuFeatures::Get().PCLMUL && CpuFeatures::Get().SSE41)
+	{
+		const size_t s_FoldedLength = p_Length & ~size_t(15);
+
+		s_Crc = Crc32Pclmul(s_Crc, s_Data, s_FoldedLength);
+
+		s_Data += s_FoldedLength;
+		p_Length -= s_FoldedLength;
+	}
+#endif
+
+	return Crc32SliceBy8(s_Crc, s_Data, p_Length) ^ 0xFFFFFFFF;
+}
+
+uint32_t Hash::PropertyNameCrc32(std::string_view p_Name)
+{
+	// Direct-mapped, so lookups are a single compare. Entries are a cache line each.
+	struct CacheEntry
+	{
+		uint32_t Crc;
+		uint32_t Length;
+		char Name[56];
+	};
+
+	constexpr size_t c_CacheSize = 512;
+
+	static thread_local CacheEntry s_Cache[c_CacheSize] {};
+
+	if (p_Name.size() > sizeof(CacheEntry::Name))
+		return Crc32(p_Name);
+
+	// Cheap slot hash made up of the length and the first and last few characters.
+	uint64_t s_Key = p_Name.size();
+
+	if (p_Name.size() >= 8)
+	{
+		uint64_t s_First, s_Last;
+		memcpy(&s_First, p_Name.data(), sizeof(s_First));
+		memcpy(&s_Last, p_Name.data() + p_Name.size() - sizeof(s_Last), sizeof(s_Last));
+		s_Key ^= s_First ^ (s_Last * 31);
+	}
+	else
+	{
+		for (char s_Char : p_Name)
+			s_Key = (s_Key << 8) | static_cast<uint8_t>(s_Char);
+	}
+
+	auto& s_Entry = s_Cache[(s_Key * 0x9E3779B97F4A7C15ull) >> 55];
+
+	if (s_Entry.Length == p_Name.size() && memcmp(s_Entry.Name, p_Name.data(), p_Name.size()) == 0)
+		return s_Entry.Crc;
+
+	s_Entry.Crc = Crc32(p_Name);
+	s_Entry.Length = static_cast<uint32_t>(p_Name.size());
+	memcpy(s_Entry.Name, p_Name.data(), p_Name.size());
+
+	return s_Entry.Crc;
+}
@@ -26,10 +26,24 @@ SOFTWARE.
 
 #include <cctype>
 #include <cstdint>
+#include <cstring>
 #include <string_view>
+#include <type_traits>
 
 namespace Hash
 {
+	/**
+	 * Runtime CRC32, using PCLMULQDQ folding for long inputs when the CPU supports it and slice-by-8 otherwise.
+	 * Prefer calling Crc32, which uses this when it isn't evaluated at compile time.
+	 */
+	uint32_t Crc32Accelerated(const char* p_Data, size_t p_Length);
+
+	/**
+	 * CRC32 of a property name, memoized in a small per-thread cache since the same few hundred
+	 * names come up over and over again while generating a resource.
+	 */
+	uint32_t PropertyNameCrc32(std::string_view p_Name);
+
     static constexpr uint32_t g_Crc32Table[] =
 	{
 		0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f,
@@ -79,11 +93,14 @@ namespace Hash
 
     constexpr uint32_t Crc32(const char* p_Data, size_t p_Length)
     {
+		if (!std::is_constant_evaluated())
+			return Crc32Accelerated(p_Data, p_Length);
+
 		uint32_t s_Hash = 0xFFFFFFFF;
     	
 		while (p_Length--)
 		{
-			s_Hash = g_Crc32Table[*p_Data ^ (s_Hash & 0xFF)] ^ (s_Hash >> 8);
+			s_Hash = g_Crc32Table[static_cast<uint8_t>(*p_Data) ^ (s_Hash & 0xFF)] ^ (s_Hash >> 8);
 			p_Data++;
 		}
 
@@ -92,11 +109,14 @@ namespace Hash
 
     constexpr uint32_t Crc32(const char* p_Data)
     {
+		if (!std::is_constant_evaluated())
+			return Crc32Accelerated(p_Data, strlen(p_Data));
+
 		uint32_t s_Hash = 0xFFFFFFFF;
     	
 		while (*p_Data)
 		{
-			s_Hash = g_Crc32Table[*p_Data ^ (s_Hash & 0xFF)] ^ (s_Hash >> 8);
+			s_Hash = g_Crc32Table[static_cast<uint8_t>(*p_Data) ^ (s_Hash & 0xFF)] ^ (s_Hash >> 8);
 			p_Data++;
 		}
     	
@@ -1,13 +1,25 @@
 #pragma once
 
+#include <bit>
 #include <vector>
 #include <ostream>
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
 
 #include <ResourceLib.h>
 #include <External/simdjson_helpers.h>
 
 #include "ZHMSerializer.h"
+#include "ZHMRelocation.h"
+#include "ZHMCbor.h"
 #include "Util/PortableIntrinsics.h"
+#include "Util/NumericArrayJson.h"
+#include "Util/BinarySidecar.h"
+#include "Util/JobProgress.h"
+#include "Util/ParallelJsonReader.h"
+#include "Util/ParallelJsonWriter.h"
+#include <ResourceTrace.h>
 
 template <size_t T>
 class alignas(T) TAlignedType {
@@ -22,36 +34,166 @@ public:
     {
         auto* s_Object = reinterpret_cast<TArray<T>*>(p_Object);
 
-        p_Stream << "[";
+        ResourceTraceArrayScope s_Trace(TraceElementType());
 
-		for (size_t i = 0; i < s_Object->size(); ++i)
-		{
-            auto* s_ObjectPtr = &s_Object->operator[](i);
-			T::WriteSimpleJson(s_ObjectPtr, p_Stream);
+        // Arrays of numbers can get huge, so they're written in bulk, or to the binary sidecar if there is one.
+        if constexpr (NumericArrayJson::IsSupported<T>)
+        {
+            if constexpr (!std::is_same_v<T, bool>)
+            {
+                auto* s_Sidecar = BinarySidecarWriter::Current();
 
-			if (i < s_Object->size() - 1)
-				p_Stream << ",";
-		}
+                if (s_Sidecar && s_Sidecar->TryWrite(s_Object->begin(), s_Object->size() * sizeof(T), p_Stream))
+                    return;
+            }
+
+            NumericArrayJson::Write(s_Object->begin(), s_Object->size(), p_Stream);
+        }
+        else
+        {
+            p_Stream << "[";
+
+            // Huge arrays of structs (eg. sub-entities and waypoints) are written on the worker pool.
+            if (ParallelJsonWriter::ShouldSplit(s_Object->size()))
+            {
+                ParallelJsonWriter::WriteElements(s_Object->size(), p_Stream, [&](size_t p_Index, std::ostream& p_ElementStream)
+                {
+                    T::WriteSimpleJson(&s_Object->operator[](p_Index), p_ElementStream);
+                });
+
+                p_Stream << "]";
+                return;
+            }
 
-		p_Stream << "]";
+            auto* s_Progress = JobProgress::BeginElements(s_Object->size());
+
+            for (size_t i = 0; i < s_Object->size(); ++i)
+            {
+                auto* s_ObjectPtr = &s_Object->operator[](i);
+                T::WriteSimpleJson(s_ObjectPtr, p_Stream);
+
+                if (i < s_Object->size() - 1)
+                    p_Stream << ",";
+
+                if (s_Progress)
+                    s_Progress->CompleteElements(1);
+            }
+
+            p_Stream << "]";
+        }
     }
 
 	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target)
     {
         auto* s_Object = reinterpret_cast<TArray<T>*>(p_Target);
 
+        if constexpr (NumericArrayJson::IsSupported<T>)
         {
+            if constexpr (!std::is_same_v<T, bool>)
+            {
+                if (const auto s_Data = BinarySidecarReader::Resolve(p_Document))
+                {
+                    if (s_Data->size() % sizeof(T) != 0)
+                        throw std::runtime_error("Binary sidecar data length is not a multiple of the array element size.");
+
+                    s_Object->assign(reinterpret_cast<const T*>(s_Data->data()), s_Data->size() / sizeof(T));
+                    return;
+                }
+            }
+
+            // Parse the raw array text directly instead of going through every value with simdjson.
+            simdjson::ondemand::array s_Array0 = p_Document;
+            const std::string_view s_Json = s_Array0.raw_json();
+
+            s_Object->resize(NumericArrayJson::Count(s_Json));
+            NumericArrayJson::Parse(s_Json, s_Object->begin(), s_Object->size());
+        }
+        else
+        {
+            // Huge arrays of structs (eg. sub-entities and waypoints) are parsed on the worker pool.
+            if (WorkerPool::IsParallel())
+            {
+                ParallelJsonReader::ReadElements(p_Document, [&](size_t p_Count) { s_Object->resize(p_Count); }, [&](size_t p_Index, simdjson::ondemand::value p_Element)
+                {
+                    T::FromSimpleJson(p_Element, &s_Object->operator[](p_Index));
+                });
+
+                return;
+            }
+
             simdjson::ondemand::array s_Array0 = p_Document;
             s_Object->resize(s_Array0.count_elements());
             size_t s_Index0 = 0;
 
+            auto* s_Progress = JobProgress::BeginElements(s_Object->size());
+
             for (simdjson::ondemand::value s_Item0 : s_Array0)
             {
                 T::FromSimpleJson(s_Item0, &s_Object->operator[](s_Index0++));
+
+                if (s_Progress)
+                    s_Progress->CompleteElements(1);
             }
         }
     }
 
+	// Numbers are stored as CBOR typed arrays. Bools aren't, since RFC 8746 has no typed array for them.
+	static constexpr bool c_IsCborTypedArray = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+	static_assert(!c_IsCborTypedArray || CborTypedArrayOf<T>() != ECborTypedArray::None);
+
+	static void WriteCbor(void* p_Object, CborWriter& p_Writer)
+	{
+		auto* s_Object = reinterpret_cast<TArray<T>*>(p_Object);
+
+		// Arrays of numbers are written as typed arrays, straight from the array's memory.
+		if constexpr (c_IsCborTypedArray)
+		{
+			p_Writer.WriteTypedArray(s_Object->begin(), s_Object->size());
+		}
+		else
+		{
+			p_Writer.BeginArray(s_Object->size());
+
+			auto* s_Progress = JobProgress::BeginElements(s_Object->size());
+
+			for (size_t i = 0; i < s_Object->size(); ++i)
+			{
+				ZHMCbor<T>::Write(&s_Object->operator[](i), p_Writer);
+
+				if (s_Progress)
+					s_Progress->CompleteElements(1);
+			}
+		}
+	}
+
+	static void FromCbor(CborReader& p_Reader, void* p_Target)
+	{
+		auto* s_Object = reinterpret_cast<TArray<T>*>(p_Target);
+
+		if constexpr (c_IsCborTypedArray)
+		{
+			if (const auto s_TypedArray = p_Reader.TryReadTypedArray())
+			{
+				s_Object->resize(s_TypedArray->m_Count);
+				CborReader::ReadTypedArray(*s_TypedArray, s_Object->begin());
+				return;
+			}
+		}
+
+		auto s_Array = p_Reader.ReadArray();
+		s_Object->resize(p_Reader.Count(s_Array));
+
+		auto* s_Progress = JobProgress::BeginElements(s_Object->size());
+
+		for (size_t i = 0; p_Reader.Next(s_Array); ++i)
+		{
+			ZHMCbor<T>::Read(p_Reader, &s_Object->operator[](i));
+
+			if (s_Progress)
+				s_Progress->CompleteElements(1);
+		}
+	}
+
 	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, uintptr_t p_OwnOffset)
 	{
 		auto* s_Object = reinterpret_cast<TArray<T>*>(p_Object);
@@ -64,6 +206,22 @@ public:
 		}
 		else
 		{
+			constexpr bool s_IsRelocationFree = ZHMIsRelocationFree_v<T>;
+
+			const std::string_view s_Payload(reinterpret_cast<const char*>(s_Object->m_pBegin), sizeof(T) * s_Object->size());
+
+			// Arrays of relocation-free types don't contain any pointers, so identical ones can share the same data.
+			if constexpr (s_IsRelocationFree)
+			{
+				if (const auto s_ExistingOffset = p_Serializer.GetExistingPayload(ZHMSerializer::PayloadKind::Array, sizeof(T), s_Payload))
+				{
+					p_Serializer.PatchPtr(p_OwnOffset + offsetof(TArray<T>, m_pBegin), *s_ExistingOffset);
+					p_Serializer.PatchPtr(p_OwnOffset + offsetof(TArray<T>, m_pEnd), *s_ExistingOffset + s_Payload.size());
+					p_Serializer.PatchPtr(p_OwnOffset + offsetof(TArray<T>, m_pAllocationEnd), *s_ExistingOffset + s_Payload.size());
+					return;
+				}
+			}
+
 			if (p_Serializer.InCompatibilityMode())
 			{
 				// Prefix the array data with a 32-bit count of elements. This isn't used by the game but
@@ -81,17 +239,20 @@ public:
 			// And now write the array data.
 			auto s_ElementsPtr = p_Serializer.WriteMemory(s_Object->m_pBegin, sizeof(T) * s_Object->size(), sizeof(zhmptr_t));
 
-			for (size_t i = 0; i < s_Object->size(); ++i)
+			if constexpr (!s_IsRelocationFree)
 			{
-				auto& s_Item = s_Object->begin()[i];
-
-				if constexpr(!std::is_fundamental_v<T> && !std::is_enum_v<T>)
+				p_Serializer.SerializeElements(s_Object->size(), [&](ZHMSerializer& p_ElementSerializer, size_t i)
 				{
+					auto& s_Item = s_Object->begin()[i];
+
 					uintptr_t s_Offset = s_ElementsPtr + sizeof(T) * i;
-					T::Serialize(&s_Item, p_Serializer, s_Offset);
-				}
+					T::Serialize(&s_Item, p_ElementSerializer, s_Offset);
+				});
 			}
 
+			if constexpr (s_IsRelocationFree)
+				p_Serializer.RegisterPayload(ZHMSerializer::PayloadKind::Array, sizeof(T), s_Payload, s_ElementsPtr);
+
 			p_Serializer.PatchPtr(p_OwnOffset + offsetof(TArray<T>, m_pBegin), s_ElementsPtr);
 			p_Serializer.PatchPtr(p_OwnOffset + offsetof(TArray<T>, m_pEnd), s_ElementsPtr + sizeof(T) * s_Object->size());
 			p_Serializer.PatchPtr(p_OwnOffset + offsetof(TArray<T>, m_pAllocationEnd), s_ElementsPtr + sizeof(T) * s_Object->size());
@@ -108,29 +269,17 @@ public:
         m_pBegin(nullptr),
         m_pEnd(nullptr),
         m_pAllocationEnd(nullptr) {
-        if (p_Other.size() == 0) {
-            return;
-        }
-
-        for (const auto& s_Value : p_Other) {
-            push_back(s_Value);
-        }
+        assign(p_Other.data(), p_Other.size());
     }
 
     TArray(const TArray<T>& p_Other) :
         m_pBegin(nullptr),
         m_pEnd(nullptr),
         m_pAllocationEnd(nullptr) {
-        if (p_Other.size() == 0) {
-            return;
-        }
-
-        for (const auto& s_Value : p_Other) {
-            push_back(s_Value);
-        }
+        assign(p_Other.begin(), p_Other.size());
     }
 
-    TArray(TArray<T>&& p_Other) {
+    TArray(TArray<T>&& p_Other) noexcept {
         m_pBegin = p_Other.m_pBegin;
         m_pEnd = p_Other.m_pEnd;
         m_pAllocationEnd = p_Other.m_pAllocationEnd;
@@ -141,8 +290,7 @@ public:
     }
 
     ~TArray() {
-        for (T* s_Item = begin(); s_Item != end(); ++s_Item)
-            s_Item->~T();
+        destroy_range(begin(), end());
 
         if (!hasInlineFlag()) {
             c_aligned_free(m_pBegin);
@@ -154,17 +302,17 @@ public:
             return *this;
         }
 
-        clear();
-
-        for (const auto& s_Value : p_Other) {
-            push_back(s_Value);
-        }
+        assign(p_Other.begin(), p_Other.size());
 
         return *this;
     }
 
-    TArray& operator=(TArray<T>&& p_Other) {
-        clear();
+    TArray& operator=(TArray<T>&& p_Other) noexcept {
+        if (this == &p_Other) {
+            return *this;
+        }
+
+        release();
 
         m_pBegin = p_Other.m_pBegin;
         m_pEnd = p_Other.m_pEnd;
@@ -177,9 +325,22 @@ public:
         return *this;
     }
 
+    /**
+     * Make sure the array can hold at least the specified number of elements without reallocating.
+     * The new allocation is sized exactly, so reserving up front avoids any slack in the buffer.
+     * @param p_Capacity The minimum capacity of the array.
+     */
+    void reserve(size_t p_Capacity) {
+        if (hasInlineFlag() ? p_Capacity == 0 : p_Capacity <= capacity()) {
+            return;
+        }
+
+        reallocate(std::max(p_Capacity, size()));
+    }
+
     /**
      * Resize the array to the specified size.
-     * @param p_NewSize The new capacity of the array.
+     * @param p_NewSize The new size of the array.
      */
     void resize(size_t p_NewSize) {
         if (p_NewSize == 0) {
@@ -187,45 +348,92 @@ public:
             return;
         }
 
-        // Out of space, need to allocate a new array and move everything over.
-        // We will allocate double the existing capacity.
-        const size_t s_NewSize = p_NewSize;
         const size_t s_CurrentSize = size();
-        const auto s_NewBegin = static_cast<T*>(c_aligned_alloc(sizeof(T) * s_NewSize, alignof(T)));
 
-        const auto s_CopySize = std::min(s_CurrentSize, s_NewSize);
+        if (hasInlineFlag() || p_NewSize > capacity()) {
+            reallocate(std::max(p_NewSize, s_CurrentSize));
+        }
 
-        // Copy the old data over to the new array.
-        for (size_t i = 0; i < s_CopySize; ++i) {
-            new(&s_NewBegin[i]) T(std::move(operator[](i)));
+        if (p_NewSize < s_CurrentSize) {
+            // Shrinking keeps the allocation around so it can be re-used.
+            destroy_range(m_pBegin + p_NewSize, m_pEnd);
+            m_pEnd = m_pBegin + p_NewSize;
+            return;
         }
 
-        // Initialize new elements if the array has grown.
-        for (size_t i = s_CopySize; i < s_NewSize; ++i) {
-            new(&s_NewBegin[i]) T();
+        // Initialize the new elements.
+        construct_range(m_pEnd, m_pBegin + p_NewSize);
+        m_pEnd = m_pBegin + p_NewSize;
+    }
+
+    /**
+     * Replace the contents of the array with a copy of the specified elements.
+     * Trivially copyable elements are copied over in bulk.
+     */
+    void assign(const T* p_Values, size_t p_Count) {
+        clear();
+
+        if (p_Count == 0) {
+            return;
         }
 
-        // Destroy old elements.
-        for (T* s_Item = begin(); s_Item != end(); ++s_Item) {
-            s_Item->~T();
+        reserve(p_Count);
+        copy_construct_range(m_pBegin, p_Values, p_Count);
+        m_pEnd = m_pBegin + p_Count;
+    }
+
+    /**
+     * Append a copy of the specified elements to the end of the array.
+     * Trivially copyable elements are copied over in bulk.
+     */
+    void append(const T* p_Values, size_t p_Count) {
+        if (p_Count == 0) {
+            return;
         }
 
-        // Free old array if needed.
-        if (!hasInlineFlag()) {
-            c_aligned_free(m_pBegin);
-        }        
+        const size_t s_CurrentSize = size();
 
-        // Update the pointers.
-        m_pBegin = s_NewBegin;
-        m_pEnd = m_pBegin + s_NewSize;
-        m_pAllocationEnd = m_pEnd;
-    }
+        // The source could live in our own buffer, so copy it over before moving the existing elements.
+        if (hasInlineFlag() || s_CurrentSize + p_Count > capacity()) {
+            TArray<T> s_Grown;
+            s_Grown.reserve(s_CurrentSize + p_Count);
+            copy_construct_range(s_Grown.m_pBegin + s_CurrentSize, p_Values, p_Count);
+            s_Grown.relocate_from(*this);
+            s_Grown.m_pEnd += p_Count;
 
+            *this = std::move(s_Grown);
+            return;
+        }
+
+        copy_construct_range(m_pEnd, p_Values, p_Count);
+        m_pEnd += p_Count;
+    }
 
     void push_back(const T& p_Value) {
-        // TODO: Optimize reallocations.
-        resize(size() + 1);
-        operator[](size() - 1) = p_Value;
+        if (hasInlineFlag() || size() == capacity()) {
+            // The value could live in our own buffer, so copy it before growing.
+            push_back(T(p_Value));
+            return;
+        }
+
+        new(m_pEnd) T(p_Value);
+        ++m_pEnd;
+    }
+
+    void push_back(T&& p_Value) {
+        if (hasInlineFlag() || size() == capacity()) {
+            T s_Value(std::move(p_Value));
+
+            // Grow geometrically so repeated pushes don't reallocate every time.
+            reallocate(std::max<size_t>(size() * 2, 4));
+
+            new(m_pEnd) T(std::move(s_Value));
+            ++m_pEnd;
+            return;
+        }
+
+        new(m_pEnd) T(std::move(p_Value));
+        ++m_pEnd;
     }
 
     void insert(size_t p_Index, const T& p_Value) {
@@ -235,6 +443,9 @@ public:
             return;
         }
 
+        // Copy the value first in case it lives in this array.
+        T s_Value = p_Value;
+
         // Otherwise resize to make space for the new element.
         resize(size() + 1);
 
@@ -244,13 +455,11 @@ public:
         }
 
         // Insert the new element.
-        operator[](p_Index) = p_Value;
+        operator[](p_Index) = std::move(s_Value);
     }
 
     void clear() {
-        for (T* s_Item = begin(); s_Item != end(); ++s_Item) {
-            s_Item->~T();
-        }
+        destroy_range(begin(), end());
 
         if (hasInlineFlag()) {
             // If data was stored inline, just clear everything (including the inline flag).
@@ -258,7 +467,7 @@ public:
         }
         else {
             // We're not freeing anything here since the allocated memory can be re-used.
-            m_pBegin = m_pEnd;
+            m_pEnd = m_pBegin;
         }
     }
 
@@ -348,6 +557,10 @@ public:
             return false;
         }
 
+        if constexpr (ZHMIsBitwiseComparable_v<T>) {
+            return size() == 0 || memcmp(begin(), p_Other.begin(), sizeof(T) * size()) == 0;
+        }
+
         for (size_t i = 0; i < size(); ++i) {
             if (operator[](i) != p_Other[i]) {
                 return false;
@@ -357,6 +570,111 @@ public:
         return true;
     }
 
+private:
+    /**
+     * Move the elements into a new allocation that holds exactly [p_Capacity] elements.
+     */
+    void reallocate(size_t p_Capacity) {
+        TArray<T> s_New;
+        s_New.m_pBegin = static_cast<T*>(c_aligned_alloc(sizeof(T) * p_Capacity, alignof(T)));
+        s_New.m_pEnd = s_New.m_pBegin;
+        s_New.m_pAllocationEnd = s_New.m_pBegin + p_Capacity;
+        s_New.relocate_from(*this);
+
+        *this = std::move(s_New);
+    }
+
+    /**
+     * Move all the elements of [p_Other] to the end of this array, which must have enough capacity for them.
+     * [p_Other] is left empty but keeps its allocation.
+     */
+    void relocate_from(TArray<T>& p_Other) {
+        T* s_Source = p_Other.begin();
+        const size_t s_Count = p_Other.size();
+
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (s_Count > 0) {
+                memcpy(m_pEnd, s_Source, sizeof(T) * s_Count);
+            }
+        }
+        else {
+            for (size_t i = 0; i < s_Count; ++i) {
+                new(&m_pEnd[i]) T(std::move(s_Source[i]));
+            }
+        }
+
+        m_pEnd += s_Count;
+        p_Other.clear();
+    }
+
+    /**
+     * Destroy all elements and free the allocation, leaving the array empty.
+     */
+    void release() {
+        destroy_range(begin(), end());
+
+        if (!hasInlineFlag()) {
+            c_aligned_free(m_pBegin);
+        }
+
+        m_pBegin = m_pEnd = m_pAllocationEnd = nullptr;
+    }
+
+    static void construct_range(T* p_Begin, T* p_End) {
+        if constexpr (std::is_trivially_default_constructible_v<T> && std::is_trivially_copyable_v<T>) {
+            if (p_Begin != p_End) {
+                memset(p_Begin, 0x00, reinterpret_cast<uintptr_t>(p_End) - reinterpret_cast<uintptr_t>(p_Begin));
+            }
+        }
+        else {
+            for (T* s_Item = p_Begin; s_Item != p_End; ++s_Item) {
+                new(s_Item) T();
+            }
+        }
+    }
+
+    static void copy_construct_range(T* p_Target, const T* p_Values, size_t p_Count) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            memcpy(p_Target, p_Values, sizeof(T) * p_Count);
+        }
+        else {
+            for (size_t i = 0; i < p_Count; ++i) {
+                new(&p_Target[i]) T(p_Values[i]);
+            }
+        }
+    }
+
+    static void destroy_range(T* p_Begin, T* p_End) {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (T* s_Item = p_Begin; s_Item != p_End; ++s_Item) {
+                s_Item->~T();
+            }
+        }
+    }
+
+    /**
+     * Name of the element type in trace events. Element types without a type info of their own share one.
+     */
+    static std::string_view TraceElementType() {
+        if constexpr (requires { T::TypeInfo.TypeName(); }) {
+            return T::TypeInfo.TypeName();
+        }
+        else if constexpr (std::is_same_v<T, bool>) {
+            return "bool";
+        }
+        else if constexpr (std::is_floating_point_v<T>) {
+            return sizeof(T) == 4 ? "float32" : "float64";
+        }
+        else if constexpr (std::is_integral_v<T>) {
+            constexpr std::string_view s_Signed[] = { "int8", "int16", "int32", "int64" };
+            constexpr std::string_view s_Unsigned[] = { "uint8", "uint16", "uint32", "uint64" };
+            return (std::is_signed_v<T> ? s_Signed : s_Unsigned)[std::bit_width(sizeof(T)) - 1];
+        }
+        else {
+            return "TArray";
+        }
+    }
+
 public:
     T* m_pBegin;
     T* m_pEnd;
@@ -484,6 +802,8 @@ public:
 template <typename TElement, size_t TCapacity>
 class TFixedArray : public TFixedArrayBase<TElement, ZFixedArrayData<TElement, TCapacity>> {
 public:
+    static constexpr bool IsRelocationFree = ZHMIsRelocationFree_v<TElement>;
+
     static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, uintptr_t p_OwnOffset)
     {
         auto* s_Object = reinterpret_cast<TFixedArray*>(p_Object);
@@ -492,7 +812,7 @@ public:
         {
             auto& s_Item = s_Object->begin()[i];
 
-            if constexpr (!std::is_fundamental_v<TElement> && !std::is_enum_v<TElement>)
+            if constexpr (!ZHMIsRelocationFree_v<TElement>)
             {
                 uintptr_t s_Offset = p_OwnOffset + c_get_aligned(sizeof(TElement), alignof(TElement)) * i;
                 TElement::Serialize(&s_Item, p_Serializer, s_Offset);
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <type_traits>
-#include <External/simdjson.h>
+#include <External/simdjson_helpers.h>
+
+#include "ZHMCbor.h"
 
 template <typename T, typename Z>
 class TPair
@@ -14,14 +16,14 @@ public:
 		p_Stream << "{" << "\"first\"" << ":";
 		
 		if constexpr (std::is_fundamental_v<T>)
-			p_Stream << s_Object->first;
+			p_Stream << simdjson::as_json_string(s_Object->first);
 		else
 			T::WriteJson(&s_Object->first, p_Stream);
 
 		p_Stream << "," << "\"second\"" << ":";
 		
 		if constexpr (std::is_fundamental_v<Z>)
-			p_Stream << s_Object->second;
+			p_Stream << simdjson::as_json_string(s_Object->second);
 		else
 			T::WriteJson(&s_Object->second, p_Stream);
 
@@ -35,14 +37,14 @@ public:
 		p_Stream << "[";
 
 		if constexpr(std::is_fundamental_v<T>)
-			p_Stream << s_Object->first;
+			p_Stream << simdjson::as_json_string(s_Object->first);
 		else
 			T::WriteSimpleJson(&s_Object->first, p_Stream);
 
 		p_Stream << ",";
 
 		if constexpr (std::is_fundamental_v<Z>)
-			p_Stream << s_Object->second;
+			p_Stream << simdjson::as_json_string(s_Object->second);
 		else
 			Z::WriteSimpleJson(&s_Object->second, p_Stream);
 
@@ -109,6 +111,33 @@ public:
 		}	
 	}
 
+	static void WriteCbor(void* p_Object, CborWriter& p_Writer)
+	{
+		auto s_Object = static_cast<TPair<T, Z>*>(p_Object);
+
+		p_Writer.BeginArray(2);
+
+		ZHMCbor<T>::Write(&s_Object->first, p_Writer);
+		ZHMCbor<Z>::Write(&s_Object->second, p_Writer);
+	}
+
+	static void FromCbor(CborReader& p_Reader, void* p_Target)
+	{
+		auto s_Object = reinterpret_cast<TPair<T, Z>*>(p_Target);
+
+		auto s_Array = p_Reader.ReadArray();
+
+		if (p_Reader.Next(s_Array))
+			ZHMCbor<T>::Read(p_Reader, &s_Object->first);
+
+		if (p_Reader.Next(s_Array))
+			ZHMCbor<Z>::Read(p_Reader, &s_Object->second);
+
+		// Anything past the pair is ignored, like in json.
+		while (p_Reader.Next(s_Array))
+			p_Reader.Skip();
+	}
+
 	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, uintptr_t p_OwnOffset)
 	{
 		typedef TPair<T, Z> ThisPair;
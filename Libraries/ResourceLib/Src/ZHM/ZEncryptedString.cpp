@@ -24,35 +24,50 @@ void ZEncryptedString::WriteSimpleJson(void* p_Object, std::ostream& p_Stream)
 
 void ZEncryptedString::FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target)
 {
-	ZEncryptedString s_String = std::string_view(p_Document);
-	*reinterpret_cast<ZEncryptedString*>(p_Target) = s_String;
+	reinterpret_cast<ZEncryptedString*>(p_Target)->SetInterned(std::string_view(p_Document));
 }
 
 void ZEncryptedString::Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset)
 {
 	const auto* s_Object = reinterpret_cast<ZEncryptedString*>(p_Object);
-	const auto s_EncryptedData = s_Object->EncryptToString();
+	const auto s_EncryptedSize = XTEA::EncryptedSize(s_Object->size());
+
+	// Encryption is deterministic, so identical strings can share the same encrypted data.
+	const auto s_ExistingOffset = p_Serializer.GetExistingPayload(ZHMSerializer::PayloadKind::EncryptedString, 1, s_Object->string_view());
 
 	uintptr_t s_StrDataOffset;
 
-	if (p_Serializer.InCompatibilityMode())
+	if (s_ExistingOffset)
 	{
-		// In compatibility mode we prepend a 32-bit integer with the length of the string.
-		uint32_t s_StrLen = s_EncryptedData.size();
-		p_Serializer.WriteMemory(&s_StrLen, sizeof(s_StrLen), 4);
-
-		// And then we write the string data, unaligned.
-		s_StrDataOffset = p_Serializer.WriteMemoryUnaligned(const_cast<char*>(s_EncryptedData.data()), s_EncryptedData.size());
+		s_StrDataOffset = *s_ExistingOffset;
 	}
 	else
 	{
-		// Otherwise we just write the string data alone.
-		s_StrDataOffset = p_Serializer.WriteMemory(const_cast<char*>(s_EncryptedData.data()), s_EncryptedData.size(), alignof(char*));
+		if (p_Serializer.InCompatibilityMode())
+		{
+			// In compatibility mode we prepend a 32-bit integer with the length of the string.
+			uint32_t s_StrLen = s_EncryptedSize;
+			p_Serializer.WriteMemory(&s_StrLen, sizeof(s_StrLen), 4);
+
+			// And then we write the string data, unaligned.
+			s_StrDataOffset = p_Serializer.ReserveMemoryUnaligned(s_EncryptedSize);
+		}
+		else
+		{
+			// Otherwise we just write the string data alone.
+			s_StrDataOffset = p_Serializer.ReserveMemory(s_EncryptedSize, alignof(char*));
+		}
+
+		// Encrypt the string directly in the serializer buffer. The reserved memory is
+		// zeroed, so the padding is already there.
+		s_Object->EncryptTo(p_Serializer.MemoryAt(s_StrDataOffset));
+
+		p_Serializer.RegisterPayload(ZHMSerializer::PayloadKind::EncryptedString, 1, s_Object->string_view(), s_StrDataOffset);
 	}
 
 	// Some strings can have the allocated flag, so we rewrite the length without it
 	// cause otherwise the game will try to do some weird re-allocation shit and crash spectacularly.
-	p_Serializer.PatchValue<int32_t>(p_OwnOffset + offsetof(ZEncryptedString, m_nLength), s_EncryptedData.size() | 0x40000000);
+	p_Serializer.PatchValue<int32_t>(p_OwnOffset + offsetof(ZEncryptedString, m_nLength), s_EncryptedSize | 0x40000000);
 	p_Serializer.PatchPtr(p_OwnOffset + offsetof(ZEncryptedString, m_pChars), s_StrDataOffset);
 }
 
@@ -88,7 +103,8 @@ void ZEncryptedString::DecryptInPlace()
 	}
 }
 
-std::string ZEncryptedString::EncryptToString() const
+void ZEncryptedString::EncryptTo(void* p_Target) const
 {
-	return XTEA::Encrypt(string_view(), XTEA::c_L10nRounds, XTEA::c_L10nKey, XTEA::c_L10nDelta);
+	memcpy(p_Target, c_str(), size());
+	XTEA::EncryptInPlace(p_Target, XTEA::EncryptedSize(size()), XTEA::c_L10nRounds, XTEA::c_L10nKey, XTEA::c_L10nDelta);
 }
@@ -22,5 +22,9 @@ public:
 	ZEncryptedString(const std::string& p_Str) : ZString(p_Str) {}
 
 	void DecryptInPlace();
-	std::string EncryptToString() const;
+	/**
+	 * Writes the encrypted string to [p_Target], which must be XTEA::EncryptedSize(size())
+	 * bytes long and zeroed, so it already contains the padding.
+	 */
+	void EncryptTo(void* p_Target) const;
 };
\ No newline at end of file
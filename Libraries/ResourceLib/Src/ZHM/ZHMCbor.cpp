@@ -0,0 +1,18 @@
+#include "ZHMCbor.h"
+
+#include <CborTranscoder.h>
+
+void ZHMCborFallback::WriteJson(const std::string& p_Json, CborWriter& p_Writer)
+{
+	simdjson::dom::parser s_Parser;
+	CborTranscoder::JsonToCbor(s_Parser.parse(p_Json), p_Writer);
+}
+
+simdjson::padded_string ZHMCborFallback::ReadJson(CborReader& p_Reader)
+{
+	std::string s_Json = "[";
+	CborTranscoder::CborToJson(p_Reader, s_Json);
+	s_Json += ']';
+
+	return simdjson::padded_string(s_Json);
+}
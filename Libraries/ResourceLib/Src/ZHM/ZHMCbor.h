@@ -0,0 +1,90 @@
+#pragma once
+
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#include <External/simdjson.h>
+#include <Util/Cbor.h>
+
+/**
+ * Writes and reads values of types that have no CBOR code of their own through their simple json
+ * representation, one value at a time. This is only used by a handful of hand-written types.
+ */
+class ZHMCborFallback
+{
+public:
+	template <class TWriteJson>
+	static void Write(TWriteJson&& p_WriteJson, CborWriter& p_Writer)
+	{
+		std::ostringstream s_Stream;
+		s_Stream << std::boolalpha;
+
+		p_WriteJson(s_Stream);
+
+		WriteJson(s_Stream.str(), p_Writer);
+	}
+
+	template <class TReadJson>
+	static void Read(CborReader& p_Reader, TReadJson&& p_ReadJson)
+	{
+		const simdjson::padded_string s_Json = ReadJson(p_Reader);
+
+		simdjson::ondemand::parser s_Parser;
+		simdjson::ondemand::document s_Document = s_Parser.iterate(s_Json);
+
+		// The value is wrapped in an array since scalar documents can't be read as values.
+		for (simdjson::ondemand::value s_Value : s_Document.get_array())
+		{
+			p_ReadJson(s_Value);
+			break;
+		}
+	}
+
+private:
+	static void WriteJson(const std::string& p_Json, CborWriter& p_Writer);
+	static simdjson::padded_string ReadJson(CborReader& p_Reader);
+};
+
+/**
+ * CBOR codec of a compiled type. The CBOR documents have the same shape as the simple json ones.
+ * Numbers are written directly, types with a type info (everything CodeGen generates) go through it,
+ * and types with their own WriteCbor / FromCbor statics (TArray, ZString, ZVariant, ...) use those.
+ */
+template <class T>
+struct ZHMCbor
+{
+	static void Write(void* p_Object, CborWriter& p_Writer)
+	{
+		if constexpr (std::is_same_v<T, bool>)
+			p_Writer.WriteBool(*static_cast<bool*>(p_Object));
+		else if constexpr (std::is_integral_v<T>)
+			p_Writer.WriteInteger(*static_cast<T*>(p_Object));
+		else if constexpr (std::is_same_v<T, float>)
+			p_Writer.WriteFloat(*static_cast<float*>(p_Object));
+		else if constexpr (std::is_same_v<T, double>)
+			p_Writer.WriteDouble(*static_cast<double*>(p_Object));
+		else if constexpr (requires { T::WriteCbor(p_Object, p_Writer); })
+			T::WriteCbor(p_Object, p_Writer);
+		else if constexpr (requires { T::TypeInfo.WriteCbor(p_Object, p_Writer); })
+			T::TypeInfo.WriteCbor(p_Object, p_Writer);
+		else
+			ZHMCborFallback::Write([&](std::ostream& p_Stream) { T::WriteSimpleJson(p_Object, p_Stream); }, p_Writer);
+	}
+
+	static void Read(CborReader& p_Reader, void* p_Target)
+	{
+		if constexpr (std::is_same_v<T, bool>)
+			*static_cast<bool*>(p_Target) = p_Reader.ReadBool();
+		else if constexpr (std::is_integral_v<T>)
+			*static_cast<T*>(p_Target) = p_Reader.ReadInteger<T>();
+		else if constexpr (std::is_floating_point_v<T>)
+			*static_cast<T*>(p_Target) = static_cast<T>(p_Reader.ReadDouble());
+		else if constexpr (requires { T::FromCbor(p_Reader, p_Target); })
+			T::FromCbor(p_Reader, p_Target);
+		else if constexpr (requires { T::TypeInfo.CreateFromCbor(p_Reader, p_Target); })
+			T::TypeInfo.CreateFromCbor(p_Reader, p_Target);
+		else
+			ZHMCborFallback::Read(p_Reader, [&](simdjson::ondemand::value p_Value) { T::FromSimpleJson(p_Value, p_Target); });
+	}
+};
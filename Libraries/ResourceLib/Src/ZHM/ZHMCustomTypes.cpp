@@ -2,6 +2,7 @@
 
 #include "External/simdjson_helpers.h"
 #include "Util/Base64.h"
+#include "Util/BinarySidecar.h"
 
 #include <map>
 
@@ -15,7 +16,7 @@
 #include <Generated/KNT/ZHMGen.h>
 #endif
 
-ZHMTypeInfo SAudioSwitchBlueprintData::TypeInfo = ZHMTypeInfo("SAudioSwitchBlueprintData", sizeof(SAudioSwitchBlueprintData), alignof(SAudioSwitchBlueprintData), WriteSimpleJson, FromSimpleJson, Serialize);
+constinit ZHMTypeInfo SAudioSwitchBlueprintData::TypeInfo = ZHMTypeInfo("SAudioSwitchBlueprintData", "\"SAudioSwitchBlueprintData\"", sizeof(SAudioSwitchBlueprintData), alignof(SAudioSwitchBlueprintData), WriteSimpleJson, FromSimpleJson, Serialize);
 
 void SAudioSwitchBlueprintData::WriteSimpleJson(void* p_Object, std::ostream& p_Stream)
 {
@@ -68,7 +69,7 @@ void SAudioSwitchBlueprintData::Serialize(void* p_Object, ZHMSerializer& p_Seria
 	TArray<ZString>::Serialize(&s_Object->m_aSwitches, p_Serializer, p_OwnOffset + offsetof(SAudioSwitchBlueprintData, m_aSwitches));
 }
 
-ZHMTypeInfo SScaleformGFxResource::TypeInfo = ZHMTypeInfo("SScaleformGFxResource", sizeof(SScaleformGFxResource), alignof(SScaleformGFxResource), WriteSimpleJson, FromSimpleJson, Serialize, nullptr, Destroy);
+constinit ZHMTypeInfo SScaleformGFxResource::TypeInfo = ZHMTypeInfo("SScaleformGFxResource", "\"SScaleformGFxResource\"", sizeof(SScaleformGFxResource), alignof(SScaleformGFxResource), WriteSimpleJson, FromSimpleJson, Serialize, nullptr, Destroy);
 
 void SScaleformGFxResource::WriteSimpleJson(void* p_Object, std::ostream& p_Stream)
 {
@@ -76,8 +77,14 @@ void SScaleformGFxResource::WriteSimpleJson(void* p_Object, std::ostream& p_Stre
 
 	auto s_Object = static_cast<SScaleformGFxResource*>(p_Object);
 
-	std::string s_SwfData(s_Object->m_pSwfData, s_Object->m_pSwfData + s_Object->m_nSwfDataSize);
-	p_Stream << "\"m_pSwfData\"" << ":" << simdjson::as_json_string(Base64::Encode(s_SwfData)) << ",";
+	auto* s_Sidecar = BinarySidecarWriter::Current();
+
+	p_Stream << "\"m_pSwfData\"" << ":";
+
+	if (!s_Sidecar || !s_Sidecar->TryWrite(s_Object->m_pSwfData, s_Object->m_nSwfDataSize, p_Stream))
+		Base64::EncodeJsonString(std::span<const uint8_t>(s_Object->m_pSwfData, s_Object->m_nSwfDataSize), p_Stream);
+
+	p_Stream << ",";
 
 	p_Stream << "\"m_pAdditionalFileNames\"" << ":[";
 
@@ -99,8 +106,8 @@ void SScaleformGFxResource::WriteSimpleJson(void* p_Object, std::ostream& p_Stre
 	{
 		auto& s_Item = s_Object->m_pAdditionalFileData[i];
 
-		std::string s_Data(s_Item.begin(), s_Item.end());
-		p_Stream << simdjson::as_json_string(Base64::Encode(s_Data));
+		if (!s_Sidecar || !s_Sidecar->TryWrite(s_Item.begin(), s_Item.size(), p_Stream))
+			Base64::EncodeJsonString(std::span<const uint8_t>(s_Item.begin(), s_Item.size()), p_Stream);
 
 		if (i < s_Object->m_pAdditionalFileData.size() - 1)
 			p_Stream << ",";
@@ -115,14 +122,34 @@ void SScaleformGFxResource::FromSimpleJson(simdjson::ondemand::value p_Document,
 {
 	auto* s_Object = reinterpret_cast<SScaleformGFxResource*>(p_Target);
 
-	std::string s_SwfDataStr;
-	Base64::Decode(std::string_view(p_Document["m_pSwfData"]), s_SwfDataStr);
+	simdjson::ondemand::value s_SwfDataValue = p_Document["m_pSwfData"];
 
-	auto* s_SwfData = c_aligned_alloc(s_SwfDataStr.size(), alignof(uint8_t*));
-	memcpy(s_SwfData, s_SwfDataStr.data(), s_SwfDataStr.size());
+	size_t s_SwfDataSize;
+	uint8_t* s_SwfData;
 
-	s_Object->m_nSwfDataSize = s_SwfDataStr.size();
-	s_Object->m_pSwfData = reinterpret_cast<uint8_t*>(s_SwfData);
+	if (const auto s_SidecarData = BinarySidecarReader::Resolve(s_SwfDataValue))
+	{
+		s_SwfDataSize = s_SidecarData->size();
+		s_SwfData = reinterpret_cast<uint8_t*>(c_aligned_alloc(s_SwfDataSize, alignof(uint8_t*)));
+		memcpy(s_SwfData, s_SidecarData->data(), s_SwfDataSize);
+	}
+	else
+	{
+		const std::string_view s_SwfDataStr = s_SwfDataValue;
+		s_SwfDataSize = Base64::DecodedSize(s_SwfDataStr);
+
+		// Decode straight into the final allocation.
+		s_SwfData = reinterpret_cast<uint8_t*>(c_aligned_alloc(s_SwfDataSize, alignof(uint8_t*)));
+
+		if (!Base64::Decode(s_SwfDataStr, std::span(s_SwfData, s_SwfDataSize)))
+		{
+			c_aligned_free(s_SwfData);
+			throw std::runtime_error("Invalid base64 in m_pSwfData.");
+		}
+	}
+
+	s_Object->m_nSwfDataSize = s_SwfDataSize;
+	s_Object->m_pSwfData = s_SwfData;
 
 	{
 		simdjson::ondemand::array s_Array = p_Document["m_pAdditionalFileNames"];
@@ -140,13 +167,23 @@ void SScaleformGFxResource::FromSimpleJson(simdjson::ondemand::value p_Document,
 		s_Object->m_pAdditionalFileData.resize(s_Array.count_elements());
 
 		size_t s_Index = 0;
-		for (auto s_Item : s_Array)
+		for (simdjson::ondemand::value s_Item : s_Array)
 		{
-			std::string s_Data;
-			Base64::Decode(std::string_view(s_Item), s_Data);
+			auto& s_Data = s_Object->m_pAdditionalFileData[s_Index];
+
+			if (const auto s_SidecarData = BinarySidecarReader::Resolve(s_Item))
+			{
+				s_Data.assign(s_SidecarData->data(), s_SidecarData->size());
+				++s_Index;
+				continue;
+			}
 
-			s_Object->m_pAdditionalFileData[s_Index].resize(s_Data.size());
-			memcpy(s_Object->m_pAdditionalFileData[s_Index].begin(), s_Data.data(), s_Data.size());
+			const std::string_view s_DataStr = s_Item;
+
+			s_Data.resize(Base64::DecodedSize(s_DataStr));
+
+			if (!Base64::Decode(s_DataStr, std::span(s_Data.begin(), s_Data.size())))
+				throw std::runtime_error("Invalid base64 in m_pAdditionalFileData.");
 
 			++s_Index;
 		}
@@ -176,7 +213,7 @@ void SScaleformGFxResource::Destroy(void* p_Object)
 	}
 }
 
-ZHMTypeInfo SGlobalResourceIndexItem::TypeInfo = ZHMTypeInfo("SGlobalResourceIndexItem", sizeof(SGlobalResourceIndexItem), alignof(SGlobalResourceIndexItem), WriteSimpleJson, FromSimpleJson, Serialize);
+constinit ZHMTypeInfo SGlobalResourceIndexItem::TypeInfo = ZHMTypeInfo("SGlobalResourceIndexItem", "\"SGlobalResourceIndexItem\"", sizeof(SGlobalResourceIndexItem), alignof(SGlobalResourceIndexItem), WriteSimpleJson, FromSimpleJson, Serialize);
 
 void SGlobalResourceIndexItem::WriteSimpleJson(void* p_Object, std::ostream& p_Stream)
 {
@@ -229,7 +266,7 @@ void SGlobalResourceIndexItem::Serialize(void* p_Object, ZHMSerializer& p_Serial
 	TArray<uint32_t>::Serialize(&s_Object->m_aResourceIndices, p_Serializer, p_OwnOffset + offsetof(SGlobalResourceIndexItem, m_aResourceIndices));
 }
 
-ZHMTypeInfo SGlobalResourceIndex::TypeInfo = ZHMTypeInfo("SGlobalResourceIndex", sizeof(SGlobalResourceIndex), alignof(SGlobalResourceIndex), WriteSimpleJson, FromSimpleJson, Serialize);
+constinit ZHMTypeInfo SGlobalResourceIndex::TypeInfo = ZHMTypeInfo("SGlobalResourceIndex", "\"SGlobalResourceIndex\"", sizeof(SGlobalResourceIndex), alignof(SGlobalResourceIndex), WriteSimpleJson, FromSimpleJson, Serialize);
 
 void SGlobalResourceIndex::WriteSimpleJson(void* p_Object, std::ostream& p_Stream)
 {
@@ -277,7 +314,7 @@ void SGlobalResourceIndex::Serialize(void* p_Object, ZHMSerializer& p_Serializer
 	TArray<SGlobalResourceIndexItem>::Serialize(&s_Object->m_aItems, p_Serializer, p_OwnOffset + offsetof(SGlobalResourceIndex, m_aItems));
 }
 
-ZHMTypeInfo SAudioStateBlueprintData::TypeInfo = ZHMTypeInfo("SAudioStateBlueprintData", sizeof(SAudioStateBlueprintData), alignof(SAudioStateBlueprintData), WriteSimpleJson, FromSimpleJson, Serialize);
+constinit ZHMTypeInfo SAudioStateBlueprintData::TypeInfo = ZHMTypeInfo("SAudioStateBlueprintData", "\"SAudioStateBlueprintData\"", sizeof(SAudioStateBlueprintData), alignof(SAudioStateBlueprintData), WriteSimpleJson, FromSimpleJson, Serialize);
 
 void SAudioStateBlueprintData::WriteSimpleJson(void* p_Object, std::ostream& p_Stream)
 {
@@ -330,7 +367,7 @@ void SAudioStateBlueprintData::Serialize(void* p_Object, ZHMSerializer& p_Serial
 	TArray<ZString>::Serialize(&s_Object->m_aStates, p_Serializer, p_OwnOffset + offsetof(SAudioStateBlueprintData, m_aStates));
 }
 
-ZHMTypeInfo SAttributeInfo::TypeInfo = ZHMTypeInfo("SAttributeInfo", sizeof(SAttributeInfo), alignof(SAttributeInfo), WriteSimpleJson, FromSimpleJson, Serialize);
+constinit ZHMTypeInfo SAttributeInfo::TypeInfo = ZHMTypeInfo("SAttributeInfo", "\"SAttributeInfo\"", sizeof(SAttributeInfo), alignof(SAttributeInfo), WriteSimpleJson, FromSimpleJson, Serialize);
 
 std::map<uint32_t, std::string> EAttributeKind = {
 	{ 0, "E_ATTRIBUTE_KIND_PROPERTY" },
@@ -427,7 +464,7 @@ void SAttributeInfo::Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmp
 	ZString::Serialize(&s_Object->m_sName, p_Serializer, p_OwnOffset + offsetof(SAttributeInfo, m_sName));
 }
 
-ZHMTypeInfo SUIControlBlueprint::TypeInfo = ZHMTypeInfo("SUIControlBlueprint", sizeof(SUIControlBlueprint), alignof(SUIControlBlueprint), WriteSimpleJson, FromSimpleJson, Serialize);
+constinit ZHMTypeInfo SUIControlBlueprint::TypeInfo = ZHMTypeInfo("SUIControlBlueprint", "\"SUIControlBlueprint\"", sizeof(SUIControlBlueprint), alignof(SUIControlBlueprint), WriteSimpleJson, FromSimpleJson, Serialize);
 
 void SUIControlBlueprint::WriteSimpleJson(void* p_Object, std::ostream& p_Stream)
 {
@@ -534,7 +571,7 @@ void SUIControlBlueprint::Serialize(void* p_Object, ZHMSerializer& p_Serializer,
 	TArray<bool>::Serialize(&s_Object->m_aSpecialMethods, p_Serializer, p_OwnOffset + offsetof(SUIControlBlueprint, m_aSpecialMethods));
 }
 
-ZHMTypeInfo SEnumType::TypeInfo = ZHMTypeInfo("SEnumType", sizeof(SEnumType), alignof(SEnumType), WriteSimpleJson, FromSimpleJson, Serialize);
+constinit ZHMTypeInfo SEnumType::TypeInfo = ZHMTypeInfo("SEnumType", "\"SEnumType\"", sizeof(SEnumType), alignof(SEnumType), WriteSimpleJson, FromSimpleJson, Serialize);
 
 void SEnumType::WriteSimpleJson(void* p_Object, std::ostream& p_Stream)
 {
@@ -608,7 +645,7 @@ void SEnumType::Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t
 	TArray<uint32_t>::Serialize(&s_Object->m_aItemValues, p_Serializer, p_OwnOffset + offsetof(SEnumType, m_aItemValues));
 }
 
-ZHMTypeInfo SLocalizedVideoDataDecrypted::TypeInfo = ZHMTypeInfo("SLocalizedVideoDataDecrypted", sizeof(SLocalizedVideoDataDecrypted), alignof(SLocalizedVideoDataDecrypted), SLocalizedVideoDataDecrypted::WriteSimpleJson, SLocalizedVideoDataDecrypted::FromSimpleJson, SLocalizedVideoDataDecrypted::Serialize, SLocalizedVideoDataDecrypted::Equals, SLocalizedVideoDataDecrypted::Destroy);
+constinit ZHMTypeInfo SLocalizedVideoDataDecrypted::TypeInfo = ZHMTypeInfo("SLocalizedVideoDataDecrypted", "\"SLocalizedVideoDataDecrypted\"", sizeof(SLocalizedVideoDataDecrypted), alignof(SLocalizedVideoDataDecrypted), SLocalizedVideoDataDecrypted::WriteSimpleJson, SLocalizedVideoDataDecrypted::FromSimpleJson, SLocalizedVideoDataDecrypted::Serialize, SLocalizedVideoDataDecrypted::Equals, SLocalizedVideoDataDecrypted::Destroy);
 
 void SLocalizedVideoDataDecrypted::WriteSimpleJson(void* p_Object, std::ostream& p_Stream)
 {
@@ -764,3 +801,18 @@ void SLocalizedVideoDataDecrypted::Destroy(void* p_Object)
 	auto* s_Object = reinterpret_cast<SLocalizedVideoDataDecrypted*>(p_Object);
 	s_Object->~SLocalizedVideoDataDecrypted();
 }
+
+static IZHMTypeInfo* const g_CustomTypeInfos[] =
+{
+	&SAudioSwitchBlueprintData::TypeInfo,
+	&SScaleformGFxResource::TypeInfo,
+	&SGlobalResourceIndexItem::TypeInfo,
+	&SGlobalResourceIndex::TypeInfo,
+	&SAudioStateBlueprintData::TypeInfo,
+	&SAttributeInfo::TypeInfo,
+	&SUIControlBlueprint::TypeInfo,
+	&SEnumType::TypeInfo,
+	&SLocalizedVideoDataDecrypted::TypeInfo,
+};
+
+constinit const std::span<IZHMTypeInfo* const> IZHMTypeInfo::g_CustomTypes = g_CustomTypeInfos;
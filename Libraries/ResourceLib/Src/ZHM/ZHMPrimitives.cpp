@@ -3,179 +3,206 @@
 
 #include <External/simdjson_helpers.h>
 
-void IZHMTypeInfo::RegisterPrimitiveTypes()
+static constinit ZHMTypeInfo g_Int8TypeInfo("int8", "\"int8\"", sizeof(int8), alignof(int8),
+	[](void* p_Data, std::ostream& p_Stream)
+	{
+		p_Stream << simdjson::as_json_string(static_cast<int>(*static_cast<int8_t*>(p_Data)));
+	},
+	[](simdjson::ondemand::value p_Document, void* p_Target)
+	{
+		*reinterpret_cast<int8_t*>(p_Target) = simdjson::from_json_int8(p_Document);
+	}, [](void*, ZHMSerializer&, zhmptr_t) {},
+	[](void* p_Left, void* p_Right)
+	{
+		return *reinterpret_cast<int8_t*>(p_Left) == *reinterpret_cast<int8_t*>(p_Right);
+	}, nullptr, true, ZHMCbor<int8>::Write, ZHMCbor<int8>::Read);
+
+static constinit ZHMTypeInfo g_Uint8TypeInfo("uint8", "\"uint8\"", sizeof(uint8), alignof(uint8),
+	[](void* p_Data, std::ostream& p_Stream)
+	{
+		p_Stream << simdjson::as_json_string(static_cast<int>(*static_cast<uint8_t*>(p_Data)));
+	},
+	[](simdjson::ondemand::value p_Document, void* p_Target)
+	{
+		*reinterpret_cast<uint8*>(p_Target) = simdjson::from_json_uint8(p_Document);
+	}, [](void*, ZHMSerializer&, zhmptr_t) {},
+	[](void* p_Left, void* p_Right)
+	{
+		return *reinterpret_cast<uint8_t*>(p_Left) == *reinterpret_cast<uint8_t*>(p_Right);
+	}, nullptr, true, ZHMCbor<uint8>::Write, ZHMCbor<uint8>::Read);
+
+static constinit ZHMTypeInfo g_Int16TypeInfo("int16", "\"int16\"", sizeof(int16), alignof(int16),
+	[](void* p_Data, std::ostream& p_Stream)
+	{
+		p_Stream << simdjson::as_json_string(*static_cast<int16_t*>(p_Data));
+	},
+	[](simdjson::ondemand::value p_Document, void* p_Target)
+	{
+		*reinterpret_cast<int16*>(p_Target) = simdjson::from_json_int16(p_Document);
+	}, [](void*, ZHMSerializer&, zhmptr_t) {},
+	[](void* p_Left, void* p_Right)
+	{
+		return *reinterpret_cast<int16_t*>(p_Left) == *reinterpret_cast<int16_t*>(p_Right);
+	}, nullptr, true, ZHMCbor<int16>::Write, ZHMCbor<int16>::Read);
+
+static constinit ZHMTypeInfo g_Uint16TypeInfo("uint16", "\"uint16\"", sizeof(uint16), alignof(uint16),
+	[](void* p_Data, std::ostream& p_Stream)
+	{
+		p_Stream << simdjson::as_json_string(*static_cast<uint16_t*>(p_Data));
+	},
+	[](simdjson::ondemand::value p_Document, void* p_Target)
+	{
+		*reinterpret_cast<uint16*>(p_Target) = simdjson::from_json_uint16(p_Document);
+	}, [](void*, ZHMSerializer&, zhmptr_t) {},
+	[](void* p_Left, void* p_Right)
+	{
+		return *reinterpret_cast<uint16_t*>(p_Left) == *reinterpret_cast<uint16_t*>(p_Right);
+	}, nullptr, true, ZHMCbor<uint16>::Write, ZHMCbor<uint16>::Read);
+
+static constinit ZHMTypeInfo g_Int32TypeInfo("int32", "\"int32\"", sizeof(int32), alignof(int32),
+	[](void* p_Data, std::ostream& p_Stream)
+	{
+		p_Stream << simdjson::as_json_string(*static_cast<int32_t*>(p_Data));
+	},
+	[](simdjson::ondemand::value p_Document, void* p_Target)
+	{
+		*reinterpret_cast<int32*>(p_Target) = simdjson::from_json_int32(p_Document);
+	}, [](void*, ZHMSerializer&, zhmptr_t) {},
+	[](void* p_Left, void* p_Right)
+	{
+		return *reinterpret_cast<int32_t*>(p_Left) == *reinterpret_cast<int32_t*>(p_Right);
+	}, nullptr, true, ZHMCbor<int32>::Write, ZHMCbor<int32>::Read);
+
+static constinit ZHMTypeInfo g_Uint32TypeInfo("uint32", "\"uint32\"", sizeof(uint32), alignof(uint32),
+	[](void* p_Data, std::ostream& p_Stream)
+	{
+		p_Stream << simdjson::as_json_string(*static_cast<uint32_t*>(p_Data));
+	},
+	[](simdjson::ondemand::value p_Document, void* p_Target)
+	{
+		*reinterpret_cast<uint32_t*>(p_Target) = simdjson::from_json_uint32(p_Document);
+	}, [](void*, ZHMSerializer&, zhmptr_t) {},
+	[](void* p_Left, void* p_Right)
+	{
+		return *reinterpret_cast<uint32_t*>(p_Left) == *reinterpret_cast<uint32_t*>(p_Right);
+	}, nullptr, true, ZHMCbor<uint32>::Write, ZHMCbor<uint32>::Read);
+
+static constinit ZHMTypeInfo g_Int64TypeInfo("int64", "\"int64\"", sizeof(int64), alignof(int64),
+	[](void* p_Data, std::ostream& p_Stream)
+	{
+		p_Stream << simdjson::as_json_string(*static_cast<int64_t*>(p_Data));
+	},
+	[](simdjson::ondemand::value p_Document, void* p_Target)
+	{
+		*reinterpret_cast<int64*>(p_Target) = simdjson::from_json_int64(p_Document);
+	}, [](void*, ZHMSerializer&, zhmptr_t) {},
+	[](void* p_Left, void* p_Right)
+	{
+		return *reinterpret_cast<int64_t*>(p_Left) == *reinterpret_cast<int64_t*>(p_Right);
+	}, nullptr, true, ZHMCbor<int64>::Write, ZHMCbor<int64>::Read);
+
+static constinit ZHMTypeInfo g_Uint64TypeInfo("uint64", "\"uint64\"", sizeof(uint64), alignof(uint64),
+	[](void* p_Data, std::ostream& p_Stream)
+	{
+		p_Stream << simdjson::as_json_string(*static_cast<uint64_t*>(p_Data));
+	},
+	[](simdjson::ondemand::value p_Document, void* p_Target)
+	{
+		*reinterpret_cast<uint64*>(p_Target) = simdjson::from_json_uint64(p_Document);
+	}, [](void*, ZHMSerializer&, zhmptr_t) {},
+	[](void* p_Left, void* p_Right)
+	{
+		return *reinterpret_cast<uint64_t*>(p_Left) == *reinterpret_cast<uint64_t*>(p_Right);
+	}, nullptr, true, ZHMCbor<uint64>::Write, ZHMCbor<uint64>::Read);
+
+static constinit ZHMTypeInfo g_Float32TypeInfo("float32", "\"float32\"", sizeof(float32), alignof(float32),
+	[](void* p_Data, std::ostream& p_Stream)
+	{
+		p_Stream << simdjson::as_json_string(*static_cast<float*>(p_Data));
+	},
+	[](simdjson::ondemand::value p_Document, void* p_Target)
+	{
+		*reinterpret_cast<float32*>(p_Target) = simdjson::from_json_float32(p_Document);
+	}, [](void*, ZHMSerializer&, zhmptr_t) {},
+	[](void* p_Left, void* p_Right)
+	{
+		return *reinterpret_cast<float32*>(p_Left) == *reinterpret_cast<float32*>(p_Right);
+	}, nullptr, true, ZHMCbor<float32>::Write, ZHMCbor<float32>::Read);
+
+static constinit ZHMTypeInfo g_Float64TypeInfo("float64", "\"float64\"", sizeof(float64), alignof(float64),
+	[](void* p_Data, std::ostream& p_Stream)
+	{
+		p_Stream << simdjson::as_json_string(*static_cast<double*>(p_Data));
+	},
+	[](simdjson::ondemand::value p_Document, void* p_Target)
+	{
+		*reinterpret_cast<float64*>(p_Target) = simdjson::from_json_float64(p_Document);
+	}, [](void*, ZHMSerializer&, zhmptr_t) {},
+	[](void* p_Left, void* p_Right)
+	{
+		return *reinterpret_cast<float64*>(p_Left) == *reinterpret_cast<float64*>(p_Right);
+	}, nullptr, true, ZHMCbor<float64>::Write, ZHMCbor<float64>::Read);
+
+static constinit ZHMTypeInfo g_BoolTypeInfo("bool", "\"bool\"", sizeof(bool), alignof(bool),
+	[](void* p_Data, std::ostream& p_Stream)
+	{
+		p_Stream << simdjson::as_json_string(*static_cast<bool*>(p_Data));
+	},
+	[](simdjson::ondemand::value p_Document, void* p_Target)
+	{
+		*reinterpret_cast<bool*>(p_Target) = simdjson::from_json_bool(p_Document);
+	}, [](void*, ZHMSerializer&, zhmptr_t) {},
+	[](void* p_Left, void* p_Right)
+	{
+		return *reinterpret_cast<bool*>(p_Left) == *reinterpret_cast<bool*>(p_Right);
+	}, nullptr, true, ZHMCbor<bool>::Write, ZHMCbor<bool>::Read);
+
+static constinit ZHMTypeInfo g_ZStringTypeInfo("ZString", "\"ZString\"", sizeof(ZString), alignof(ZString), ZString::WriteSimpleJson, ZString::FromSimpleJson, ZString::Serialize, ZString::Equals, ZString::Destroy, false, ZString::WriteCbor, ZString::FromCbor);
+
+static constinit ZHMTypeInfo g_ZRepositoryIDTypeInfo("ZRepositoryID", "\"ZRepositoryID\"", sizeof(ZRepositoryID), alignof(ZRepositoryID),ZRepositoryID::WriteSimpleJson, ZRepositoryID::FromSimpleJson, ZRepositoryID::Serialize, ZRepositoryID::Equals, nullptr, true, ZRepositoryID::WriteCbor, ZRepositoryID::FromCbor);
+
+static constinit ZHMTypeInfo g_ZVariantTypeInfo("ZVariant", "\"ZVariant\"", sizeof(ZVariant), alignof(ZVariant), ZVariant::WriteSimpleJson, ZVariant::FromSimpleJson, ZVariant::Serialize, ZVariant::Equals, ZVariant::Destroy, false, ZVariant::WriteCbor, ZVariant::FromCbor);
+
+static constinit ZHMTypeInfo g_VoidTypeInfo("void", "\"void\"", 0, 0,
+	[](void* p_Data, std::ostream& p_Stream)
+	{
+		p_Stream << "null";
+	},
+	[](simdjson::ondemand::value p_Document, void* p_Target)
+	{
+	}, [](void*, ZHMSerializer&, zhmptr_t) {}, nullptr, nullptr, false,
+	[](void* p_Data, CborWriter& p_Writer)
+	{
+		p_Writer.WriteNull();
+	},
+	[](CborReader& p_Reader, void* p_Target)
+	{
+		p_Reader.Skip();
+	});
+
+static constinit ZHMTypeInfo g_TResourcePtrTypeInfo("TResourcePtr", "\"TResourcePtr\"", sizeof(TResourcePtr), alignof(TResourcePtr), TResourcePtr::WriteSimpleJson, TResourcePtr::FromSimpleJson, TResourcePtr::Serialize, nullptr, nullptr, false, TResourcePtr::WriteCbor, TResourcePtr::FromCbor);
+
+static IZHMTypeInfo* const g_PrimitiveTypeInfos[] =
 {
-	new ZHMTypeInfo("int8", sizeof(int8), alignof(int8),
-		[](void* p_Data, std::ostream& p_Stream)
-		{
-			p_Stream << simdjson::as_json_string(static_cast<int>(*static_cast<int8_t*>(p_Data)));
-		},
-		[](simdjson::ondemand::value p_Document, void* p_Target)
-		{
-			*reinterpret_cast<int8_t*>(p_Target) = simdjson::from_json_int8(p_Document);
-		}, [](void*, ZHMSerializer&, zhmptr_t) {},
-		[](void* p_Left, void* p_Right)
-		{
-			return *reinterpret_cast<int8_t*>(p_Left) == *reinterpret_cast<int8_t*>(p_Right);
-		});
-
-	new ZHMTypeInfo("uint8", sizeof(uint8), alignof(uint8),
-		[](void* p_Data, std::ostream& p_Stream)
-		{
-			p_Stream << simdjson::as_json_string(static_cast<int>(*static_cast<uint8_t*>(p_Data)));
-		},
-		[](simdjson::ondemand::value p_Document, void* p_Target)
-		{
-			*reinterpret_cast<uint8*>(p_Target) = simdjson::from_json_uint8(p_Document);
-		}, [](void*, ZHMSerializer&, zhmptr_t) {},
-		[](void* p_Left, void* p_Right)
-		{
-			return *reinterpret_cast<uint8_t*>(p_Left) == *reinterpret_cast<uint8_t*>(p_Right);
-		});
-
-	new ZHMTypeInfo("int16", sizeof(int16), alignof(int16),
-		[](void* p_Data, std::ostream& p_Stream)
-		{
-			p_Stream << simdjson::as_json_string(*static_cast<int16_t*>(p_Data));
-		},
-		[](simdjson::ondemand::value p_Document, void* p_Target)
-		{
-			*reinterpret_cast<int16*>(p_Target) = simdjson::from_json_int16(p_Document);
-		}, [](void*, ZHMSerializer&, zhmptr_t) {},
-		[](void* p_Left, void* p_Right)
-		{
-			return *reinterpret_cast<int16_t*>(p_Left) == *reinterpret_cast<int16_t*>(p_Right);
-		});
-
-	new ZHMTypeInfo("uint16", sizeof(uint16), alignof(uint16),
-		[](void* p_Data, std::ostream& p_Stream)
-		{
-			p_Stream << simdjson::as_json_string(*static_cast<uint16_t*>(p_Data));
-		},
-		[](simdjson::ondemand::value p_Document, void* p_Target)
-		{
-			*reinterpret_cast<uint16*>(p_Target) = simdjson::from_json_uint16(p_Document);
-		}, [](void*, ZHMSerializer&, zhmptr_t) {},
-		[](void* p_Left, void* p_Right)
-		{
-			return *reinterpret_cast<uint16_t*>(p_Left) == *reinterpret_cast<uint16_t*>(p_Right);
-		});
-
-	new ZHMTypeInfo("int32", sizeof(int32), alignof(int32),
-		[](void* p_Data, std::ostream& p_Stream)
-		{
-			p_Stream << simdjson::as_json_string(*static_cast<int32_t*>(p_Data));
-		},
-		[](simdjson::ondemand::value p_Document, void* p_Target)
-		{
-			*reinterpret_cast<int32*>(p_Target) = simdjson::from_json_int32(p_Document);
-		}, [](void*, ZHMSerializer&, zhmptr_t) {},
-		[](void* p_Left, void* p_Right)
-		{
-			return *reinterpret_cast<int32_t*>(p_Left) == *reinterpret_cast<int32_t*>(p_Right);
-		});
-
-	new ZHMTypeInfo("uint32", sizeof(uint32), alignof(uint32),
-		[](void* p_Data, std::ostream& p_Stream)
-		{
-			p_Stream << simdjson::as_json_string(*static_cast<uint32_t*>(p_Data));
-		},
-		[](simdjson::ondemand::value p_Document, void* p_Target)
-		{
-			*reinterpret_cast<uint32_t*>(p_Target) = simdjson::from_json_uint32(p_Document);
-		}, [](void*, ZHMSerializer&, zhmptr_t) {},
-		[](void* p_Left, void* p_Right)
-		{
-			return *reinterpret_cast<uint32_t*>(p_Left) == *reinterpret_cast<uint32_t*>(p_Right);
-		});
-
-	new ZHMTypeInfo("int64", sizeof(int64), alignof(int64),
-		[](void* p_Data, std::ostream& p_Stream)
-		{
-			p_Stream << simdjson::as_json_string(*static_cast<int64_t*>(p_Data));
-		},
-		[](simdjson::ondemand::value p_Document, void* p_Target)
-		{
-			*reinterpret_cast<int64*>(p_Target) = simdjson::from_json_int64(p_Document);
-		}, [](void*, ZHMSerializer&, zhmptr_t) {},
-		[](void* p_Left, void* p_Right)
-		{
-			return *reinterpret_cast<int64_t*>(p_Left) == *reinterpret_cast<int64_t*>(p_Right);
-		});
-
-	new ZHMTypeInfo("uint64", sizeof(uint64), alignof(uint64),
-		[](void* p_Data, std::ostream& p_Stream)
-		{
-			p_Stream << simdjson::as_json_string(*static_cast<uint64_t*>(p_Data));
-		},
-		[](simdjson::ondemand::value p_Document, void* p_Target)
-		{
-			*reinterpret_cast<uint64*>(p_Target) = simdjson::from_json_uint64(p_Document);
-		}, [](void*, ZHMSerializer&, zhmptr_t) {},
-		[](void* p_Left, void* p_Right)
-		{
-			return *reinterpret_cast<uint64_t*>(p_Left) == *reinterpret_cast<uint64_t*>(p_Right);
-		});
-
-	new ZHMTypeInfo("float32", sizeof(float32), alignof(float32),
-		[](void* p_Data, std::ostream& p_Stream)
-		{
-			p_Stream << simdjson::as_json_string(*static_cast<float*>(p_Data));
-		},
-		[](simdjson::ondemand::value p_Document, void* p_Target)
-		{
-			*reinterpret_cast<float32*>(p_Target) = simdjson::from_json_float32(p_Document);
-		}, [](void*, ZHMSerializer&, zhmptr_t) {},
-		[](void* p_Left, void* p_Right)
-		{
-			return *reinterpret_cast<float32*>(p_Left) == *reinterpret_cast<float32*>(p_Right);
-		});
-
-	new ZHMTypeInfo("float64", sizeof(float64), alignof(float64),
-		[](void* p_Data, std::ostream& p_Stream)
-		{
-			p_Stream << simdjson::as_json_string(*static_cast<double*>(p_Data));
-		},
-		[](simdjson::ondemand::value p_Document, void* p_Target)
-		{
-			*reinterpret_cast<float64*>(p_Target) = simdjson::from_json_float64(p_Document);
-		}, [](void*, ZHMSerializer&, zhmptr_t) {},
-		[](void* p_Left, void* p_Right)
-		{
-			return *reinterpret_cast<float64*>(p_Left) == *reinterpret_cast<float64*>(p_Right);
-		});
-
-	new ZHMTypeInfo("bool", sizeof(bool), alignof(bool),
-		[](void* p_Data, std::ostream& p_Stream)
-		{
-			p_Stream << simdjson::as_json_string(*static_cast<bool*>(p_Data));
-		},
-		[](simdjson::ondemand::value p_Document, void* p_Target)
-		{
-			*reinterpret_cast<bool*>(p_Target) = simdjson::from_json_bool(p_Document);
-		}, [](void*, ZHMSerializer&, zhmptr_t) {},
-		[](void* p_Left, void* p_Right)
-		{
-			return *reinterpret_cast<bool*>(p_Left) == *reinterpret_cast<bool*>(p_Right);
-		});
-
-	new ZHMTypeInfo("ZString", sizeof(ZString), alignof(ZString), ZString::WriteSimpleJson, ZString::FromSimpleJson, ZString::Serialize, ZString::Equals, ZString::Destroy);
-	
-	new ZHMTypeInfo("ZRepositoryID", sizeof(ZRepositoryID), alignof(ZRepositoryID),ZRepositoryID::WriteSimpleJson, ZRepositoryID::FromSimpleJson, ZRepositoryID::Serialize, ZRepositoryID::Equals);
-	
-	new ZHMTypeInfo("ZVariant", sizeof(ZVariant), alignof(ZVariant), ZVariant::WriteSimpleJson, ZVariant::FromSimpleJson, ZVariant::Serialize, ZVariant::Equals, ZVariant::Destroy);
-
-	new ZHMTypeInfo("void", 0, 0,
-		[](void* p_Data, std::ostream& p_Stream)
-		{
-			p_Stream << "null";
-		},
-		[](simdjson::ondemand::value p_Document, void* p_Target)
-		{
-		}, [](void*, ZHMSerializer&, zhmptr_t) {});
-
-	new ZHMTypeInfo("TResourcePtr", sizeof(TResourcePtr), alignof(TResourcePtr), TResourcePtr::WriteSimpleJson, TResourcePtr::FromSimpleJson, TResourcePtr::Serialize);
-}
+	&g_Int8TypeInfo,
+	&g_Uint8TypeInfo,
+	&g_Int16TypeInfo,
+	&g_Uint16TypeInfo,
+	&g_Int32TypeInfo,
+	&g_Uint32TypeInfo,
+	&g_Int64TypeInfo,
+	&g_Uint64TypeInfo,
+	&g_Float32TypeInfo,
+	&g_Float64TypeInfo,
+	&g_BoolTypeInfo,
+	&g_ZStringTypeInfo,
+	&g_ZRepositoryIDTypeInfo,
+	&g_ZVariantTypeInfo,
+	&g_VoidTypeInfo,
+	&g_TResourcePtrTypeInfo,
+};
+
+constinit const std::span<IZHMTypeInfo* const> IZHMTypeInfo::g_PrimitiveTypes = g_PrimitiveTypeInfos;
 
 void TResourcePtr::WriteSimpleJson(void* p_Object, std::ostream& p_Stream)
 {
@@ -201,6 +228,38 @@ void TResourcePtr::FromSimpleJson(simdjson::ondemand::value p_Document, void* p_
 	s_Object->m_IDLow = simdjson::from_json_uint32(p_Document["m_IDLow"]);
 }
 
+void TResourcePtr::WriteCbor(void* p_Object, CborWriter& p_Writer)
+{
+	auto* s_Object = reinterpret_cast<TResourcePtr*>(p_Object);
+
+	p_Writer.BeginMap(2);
+
+	p_Writer.WriteText("m_IDHigh");
+	p_Writer.WriteInteger(s_Object->m_IDHigh);
+
+	p_Writer.WriteText("m_IDLow");
+	p_Writer.WriteInteger(s_Object->m_IDLow);
+}
+
+void TResourcePtr::FromCbor(CborReader& p_Reader, void* p_Target)
+{
+	auto* s_Object = reinterpret_cast<TResourcePtr*>(p_Target);
+
+	auto s_Map = p_Reader.ReadMap();
+
+	while (p_Reader.Next(s_Map))
+	{
+		const std::string_view s_Key = p_Reader.ReadText();
+
+		if (s_Key == "m_IDHigh")
+			s_Object->m_IDHigh = p_Reader.ReadInteger<uint32_t>();
+		else if (s_Key == "m_IDLow")
+			s_Object->m_IDLow = p_Reader.ReadInteger<uint32_t>();
+		else
+			p_Reader.Skip();
+	}
+}
+
 void TResourcePtr::Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset)
 {
 	p_Serializer.RegisterResourcePtr(p_OwnOffset);
@@ -14,6 +14,8 @@ class TResourcePtr
 public:
 	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
 	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
+	static void WriteCbor(void* p_Object, CborWriter& p_Writer);
+	static void FromCbor(CborReader& p_Reader, void* p_Target);
 	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
 
     bool operator==(const TResourcePtr& p_Other) const
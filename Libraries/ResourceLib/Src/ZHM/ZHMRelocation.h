@@ -0,0 +1,24 @@
+#pragma once
+
+#include <type_traits>
+
+/**
+ * Relocation-free types don't contain anything the serializer has to patch or register (strings, arrays,
+ * variants, type ids, resource ids and so on) and own nothing that has to be freed. Objects of these types,
+ * and arrays of them, are serialized and destroyed with single memory operations. Their type infos also compare
+ * them bytewise, since that's what de-duplicating serialized data needs.
+ *
+ * Generated types that are relocation-free are marked by CodeGen with a static IsRelocationFree member.
+ */
+template <class T>
+constexpr inline bool ZHMIsRelocationFree_v = std::is_fundamental_v<T> || std::is_enum_v<T>;
+
+template <class T> requires requires { T::IsRelocationFree; }
+constexpr inline bool ZHMIsRelocationFree_v<T> = T::IsRelocationFree;
+
+/**
+ * Types whose values are equal exactly when their bytes are. Floating point numbers aren't (0.0 equals -0.0
+ * and NaN equals nothing), and neither are generated types, which can have padding and floating point fields.
+ */
+template <class T>
+constexpr inline bool ZHMIsBitwiseComparable_v = std::is_integral_v<T> || std::is_enum_v<T>;
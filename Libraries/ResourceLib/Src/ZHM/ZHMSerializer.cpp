@@ -1,14 +1,20 @@
 #include "ZHMSerializer.h"
 
 #include <Util/BinaryStreamWriter.h>
+#include <Util/WorkerPool.h>
 #include "ZHMTypeInfo.h"
 #include "ZVariant.h"
 
+#include <memory>
+
+std::atomic<bool> ZHMSerializer::g_PayloadDeduplicationEnabled = false;
+
 ZHMSerializer::ZHMSerializer(uint8_t p_Alignment, bool p_GenerateCompatible) :
 	m_GenerateCompatible(p_GenerateCompatible),
 	m_CurrentSize(0),
 	m_Capacity(256),
-	m_Buffer(c_aligned_alloc(m_Capacity, alignof(uintptr_t)))
+	m_Buffer(c_aligned_alloc(m_Capacity, alignof(uintptr_t))),
+	m_DeduplicatePayloads(g_PayloadDeduplicationEnabled.load(std::memory_order_relaxed))
 {
 	if (p_GenerateCompatible)
 		m_Alignment = 4;
@@ -16,6 +22,18 @@ ZHMSerializer::ZHMSerializer(uint8_t p_Alignment, bool p_GenerateCompatible) :
 		m_Alignment = std::max(static_cast<size_t>(p_Alignment), sizeof(zhmptr_t));
 }
 
+ZHMSerializer::ZHMSerializer(ZHMSerializer& p_Parent, zhmptr_t p_BaseOffset) :
+	m_GenerateCompatible(false),
+	m_CurrentSize(p_BaseOffset),
+	m_Capacity(256),
+	m_Buffer(c_aligned_alloc(m_Capacity, alignof(uintptr_t))),
+	m_Alignment(p_Parent.m_Alignment),
+	m_DeduplicatePayloads(false),
+	m_Parent(&p_Parent),
+	m_BaseOffset(p_BaseOffset)
+{
+}
+
 ZHMSerializer::~ZHMSerializer()
 {
 	c_aligned_free(m_Buffer);
@@ -39,6 +57,9 @@ zhmptr_t ZHMSerializer::WriteMemory(void* p_Memory, zhmptr_t p_Size, zhmptr_t p_
 
 zhmptr_t ZHMSerializer::WriteMemoryUnaligned(void* p_Memory, zhmptr_t p_Size)
 {
+	if (m_FirstAlignment == 0)
+		m_FirstAlignment = 1;
+
 	const zhmptr_t s_StartOffset = m_CurrentSize;
 
 	// Ensure we have enough space.
@@ -51,38 +72,57 @@ zhmptr_t ZHMSerializer::WriteMemoryUnaligned(void* p_Memory, zhmptr_t p_Size)
 	return s_StartOffset;
 }
 
+zhmptr_t ZHMSerializer::ReserveMemory(zhmptr_t p_Size, zhmptr_t p_Alignment)
+{
+	AlignTo(p_Alignment);
+	return ReserveMemoryUnaligned(p_Size);
+}
+
+zhmptr_t ZHMSerializer::ReserveMemoryUnaligned(zhmptr_t p_Size)
+{
+	if (m_FirstAlignment == 0)
+		m_FirstAlignment = 1;
+
+	const zhmptr_t s_StartOffset = m_CurrentSize;
+
+	EnsureEnough(m_CurrentSize + p_Size);
+
+	memset(CurrentPtr(), 0x00, p_Size);
+	m_CurrentSize += p_Size;
+
+	return s_StartOffset;
+}
+
 void ZHMSerializer::PatchPtr(zhmptr_t p_Offset, zhmptr_t p_Pointer)
 {
-	*reinterpret_cast<zhmptr_t*>(reinterpret_cast<uintptr_t>(m_Buffer) + p_Offset) = p_Pointer;
+	*reinterpret_cast<zhmptr_t*>(MemoryAt(p_Offset)) = p_Pointer;
 	m_Relocations.insert(p_Offset);
 }
 
 void ZHMSerializer::PatchNullPtr(zhmptr_t p_Offset)
 {
-	*reinterpret_cast<zhmptr_t*>(reinterpret_cast<uintptr_t>(m_Buffer) + p_Offset) = ~zhmptr_t(0);
+	*reinterpret_cast<zhmptr_t*>(MemoryAt(p_Offset)) = ~zhmptr_t(0);
 	m_Relocations.insert(p_Offset);
 }
 
 void ZHMSerializer::PatchType(zhmptr_t p_Offset, IZHMTypeInfo* p_Type)
 {
-	// See if we already have this type.
-	size_t s_TypeIndex = m_Types.size();
+	*reinterpret_cast<zhmptr_t*>(MemoryAt(p_Offset)) = static_cast<zhmptr_t>(GetTypeIndex(p_Type));
+	m_TypeIdOffsets.insert(p_Offset);
+}
 
+size_t ZHMSerializer::GetTypeIndex(IZHMTypeInfo* p_Type)
+{
+	// See if we already have this type.
 	for (size_t i = 0; i < m_Types.size(); ++i)
 	{
 		if (m_Types[i] == p_Type)
-		{
-			s_TypeIndex = i;
-			break;
-		}
+			return i;
 	}
 
 	// Couldn't find the type. Add it.
-	if (s_TypeIndex == m_Types.size())
-		m_Types.push_back(p_Type);
-
-	*reinterpret_cast<zhmptr_t*>(reinterpret_cast<uintptr_t>(m_Buffer) + p_Offset) = static_cast<zhmptr_t>(s_TypeIndex);
-	m_TypeIdOffsets.insert(p_Offset);
+	m_Types.push_back(p_Type);
+	return m_Types.size() - 1;
 }
 
 void ZHMSerializer::RegisterRuntimeResourceId(zhmptr_t p_Offset)
@@ -141,6 +181,32 @@ void ZHMSerializer::SetPtrForVariant(ZVariant* p_Variant, zhmptr_t p_Ptr)
 	m_VariantRegistry[p_Variant->m_pTypeID] = s_VariantsOfType;
 }
 
+std::optional<zhmptr_t> ZHMSerializer::GetExistingPayload(PayloadKind p_Kind, uint32_t p_ElementSize, std::string_view p_Data) const
+{
+	if (!m_DeduplicatePayloads)
+		return std::nullopt;
+
+	const auto it = m_Payloads.find(PayloadKey { p_Kind, p_ElementSize, p_Data });
+
+	if (it == m_Payloads.end())
+		return std::nullopt;
+
+	return it->second;
+}
+
+void ZHMSerializer::RegisterPayload(PayloadKind p_Kind, uint32_t p_ElementSize, std::string_view p_Data, zhmptr_t p_Offset)
+{
+	if (!m_DeduplicatePayloads)
+		return;
+
+	m_Payloads.try_emplace(PayloadKey { p_Kind, p_ElementSize, p_Data }, p_Offset);
+}
+
+void ZHMSerializer::SetPayloadDeduplicationEnabled(bool p_Enabled)
+{
+	g_PayloadDeduplicationEnabled.store(p_Enabled, std::memory_order_relaxed);
+}
+
 std::set<zhmptr_t> ZHMSerializer::GetRelocations() const
 {
 	return m_Relocations;
@@ -155,11 +221,21 @@ std::string ZHMSerializer::GetBuffer()
 void ZHMSerializer::AlignTo(zhmptr_t p_Alignment)
 {
 	auto s_Alignment = std::max(m_Alignment, p_Alignment);
-	
+
+	if (m_FirstAlignment == 0)
+		m_FirstAlignment = s_Alignment;
+
+	m_MaxAlignment = std::max(m_MaxAlignment, s_Alignment);
+
+	PadTo(s_Alignment);
+}
+
+void ZHMSerializer::PadTo(zhmptr_t p_Alignment)
+{
 	// Align to boundary.
-	if (m_CurrentSize % s_Alignment != 0)
+	if (m_CurrentSize % p_Alignment != 0)
 	{
-		const auto s_BytesToSkip = s_Alignment - (m_CurrentSize % s_Alignment);
+		const auto s_BytesToSkip = p_Alignment - (m_CurrentSize % p_Alignment);
 		EnsureEnough(m_CurrentSize + s_BytesToSkip);
 
 		memset(CurrentPtr(), 0x00, s_BytesToSkip);
@@ -169,6 +245,9 @@ void ZHMSerializer::AlignTo(zhmptr_t p_Alignment)
 
 void ZHMSerializer::EnsureEnough(zhmptr_t p_Size)
 {
+	// The buffer of sub-serializers starts at their base offset.
+	p_Size -= m_BaseOffset;
+
 	if (m_Capacity >= p_Size)
 		return;
 
@@ -178,13 +257,130 @@ void ZHMSerializer::EnsureEnough(zhmptr_t p_Size)
 		s_NewCapacity = ceil(s_NewCapacity * 1.5);
 
 	auto s_NewBuffer = c_aligned_alloc(s_NewCapacity, alignof(char));
-	memcpy(s_NewBuffer, m_Buffer, m_CurrentSize);
+	memcpy(s_NewBuffer, m_Buffer, m_CurrentSize - m_BaseOffset);
 	c_aligned_free(m_Buffer);
 
 	m_Buffer = s_NewBuffer;
 	m_Capacity = s_NewCapacity;
 }
 
+bool ZHMSerializer::ShouldSplitElements(size_t p_Count) const
+{
+	// Arrays smaller than this aren't worth the overhead of splitting.
+	static constexpr size_t c_MinElements = 256;
+
+	return p_Count >= c_MinElements && !m_Parent && !m_GenerateCompatible && !m_DeduplicatePayloads && WorkerPool::IsParallel();
+}
+
+void ZHMSerializer::SerializeElementsInParallel(size_t p_Count, const std::function<void(ZHMSerializer&, size_t)>& p_Serialize)
+{
+	static constexpr size_t c_MinRangeSize = 64;
+
+	const auto [s_RangeCount, s_RangeSize] = WorkerPool::SplitRanges(p_Count, c_MinRangeSize, WorkerPool::ThreadCount());
+
+	// Sub-serializers start past everything that's been written so far, so offsets in their data can be told
+	// apart from offsets in ours. Elements only patch their own data in our buffer, which can't move until
+	// the sub-serializers are merged.
+	const zhmptr_t s_BaseOffset = (m_CurrentSize / c_SubSerializerAlignment + 1) * c_SubSerializerAlignment;
+
+	std::vector<std::unique_ptr<ZHMSerializer>> s_SubSerializers(s_RangeCount);
+
+	auto* s_Job = JobProgress::Current();
+	auto* s_Progress = JobProgress::BeginElements(p_Count);
+
+	WorkerPool::Run(s_RangeCount, [&](size_t p_Range)
+	{
+		const size_t s_End = std::min(p_Count, (p_Range + 1) * s_RangeSize);
+
+		JobProgress::Scope s_JobScope(s_Job);
+		s_SubSerializers[p_Range].reset(new ZHMSerializer(*this, s_BaseOffset));
+
+		for (size_t i = p_Range * s_RangeSize; i < s_End; ++i)
+		{
+			p_Serialize(*s_SubSerializers[p_Range], i);
+
+			if (s_Progress)
+				s_Progress->CompleteElements(1);
+		}
+	});
+
+	for (size_t s_Range = 0; s_Range < s_RangeCount; ++s_Range)
+	{
+		if (Merge(*s_SubSerializers[s_Range]))
+			continue;
+
+		// The data of this range would end up padded differently, so we serialize it again in place instead.
+		// This rewrites everything the sub-serializer patched in our buffer.
+		const size_t s_End = std::min(p_Count, (s_Range + 1) * s_RangeSize);
+
+		for (size_t i = s_Range * s_RangeSize; i < s_End; ++i)
+			p_Serialize(*this, i);
+	}
+}
+
+bool ZHMSerializer::Merge(ZHMSerializer& p_Sub)
+{
+	const zhmptr_t s_SubBase = p_Sub.m_BaseOffset;
+	const zhmptr_t s_SubSize = p_Sub.m_CurrentSize - s_SubBase;
+
+	// The first write of the sub-serializer would have padded our data to its alignment.
+	zhmptr_t s_Base = m_CurrentSize;
+
+	if (p_Sub.m_FirstAlignment > 1)
+		s_Base = (s_Base + p_Sub.m_FirstAlignment - 1) / p_Sub.m_FirstAlignment * p_Sub.m_FirstAlignment;
+
+	// Everything after that was padded as if it started at an offset aligned to [c_SubSerializerAlignment].
+	if (p_Sub.m_MaxAlignment > c_SubSerializerAlignment || s_Base % p_Sub.m_MaxAlignment != 0)
+		return false;
+
+	const auto s_Rebase = [&](zhmptr_t p_Offset)
+	{
+		return p_Offset >= s_SubBase ? p_Offset - s_SubBase + s_Base : p_Offset;
+	};
+
+	if (p_Sub.m_FirstAlignment > 1)
+		PadTo(p_Sub.m_FirstAlignment);
+
+	EnsureEnough(s_Base + s_SubSize);
+	memcpy(MemoryAt(s_Base), p_Sub.m_Buffer, s_SubSize);
+	m_CurrentSize = s_Base + s_SubSize;
+
+	for (const auto s_Offset : p_Sub.m_Relocations)
+	{
+		const auto s_RebasedOffset = s_Rebase(s_Offset);
+		auto* s_Pointer = reinterpret_cast<zhmptr_t*>(MemoryAt(s_RebasedOffset));
+
+		if (*s_Pointer != ~zhmptr_t(0))
+			*s_Pointer = s_Rebase(*s_Pointer);
+
+		m_Relocations.insert(s_RebasedOffset);
+	}
+
+	// Types are added in the order the sub-serializer first saw them, just like they would have been here.
+	std::vector<zhmptr_t> s_TypeIndices;
+	s_TypeIndices.reserve(p_Sub.m_Types.size());
+
+	for (auto* s_Type : p_Sub.m_Types)
+		s_TypeIndices.push_back(GetTypeIndex(s_Type));
+
+	for (const auto s_Offset : p_Sub.m_TypeIdOffsets)
+	{
+		const auto s_RebasedOffset = s_Rebase(s_Offset);
+		auto* s_TypeIndex = reinterpret_cast<zhmptr_t*>(MemoryAt(s_RebasedOffset));
+
+		*s_TypeIndex = s_TypeIndices[*s_TypeIndex];
+		m_TypeIdOffsets.insert(s_RebasedOffset);
+	}
+
+	for (const auto s_Offset : p_Sub.m_RuntimeResourceIdOffsets)
+		m_RuntimeResourceIdOffsets.insert(s_Rebase(s_Offset));
+
+	for (const auto s_Offset : p_Sub.m_ResourcePtrOffsets)
+		m_ResourcePtrOffsets.insert(s_Rebase(s_Offset));
+
+	return true;
+}
+
 std::vector<ZHMSerializer::SerializerSegment> ZHMSerializer::GenerateSegments()
 {
 	std::vector<SerializerSegment> s_Segments;
@@ -233,7 +429,7 @@ std::string ZHMSerializer::GenerateTypeIdSegment()
 
 		s_Writer.Write<uint32_t>(i);
 		s_Writer.Write<int32_t>(-1);
-		s_Writer.WriteString(m_Types[i]->TypeName());
+		s_Writer.WriteString(std::string(m_Types[i]->TypeName()));
 	}
 
 	return s_Writer.ToString();
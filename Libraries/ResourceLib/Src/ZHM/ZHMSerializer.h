@@ -1,14 +1,18 @@
 #pragma once
 
+#include <atomic>
 #include <set>
 #include <string>
+#include <string_view>
 #include <cstdint>
+#include <functional>
 #include <optional>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
 
 #include "ZHMInt.h"
+#include "Util/JobProgress.h"
 
 class ZVariant;
 class IZHMTypeInfo;
@@ -23,6 +27,13 @@ public:
 		uint32_t Type;
 		std::string Data;
 	};
+
+	enum class PayloadKind : uint32_t
+	{
+		String,
+		EncryptedString,
+		Array,
+	};
 	
 public:
 	ZHMSerializer(uint8_t p_Alignment, bool p_GenerateCompatible);
@@ -30,6 +41,21 @@ public:
 	
 	zhmptr_t WriteMemory(void* p_Memory, zhmptr_t p_Size, zhmptr_t p_Alignment);
 	zhmptr_t WriteMemoryUnaligned(void* p_Memory, zhmptr_t p_Size);
+
+	// Reserve zeroed memory for data that's written in place. Pointers from MemoryAt
+	// are only valid until the next write, which can grow the buffer.
+	zhmptr_t ReserveMemory(zhmptr_t p_Size, zhmptr_t p_Alignment);
+	zhmptr_t ReserveMemoryUnaligned(zhmptr_t p_Size);
+
+	void* MemoryAt(zhmptr_t p_Offset)
+	{
+		// Sub-serializers only hold the data written to them. Everything before that is in their parent.
+		if (p_Offset < m_BaseOffset)
+			return m_Parent->MemoryAt(p_Offset);
+
+		return reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(m_Buffer) + (p_Offset - m_BaseOffset));
+	}
+
 	void PatchPtr(zhmptr_t p_Offset, zhmptr_t p_Pointer);
 	void PatchNullPtr(zhmptr_t p_Offset);
 	void PatchType(zhmptr_t p_Offset, IZHMTypeInfo* p_Type);
@@ -38,11 +64,49 @@ public:
 	std::optional<zhmptr_t> GetExistingPtrForVariant(ZVariant* p_Variant);
 	void SetPtrForVariant(ZVariant* p_Variant, zhmptr_t p_Ptr);
 
+	// When payload deduplication is enabled, immutable payloads (string data, arrays of primitives)
+	// that are identical to one written earlier reuse its offset instead of being written again.
+	// [p_Data] must stay alive for as long as the serializer does.
+	std::optional<zhmptr_t> GetExistingPayload(PayloadKind p_Kind, uint32_t p_ElementSize, std::string_view p_Data) const;
+	void RegisterPayload(PayloadKind p_Kind, uint32_t p_ElementSize, std::string_view p_Data, zhmptr_t p_Offset);
+
+	static void SetPayloadDeduplicationEnabled(bool p_Enabled);
+
 	template <class T>
 	void PatchValue(zhmptr_t p_Offset, T p_Value)
 	{
-		EnsureEnough(p_Offset + sizeof(T));
-		*reinterpret_cast<T*>(reinterpret_cast<uintptr_t>(m_Buffer) + p_Offset) = p_Value;
+		if (p_Offset >= m_BaseOffset)
+			EnsureEnough(p_Offset + sizeof(T));
+
+		*reinterpret_cast<T*>(MemoryAt(p_Offset)) = p_Value;
+	}
+
+	/**
+	 * Calls [p_Serialize] with a serializer and the index of every element in [0, p_Count), in order.
+	 * The elements of large arrays are serialized on the worker pool, each range of them into a sub-serializer
+	 * of its own, which are then merged into this one in order. The result is the same as serializing them one
+	 * after another. Elements must be independent of each other, which they are as long as variants and payloads
+	 * aren't being shared, so arrays are only split when neither compatibility mode nor deduplication is enabled.
+	 */
+	template <class F>
+	void SerializeElements(size_t p_Count, const F& p_Serialize)
+	{
+		if (!ShouldSplitElements(p_Count))
+		{
+			auto* s_Progress = JobProgress::BeginElements(p_Count);
+
+			for (size_t i = 0; i < p_Count; ++i)
+			{
+				p_Serialize(*this, i);
+
+				if (s_Progress)
+					s_Progress->CompleteElements(1);
+			}
+
+			return;
+		}
+
+		SerializeElementsInParallel(p_Count, p_Serialize);
 	}
 	
 	std::set<zhmptr_t> GetRelocations() const;
@@ -53,17 +117,29 @@ public:
 	bool InCompatibilityMode() const { return m_GenerateCompatible; }
 
 private:
+	ZHMSerializer(ZHMSerializer& p_Parent, zhmptr_t p_BaseOffset);
+
+	bool ShouldSplitElements(size_t p_Count) const;
+	void SerializeElementsInParallel(size_t p_Count, const std::function<void(ZHMSerializer&, size_t)>& p_Serialize);
+
+	// Appends the data of [p_Sub] and rebases its offsets. Returns false, without changing anything, if its data
+	// would have been padded differently if it had been written to this serializer directly.
+	bool Merge(ZHMSerializer& p_Sub);
+
+	size_t GetTypeIndex(IZHMTypeInfo* p_Type);
+
 	std::string GenerateRelocationSegment();
 	std::string GenerateTypeIdSegment();
 	std::string GenerateRuntimeResourceIdSegment();
 	std::string GenerateResourcePtrSegment();
 	
 	void AlignTo(zhmptr_t p_Alignment);
+	void PadTo(zhmptr_t p_Alignment);
 	void EnsureEnough(zhmptr_t p_Size);
 
 	void* CurrentPtr()
 	{
-		return reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(m_Buffer) + m_CurrentSize);
+		return reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(m_Buffer) + (m_CurrentSize - m_BaseOffset));
 	}
 
 private:
@@ -82,4 +158,38 @@ private:
 	std::set<zhmptr_t> m_ResourcePtrOffsets;
 
 	std::unordered_map<IZHMTypeInfo*, std::unordered_map<ZVariant*, zhmptr_t>> m_VariantRegistry;
+
+	struct PayloadKey
+	{
+		PayloadKind Kind;
+		uint32_t ElementSize;
+		std::string_view Data;
+
+		bool operator==(const PayloadKey& p_Other) const = default;
+	};
+
+	struct PayloadKeyHash
+	{
+		size_t operator()(const PayloadKey& p_Key) const
+		{
+			const size_t s_Tag = (static_cast<size_t>(p_Key.Kind) << 32) | p_Key.ElementSize;
+			return std::hash<std::string_view>()(p_Key.Data) ^ (s_Tag * 0x9E3779B97F4A7C15ull);
+		}
+	};
+
+	bool m_DeduplicatePayloads;
+	std::unordered_map<PayloadKey, zhmptr_t, PayloadKeyHash> m_Payloads;
+
+	// Sub-serializers write their data at offsets starting from [m_BaseOffset], which is aligned to
+	// [c_SubSerializerAlignment] and past everything in their parent. Data written to them is always padded
+	// as if it started at an offset with that alignment, so it can only be merged at offsets that keep the
+	// padding the same.
+	static constexpr zhmptr_t c_SubSerializerAlignment = 64;
+
+	ZHMSerializer* m_Parent = nullptr;
+	zhmptr_t m_BaseOffset = 0;
+	zhmptr_t m_FirstAlignment = 0;
+	zhmptr_t m_MaxAlignment = 1;
+
+	static std::atomic<bool> g_PayloadDeduplicationEnabled;
 };
@@ -0,0 +1,331 @@
+#include "ZHMSyntheticGenerator.h"
+
+#include <cstdio>
+#include <algorithm>
+#include <stdexcept>
+
+#include <External/simdjson.h>
+#include <External/simdjson_helpers.h>
+#include <Util/PortableIntrinsics.h>
+
+#include "ZHMTypeInfo.h"
+
+static constexpr std::string_view c_PrimitiveTypes[] = {
+	"bool", "int8", "uint8", "int16", "uint16", "int32", "uint32", "int64", "uint64", "float32", "float64",
+};
+
+ZHMSyntheticGenerator::ZHMSyntheticGenerator(const SyntheticResourceOptions& p_Options) :
+	m_Options(p_Options),
+	m_State(p_Options.Seed)
+{
+}
+
+void ZHMSyntheticGenerator::LoadTypes(const std::filesystem::path& p_TypesJsonPath)
+{
+	if (!is_regular_file(p_TypesJsonPath))
+		throw std::runtime_error("Could not find types file '" + p_TypesJsonPath.string() + "'.");
+
+	simdjson::ondemand::parser s_Parser;
+	const auto s_Json = simdjson::padded_string::load(p_TypesJsonPath.string());
+
+	simdjson::ondemand::document s_Document = s_Parser.iterate(s_Json);
+
+	for (simdjson::ondemand::object s_Enum : s_Document["enums"])
+	{
+		const std::string s_Name { std::string_view(s_Enum["name"]) };
+		auto& s_Values = m_Enums[s_Name];
+
+		for (simdjson::ondemand::object s_Value : s_Enum["values"])
+			s_Values.emplace_back(std::string_view(s_Value["name"]));
+	}
+
+	for (simdjson::ondemand::object s_Struct : s_Document["structs"])
+	{
+		const std::string s_Name { std::string_view(s_Struct["name"]) };
+		auto& s_Fields = m_Structs[s_Name];
+
+		for (simdjson::ondemand::object s_Field : s_Struct["fields"])
+		{
+			SyntheticField s_SyntheticField;
+			s_SyntheticField.Name = std::string_view(s_Field["name"]);
+
+			auto s_Type = s_Field["type"];
+
+			if (!s_Type.is_null())
+				s_SyntheticField.Type = std::string_view(s_Type);
+
+			s_Fields.push_back(std::move(s_SyntheticField));
+		}
+
+		// Structs that don't exist in the type registry can't be instantiated through
+		// a variant, so we only consider the ones that do.
+		if (IZHMTypeInfo::IsTypeRegistered(s_Name))
+			m_VariantTypes.push_back(s_Name);
+	}
+}
+
+void ZHMSyntheticGenerator::WriteSimpleJson(const std::string& p_TypeName, std::ostream& p_Stream)
+{
+	WriteValue(p_TypeName, p_Stream, 0);
+}
+
+void ZHMSyntheticGenerator::WriteValue(std::string_view p_TypeName, std::ostream& p_Stream, uint32_t p_Depth)
+{
+	if (TryWritePrimitive(p_TypeName, p_Stream))
+		return;
+
+	if (p_TypeName == "ZString")
+	{
+		WriteString(p_Stream);
+		return;
+	}
+
+	if (p_TypeName == "ZRepositoryID")
+	{
+		WriteRepositoryId(p_Stream);
+		return;
+	}
+
+	if (p_TypeName == "ZVariant")
+	{
+		WriteVariant(p_Stream, p_Depth);
+		return;
+	}
+
+	if (p_TypeName.starts_with("TArray<") && p_TypeName.ends_with(">"))
+	{
+		const auto s_ElementType = p_TypeName.substr(7, p_TypeName.size() - 8);
+
+		// Arrays that are the root value or a direct member of it (eg. the sub-entities of a TEMP)
+		// use the root length. Everything else uses the nested one.
+		size_t s_Count = p_Depth <= 1 ? m_Options.RootArrayLength : m_Options.NestedArrayLength;
+
+		if (p_Depth > m_Options.MaxDepth)
+			s_Count = 0;
+
+		WriteArray(s_ElementType, s_Count, p_Stream, p_Depth);
+		return;
+	}
+
+	if (p_TypeName.starts_with("TFixedArray<") && p_TypeName.ends_with(">"))
+	{
+		// Fixed arrays are written as "TFixedArray<ElementType, Count>".
+		const auto s_Separator = p_TypeName.rfind(", ");
+
+		if (s_Separator == std::string_view::npos)
+			throw std::runtime_error("Malformed fixed array type '" + std::string(p_TypeName) + "'.");
+
+		const auto s_ElementType = p_TypeName.substr(12, s_Separator - 12);
+		const auto s_Count = std::stoull(std::string(p_TypeName.substr(s_Separator + 2, p_TypeName.size() - s_Separator - 3)));
+
+		WriteArray(s_ElementType, s_Count, p_Stream, p_Depth);
+		return;
+	}
+
+	const std::string s_TypeName(p_TypeName);
+
+	if (const auto s_EnumIt = m_Enums.find(s_TypeName); s_EnumIt != m_Enums.end() && !s_EnumIt->second.empty())
+	{
+		p_Stream << simdjson::as_json_string(s_EnumIt->second[NextBelow(s_EnumIt->second.size())]);
+		return;
+	}
+
+	if (const auto s_StructIt = m_Structs.find(s_TypeName); s_StructIt != m_Structs.end())
+	{
+		WriteStruct(s_StructIt->second, p_Stream, p_Depth);
+		return;
+	}
+
+	WriteDefault(p_TypeName, p_Stream);
+}
+
+bool ZHMSyntheticGenerator::TryWritePrimitive(std::string_view p_TypeName, std::ostream& p_Stream)
+{
+	if (p_TypeName != "char" && std::ranges::find(c_PrimitiveTypes, p_TypeName) == std::end(c_PrimitiveTypes))
+		return false;
+
+	const auto s_Value = Next();
+
+	if (p_TypeName == "bool")
+		p_Stream << simdjson::as_json_string((s_Value & 1) != 0);
+	else if (p_TypeName == "int8" || p_TypeName == "char")
+		p_Stream << simdjson::as_json_string(static_cast<int8_t>(s_Value));
+	else if (p_TypeName == "uint8")
+		p_Stream << simdjson::as_json_string(static_cast<uint8_t>(s_Value));
+	else if (p_TypeName == "int16")
+		p_Stream << simdjson::as_json_string(static_cast<int16_t>(s_Value));
+	else if (p_TypeName == "uint16")
+		p_Stream << simdjson::as_json_string(static_cast<uint16_t>(s_Value));
+	else if (p_TypeName == "int32")
+		p_Stream << simdjson::as_json_string(static_cast<int32_t>(s_Value));
+	else if (p_TypeName == "uint32")
+		p_Stream << simdjson::as_json_string(static_cast<uint32_t>(s_Value));
+	else if (p_TypeName == "int64")
+		p_Stream << simdjson::as_json_string(static_cast<int64_t>(s_Value));
+	else if (p_TypeName == "uint64")
+		p_Stream << simdjson::as_json_string(s_Value);
+	else if (p_TypeName == "float32" || p_TypeName == "float64")
+	{
+		// Multiples of 1/1024 in [-1024, 1024] are exactly representable as float32 and
+		// float64, so they survive a round-trip through json unchanged.
+		const auto s_Numerator = static_cast<int64_t>(s_Value % (2 * 1048576 + 1)) - 1048576;
+		p_Stream << simdjson::as_json_string(static_cast<double>(s_Numerator) / 1024.0);
+	}
+
+	return true;
+}
+
+void ZHMSyntheticGenerator::WriteString(std::ostream& p_Stream)
+{
+	static constexpr char c_Alphabet[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_";
+
+	const auto s_Length = NextBelow(static_cast<uint64_t>(m_Options.MaxStringLength) + 1);
+
+	std::string s_String(s_Length, '\0');
+
+	for (auto& s_Char : s_String)
+		s_Char = c_Alphabet[NextBelow(sizeof(c_Alphabet) - 1)];
+
+	p_Stream << simdjson::as_json_string(s_String);
+}
+
+void ZHMSyntheticGenerator::WriteRepositoryId(std::ostream& p_Stream)
+{
+	const auto s_High = Next();
+	const auto s_Low = Next();
+
+	char s_Buffer[37];
+
+	snprintf(s_Buffer, sizeof(s_Buffer), "%08x-%04x-%04x-%04x-%012llx",
+		static_cast<uint32_t>(s_High >> 32),
+		static_cast<uint32_t>((s_High >> 16) & 0xFFFF),
+		static_cast<uint32_t>(s_High & 0xFFFF),
+		static_cast<uint32_t>(s_Low >> 48),
+		static_cast<unsigned long long>(s_Low & 0xFFFFFFFFFFFFull)
+	);
+
+	p_Stream << "\"" << s_Buffer << "\"";
+}
+
+void ZHMSyntheticGenerator::WriteVariant(std::ostream& p_Stream, uint32_t p_Depth)
+{
+	// Past the maximum depth we only pick primitives, strings, and repository ids so the
+	// document doesn't keep growing through nested variants.
+	constexpr size_t c_LeafTypeCount = std::size(c_PrimitiveTypes) + 2;
+
+	const auto s_CandidateCount = p_Depth > m_Options.MaxDepth
+		? c_LeafTypeCount
+		: c_LeafTypeCount + m_VariantTypes.size();
+
+	const auto s_Choice = NextBelow(s_CandidateCount);
+
+	std::string_view s_TypeName;
+
+	if (s_Choice < std::size(c_PrimitiveTypes))
+		s_TypeName = c_PrimitiveTypes[s_Choice];
+	else if (s_Choice == std::size(c_PrimitiveTypes))
+		s_TypeName = "ZString";
+	else if (s_Choice == std::size(c_PrimitiveTypes) + 1)
+		s_TypeName = "ZRepositoryID";
+	else
+		s_TypeName = m_VariantTypes[s_Choice - c_LeafTypeCount];
+
+	p_Stream << "{\"$type\":" << simdjson::as_json_string(s_TypeName) << ",\"$val\":";
+	WriteValue(s_TypeName, p_Stream, p_Depth + 1);
+	p_Stream << "}";
+}
+
+void ZHMSyntheticGenerator::WriteStruct(const std::vector<SyntheticField>& p_Fields, std::ostream& p_Stream, uint32_t p_Depth)
+{
+	p_Stream << "{";
+
+	bool s_First = true;
+
+	for (const auto& s_Field : p_Fields)
+	{
+		// Untyped arrays are never part of the simple json representation.
+		if (s_Field.Type.empty() || s_Field.Type == "TArray")
+			continue;
+
+		if (!s_First)
+			p_Stream << ",";
+
+		s_First = false;
+
+		p_Stream << simdjson::as_json_string(s_Field.Name) << ":";
+		WriteValue(s_Field.Type, p_Stream, p_Depth + 1);
+	}
+
+	p_Stream << "}";
+}
+
+void ZHMSyntheticGenerator::WriteArray(std::string_view p_ElementType, size_t p_Count, std::ostream& p_Stream, uint32_t p_Depth)
+{
+	p_Stream << "[";
+
+	for (size_t i = 0; i < p_Count; ++i)
+	{
+		if (i > 0)
+			p_Stream << ",";
+
+		WriteValue(p_ElementType, p_Stream, p_Depth + 1);
+	}
+
+	p_Stream << "]";
+}
+
+void ZHMSyntheticGenerator::WriteDefault(std::string_view p_TypeName, std::ostream& p_Stream)
+{
+	std::string s_TypeName(p_TypeName);
+
+	// Templated types we don't know about (eg. TResourcePtr<T>) are registered under their base name.
+	if (!IZHMTypeInfo::IsTypeRegistered(s_TypeName) && s_TypeName.find('<') != std::string::npos)
+	{
+		const auto s_BaseName = s_TypeName.substr(0, s_TypeName.find('<'));
+
+		if (IZHMTypeInfo::IsTypeRegistered(s_BaseName))
+			s_TypeName = s_BaseName;
+	}
+
+	auto* s_Type = IZHMTypeInfo::GetTypeByName(s_TypeName);
+
+	if (s_Type == nullptr || s_Type->IsDummy())
+		throw std::runtime_error("Cannot synthesize a value for unknown type '" + std::string(p_TypeName) + "'.");
+
+	// Write a default value for the type by zero-initializing it.
+	const auto s_Alignment = std::max<size_t>(s_Type->Alignment(), alignof(void*));
+	const auto s_Size = c_get_aligned(std::max<size_t>(s_Type->Size(), 1), s_Alignment);
+
+	auto* s_Object = c_aligned_alloc(s_Size, s_Alignment);
+	memset(s_Object, 0x00, s_Size);
+
+	try
+	{
+		s_Type->WriteSimpleJson(s_Object, p_Stream);
+	}
+	catch (...)
+	{
+		c_aligned_free(s_Object);
+		throw;
+	}
+
+	c_aligned_free(s_Object);
+}
+
+uint64_t ZHMSyntheticGenerator::Next()
+{
+	// splitmix64. Unlike the standard library distributions, this produces the
+	// same sequence on every platform and compiler.
+	uint64_t s_Value = (m_State += 0x9E3779B97F4A7C15ull);
+	s_Value = (s_Value ^ (s_Value >> 30)) * 0xBF58476D1CE4E5B9ull;
+	s_Value = (s_Value ^ (s_Value >> 27)) * 0x94D049BB133111EBull;
+	return s_Value ^ (s_Value >> 31);
+}
+
+uint64_t ZHMSyntheticGenerator::NextBelow(uint64_t p_Bound)
+{
+	if (p_Bound == 0)
+		return 0;
+
+	return Next() % p_Bound;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <ostream>
+#include <filesystem>
+#include <unordered_map>
+
+#include <ResourceLibCommon.h>
+
+/**
+ * Produces simple json documents for arbitrary ZHM types, filled with deterministic pseudo-random data.
+ *
+ * Struct layouts and enum values are read from the ZHMTypes.json file that CodeGen writes next to the
+ * generated sources. Types that aren't described there but are known to the type registry (custom types
+ * and the like) are written in their default (zeroed) state.
+ */
+class ZHMSyntheticGenerator
+{
+public:
+	explicit ZHMSyntheticGenerator(const SyntheticResourceOptions& p_Options);
+
+	void LoadTypes(const std::filesystem::path& p_TypesJsonPath);
+	void WriteSimpleJson(const std::string& p_TypeName, std::ostream& p_Stream);
+
+private:
+	struct SyntheticField
+	{
+		std::string Name;
+		std::string Type;
+	};
+
+	void WriteValue(std::string_view p_TypeName, std::ostream& p_Stream, uint32_t p_Depth);
+	bool TryWritePrimitive(std::string_view p_TypeName, std::ostream& p_Stream);
+	void WriteString(std::ostream& p_Stream);
+	void WriteRepositoryId(std::ostream& p_Stream);
+	void WriteVariant(std::ostream& p_Stream, uint32_t p_Depth);
+	void WriteStruct(const std::vector<SyntheticField>& p_Fields, std::ostream& p_Stream, uint32_t p_Depth);
+	void WriteArray(std::string_view p_ElementType, size_t p_Count, std::ostream& p_Stream, uint32_t p_Depth);
+	void WriteDefault(std::string_view p_TypeName, std::ostream& p_Stream);
+
+	uint64_t Next();
+	uint64_t NextBelow(uint64_t p_Bound);
+
+private:
+	SyntheticResourceOptions m_Options;
+	uint64_t m_State;
+
+	std::unordered_map<std::string, std::vector<SyntheticField>> m_Structs;
+	std::unordered_map<std::string, std::vector<std::string>> m_Enums;
+	std::vector<std::string> m_VariantTypes;
+};
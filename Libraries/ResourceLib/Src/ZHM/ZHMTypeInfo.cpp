@@ -5,8 +5,10 @@
 #include <External/simdjson.h>
 #include <Util/PortableIntrinsics.h>
 
+#include <algorithm>
 #include <stdexcept>
 
+#include "Hash.h"
 #include "ZHMSerializer.h"
 #include "External/simdjson_helpers.h"
 
@@ -22,7 +24,22 @@
 
 std::recursive_mutex IZHMTypeInfo::g_TypeRegistryMutex;
 std::unordered_map<std::string, IZHMTypeInfo*>* IZHMTypeInfo::g_TypeRegistry = nullptr;
-ZHMTypeInfo::PrimitiveRegistrar IZHMTypeInfo::g_PrimitiveRegistrar;
+
+void IZHMTypeInfo::CacheJsonTypeName()
+{
+	// Type infos created at runtime are never destroyed, so neither are their json names.
+	m_JsonTypeName = *new std::string(simdjson::as_json_string(TypeName()));
+}
+
+void IZHMTypeInfo::WriteCbor(void* p_Object, CborWriter& p_Writer)
+{
+	ZHMCborFallback::Write([&](std::ostream& p_Stream) { WriteSimpleJson(p_Object, p_Stream); }, p_Writer);
+}
+
+void IZHMTypeInfo::CreateFromCbor(CborReader& p_Reader, void* p_Target)
+{
+	ZHMCborFallback::Read(p_Reader, [&](simdjson::ondemand::value p_Value) { CreateFromJson(p_Value, p_Target); });
+}
 
 class ZHMEnumTypeInfo : public IZHMTypeInfo
 {
@@ -31,37 +48,35 @@ public:
 		m_TypeName(p_TypeName),
 		m_Size(ZHMEnums::GetEnumSize(p_TypeName))
 	{
+		CacheJsonTypeName();
 	}
 
 public:
 	void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) override
 	{
-		int32_t s_Value = 0;
-		switch (m_Size)
-		{
-			case 1: s_Value = *reinterpret_cast<int8_t*>(p_Object); break;
-			case 2: s_Value = *reinterpret_cast<int16_t*>(p_Object); break;
-			default: s_Value = *reinterpret_cast<int32_t*>(p_Object); break;
-		}
-		p_Stream << simdjson::as_json_string(ZHMEnums::GetEnumValueName(m_TypeName, s_Value));
+		p_Stream << simdjson::as_json_string(ZHMEnums::GetEnumValueName(m_TypeName, GetValue(p_Object)));
 	}
 
 	void CreateFromJson(simdjson::ondemand::value p_Document, void* p_Target) override
 	{
-		const int32_t s_Value = ZHMEnums::GetEnumValueByName(m_TypeName, std::string_view(p_Document));
-		switch (m_Size)
-		{
-			case 1: *reinterpret_cast<int8_t*>(p_Target) = static_cast<int8_t>(s_Value); break;
-			case 2: *reinterpret_cast<int16_t*>(p_Target) = static_cast<int16_t>(s_Value); break;
-			default: *reinterpret_cast<int32_t*>(p_Target) = s_Value; break;
-		}
+		SetValue(p_Target, ZHMEnums::GetEnumValueByName(m_TypeName, std::string_view(p_Document)));
+	}
+
+	void WriteCbor(void* p_Object, CborWriter& p_Writer) override
+	{
+		p_Writer.WriteText(ZHMEnums::GetEnumValueName(m_TypeName, GetValue(p_Object)));
+	}
+
+	void CreateFromCbor(CborReader& p_Reader, void* p_Target) override
+	{
+		SetValue(p_Target, ZHMEnums::GetEnumValueByName(m_TypeName, p_Reader.ReadText()));
 	}
 
 	void Serialize(void* p_Object, ZHMSerializer& p_Serializer, uintptr_t p_OwnOffset) override
 	{
 	}
 
-	std::string TypeName() const override
+	std::string_view TypeName() const override
 	{
 		return m_TypeName;
 	}
@@ -92,6 +107,32 @@ public:
 		// No-op.
 	}
 
+	bool IsRelocationFree() const override
+	{
+		return true;
+	}
+
+private:
+	int32_t GetValue(void* p_Object) const
+	{
+		switch (m_Size)
+		{
+			case 1: return *reinterpret_cast<int8_t*>(p_Object);
+			case 2: return *reinterpret_cast<int16_t*>(p_Object);
+			default: return *reinterpret_cast<int32_t*>(p_Object);
+		}
+	}
+
+	void SetValue(void* p_Target, int32_t p_Value) const
+	{
+		switch (m_Size)
+		{
+			case 1: *reinterpret_cast<int8_t*>(p_Target) = static_cast<int8_t>(p_Value); break;
+			case 2: *reinterpret_cast<int16_t*>(p_Target) = static_cast<int16_t>(p_Value); break;
+			default: *reinterpret_cast<int32_t*>(p_Target) = p_Value; break;
+		}
+	}
+
 private:
 	std::string m_TypeName;
 	size_t m_Size;
@@ -101,19 +142,25 @@ class ZHMArrayTypeInfo : public IZHMTypeInfo
 {
 public:
 	ZHMArrayTypeInfo(IZHMTypeInfo* p_ElementType) :
-		m_ElementType(p_ElementType)
+		ZHMArrayTypeInfo(p_ElementType, "TArray<" + std::string(p_ElementType->TypeName()) + ">")
 	{
 	}
 
-	ZHMArrayTypeInfo(IZHMTypeInfo* p_ElementType, std::string p_OverriddenTypeName) :
+	ZHMArrayTypeInfo(IZHMTypeInfo* p_ElementType, std::string p_TypeName) :
 		m_ElementType(p_ElementType),
-		m_OverriddenTypeName(std::move(p_OverriddenTypeName))
+		m_NumericCodec(GetNumericCodec(p_ElementType)),
+		m_ElementIsRelocationFree(p_ElementType->IsRelocationFree()),
+		m_TypeName(std::move(p_TypeName))
 	{
+		CacheJsonTypeName();
 	}
 	
 public:	
 	void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) override
 	{
+		if (m_NumericCodec)
+			return m_NumericCodec->m_WriteSimpleJson(p_Object, p_Stream);
+
 		auto s_AlignedSize = c_get_aligned(m_ElementType->Size(), m_ElementType->Alignment());
 
 		auto* s_Array = reinterpret_cast<TArray<void*>*>(p_Object);
@@ -123,6 +170,19 @@ public:
 
 		auto s_ObjectPtr = reinterpret_cast<uintptr_t>(s_Array->begin());
 
+		if (ParallelJsonWriter::ShouldSplit(s_ElementCount))
+		{
+			ParallelJsonWriter::WriteElements(s_ElementCount, p_Stream, [&](size_t p_Index, std::ostream& p_ElementStream)
+			{
+				m_ElementType->WriteSimpleJson(reinterpret_cast<void*>(s_ObjectPtr + p_Index * s_AlignedSize), p_ElementStream);
+			});
+
+			p_Stream << "]";
+			return;
+		}
+
+		auto* s_Progress = JobProgress::BeginElements(s_ElementCount);
+
 		for (size_t i = 0; i < s_ElementCount; ++i)
 		{
 			m_ElementType->WriteSimpleJson(reinterpret_cast<void*>(s_ObjectPtr), p_Stream);
@@ -130,6 +190,9 @@ public:
 
 			if (i < s_ElementCount - 1)
 				p_Stream << ",";
+
+			if (s_Progress)
+				s_Progress->CompleteElements(1);
 		}
 
 		p_Stream << "]";
@@ -137,34 +200,93 @@ public:
 	
 	void CreateFromJson(simdjson::ondemand::value p_Document, void* p_Target) override
 	{
+		if (m_NumericCodec)
+			return m_NumericCodec->m_FromSimpleJson(p_Document, p_Target);
+
 		const auto s_ElementSize = m_ElementType->Size();
-		
-		simdjson::ondemand::array s_JsonArray = p_Document;
-		const size_t s_ElementCount = s_JsonArray.count_elements();
 
 		auto* s_Array = reinterpret_cast<TArray<void*>*>(p_Target);
 
-		if (s_ElementCount == 0)
+		const auto s_Allocate = [&](size_t p_ElementCount)
+		{
+			Allocate(s_Array, p_ElementCount);
+		};
+
+		if (WorkerPool::IsParallel())
 		{
-			s_Array->m_pBegin = nullptr;
-			s_Array->m_pEnd = nullptr;
-			s_Array->m_pAllocationEnd = nullptr;
+			ParallelJsonReader::ReadElements(p_Document, s_Allocate, [&](size_t p_Index, simdjson::ondemand::value p_Element)
+			{
+				m_ElementType->CreateFromJson(p_Element, reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(s_Array->m_pBegin) + p_Index * s_ElementSize));
+			});
+
+			return;
 		}
-		else
+
+		simdjson::ondemand::array s_JsonArray = p_Document;
+		s_Allocate(s_JsonArray.count_elements());
+
+		auto s_ArrayData = reinterpret_cast<uintptr_t>(s_Array->m_pBegin);
+		auto* s_Progress = JobProgress::BeginElements((reinterpret_cast<uintptr_t>(s_Array->m_pEnd) - s_ArrayData) / s_ElementSize);
+
+		for (simdjson::ondemand::value s_Element : s_JsonArray)
 		{
-			auto* s_ArrayData = c_aligned_alloc(s_ElementSize * s_ElementCount, m_ElementType->Alignment());
-			memset(s_ArrayData, 0x00, s_ElementSize * s_ElementCount);
+			m_ElementType->CreateFromJson(s_Element, reinterpret_cast<void*>(s_ArrayData));
+			s_ArrayData += s_ElementSize;
 
-			s_Array->m_pBegin = static_cast<void**>(s_ArrayData);
+			if (s_Progress)
+				s_Progress->CompleteElements(1);
+		}
+	}
 
-			for (const simdjson::ondemand::value& s_Element : s_JsonArray)
-			{
-				m_ElementType->CreateFromJson(s_Element, s_ArrayData);
-				s_ArrayData = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(s_ArrayData) + s_ElementSize);
-			}
+	void WriteCbor(void* p_Object, CborWriter& p_Writer) override
+	{
+		if (m_NumericCodec)
+			return m_NumericCodec->m_WriteCbor(p_Object, p_Writer);
+
+		const auto s_AlignedSize = c_get_aligned(m_ElementType->Size(), m_ElementType->Alignment());
+
+		auto* s_Array = reinterpret_cast<TArray<void*>*>(p_Object);
+		const auto s_ElementCount = (reinterpret_cast<uintptr_t>(s_Array->end()) - reinterpret_cast<uintptr_t>(s_Array->begin())) / s_AlignedSize;
+
+		p_Writer.BeginArray(s_ElementCount);
+
+		auto s_ObjectPtr = reinterpret_cast<uintptr_t>(s_Array->begin());
+		auto* s_Progress = JobProgress::BeginElements(s_ElementCount);
+
+		for (size_t i = 0; i < s_ElementCount; ++i)
+		{
+			m_ElementType->WriteCbor(reinterpret_cast<void*>(s_ObjectPtr), p_Writer);
+			s_ObjectPtr += s_AlignedSize;
+
+			if (s_Progress)
+				s_Progress->CompleteElements(1);
+		}
+	}
 
-			s_Array->m_pEnd = static_cast<void**>(s_ArrayData);
-			s_Array->m_pAllocationEnd = s_Array->m_pEnd;
+	void CreateFromCbor(CborReader& p_Reader, void* p_Target) override
+	{
+		if (m_NumericCodec)
+			return m_NumericCodec->m_FromCbor(p_Reader, p_Target);
+
+		const auto s_ElementSize = m_ElementType->Size();
+
+		auto* s_Array = reinterpret_cast<TArray<void*>*>(p_Target);
+
+		auto s_CborArray = p_Reader.ReadArray();
+		const auto s_ElementCount = p_Reader.Count(s_CborArray);
+
+		Allocate(s_Array, s_ElementCount);
+
+		auto s_ArrayData = reinterpret_cast<uintptr_t>(s_Array->m_pBegin);
+		auto* s_Progress = JobProgress::BeginElements(s_ElementCount);
+
+		while (p_Reader.Next(s_CborArray))
+		{
+			m_ElementType->CreateFromCbor(p_Reader, reinterpret_cast<void*>(s_ArrayData));
+			s_ArrayData += s_ElementSize;
+
+			if (s_Progress)
+				s_Progress->CompleteElements(1);
 		}
 	}
 
@@ -199,15 +321,17 @@ public:
 
 			// And now write the array data.
 			auto s_ElementsPtr = p_Serializer.WriteMemory(s_Object->m_pBegin, m_ElementType->Size() * s_ElementCount, sizeof(zhmptr_t));
-			auto s_CurrentElement = s_ElementsPtr;
+			const auto s_CurrentElement = s_ElementsPtr + s_AlignedSize * s_ElementCount;
 
 			auto s_ObjectPtr = reinterpret_cast<uintptr_t>(s_Object->m_pBegin);
 
-			for (size_t i = 0; i < s_ElementCount; ++i)
+			// Relocation-free elements have nothing to patch, so their data is already final.
+			if (!m_ElementIsRelocationFree)
 			{
-				m_ElementType->Serialize(reinterpret_cast<void*>(s_ObjectPtr), p_Serializer, s_CurrentElement);
-				s_CurrentElement += s_AlignedSize;
-				s_ObjectPtr += s_AlignedSize;
+				p_Serializer.SerializeElements(s_ElementCount, [&](ZHMSerializer& p_ElementSerializer, size_t i)
+				{
+					m_ElementType->Serialize(reinterpret_cast<void*>(s_ObjectPtr + s_AlignedSize * i), p_ElementSerializer, s_ElementsPtr + s_AlignedSize * i);
+				});
 			}
 
 			p_Serializer.PatchPtr(p_OwnOffset + offsetof(TArray<void*>, m_pBegin), s_ElementsPtr);
@@ -216,12 +340,9 @@ public:
 		}
 	}
 	
-	std::string TypeName() const override
+	std::string_view TypeName() const override
 	{
-		if (!m_OverriddenTypeName.empty())
-			return m_OverriddenTypeName;
-
-		return "TArray<" + m_ElementType->TypeName() + ">";
+		return m_TypeName;
 	}
 	
 	size_t Size() const override
@@ -256,6 +377,9 @@ public:
 		if (s_LeftElementCount == 0)
 			return false;
 
+		if (m_ElementIsRelocationFree)
+			return memcmp(s_Left->begin(), s_Right->begin(), s_AlignedSize * s_LeftElementCount) == 0;
+
 		auto s_LeftObjectPtr = reinterpret_cast<uintptr_t>(s_Left->begin());
 		auto s_RightObjectPtr = reinterpret_cast<uintptr_t>(s_Right->begin());
 
@@ -282,7 +406,7 @@ public:
 
 		auto s_ObjectPtr = reinterpret_cast<uintptr_t>(s_Object->begin());
 		
-		for (size_t i = 0; i < s_ElementCount; ++i)
+		for (size_t i = 0; i < s_ElementCount && !m_ElementIsRelocationFree; ++i)
 		{
 			m_ElementType->DestroyObject(reinterpret_cast<void*>(s_ObjectPtr));
 			s_ObjectPtr += s_AlignedSize;
@@ -294,15 +418,75 @@ public:
 		}
 	}
 
+	bool IsRelocationFree() const override
+	{
+		return false;
+	}
+
+private:
+	void Allocate(TArray<void*>* p_Array, size_t p_ElementCount) const
+	{
+		if (p_ElementCount == 0)
+		{
+			p_Array->m_pBegin = nullptr;
+			p_Array->m_pEnd = nullptr;
+			p_Array->m_pAllocationEnd = nullptr;
+			return;
+		}
+
+		const auto s_ElementSize = m_ElementType->Size();
+
+		auto* s_ArrayData = c_aligned_alloc(s_ElementSize * p_ElementCount, m_ElementType->Alignment());
+		memset(s_ArrayData, 0x00, s_ElementSize * p_ElementCount);
+
+		p_Array->m_pBegin = static_cast<void**>(s_ArrayData);
+		p_Array->m_pEnd = reinterpret_cast<void**>(reinterpret_cast<uintptr_t>(s_ArrayData) + s_ElementSize * p_ElementCount);
+		p_Array->m_pAllocationEnd = p_Array->m_pEnd;
+	}
+
+	struct NumericCodec
+	{
+		WriteTypeAsJson_t m_WriteSimpleJson;
+		CreateTypeFromJson_t m_FromSimpleJson;
+		WriteTypeAsCbor_t m_WriteCbor;
+		CreateTypeFromCbor_t m_FromCbor;
+	};
+
+	// Arrays of numbers and booleans go through the bulk codecs of the matching TArray.
+	static const NumericCodec* GetNumericCodec(IZHMTypeInfo* p_Type)
+	{
+		static const std::unordered_map<std::string, NumericCodec> s_Codecs = {
+			{ "int8", { TArray<int8>::WriteSimpleJson, TArray<int8>::FromSimpleJson, TArray<int8>::WriteCbor, TArray<int8>::FromCbor } },
+			{ "uint8", { TArray<uint8>::WriteSimpleJson, TArray<uint8>::FromSimpleJson, TArray<uint8>::WriteCbor, TArray<uint8>::FromCbor } },
+			{ "int16", { TArray<int16>::WriteSimpleJson, TArray<int16>::FromSimpleJson, TArray<int16>::WriteCbor, TArray<int16>::FromCbor } },
+			{ "uint16", { TArray<uint16>::WriteSimpleJson, TArray<uint16>::FromSimpleJson, TArray<uint16>::WriteCbor, TArray<uint16>::FromCbor } },
+			{ "int32", { TArray<int32>::WriteSimpleJson, TArray<int32>::FromSimpleJson, TArray<int32>::WriteCbor, TArray<int32>::FromCbor } },
+			{ "uint32", { TArray<uint32>::WriteSimpleJson, TArray<uint32>::FromSimpleJson, TArray<uint32>::WriteCbor, TArray<uint32>::FromCbor } },
+			{ "int64", { TArray<int64>::WriteSimpleJson, TArray<int64>::FromSimpleJson, TArray<int64>::WriteCbor, TArray<int64>::FromCbor } },
+			{ "uint64", { TArray<uint64>::WriteSimpleJson, TArray<uint64>::FromSimpleJson, TArray<uint64>::WriteCbor, TArray<uint64>::FromCbor } },
+			{ "float32", { TArray<float32>::WriteSimpleJson, TArray<float32>::FromSimpleJson, TArray<float32>::WriteCbor, TArray<float32>::FromCbor } },
+			{ "float64", { TArray<float64>::WriteSimpleJson, TArray<float64>::FromSimpleJson, TArray<float64>::WriteCbor, TArray<float64>::FromCbor } },
+			{ "bool", { TArray<bool>::WriteSimpleJson, TArray<bool>::FromSimpleJson, TArray<bool>::WriteCbor, TArray<bool>::FromCbor } },
+		};
+
+		const auto it = s_Codecs.find(std::string(p_Type->TypeName()));
+		return it == s_Codecs.end() ? nullptr : &it->second;
+	}
+
 private:
 	IZHMTypeInfo* m_ElementType;
-	std::string m_OverriddenTypeName;
+	const NumericCodec* m_NumericCodec;
+	bool m_ElementIsRelocationFree;
+	std::string m_TypeName;
 };
 
 class ZHMDummyTypeInfo : public IZHMTypeInfo
 {
 public:
-	ZHMDummyTypeInfo(const std::string& p_TypeName) : m_TypeName(p_TypeName) {}
+	ZHMDummyTypeInfo(const std::string& p_TypeName) : m_TypeName(p_TypeName)
+	{
+		CacheJsonTypeName();
+	}
 
 	void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) override
 	{
@@ -319,7 +503,7 @@ public:
 		throw std::runtime_error("Cannot serialize a value with dummy type info.");
 	}
 	
-	std::string TypeName() const override
+	std::string_view TypeName() const override
 	{
 		return m_TypeName;
 	}
@@ -349,14 +533,51 @@ public:
 		// No-op.
 	}
 
+	bool IsRelocationFree() const override
+	{
+		return false;
+	}
+
 private:
 	std::string m_TypeName;
 };
 
+IZHMTypeInfo* IZHMTypeInfo::FindStaticType(std::string_view p_Name)
+{
+	const auto s_NameHash = Hash::Crc32(p_Name);
+
+	for (
+		auto it = std::ranges::lower_bound(g_GeneratedTypes, s_NameHash, {}, &ZHMTypeIndexEntry::m_NameHash);
+		it != g_GeneratedTypes.end() && it->m_NameHash == s_NameHash;
+		++it
+	)
+	{
+		if (it->m_Type->TypeName() == p_Name)
+			return it->m_Type;
+	}
+
+	// These are only a handful, so they're not worth indexing.
+	for (auto* s_Type : g_PrimitiveTypes)
+		if (s_Type->TypeName() == p_Name)
+			return s_Type;
+
+	for (auto* s_Type : g_CustomTypes)
+		if (s_Type->TypeName() == p_Name)
+			return s_Type;
+
+	return nullptr;
+}
+
 IZHMTypeInfo* IZHMTypeInfo::GetTypeByName(const std::string& p_Name)
 {
+	if (auto* s_StaticType = FindStaticType(p_Name))
+		return s_StaticType;
+
 	std::lock_guard s_Lock(g_TypeRegistryMutex);
 
+	if (g_TypeRegistry == nullptr)
+		g_TypeRegistry = new std::unordered_map<std::string, IZHMTypeInfo*>();
+
 	auto it = g_TypeRegistry->find(p_Name);
 
 	if (it == g_TypeRegistry->end())
@@ -429,7 +650,49 @@ IZHMTypeInfo* IZHMTypeInfo::GetTypeByName(const std::string& p_Name)
 
 IZHMTypeInfo* IZHMTypeInfo::GetTypeByName(std::string_view p_Name)
 {
-	return GetTypeByName(std::string(p_Name.data(), p_Name.size()));
+	// Type infos are never removed from the registry, so the cache can point into their names.
+	thread_local std::unordered_map<std::string_view, IZHMTypeInfo*> s_Cache;
+
+	if (const auto it = s_Cache.find(p_Name); it != s_Cache.end())
+		return it->second;
+
+	auto* s_Type = FindStaticType(p_Name);
+
+	if (!s_Type)
+		s_Type = GetTypeByName(std::string(p_Name.data(), p_Name.size()));
+
+	// Dummies are replaced when the type gets registered later on, so they can't be cached.
+	if (s_Type->TypeName() == p_Name && !s_Type->IsDummy())
+		s_Cache.emplace(s_Type->TypeName(), s_Type);
+
+	return s_Type;
+}
+
+void IZHMTypeInfo::RegisterType(IZHMTypeInfo* p_Type)
+{
+	std::lock_guard s_Lock(g_TypeRegistryMutex);
+
+	if (g_TypeRegistry == nullptr)
+		g_TypeRegistry = new std::unordered_map<std::string, IZHMTypeInfo*>();
+
+	// Arrays of unknown types are dummies too, so they also get dropped here.
+	std::erase_if(*g_TypeRegistry, [](const auto& p_Entry) { return p_Entry.second->IsDummy(); });
+
+	(*g_TypeRegistry)[std::string(p_Type->TypeName())] = p_Type;
+}
+
+bool IZHMTypeInfo::IsTypeRegistered(const std::string& p_Name)
+{
+	if (FindStaticType(p_Name))
+		return true;
+
+	std::lock_guard s_Lock(g_TypeRegistryMutex);
+
+	if (g_TypeRegistry == nullptr)
+		return false;
+
+	const auto it = g_TypeRegistry->find(p_Name);
+	return it != g_TypeRegistry->end() && !it->second->IsDummy();
 }
 
 void TypeID::WriteSimpleJson(void* p_Object, std::ostream& p_Stream)
@@ -438,7 +701,7 @@ void TypeID::WriteSimpleJson(void* p_Object, std::ostream& p_Stream)
 	const auto s_Type = s_Object->m_pTypeID;
 
 	if (s_Type) {
-		p_Stream << simdjson::as_json_string(s_Object->m_pTypeID->TypeName());
+		p_Stream << s_Object->m_pTypeID->JsonTypeName();
 	} else {
 		p_Stream << simdjson::as_json_string("void");
 	}
@@ -450,6 +713,17 @@ void TypeID::FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target
 	reinterpret_cast<TypeID*>(p_Target)->m_pTypeID = ZHMTypeInfo::GetTypeByName(s_TypeName);
 }
 
+void TypeID::WriteCbor(void* p_Object, CborWriter& p_Writer)
+{
+	const auto s_Type = static_cast<TypeID*>(p_Object)->m_pTypeID;
+	p_Writer.WriteText(s_Type ? s_Type->TypeName() : "void");
+}
+
+void TypeID::FromCbor(CborReader& p_Reader, void* p_Target)
+{
+	reinterpret_cast<TypeID*>(p_Target)->m_pTypeID = ZHMTypeInfo::GetTypeByName(p_Reader.ReadText());
+}
+
 void TypeID::Serialize(void* p_Object, ZHMSerializer& p_Serializer, uintptr_t p_OwnOffset)
 {
 	auto* s_Object = static_cast<TypeID*>(p_Object);
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <cstddef>
+#include <cstring>
+#include <span>
+#include <string_view>
 #include <unordered_map>
 #include <mutex>
 #include "ZString.h"
@@ -12,57 +15,126 @@
 	static_assert(offsetof(T, m) == (off), "Wrong offset for " #T "::" #m)
 
 class ZHMSerializer;
+class CborWriter;
+class CborReader;
 
 typedef void(*WriteTypeAsJson_t)(void*, std::ostream&);
 typedef void(*CreateTypeFromJson_t)(simdjson::ondemand::value, void*);
+typedef void(*WriteTypeAsCbor_t)(void*, CborWriter&);
+typedef void(*CreateTypeFromCbor_t)(CborReader&, void*);
 typedef void(*SerializeType_t)(void*, ZHMSerializer&, zhmptr_t);
 typedef bool(*CheckEquals_t)(void*, void*);
 typedef void(*DestroyObject_t)(void*);
 
+class IZHMTypeInfo;
+
+struct ZHMTypeIndexEntry
+{
+	uint32_t m_NameHash;
+	IZHMTypeInfo* m_Type;
+};
+
 class IZHMTypeInfo
 {
 private:
-	struct PrimitiveRegistrar
-	{
-		PrimitiveRegistrar() { IZHMTypeInfo::RegisterPrimitiveTypes(); }
-	};
-
 	static std::recursive_mutex g_TypeRegistryMutex;
 	static std::unordered_map<std::string, IZHMTypeInfo*>* g_TypeRegistry;
-	static PrimitiveRegistrar g_PrimitiveRegistrar;
-	static void RegisterPrimitiveTypes();
+
+	/**
+	 * Types known at compile time (primitives, custom types and everything CodeGen generates) are constant
+	 * initialized and never go through the registry, so loading the library doesn't construct or register
+	 * anything. They are found through these tables instead, which are defined next to the types themselves.
+	 * The generated types are indexed by the CRC32 of their names and sorted by it.
+	 */
+	static const std::span<IZHMTypeInfo* const> g_PrimitiveTypes;
+	static const std::span<IZHMTypeInfo* const> g_CustomTypes;
+	static const std::span<const ZHMTypeIndexEntry> g_GeneratedTypes;
+
+	static IZHMTypeInfo* FindStaticType(std::string_view p_Name);
 
 public:
 	static IZHMTypeInfo* GetTypeByName(const std::string& p_Name);
+
+	/**
+	 * Same as above, but lookups of types that were already found by the calling thread are served
+	 * from a per-thread cache, without locking the registry or allocating.
+	 */
 	static IZHMTypeInfo* GetTypeByName(std::string_view p_Name);
+	static bool IsTypeRegistered(const std::string& p_Name);
 
 public:
 	virtual void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) = 0;
 	virtual void CreateFromJson(simdjson::ondemand::value p_Document, void* p_Target) = 0;
+
+	/**
+	 * Writes and reads values as CBOR, in the same shape as their simple json. Types that don't override
+	 * these go through their json representation, one value at a time.
+	 */
+	virtual void WriteCbor(void* p_Object, CborWriter& p_Writer);
+	virtual void CreateFromCbor(CborReader& p_Reader, void* p_Target);
+
 	virtual void Serialize(void* p_Object, ZHMSerializer& p_Serializer, uintptr_t p_OwnOffset) = 0;
-	virtual std::string TypeName() const = 0;
+	virtual std::string_view TypeName() const = 0;
 	virtual size_t Size() const = 0;
 	virtual size_t Alignment() const = 0;
 	virtual bool IsDummy() const = 0;
 	virtual bool Equals(void* p_Left, void* p_Right) const = 0;
 	virtual void DestroyObject(void* p_Object) = 0;
 
-	friend class ZHMTypeInfo;
+	// See ZHMRelocation.h.
+	virtual bool IsRelocationFree() const = 0;
+
+	/**
+	 * The type name as a quoted and escaped json string, ready to be written as is.
+	 */
+	std::string_view JsonTypeName() const
+	{
+		return m_JsonTypeName;
+	}
+
+protected:
+	constexpr IZHMTypeInfo() = default;
+
+	constexpr explicit IZHMTypeInfo(std::string_view p_JsonTypeName) :
+		m_JsonTypeName(p_JsonTypeName)
+	{
+	}
+
+	// Must be called by every type info that is created at runtime once its name is known.
+	void CacheJsonTypeName();
+
+	/**
+	 * Adds a type that was created at runtime to the registry. Placeholders that were handed out for
+	 * types the registry didn't know about are dropped, so they get resolved again on their next lookup.
+	 */
+	static void RegisterType(IZHMTypeInfo* p_Type);
+
+private:
+	std::string_view m_JsonTypeName;
 };
 
+/**
+ * Type info of a type known at compile time. These must be defined constinit and listed in one of the static type
+ * tables of IZHMTypeInfo. [p_JsonTypeName] is the type name as a quoted json string literal.
+ */
 class ZHMTypeInfo : public IZHMTypeInfo
 {
 public:
-	ZHMTypeInfo(
-		const char* p_TypeName, 
+	constexpr ZHMTypeInfo(
+		std::string_view p_TypeName,
+		std::string_view p_JsonTypeName,
 		size_t p_Size, 
 		size_t p_Alignment,
 		WriteTypeAsJson_t p_WriteSimpleJson,
 		CreateTypeFromJson_t p_CreateFromJson,
 		SerializeType_t p_Serialize,
 		CheckEquals_t p_CheckEquals = nullptr,
-		DestroyObject_t p_DestroyObject = nullptr
+		DestroyObject_t p_DestroyObject = nullptr,
+		bool p_IsRelocationFree = false,
+		WriteTypeAsCbor_t p_WriteCbor = nullptr,
+		CreateTypeFromCbor_t p_CreateFromCbor = nullptr
 	) :
+		IZHMTypeInfo(p_JsonTypeName),
 		m_Name(p_TypeName),
 		m_Size(p_Size),
 		m_Alignment(p_Alignment),
@@ -70,14 +142,11 @@ public:
 		m_CreateFromJson(p_CreateFromJson),
 		m_Serialize(p_Serialize),
 		m_CheckEquals(p_CheckEquals),
-		m_DestroyObject(p_DestroyObject)
+		m_DestroyObject(p_DestroyObject),
+		m_IsRelocationFree(p_IsRelocationFree),
+		m_WriteCbor(p_WriteCbor),
+		m_CreateFromCbor(p_CreateFromCbor)
 	{
-		std::lock_guard s_Lock(g_TypeRegistryMutex);
-
-		if (g_TypeRegistry == nullptr)
-			g_TypeRegistry = new std::unordered_map<std::string, IZHMTypeInfo*>();
-		
-		(*g_TypeRegistry)[p_TypeName] = this;
 	}
 
 	void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) override
@@ -90,12 +159,32 @@ public:
 		return m_CreateFromJson(p_Document, p_Target);
 	}
 
+	void WriteCbor(void* p_Object, CborWriter& p_Writer) override
+	{
+		if (m_WriteCbor == nullptr)
+			return IZHMTypeInfo::WriteCbor(p_Object, p_Writer);
+
+		return m_WriteCbor(p_Object, p_Writer);
+	}
+
+	void CreateFromCbor(CborReader& p_Reader, void* p_Target) override
+	{
+		if (m_CreateFromCbor == nullptr)
+			return IZHMTypeInfo::CreateFromCbor(p_Reader, p_Target);
+
+		return m_CreateFromCbor(p_Reader, p_Target);
+	}
+
 	void Serialize(void* p_Object, ZHMSerializer& p_Serializer, uintptr_t p_OwnOffset) override
 	{
+		// The raw data of the object has already been written, and there's nothing in it to patch.
+		if (m_IsRelocationFree)
+			return;
+
 		return m_Serialize(p_Object, p_Serializer, p_OwnOffset);
 	}
 
-	std::string TypeName() const override
+	std::string_view TypeName() const override
 	{
 		return m_Name;
 	}
@@ -120,19 +209,27 @@ public:
 		if (m_CheckEquals == nullptr)
 			return false;
 
+		if (m_IsRelocationFree)
+			return memcmp(p_Left, p_Right, m_Size) == 0;
+
 		return m_CheckEquals(p_Left, p_Right);
 	}
 
 	void DestroyObject(void* p_Object) override
 	{
-		if (m_DestroyObject == nullptr)
+		if (m_DestroyObject == nullptr || m_IsRelocationFree)
 			return;
 
 		m_DestroyObject(p_Object);
 	}
 
+	bool IsRelocationFree() const override
+	{
+		return m_IsRelocationFree;
+	}
+
 private:
-	std::string m_Name;
+	std::string_view m_Name;
 	size_t m_Size;
 	size_t m_Alignment;
 	WriteTypeAsJson_t m_WriteSimpleJson;
@@ -140,6 +237,9 @@ private:
 	SerializeType_t m_Serialize;
 	CheckEquals_t m_CheckEquals;
 	DestroyObject_t m_DestroyObject;
+	bool m_IsRelocationFree;
+	WriteTypeAsCbor_t m_WriteCbor;
+	CreateTypeFromCbor_t m_CreateFromCbor;
 };
 
 class TypeID
@@ -147,6 +247,8 @@ class TypeID
 public:
 	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
 	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
+	static void WriteCbor(void* p_Object, CborWriter& p_Writer);
+	static void FromCbor(CborReader& p_Reader, void* p_Target);
 	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, uintptr_t p_OwnOffset);
 
 	bool operator==(const TypeID& p_Other) const
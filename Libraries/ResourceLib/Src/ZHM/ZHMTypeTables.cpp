@@ -0,0 +1,1147 @@
+#include "ZHMTypeTables.h"
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <External/simdjson.h>
+#include <External/simdjson_helpers.h>
+#include <Util/JobProgress.h>
+#include <Util/ParallelJsonReader.h>
+#include <Util/ParallelJsonWriter.h>
+#include <Util/PortableIntrinsics.h>
+
+#include <ResourceTrace.h>
+
+#include "Hash.h"
+#include "ZHMSerializer.h"
+
+#if ZHM_TARGET == 3
+#include <Generated/HM3/ZHMEnums.h>
+#include <Generated/HM3/ZHMProperties.h>
+#elif ZHM_TARGET == 2
+#include <Generated/HM2/ZHMEnums.h>
+#include <Generated/HM2/ZHMProperties.h>
+#elif ZHM_TARGET == 2016
+#include <Generated/HM2016/ZHMEnums.h>
+#include <Generated/HM2016/ZHMProperties.h>
+#elif ZHM_TARGET == 2026
+#include <Generated/KNT/ZHMEnums.h>
+#include <Generated/KNT/ZHMProperties.h>
+#endif
+
+namespace
+{
+	template <class T>
+	T& As(void* p_Data)
+	{
+		return *static_cast<T*>(p_Data);
+	}
+
+	template <class T>
+	const T& As(const void* p_Data)
+	{
+		return *static_cast<const T*>(p_Data);
+	}
+
+	void* Offset(void* p_Data, size_t p_Offset)
+	{
+		return static_cast<uint8_t*>(p_Data) + p_Offset;
+	}
+
+	const void* Offset(const void* p_Data, size_t p_Offset)
+	{
+		return static_cast<const uint8_t*>(p_Data) + p_Offset;
+	}
+
+	// Size of a whole value of the type, which for fixed arrays covers all of their elements.
+	size_t ValueSize(const ZHMFieldType& p_Type)
+	{
+		return static_cast<size_t>(p_Type.m_Size) * p_Type.m_Count;
+	}
+
+	int32_t ReadEnum(const ZHMFieldType& p_Type, const void* p_Element)
+	{
+		switch (p_Type.m_Size)
+		{
+			case 1: return As<int8_t>(p_Element);
+			case 2: return As<int16_t>(p_Element);
+			default: return As<int32_t>(p_Element);
+		}
+	}
+
+	void WriteEnum(const ZHMFieldType& p_Type, void* p_Element, int32_t p_Value)
+	{
+		switch (p_Type.m_Size)
+		{
+			case 1: As<int8_t>(p_Element) = static_cast<int8_t>(p_Value); break;
+			case 2: As<int16_t>(p_Element) = static_cast<int16_t>(p_Value); break;
+			default: As<int32_t>(p_Element) = p_Value; break;
+		}
+	}
+
+	/**
+	 * Calls [p_Function] with a value of the C++ type of numeric kinds (bools excluded), which are stored
+	 * as CBOR typed arrays. Returns [false] for every other kind.
+	 */
+	template <class TFunction>
+	bool VisitNumeric(EZHMFieldKind p_Kind, TFunction&& p_Function)
+	{
+		switch (p_Kind)
+		{
+			case EZHMFieldKind::Int8: p_Function(int8_t()); return true;
+			case EZHMFieldKind::UInt8: p_Function(uint8_t()); return true;
+			case EZHMFieldKind::Int16: p_Function(int16_t()); return true;
+			case EZHMFieldKind::UInt16: p_Function(uint16_t()); return true;
+			case EZHMFieldKind::Int32: p_Function(int32_t()); return true;
+			case EZHMFieldKind::UInt32: p_Function(uint32_t()); return true;
+			case EZHMFieldKind::Int64: p_Function(int64_t()); return true;
+			case EZHMFieldKind::UInt64: p_Function(uint64_t()); return true;
+			case EZHMFieldKind::Float32: p_Function(float()); return true;
+			case EZHMFieldKind::Float64: p_Function(double()); return true;
+			default: return false;
+		}
+	}
+
+	// Name of arrays of [p_Type] in trace events.
+	std::string_view TraceElementType(const ZHMFieldType& p_Type)
+	{
+		switch (p_Type.m_Kind)
+		{
+			case EZHMFieldKind::String: return "ZString";
+			case EZHMFieldKind::Enum: return p_Type.m_EnumName;
+			case EZHMFieldKind::Struct: return p_Type.m_Struct->TypeName();
+			case EZHMFieldKind::TypeInfo: return p_Type.m_TypeInfo->TypeName();
+			default: return "TArray";
+		}
+	}
+
+	void WriteValue(const ZHMFieldType& p_Type, void* p_Value, std::ostream& p_Stream);
+	void ParseValue(const ZHMFieldType& p_Type, simdjson::ondemand::value p_Json, void* p_Value);
+	void WriteValueCbor(const ZHMFieldType& p_Type, void* p_Value, CborWriter& p_Writer);
+	void ReadValueCbor(const ZHMFieldType& p_Type, CborReader& p_Reader, void* p_Value);
+	void SerializeValue(const ZHMFieldType& p_Type, void* p_Value, ZHMSerializer& p_Serializer, zhmptr_t p_Offset);
+	bool ValuesEqual(const ZHMFieldType& p_Type, const void* p_Left, const void* p_Right);
+	void DestroyValue(const ZHMFieldType& p_Type, void* p_Value);
+
+	void WriteElement(const ZHMFieldType& p_Type, void* p_Element, std::ostream& p_Stream)
+	{
+		switch (p_Type.m_Kind)
+		{
+			case EZHMFieldKind::Bool: p_Stream << simdjson::as_json_string(As<bool>(p_Element)); break;
+			case EZHMFieldKind::Int8: p_Stream << simdjson::as_json_string(As<int8_t>(p_Element)); break;
+			case EZHMFieldKind::UInt8: p_Stream << simdjson::as_json_string(As<uint8_t>(p_Element)); break;
+			case EZHMFieldKind::Int16: p_Stream << simdjson::as_json_string(As<int16_t>(p_Element)); break;
+			case EZHMFieldKind::UInt16: p_Stream << simdjson::as_json_string(As<uint16_t>(p_Element)); break;
+			case EZHMFieldKind::Int32: p_Stream << simdjson::as_json_string(As<int32_t>(p_Element)); break;
+			case EZHMFieldKind::UInt32: p_Stream << simdjson::as_json_string(As<uint32_t>(p_Element)); break;
+			case EZHMFieldKind::Int64: p_Stream << simdjson::as_json_string(As<int64_t>(p_Element)); break;
+			case EZHMFieldKind::UInt64: p_Stream << simdjson::as_json_string(As<uint64_t>(p_Element)); break;
+			case EZHMFieldKind::Float32: p_Stream << simdjson::as_json_string(As<float>(p_Element)); break;
+			case EZHMFieldKind::Float64: p_Stream << simdjson::as_json_string(As<double>(p_Element)); break;
+
+			case EZHMFieldKind::PropertyId:
+			{
+				const auto s_PropertyName = ZHMProperties::PropertyToStringView(As<uint32_t>(p_Element));
+
+				if (s_PropertyName.empty())
+					p_Stream << simdjson::as_json_string(As<uint32_t>(p_Element));
+				else
+					p_Stream << simdjson::as_json_string(s_PropertyName);
+
+				break;
+			}
+
+			case EZHMFieldKind::String:
+				p_Stream << simdjson::as_json_string(As<ZString>(p_Element));
+				break;
+
+			case EZHMFieldKind::Enum:
+				p_Stream << simdjson::as_json_string(ZHMEnums::GetEnumValueName(p_Type.m_EnumName, ReadEnum(p_Type, p_Element)));
+				break;
+
+			case EZHMFieldKind::Struct:
+				p_Type.m_Struct->WriteSimpleJson(p_Element, p_Stream);
+				break;
+
+			case EZHMFieldKind::Array:
+			{
+				auto* s_Data = p_Type.m_ArrayOps->m_Data(p_Element);
+				const auto s_Size = p_Type.m_ArrayOps->m_Size(p_Element);
+				const auto s_Stride = ValueSize(*p_Type.m_Element);
+
+				ResourceTraceArrayScope s_Trace(TraceElementType(*p_Type.m_Element));
+
+				p_Stream << "[";
+
+				// Same as TArray::WriteSimpleJson, huge arrays are written on the worker pool.
+				if (ParallelJsonWriter::ShouldSplit(s_Size))
+				{
+					ParallelJsonWriter::WriteElements(s_Size, p_Stream, [&](size_t p_Index, std::ostream& p_ElementStream)
+					{
+						WriteValue(*p_Type.m_Element, Offset(s_Data, s_Stride * p_Index), p_ElementStream);
+					});
+
+					p_Stream << "]";
+					break;
+				}
+
+				auto* s_Progress = JobProgress::BeginElements(s_Size);
+
+				for (size_t i = 0; i < s_Size; ++i)
+				{
+					if (i > 0)
+						p_Stream << ",";
+
+					WriteValue(*p_Type.m_Element, Offset(s_Data, s_Stride * i), p_Stream);
+
+					if (s_Progress)
+						s_Progress->CompleteElements(1);
+				}
+
+				p_Stream << "]";
+				break;
+			}
+
+			case EZHMFieldKind::Object:
+				p_Type.m_Ops->m_WriteSimpleJson(p_Element, p_Stream);
+				break;
+
+			case EZHMFieldKind::TypeInfo:
+				p_Type.m_TypeInfo->WriteSimpleJson(p_Element, p_Stream);
+				break;
+		}
+	}
+
+	void ParseElement(const ZHMFieldType& p_Type, simdjson::ondemand::value p_Json, void* p_Element)
+	{
+		switch (p_Type.m_Kind)
+		{
+			case EZHMFieldKind::Bool: As<bool>(p_Element) = simdjson::from_json_bool(p_Json); break;
+			case EZHMFieldKind::Int8: As<int8_t>(p_Element) = simdjson::from_json_int8(p_Json); break;
+			case EZHMFieldKind::UInt8: As<uint8_t>(p_Element) = simdjson::from_json_uint8(p_Json); break;
+			case EZHMFieldKind::Int16: As<int16_t>(p_Element) = simdjson::from_json_int16(p_Json); break;
+			case EZHMFieldKind::UInt16: As<uint16_t>(p_Element) = simdjson::from_json_uint16(p_Json); break;
+			case EZHMFieldKind::Int32: As<int32_t>(p_Element) = simdjson::from_json_int32(p_Json); break;
+			case EZHMFieldKind::UInt32: As<uint32_t>(p_Element) = simdjson::from_json_uint32(p_Json); break;
+			case EZHMFieldKind::Int64: As<int64_t>(p_Element) = simdjson::from_json_int64(p_Json); break;
+			case EZHMFieldKind::UInt64: As<uint64_t>(p_Element) = simdjson::from_json_uint64(p_Json); break;
+			case EZHMFieldKind::Float32: As<float>(p_Element) = simdjson::from_json_float32(p_Json); break;
+			case EZHMFieldKind::Float64: As<double>(p_Element) = simdjson::from_json_float64(p_Json); break;
+
+			case EZHMFieldKind::PropertyId:
+				if (p_Json.type() == simdjson::ondemand::json_type::string)
+					As<uint32_t>(p_Element) = Hash::PropertyNameCrc32(std::string_view(p_Json));
+				else
+					As<uint32_t>(p_Element) = simdjson::from_json_uint32(p_Json);
+
+				break;
+
+			case EZHMFieldKind::String:
+				ZString::FromSimpleJson(p_Json, p_Element);
+				break;
+
+			case EZHMFieldKind::Enum:
+				WriteEnum(p_Type, p_Element, ZHMEnums::GetEnumValueByName(p_Type.m_EnumName, std::string_view(p_Json)));
+				break;
+
+			case EZHMFieldKind::Struct:
+				p_Type.m_Struct->CreateFromJson(p_Json, p_Element);
+				break;
+
+			case EZHMFieldKind::Array:
+			{
+				const auto s_Stride = ValueSize(*p_Type.m_Element);
+
+				// Same as TArray::FromSimpleJson, huge arrays are parsed on the worker pool.
+				if (WorkerPool::IsParallel())
+				{
+					void* s_Data = nullptr;
+
+					ParallelJsonReader::ReadElements(p_Json, [&](size_t p_Count)
+					{
+						p_Type.m_ArrayOps->m_Resize(p_Element, p_Count);
+						s_Data = p_Type.m_ArrayOps->m_Data(p_Element);
+					}, [&](size_t p_Index, simdjson::ondemand::value p_Item)
+					{
+						ParseValue(*p_Type.m_Element, p_Item, Offset(s_Data, s_Stride * p_Index));
+					});
+
+					break;
+				}
+
+				simdjson::ondemand::array s_Array = p_Json;
+				p_Type.m_ArrayOps->m_Resize(p_Element, s_Array.count_elements());
+
+				auto* s_Data = p_Type.m_ArrayOps->m_Data(p_Element);
+				auto* s_Progress = JobProgress::BeginElements(p_Type.m_ArrayOps->m_Size(p_Element));
+				size_t s_Index = 0;
+
+				for (simdjson::ondemand::value s_Item : s_Array)
+				{
+					ParseValue(*p_Type.m_Element, s_Item, Offset(s_Data, s_Stride * s_Index++));
+
+					if (s_Progress)
+						s_Progress->CompleteElements(1);
+				}
+
+				break;
+			}
+
+			case EZHMFieldKind::Object:
+				p_Type.m_Ops->m_FromSimpleJson(p_Json, p_Element);
+				break;
+
+			case EZHMFieldKind::TypeInfo:
+				p_Type.m_TypeInfo->CreateFromJson(p_Json, p_Element);
+				break;
+		}
+	}
+
+	void WriteElementCbor(const ZHMFieldType& p_Type, void* p_Element, CborWriter& p_Writer)
+	{
+		switch (p_Type.m_Kind)
+		{
+			case EZHMFieldKind::Bool: p_Writer.WriteBool(As<bool>(p_Element)); break;
+			case EZHMFieldKind::Int8: p_Writer.WriteInteger(As<int8_t>(p_Element)); break;
+			case EZHMFieldKind::UInt8: p_Writer.WriteInteger(As<uint8_t>(p_Element)); break;
+			case EZHMFieldKind::Int16: p_Writer.WriteInteger(As<int16_t>(p_Element)); break;
+			case EZHMFieldKind::UInt16: p_Writer.WriteInteger(As<uint16_t>(p_Element)); break;
+			case EZHMFieldKind::Int32: p_Writer.WriteInteger(As<int32_t>(p_Element)); break;
+			case EZHMFieldKind::UInt32: p_Writer.WriteInteger(As<uint32_t>(p_Element)); break;
+			case EZHMFieldKind::Int64: p_Writer.WriteInteger(As<int64_t>(p_Element)); break;
+			case EZHMFieldKind::UInt64: p_Writer.WriteInteger(As<uint64_t>(p_Element)); break;
+			case EZHMFieldKind::Float32: p_Writer.WriteFloat(As<float>(p_Element)); break;
+			case EZHMFieldKind::Float64: p_Writer.WriteDouble(As<double>(p_Element)); break;
+
+			case EZHMFieldKind::PropertyId:
+			{
+				const auto s_PropertyName = ZHMProperties::PropertyToStringView(As<uint32_t>(p_Element));
+
+				if (s_PropertyName.empty())
+					p_Writer.WriteInteger(As<uint32_t>(p_Element));
+				else
+					p_Writer.WriteText(s_PropertyName);
+
+				break;
+			}
+
+			case EZHMFieldKind::String:
+				p_Writer.WriteText(As<ZString>(p_Element).string_view());
+				break;
+
+			case EZHMFieldKind::Enum:
+				p_Writer.WriteText(ZHMEnums::GetEnumValueName(p_Type.m_EnumName, ReadEnum(p_Type, p_Element)));
+				break;
+
+			case EZHMFieldKind::Struct:
+				p_Type.m_Struct->WriteCbor(p_Element, p_Writer);
+				break;
+
+			case EZHMFieldKind::Array:
+			{
+				auto* s_Data = p_Type.m_ArrayOps->m_Data(p_Element);
+				const auto s_Size = p_Type.m_ArrayOps->m_Size(p_Element);
+				const auto s_Stride = ValueSize(*p_Type.m_Element);
+
+				p_Writer.BeginArray(s_Size);
+
+				auto* s_Progress = JobProgress::BeginElements(s_Size);
+
+				for (size_t i = 0; i < s_Size; ++i)
+				{
+					WriteValueCbor(*p_Type.m_Element, Offset(s_Data, s_Stride * i), p_Writer);
+
+					if (s_Progress)
+						s_Progress->CompleteElements(1);
+				}
+
+				break;
+			}
+
+			case EZHMFieldKind::Object:
+				p_Type.m_Ops->m_WriteCbor(p_Element, p_Writer);
+				break;
+
+			case EZHMFieldKind::TypeInfo:
+				p_Type.m_TypeInfo->WriteCbor(p_Element, p_Writer);
+				break;
+		}
+	}
+
+	void ReadElementCbor(const ZHMFieldType& p_Type, CborReader& p_Reader, void* p_Element)
+	{
+		switch (p_Type.m_Kind)
+		{
+			case EZHMFieldKind::Bool: As<bool>(p_Element) = p_Reader.ReadBool(); break;
+			case EZHMFieldKind::Int8: As<int8_t>(p_Element) = p_Reader.ReadInteger<int8_t>(); break;
+			case EZHMFieldKind::UInt8: As<uint8_t>(p_Element) = p_Reader.ReadInteger<uint8_t>(); break;
+			case EZHMFieldKind::Int16: As<int16_t>(p_Element) = p_Reader.ReadInteger<int16_t>(); break;
+			case EZHMFieldKind::UInt16: As<uint16_t>(p_Element) = p_Reader.ReadInteger<uint16_t>(); break;
+			case EZHMFieldKind::Int32: As<int32_t>(p_Element) = p_Reader.ReadInteger<int32_t>(); break;
+			case EZHMFieldKind::UInt32: As<uint32_t>(p_Element) = p_Reader.ReadInteger<uint32_t>(); break;
+			case EZHMFieldKind::Int64: As<int64_t>(p_Element) = p_Reader.ReadInteger<int64_t>(); break;
+			case EZHMFieldKind::UInt64: As<uint64_t>(p_Element) = p_Reader.ReadInteger<uint64_t>(); break;
+			case EZHMFieldKind::Float32: As<float>(p_Element) = static_cast<float>(p_Reader.ReadDouble()); break;
+			case EZHMFieldKind::Float64: As<double>(p_Element) = p_Reader.ReadDouble(); break;
+
+			case EZHMFieldKind::PropertyId:
+				if (p_Reader.PeekType() == ECborMajorType::TextString)
+					As<uint32_t>(p_Element) = Hash::PropertyNameCrc32(p_Reader.ReadText());
+				else
+					As<uint32_t>(p_Element) = p_Reader.ReadInteger<uint32_t>();
+
+				break;
+
+			case EZHMFieldKind::String:
+				ZString::FromCbor(p_Reader, p_Element);
+				break;
+
+			case EZHMFieldKind::Enum:
+				WriteEnum(p_Type, p_Element, ZHMEnums::GetEnumValueByName(p_Type.m_EnumName, p_Reader.ReadText()));
+				break;
+
+			case EZHMFieldKind::Struct:
+				p_Type.m_Struct->CreateFromCbor(p_Reader, p_Element);
+				break;
+
+			case EZHMFieldKind::Array:
+			{
+				auto s_Array = p_Reader.ReadArray();
+				p_Type.m_ArrayOps->m_Resize(p_Element, p_Reader.Count(s_Array));
+
+				auto* s_Data = p_Type.m_ArrayOps->m_Data(p_Element);
+				const auto s_Stride = ValueSize(*p_Type.m_Element);
+
+				auto* s_Progress = JobProgress::BeginElements(p_Type.m_ArrayOps->m_Size(p_Element));
+
+				for (size_t i = 0; p_Reader.Next(s_Array); ++i)
+				{
+					ReadValueCbor(*p_Type.m_Element, p_Reader, Offset(s_Data, s_Stride * i));
+
+					if (s_Progress)
+						s_Progress->CompleteElements(1);
+				}
+
+				break;
+			}
+
+			case EZHMFieldKind::Object:
+				p_Type.m_Ops->m_FromCbor(p_Reader, p_Element);
+				break;
+
+			case EZHMFieldKind::TypeInfo:
+				p_Type.m_TypeInfo->CreateFromCbor(p_Reader, p_Element);
+				break;
+		}
+	}
+
+	void SerializeElement(const ZHMFieldType& p_Type, void* p_Element, ZHMSerializer& p_Serializer, zhmptr_t p_Offset)
+	{
+		switch (p_Type.m_Kind)
+		{
+			case EZHMFieldKind::String: ZString::Serialize(p_Element, p_Serializer, p_Offset); break;
+			case EZHMFieldKind::Struct: p_Type.m_Struct->Serialize(p_Element, p_Serializer, p_Offset); break;
+			case EZHMFieldKind::Array: p_Type.m_ArrayOps->m_Serialize(p_Element, p_Serializer, p_Offset); break;
+			case EZHMFieldKind::Object: p_Type.m_Ops->m_Serialize(p_Element, p_Serializer, p_Offset); break;
+			case EZHMFieldKind::TypeInfo: p_Type.m_TypeInfo->Serialize(p_Element, p_Serializer, p_Offset); break;
+			default: break;
+		}
+	}
+
+	bool ElementsEqual(const ZHMFieldType& p_Type, const void* p_Left, const void* p_Right)
+	{
+		switch (p_Type.m_Kind)
+		{
+			case EZHMFieldKind::Bool: return As<bool>(p_Left) == As<bool>(p_Right);
+			case EZHMFieldKind::Int8: return As<int8_t>(p_Left) == As<int8_t>(p_Right);
+			case EZHMFieldKind::UInt8: return As<uint8_t>(p_Left) == As<uint8_t>(p_Right);
+			case EZHMFieldKind::Int16: return As<int16_t>(p_Left) == As<int16_t>(p_Right);
+			case EZHMFieldKind::UInt16: return As<uint16_t>(p_Left) == As<uint16_t>(p_Right);
+			case EZHMFieldKind::Int32: return As<int32_t>(p_Left) == As<int32_t>(p_Right);
+			case EZHMFieldKind::UInt32: return As<uint32_t>(p_Left) == As<uint32_t>(p_Right);
+			case EZHMFieldKind::Int64: return As<int64_t>(p_Left) == As<int64_t>(p_Right);
+			case EZHMFieldKind::UInt64: return As<uint64_t>(p_Left) == As<uint64_t>(p_Right);
+			case EZHMFieldKind::Float32: return As<float>(p_Left) == As<float>(p_Right);
+			case EZHMFieldKind::Float64: return As<double>(p_Left) == As<double>(p_Right);
+			case EZHMFieldKind::PropertyId: return As<uint32_t>(p_Left) == As<uint32_t>(p_Right);
+			case EZHMFieldKind::String: return As<ZString>(p_Left) == As<ZString>(p_Right);
+			case EZHMFieldKind::Enum: return ReadEnum(p_Type, p_Left) == ReadEnum(p_Type, p_Right);
+			case EZHMFieldKind::Struct: return p_Type.m_Struct->FieldsEqual(p_Left, p_Right);
+			case EZHMFieldKind::Array: return p_Type.m_ArrayOps->m_Equals(p_Left, p_Right);
+			case EZHMFieldKind::Object: return p_Type.m_Ops->m_Equals(p_Left, p_Right);
+			case EZHMFieldKind::TypeInfo:
+				// Values without pointers are compared as raw memory, even when their type info (like that of
+				// a loaded enum) wouldn't compare them at all.
+				if (p_Type.m_TypeInfo->IsRelocationFree())
+					return memcmp(p_Left, p_Right, p_Type.m_TypeInfo->Size()) == 0;
+
+				return p_Type.m_TypeInfo->Equals(const_cast<void*>(p_Left), const_cast<void*>(p_Right));
+		}
+
+		return false;
+	}
+
+	void DestroyElement(const ZHMFieldType& p_Type, void* p_Element)
+	{
+		switch (p_Type.m_Kind)
+		{
+			case EZHMFieldKind::String: As<ZString>(p_Element).~ZString(); break;
+			case EZHMFieldKind::Struct: p_Type.m_Struct->DestroyObject(p_Element); break;
+			case EZHMFieldKind::Array: p_Type.m_ArrayOps->m_Destroy(p_Element); break;
+			case EZHMFieldKind::Object: p_Type.m_Ops->m_Destroy(p_Element); break;
+			case EZHMFieldKind::TypeInfo: p_Type.m_TypeInfo->DestroyObject(p_Element); break;
+			default: break;
+		}
+	}
+
+	void WriteValue(const ZHMFieldType& p_Type, void* p_Value, std::ostream& p_Stream)
+	{
+		if (!(p_Type.m_Flags & ZHMFieldType::c_FixedArray))
+		{
+			WriteElement(p_Type, p_Value, p_Stream);
+			return;
+		}
+
+		p_Stream << "[";
+
+		for (size_t i = 0; i < p_Type.m_Count; ++i)
+		{
+			if (i > 0)
+				p_Stream << ",";
+
+			WriteElement(p_Type, Offset(p_Value, p_Type.m_Size * i), p_Stream);
+		}
+
+		p_Stream << "]";
+	}
+
+	void ParseValue(const ZHMFieldType& p_Type, simdjson::ondemand::value p_Json, void* p_Value)
+	{
+		if (!(p_Type.m_Flags & ZHMFieldType::c_FixedArray))
+		{
+			ParseElement(p_Type, p_Json, p_Value);
+			return;
+		}
+
+		size_t s_Index = 0;
+
+		for (simdjson::ondemand::value s_Item : p_Json)
+		{
+			if (s_Index >= p_Type.m_Count)
+				throw std::runtime_error("Fixed array has more than " + std::to_string(p_Type.m_Count) + " elements.");
+
+			ParseElement(p_Type, s_Item, Offset(p_Value, p_Type.m_Size * s_Index++));
+		}
+	}
+
+	void WriteValueCbor(const ZHMFieldType& p_Type, void* p_Value, CborWriter& p_Writer)
+	{
+		if (!(p_Type.m_Flags & ZHMFieldType::c_FixedArray))
+		{
+			WriteElementCbor(p_Type, p_Value, p_Writer);
+			return;
+		}
+
+		// Fixed arrays of numbers (matrices, colors, ...) are written straight from the object's memory.
+		const bool s_IsNumeric = VisitNumeric(p_Type.m_Kind, [&]<class T>(T)
+		{
+			p_Writer.WriteTypedArray(static_cast<const T*>(p_Value), p_Type.m_Count);
+		});
+
+		if (s_IsNumeric)
+			return;
+
+		p_Writer.BeginArray(p_Type.m_Count);
+
+		for (size_t i = 0; i < p_Type.m_Count; ++i)
+			WriteElementCbor(p_Type, Offset(p_Value, p_Type.m_Size * i), p_Writer);
+	}
+
+	void ReadValueCbor(const ZHMFieldType& p_Type, CborReader& p_Reader, void* p_Value)
+	{
+		if (!(p_Type.m_Flags & ZHMFieldType::c_FixedArray))
+		{
+			ReadElementCbor(p_Type, p_Reader, p_Value);
+			return;
+		}
+
+		const auto s_TooLong = [&]()
+		{
+			return std::runtime_error("Fixed array has more than " + std::to_string(p_Type.m_Count) + " elements.");
+		};
+
+		if (const auto s_TypedArray = p_Reader.TryReadTypedArray())
+		{
+			if (s_TypedArray->m_Count > p_Type.m_Count)
+				throw s_TooLong();
+
+			const bool s_IsNumeric = VisitNumeric(p_Type.m_Kind, [&]<class T>(T)
+			{
+				CborReader::ReadTypedArray(*s_TypedArray, static_cast<T*>(p_Value));
+			});
+
+			if (!s_IsNumeric)
+				throw std::runtime_error("Expected a CBOR array.");
+
+			return;
+		}
+
+		auto s_Array = p_Reader.ReadArray();
+
+		for (size_t i = 0; p_Reader.Next(s_Array); ++i)
+		{
+			if (i >= p_Type.m_Count)
+				throw s_TooLong();
+
+			ReadElementCbor(p_Type, p_Reader, Offset(p_Value, p_Type.m_Size * i));
+		}
+	}
+
+	void SerializeValue(const ZHMFieldType& p_Type, void* p_Value, ZHMSerializer& p_Serializer, zhmptr_t p_Offset)
+	{
+		if (p_Type.m_Flags & ZHMFieldType::c_Trivial)
+			return;
+
+		for (size_t i = 0; i < p_Type.m_Count; ++i)
+			SerializeElement(p_Type, Offset(p_Value, p_Type.m_Size * i), p_Serializer, p_Offset + p_Type.m_Size * i);
+	}
+
+	bool ValuesEqual(const ZHMFieldType& p_Type, const void* p_Left, const void* p_Right)
+	{
+		for (size_t i = 0; i < p_Type.m_Count; ++i)
+			if (!ElementsEqual(p_Type, Offset(p_Left, p_Type.m_Size * i), Offset(p_Right, p_Type.m_Size * i)))
+				return false;
+
+		return true;
+	}
+
+	void DestroyValue(const ZHMFieldType& p_Type, void* p_Value)
+	{
+		if (p_Type.m_Flags & ZHMFieldType::c_Trivial)
+			return;
+
+		for (size_t i = 0; i < p_Type.m_Count; ++i)
+			DestroyElement(p_Type, Offset(p_Value, p_Type.m_Size * i));
+	}
+}
+
+ZHMTableTypeInfo::ZHMTableTypeInfo(std::string_view p_TypeName, size_t p_Size, size_t p_Alignment) :
+	m_Name(p_TypeName),
+	m_Size(p_Size),
+	m_Alignment(p_Alignment),
+	m_Flags(c_RelocationFree)
+{
+	CacheJsonTypeName();
+	RegisterType(this);
+}
+
+void ZHMTableTypeInfo::WriteSimpleJson(void* p_Object, std::ostream& p_Stream)
+{
+	if (m_Fields.empty())
+	{
+		p_Stream << "{}";
+		return;
+	}
+
+	for (const auto& s_Field : m_Fields)
+	{
+		p_Stream << s_Field.m_JsonPrefix;
+		WriteValue(s_Field.m_Type, Offset(p_Object, s_Field.m_Offset), p_Stream);
+	}
+
+	p_Stream << "}";
+}
+
+void ZHMTableTypeInfo::CreateFromJson(simdjson::ondemand::value p_Document, void* p_Target)
+{
+	for (const auto& s_Field : m_Fields)
+		ParseValue(s_Field.m_Type, p_Document[s_Field.m_Name], Offset(p_Target, s_Field.m_Offset));
+}
+
+void ZHMTableTypeInfo::WriteCbor(void* p_Object, CborWriter& p_Writer)
+{
+	p_Writer.BeginMap(m_Fields.size());
+
+	for (const auto& s_Field : m_Fields)
+	{
+		p_Writer.WriteText(s_Field.m_Name);
+		WriteValueCbor(s_Field.m_Type, Offset(p_Object, s_Field.m_Offset), p_Writer);
+	}
+}
+
+void ZHMTableTypeInfo::CreateFromCbor(CborReader& p_Reader, void* p_Target)
+{
+	auto s_Map = p_Reader.ReadMap();
+
+	// Fields are almost always in table order, so the next one is checked before searching for it.
+	size_t s_NextField = 0;
+	size_t s_FieldsRead = 0;
+
+	while (p_Reader.Next(s_Map))
+	{
+		const std::string_view s_Key = p_Reader.ReadText();
+
+		if (s_NextField >= m_Fields.size() || m_Fields[s_NextField].m_Name != s_Key)
+		{
+			const auto it = std::ranges::find(m_Fields, s_Key, &ZHMFieldDescriptor::m_Name);
+
+			// Unknown fields are ignored.
+			if (it == m_Fields.end())
+			{
+				p_Reader.Skip();
+				continue;
+			}
+
+			s_NextField = it - m_Fields.begin();
+		}
+
+		const auto& s_Field = m_Fields[s_NextField++];
+		ReadValueCbor(s_Field.m_Type, p_Reader, Offset(p_Target, s_Field.m_Offset));
+		++s_FieldsRead;
+	}
+
+	if (s_FieldsRead < m_Fields.size())
+		throw std::runtime_error("Missing fields in CBOR object of type '" + std::string(m_Name) + "'.");
+}
+
+void ZHMTableTypeInfo::Serialize(void* p_Object, ZHMSerializer& p_Serializer, uintptr_t p_OwnOffset)
+{
+	// The raw data of the object has already been written, and there's nothing in it to patch.
+	if (m_Flags & c_RelocationFree)
+		return;
+
+	for (const auto& s_Field : m_Fields)
+		SerializeValue(s_Field.m_Type, Offset(p_Object, s_Field.m_Offset), p_Serializer, p_OwnOffset + s_Field.m_Offset);
+
+	if (m_Flags & c_RuntimeResourceId)
+		p_Serializer.RegisterRuntimeResourceId(p_OwnOffset);
+}
+
+bool ZHMTableTypeInfo::FieldsEqual(const void* p_Left, const void* p_Right) const
+{
+	if (m_Flags & (c_NoEquality | c_UnknownFields))
+		return false;
+
+	for (const auto& s_Field : m_Fields)
+		if (!ValuesEqual(s_Field.m_Type, Offset(p_Left, s_Field.m_Offset), Offset(p_Right, s_Field.m_Offset)))
+			return false;
+
+	return true;
+}
+
+bool ZHMTableTypeInfo::Equals(void* p_Left, void* p_Right) const
+{
+	if (m_Flags & (c_NoEquality | c_UnknownFields))
+		return false;
+
+	if (m_Flags & c_RelocationFree)
+		return memcmp(p_Left, p_Right, m_Size) == 0;
+
+	return FieldsEqual(p_Left, p_Right);
+}
+
+void ZHMTableTypeInfo::DestroyObject(void* p_Object)
+{
+	if (m_Flags & c_RelocationFree)
+		return;
+
+	for (const auto& s_Field : m_Fields)
+		DestroyValue(s_Field.m_Type, Offset(p_Object, s_Field.m_Offset));
+}
+
+class ZHMTableEnumTypeInfo : public IZHMTypeInfo
+{
+public:
+	ZHMTableEnumTypeInfo(std::string p_TypeName, size_t p_Size, std::unordered_map<int32_t, std::string> p_Names) :
+		m_TypeName(std::move(p_TypeName)),
+		m_Size(p_Size),
+		m_Names(std::move(p_Names))
+	{
+		for (const auto& [s_Value, s_Name] : m_Names)
+			m_Values.emplace(s_Name, s_Value);
+
+		CacheJsonTypeName();
+		RegisterType(this);
+	}
+
+public:
+	void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) override
+	{
+		p_Stream << simdjson::as_json_string(GetName(p_Object));
+	}
+
+	void CreateFromJson(simdjson::ondemand::value p_Document, void* p_Target) override
+	{
+		SetValue(p_Target, std::string_view(p_Document));
+	}
+
+	void WriteCbor(void* p_Object, CborWriter& p_Writer) override
+	{
+		p_Writer.WriteText(GetName(p_Object));
+	}
+
+	void CreateFromCbor(CborReader& p_Reader, void* p_Target) override
+	{
+		SetValue(p_Target, p_Reader.ReadText());
+	}
+
+	void Serialize(void* p_Object, ZHMSerializer& p_Serializer, uintptr_t p_OwnOffset) override
+	{
+	}
+
+	std::string_view TypeName() const override
+	{
+		return m_TypeName;
+	}
+
+	size_t Size() const override
+	{
+		return m_Size;
+	}
+
+	size_t Alignment() const override
+	{
+		return m_Size;
+	}
+
+	bool IsDummy() const override
+	{
+		return false;
+	}
+
+	bool Equals(void* p_Left, void* p_Right) const override
+	{
+		// Enums don't get de-duplicated.
+		return false;
+	}
+
+	void DestroyObject(void* p_Object) override
+	{
+		// No-op.
+	}
+
+	bool IsRelocationFree() const override
+	{
+		return true;
+	}
+
+private:
+	std::string_view GetName(void* p_Object) const
+	{
+		int32_t s_Value = 0;
+		switch (m_Size)
+		{
+			case 1: s_Value = *reinterpret_cast<int8_t*>(p_Object); break;
+			case 2: s_Value = *reinterpret_cast<int16_t*>(p_Object); break;
+			default: s_Value = *reinterpret_cast<int32_t*>(p_Object); break;
+		}
+
+		// Unknown values are written as empty strings, just like compiled enums.
+		const auto it = m_Names.find(s_Value);
+		return it == m_Names.end() ? std::string_view() : std::string_view(it->second);
+	}
+
+	void SetValue(void* p_Target, std::string_view p_Name) const
+	{
+		const auto it = m_Values.find(p_Name);
+		const int32_t s_Value = it == m_Values.end() ? 0 : it->second;
+
+		switch (m_Size)
+		{
+			case 1: *reinterpret_cast<int8_t*>(p_Target) = static_cast<int8_t>(s_Value); break;
+			case 2: *reinterpret_cast<int16_t*>(p_Target) = static_cast<int16_t>(s_Value); break;
+			default: *reinterpret_cast<int32_t*>(p_Target) = s_Value; break;
+		}
+	}
+
+	struct StringHash
+	{
+		using is_transparent = void;
+		size_t operator()(std::string_view p_Value) const { return std::hash<std::string_view>()(p_Value); }
+	};
+
+	std::string m_TypeName;
+	size_t m_Size;
+	std::unordered_map<int32_t, std::string> m_Names;
+	std::unordered_map<std::string, int32_t, StringHash, std::equal_to<>> m_Values;
+};
+
+namespace
+{
+	struct SPrimitiveKind
+	{
+		std::string_view m_Name;
+		EZHMFieldKind m_Kind;
+		uint32_t m_Size;
+	};
+
+	constexpr SPrimitiveKind c_PrimitiveKinds[] = {
+		{ "bool", EZHMFieldKind::Bool, sizeof(bool) },
+		{ "int8", EZHMFieldKind::Int8, sizeof(int8_t) },
+		{ "uint8", EZHMFieldKind::UInt8, sizeof(uint8_t) },
+		{ "int16", EZHMFieldKind::Int16, sizeof(int16_t) },
+		{ "uint16", EZHMFieldKind::UInt16, sizeof(uint16_t) },
+		{ "int32", EZHMFieldKind::Int32, sizeof(int32_t) },
+		{ "uint32", EZHMFieldKind::UInt32, sizeof(uint32_t) },
+		{ "int64", EZHMFieldKind::Int64, sizeof(int64_t) },
+		{ "uint64", EZHMFieldKind::UInt64, sizeof(uint64_t) },
+		{ "float32", EZHMFieldKind::Float32, sizeof(float) },
+		{ "float64", EZHMFieldKind::Float64, sizeof(double) },
+	};
+
+	struct SJsonField
+	{
+		std::string m_Name;
+		std::optional<std::string> m_Type;
+		uint32_t m_Offset;
+	};
+
+	/**
+	 * A struct described by the types file. Type infos created at runtime are never destroyed, so neither is
+	 * this, which owns the names and field table its type info points to.
+	 */
+	struct SLoadedStruct
+	{
+		SLoadedStruct(std::string p_Name, size_t p_Size, size_t p_Alignment) :
+			m_Name(std::move(p_Name)),
+			m_TypeInfo(m_Name, p_Size, p_Alignment)
+		{
+		}
+
+		void SetFields()
+		{
+			uint8_t s_Flags = 0;
+
+			if (m_HasUnknownFields)
+				s_Flags |= ZHMTableTypeInfo::c_UnknownFields;
+			else if (std::ranges::all_of(m_Fields, [](const ZHMFieldDescriptor& p_Field) { return (p_Field.m_Type.m_Flags & ZHMFieldType::c_Trivial) != 0; }))
+				s_Flags |= ZHMTableTypeInfo::c_RelocationFree;
+
+			m_TypeInfo.SetFields(m_Fields, s_Flags);
+		}
+
+		/**
+		 * Structs whose fields haven't been set yet claim to be relocation-free, so fields of those types
+		 * might have been flagged as such too early. Returns [true] if any flags had to be cleared.
+		 */
+		bool UpdateTrivialFields()
+		{
+			bool s_Changed = false;
+
+			for (auto& s_Field : m_Fields)
+			{
+				auto& s_Type = s_Field.m_Type;
+
+				if (!(s_Type.m_Flags & ZHMFieldType::c_Trivial))
+					continue;
+
+				const bool s_NeedsRelocation =
+					(s_Type.m_Kind == EZHMFieldKind::Struct && !s_Type.m_Struct->IsRelocationFree()) ||
+					(s_Type.m_Kind == EZHMFieldKind::TypeInfo && !s_Type.m_TypeInfo->IsRelocationFree());
+
+				if (s_NeedsRelocation)
+				{
+					s_Type.m_Flags &= ~ZHMFieldType::c_Trivial;
+					s_Changed = true;
+				}
+			}
+
+			if (s_Changed)
+				SetFields();
+
+			return s_Changed;
+		}
+
+		std::string m_Name;
+		ZHMTableTypeInfo m_TypeInfo;
+		std::vector<SJsonField> m_JsonFields;
+		std::vector<ZHMFieldDescriptor> m_Fields;
+		bool m_HasUnknownFields = false;
+
+		// Names of fields and the enums they refer to. A deque, so adding to it doesn't move them.
+		std::deque<std::string> m_Strings;
+	};
+
+	// Returns [false] if the type of the field isn't known.
+	bool ResolveFieldType(std::string_view p_TypeName, SLoadedStruct& p_Struct, ZHMFieldType& p_Type)
+	{
+		p_Type = ZHMFieldType { EZHMFieldKind::TypeInfo };
+
+		if (p_TypeName.starts_with("TFixedArray<") && p_TypeName.ends_with(">"))
+		{
+			// Fixed arrays are written as "TFixedArray<ElementType, Count>".
+			const auto s_Separator = p_TypeName.rfind(", ");
+
+			if (s_Separator == std::string_view::npos)
+				throw std::runtime_error("Malformed fixed array type '" + std::string(p_TypeName) + "'.");
+
+			const auto s_Count = std::stoul(std::string(p_TypeName.substr(s_Separator + 2, p_TypeName.size() - s_Separator - 3)));
+
+			if (!ResolveFieldType(p_TypeName.substr(12, s_Separator - 12), p_Struct, p_Type) || (p_Type.m_Flags & ZHMFieldType::c_FixedArray))
+				return false;
+
+			p_Type.m_Flags |= ZHMFieldType::c_FixedArray;
+			p_Type.m_Count = static_cast<uint32_t>(s_Count);
+
+			return true;
+		}
+
+		if (const auto it = std::ranges::find(c_PrimitiveKinds, p_TypeName, &SPrimitiveKind::m_Name); it != std::end(c_PrimitiveKinds))
+		{
+			p_Type.m_Kind = it->m_Kind;
+			p_Type.m_Flags = ZHMFieldType::c_Trivial;
+			p_Type.m_Size = it->m_Size;
+
+			return true;
+		}
+
+		if (p_TypeName == "ZString")
+		{
+			p_Type = ZHMFieldType::Of<ZString>();
+			return true;
+		}
+
+		const std::string s_TypeName(p_TypeName);
+
+		// Compiled enums are converted through ZHMEnums directly, just like in generated tables.
+		if (ZHMEnums::IsTypeNameEnum(s_TypeName))
+		{
+			p_Type.m_Kind = EZHMFieldKind::Enum;
+			p_Type.m_Flags = ZHMFieldType::c_Trivial;
+			p_Type.m_Size = ZHMEnums::GetEnumSize(s_TypeName);
+			p_Type.m_EnumName = p_Struct.m_Strings.emplace_back(s_TypeName).c_str();
+
+			return true;
+		}
+
+		auto* s_Type = IZHMTypeInfo::GetTypeByName(s_TypeName);
+
+		if (s_Type->IsDummy())
+			return false;
+
+		if (auto* s_Struct = dynamic_cast<ZHMTableTypeInfo*>(s_Type))
+		{
+			p_Type.m_Kind = EZHMFieldKind::Struct;
+			p_Type.m_Struct = s_Struct;
+		}
+		else
+		{
+			p_Type.m_TypeInfo = s_Type;
+		}
+
+		if (s_Type->IsRelocationFree())
+			p_Type.m_Flags |= ZHMFieldType::c_Trivial;
+
+		p_Type.m_Size = static_cast<uint32_t>(c_get_aligned(s_Type->Size(), s_Type->Alignment()));
+
+		return true;
+	}
+}
+
+size_t ZHMTypeTables::LoadTypes(const std::filesystem::path& p_TypesJsonPath)
+{
+	if (!is_regular_file(p_TypesJsonPath))
+		throw std::runtime_error("Could not find types file '" + p_TypesJsonPath.string() + "'.");
+
+	simdjson::ondemand::parser s_Parser;
+	const auto s_Json = simdjson::padded_string::load(p_TypesJsonPath.string());
+
+	simdjson::ondemand::document s_Document = s_Parser.iterate(s_Json);
+
+	size_t s_RegisteredTypes = 0;
+
+	for (simdjson::ondemand::object s_Enum : s_Document["enums"])
+	{
+		std::string s_Name { std::string_view(s_Enum["name"]) };
+
+		if (ZHMEnums::IsTypeNameEnum(s_Name) || IZHMTypeInfo::IsTypeRegistered(s_Name))
+			continue;
+
+		const uint64_t s_Size = s_Enum["size"];
+		std::unordered_map<int32_t, std::string> s_Names;
+
+		for (simdjson::ondemand::object s_Value : s_Enum["values"])
+		{
+			const std::string_view s_ValueName = s_Value["name"];
+			const int64_t s_ValueNumber = s_Value["value"];
+
+			s_Names.emplace(static_cast<int32_t>(s_ValueNumber), s_ValueName);
+		}
+
+		new ZHMTableEnumTypeInfo(std::move(s_Name), s_Size, std::move(s_Names));
+		++s_RegisteredTypes;
+	}
+
+	// Every struct is registered before any fields are resolved, since they can refer to each other.
+	std::vector<SLoadedStruct*> s_Structs;
+
+	for (simdjson::ondemand::object s_Struct : s_Document["structs"])
+	{
+		std::string s_Name { std::string_view(s_Struct["name"]) };
+
+		if (IZHMTypeInfo::IsTypeRegistered(s_Name))
+			continue;
+
+		const uint64_t s_Size = s_Struct["size"];
+		const uint64_t s_Alignment = s_Struct["alignment"];
+
+		auto* s_LoadedStruct = new SLoadedStruct(std::move(s_Name), s_Size, s_Alignment);
+
+		for (simdjson::ondemand::object s_Field : s_Struct["fields"])
+		{
+			SJsonField s_JsonField;
+			s_JsonField.m_Name = std::string_view(s_Field["name"]);
+
+			auto s_Type = s_Field["type"];
+
+			if (!s_Type.is_null())
+				s_JsonField.m_Type = std::string(std::string_view(s_Type));
+
+			s_JsonField.m_Offset = static_cast<uint32_t>(uint64_t(s_Field["offset"]));
+
+			s_LoadedStruct->m_JsonFields.push_back(std::move(s_JsonField));
+		}
+
+		s_Structs.push_back(s_LoadedStruct);
+		++s_RegisteredTypes;
+	}
+
+	for (auto* s_Struct : s_Structs)
+	{
+		for (const auto& s_JsonField : s_Struct->m_JsonFields)
+		{
+			ZHMFieldType s_Type { EZHMFieldKind::TypeInfo };
+
+			if (!s_JsonField.m_Type || !ResolveFieldType(*s_JsonField.m_Type, *s_Struct, s_Type))
+			{
+				s_Struct->m_HasUnknownFields = true;
+				continue;
+			}
+
+			const auto& s_Name = s_Struct->m_Strings.emplace_back(s_JsonField.m_Name);
+			const auto& s_JsonPrefix = s_Struct->m_Strings.emplace_back((s_Struct->m_Fields.empty() ? "{" : ",") + simdjson::as_json_string(s_Name) + ":");
+
+			s_Struct->m_Fields.push_back({ s_Name, s_JsonPrefix, s_JsonField.m_Offset, s_Type });
+		}
+
+		s_Struct->m_JsonFields.clear();
+		s_Struct->SetFields();
+	}
+
+	for (bool s_Changed = true; s_Changed;)
+	{
+		s_Changed = false;
+
+		for (auto* s_Struct : s_Structs)
+			s_Changed |= s_Struct->UpdateTrivialFields();
+	}
+
+	return s_RegisteredTypes;
+}
@@ -0,0 +1,359 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include "TArray.h"
+#include "ZString.h"
+#include "ZHMTypeInfo.h"
+#include "ZHMEquality.h"
+#include "ZHMRelocation.h"
+
+class ZHMTableTypeInfo;
+
+enum class EZHMFieldKind : uint8_t
+{
+	Bool,
+	Int8,
+	UInt8,
+	Int16,
+	UInt16,
+	Int32,
+	UInt32,
+	Int64,
+	UInt64,
+	Float32,
+	Float64,
+
+	// A uint32 property id, written as the name of the property when it's known.
+	PropertyId,
+
+	// A ZString. Parsed strings are interned in the current ZStringPool, if there is one.
+	String,
+
+	// An enum, written and parsed by name through ZHMEnums. [m_EnumName] is its original name.
+	Enum,
+
+	// A generated struct, whose own table is walked directly.
+	Struct,
+
+	// A TArray whose elements are described by [m_Element] and converted by the interpreter, split across the
+	// worker pool and reporting job progress the same way TArray does for its own elements.
+	Array,
+
+	// Any other compiled type (custom types, maps, arrays that TArray converts in bulk), handled by [m_Ops].
+	Object,
+
+	// A type only known at runtime, handled by its type info.
+	TypeInfo,
+};
+
+/**
+ * The statics of a compiled type that the interpreter hands its values off to.
+ */
+struct ZHMTypeOps
+{
+	WriteTypeAsJson_t m_WriteSimpleJson;
+	CreateTypeFromJson_t m_FromSimpleJson;
+	WriteTypeAsCbor_t m_WriteCbor;
+	CreateTypeFromCbor_t m_FromCbor;
+	SerializeType_t m_Serialize;
+	bool (*m_Equals)(const void*, const void*);
+	DestroyObject_t m_Destroy;
+};
+
+template <class T>
+constexpr inline ZHMTypeOps ZHMTypeOps_v {
+	[](void* p_Object, std::ostream& p_Stream) { T::WriteSimpleJson(p_Object, p_Stream); },
+	[](simdjson::ondemand::value p_Document, void* p_Target) { T::FromSimpleJson(p_Document, p_Target); },
+	[](void* p_Object, CborWriter& p_Writer) { ZHMCbor<T>::Write(p_Object, p_Writer); },
+	[](CborReader& p_Reader, void* p_Target) { ZHMCbor<T>::Read(p_Reader, p_Target); },
+	[](void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { T::Serialize(p_Object, p_Serializer, p_OwnOffset); },
+	[](const void* p_Left, const void* p_Right) { return *static_cast<const T*>(p_Left) == *static_cast<const T*>(p_Right); },
+	[](void* p_Object) { static_cast<T*>(p_Object)->~T(); },
+};
+
+/**
+ * Storage of a TArray<T> whose elements the interpreter converts itself. Everything else about
+ * the array (inline storage, payload de-duplication, ...) stays with TArray.
+ */
+struct ZHMArrayOps
+{
+	void* (*m_Data)(void*);
+	size_t (*m_Size)(void*);
+	void (*m_Resize)(void*, size_t);
+	SerializeType_t m_Serialize;
+	bool (*m_Equals)(const void*, const void*);
+	DestroyObject_t m_Destroy;
+};
+
+template <class T>
+constexpr inline ZHMArrayOps ZHMArrayOps_v {
+	[](void* p_Array) -> void* { return static_cast<TArray<T>*>(p_Array)->begin(); },
+	[](void* p_Array) { return static_cast<TArray<T>*>(p_Array)->size(); },
+	[](void* p_Array, size_t p_Size) { static_cast<TArray<T>*>(p_Array)->resize(p_Size); },
+	[](void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset) { TArray<T>::Serialize(p_Object, p_Serializer, p_OwnOffset); },
+	[](const void* p_Left, const void* p_Right) { return *static_cast<const TArray<T>*>(p_Left) == *static_cast<const TArray<T>*>(p_Right); },
+	[](void* p_Object) { static_cast<TArray<T>*>(p_Object)->~TArray<T>(); },
+};
+
+struct ZHMFieldType
+{
+	static constexpr uint8_t c_FixedArray = 1 << 0;
+
+	// Relocation-free, so there's nothing to patch when serializing and nothing to free when destroying.
+	static constexpr uint8_t c_Trivial = 1 << 1;
+
+	constexpr ZHMFieldType(EZHMFieldKind p_Kind = EZHMFieldKind::TypeInfo, uint8_t p_Flags = 0, uint32_t p_Count = 1, uint32_t p_Size = 0) :
+		m_Kind(p_Kind),
+		m_Flags(p_Flags),
+		m_Count(p_Count),
+		m_Size(p_Size),
+		m_Struct(nullptr),
+		m_Element(nullptr)
+	{
+	}
+
+	EZHMFieldKind m_Kind;
+	uint8_t m_Flags;
+
+	// Fixed arrays have [m_Count] elements of [m_Size] bytes each. Everything else has a single one.
+	uint32_t m_Count;
+	uint32_t m_Size;
+
+	union
+	{
+		ZHMTableTypeInfo* m_Struct;
+		const ZHMTypeOps* m_Ops;
+		const ZHMArrayOps* m_ArrayOps;
+		IZHMTypeInfo* m_TypeInfo;
+		const char* m_EnumName;
+	};
+
+	const ZHMFieldType* m_Element;
+
+	template <class T>
+	static consteval ZHMFieldType Of();
+
+	template <class T>
+	static consteval ZHMFieldType Enum(const char* p_TypeName)
+	{
+		static_assert(std::is_enum_v<T>);
+
+		ZHMFieldType s_Type { EZHMFieldKind::Enum, c_Trivial, 1, sizeof(T) };
+		s_Type.m_EnumName = p_TypeName;
+		return s_Type;
+	}
+
+	static consteval ZHMFieldType PropertyId()
+	{
+		return { EZHMFieldKind::PropertyId, c_Trivial, 1, sizeof(uint32_t) };
+	}
+
+	// [p_Element] must be a constant with static storage duration.
+	template <class T>
+	static consteval ZHMFieldType Array(const ZHMFieldType& p_Element)
+	{
+		ZHMFieldType s_Type { EZHMFieldKind::Array, 0, 1, sizeof(TArray<T>) };
+		s_Type.m_ArrayOps = &ZHMArrayOps_v<T>;
+		s_Type.m_Element = &p_Element;
+		return s_Type;
+	}
+
+	static consteval ZHMFieldType FixedArray(ZHMFieldType p_Element, uint32_t p_Count)
+	{
+		p_Element.m_Flags |= c_FixedArray;
+		p_Element.m_Count = p_Count;
+		return p_Element;
+	}
+};
+
+struct ZHMFieldDescriptor
+{
+	std::string_view m_Name;
+
+	// The quoted name along with the brace or comma before it, ready to be written as is.
+	std::string_view m_JsonPrefix;
+
+	uint32_t m_Offset;
+	ZHMFieldType m_Type;
+};
+
+/**
+ * Struct type infos driven by field descriptor tables. CodeGen emits a table (name, offset, kind, element type and
+ * flags) for every generated struct, and the same tables are built at runtime from the ZHMTypes.json file CodeGen
+ * writes next to the generated sources. ZHMTableTypeInfo walks them to write and parse json and CBOR, serialize,
+ * compare and destroy objects, so only custom types (ZVariant, SScaleformGFxResource, ...) need hand-written code.
+ */
+class ZHMTableTypeInfo final : public IZHMTypeInfo
+{
+public:
+	static constexpr uint8_t c_RelocationFree = 1 << 0;
+	static constexpr uint8_t c_NoEquality = 1 << 1;
+
+	// Objects of the type are registered with the serializer as runtime resource ids.
+	static constexpr uint8_t c_RuntimeResourceId = 1 << 2;
+
+	// Some fields of the type couldn't be resolved, so we can't tell whether two objects are equal.
+	static constexpr uint8_t c_UnknownFields = 1 << 3;
+
+	constexpr ZHMTableTypeInfo(
+		std::string_view p_TypeName,
+		std::string_view p_JsonTypeName,
+		size_t p_Size,
+		size_t p_Alignment,
+		std::span<const ZHMFieldDescriptor> p_Fields,
+		uint8_t p_Flags
+	) :
+		IZHMTypeInfo(p_JsonTypeName),
+		m_Name(p_TypeName),
+		m_Size(p_Size),
+		m_Alignment(p_Alignment),
+		m_Fields(p_Fields),
+		m_Flags(p_Flags)
+	{
+	}
+
+	/**
+	 * Type info of the compiled struct [T], to be defined constinit. The relocation and equality flags are
+	 * derived from the type itself.
+	 */
+	template <class T>
+	static consteval ZHMTableTypeInfo Of(std::string_view p_TypeName, std::string_view p_JsonTypeName, std::span<const ZHMFieldDescriptor> p_Fields, uint8_t p_Flags = 0)
+	{
+		if (ZHMIsRelocationFree_v<T>)
+			p_Flags |= c_RelocationFree;
+
+		if (!ZHMTypeSupportsEquality_v<T>)
+			p_Flags |= c_NoEquality;
+
+		return ZHMTableTypeInfo(p_TypeName, p_JsonTypeName, sizeof(T), alignof(T), p_Fields, p_Flags);
+	}
+
+	/**
+	 * Creates and registers the type info of a struct that's only known at runtime. [p_TypeName] must outlive it.
+	 * It has no fields until SetFields is called, since those can only be resolved once every type they could
+	 * refer to is registered.
+	 */
+	ZHMTableTypeInfo(std::string_view p_TypeName, size_t p_Size, size_t p_Alignment);
+
+	void SetFields(std::span<const ZHMFieldDescriptor> p_Fields, uint8_t p_Flags)
+	{
+		m_Fields = p_Fields;
+		m_Flags = p_Flags;
+	}
+
+	std::span<const ZHMFieldDescriptor> Fields() const
+	{
+		return m_Fields;
+	}
+
+	/**
+	 * Compares two objects field by field, by value. This is what the operator== of generated types uses.
+	 */
+	bool FieldsEqual(const void* p_Left, const void* p_Right) const;
+
+public:
+	void WriteSimpleJson(void* p_Object, std::ostream& p_Stream) override;
+	void CreateFromJson(simdjson::ondemand::value p_Document, void* p_Target) override;
+	void WriteCbor(void* p_Object, CborWriter& p_Writer) override;
+	void CreateFromCbor(CborReader& p_Reader, void* p_Target) override;
+	void Serialize(void* p_Object, ZHMSerializer& p_Serializer, uintptr_t p_OwnOffset) override;
+
+	std::string_view TypeName() const override
+	{
+		return m_Name;
+	}
+
+	size_t Size() const override
+	{
+		return m_Size;
+	}
+
+	size_t Alignment() const override
+	{
+		return m_Alignment;
+	}
+
+	bool IsDummy() const override
+	{
+		return false;
+	}
+
+	bool Equals(void* p_Left, void* p_Right) const override;
+	void DestroyObject(void* p_Object) override;
+
+	bool IsRelocationFree() const override
+	{
+		return (m_Flags & c_RelocationFree) != 0;
+	}
+
+private:
+	std::string_view m_Name;
+	size_t m_Size;
+	size_t m_Alignment;
+	std::span<const ZHMFieldDescriptor> m_Fields;
+	uint8_t m_Flags;
+};
+
+template <class T>
+consteval ZHMFieldType ZHMFieldType::Of()
+{
+	constexpr uint8_t s_Flags = ZHMIsRelocationFree_v<T> ? c_Trivial : 0;
+
+	if constexpr (std::is_same_v<T, bool>)
+		return { EZHMFieldKind::Bool, s_Flags, 1, sizeof(T) };
+	else if constexpr (std::is_same_v<T, int8_t> || std::is_same_v<T, char>)
+		return { EZHMFieldKind::Int8, s_Flags, 1, sizeof(T) };
+	else if constexpr (std::is_same_v<T, uint8_t>)
+		return { EZHMFieldKind::UInt8, s_Flags, 1, sizeof(T) };
+	else if constexpr (std::is_same_v<T, int16_t>)
+		return { EZHMFieldKind::Int16, s_Flags, 1, sizeof(T) };
+	else if constexpr (std::is_same_v<T, uint16_t>)
+		return { EZHMFieldKind::UInt16, s_Flags, 1, sizeof(T) };
+	else if constexpr (std::is_same_v<T, int32_t>)
+		return { EZHMFieldKind::Int32, s_Flags, 1, sizeof(T) };
+	else if constexpr (std::is_same_v<T, uint32_t>)
+		return { EZHMFieldKind::UInt32, s_Flags, 1, sizeof(T) };
+	else if constexpr (std::is_same_v<T, int64_t>)
+		return { EZHMFieldKind::Int64, s_Flags, 1, sizeof(T) };
+	else if constexpr (std::is_same_v<T, uint64_t>)
+		return { EZHMFieldKind::UInt64, s_Flags, 1, sizeof(T) };
+	else if constexpr (std::is_same_v<T, float>)
+		return { EZHMFieldKind::Float32, s_Flags, 1, sizeof(T) };
+	else if constexpr (std::is_same_v<T, double>)
+		return { EZHMFieldKind::Float64, s_Flags, 1, sizeof(T) };
+	else if constexpr (std::is_same_v<T, ZString>)
+		return { EZHMFieldKind::String, s_Flags, 1, sizeof(T) };
+	else if constexpr (requires { requires std::is_same_v<decltype(T::TypeInfo), ZHMTableTypeInfo>; })
+	{
+		ZHMFieldType s_Type { EZHMFieldKind::Struct, s_Flags, 1, sizeof(T) };
+		s_Type.m_Struct = &T::TypeInfo;
+		return s_Type;
+	}
+	else
+	{
+		static_assert(std::is_class_v<T>, "Enums must be described with ZHMFieldType::Enum.");
+
+		ZHMFieldType s_Type { EZHMFieldKind::Object, s_Flags, 1, sizeof(T) };
+		s_Type.m_Ops = &ZHMTypeOps_v<T>;
+		return s_Type;
+	}
+}
+
+class ZHMTypeTables
+{
+public:
+	/**
+	 * Registers the types described in [p_TypesJsonPath] and returns how many of them were new. Structs get the same
+	 * field tables CodeGen emits for compiled types. Loading a types file lets resources and properties using types
+	 * added in newer game versions be converted without regenerating ResourceLib. Compiled types always take precedence
+	 * over the ones described in the file.
+	 * Throws std::runtime_error if the file can't be read or is malformed.
+	 */
+	static size_t LoadTypes(const std::filesystem::path& p_TypesJsonPath);
+};
@@ -1,24 +1,298 @@
 #include "ZRepositoryID.h"
 #include "External/simdjson_helpers.h"
+#include "Util/CpuFeatures.h"
+#include "Util/Cbor.h"
+
+#include <cstring>
+
+// The GUID fields are stored little-endian, but written most significant byte first, so the
+// bytes of data1, data2 and data3 are reversed between the string and memory representations.
+// data4 is just a byte array, so it's written as is.
+static constexpr uint8_t c_GuidByteOrder[16] = { 3, 2, 1, 0, 5, 4, 7, 6, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+// Offsets of the hex digit pairs of each byte (in string order) in the Dashes format.
+static constexpr uint8_t c_DashedPairOffsets[16] = { 0, 2, 4, 6, 9, 11, 14, 16, 19, 21, 24, 26, 28, 30, 32, 34 };
+
+static constexpr char c_HexDigits[] = "0123456789ABCDEF";
+
+static bool HasDashes(const char* p_String)
+{
+	return (p_String[8] == '-') & (p_String[13] == '-') & (p_String[18] == '-') & (p_String[23] == '-');
+}
+
+// Returns the value of a hex digit, or a value with bit 4 set if it's not one.
+static uint32_t HexValue(char p_Char)
+{
+	const uint32_t s_Digit = static_cast<uint8_t>(p_Char) - '0';
+	const uint32_t s_Letter = (static_cast<uint8_t>(p_Char) | 0x20) - 'a';
+
+	if (s_Digit < 10)
+		return s_Digit;
+
+	if (s_Letter < 6)
+		return s_Letter + 10;
+
+	return 0x10;
+}
+
+static bool ParseDashedScalar(const char* p_String, uint8_t* p_Bytes)
+{
+	uint32_t s_Invalid = 0;
+
+	for (size_t i = 0; i < 16; ++i)
+	{
+		const char* s_Pair = p_String + c_DashedPairOffsets[i];
+		const uint32_t s_High = HexValue(s_Pair[0]);
+		const uint32_t s_Low = HexValue(s_Pair[1]);
+
+		s_Invalid |= s_High | s_Low;
+		p_Bytes[c_GuidByteOrder[i]] = static_cast<uint8_t>((s_High << 4) | s_Low);
+	}
+
+	return (s_Invalid & 0x10) == 0;
+}
+
+static void FormatDashedScalar(const uint8_t* p_Bytes, char* p_Buffer)
+{
+	p_Buffer[8] = p_Buffer[13] = p_Buffer[18] = p_Buffer[23] = '-';
+
+	for (size_t i = 0; i < 16; ++i)
+	{
+		const uint8_t s_Byte = p_Bytes[c_GuidByteOrder[i]];
+		char* s_Pair = p_Buffer + c_DashedPairOffsets[i];
+
+		s_Pair[0] = c_HexDigits[s_Byte >> 4];
+		s_Pair[1] = c_HexDigits[s_Byte & 0xF];
+	}
+}
+
+#if RL_X86
+// Converts hex digits to their values, clearing the lanes of [p_Valid] that aren't hex digits.
+RL_TARGET_SSSE3
+static __m128i HexToNibbles(__m128i p_Chars, __m128i& p_Valid)
+{
+	const __m128i s_Digit = _mm_sub_epi8(p_Chars, _mm_set1_epi8('0'));
+	const __m128i s_Letter = _mm_sub_epi8(_mm_or_si128(p_Chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+
+	const __m128i s_IsDigit = _mm_cmpeq_epi8(_mm_min_epu8(s_Digit, _mm_set1_epi8(9)), s_Digit);
+	const __m128i s_IsLetter = _mm_cmpeq_epi8(_mm_min_epu8(s_Letter, _mm_set1_epi8(5)), s_Letter);
+
+	p_Valid = _mm_and_si128(p_Valid, _mm_or_si128(s_IsDigit, s_IsLetter));
+
+	return _mm_or_si128(
+		_mm_and_si128(s_IsDigit, s_Digit),
+		_mm_and_si128(s_IsLetter, _mm_add_epi8(s_Letter, _mm_set1_epi8(10)))
+	);
+}
+
+RL_TARGET_SSSE3
+static bool ParseDashedSSSE3(const char* p_String, uint8_t* p_Bytes)
+{
+	const __m128i s_In0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_String));
+	const __m128i s_In1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_String + 16));
+	const __m128i s_In2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_String + 20));
+
+	// Gather the 32 hex digits, skipping the dashes.
+	const __m128i s_Digits0 = _mm_or_si128(
+		_mm_shuffle_epi8(s_In0, _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 9, 10, 11, 12, 14, 15, -1, -1)),
+		_mm_shuffle_epi8(s_In1, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1))
+	);
+
+	const __m128i s_Digits1 = _mm_or_si128(
+		_mm_shuffle_epi8(s_In1, _mm_setr_epi8(3, 4, 5, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+		_mm_shuffle_epi8(s_In2, _mm_setr_epi8(-1, -1, -1, -1, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15))
+	);
+
+	__m128i s_Valid = _mm_set1_epi8(-1);
+
+	const __m128i s_Nibbles0 = HexToNibbles(s_Digits0, s_Valid);
+	const __m128i s_Nibbles1 = HexToNibbles(s_Digits1, s_Valid);
+
+	if (_mm_movemask_epi8(s_Valid) != 0xFFFF)
+		return false;
+
+	// Combine each pair of nibbles into a byte (high * 16 + low) and put them in memory order.
+	const __m128i s_PairWeights = _mm_set1_epi16(0x0110);
+
+	__m128i s_Bytes = _mm_packus_epi16(
+		_mm_maddubs_epi16(s_Nibbles0, s_PairWeights),
+		_mm_maddubs_epi16(s_Nibbles1, s_PairWeights)
+	);
+
+	s_Bytes = _mm_shuffle_epi8(s_Bytes, _mm_loadu_si128(reinterpret_cast<const __m128i*>(c_GuidByteOrder)));
+
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(p_Bytes), s_Bytes);
+
+	return true;
+}
+
+RL_TARGET_SSSE3
+static void FormatDashedSSSE3(const uint8_t* p_Bytes, char* p_Buffer)
+{
+	__m128i s_Bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_Bytes));
+	s_Bytes = _mm_shuffle_epi8(s_Bytes, _mm_loadu_si128(reinterpret_cast<const __m128i*>(c_GuidByteOrder)));
+
+	const __m128i s_HexLut = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c_HexDigits));
+	const __m128i s_High = _mm_and_si128(_mm_srli_epi16(s_Bytes, 4), _mm_set1_epi8(0x0F));
+	const __m128i s_Low = _mm_and_si128(s_Bytes, _mm_set1_epi8(0x0F));
+
+	// Digits 0 - 15 and 16 - 31, in string order.
+	const __m128i s_Digits0 = _mm_shuffle_epi8(s_HexLut, _mm_unpacklo_epi8(s_High, s_Low));
+	const __m128i s_Digits1 = _mm_shuffle_epi8(s_HexLut, _mm_unpackhi_epi8(s_High, s_Low));
+
+	// Spread the digits out, leaving room for the dashes.
+	const __m128i s_Out0 = _mm_or_si128(
+		_mm_shuffle_epi8(s_Digits0, _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, -1, 8, 9, 10, 11, -1, 12, 13)),
+		_mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, '-', 0, 0, 0, 0, '-', 0, 0)
+	);
+
+	const __m128i s_Out1 = _mm_or_si128(
+		_mm_or_si128(
+			_mm_shuffle_epi8(s_Digits0, _mm_setr_epi8(14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+			_mm_shuffle_epi8(s_Digits1, _mm_setr_epi8(-1, -1, -1, 0, 1, 2, 3, -1, 4, 5, 6, 7, 8, 9, 10, 11))
+		),
+		_mm_setr_epi8(0, 0, '-', 0, 0, 0, 0, '-', 0, 0, 0, 0, 0, 0, 0, 0)
+	);
+
+	const int s_Out2 = _mm_cvtsi128_si32(_mm_srli_si128(s_Digits1, 12));
+
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(p_Buffer), s_Out0);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(p_Buffer + 16), s_Out1);
+	memcpy(p_Buffer + 32, &s_Out2, sizeof(s_Out2));
+}
+#endif
+
+static bool ParseDashed(const char* p_String, uint8_t* p_Bytes)
+{
+	if (!HasDashes(p_String))
+		return false;
+
+#if RL_X86
+	if (CpuFeatures::Get().SSSE3)
+		return ParseDashedSSSE3(p_String, p_Bytes);
+#endif
+
+	return ParseDashedScalar(p_String, p_Bytes);
+}
+
+static void FormatDashed(const uint8_t* p_Bytes, char* p_Buffer)
+{
+#if RL_X86
+	if (CpuFeatures::Get().SSSE3)
+		return FormatDashedSSSE3(p_Bytes, p_Buffer);
+#endif
+
+	FormatDashedScalar(p_Bytes, p_Buffer);
+}
+
+bool ZRepositoryID::FromString(std::string_view p_String, GuidFormat p_Format)
+{
+	uint8_t s_Bytes[16];
+	bool s_Valid = false;
+
+	if (p_Format == GuidFormat::Dashes)
+	{
+		s_Valid = p_String.size() == c_DashedLength && ParseDashed(p_String.data(), s_Bytes);
+	}
+	else if (p_Format == GuidFormat::NoDashes)
+	{
+		if (p_String.size() != 32)
+			return false;
+
+		// Put the dashes in so we can use the same parser.
+		char s_Dashed[c_DashedLength];
+		memcpy(s_Dashed, p_String.data(), 8);
+		memcpy(s_Dashed + 9, p_String.data() + 8, 4);
+		memcpy(s_Dashed + 14, p_String.data() + 12, 4);
+		memcpy(s_Dashed + 19, p_String.data() + 16, 4);
+		memcpy(s_Dashed + 24, p_String.data() + 20, 12);
+		s_Dashed[8] = s_Dashed[13] = s_Dashed[18] = s_Dashed[23] = '-';
+
+		s_Valid = ParseDashed(s_Dashed, s_Bytes);
+	}
+	else if (p_Format == GuidFormat::Brackets || p_Format == GuidFormat::Parentheses)
+	{
+		const char s_Open = p_Format == GuidFormat::Brackets ? '{' : '(';
+		const char s_Close = p_Format == GuidFormat::Brackets ? '}' : ')';
+
+		s_Valid = p_String.size() == c_DashedLength + 2 &&
+			p_String.front() == s_Open && p_String.back() == s_Close &&
+			ParseDashed(p_String.data() + 1, s_Bytes);
+	}
+
+	if (!s_Valid)
+		return false;
+
+	memcpy(&data1, s_Bytes, sizeof(s_Bytes));
+
+	return true;
+}
+
+size_t ZRepositoryID::ToChars(char* p_Buffer, GuidFormat p_Format) const
+{
+	const auto* s_Bytes = reinterpret_cast<const uint8_t*>(&data1);
+
+	if (p_Format == GuidFormat::NoDashes)
+	{
+		char s_Dashed[c_DashedLength];
+		FormatDashed(s_Bytes, s_Dashed);
+
+		memcpy(p_Buffer, s_Dashed, 8);
+		memcpy(p_Buffer + 8, s_Dashed + 9, 4);
+		memcpy(p_Buffer + 12, s_Dashed + 14, 4);
+		memcpy(p_Buffer + 16, s_Dashed + 19, 4);
+		memcpy(p_Buffer + 20, s_Dashed + 24, 12);
+
+		return 32;
+	}
+
+	if (p_Format == GuidFormat::Brackets || p_Format == GuidFormat::Parentheses)
+	{
+		p_Buffer[0] = p_Format == GuidFormat::Brackets ? '{' : '(';
+		FormatDashed(s_Bytes, p_Buffer + 1);
+		p_Buffer[c_DashedLength + 1] = p_Format == GuidFormat::Brackets ? '}' : ')';
+
+		return c_DashedLength + 2;
+	}
+
+	FormatDashed(s_Bytes, p_Buffer);
+	return c_DashedLength;
+}
 
 void ZRepositoryID::WriteJson(void* p_Object, std::ostream& p_Stream)
 {
-	auto* s_Object = static_cast<ZRepositoryID*>(p_Object);
-	p_Stream << simdjson::as_json_string(s_Object->ToString());
+	WriteSimpleJson(p_Object, p_Stream);
 }
 
 void ZRepositoryID::WriteSimpleJson(void* p_Object, std::ostream& p_Stream)
 {
 	auto* s_Object = static_cast<ZRepositoryID*>(p_Object);
-	p_Stream << simdjson::as_json_string(s_Object->ToString());
+
+	// GUIDs never need escaping, so we can write them out directly.
+	char s_Json[c_DashedLength + 2];
+	s_Json[0] = '"';
+	s_Object->ToChars(s_Json + 1);
+	s_Json[c_DashedLength + 1] = '"';
+
+	p_Stream.write(s_Json, sizeof(s_Json));
 }
 
 void ZRepositoryID::FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target)
 {
-	auto s_StringView = std::string_view(p_Document);
-	auto s_String = std::string(s_StringView.data(), s_StringView.size());
+	reinterpret_cast<ZRepositoryID*>(p_Target)->FromString(std::string_view(p_Document));
+}
 
-	*reinterpret_cast<ZRepositoryID*>(p_Target) = s_String;
+void ZRepositoryID::WriteCbor(void* p_Object, CborWriter& p_Writer)
+{
+	char s_Guid[c_DashedLength];
+	static_cast<ZRepositoryID*>(p_Object)->ToChars(s_Guid);
+
+	p_Writer.WriteText(std::string_view(s_Guid, c_DashedLength));
+}
+
+void ZRepositoryID::FromCbor(CborReader& p_Reader, void* p_Target)
+{
+	reinterpret_cast<ZRepositoryID*>(p_Target)->FromString(p_Reader.ReadText());
 }
 
 void ZRepositoryID::Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset)
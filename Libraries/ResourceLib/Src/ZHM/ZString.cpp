@@ -1,6 +1,8 @@
 #include "ZString.h"
 
 #include <ZHM/ZHMSerializer.h>
+#include <ZHM/ZStringPool.h>
+#include <Util/Cbor.h>
 
 #include "ZHMInt.h"
 #include "External/simdjson_helpers.h"
@@ -19,17 +21,33 @@ void ZString::WriteSimpleJson(void* p_Object, std::ostream& p_Stream)
 
 void ZString::FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target)
 {
-	ZString s_String = std::string_view(p_Document);
-	*reinterpret_cast<ZString*>(p_Target) = s_String;
+	reinterpret_cast<ZString*>(p_Target)->SetInterned(std::string_view(p_Document));
+}
+
+void ZString::WriteCbor(void* p_Object, CborWriter& p_Writer)
+{
+	p_Writer.WriteText(static_cast<ZString*>(p_Object)->string_view());
+}
+
+void ZString::FromCbor(CborReader& p_Reader, void* p_Target)
+{
+	reinterpret_cast<ZString*>(p_Target)->SetInterned(p_Reader.ReadText());
 }
 
 void ZString::Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset)
 {
 	const auto* s_Object = reinterpret_cast<ZString*>(p_Object);
 
+	// Identical strings can share the same data.
+	const auto s_ExistingOffset = p_Serializer.GetExistingPayload(ZHMSerializer::PayloadKind::String, 1, s_Object->string_view());
+
 	uintptr_t s_StrDataOffset;
 
-	if (p_Serializer.InCompatibilityMode())
+	if (s_ExistingOffset)
+	{
+		s_StrDataOffset = *s_ExistingOffset;
+	}
+	else if (p_Serializer.InCompatibilityMode())
 	{
 		// In compatibility mode we prepend a 32-bit integer with the length of the
 		// string (including the null terminator).
@@ -45,11 +63,16 @@ void ZString::Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_
 		s_StrDataOffset = p_Serializer.WriteMemory(const_cast<char*>(s_Object->m_pChars), s_Object->size(), alignof(char*));
 	}
 
-	// We append a null terminator here since it looks like some parts of the engine
-	// will just ignore the fact that ZStrings come with length specified and just read
-	// till they encounter a null terminator, resulting in all sorts of weird issues.
-	uint8_t s_NullTerminator = 0x00;
-	p_Serializer.WriteMemoryUnaligned(&s_NullTerminator, sizeof(s_NullTerminator));
+	if (!s_ExistingOffset)
+	{
+		// We append a null terminator here since it looks like some parts of the engine
+		// will just ignore the fact that ZStrings come with length specified and just read
+		// till they encounter a null terminator, resulting in all sorts of weird issues.
+		uint8_t s_NullTerminator = 0x00;
+		p_Serializer.WriteMemoryUnaligned(&s_NullTerminator, sizeof(s_NullTerminator));
+
+		p_Serializer.RegisterPayload(ZHMSerializer::PayloadKind::String, 1, s_Object->string_view(), s_StrDataOffset);
+	}
 
 	// Some strings can have the allocated flag, so we rewrite the length without it
 	// cause otherwise the game will try to do some weird re-allocation shit and crash spectacularly.
@@ -70,3 +93,14 @@ void ZString::Destroy(void* p_Object)
 	auto* s_Object = reinterpret_cast<ZString*>(p_Object);
 	s_Object->~ZString();
 }
+
+void ZString::SetInterned(std::string_view p_Str)
+{
+	if (auto* s_Pool = ZStringPool::Current())
+	{
+		SetNonOwned(s_Pool->Intern(p_Str));
+		return;
+	}
+
+	*this = ZString(p_Str);
+}
@@ -10,6 +10,8 @@
 #include <Util/PortableIntrinsics.h>
 
 class ZHMSerializer;
+class CborWriter;
+class CborReader;
 
 class ZString
 {
@@ -17,6 +19,8 @@ public:
 	static void WriteJson(void* p_Object, std::ostream& p_Stream);
 	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
 	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
+	static void WriteCbor(void* p_Object, CborWriter& p_Writer);
+	static void FromCbor(CborReader& p_Reader, void* p_Target);
 	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
 	static bool Equals(void* p_Left, void* p_Right);
 	static void Destroy(void* p_Object);
@@ -76,9 +80,13 @@ public:
 
 	ZString& operator=(const ZString& p_Other)
 	{
+		if (this == &p_Other)
+			return *this;
+
 		if (is_allocated() && size() > 0 && m_pChars)
 		{
 			c_aligned_free(const_cast<char*>(m_pChars));
+			SetEmptyStr();
 		}
 
 		if (p_Other.is_allocated())
@@ -106,6 +114,32 @@ public:
 		m_nLength = 0x80000000;
 		m_pChars = "";
 	}
+
+	/**
+	 * Points this string at [p_Str] without taking ownership of it, so [p_Str] must outlive it and every copy of it.
+	 */
+	void SetNonOwned(std::string_view p_Str)
+	{
+		if (is_allocated() && size() > 0 && m_pChars)
+		{
+			c_aligned_free(const_cast<char*>(m_pChars));
+		}
+
+		if (p_Str.empty())
+		{
+			SetEmptyStr();
+			return;
+		}
+
+		m_nLength = static_cast<uint32_t>(p_Str.size()) | 0x80000000;
+		m_pChars = p_Str.data();
+	}
+
+	/**
+	 * Sets this string to the pooled copy of [p_Str] if there's a current ZStringPool,
+	 * or to its own copy of it otherwise.
+	 */
+	void SetInterned(std::string_view p_Str);
 	
 	inline std::string_view string_view() const
 	{
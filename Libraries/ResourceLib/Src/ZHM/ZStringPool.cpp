@@ -0,0 +1,123 @@
+#include "ZStringPool.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <Util/PortableIntrinsics.h>
+
+static thread_local ZStringPool* g_CurrentStringPool = nullptr;
+
+ZStringPool::ZStringPool() : m_Previous(g_CurrentStringPool)
+{
+	g_CurrentStringPool = this;
+}
+
+ZStringPool::~ZStringPool()
+{
+	g_CurrentStringPool = m_Previous;
+
+	for (auto* s_Block : m_Blocks)
+		c_aligned_free(s_Block);
+}
+
+ZStringPool* ZStringPool::Current()
+{
+	return g_CurrentStringPool;
+}
+
+std::string_view ZStringPool::Intern(std::string_view p_String)
+{
+	if (const auto it = m_Strings.find(p_String); it != m_Strings.end())
+		return *it;
+
+	char* s_Chars = AllocateChars(p_String.size() + 1);
+	memcpy(s_Chars, p_String.data(), p_String.size());
+	s_Chars[p_String.size()] = '\0';
+
+	const std::string_view s_Interned(s_Chars, p_String.size());
+	m_Strings.insert(s_Interned);
+
+	return s_Interned;
+}
+
+char* ZStringPool::AllocateChars(size_t p_Size)
+{
+	// Strings are kept pointer-aligned, like the ones ZString allocates itself.
+	const size_t s_AlignedSize = (p_Size + alignof(char*) - 1) & ~(alignof(char*) - 1);
+
+	// Big strings get a block of their own, so they don't waste the rest of the current one.
+	if (s_AlignedSize > c_BlockSize / 4)
+	{
+		auto* s_Block = static_cast<char*>(c_aligned_alloc(s_AlignedSize, alignof(char*)));
+		m_Blocks.push_back(s_Block);
+		return s_Block;
+	}
+
+	if (s_AlignedSize > m_BlockRemaining)
+	{
+		m_BlockCursor = static_cast<char*>(c_aligned_alloc(c_BlockSize, alignof(char*)));
+		m_BlockRemaining = c_BlockSize;
+		m_Blocks.push_back(m_BlockCursor);
+	}
+
+	char* s_Chars = m_BlockCursor;
+	m_BlockCursor += s_AlignedSize;
+	m_BlockRemaining -= s_AlignedSize;
+
+	return s_Chars;
+}
+
+void* ZStringPool::AllocateValue(size_t p_Size, size_t p_Alignment)
+{
+	if (p_Size == 0 || p_Size > c_MaxValueSize || p_Alignment > c_MaxValueAlignment)
+		return nullptr;
+
+	uintptr_t s_Value = (m_ValueCursor + p_Alignment - 1) & ~(p_Alignment - 1);
+
+	if (m_ValueCursor == 0 || s_Value + p_Size > m_ValueBlockEnd)
+	{
+		// Blocks are zeroed up front, so values don't need to be zeroed one by one.
+		auto* s_Block = c_aligned_alloc(c_ValueBlockSize, c_MaxValueAlignment);
+		memset(s_Block, 0x00, c_ValueBlockSize);
+		m_Blocks.push_back(s_Block);
+
+		const auto s_BlockStart = reinterpret_cast<uintptr_t>(s_Block);
+		m_ValueBlocks.insert(std::ranges::upper_bound(m_ValueBlocks, s_BlockStart), s_BlockStart);
+
+		m_ValueBlockEnd = s_BlockStart + c_ValueBlockSize;
+		s_Value = s_BlockStart;
+	}
+
+	m_ValueCursor = s_Value + p_Size;
+
+	return reinterpret_cast<void*>(s_Value);
+}
+
+bool ZStringPool::OwnsValue(const void* p_Value) const
+{
+	const auto s_Address = reinterpret_cast<uintptr_t>(p_Value);
+	const auto it = std::ranges::upper_bound(m_ValueBlocks, s_Address);
+
+	if (it != m_ValueBlocks.begin() && s_Address < *std::prev(it) + c_ValueBlockSize)
+		return true;
+
+	return m_Previous && m_Previous->OwnsValue(p_Value);
+}
+
+void ZStringPool::Adopt(ZStringPool& p_Other)
+{
+	m_Strings.merge(p_Other.m_Strings);
+	p_Other.m_Strings.clear();
+
+	m_Blocks.insert(m_Blocks.end(), p_Other.m_Blocks.begin(), p_Other.m_Blocks.end());
+	p_Other.m_Blocks.clear();
+	p_Other.m_BlockCursor = nullptr;
+	p_Other.m_BlockRemaining = 0;
+
+	for (const auto s_BlockStart : p_Other.m_ValueBlocks)
+		m_ValueBlocks.insert(std::ranges::upper_bound(m_ValueBlocks, s_BlockStart), s_BlockStart);
+
+	p_Other.m_ValueBlocks.clear();
+	p_Other.m_ValueCursor = 0;
+	p_Other.m_ValueBlockEnd = 0;
+}
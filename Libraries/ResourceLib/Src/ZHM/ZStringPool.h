@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * Keeps a single immutable copy of every distinct string parsed while generating a resource, so that
+ * the entity names, type names, resource paths, etc. that repeat thousands of times in a resource
+ * don't each get their own allocation.
+ *
+ * Creating a pool makes it the current one for the calling thread until it's destroyed. ZStrings parsed
+ * from json while a pool is current point into it without owning their data, so the pool must outlive
+ * every object parsed while it was current.
+ *
+ * The pool also hands out memory for the small values of ZVariants parsed while it's current, so that
+ * every bool or int property value doesn't need an allocation of its own.
+ */
+class ZStringPool
+{
+public:
+	ZStringPool();
+	~ZStringPool();
+
+	ZStringPool(const ZStringPool&) = delete;
+	ZStringPool& operator=(const ZStringPool&) = delete;
+
+	static ZStringPool* Current();
+
+	/**
+	 * Returns the pooled copy of [p_String], adding it if it's not already there.
+	 * The returned data is null-terminated and stays valid for the lifetime of the pool.
+	 */
+	std::string_view Intern(std::string_view p_String);
+
+	/**
+	 * Returns zeroed memory for a value of [p_Size] bytes that stays valid for the lifetime of the pool,
+	 * or [nullptr] if the value is too big to be pooled and should be allocated by the caller.
+	 */
+	void* AllocateValue(size_t p_Size, size_t p_Alignment);
+
+	/**
+	 * Checks whether [p_Value] was returned by [AllocateValue] of this pool or of any pool that was current
+	 * when this one was created, in which case it must not be freed.
+	 */
+	bool OwnsValue(const void* p_Value) const;
+
+	/**
+	 * Takes over the strings and values of [p_Other], so that everything parsed while it was current stays
+	 * valid for the lifetime of this pool instead. This is used to collect the pools of worker threads that
+	 * parse parts of a resource. [p_Other] is left empty.
+	 */
+	void Adopt(ZStringPool& p_Other);
+
+private:
+	char* AllocateChars(size_t p_Size);
+
+private:
+	static constexpr size_t c_BlockSize = 64 * 1024;
+	static constexpr size_t c_ValueBlockSize = 256 * 1024;
+	static constexpr size_t c_MaxValueSize = 64;
+	static constexpr size_t c_MaxValueAlignment = 16;
+
+	std::unordered_set<std::string_view> m_Strings;
+	std::vector<void*> m_Blocks;
+	char* m_BlockCursor = nullptr;
+	size_t m_BlockRemaining = 0;
+
+	// Start addresses of the value blocks, kept sorted for [OwnsValue].
+	std::vector<uintptr_t> m_ValueBlocks;
+	uintptr_t m_ValueCursor = 0;
+	uintptr_t m_ValueBlockEnd = 0;
+	ZStringPool* m_Previous;
+};
@@ -3,13 +3,35 @@
 #include "ZString.h"
 #include "ZHMTypeInfo.h"
 #include "ZHMSerializer.h"
+#include "ZStringPool.h"
 #include "Util/PortableIntrinsics.h"
+#include "Util/Cbor.h"
 
 #include <iostream>
+#include <optional>
 #include <unordered_set>
 
 #include "External/simdjson_helpers.h"
 
+static void* AllocateValue(IZHMTypeInfo* p_Type)
+{
+	const auto s_Size = p_Type->Size();
+	const auto s_Alignment = p_Type->Alignment();
+
+	// Small values (most property values are bools, ints, floats, etc.) come from the string pool
+	// of the generation, if there is one, instead of getting an allocation of their own.
+	auto* s_Pool = ZStringPool::Current();
+	void* s_Ptr = s_Pool ? s_Pool->AllocateValue(s_Size, s_Alignment) : nullptr;
+
+	if (!s_Ptr)
+	{
+		s_Ptr = c_aligned_alloc(s_Size, s_Alignment);
+		memset(s_Ptr, 0x00, s_Size);
+	}
+
+	return s_Ptr;
+}
+
 void ZVariant::WriteSimpleJson(void* p_Object, std::ostream& p_Stream)
 {
 	auto s_Object = static_cast<ZVariant*>(p_Object);
@@ -23,12 +45,12 @@ void ZVariant::WriteSimpleJson(void* p_Object, std::ostream& p_Stream)
 
 	if (s_Object->m_pTypeID->IsDummy())
 	{
-		fprintf(stderr, "[WARNING] Could not write ZVariant with unknown type '%s'.\n", s_Object->m_pTypeID->TypeName().c_str());
+		fprintf(stderr, "[WARNING] Could not write ZVariant with unknown type '%s'.\n", std::string(s_Object->m_pTypeID->TypeName()).c_str());
 		p_Stream << "null";
 		return;
 	}
 
-	p_Stream << "{\"$type\":" << simdjson::as_json_string(s_Object->m_pTypeID->TypeName()) << ",\"$val\"" << ":";
+	p_Stream << "{\"$type\":" << s_Object->m_pTypeID->JsonTypeName() << ",\"$val\":";
 
 	s_Object->m_pTypeID->WriteSimpleJson(s_Object->m_pData, p_Stream);
 	
@@ -37,11 +59,13 @@ void ZVariant::WriteSimpleJson(void* p_Object, std::ostream& p_Stream)
 
 void ZVariant::FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target)
 {
+	static IZHMTypeInfo* s_VoidType = ZHMTypeInfo::GetTypeByName(std::string("void"));
+
 	auto* s_Variant = reinterpret_cast<ZVariant*>(p_Target);
 
 	if (p_Document.type().value() == simdjson::ondemand::json_type::null)
 	{
-		s_Variant->m_pTypeID = ZHMTypeInfo::GetTypeByName(std::string_view("void"));
+		s_Variant->m_pTypeID = s_VoidType;
 		s_Variant->m_pData = nullptr;
 	}
 	else
@@ -56,14 +80,14 @@ void ZVariant::FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Targ
 		}
 		else
 		{
-			if (s_Variant->m_pTypeID->TypeName() == "void")
+			if (s_Variant->m_pTypeID == s_VoidType)
 			{
 				s_Variant->m_pData = nullptr;
 			}
 			else
 			{
-				auto s_Ptr = c_aligned_alloc(s_Variant->m_pTypeID->Size(), s_Variant->m_pTypeID->Alignment());
-				memset(s_Ptr, 0x00, s_Variant->m_pTypeID->Size());
+				void* s_Ptr = AllocateValue(s_Variant->m_pTypeID);
+
 				s_Variant->m_pTypeID->CreateFromJson(p_Document["$val"], s_Ptr);
 				s_Variant->m_pData = s_Ptr;
 			}
@@ -71,6 +95,111 @@ void ZVariant::FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Targ
 	}
 }
 
+void ZVariant::WriteCbor(void* p_Object, CborWriter& p_Writer)
+{
+	auto s_Object = static_cast<ZVariant*>(p_Object);
+
+	if (s_Object->m_pTypeID == nullptr)
+	{
+		fprintf(stderr, "[WARNING] Could not write ZVariant with null type\n");
+		p_Writer.WriteNull();
+		return;
+	}
+
+	if (s_Object->m_pTypeID->IsDummy())
+	{
+		fprintf(stderr, "[WARNING] Could not write ZVariant with unknown type '%s'.\n", std::string(s_Object->m_pTypeID->TypeName()).c_str());
+		p_Writer.WriteNull();
+		return;
+	}
+
+	p_Writer.BeginMap(2);
+
+	p_Writer.WriteText("$type");
+	p_Writer.WriteText(s_Object->m_pTypeID->TypeName());
+
+	p_Writer.WriteText("$val");
+	s_Object->m_pTypeID->WriteCbor(s_Object->m_pData, p_Writer);
+}
+
+void ZVariant::FromCbor(CborReader& p_Reader, void* p_Target)
+{
+	static IZHMTypeInfo* s_VoidType = ZHMTypeInfo::GetTypeByName(std::string("void"));
+
+	auto* s_Variant = reinterpret_cast<ZVariant*>(p_Target);
+
+	if (p_Reader.TryReadNull())
+	{
+		s_Variant->m_pTypeID = s_VoidType;
+		s_Variant->m_pData = nullptr;
+		return;
+	}
+
+	const auto s_ReadValue = [&](std::string_view p_TypeName)
+	{
+		s_Variant->m_pTypeID = ZHMTypeInfo::GetTypeByName(p_TypeName);
+
+		if (s_Variant->m_pTypeID->IsDummy())
+		{
+			std::cerr << "[ERROR] Could not find TypeInfo for ZVariant of type '" << p_TypeName << "'." << std::endl;
+			p_Reader.Skip();
+		}
+		else if (s_Variant->m_pTypeID == s_VoidType)
+		{
+			s_Variant->m_pData = nullptr;
+			p_Reader.Skip();
+		}
+		else
+		{
+			void* s_Ptr = AllocateValue(s_Variant->m_pTypeID);
+
+			s_Variant->m_pTypeID->CreateFromCbor(p_Reader, s_Ptr);
+			s_Variant->m_pData = s_Ptr;
+		}
+	};
+
+	auto s_Map = p_Reader.ReadMap();
+
+	std::string_view s_TypeName;
+	std::optional<size_t> s_ValuePosition;
+	bool s_ValueRead = false;
+
+	while (p_Reader.Next(s_Map))
+	{
+		const std::string_view s_Key = p_Reader.ReadText();
+
+		if (s_Key == "$type")
+		{
+			s_TypeName = p_Reader.ReadText();
+		}
+		else if (s_Key == "$val" && !s_TypeName.empty())
+		{
+			s_ReadValue(s_TypeName);
+			s_ValueRead = true;
+		}
+		else
+		{
+			// A value that comes before its type is read once the type is known.
+			if (s_Key == "$val")
+				s_ValuePosition = p_Reader.Position();
+
+			p_Reader.Skip();
+		}
+	}
+
+	if (s_ValueRead)
+		return;
+
+	if (s_TypeName.empty() || !s_ValuePosition)
+		throw std::runtime_error("ZVariant must have both a $type and a $val.");
+
+	const auto s_EndPosition = p_Reader.Position();
+
+	p_Reader.Seek(*s_ValuePosition);
+	s_ReadValue(s_TypeName);
+	p_Reader.Seek(s_EndPosition);
+}
+
 void ZVariant::Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset)
 {
 	auto* s_Object = reinterpret_cast<ZVariant*>(p_Object);
@@ -145,5 +274,10 @@ ZVariant::~ZVariant()
 		return;
 
 	m_pTypeID->DestroyObject(m_pData);
+
+	// Values allocated from a string pool are freed along with it.
+	if (auto* s_Pool = ZStringPool::Current(); s_Pool && s_Pool->OwnsValue(m_pData))
+		return;
+
 	c_aligned_free(m_pData);
 }
\ No newline at end of file
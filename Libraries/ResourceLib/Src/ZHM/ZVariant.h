@@ -8,12 +8,16 @@
 class IZHMTypeInfo;
 class ZHMSerializer;
 class ZString;
+class CborWriter;
+class CborReader;
 
 class ZVariant
 {
 public:
 	static void WriteSimpleJson(void* p_Object, std::ostream& p_Stream);
 	static void FromSimpleJson(simdjson::ondemand::value p_Document, void* p_Target);
+	static void WriteCbor(void* p_Object, CborWriter& p_Writer);
+	static void FromCbor(CborReader& p_Reader, void* p_Target);
 	static void Serialize(void* p_Object, ZHMSerializer& p_Serializer, zhmptr_t p_OwnOffset);
 	static bool Equals(void* p_Left, void* p_Right);
 	static void Destroy(void* p_Object);
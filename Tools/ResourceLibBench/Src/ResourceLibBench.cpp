@@ -0,0 +1,626 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <fstream>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <new>
+
+#include <ResourceLib_HM3.h>
+#include <ResourceLib_HM2.h>
+#include <ResourceLib_HM2016.h>
+#include <ResourceLib_KNT.h>
+
+#if _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#include <psapi.h>
+#define EXECUTABLE "ResourceLibBench.exe"
+#define SAMPLE_PATH "C:\\path\\to\\samples"
+#else
+#include <sys/resource.h>
+#define EXECUTABLE "./ResourceLibBench"
+#define SAMPLE_PATH "/path/to/samples"
+#endif
+
+// Heap allocation counters. Replacing the global operator new here also catches allocations
+// made inside the ResourceLib shared objects on platforms with symbol interposition (ELF / Mach-O).
+// On Windows each DLL has its own CRT, so only allocations made through the ResourceLib
+// allocator are counted there.
+static std::atomic<uint64_t> g_HeapAllocCount = 0;
+static std::atomic<uint64_t> g_HeapAllocBytes = 0;
+
+#if !_WIN32
+void* operator new(size_t p_Size)
+{
+	g_HeapAllocCount.fetch_add(1, std::memory_order_relaxed);
+	g_HeapAllocBytes.fetch_add(p_Size, std::memory_order_relaxed);
+
+	if (void* s_Ptr = std::malloc(p_Size == 0 ? 1 : p_Size))
+		return s_Ptr;
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p_Ptr) noexcept
+{
+	std::free(p_Ptr);
+}
+
+void operator delete(void* p_Ptr, size_t) noexcept
+{
+	std::free(p_Ptr);
+}
+#endif
+
+// Allocations routed through the ResourceLib allocator (c_aligned_alloc).
+static std::atomic<uint64_t> g_RlAllocCount = 0;
+static std::atomic<uint64_t> g_RlAllocBytes = 0;
+
+/**
+ * Wraps the allocator of a single game library and counts every allocation made through it.
+ * Each game gets its own instantiation since the allocator interface has no user data pointer.
+ */
+template <int Game>
+struct CountingAllocator
+{
+	inline static Allocator* Upstream = nullptr;
+
+	inline static Allocator Instance {
+		.Alloc = [](size_t p_Size, size_t p_Alignment)
+		{
+			g_RlAllocCount.fetch_add(1, std::memory_order_relaxed);
+			g_RlAllocBytes.fetch_add(p_Size, std::memory_order_relaxed);
+			return Upstream->Alloc(p_Size, p_Alignment);
+		},
+		.Free = [](void* p_Ptr)
+		{
+			Upstream->Free(p_Ptr);
+		},
+	};
+};
+
+struct GameLibrary
+{
+	const char* Name;
+	ResourceConverter* (*GetConverterForResource)(const char*);
+	ResourceGenerator* (*GetGeneratorForResource)(const char*);
+	ResourceTypesArray* (*GetSupportedResourceTypes)();
+	void (*FreeSupportedResourceTypes)(ResourceTypesArray*);
+	Allocator* (*GetAllocator)();
+	void (*SetAllocator)(Allocator*);
+	ResourceMem* (*SynthesizeResource)(const char*, const char*, const SyntheticResourceOptions*);
+	void (*FreeResourceMem)(ResourceMem*);
+	Allocator* CountingAllocator;
+	Allocator** UpstreamAllocator;
+};
+
+#define GAME_LIBRARY(Prefix, Index) \
+	GameLibrary { \
+		#Prefix, \
+		Prefix##_GetConverterForResource, \
+		Prefix##_GetGeneratorForResource, \
+		Prefix##_GetSupportedResourceTypes, \
+		Prefix##_FreeSupportedResourceTypes, \
+		Prefix##_GetAllocator, \
+		Prefix##_SetAllocator, \
+		Prefix##_SynthesizeResource, \
+		Prefix##_FreeResourceMem, \
+		&CountingAllocator<Index>::Instance, \
+		&CountingAllocator<Index>::Upstream, \
+	}
+
+static GameLibrary g_Games[] = {
+	GAME_LIBRARY(HM2016, 0),
+	GAME_LIBRARY(HM2, 1),
+	GAME_LIBRARY(HM3, 2),
+	GAME_LIBRARY(KNT, 3),
+};
+
+struct BenchSample
+{
+	std::string Name;
+	std::vector<char> Data;
+};
+
+struct BenchResult
+{
+	std::string Game;
+	std::string ResourceType;
+	size_t SampleCount = 0;
+	size_t Failures = 0;
+	uint64_t ResourceBytes = 0;
+	uint64_t JsonBytes = 0;
+	uint64_t Conversions = 0;
+	double ToJsonSeconds = 0.0;
+	double FromJsonSeconds = 0.0;
+	uint64_t ToJsonRlAllocs = 0;
+	uint64_t ToJsonHeapAllocs = 0;
+	uint64_t ToJsonAllocBytes = 0;
+	uint64_t FromJsonRlAllocs = 0;
+	uint64_t FromJsonHeapAllocs = 0;
+	uint64_t FromJsonAllocBytes = 0;
+	uint64_t PeakRssKb = 0;
+};
+
+struct AllocSnapshot
+{
+	uint64_t RlCount;
+	uint64_t RlBytes;
+	uint64_t HeapCount;
+	uint64_t HeapBytes;
+
+	static AllocSnapshot Take()
+	{
+		return {
+			g_RlAllocCount.load(std::memory_order_relaxed),
+			g_RlAllocBytes.load(std::memory_order_relaxed),
+			g_HeapAllocCount.load(std::memory_order_relaxed),
+			g_HeapAllocBytes.load(std::memory_order_relaxed),
+		};
+	}
+};
+
+static void ResetPeakRss()
+{
+#if __linux__
+	// Writing 5 to clear_refs resets the VmHWM high water mark (Linux 4.0+).
+	// Not fatal if it fails, we'll just report the process-wide peak instead.
+	if (FILE* s_File = fopen("/proc/self/clear_refs", "w"))
+	{
+		fputs("5", s_File);
+		fclose(s_File);
+	}
+#endif
+}
+
+static uint64_t GetPeakRssKb()
+{
+#if _WIN32
+	PROCESS_MEMORY_COUNTERS s_Counters {};
+
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &s_Counters, sizeof(s_Counters)))
+		return s_Counters.PeakWorkingSetSize / 1024;
+
+	return 0;
+#else
+#if __linux__
+	if (FILE* s_File = fopen("/proc/self/status", "r"))
+	{
+		char s_Line[256];
+		uint64_t s_PeakKb = 0;
+
+		while (fgets(s_Line, sizeof(s_Line), s_File))
+		{
+			if (strncmp(s_Line, "VmHWM:", 6) == 0)
+			{
+				s_PeakKb = strtoull(s_Line + 6, nullptr, 10);
+				break;
+			}
+		}
+
+		fclose(s_File);
+
+		if (s_PeakKb != 0)
+			return s_PeakKb;
+	}
+#endif
+
+	rusage s_Usage {};
+	getrusage(RUSAGE_SELF, &s_Usage);
+
+#if __APPLE__
+	return s_Usage.ru_maxrss / 1024;
+#else
+	return s_Usage.ru_maxrss;
+#endif
+#endif
+}
+
+static bool ReadFile(const std::filesystem::path& p_Path, std::vector<char>& p_Data)
+{
+	std::ifstream s_FileStream(p_Path, std::ios::in | std::ios::binary);
+
+	if (!s_FileStream)
+		return false;
+
+	p_Data.resize(file_size(p_Path));
+	s_FileStream.read(p_Data.data(), p_Data.size());
+
+	return static_cast<bool>(s_FileStream);
+}
+
+static void LoadSamples(const std::filesystem::path& p_GameDir, const std::string& p_ResourceType, std::vector<BenchSample>& p_Samples)
+{
+	if (!is_directory(p_GameDir))
+		return;
+
+	const std::string s_Extension = "." + p_ResourceType;
+	std::vector<std::filesystem::path> s_Paths;
+
+	for (const auto& s_Entry : std::filesystem::recursive_directory_iterator(p_GameDir))
+	{
+		if (!s_Entry.is_regular_file())
+			continue;
+
+		std::string s_EntryExtension = s_Entry.path().extension().string();
+		std::transform(s_EntryExtension.begin(), s_EntryExtension.end(), s_EntryExtension.begin(), [](unsigned char c) { return std::toupper(c); });
+
+		if (s_EntryExtension == s_Extension)
+			s_Paths.push_back(s_Entry.path());
+	}
+
+	std::sort(s_Paths.begin(), s_Paths.end());
+
+	for (const auto& s_Path : s_Paths)
+	{
+		BenchSample s_Sample;
+		s_Sample.Name = s_Path.string();
+
+		if (!ReadFile(s_Path, s_Sample.Data))
+		{
+			fprintf(stderr, "[WARNING] Could not read sample '%s'.\n", s_Sample.Name.c_str());
+			continue;
+		}
+
+		p_Samples.push_back(std::move(s_Sample));
+	}
+}
+
+static void SynthesizeSample(const GameLibrary& p_Game, const std::string& p_ResourceType, const std::filesystem::path& p_TypesJsonPath, const SyntheticResourceOptions& p_Options, std::vector<BenchSample>& p_Samples)
+{
+	auto* s_Resource = p_Game.SynthesizeResource(p_ResourceType.c_str(), p_TypesJsonPath.string().c_str(), &p_Options);
+
+	if (s_Resource == nullptr)
+	{
+		fprintf(stderr, "[WARNING] Could not synthesize a %s %s resource.\n", p_Game.Name, p_ResourceType.c_str());
+		return;
+	}
+
+	BenchSample s_Sample;
+	s_Sample.Name = "synthetic:" + std::to_string(p_Options.Seed);
+
+	const auto* s_Data = static_cast<const char*>(s_Resource->ResourceData);
+	s_Sample.Data.assign(s_Data, s_Data + s_Resource->DataSize);
+
+	p_Game.FreeResourceMem(s_Resource);
+
+	p_Samples.push_back(std::move(s_Sample));
+}
+
+static BenchResult BenchResourceType(const GameLibrary& p_Game, const std::string& p_ResourceType, const std::vector<BenchSample>& p_Samples, int p_Iterations)
+{
+	BenchResult s_Result;
+	s_Result.Game = p_Game.Name;
+	s_Result.ResourceType = p_ResourceType;
+	s_Result.SampleCount = p_Samples.size();
+
+	auto* s_Converter = p_Game.GetConverterForResource(p_ResourceType.c_str());
+	auto* s_Generator = p_Game.GetGeneratorForResource(p_ResourceType.c_str());
+
+	ResetPeakRss();
+
+	for (const auto& s_Sample : p_Samples)
+	{
+		const auto& s_ResourceData = s_Sample.Data;
+
+		try
+		{
+			for (int i = 0; i < p_Iterations; ++i)
+			{
+				// Binary -> JSON.
+				const auto s_ToJsonAllocs = AllocSnapshot::Take();
+				const auto s_ToJsonStart = std::chrono::steady_clock::now();
+
+				auto* s_Json = s_Converter->FromMemoryToJsonString(s_ResourceData.data(), s_ResourceData.size());
+
+				const auto s_ToJsonEnd = std::chrono::steady_clock::now();
+				const auto s_ToJsonAllocsEnd = AllocSnapshot::Take();
+
+				if (s_Json == nullptr)
+				{
+					fprintf(stderr, "[WARNING] Failed to convert sample '%s' to json.\n", s_Sample.Name.c_str());
+					++s_Result.Failures;
+					break;
+				}
+
+				// JSON -> binary.
+				const auto s_FromJsonAllocs = AllocSnapshot::Take();
+				const auto s_FromJsonStart = std::chrono::steady_clock::now();
+
+				auto* s_Resource = s_Generator->FromJsonStringToResourceMem(s_Json->JsonData, s_Json->StrSize, false);
+
+				const auto s_FromJsonEnd = std::chrono::steady_clock::now();
+				const auto s_FromJsonAllocsEnd = AllocSnapshot::Take();
+
+				if (s_Resource == nullptr)
+				{
+					fprintf(stderr, "[WARNING] Failed to generate sample '%s' from json.\n", s_Sample.Name.c_str());
+					s_Converter->FreeJsonString(s_Json);
+					++s_Result.Failures;
+					break;
+				}
+
+				s_Result.ResourceBytes += s_ResourceData.size();
+				s_Result.JsonBytes += s_Json->StrSize;
+				++s_Result.Conversions;
+
+				s_Result.ToJsonSeconds += std::chrono::duration<double>(s_ToJsonEnd - s_ToJsonStart).count();
+				s_Result.FromJsonSeconds += std::chrono::duration<double>(s_FromJsonEnd - s_FromJsonStart).count();
+
+				s_Result.ToJsonRlAllocs += s_ToJsonAllocsEnd.RlCount - s_ToJsonAllocs.RlCount;
+				s_Result.ToJsonHeapAllocs += s_ToJsonAllocsEnd.HeapCount - s_ToJsonAllocs.HeapCount;
+				s_Result.ToJsonAllocBytes += (s_ToJsonAllocsEnd.RlBytes - s_ToJsonAllocs.RlBytes) + (s_ToJsonAllocsEnd.HeapBytes - s_ToJsonAllocs.HeapBytes);
+
+				s_Result.FromJsonRlAllocs += s_FromJsonAllocsEnd.RlCount - s_FromJsonAllocs.RlCount;
+				s_Result.FromJsonHeapAllocs += s_FromJsonAllocsEnd.HeapCount - s_FromJsonAllocs.HeapCount;
+				s_Result.FromJsonAllocBytes += (s_FromJsonAllocsEnd.RlBytes - s_FromJsonAllocs.RlBytes) + (s_FromJsonAllocsEnd.HeapBytes - s_FromJsonAllocs.HeapBytes);
+
+				s_Generator->FreeResourceMem(s_Resource);
+				s_Converter->FreeJsonString(s_Json);
+			}
+		}
+		catch (std::exception& p_Exception)
+		{
+			fprintf(stderr, "[WARNING] Benchmarking sample '%s' failed: %s\n", s_Sample.Name.c_str(), p_Exception.what());
+			++s_Result.Failures;
+		}
+	}
+
+	s_Result.PeakRssKb = GetPeakRssKb();
+
+	return s_Result;
+}
+
+static double MBPerSecond(uint64_t p_Bytes, double p_Seconds)
+{
+	if (p_Seconds <= 0.0)
+		return 0.0;
+
+	return (static_cast<double>(p_Bytes) / (1024.0 * 1024.0)) / p_Seconds;
+}
+
+static double PerConversion(uint64_t p_Value, uint64_t p_Conversions)
+{
+	if (p_Conversions == 0)
+		return 0.0;
+
+	return static_cast<double>(p_Value) / static_cast<double>(p_Conversions);
+}
+
+static void WriteJsonResults(FILE* p_Output, const std::vector<BenchResult>& p_Results)
+{
+	fprintf(p_Output, "[\n");
+
+	for (size_t i = 0; i < p_Results.size(); ++i)
+	{
+		const auto& s_Result = p_Results[i];
+
+		fprintf(p_Output, "\t{");
+		fprintf(p_Output, "\"game\":\"%s\",", s_Result.Game.c_str());
+		fprintf(p_Output, "\"type\":\"%s\",", s_Result.ResourceType.c_str());
+		fprintf(p_Output, "\"samples\":%zu,", s_Result.SampleCount);
+		fprintf(p_Output, "\"failures\":%zu,", s_Result.Failures);
+		fprintf(p_Output, "\"conversions\":%llu,", static_cast<unsigned long long>(s_Result.Conversions));
+		fprintf(p_Output, "\"resource_bytes\":%llu,", static_cast<unsigned long long>(s_Result.ResourceBytes));
+		fprintf(p_Output, "\"json_bytes\":%llu,", static_cast<unsigned long long>(s_Result.JsonBytes));
+		fprintf(p_Output, "\"to_json_mbps\":%.3f,", MBPerSecond(s_Result.ResourceBytes, s_Result.ToJsonSeconds));
+		fprintf(p_Output, "\"from_json_mbps\":%.3f,", MBPerSecond(s_Result.JsonBytes, s_Result.FromJsonSeconds));
+		fprintf(p_Output, "\"to_json_rl_allocs\":%.2f,", PerConversion(s_Result.ToJsonRlAllocs, s_Result.Conversions));
+		fprintf(p_Output, "\"to_json_heap_allocs\":%.2f,", PerConversion(s_Result.ToJsonHeapAllocs, s_Result.Conversions));
+		fprintf(p_Output, "\"to_json_alloc_bytes\":%.0f,", PerConversion(s_Result.ToJsonAllocBytes, s_Result.Conversions));
+		fprintf(p_Output, "\"from_json_rl_allocs\":%.2f,", PerConversion(s_Result.FromJsonRlAllocs, s_Result.Conversions));
+		fprintf(p_Output, "\"from_json_heap_allocs\":%.2f,", PerConversion(s_Result.FromJsonHeapAllocs, s_Result.Conversions));
+		fprintf(p_Output, "\"from_json_alloc_bytes\":%.0f,", PerConversion(s_Result.FromJsonAllocBytes, s_Result.Conversions));
+		fprintf(p_Output, "\"peak_rss_kb\":%llu", static_cast<unsigned long long>(s_Result.PeakRssKb));
+		fprintf(p_Output, "}%s\n", i + 1 < p_Results.size() ? "," : "");
+	}
+
+	fprintf(p_Output, "]\n");
+}
+
+static void WriteCsvResults(FILE* p_Output, const std::vector<BenchResult>& p_Results)
+{
+	fprintf(p_Output, "game,type,samples,failures,conversions,resource_bytes,json_bytes,to_json_mbps,from_json_mbps,to_json_rl_allocs,to_json_heap_allocs,to_json_alloc_bytes,from_json_rl_allocs,from_json_heap_allocs,from_json_alloc_bytes,peak_rss_kb\n");
+
+	for (const auto& s_Result : p_Results)
+	{
+		fprintf(p_Output, "%s,%s,%zu,%zu,%llu,%llu,%llu,%.3f,%.3f,%.2f,%.2f,%.0f,%.2f,%.2f,%.0f,%llu\n",
+			s_Result.Game.c_str(),
+			s_Result.ResourceType.c_str(),
+			s_Result.SampleCount,
+			s_Result.Failures,
+			static_cast<unsigned long long>(s_Result.Conversions),
+			static_cast<unsigned long long>(s_Result.ResourceBytes),
+			static_cast<unsigned long long>(s_Result.JsonBytes),
+			MBPerSecond(s_Result.ResourceBytes, s_Result.ToJsonSeconds),
+			MBPerSecond(s_Result.JsonBytes, s_Result.FromJsonSeconds),
+			PerConversion(s_Result.ToJsonRlAllocs, s_Result.Conversions),
+			PerConversion(s_Result.ToJsonHeapAllocs, s_Result.Conversions),
+			PerConversion(s_Result.ToJsonAllocBytes, s_Result.Conversions),
+			PerConversion(s_Result.FromJsonRlAllocs, s_Result.Conversions),
+			PerConversion(s_Result.FromJsonHeapAllocs, s_Result.Conversions),
+			PerConversion(s_Result.FromJsonAllocBytes, s_Result.Conversions),
+			static_cast<unsigned long long>(s_Result.PeakRssKb)
+		);
+	}
+}
+
+void PrintHelp()
+{
+	printf("Usage: " EXECUTABLE " [options]\n");
+	printf("\n");
+	printf("Benchmarks binary -> json and json -> binary conversion for every supported resource type of every game.\n");
+	printf("At least one of --samples or --synthesize must be specified.\n");
+	printf("\n");
+	printf("Sample resources:\n");
+	printf("\tThe samples path must contain one folder per game (HM2016, HM2, HM3, KNT), each containing resource\n");
+	printf("\tfiles named after their resource type (eg. " SAMPLE_PATH "/HM3/XXXX.TEMP). Sub-folders are searched too.\n");
+	printf("\tResource types without any samples are reported with zero conversions.\n");
+	printf("\n");
+	printf("Synthetic resources:\n");
+	printf("\tThe types path must contain one folder per game, each containing the ZHMTypes.json file produced by\n");
+	printf("\tCodeGen for that game (eg. " SAMPLE_PATH "/HM3/ZHMTypes.json). One resource is synthesized per type and seed.\n");
+	printf("\n");
+	printf("Options:\n");
+	printf("\t--samples <path>\tBenchmark the resources found in the specified folder.\n");
+	printf("\t--synthesize <path>\tBenchmark synthetic resources generated from the type information in the specified folder.\n");
+	printf("\t--seeds <n>\tNumber of synthetic resources to generate per resource type. Defaults to 1.\n");
+	printf("\t--root-array-length <n>\tNumber of elements in top-level arrays of synthetic resources. Defaults to 1000.\n");
+	printf("\t--nested-array-length <n>\tNumber of elements in all other arrays of synthetic resources. Defaults to 8.\n");
+	printf("\t--iterations <n>\tNumber of times each sample is converted in each direction. Defaults to 3.\n");
+	printf("\t--format <json|csv>\tOutput format of the results. Defaults to json.\n");
+	printf("\t--output <path>\tWrite the results to the specified file instead of stdout.\n");
+	printf("\t--game <game>\tOnly benchmark the specified game. Can be specified multiple times.\n");
+	printf("\t--type <type>\tOnly benchmark the specified resource type. Can be specified multiple times.\n");
+}
+
+int main(int argc, char** argv)
+{
+	std::filesystem::path s_SamplesPath;
+	std::filesystem::path s_TypesPath;
+
+	int s_Iterations = 3;
+	int s_Seeds = 1;
+	std::string s_Format = "json";
+	std::string s_OutputPath;
+	std::vector<std::string> s_GameFilter;
+	std::vector<std::string> s_TypeFilter;
+
+	SyntheticResourceOptions s_SyntheticOptions {
+		.Seed = 0,
+		.RootArrayLength = 1000,
+		.NestedArrayLength = 8,
+		.MaxStringLength = 32,
+		.MaxDepth = 6,
+	};
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string s_Arg(argv[i]);
+
+		if (i + 1 >= argc)
+		{
+			PrintHelp();
+			return 1;
+		}
+
+		if (s_Arg == "--samples")
+			s_SamplesPath = argv[++i];
+		else if (s_Arg == "--synthesize")
+			s_TypesPath = argv[++i];
+		else if (s_Arg == "--seeds")
+			s_Seeds = std::max(1, atoi(argv[++i]));
+		else if (s_Arg == "--root-array-length")
+			s_SyntheticOptions.RootArrayLength = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+		else if (s_Arg == "--nested-array-length")
+			s_SyntheticOptions.NestedArrayLength = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+		else if (s_Arg == "--iterations")
+			s_Iterations = std::max(1, atoi(argv[++i]));
+		else if (s_Arg == "--format")
+			s_Format = argv[++i];
+		else if (s_Arg == "--output")
+			s_OutputPath = argv[++i];
+		else if (s_Arg == "--game")
+			s_GameFilter.emplace_back(argv[++i]);
+		else if (s_Arg == "--type")
+			s_TypeFilter.emplace_back(argv[++i]);
+		else
+		{
+			PrintHelp();
+			return 1;
+		}
+	}
+
+	if ((s_SamplesPath.empty() && s_TypesPath.empty()) || (s_Format != "json" && s_Format != "csv"))
+	{
+		PrintHelp();
+		return 1;
+	}
+
+	if (!s_SamplesPath.empty() && !is_directory(s_SamplesPath))
+	{
+		fprintf(stderr, "[ERROR] Could not find the samples folder you specified.\n");
+		return 1;
+	}
+
+	if (!s_TypesPath.empty() && !is_directory(s_TypesPath))
+	{
+		fprintf(stderr, "[ERROR] Could not find the types folder you specified.\n");
+		return 1;
+	}
+
+	std::vector<BenchResult> s_Results;
+
+	for (auto& s_Game : g_Games)
+	{
+		if (!s_GameFilter.empty() && std::find(s_GameFilter.begin(), s_GameFilter.end(), s_Game.Name) == s_GameFilter.end())
+			continue;
+
+		// Route all of this library's allocations through our counting allocator.
+		*s_Game.UpstreamAllocator = s_Game.GetAllocator();
+		s_Game.SetAllocator(s_Game.CountingAllocator);
+
+		auto* s_ResourceTypes = s_Game.GetSupportedResourceTypes();
+
+		std::vector<std::string> s_SortedTypes(s_ResourceTypes->Types, s_ResourceTypes->Types + s_ResourceTypes->TypeCount);
+		std::sort(s_SortedTypes.begin(), s_SortedTypes.end());
+
+		s_Game.FreeSupportedResourceTypes(s_ResourceTypes);
+
+		for (const auto& s_ResourceType : s_SortedTypes)
+		{
+			if (!s_TypeFilter.empty() && std::find(s_TypeFilter.begin(), s_TypeFilter.end(), s_ResourceType) == s_TypeFilter.end())
+				continue;
+
+			std::vector<BenchSample> s_Samples;
+
+			if (!s_SamplesPath.empty())
+				LoadSamples(s_SamplesPath / s_Game.Name, s_ResourceType, s_Samples);
+
+			if (!s_TypesPath.empty())
+			{
+				const auto s_TypesJsonPath = s_TypesPath / s_Game.Name / "ZHMTypes.json";
+
+				for (int s_Seed = 0; s_Seed < s_Seeds; ++s_Seed)
+				{
+					s_SyntheticOptions.Seed = s_Seed;
+					SynthesizeSample(s_Game, s_ResourceType, s_TypesJsonPath, s_SyntheticOptions, s_Samples);
+				}
+			}
+
+			fprintf(stderr, "[INFO] Benchmarking %s %s (%zu samples).\n", s_Game.Name, s_ResourceType.c_str(), s_Samples.size());
+
+			s_Results.push_back(BenchResourceType(s_Game, s_ResourceType, s_Samples, s_Iterations));
+		}
+
+		s_Game.SetAllocator(*s_Game.UpstreamAllocator);
+	}
+
+	FILE* s_Output = stdout;
+
+	if (!s_OutputPath.empty())
+	{
+		s_Output = fopen(s_OutputPath.c_str(), "w");
+
+		if (s_Output == nullptr)
+		{
+			fprintf(stderr, "[ERROR] Could not open output file '%s'.\n", s_OutputPath.c_str());
+			return 1;
+		}
+	}
+
+	if (s_Format == "csv")
+		WriteCsvResults(s_Output, s_Results);
+	else
+		WriteJsonResults(s_Output, s_Results);
+
+	if (s_Output != stdout)
+		fclose(s_Output);
+
+	return 0;
+}
@@ -2,6 +2,7 @@
 #include <fstream>
 #include <algorithm>
 #include <filesystem>
+#include <thread>
 
 #include <ResourceLib_HM3.h>
 #include <ResourceLib_HM2.h>
@@ -50,13 +51,337 @@ bool ResourceFromJson(const std::filesystem::path& p_JsonFilePath, const std::fi
 	return p_Generator->FromJsonFileToResourceFile(p_JsonFilePath.string().c_str(), p_OutputFilePath.string().c_str(), p_Compatible);
 }
 
+bool ResourceToCbor(const std::filesystem::path& p_InputFilePath, const std::filesystem::path& p_OutputFilePath, ResourceConverter* p_Converter)
+{
+	// Read the entire file to memory.
+	const auto s_FileSize = file_size(p_InputFilePath);
+	std::ifstream s_FileStream(p_InputFilePath, std::ios::in | std::ios::binary);
+
+	void* s_FileData = malloc(s_FileSize);
+	s_FileStream.read(static_cast<char*>(s_FileData), s_FileSize);
+
+	s_FileStream.close();
+
+	const auto s_Result = p_Converter->FromMemoryToCborFile(s_FileData, s_FileSize, p_OutputFilePath.string().c_str());
+
+	free(s_FileData);
+
+	return s_Result;
+}
+
+bool ResourceFromCbor(const std::filesystem::path& p_CborFilePath, const std::filesystem::path& p_OutputFilePath, ResourceGenerator* p_Generator, bool p_Compatible)
+{
+	// Read the entire file to memory.
+	const auto s_FileSize = file_size(p_CborFilePath);
+	std::ifstream s_FileStream(p_CborFilePath, std::ios::in | std::ios::binary);
+
+	void* s_FileData = malloc(s_FileSize);
+	s_FileStream.read(static_cast<char*>(s_FileData), s_FileSize);
+
+	s_FileStream.close();
+
+	const auto s_Result = p_Generator->FromCborToResourceFile(s_FileData, s_FileSize, p_OutputFilePath.string().c_str(), p_Compatible);
+
+	free(s_FileData);
+
+	return s_Result;
+}
+
+bool SynthesizeResource(HitmanVersion p_Version, const std::string& p_ResourceType, const std::filesystem::path& p_TypesJsonPath, const std::filesystem::path& p_OutputFilePath, const SyntheticResourceOptions& p_Options)
+{
+	ResourceMem* (*s_Synthesize)(const char*, const char*, const SyntheticResourceOptions*) = nullptr;
+	void (*s_Free)(ResourceMem*) = nullptr;
+
+	switch (p_Version)
+	{
+	case HitmanVersion::Hitman2016:
+		s_Synthesize = HM2016_SynthesizeResource;
+		s_Free = HM2016_FreeResourceMem;
+		break;
+
+	case HitmanVersion::Hitman2:
+		s_Synthesize = HM2_SynthesizeResource;
+		s_Free = HM2_FreeResourceMem;
+		break;
+
+	case HitmanVersion::Hitman3:
+		s_Synthesize = HM3_SynthesizeResource;
+		s_Free = HM3_FreeResourceMem;
+		break;
+
+	case HitmanVersion::FirstLight007:
+		s_Synthesize = KNT_SynthesizeResource;
+		s_Free = KNT_FreeResourceMem;
+		break;
+
+	default:
+		return false;
+	}
+
+	auto* s_Resource = s_Synthesize(p_ResourceType.c_str(), p_TypesJsonPath.string().c_str(), &p_Options);
+
+	if (s_Resource == nullptr)
+		return false;
+
+	std::ofstream s_OutputStream(p_OutputFilePath, std::ios::out | std::ios::binary);
+	s_OutputStream.write(static_cast<const char*>(s_Resource->ResourceData), s_Resource->DataSize);
+
+	const bool s_Result = static_cast<bool>(s_OutputStream);
+
+	s_Free(s_Resource);
+
+	return s_Result;
+}
+
+void PrintStats(HitmanVersion p_Version)
+{
+	ResourceStatsArray* (*s_GetStats)() = nullptr;
+	void (*s_FreeStats)(ResourceStatsArray*) = nullptr;
+
+	switch (p_Version)
+	{
+	case HitmanVersion::Hitman2016:
+		s_GetStats = HM2016_GetStats;
+		s_FreeStats = HM2016_FreeStats;
+		break;
+
+	case HitmanVersion::Hitman2:
+		s_GetStats = HM2_GetStats;
+		s_FreeStats = HM2_FreeStats;
+		break;
+
+	case HitmanVersion::Hitman3:
+		s_GetStats = HM3_GetStats;
+		s_FreeStats = HM3_FreeStats;
+		break;
+
+	case HitmanVersion::FirstLight007:
+		s_GetStats = KNT_GetStats;
+		s_FreeStats = KNT_FreeStats;
+		break;
+
+	default:
+		return;
+	}
+
+	static const char* s_PhaseNames[ResourcePhase_Count] = {
+		"File IO",
+		"Relocation",
+		"Json write",
+		"Json parse",
+		"Serialize",
+		"Segment generation",
+	};
+
+	auto* s_Stats = s_GetStats();
+
+	for (size_t i = 0; i < s_Stats->StatsCount; ++i)
+	{
+		const auto& s_TypeStats = s_Stats->Stats[i];
+
+		printf("\n");
+		printf("%s (%llu conversions, %llu generations):\n", s_TypeStats.ResourceType, static_cast<unsigned long long>(s_TypeStats.Conversions), static_cast<unsigned long long>(s_TypeStats.Generations));
+
+		for (int j = 0; j < ResourcePhase_Count; ++j)
+		{
+			const auto& s_Phase = s_TypeStats.Phases[j];
+
+			if (s_Phase.Calls == 0)
+				continue;
+
+			printf(
+				"\t%-20s %10.3f ms %10llu allocations %14llu bytes\n",
+				s_PhaseNames[j],
+				static_cast<double>(s_Phase.Nanoseconds) / 1000000.0,
+				static_cast<unsigned long long>(s_Phase.Allocations),
+				static_cast<unsigned long long>(s_Phase.AllocatedBytes)
+			);
+		}
+	}
+
+	s_FreeStats(s_Stats);
+}
+
+void SetTracingEnabled(HitmanVersion p_Version, bool p_Enabled)
+{
+	switch (p_Version)
+	{
+	case HitmanVersion::Hitman2016:
+		HM2016_SetTracingEnabled(p_Enabled);
+		break;
+
+	case HitmanVersion::Hitman2:
+		HM2_SetTracingEnabled(p_Enabled);
+		break;
+
+	case HitmanVersion::Hitman3:
+		HM3_SetTracingEnabled(p_Enabled);
+		break;
+
+	case HitmanVersion::FirstLight007:
+		KNT_SetTracingEnabled(p_Enabled);
+		break;
+
+	default:
+		break;
+	}
+}
+
+void SetPayloadDeduplicationEnabled(HitmanVersion p_Version, bool p_Enabled)
+{
+	switch (p_Version)
+	{
+	case HitmanVersion::Hitman2016:
+		HM2016_SetPayloadDeduplicationEnabled(p_Enabled);
+		break;
+
+	case HitmanVersion::Hitman2:
+		HM2_SetPayloadDeduplicationEnabled(p_Enabled);
+		break;
+
+	case HitmanVersion::Hitman3:
+		HM3_SetPayloadDeduplicationEnabled(p_Enabled);
+		break;
+
+	case HitmanVersion::FirstLight007:
+		KNT_SetPayloadDeduplicationEnabled(p_Enabled);
+		break;
+
+	default:
+		break;
+	}
+}
+
+void SetBinarySidecarThreshold(HitmanVersion p_Version, size_t p_MinSize)
+{
+	switch (p_Version)
+	{
+	case HitmanVersion::Hitman2016:
+		HM2016_SetBinarySidecarThreshold(p_MinSize);
+		break;
+
+	case HitmanVersion::Hitman2:
+		HM2_SetBinarySidecarThreshold(p_MinSize);
+		break;
+
+	case HitmanVersion::Hitman3:
+		HM3_SetBinarySidecarThreshold(p_MinSize);
+		break;
+
+	case HitmanVersion::FirstLight007:
+		KNT_SetBinarySidecarThreshold(p_MinSize);
+		break;
+
+	default:
+		break;
+	}
+}
+
+void SetWorkerThreadCount(HitmanVersion p_Version, size_t p_ThreadCount)
+{
+	switch (p_Version)
+	{
+	case HitmanVersion::Hitman2016:
+		HM2016_SetWorkerThreadCount(p_ThreadCount);
+		break;
+
+	case HitmanVersion::Hitman2:
+		HM2_SetWorkerThreadCount(p_ThreadCount);
+		break;
+
+	case HitmanVersion::Hitman3:
+		HM3_SetWorkerThreadCount(p_ThreadCount);
+		break;
+
+	case HitmanVersion::FirstLight007:
+		KNT_SetWorkerThreadCount(p_ThreadCount);
+		break;
+
+	default:
+		break;
+	}
+}
+
+bool LoadTypes(HitmanVersion p_Version, const std::filesystem::path& p_TypesJsonPath)
+{
+	const auto s_TypesJsonPath = p_TypesJsonPath.string();
+	int64_t s_Result = -1;
+
+	switch (p_Version)
+	{
+	case HitmanVersion::Hitman2016:
+		s_Result = HM2016_LoadTypes(s_TypesJsonPath.c_str());
+		break;
+
+	case HitmanVersion::Hitman2:
+		s_Result = HM2_LoadTypes(s_TypesJsonPath.c_str());
+		break;
+
+	case HitmanVersion::Hitman3:
+		s_Result = HM3_LoadTypes(s_TypesJsonPath.c_str());
+		break;
+
+	case HitmanVersion::FirstLight007:
+		s_Result = KNT_LoadTypes(s_TypesJsonPath.c_str());
+		break;
+
+	default:
+		break;
+	}
+
+	return s_Result >= 0;
+}
+
+bool WriteTrace(HitmanVersion p_Version, const std::filesystem::path& p_TraceFilePath)
+{
+	JsonString* (*s_GetTraceJson)() = nullptr;
+	void (*s_FreeJsonString)(JsonString*) = nullptr;
+
+	switch (p_Version)
+	{
+	case HitmanVersion::Hitman2016:
+		s_GetTraceJson = HM2016_GetTraceJson;
+		s_FreeJsonString = HM2016_FreeJsonString;
+		break;
+
+	case HitmanVersion::Hitman2:
+		s_GetTraceJson = HM2_GetTraceJson;
+		s_FreeJsonString = HM2_FreeJsonString;
+		break;
+
+	case HitmanVersion::Hitman3:
+		s_GetTraceJson = HM3_GetTraceJson;
+		s_FreeJsonString = HM3_FreeJsonString;
+		break;
+
+	case HitmanVersion::FirstLight007:
+		s_GetTraceJson = KNT_GetTraceJson;
+		s_FreeJsonString = KNT_FreeJsonString;
+		break;
+
+	default:
+		return false;
+	}
+
+	auto* s_Trace = s_GetTraceJson();
+
+	std::ofstream s_OutputStream(p_TraceFilePath, std::ios::out | std::ios::binary);
+	s_OutputStream.write(s_Trace->JsonData, s_Trace->StrSize);
+
+	const bool s_Result = static_cast<bool>(s_OutputStream);
+
+	s_FreeJsonString(s_Trace);
+
+	return s_Result;
+}
+
 void PrintHelp()
 {
 	printf("Usage: " EXECUTABLE " <game> <mode> <resource-type> <input-path> <output-path> [options]\n");
 
 	printf("\n");
 	printf("game can be one of: HM2016, HM2, HM3, KNT\n");
-	printf("mode can be one of: convert, generate\n");
+	printf("mode can be one of: convert, generate, synthesize\n");
 	printf("resource-type can be one of:\n");
 
 	printf("\n");
@@ -131,8 +456,26 @@ void PrintHelp()
 	printf("\tBy using the \"generate\" mode, you can generate a binary resource from a JSON file.\n");
 	printf("\tExample: " EXECUTABLE " HM3 generate TEMP " SAMPLE_PATH "file.json " SAMPLE_PATH "file.TEMP\n");
 	printf("\n");
+	printf("\n");
+	printf("Synthesizing resources:\n");
+	printf("\tBy using the \"synthesize\" mode, you can generate a binary resource filled with deterministic pseudo-random data.\n");
+	printf("\tThe input path must point to the ZHMTypes.json file produced by CodeGen for the selected game.\n");
+	printf("\tExample: " EXECUTABLE " HM3 synthesize TEMP " SAMPLE_PATH "ZHMTypes.json " SAMPLE_PATH "file.TEMP --seed 1 --root-array-length 5000\n");
+	printf("\n");
 	printf("Options:\n");
 	printf("\t--compatible\tTry to generate resources that more closely resemble the original ones. Doesn't matter when producing files for use in the game, but third party tools might work better with them. Enabling this makes generation take significantly longer.\n");
+	printf("\t--dedup\tShare a single copy of the data of identical strings and arrays of primitive values when generating resources, making them smaller.\n");
+	printf("\t--sidecar <n>\tWhen converting resources to JSON, write binary fields (eg. byte blobs and arrays of numbers) of at least <n> bytes to a .bin file next to the JSON file instead of inlining them. Generating resources from such JSON files reads the data back from the .bin file.\n");
+	printf("\t--threads <n>\tSplit the conversion and generation of large arrays (eg. TEMP sub-entities) across <n> threads. Pass 0 to use all cores. The output is the same as with a single thread, which is the default.\n");
+	printf("\t--types <path>\tLoad the layouts of types this tool doesn't know about (eg. ones added in a game update) from the given ZHMTypes.json file produced by CodeGen.\n");
+	printf("\t--cbor\tConvert resources to CBOR instead of JSON, or generate them from CBOR files. The CBOR documents have the same structure as the JSON ones, with arrays of numbers stored as typed arrays.\n");
+	printf("\t--seed <n>\tSeed used when synthesizing resources. Defaults to 0.\n");
+	printf("\t--root-array-length <n>\tNumber of elements in top-level arrays of synthesized resources (eg. TEMP sub-entities). Defaults to 100.\n");
+	printf("\t--nested-array-length <n>\tNumber of elements in all other arrays of synthesized resources (eg. TEMP sub-entity properties). Defaults to 8.\n");
+	printf("\t--max-string-length <n>\tMaximum length of strings in synthesized resources. Defaults to 32.\n");
+	printf("\t--max-depth <n>\tNesting depth after which synthesized arrays are left empty. Defaults to 6.\n");
+	printf("\t--trace <path>\tWrite a Chrome trace event file of the operation to the given path. It can be opened in chrome://tracing or Perfetto.\n");
+	printf("\t--stats\tPrint the time spent and the allocations made in each phase of the operation once it completes.\n");
 }
 
 int TryConvertFile(const std::string& p_FilePath)
@@ -265,11 +608,52 @@ int main(int argc, char** argv)
 	const std::string s_OutputPathStr(argv[5]);
 	
 	bool s_Compatible = false;
+	bool s_PrintStats = false;
+	bool s_Cbor = false;
+	bool s_Dedup = false;
+	size_t s_SidecarThreshold = 0;
+	size_t s_ThreadCount = 1;
+	std::string s_TracePathStr;
+	std::string s_TypesPathStr;
+
+	SyntheticResourceOptions s_SyntheticOptions {
+		.Seed = 0,
+		.RootArrayLength = 100,
+		.NestedArrayLength = 8,
+		.MaxStringLength = 32,
+		.MaxDepth = 6,
+	};
 
 	for (int i = 6; i < argc; ++i)
 	{
-		if (std::string(argv[6]) == "--compatible")
+		const std::string s_Option(argv[i]);
+
+		if (s_Option == "--compatible")
 			s_Compatible = true;
+		else if (s_Option == "--cbor")
+			s_Cbor = true;
+		else if (s_Option == "--dedup")
+			s_Dedup = true;
+		else if (s_Option == "--stats")
+			s_PrintStats = true;
+		else if (i + 1 < argc && s_Option == "--sidecar")
+			s_SidecarThreshold = strtoull(argv[++i], nullptr, 10);
+		else if (i + 1 < argc && s_Option == "--threads")
+			s_ThreadCount = strtoull(argv[++i], nullptr, 10);
+		else if (i + 1 < argc && s_Option == "--types")
+			s_TypesPathStr = argv[++i];
+		else if (i + 1 < argc && s_Option == "--trace")
+			s_TracePathStr = argv[++i];
+		else if (i + 1 < argc && s_Option == "--seed")
+			s_SyntheticOptions.Seed = strtoull(argv[++i], nullptr, 10);
+		else if (i + 1 < argc && s_Option == "--root-array-length")
+			s_SyntheticOptions.RootArrayLength = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+		else if (i + 1 < argc && s_Option == "--nested-array-length")
+			s_SyntheticOptions.NestedArrayLength = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+		else if (i + 1 < argc && s_Option == "--max-string-length")
+			s_SyntheticOptions.MaxStringLength = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+		else if (i + 1 < argc && s_Option == "--max-depth")
+			s_SyntheticOptions.MaxDepth = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
 	}
 
 	if (s_GameVersionStr != "HM2016" && s_GameVersionStr != "HM2" && s_GameVersionStr != "HM3" && s_GameVersionStr != "KNT")
@@ -278,7 +662,7 @@ int main(int argc, char** argv)
 		return 1;
 	}
 	
-	if (s_OperatingMode != "convert" && s_OperatingMode != "generate")
+	if (s_OperatingMode != "convert" && s_OperatingMode != "generate" && s_OperatingMode != "synthesize")
 	{
 		PrintHelp();
 		return 1;
@@ -343,18 +727,51 @@ int main(int argc, char** argv)
 		return 1;
 	}
 
+	if (!s_TracePathStr.empty())
+		SetTracingEnabled(s_GameVersion, true);
+
+	if (s_Dedup)
+		SetPayloadDeduplicationEnabled(s_GameVersion, true);
+
+	if (s_SidecarThreshold != 0)
+		SetBinarySidecarThreshold(s_GameVersion, s_SidecarThreshold);
+
+	if (s_ThreadCount == 0)
+		s_ThreadCount = std::max(1u, std::thread::hardware_concurrency());
+
+	if (s_ThreadCount > 1)
+		SetWorkerThreadCount(s_GameVersion, s_ThreadCount);
+
+	if (!s_TypesPathStr.empty() && !LoadTypes(s_GameVersion, s_TypesPathStr))
+		return 1;
+
 	try
 	{
 		if (s_OperatingMode == "convert")
 		{
-			if (!ResourceToJson(s_InputPath, s_OutputPath, s_ResourceConverter))
+			const bool s_Result = s_Cbor ?
+				ResourceToCbor(s_InputPath, s_OutputPath, s_ResourceConverter) :
+				ResourceToJson(s_InputPath, s_OutputPath, s_ResourceConverter);
+
+			if (!s_Result)
 			{
 				return 1;
 			}
 		}
 		else if (s_OperatingMode == "generate")
 		{
-			if (!ResourceFromJson(s_InputPath, s_OutputPath, s_ResourceGenerator, s_Compatible))
+			const bool s_Result = s_Cbor ?
+				ResourceFromCbor(s_InputPath, s_OutputPath, s_ResourceGenerator, s_Compatible) :
+				ResourceFromJson(s_InputPath, s_OutputPath, s_ResourceGenerator, s_Compatible);
+
+			if (!s_Result)
+			{
+				return 1;
+			}
+		}
+		else if (s_OperatingMode == "synthesize")
+		{
+			if (!SynthesizeResource(s_GameVersion, s_ResourceType, s_InputPath, s_OutputPath, s_SyntheticOptions))
 			{
 				return 1;
 			}
@@ -366,5 +783,14 @@ int main(int argc, char** argv)
 		return 1;
 	}
 
+	if (s_PrintStats)
+		PrintStats(s_GameVersion);
+
+	if (!s_TracePathStr.empty() && !WriteTrace(s_GameVersion, s_TracePathStr))
+	{
+		fprintf(stderr, "[ERROR] Could not write the trace file.\n");
+		return 1;
+	}
+
 	return 0;
 }